@@ -11,6 +11,7 @@
         .import         popax, __ZP_START__, jmpvec
 
         .include        "zeropage.inc"
+        .include        "zpargs.inc"
 
         .macpack        generic
 
@@ -29,6 +30,8 @@ irqsp:  .res    2
 
 zpsave: .res    zpsavespace
 
+argsave: .res   zpargssize
+
 ; ---------------------------------------------------------------------------
 
 .code
@@ -84,6 +87,13 @@ zpsave: .res    zpsavespace
         dex
         bpl     @L2
 
+        ; Save the argument block of zpargs functions
+        ldx     #zpargssize-1
+@L4:    lda     zpargs,x
+        sta     argsave,x
+        dex
+        bpl     @L4
+
         ; Save jmpvec
         lda     jmpvec+1
         pha
@@ -109,6 +119,13 @@ zpsave: .res    zpsavespace
         dex
         bpl     @L3
 
+        ; Restore the argument block
+        ldx     #zpargssize-1
+@L5:    lda     argsave,x
+        sta     zpargs,x
+        dex
+        bpl     @L5
+
         ; Restore jmpvec and return
         pla
         sta     jmpvec+2
@@ -0,0 +1,27 @@
+;
+; CC65 runtime: Pop y bytes from the stack into the zero page argument block
+;
+; Used to load the arguments of a zpargs function before the call, and to
+; restore the block after a call. Preserves a, x and sreg.
+;
+
+        .export         popzpargs
+        .import         addysp
+        .importzp       c_sp, tmp1
+
+        .include        "zpargs.inc"
+
+.proc   popzpargs
+
+        sty     tmp1            ; Remember the count
+        pha                     ; Save A
+        dey
+@L1:    lda     (c_sp),y
+        sta     zpargs,y
+        dey
+        bpl     @L1
+        pla                     ; Restore A
+        ldy     tmp1
+        jmp     addysp          ; Drop the bytes, preserves A and X
+
+.endproc
@@ -0,0 +1,26 @@
+;
+; CC65 runtime: Push y bytes of the zero page argument block onto the stack
+;
+; Used to save the part of the block that is in use across a function call.
+; Preserves a and x.
+;
+
+        .export         pushzpargs
+        .import         subysp
+        .importzp       c_sp
+
+        .include        "zpargs.inc"
+
+.proc   pushzpargs
+
+        pha                     ; Save A
+        jsr     subysp          ; Make room, y is preserved
+        dey
+@L1:    lda     zpargs,y
+        sta     (c_sp),y
+        dey
+        bpl     @L1
+        pla                     ; Restore A
+        rts
+
+.endproc
@@ -0,0 +1,19 @@
+;
+; CC65 runtime: Zero page argument block
+;
+; The block is used to pass the parameters of functions declared with
+; __attribute__ ((zpargs)), except for the rightmost one, which is passed
+; in the primary register as with __fastcall__.
+;
+
+        .include        "zpargs.inc"
+
+; ------------------------------------------------------------------------
+
+.if zpargsinzp
+.zeropage
+.else
+.bss
+.endif
+
+zpargs:         .res    zpargssize
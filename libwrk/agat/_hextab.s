@@ -0,0 +1,36 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/_hextab.c", 305, 1779181050
+	.export		__hextab
+
+.segment	"RODATA"
+
+__hextab:
+	.byte	$B0
+	.byte	$B1
+	.byte	$B2
+	.byte	$B3
+	.byte	$B4
+	.byte	$B5
+	.byte	$B6
+	.byte	$B7
+	.byte	$B8
+	.byte	$B9
+	.byte	$C1
+	.byte	$C2
+	.byte	$C3
+	.byte	$C4
+	.byte	$C5
+	.byte	$C6
+
@@ -0,0 +1,21 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/_longminstr.c", 343, 1779181050
+	.export		__longminstr
+
+.segment	"RODATA"
+
+__longminstr:
+	.byte	$AD,$B2,$B1,$B4,$B7,$B4,$B8,$B3,$B6,$B4,$B8,$00
+
@@ -0,0 +1,194 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/strqtok.c", 2005, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.import		_strchr
+	.export		_strqtok
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ strqtok (register char *s1, const char *s2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strqtok: near
+
+	.dbg	func, "strqtok", "00", static, "_strqtok"
+	.dbg	sym, "s1", "00", register, "regbank", 4
+	.dbg	sym, "s2", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/strqtok.c", 19
+	jsr     pushax
+	ldy     #$02
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "common/strqtok.c", 24
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0008
+	.dbg	line, "common/strqtok.c", 25
+	lda     M0003+1
+	sta     regbank+4+1
+	lda     M0003
+	sta     regbank+4
+	.dbg	line, "common/strqtok.c", 26
+	lda     M0001
+	cmp     #$A2
+	bne     L0008
+	.dbg	line, "common/strqtok.c", 27
+	jmp     L001F
+	.dbg	line, "common/strqtok.c", 33
+L0006:	lda     M0001
+	bne     L0009
+	.dbg	line, "common/strqtok.c", 35
+	tax
+	jmp     L0001
+	.dbg	line, "common/strqtok.c", 37
+L0009:	inc     regbank+4
+	bne     L0008
+	inc     regbank+4+1
+	.dbg	line, "common/strqtok.c", 32
+L0008:	jsr     pushw0sp
+	ldx     #$00
+	lda     (regbank+4,x)
+	sta     M0001
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+	.dbg	line, "common/strqtok.c", 39
+	lda     M0001
+	cmp     #$A2
+	.dbg	line, "common/strqtok.c", 40
+	beq     L000C
+	.dbg	line, "common/strqtok.c", 44
+	lda     regbank+4+1
+	sta     M0002+1
+	lda     regbank+4
+	sta     M0002
+	.dbg	line, "common/strqtok.c", 47
+	jmp     L000F
+	.dbg	line, "common/strqtok.c", 48
+L000D:	inc     regbank+4
+	bne     L000F
+	inc     regbank+4+1
+	.dbg	line, "common/strqtok.c", 47
+L000F:	ldy     #$00
+	lda     (regbank+4),y
+	sta     M0001
+	cmp     #$A2
+	beq     L001E
+	jsr     pushw0sp
+	ldx     #$00
+	lda     M0001
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+	.dbg	line, "common/strqtok.c", 50
+L001E:	lda     M0001
+	bne     L0018
+	.dbg	line, "common/strqtok.c", 54
+	jmp     L0015
+	.dbg	line, "common/strqtok.c", 61
+L000C:	inc     regbank+4
+	bne     L001F
+	inc     regbank+4+1
+	.dbg	line, "common/strqtok.c", 65
+L001F:	lda     #$00
+	sta     M0001
+	.dbg	line, "common/strqtok.c", 68
+	lda     regbank+4+1
+	sta     M0002+1
+	lda     regbank+4
+	sta     M0002
+	.dbg	line, "common/strqtok.c", 71
+	ldx     regbank+4+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$A2
+	jsr     _strchr
+	sta     regbank+4
+	stx     regbank+4+1
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+	bne     L0018
+	.dbg	line, "common/strqtok.c", 75
+	lda     #>(S0002)
+	sta     M0003+1
+	lda     #<(S0002)
+	.dbg	line, "common/strqtok.c", 76
+	jmp     L0021
+	.dbg	line, "common/strqtok.c", 80
+L0018:	lda     #$00
+	tay
+	sta     (regbank+4),y
+	.dbg	line, "common/strqtok.c", 81
+	inc     regbank+4
+	bne     L0015
+	inc     regbank+4+1
+	.dbg	line, "common/strqtok.c", 84
+L0015:	lda     regbank+4+1
+	sta     M0003+1
+	lda     regbank+4
+L0021:	sta     M0003
+	.dbg	line, "common/strqtok.c", 85
+	lda     M0002
+	ldx     M0002+1
+	.dbg	line, "common/strqtok.c", 86
+L0001:	pha
+	ldy     #$02
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+	.dbg	line
+.segment	"DATA"
+
+M0003:
+	.addr	S0001
+
+.segment	"RODATA"
+
+M0005:
+	.word	$0000
+M0004:
+	.word	$0000
+M0007:
+	.word	$0000
+M0006:
+	.word	$0000
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,124 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "tgi/tgi_pieslice.c", 3560, 1779181050
+	.dbg		file, "/root/repo/include/tgi.h", 10994, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-error.h", 3568, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/agat.h", 2116, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-kernel.h", 4287, 1779181050
+	.dbg		file, "/root/repo/include/cc65.h", 5121, 1779181050
+	.import		_tgi_line
+	.import		_tgi_arc
+	.export		_tgi_pieslice
+	.import		_tgi_imulround
+	.import		__sin
+	.import		__cos
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ tgi_pieslice (int x, int y, unsigned char rx, unsigned char ry, unsigned int sa, unsigned int ea)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tgi_pieslice: near
+
+	.dbg	func, "tgi_pieslice", "00", static, "_tgi_pieslice"
+	.dbg	sym, "x", "00", auto, 8
+	.dbg	sym, "y", "00", auto, 6
+	.dbg	sym, "rx", "00", auto, 5
+	.dbg	sym, "ry", "00", auto, 4
+	.dbg	sym, "sa", "00", auto, 2
+	.dbg	sym, "ea", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "tgi/tgi_pieslice.c", 55
+	jsr     pushax
+	.dbg	line, "tgi/tgi_pieslice.c", 57
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _tgi_arc
+	.dbg	line, "tgi/tgi_pieslice.c", 60
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     __cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0C
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     __sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	jsr     _tgi_line
+	.dbg	line, "tgi/tgi_pieslice.c", 61
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     __cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0C
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     __sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	jsr     _tgi_line
+	.dbg	line, "tgi/tgi_pieslice.c", 62
+	ldy     #$0A
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
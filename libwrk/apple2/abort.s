@@ -0,0 +1,61 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/abort.c", 244, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/signal.h", 3345, 1779181050
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.import		_stderr
+	.import		_fputs
+	.export		_abort
+	.import		_exit
+	.import		_raise
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$41,$42,$4E,$4F,$52,$4D,$41,$4C,$20,$50,$52,$4F,$47,$52,$41,$4D
+	.byte	$20,$54,$45,$52,$4D,$49,$4E,$41,$54,$49,$4F,$4E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ abort (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_abort: near
+
+	.dbg	func, "abort", "00", static, "_abort"
+
+.segment	"CODE"
+
+	.dbg	line, "common/abort.c", 16
+	ldx     #$00
+	txa
+	jsr     _raise
+	.dbg	line, "common/abort.c", 17
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	.dbg	line, "common/abort.c", 18
+	ldx     #$00
+	lda     #$03
+	jmp     _exit
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,1131 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "apple2/targetutil/convert.c", 10835, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/dirent.h", 4989, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/apple2.h", 12699, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/apple2_filetype.h", 17100, 1779181050
+	.dbg		file, "/root/repo/include/device.h", 3212, 1779181050
+	.dbg		file, "/root/repo/include/dio.h", 5473, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "__oserror", "00", extern, "___oserror"
+	.import		_strlen
+	.import		_strrchr
+	.import		_memcpy
+	.import		_memmove
+	.import		_strncasecmp
+	.import		___stroserror
+	.import		_exit
+	.import		_stderr
+	.import		_fprintf
+	.import		_getchar
+	.import		_gets
+	.import		_printf
+	.import		___oserror
+	.import		___mappederrno
+	.import		_opendir
+	.import		_readdir
+	.import		_getcurrentdevice
+	.import		_dio_open
+	.import		_dio_close
+	.import		_dio_read
+	.import		_dio_write
+	.export		_info_signature
+	.export		_dhandle
+	.export		_dir_entry
+	.export		_dir_block
+	.export		_index_block
+	.export		_master_block
+	.export		_vlir_block
+	.export		_header_block
+	.export		_main
+
+.segment	"DATA"
+
+_info_signature:
+	.byte	$03
+	.byte	$15
+	.byte	$BF
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$0A,$41,$70,$70,$6C,$65,$20,$47,$45,$4F,$53,$20,$43,$6F,$6E,$76
+	.byte	$65,$72,$74,$20,$31,$2E,$30,$0A,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$0A,$0A
+	.byte	$50,$61,$74,$68,$6E,$61,$6D,$65,$3A,$00
+S001B:
+	.byte	$43,$6F,$6E,$76,$65,$72,$74,$20,$74,$6F,$20,$27,$25,$2E,$2A,$73
+	.byte	$27,$20,$73,$75,$63,$63,$65,$73,$73,$66,$75,$6C,$00
+S0015:
+	.byte	$56,$4C,$49,$52,$20,$25,$75,$20,$73,$69,$7A,$65,$20,$25,$6C,$75
+	.byte	$20,$62,$79,$74,$65,$73,$0A,$00
+S0011:
+	.byte	$66,$69,$6C,$65,$20,$73,$69,$67,$6E,$61,$74,$75,$72,$65,$20,$6D
+	.byte	$69,$73,$6D,$61,$74,$63,$68,$00
+S0017:
+	.byte	$46,$69,$6C,$65,$20,$73,$69,$7A,$65,$20,$25,$6C,$75,$20,$62,$79
+	.byte	$74,$65,$73,$0A,$0A,$00
+S0001:
+	.byte	$25,$73,$20,$2D,$20,$65,$72,$72,$3A,$25,$30,$32,$78,$20,$2D,$20
+	.byte	$25,$73,$00
+S0012:
+	.byte	$0A,$53,$65,$71,$75,$65,$6E,$74,$69,$61,$6C,$20,$66,$69,$6C,$65
+	.byte	$0A,$00
+S0013:
+	.byte	$0A,$56,$4C,$49,$52,$20,$66,$69,$6C,$65,$0A,$00
+S0019:
+	.byte	$64,$69,$6F,$5F,$77,$72,$69,$74,$65,$2E,$33,$00
+S0018:
+	.byte	$64,$69,$6F,$5F,$77,$72,$69,$74,$65,$2E,$32,$00
+S0016:
+	.byte	$64,$69,$6F,$5F,$77,$72,$69,$74,$65,$2E,$31,$00
+S000F:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$34,$00
+S0009:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$33,$00
+S0008:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$32,$00
+S0014:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$36,$00
+S0010:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$35,$00
+S0007:
+	.byte	$64,$69,$6F,$5F,$72,$65,$61,$64,$2E,$31,$00
+S001A:
+	.byte	$64,$69,$6F,$5F,$63,$6C,$6F,$73,$65,$00
+S0006:
+	.byte	$64,$69,$6F,$5F,$6F,$70,$65,$6E,$00
+S0005:
+	.byte	$72,$65,$61,$64,$64,$69,$72,$00
+S0004:
+	.byte	$6F,$70,$65,$6E,$64,$69,$72,$00
+S0002	:=	S0001+16
+S0003:
+	.byte	$2E,$00
+
+.segment	"BSS"
+
+_dhandle:
+	.res	2,$00
+_dir_entry:
+	.res	2,$00
+_dir_block:
+	.res	512,$00
+_index_block:
+	.res	512,$00
+_master_block:
+	.res	512,$00
+_vlir_block:
+	.res	512,$00
+_header_block:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; void __near__ err_exit (char *operation, unsigned char oserr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_err_exit: near
+
+	.dbg	func, "err_exit", "00", static, "_err_exit"
+	.dbg	sym, "operation", "00", auto, 1
+	.dbg	sym, "oserr", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "apple2/targetutil/convert.c", 63
+	jsr     pusha
+	.dbg	line, "apple2/targetutil/convert.c", 64
+	ldy     #$00
+	lda     (c_sp),y
+	beq     L0002
+	.dbg	line, "apple2/targetutil/convert.c", 65
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 66
+	ldy     #$08
+	jsr     pushwysp
+	lda     ___oserror
+	jsr     pusha0
+	lda     ___oserror
+	jsr     ___stroserror
+	jsr     pushax
+	ldy     #$0A
+	.dbg	line, "apple2/targetutil/convert.c", 67
+	jmp     L0004
+	.dbg	line, "apple2/targetutil/convert.c", 68
+L0002:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 69
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$06
+L0004:	jsr     _fprintf
+	.dbg	line, "apple2/targetutil/convert.c", 71
+	jsr     _getchar
+	.dbg	line, "apple2/targetutil/convert.c", 72
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "apple2/targetutil/convert.c", 73
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ get_dir_entry (char *p_name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get_dir_entry: near
+
+	.dbg	func, "get_dir_entry", "00", static, "_get_dir_entry"
+	.dbg	sym, "p_name", "00", auto, 0
+	.dbg	sym, "d_name", "00", auto, -2
+	.dbg	sym, "f_name", "00", auto, -4
+	.dbg	sym, "f_namelen", "00", auto, -6
+	.dbg	sym, "dir", "00", auto, -8
+	.dbg	sym, "dirent", "00", auto, -10
+	.dbg	sym, "cur_addr", "00", auto, -12
+	.dbg	sym, "entry_length", "00", auto, -13
+	.dbg	sym, "entries_per_block", "00", auto, -14
+	.dbg	sym, "cur_entry", "00", auto, -15
+
+.segment	"CODE"
+
+	.dbg	line, "apple2/targetutil/convert.c", 77
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 89
+	ldy     #$0F
+	jsr     subysp
+	ldy     #$12
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$2F
+	jsr     _strrchr
+	ldy     #$0B
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 90
+	ldy     #$0C
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+	.dbg	line, "apple2/targetutil/convert.c", 91
+	ldy     #$10
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 92
+	ldy     #$0C
+	jsr     ldptr1ysp
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	ldy     #$0B
+	tax
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "apple2/targetutil/convert.c", 93
+	jmp     L0003
+	.dbg	line, "apple2/targetutil/convert.c", 94
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 95
+	ldy     #$10
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 97
+L0003:	ldy     #$0C
+	jsr     ldaxysp
+	jsr     _strlen
+	ldy     #$09
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 101
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _opendir
+	ldy     #$07
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 102
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	.dbg	line, "apple2/targetutil/convert.c", 103
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 105
+L0004:	ldy     #$08
+	jsr     ldaxysp
+	jsr     _readdir
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 106
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	.dbg	line, "apple2/targetutil/convert.c", 107
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 111
+L0005:	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$23
+	jsr     incaxy
+	ldy     #$02
+	jsr     ldaxidx
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 113
+	jsr     _getcurrentdevice
+	jsr     _dio_open
+	sta     _dhandle
+	stx     _dhandle+1
+	.dbg	line, "apple2/targetutil/convert.c", 114
+	jsr     bnegax
+	beq     L0006
+	.dbg	line, "apple2/targetutil/convert.c", 115
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 118
+L0006:	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$08
+	jsr     pushwysp
+	lda     #<(_dir_block)
+	ldx     #>(_dir_block)
+	jsr     _dio_read
+	tax
+	beq     L0015
+	.dbg	line, "apple2/targetutil/convert.c", 119
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 123
+L0015:	lda     _dir_block+35
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 124
+	lda     _dir_block+36
+	dey
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 127
+	tya
+	dey
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 135
+L0008:	ldy     #$00
+L0016:	lda     (c_sp),y
+	iny
+	cmp     (c_sp),y
+	bne     L000E
+	.dbg	line, "apple2/targetutil/convert.c", 138
+	lda     _dir_block+2
+	ldx     _dir_block+2+1
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 139
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	.dbg	line, "apple2/targetutil/convert.c", 140
+	lda     #$46
+	jsr     ___mappederrno
+	.dbg	line, "apple2/targetutil/convert.c", 141
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 145
+L000F:	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$08
+	jsr     pushwysp
+	lda     #<(_dir_block)
+	ldx     #>(_dir_block)
+	jsr     _dio_read
+	tax
+	beq     L0018
+	.dbg	line, "apple2/targetutil/convert.c", 146
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 150
+	lda     #$00
+L0018:	tay
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 155
+L000E:	ldx     #$00
+	lda     (c_sp,x)
+	jsr     pusha0
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     tosumula0
+	clc
+	adc     #<(_dir_block+4)
+	sta     _dir_entry
+	txa
+	adc     #>(_dir_block+4)
+	sta     _dir_entry+1
+	.dbg	line, "apple2/targetutil/convert.c", 158
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 159
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     (ptr1),y
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     bnega
+	jne     L0016
+	.dbg	line, "apple2/targetutil/convert.c", 161
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     (ptr1),y
+	ldx     #$00
+	and     #$0F
+	ldy     #$09
+	cmp     (c_sp),y
+	jne     L0008
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L0008
+	.dbg	line, "apple2/targetutil/convert.c", 162
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	jsr     incax1
+	jsr     pushax
+	ldy     #$10
+	jsr     pushwysp
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _strncasecmp
+	stx     tmp1
+	ora     tmp1
+	jne     L0008
+	.dbg	line, "apple2/targetutil/convert.c", 164
+	ldy     #$04
+	jsr     ldaxysp
+	.dbg	line, "apple2/targetutil/convert.c", 165
+	ldy     #$11
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+	.dbg	sym, "input", "00", auto, -80
+	.dbg	sym, "p_name", "00", auto, -82
+	.dbg	sym, "dir_addr", "00", auto, -84
+	.dbg	sym, "header_addr", "00", auto, -86
+	.dbg	sym, "index", "00", auto, -87
+	.dbg	sym, "size", "00", auto, -91
+
+.segment	"CODE"
+
+	.dbg	line, "apple2/targetutil/convert.c", 177
+	ldy     #$5B
+	jsr     subysp
+	ldy     #$5E
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvs     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	.dbg	line, "apple2/targetutil/convert.c", 178
+	ldy     #$5C
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	.dbg	line, "apple2/targetutil/convert.c", 179
+	jmp     L002C
+	.dbg	line, "apple2/targetutil/convert.c", 184
+L0002:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 185
+	lda     #$0B
+	jsr     leaa0sp
+	jsr     _gets
+L002C:	ldy     #$09
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 188
+	jsr     _get_dir_entry
+	ldy     #$07
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 191
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	ldy     #$12
+	jsr     pushwidx
+	lda     #<(_index_block)
+	ldx     #>(_index_block)
+	jsr     _dio_read
+	tax
+	beq     L0028
+	.dbg	line, "apple2/targetutil/convert.c", 192
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 197
+L0028:	ldx     _index_block+256
+	lda     _index_block
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 200
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	lda     #<(_header_block)
+	ldx     #>(_header_block)
+	jsr     _dio_read
+	tax
+	beq     L002A
+	.dbg	line, "apple2/targetutil/convert.c", 201
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 205
+	lda     #$00
+L002A:	ldy     #$04
+L0027:	sta     (c_sp),y
+	cmp     #$03
+	bcs     L0008
+	.dbg	line, "apple2/targetutil/convert.c", 206
+	lda     (c_sp),y
+	tay
+	lda     _header_block+2,y
+	sta     ptr1
+	ldy     #$04
+	lda     (c_sp),y
+	tay
+	lda     _info_signature,y
+	cmp     ptr1
+	beq     L0009
+	.dbg	line, "apple2/targetutil/convert.c", 207
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$00
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 205
+L0009:	ldy     #$04
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0027
+	.dbg	line, "apple2/targetutil/convert.c", 212
+L0008:	lda     _header_block+384
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$02
+	bne     L000E
+	.dbg	line, "apple2/targetutil/convert.c", 216
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 219
+	lda     #<(_index_block)
+	ldx     #>(_index_block)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 220
+	lda     #<(_index_block+1)
+	ldx     #>(_index_block+1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FD
+	jsr     _memmove
+	.dbg	line, "apple2/targetutil/convert.c", 221
+	lda     #<(_index_block+256)
+	ldx     #>(_index_block+256)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 222
+	lda     #<(_index_block+257)
+	ldx     #>(_index_block+257)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FD
+	jsr     _memmove
+	.dbg	line, "apple2/targetutil/convert.c", 225
+	ldx     #$00
+	lda     _header_block+405
+	jsr     axulong
+	.dbg	line, "apple2/targetutil/convert.c", 226
+	jsr     pusheax
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	ldx     _header_block+406
+	lda     #$00
+	jsr     tosoreax
+	.dbg	line, "apple2/targetutil/convert.c", 227
+	jsr     pusheax
+	ldx     #$00
+	lda     _header_block+407
+	jsr     axulong
+	stx     sreg+1
+	sta     sreg
+	txa
+	jsr     tosoreax
+	jsr     steax0sp
+	.dbg	line, "apple2/targetutil/convert.c", 229
+	jmp     L000F
+	.dbg	line, "apple2/targetutil/convert.c", 235
+L000E:	jsr     decsp7
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "apple2/targetutil/convert.c", 237
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 240
+	lda     #$01
+	ldy     #$0C
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 241
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	tax
+	ldy     #$08
+	jsr     steaxysp
+	.dbg	line, "apple2/targetutil/convert.c", 246
+L0010:	ldy     #$0C
+	lda     (c_sp),y
+	tay
+	lda     _index_block,y
+	.dbg	line, "apple2/targetutil/convert.c", 247
+	sta     ptr1
+	ldy     #$0C
+	lda     (c_sp),y
+	tay
+	ldx     _index_block+256,y
+	lda     ptr1
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "apple2/targetutil/convert.c", 248
+	ldy     #$0C
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 251
+	ldy     #$06
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0019
+	.dbg	line, "apple2/targetutil/convert.c", 252
+	jmp     L0011
+	.dbg	line, "apple2/targetutil/convert.c", 259
+L0017:	ldy     #$00
+	lda     (c_sp),y
+	tay
+	lda     #$FF
+	sta     _master_block,y
+	.dbg	line, "apple2/targetutil/convert.c", 260
+	ldy     #$00
+	lda     (c_sp),y
+	tay
+	lda     #$FF
+	sta     _master_block+256,y
+	.dbg	line, "apple2/targetutil/convert.c", 261
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 256
+L0019:	ldy     #$00
+	lda     (c_sp),y
+	tay
+	lda     _header_block+256,y
+	cmp     #$FF
+	beq     L0017
+	.dbg	line, "apple2/targetutil/convert.c", 265
+	ldy     #$00
+	lda     (c_sp),y
+	tax
+	ldy     #$06
+	lda     (c_sp),y
+	sta     _master_block,x
+	.dbg	line, "apple2/targetutil/convert.c", 266
+	lda     #<(_master_block+256)
+	ldx     #>(_master_block+256)
+	ldy     #$00
+	clc
+	adc     (c_sp),y
+	bcc     L001E
+	inx
+L001E:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$07
+	lda     (c_sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 267
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 270
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	lda     #<(_vlir_block)
+	ldx     #>(_vlir_block)
+	jsr     _dio_read
+	tax
+	beq     L002B
+	.dbg	line, "apple2/targetutil/convert.c", 271
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 275
+	ldx     #$00
+L002B:	lda     _vlir_block+255
+	jsr     axulong
+	.dbg	line, "apple2/targetutil/convert.c", 276
+	jsr     pusheax
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	ldx     _vlir_block+511
+	lda     #$00
+	jsr     tosoreax
+	.dbg	line, "apple2/targetutil/convert.c", 277
+	jsr     pusheax
+	ldx     #$00
+	lda     _vlir_block+254
+	jsr     axulong
+	stx     sreg+1
+	sta     sreg
+	txa
+	jsr     tosoreax
+	.dbg	line, "apple2/targetutil/convert.c", 278
+	jsr     pusheax
+	lda     _vlir_block+510
+	jsr     axulong
+	sta     sreg+1
+	lda     #$00
+	tax
+	sta     sreg
+	jsr     tosoreax
+	ldy     #$02
+	jsr     steaxysp
+	.dbg	line, "apple2/targetutil/convert.c", 280
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     decax1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 283
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	ldx     #$01
+	jsr     tosadd0ax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	ldy     #$00
+	sty     sreg+1
+	jsr     shreax1
+	iny
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 286
+	lda     #<(_vlir_block)
+	ldx     #>(_vlir_block)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 287
+	lda     #<(_index_block)
+	ldx     #>(_index_block)
+	ldy     #$0E
+	clc
+	adc     (c_sp),y
+	bcc     L0020
+	inx
+L0020:	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _memcpy
+	.dbg	line, "apple2/targetutil/convert.c", 288
+	lda     #<(_vlir_block+256)
+	ldx     #>(_vlir_block+256)
+	jsr     pushax
+	.dbg	line, "apple2/targetutil/convert.c", 289
+	lda     #<(_index_block+256)
+	ldx     #>(_index_block+256)
+	ldy     #$0E
+	clc
+	adc     (c_sp),y
+	bcc     L0021
+	inx
+L0021:	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _memcpy
+	.dbg	line, "apple2/targetutil/convert.c", 290
+	ldy     #$01
+	lda     (c_sp),y
+	ldy     #$0C
+	clc
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "apple2/targetutil/convert.c", 293
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	lda     #<(_vlir_block)
+	ldx     #>(_vlir_block)
+	jsr     _dio_write
+	tax
+	beq     L0022
+	.dbg	line, "apple2/targetutil/convert.c", 294
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 298
+L0022:	ldy     #$05
+	jsr     ldeaxysp
+	ldy     #$08
+	jsr     laddeqysp
+	.dbg	line, "apple2/targetutil/convert.c", 243
+	jmp     L0010
+	.dbg	line, "apple2/targetutil/convert.c", 303
+L0011:	lda     #<(_index_block)
+	ldx     #>(_index_block)
+	jsr     pushax
+	lda     #<(_master_block)
+	ldx     #>(_master_block)
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	jsr     _memcpy
+	.dbg	line, "apple2/targetutil/convert.c", 304
+	jsr     incsp8
+	.dbg	line, "apple2/targetutil/convert.c", 306
+L000F:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 309
+	ldy     #$00
+	lda     (c_sp),y
+	sta     _index_block+255
+	.dbg	line, "apple2/targetutil/convert.c", 310
+	jsr     ldeax0sp
+	stx     _index_block+511
+	.dbg	line, "apple2/targetutil/convert.c", 311
+	jsr     ldeax0sp
+	lda     sreg
+	sta     _index_block+254
+	.dbg	line, "apple2/targetutil/convert.c", 312
+	jsr     ldeax0sp
+	lda     sreg+1
+	sta     _index_block+510
+	.dbg	line, "apple2/targetutil/convert.c", 315
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	ldy     #$12
+	jsr     pushwidx
+	lda     #<(_index_block)
+	ldx     #>(_index_block)
+	jsr     _dio_write
+	tax
+	beq     L0023
+	.dbg	line, "apple2/targetutil/convert.c", 316
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 320
+L0023:	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     _header_block+384
+	ldy     #$00
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 321
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	jsr     incax1
+	jsr     pushax
+	lda     #<(_header_block+385)
+	ldx     #>(_header_block+385)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0F
+	jsr     _memcpy
+	.dbg	line, "apple2/targetutil/convert.c", 322
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     _header_block+400
+	ldy     #$10
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 323
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	ldy     #$15
+	jsr     incaxy
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (c_sp),y
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 324
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	ldy     #$15
+	jsr     incaxy
+	jsr     incax1
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldeax0sp
+	txa
+	ldy     #$00
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 325
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	ldy     #$15
+	jsr     incaxy
+	jsr     incax2
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldeax0sp
+	ldy     #$00
+	lda     sreg
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 326
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	jsr     pushax
+	lda     _header_block+408+3
+	sta     sreg+1
+	lda     _header_block+408+2
+	sta     sreg
+	ldx     _header_block+408+1
+	lda     _header_block+408
+	ldy     #$18
+	jsr     steaxspidx
+	.dbg	line, "apple2/targetutil/convert.c", 327
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     _header_block+412
+	ldy     #$1C
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 328
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	lda     _header_block+413
+	iny
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 329
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$1F
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "apple2/targetutil/convert.c", 330
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	jsr     pushax
+	lda     _header_block+417+3
+	sta     sreg+1
+	lda     _header_block+417+2
+	sta     sreg
+	ldx     _header_block+417+1
+	lda     _header_block+417
+	ldy     #$21
+	jsr     steaxspidx
+	.dbg	line, "apple2/targetutil/convert.c", 333
+	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     pushax
+	ldy     #$0C
+	jsr     pushwysp
+	lda     #<(_dir_block)
+	ldx     #>(_dir_block)
+	jsr     _dio_write
+	tax
+	beq     L0024
+	.dbg	line, "apple2/targetutil/convert.c", 334
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 338
+L0024:	lda     _dhandle
+	ldx     _dhandle+1
+	jsr     _dio_close
+	tax
+	beq     L0025
+	.dbg	line, "apple2/targetutil/convert.c", 339
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #$01
+	jsr     _err_exit
+	.dbg	line, "apple2/targetutil/convert.c", 342
+L0025:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _dir_entry+1
+	sta     ptr1+1
+	lda     _dir_entry
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	and     #$0F
+	jsr     pusha0
+	.dbg	line, "apple2/targetutil/convert.c", 343
+	lda     _dir_entry
+	ldx     _dir_entry+1
+	jsr     incax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "apple2/targetutil/convert.c", 344
+	jsr     _getchar
+	.dbg	line, "apple2/targetutil/convert.c", 345
+	ldx     #$00
+	txa
+	.dbg	line, "apple2/targetutil/convert.c", 346
+	rts
+
+	.dbg	line
+.endproc
+
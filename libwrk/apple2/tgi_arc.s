@@ -0,0 +1,202 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "tgi/tgi_arc.c", 4000, 1779181050
+	.dbg		file, "/root/repo/include/tgi.h", 10994, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-error.h", 3568, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/apple2.h", 12699, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/apple2_filetype.h", 17100, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-kernel.h", 4287, 1779181050
+	.dbg		file, "/root/repo/include/cc65.h", 5121, 1779181050
+	.import		_tgi_line
+	.export		_tgi_arc
+	.import		_tgi_imulround
+	.import		__sin
+	.import		__cos
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ tgi_arc (int x, int y, unsigned char rx, unsigned char ry, unsigned int sa, unsigned int ea)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tgi_arc: near
+
+	.dbg	func, "tgi_arc", "00", static, "_tgi_arc"
+	.dbg	sym, "x", "00", auto, 8
+	.dbg	sym, "y", "00", auto, 6
+	.dbg	sym, "rx", "00", auto, 5
+	.dbg	sym, "ry", "00", auto, 4
+	.dbg	sym, "sa", "00", auto, 2
+	.dbg	sym, "ea", "00", auto, 0
+	.dbg	sym, "x1", "00", auto, -2
+	.dbg	sym, "y1", "00", auto, -4
+	.dbg	sym, "x2", "00", auto, -6
+	.dbg	sym, "y2", "00", auto, -8
+	.dbg	sym, "inc", "00", auto, -9
+	.dbg	sym, "done", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "tgi/tgi_arc.c", 55
+	jsr     pushax
+	.dbg	line, "tgi/tgi_arc.c", 58
+	ldy     #$09
+	jsr     subysp
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "tgi/tgi_arc.c", 61
+	ldy     #$0D
+	jsr     ldaxysp
+	sec
+	ldy     #$0A
+	sbc     (c_sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (c_sp),y
+	ora     tmp1
+	.dbg	line, "tgi/tgi_arc.c", 62
+	beq     L000C
+	jcs     L0007
+	.dbg	line, "tgi/tgi_arc.c", 66
+L000C:	ldx     #$00
+	ldy     #$0E
+	lda     (c_sp),y
+	clc
+	iny
+	adc     (c_sp),y
+	bcc     L000A
+	inx
+L000A:	cmp     #$19
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L000D
+	.dbg	line, "tgi/tgi_arc.c", 67
+	lda     #$0C
+	.dbg	line, "tgi/tgi_arc.c", 68
+	jmp     L000E
+	.dbg	line, "tgi/tgi_arc.c", 69
+L000D:	lda     #$18
+L000E:	ldy     #$01
+	sta     (c_sp),y
+	.dbg	line, "tgi/tgi_arc.c", 73
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$11
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     __cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 74
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$10
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     __sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 76
+L0006:	ldy     #$01
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$0C
+	jsr     addeqysp
+	.dbg	line, "tgi/tgi_arc.c", 77
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0A
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bcc     L0009
+	.dbg	line, "tgi/tgi_arc.c", 78
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 79
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "tgi/tgi_arc.c", 81
+L0009:	ldy     #$15
+	jsr     pushwysp
+	ldy     #$11
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     __cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 82
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$10
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     __sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 83
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _tgi_line
+	.dbg	line, "tgi/tgi_arc.c", 84
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 85
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_arc.c", 86
+	ldy     #$00
+	lda     (c_sp),y
+	jeq     L0006
+	.dbg	line, "tgi/tgi_arc.c", 87
+L0007:	ldy     #$14
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,252 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "tgi/tgi_load_vectorfont.c", 5114, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "/root/repo/include/tgi.h", 10994, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-error.h", 3568, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/apple2.h", 12699, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/apple2_filetype.h", 17100, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-kernel.h", 4287, 1779181050
+	.dbg		file, "/root/repo/include/tgi/tgi-vectorfont.h", 4419, 1779181050
+	.dbg		sym, "tgi_error", "00", extern, "_tgi_error"
+	.import		_malloc
+	.import		_free
+	.import		_memcmp
+	.import		_open
+	.import		_close
+	.import		_read
+	.export		_tgi_load_vectorfont
+	.import		_tgi_error
+
+; ---------------------------------------------------------------
+; const struct tgi_vectorfont *__near__ __fastcall__ tgi_load_vectorfont (const char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tgi_load_vectorfont: near
+
+	.dbg	func, "tgi_load_vectorfont", "00", static, "_tgi_load_vectorfont"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "H", "00", auto, -6
+	.dbg	sym, "F", "00", auto, -8
+	.dbg	sym, "Font", "00", auto, -10
+	.dbg	sym, "V", "00", auto, -12
+	.dbg	sym, "I", "00", auto, -13
+
+.segment	"CODE"
+
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 58
+	jsr     pushax
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 65
+	jsr     decsp8
+	jsr     push0
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 71
+	jsr     decsp3
+	lda     #$02
+	sta     _tgi_error
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 74
+	ldy     #$10
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 75
+	cpx     #$80
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 77
+	jcs     L0003
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 81
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$09
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     _read
+	cpx     #$00
+	jne     L0003
+	cmp     #$06
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 83
+	jne     L0003
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 87
+	lda     #$07
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     _memcmp
+	cpx     #$00
+	jne     L0003
+	cmp     #$00
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 89
+	jne     L0003
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 93
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 94
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+	bne     L0008
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 96
+	lda     #$08
+	sta     _tgi_error
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 97
+	jmp     L0003
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 101
+L0008:	ldy     #$08
+	jsr     pushwysp
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     _read
+	ldy     #$0B
+	cmp     (c_sp),y
+	bne     L0015
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L000A
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 103
+L0015:	ldy     #$04
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 104
+	jmp     L0003
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 108
+L000A:	ldy     #$06
+	jsr     ldaxysp
+	jsr     _close
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 115
+	lda     #$20
+	clc
+	ldy     #$03
+	adc     (c_sp),y
+	pha
+	lda     #$01
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 116
+	lda     #$00
+	tay
+L0012:	sta     (c_sp),y
+	cmp     #$5F
+	bcs     L0014
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 117
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$62
+	jsr     incaxy
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (c_sp,x)
+	asl     a
+	bcc     L0013
+	inx
+	clc
+L0013:	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 116
+	dey
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0012
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 121
+L0014:	sty     _tgi_error
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 124
+	ldy     #$04
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 130
+L0003:	ldy     #$06
+	jsr     ldaxysp
+	txa
+	bmi     L000F
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 131
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     _close
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 133
+L000F:	ldx     #$00
+	txa
+	.dbg	line, "tgi/tgi_load_vectorfont.c", 134
+L0001:	ldy     #$0F
+	jmp     addysp
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.byte	$54
+	.byte	$43
+	.byte	$48
+	.byte	$00
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+M0005:
+	.word	$0000
+M0006:
+	.word	$0000
+
+.endproc
+
@@ -0,0 +1,73 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/_afailed.c", 319, 1779181050
+	.dbg		file, "/root/repo/include/signal.h", 3345, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.import		_raise
+	.import		_stderr
+	.import		_fprintf
+	.import		_exit
+	.export		___afailed
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$41,$53,$53,$45,$52,$54,$49,$4F,$4E,$20,$46,$41,$49,$4C,$45,$44
+	.byte	$20,$49,$4E,$20,$25,$73,$3A,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ __afailed (char *file, unsigned int line)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	___afailed: near
+
+	.dbg	func, "__afailed", "00", static, "___afailed"
+	.dbg	sym, "file", "00", auto, 2
+	.dbg	sym, "line", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/_afailed.c", 16
+	jsr     pushax
+	.dbg	line, "common/_afailed.c", 17
+	ldx     #$00
+	txa
+	jsr     _raise
+	.dbg	line, "common/_afailed.c", 18
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _fprintf
+	.dbg	line, "common/_afailed.c", 19
+	ldx     #$00
+	lda     #$02
+	jsr     _exit
+	.dbg	line, "common/_afailed.c", 20
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,154 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/bsearch.c", 1163, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.export		_bsearch
+
+; ---------------------------------------------------------------
+; void *__near__ __fastcall__ bsearch (const void *key, const void *base, unsigned int n, unsigned int size, int (__fastcall__ *cmp)(const void *, const void *))
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bsearch: near
+
+	.dbg	func, "bsearch", "00", static, "_bsearch"
+	.dbg	sym, "key", "00", auto, 8
+	.dbg	sym, "base", "00", auto, 6
+	.dbg	sym, "n", "00", auto, 4
+	.dbg	sym, "size", "00", auto, 2
+	.dbg	sym, "cmp", "00", auto, 0
+	.dbg	sym, "current", "00", auto, -2
+	.dbg	sym, "result", "00", auto, -4
+	.dbg	sym, "found", "00", auto, -6
+	.dbg	sym, "first", "00", auto, -8
+	.dbg	sym, "last", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "common/bsearch.c", 16
+	jsr     pushax
+	.dbg	line, "common/bsearch.c", 19
+	jsr     decsp4
+	jsr     push0
+	.dbg	line, "common/bsearch.c", 20
+	jsr     push0
+	.dbg	line, "common/bsearch.c", 21
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     pushax
+	.dbg	line, "common/bsearch.c", 24
+	jmp     L0008
+	.dbg	line, "common/bsearch.c", 27
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     (c_sp)
+	pha
+	txa
+	ldy     #$01
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "common/bsearch.c", 30
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$17
+	jsr     ldaxysp
+	pha
+	ldy     #$02
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "common/bsearch.c", 31
+	cpx     #$80
+	bcc     L0005
+	.dbg	line, "common/bsearch.c", 32
+	ldy     #$09
+	jsr     ldaxysp
+	ina
+	bne     L0006
+	inx
+L0006:	ldy     #$02
+	.dbg	line, "common/bsearch.c", 33
+	bra     L000C
+	.dbg	line, "common/bsearch.c", 34
+L0005:	ldy     #$09
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     stax0sp
+	.dbg	line, "common/bsearch.c", 35
+	ldy     #$06
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0008
+	.dbg	line, "common/bsearch.c", 40
+	tax
+	ina
+	ldy     #$04
+L000C:	jsr     staxysp
+	.dbg	line, "common/bsearch.c", 24
+L0008:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	jmi     L0002
+	jeq     L0002
+	.dbg	line, "common/bsearch.c", 46
+	ldy     #$05
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L000A
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     tosaddax
+	bra     L0001
+L000A:	tax
+	.dbg	line, "common/bsearch.c", 47
+L0001:	ldy     #$14
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,332 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/pmemalign.c", 7813, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/_heap.h", 1373, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.import		_malloc
+	.import		_free
+	.export		_posix_memalign
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ posix_memalign (void **memptr, unsigned int alignment, unsigned int size)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_posix_memalign: near
+
+	.dbg	func, "posix_memalign", "00", static, "_posix_memalign"
+	.dbg	sym, "memptr", "00", auto, 4
+	.dbg	sym, "alignment", "00", auto, 2
+	.dbg	sym, "size", "00", auto, 0
+	.dbg	sym, "rawsize", "00", auto, -2
+	.dbg	sym, "uppersize", "00", auto, -4
+	.dbg	sym, "lowersize", "00", auto, -6
+	.dbg	sym, "err", "00", auto, -7
+	.dbg	sym, "b", "00", register, "regbank", 4
+	.dbg	sym, "u", "00", register, "regbank", 2
+	.dbg	sym, "p", "00", register, "regbank", 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/pmemalign.c", 62
+	jsr     pushax
+	.dbg	line, "common/pmemalign.c", 67
+	jsr     decsp7
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "common/pmemalign.c", 68
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	.dbg	line, "common/pmemalign.c", 69
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	.dbg	line, "common/pmemalign.c", 72
+	ldy     #$0D
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0002
+	.dbg	line, "common/pmemalign.c", 74
+L0004:	lda     #$07
+L001B:	ldy     #$06
+	sta     (c_sp),y
+	.dbg	line, "common/pmemalign.c", 76
+	ldy     #$12
+	jsr     ldptr1ysp
+	lda     #$00
+	sta     (ptr1)
+	ldy     #$01
+	sta     (ptr1),y
+	.dbg	line, "common/pmemalign.c", 77
+	ldy     #$06
+	tax
+	lda     (c_sp),y
+	jmp     L0001
+	.dbg	line, "common/pmemalign.c", 81
+L0002:	iny
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	.dbg	line, "common/pmemalign.c", 82
+	beq     L0004
+	.dbg	line, "common/pmemalign.c", 85
+	jsr     ldaxysp
+	jsr     decax1
+	ldy     #$0F
+	and     (c_sp),y
+	pha
+	txa
+	iny
+	and     (c_sp),y
+	sta     tmp1
+	pla
+	ora     tmp1
+	.dbg	line, "common/pmemalign.c", 86
+	bne     L0004
+	.dbg	line, "common/pmemalign.c", 95
+	tax
+	ina
+	dey
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0E
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     _malloc
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "common/pmemalign.c", 98
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+	bne     L0009
+	.dbg	line, "common/pmemalign.c", 99
+	lda     #$02
+	.dbg	line, "common/pmemalign.c", 100
+	bra     L001B
+	.dbg	line, "common/pmemalign.c", 106
+L0009:	ldy     #$14
+	jsr     pushwysp
+	ldy     #$12
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	sta     ptr1
+	txa
+	adc     regbank+4+1
+	sta     ptr1+1
+	ldy     #$12
+	jsr     ldaxysp
+	jsr     complax
+	and     ptr1
+	pha
+	txa
+	and     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	sta     regbank+2
+	stx     regbank+2+1
+	.dbg	line, "common/pmemalign.c", 109
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0E
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	sta     regbank+0
+	txa
+	adc     ptr1+1
+	sta     regbank+0+1
+	.dbg	line, "common/pmemalign.c", 115
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     decax4
+	ldy     #$03
+	jsr     ldaxidx
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "common/pmemalign.c", 116
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	lda     (regbank+4)
+	ldy     #$0B
+	jsr     staxysp
+	.dbg	line, "common/pmemalign.c", 124
+	jsr     pushax
+	lda     regbank+0
+	sec
+	sbc     regbank+4
+	pha
+	lda     regbank+0+1
+	sbc     regbank+4+1
+	tax
+	pla
+	ldy     #$09
+	jsr     staxysp
+	jsr     tossubax
+	ldy     #$09
+	jsr     staxysp
+	.dbg	line, "common/pmemalign.c", 125
+	cmp     #$06
+	txa
+	sbc     #$00
+	bcc     L000B
+	.dbg	line, "common/pmemalign.c", 126
+	ldy     #$08
+	jsr     ldaxysp
+	cmp     #$06
+	txa
+	sbc     #$00
+	bcc     L000B
+	.dbg	line, "common/pmemalign.c", 129
+	ldy     #$0A
+	jsr     ldaxysp
+	sta     (regbank+0)
+	ldy     #$01
+	txa
+	sta     (regbank+0),y
+	.dbg	line, "common/pmemalign.c", 130
+	lda     regbank+0
+	ldx     regbank+0+1
+	iny
+	sta     (regbank+0),y
+	iny
+	txa
+	sta     (regbank+0),y
+	.dbg	line, "common/pmemalign.c", 133
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     incax4
+	jsr     _free
+	.dbg	line, "common/pmemalign.c", 136
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     staxysp
+	.dbg	line, "common/pmemalign.c", 147
+L000B:	lda     regbank+2
+	sec
+	sbc     regbank+4
+	pha
+	lda     regbank+2+1
+	sbc     regbank+4+1
+	tax
+	pla
+	jsr     decax4
+	ldy     #$07
+	jsr     staxysp
+	.dbg	line, "common/pmemalign.c", 148
+	cmp     #$06
+	txa
+	sbc     #$00
+	bcc     L000F
+	.dbg	line, "common/pmemalign.c", 149
+	ldy     #$0C
+	jsr     ldaxysp
+	sec
+	ldy     #$07
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	cmp     #$06
+	txa
+	sbc     #$00
+	bcc     L000F
+	.dbg	line, "common/pmemalign.c", 154
+	jsr     ldaxysp
+	sta     (regbank+4)
+	ldy     #$01
+	txa
+	sta     (regbank+4),y
+	.dbg	line, "common/pmemalign.c", 155
+	lda     regbank+4
+	ldx     regbank+4+1
+	iny
+	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	.dbg	line, "common/pmemalign.c", 158
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax4
+	jsr     _free
+	.dbg	line, "common/pmemalign.c", 161
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     subeqysp
+	.dbg	line, "common/pmemalign.c", 164
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     decax4
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "common/pmemalign.c", 173
+L000F:	ldy     #$0C
+	jsr     ldaxysp
+	sta     (regbank+4)
+	ldy     #$01
+	txa
+	sta     (regbank+4),y
+	.dbg	line, "common/pmemalign.c", 174
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     decax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     regbank+4
+	iny
+	sta     (ptr1),y
+	iny
+	lda     regbank+4+1
+	sta     (ptr1),y
+	.dbg	line, "common/pmemalign.c", 176
+	ldx     #$00
+	txa
+	.dbg	line, "common/pmemalign.c", 177
+L0001:	pha
+	ldy     #$00
+L0013:	lda     (c_sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L0013
+	pla
+	ldy     #$13
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,88 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/_poserror.c", 2963, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "__oserror", "00", extern, "___oserror"
+	.import		_stderr
+	.import		_fprintf
+	.export		___poserror
+	.import		___stroserror
+	.import		___oserror
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$3A,$20,$25,$73,$9B,$00
+S0002	:=	S0001+4
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ __poserror (const char *msg)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	___poserror: near
+
+	.dbg	func, "__poserror", "00", static, "___poserror"
+	.dbg	sym, "msg", "00", auto, 0
+	.dbg	sym, "errormsg", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "common/_poserror.c", 43
+	jsr     pushax
+	.dbg	line, "common/_poserror.c", 45
+	lda     ___oserror
+	jsr     ___stroserror
+	jsr     pushax
+	.dbg	line, "common/_poserror.c", 48
+	ldy     #$03
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+	.dbg	line, "common/_poserror.c", 49
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	.dbg	line, "common/_poserror.c", 50
+	jmp     L0004
+	.dbg	line, "common/_poserror.c", 51
+L0002:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+L0004:	jsr     _fprintf
+	.dbg	line, "common/_poserror.c", 53
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,96 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/puts.c", 688, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "common/_file.h", 786, 1779181050
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.export		_puts
+	.import		_strlen
+	.import		_write
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ puts (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_puts: near
+
+	.dbg	func, "puts", "00", static, "_puts"
+	.dbg	sym, "s", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/puts.c", 23
+	jsr     pushax
+	.dbg	line, "common/puts.c", 27
+	lda     _stdout+1
+	sta     ptr1+1
+	lda     _stdout
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     _write
+	cpx     #$80
+	bcs     L0005
+	.dbg	line, "common/puts.c", 28
+	lda     _stdout+1
+	sta     ptr1+1
+	lda     _stdout
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _write
+	cpx     #$80
+	bcs     L0005
+	ldx     #$00
+	jmp     L0007
+	.dbg	line, "common/puts.c", 29
+L0005:	lda     _stdout+1
+	sta     ptr1+1
+	lda     _stdout
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	ora     #$04
+	sta     (ptr1),y
+	.dbg	line, "common/puts.c", 30
+	ldx     #$FF
+L0007:	txa
+	.dbg	line, "common/puts.c", 35
+	jmp     incsp2
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$9B
+
+.endproc
+
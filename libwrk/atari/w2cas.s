@@ -0,0 +1,815 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "atari/targetutil/w2cas.c", 4515, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/6502.h", 5470, 1779181050
+	.dbg		file, "/root/repo/include/atari.h", 22634, 1779181050
+	.dbg		file, "/root/repo/include/_atarios.h", 40084, 1779181050
+	.dbg		file, "/root/repo/include/_gtia.h", 13839, 1779181050
+	.dbg		file, "/root/repo/include/_pbi.h", 3143, 1779181050
+	.dbg		file, "/root/repo/include/_pokey.h", 11376, 1779181050
+	.dbg		file, "/root/repo/include/_pia.h", 3044, 1779181050
+	.dbg		file, "/root/repo/include/_antic.h", 11827, 1779181050
+	.dbg		file, "/root/repo/include/cc65.h", 5121, 1779181050
+	.dbg		file, "/root/repo/include/conio.h", 10106, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "stdin", "00", extern, "_stdin"
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_stdin
+	.import		_stderr
+	.import		_fclose
+	.import		_fgets
+	.import		_fopen
+	.import		_fprintf
+	.import		_fread
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		___heapmaxavail
+	.import		_atexit
+	.import		_strerror
+	.import		_strlen
+	.import		___errno
+	.import		__sys
+	.import		_doesclrscrafterexit
+	.import		_cgetc
+	.export		_main
+
+.segment	"DATA"
+
+_verbose:
+	.word	$0001
+_C_dev:
+	.byte	$43,$3A,$00
+
+.segment	"RODATA"
+
+S0015:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$63,$6C,$6F,$73
+	.byte	$65,$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$9B,$00
+S0008:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$20,$2D,$2D,$20,$61,$62,$6F,$72,$74,$69
+	.byte	$6E,$67,$2E,$2E,$2E,$9B,$00
+S0012:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$6F,$70,$65,$6E
+	.byte	$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72,$6E
+	.byte	$65,$64,$20,$25,$64,$9B,$00
+S000E:
+	.byte	$66,$69,$6C,$65,$20,$69,$73,$20,$74,$6F,$6F,$20,$6C,$61,$72,$67
+	.byte	$65,$20,$28,$6D,$75,$73,$74,$20,$62,$65,$20,$3C,$20,$33,$32,$37
+	.byte	$36,$38,$29,$9B,$00
+S0014:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$77,$72,$69,$74
+	.byte	$65,$20,$66,$69,$6C,$65,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20
+	.byte	$25,$64,$9B,$00
+S0003:
+	.byte	$75,$73,$69,$6E,$67,$20,$69,$6F,$63,$62,$20,$69,$6E,$64,$65,$78
+	.byte	$20,$24,$25,$30,$32,$58,$20,$28,$24,$25,$30,$34,$58,$29,$9B,$00
+S0007:
+	.byte	$65,$6D,$70,$74,$79,$20,$66,$69,$6C,$65,$6E,$61,$6D,$65,$2C,$20
+	.byte	$65,$78,$69,$74,$69,$6E,$67,$2E,$2E,$2E,$9B,$00
+S0006	:=	S0007+0
+S0002:
+	.byte	$63,$6F,$75,$6C,$64,$6E,$27,$74,$20,$66,$69,$6E,$64,$20,$61,$20
+	.byte	$66,$72,$65,$65,$20,$69,$6F,$63,$62,$9B,$00
+S0009:
+	.byte	$62,$75,$66,$66,$65,$72,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$9B,$00
+S0013:
+	.byte	$77,$72,$69,$74,$69,$6E,$67,$20,$74,$6F,$20,$63,$61,$73,$73,$65
+	.byte	$74,$74,$65,$2E,$2E,$2E,$9B,$00
+S000C:
+	.byte	$72,$65,$61,$64,$69,$6E,$67,$20,$69,$6E,$70,$75,$74,$20,$66,$69
+	.byte	$6C,$65,$2E,$2E,$2E,$9B,$00
+S000B:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$27,$25,$73,$27
+	.byte	$3A,$20,$25,$73,$9B,$00
+S0010:
+	.byte	$66,$69,$6C,$65,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64,$20,$62
+	.byte	$79,$74,$65,$73,$9B,$00
+S0011:
+	.byte	$6F,$70,$65,$6E,$69,$6E,$67,$20,$63,$61,$73,$73,$65,$74,$74,$65
+	.byte	$2E,$2E,$2E,$9B,$00
+S000F:
+	.byte	$6E,$6F,$74,$20,$65,$6E,$6F,$75,$67,$68,$20,$6D,$65,$6D,$6F,$72
+	.byte	$79,$9B,$00
+S000D:
+	.byte	$72,$65,$61,$64,$20,$65,$72,$72,$6F,$72,$9B,$00
+S0004:
+	.byte	$9B,$66,$69,$6C,$65,$6E,$61,$6D,$65,$3A,$20,$00
+S0016:
+	.byte	$73,$75,$63,$63,$65,$73,$73,$9B,$00
+S000A:
+	.byte	$72,$62,$00
+S0005	:=	S0015+38
+
+; ---------------------------------------------------------------
+; struct __iocb *__near__ findfreeiocb (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_findfreeiocb: near
+
+	.dbg	func, "findfreeiocb", "00", static, "_findfreeiocb"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "atari/targetutil/w2cas.c", 27
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	bcc     L0001
+	.dbg	line, "atari/targetutil/w2cas.c", 28
+	jsr     ldax0sp
+	jsr     aslax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$40
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     #$03
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     #$FF
+	bne     L0009
+	.dbg	line, "atari/targetutil/w2cas.c", 29
+	jsr     ldax0sp
+	jsr     aslax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$40
+	clc
+	adc     ptr1
+	pha
+	lda     #$03
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+	.dbg	line, "atari/targetutil/w2cas.c", 27
+L0009:	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+	.dbg	line, "atari/targetutil/w2cas.c", 32
+L0001:	jmp     incsp2
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+	.dbg	sym, "filename", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -4
+	.dbg	sym, "buf", "00", auto, -24
+	.dbg	sym, "file", "00", auto, -26
+	.dbg	sym, "buffer", "00", auto, -28
+	.dbg	sym, "filen", "00", auto, -30
+	.dbg	sym, "buflen", "00", auto, -32
+	.dbg	sym, "regs", "00", auto, -38
+	.dbg	sym, "iocb", "00", auto, -40
+	.dbg	sym, "iocb_num", "00", auto, -42
+
+.segment	"CODE"
+
+	.dbg	line, "atari/targetutil/w2cas.c", 40
+	ldy     #$1E
+	jsr     subysp
+	ldx     #$80
+	lda     #$01
+	jsr     pushax
+	.dbg	line, "atari/targetutil/w2cas.c", 42
+	jsr     decsp6
+	jsr     _findfreeiocb
+	jsr     pushax
+	.dbg	line, "atari/targetutil/w2cas.c", 46
+	jsr     decsp2
+	jsr     _doesclrscrafterexit
+	tax
+	beq     L0002
+	.dbg	line, "atari/targetutil/w2cas.c", 47
+	lda     #<(_cgetc)
+	ldx     #>(_cgetc)
+	jsr     _atexit
+	.dbg	line, "atari/targetutil/w2cas.c", 49
+L0002:	ldy     #$03
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	bne     L0003
+	.dbg	line, "atari/targetutil/w2cas.c", 50
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 51
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 53
+L0003:	ldy     #$03
+	jsr     ldaxysp
+	sec
+	sbc     #$40
+	pha
+	txa
+	sbc     #$03
+	tax
+	pla
+	jsr     pushax
+	lda     #$10
+	jsr     tosdiva0
+	jsr     aslax4
+	jsr     stax0sp
+	.dbg	line, "atari/targetutil/w2cas.c", 54
+	lda     _verbose
+	ora     _verbose+1
+	beq     L0004
+	.dbg	line, "atari/targetutil/w2cas.c", 55
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 57
+L0004:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0005
+	.dbg	line, "atari/targetutil/w2cas.c", 58
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 59
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$13
+	jsr     pusha0
+	lda     _stdin
+	ldx     _stdin+1
+	jsr     _fgets
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 60
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 61
+	ldy     #$27
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	bne     L0007
+	.dbg	line, "atari/targetutil/w2cas.c", 62
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 63
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 65
+L0007:	ldy     #$27
+	jsr     ldptr1ysp
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L0008
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$9B
+	bne     L0008
+	.dbg	line, "atari/targetutil/w2cas.c", 66
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 67
+L0008:	ldy     #$27
+	jsr     ldaxysp
+	jsr     _strlen
+	stx     tmp1
+	ora     tmp1
+	bne     L000C
+	.dbg	line, "atari/targetutil/w2cas.c", 68
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 69
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 71
+L000C:	ldy     #$27
+	jsr     ldaxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 73
+	jmp     L0023
+	.dbg	line, "atari/targetutil/w2cas.c", 74
+L0005:	ldy     #$2B
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+L0023:	ldy     #$28
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 78
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 79
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	.dbg	line, "atari/targetutil/w2cas.c", 80
+	jsr     ___heapmaxavail
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 81
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 82
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	.dbg	line, "atari/targetutil/w2cas.c", 83
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 84
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 87
+L000F:	lda     _verbose
+	ora     _verbose+1
+	beq     L0010
+	.dbg	line, "atari/targetutil/w2cas.c", 88
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 91
+L0010:	ldy     #$2B
+	jsr     pushwysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     _fopen
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 92
+	stx     tmp1
+	ora     tmp1
+	bne     L0011
+	.dbg	line, "atari/targetutil/w2cas.c", 93
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "atari/targetutil/w2cas.c", 94
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$2F
+	jsr     pushwysp
+	lda     ___errno
+	ldx     ___errno+1
+	jsr     _strerror
+	jsr     pushax
+	ldy     #$08
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 95
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 99
+L0011:	lda     _verbose
+	ora     _verbose+1
+	beq     L0012
+	.dbg	line, "atari/targetutil/w2cas.c", 100
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 101
+L0012:	ldy     #$11
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     _fread
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 102
+	stx     tmp1
+	ora     tmp1
+	bne     L0013
+	.dbg	line, "atari/targetutil/w2cas.c", 103
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+L0025:	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 105
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "atari/targetutil/w2cas.c", 106
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "atari/targetutil/w2cas.c", 107
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 109
+L0013:	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	ldx     #$80
+	jsr     tosgeeax
+	beq     L0015
+	.dbg	line, "atari/targetutil/w2cas.c", 110
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	.dbg	line, "atari/targetutil/w2cas.c", 111
+	jmp     L0025
+	.dbg	line, "atari/targetutil/w2cas.c", 113
+L0015:	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0A
+	cmp     (c_sp),y
+	bne     L0016
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L0016
+	.dbg	line, "atari/targetutil/w2cas.c", 114
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	.dbg	line, "atari/targetutil/w2cas.c", 115
+	jmp     L0025
+	.dbg	line, "atari/targetutil/w2cas.c", 117
+L0016:	lda     _verbose
+	ora     _verbose+1
+	beq     L0017
+	.dbg	line, "atari/targetutil/w2cas.c", 118
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 121
+L0017:	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "atari/targetutil/w2cas.c", 124
+	lda     _verbose
+	ora     _verbose+1
+	beq     L0018
+	.dbg	line, "atari/targetutil/w2cas.c", 125
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 126
+L0018:	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #<(_C_dev)
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	lda     #>(_C_dev)
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 127
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$08
+	ldy     #$0A
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 128
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$80
+	ldy     #$0B
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 129
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$03
+	ldy     #$02
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 130
+	ldy     #$00
+	lda     (c_sp),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "atari/targetutil/w2cas.c", 131
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 133
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	.dbg	line, "atari/targetutil/w2cas.c", 134
+	ldy     #$06
+	lda     (c_sp),y
+	cmp     #$01
+	beq     L0019
+	.dbg	line, "atari/targetutil/w2cas.c", 135
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$0A
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 136
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "atari/targetutil/w2cas.c", 137
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 141
+L0019:	lda     _verbose
+	ora     _verbose+1
+	beq     L001A
+	.dbg	line, "atari/targetutil/w2cas.c", 142
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 143
+L001A:	ldy     #$03
+	jsr     ldptr1ysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 144
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$08
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 145
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$0B
+	ldy     #$02
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 146
+	ldy     #$00
+	lda     (c_sp),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "atari/targetutil/w2cas.c", 147
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 149
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	.dbg	line, "atari/targetutil/w2cas.c", 150
+	ldy     #$06
+	lda     (c_sp),y
+	cmp     #$01
+	beq     L001B
+	.dbg	line, "atari/targetutil/w2cas.c", 151
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$0A
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 152
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "atari/targetutil/w2cas.c", 154
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 155
+	ldy     #$00
+	lda     (c_sp),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "atari/targetutil/w2cas.c", 156
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 157
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	.dbg	line, "atari/targetutil/w2cas.c", 159
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 163
+L001B:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "atari/targetutil/w2cas.c", 166
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	.dbg	line, "atari/targetutil/w2cas.c", 167
+	ldy     #$00
+	lda     (c_sp),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "atari/targetutil/w2cas.c", 168
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "atari/targetutil/w2cas.c", 169
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	.dbg	line, "atari/targetutil/w2cas.c", 171
+	ldy     #$06
+	lda     (c_sp),y
+	cmp     #$01
+	beq     L001C
+	.dbg	line, "atari/targetutil/w2cas.c", 172
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$0A
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "atari/targetutil/w2cas.c", 173
+	ldx     #$00
+	lda     #$01
+	rts
+	.dbg	line, "atari/targetutil/w2cas.c", 177
+L001C:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "atari/targetutil/w2cas.c", 178
+	ldx     #$00
+	txa
+	.dbg	line, "atari/targetutil/w2cas.c", 179
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,3536 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "dbg/dbg.c", 36596, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/conio.h", 10106, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/atari2600.h", 1049, 1779181050
+	.dbg		file, "/root/repo/include/_tia.h", 2631, 1779181050
+	.dbg		file, "/root/repo/include/_riot.h", 1048, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.dbg		file, "/root/repo/include/6502.h", 5470, 1779181050
+	.dbg		file, "/root/repo/include/dbg.h", 5740, 1779181050
+	.dbg		sym, "brk_a", "00", extern, "_brk_a"
+	.dbg		sym, "brk_x", "00", extern, "_brk_x"
+	.dbg		sym, "brk_y", "00", extern, "_brk_y"
+	.dbg		sym, "brk_sr", "00", extern, "_brk_sr"
+	.dbg		sym, "brk_pc", "00", extern, "_brk_pc"
+	.dbg		sym, "DbgSP", "00", extern, "_DbgSP"
+	.dbg		sym, "DbgCS", "00", extern, "_DbgCS"
+	.dbg		sym, "DbgHI", "00", extern, "_DbgHI"
+	.import		_exit
+	.import		_strlen
+	.import		_clrscr
+	.import		_kbhit
+	.import		_gotoxy
+	.import		_wherex
+	.import		_cputc
+	.import		_cputcxy
+	.import		_cputsxy
+	.import		_cgetc
+	.import		_cursor
+	.import		_revers
+	.import		_textcolor
+	.import		_bgcolor
+	.import		_bordercolor
+	.import		_chline
+	.import		_chlinexy
+	.import		_cvlinexy
+	.import		_cclearxy
+	.import		_cputhex8
+	.import		_cputhex16
+	.import		_isalnum
+	.import		_isdigit
+	.import		_isxdigit
+	.import		_toupper
+	.import		_brk_a
+	.import		_brk_x
+	.import		_brk_y
+	.import		_brk_sr
+	.import		_brk_pc
+	.import		_DbgDisAsm
+	.import		_DbgDisAsmLen
+	.import		_DbgIsRAM
+	.import		_DbgMemDump
+	.import		_DbgSP
+	.import		_DbgCS
+	.import		_DbgHI
+	.export		_DbgBreakCount
+	.export		_DbgBreaks
+	.import		_DbgGetBreakSlot
+	.import		_DbgIsBreak
+	.export		_DbgEntry
+
+.segment	"DATA"
+
+_ActiveFrame:
+	.word	$FFFF
+_ActivePrompt:
+	.word	$0000
+_DbgBreakCount:
+	.byte	$00
+
+.segment	"RODATA"
+
+_RegText:
+	.byte	$01
+	.byte	$00
+	.addr	S0001
+	.byte	$01
+	.byte	$01
+	.addr	S0002
+	.byte	$01
+	.byte	$02
+	.addr	S0003
+	.byte	$01
+	.byte	$03
+	.addr	S0004
+	.byte	$01
+	.byte	$04
+	.addr	S0005
+	.byte	$01
+	.byte	$05
+	.addr	S0006
+	.byte	$01
+	.byte	$06
+	.addr	S0007
+	.byte	$01
+	.byte	$07
+	.addr	S0008
+_HelpText:
+	.byte	$01
+	.byte	$00
+	.addr	S0009
+	.byte	$01
+	.byte	$01
+	.addr	S000A
+	.byte	$01
+	.byte	$02
+	.addr	S000B
+	.byte	$01
+	.byte	$03
+	.addr	S000C
+	.byte	$01
+	.byte	$04
+	.addr	S000D
+	.byte	$01
+	.byte	$05
+	.addr	S000E
+	.byte	$01
+	.byte	$06
+	.addr	S000F
+	.byte	$01
+	.byte	$07
+	.addr	S0010
+	.byte	$01
+	.byte	$08
+	.addr	S0011
+	.byte	$01
+	.byte	$09
+	.addr	S0012
+	.byte	$01
+	.byte	$0A
+	.addr	S0013
+	.byte	$01
+	.byte	$0B
+	.addr	S0014
+	.byte	$01
+	.byte	$0C
+	.addr	S0015
+	.byte	$01
+	.byte	$0D
+	.addr	S0016
+	.byte	$01
+	.byte	$0E
+	.addr	S0017
+	.byte	$01
+	.byte	$0F
+	.addr	S0018
+	.byte	$01
+	.byte	$10
+	.addr	S0019
+	.byte	$01
+	.byte	$11
+	.addr	S001A
+_AsmFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$00
+	.byte	$1E
+	.byte	$0F
+	.byte	$1D
+	.byte	$0E
+	.byte	$01
+	.addr	_AsmHandler
+	.byte	$00
+	.word	$0000
+_RegFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$00
+	.byte	$27
+	.byte	$09
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_RegHandler
+	.byte	$08
+	.addr	_RegText
+_StackFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$09
+	.byte	$27
+	.byte	$0F
+	.byte	$08
+	.byte	$05
+	.byte	$01
+	.addr	_StackHandler
+	.byte	$00
+	.word	$0000
+_CStackFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$0F
+	.byte	$27
+	.byte	$18
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_CStackHandler
+	.byte	$00
+	.word	$0000
+_DumpFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$0F
+	.byte	$1E
+	.byte	$18
+	.byte	$1D
+	.byte	$08
+	.byte	$01
+	.addr	_DumpHandler
+	.byte	$00
+	.word	$0000
+_HelpFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$00
+	.byte	$27
+	.byte	$18
+	.byte	$26
+	.byte	$17
+	.byte	$00
+	.addr	_HelpHandler
+	.byte	$12
+	.addr	_HelpText
+_Frames:
+	.addr	_AsmFrame
+	.addr	_RegFrame
+	.addr	_StackFrame
+	.addr	_CStackFrame
+	.addr	_DumpFrame
+	.addr	_HelpFrame
+S000B:
+	.byte	$46,$33,$2C,$20,$75,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$75,$6E
+	.byte	$74,$69,$6C,$20,$73,$75,$62,$72,$6F,$75,$74,$69,$6E,$65,$20,$72
+	.byte	$65,$74,$75,$72,$6E,$73,$00
+S001F:
+	.byte	$43,$61,$6E,$6E,$6F,$74,$20,$73,$65,$74,$20,$62,$72,$65,$61,$6B
+	.byte	$70,$6F,$69,$6E,$74,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20
+	.byte	$6B,$65,$79,$00
+S0020:
+	.byte	$54,$6F,$6F,$20,$6D,$61,$6E,$79,$20,$62,$72,$65,$61,$6B,$70,$6F
+	.byte	$69,$6E,$74,$73,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20,$6B
+	.byte	$65,$79,$00
+S001A:
+	.byte	$73,$20,$20,$20,$20,$20,$20,$20,$20,$20,$53,$6B,$69,$70,$20,$6E
+	.byte	$65,$78,$74,$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+S000F:
+	.byte	$31,$2D,$35,$20,$20,$20,$20,$20,$20,$20,$53,$65,$6C,$65,$63,$74
+	.byte	$20,$61,$63,$74,$69,$76,$65,$20,$77,$69,$6E,$64,$6F,$77,$00
+S0017:
+	.byte	$70,$20,$20,$20,$20,$20,$20,$20,$20,$20,$55,$73,$65,$20,$61,$73
+	.byte	$20,$6E,$65,$77,$20,$50,$43,$20,$76,$61,$6C,$75,$65,$00
+S0015:
+	.byte	$66,$20,$20,$20,$20,$20,$20,$20,$20,$20,$46,$6F,$6C,$6C,$6F,$77
+	.byte	$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+S000A:
+	.byte	$46,$32,$2C,$20,$74,$20,$20,$20,$20,$20,$54,$6F,$67,$67,$6C,$65
+	.byte	$20,$62,$72,$65,$61,$6B,$70,$6F,$69,$6E,$74,$00
+S001E:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$69,$6E,$70,$75,$74,$20,$2D,$20
+	.byte	$70,$72,$65,$73,$73,$20,$61,$20,$6B,$65,$79,$00
+S001C:
+	.byte	$50,$72,$65,$73,$73,$20,$61,$6E,$79,$20,$6B,$65,$79,$20,$74,$6F
+	.byte	$20,$63,$6F,$6E,$74,$69,$6E,$75,$65,$00
+S000C:
+	.byte	$46,$34,$2C,$20,$68,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$74,$6F
+	.byte	$20,$63,$75,$72,$73,$6F,$72,$00
+S0019:
+	.byte	$72,$20,$20,$20,$20,$20,$20,$20,$20,$20,$52,$65,$64,$72,$61,$77
+	.byte	$20,$73,$63,$72,$65,$65,$6E,$00
+S0013:
+	.byte	$61,$2F,$7A,$20,$20,$20,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+S0012:
+	.byte	$43,$75,$72,$73,$6F,$72,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+S0016:
+	.byte	$6F,$20,$20,$20,$20,$20,$20,$20,$20,$20,$47,$6F,$74,$6F,$20,$6F
+	.byte	$72,$69,$67,$69,$6E,$00
+S000D:
+	.byte	$46,$37,$2C,$20,$73,$70,$61,$63,$65,$20,$53,$74,$65,$70,$20,$69
+	.byte	$6E,$74,$6F,$00
+S000E:
+	.byte	$46,$38,$2C,$20,$65,$6E,$74,$65,$72,$20,$53,$74,$65,$70,$20,$6F
+	.byte	$76,$65,$72,$00
+S0010:
+	.byte	$2B,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$64
+	.byte	$6F,$77,$6E,$00
+S0014:
+	.byte	$63,$20,$20,$20,$20,$20,$20,$20,$20,$20,$43,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$00
+S0011:
+	.byte	$2D,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$75
+	.byte	$70,$00
+S001B:
+	.byte	$50,$72,$65,$73,$73,$20,$46,$31,$20,$66,$6F,$72,$20,$68,$65,$6C
+	.byte	$70,$00
+S0018:
+	.byte	$71,$20,$20,$20,$20,$20,$20,$20,$20,$20,$51,$75,$69,$74,$00
+S0009:
+	.byte	$46,$31,$2C,$20,$3F,$20,$20,$20,$20,$20,$48,$65,$6C,$70,$00
+S001D:
+	.byte	$47,$6F,$74,$6F,$3A,$20,$00
+S0002:
+	.byte	$53,$52,$00
+S0007:
+	.byte	$43,$53,$00
+S0008:
+	.byte	$48,$49,$00
+S0006:
+	.byte	$53,$50,$00
+S0021:
+	.byte	$2D,$3E,$00
+S0001:
+	.byte	$50,$43,$00
+S0004:
+	.byte	$58,$00
+S0003:
+	.byte	$41,$00
+S0005:
+	.byte	$59,$00
+
+.segment	"BSS"
+
+_AsmAddr:
+	.res	2,$00
+_DumpAddr:
+	.res	2,$00
+_CStackAddr:
+	.res	2,$00
+_StackAddr:
+	.res	1,$00
+_PromptColor:
+	.res	1,$00
+_PromptLength:
+	.res	1,$00
+_DbgBreaks:
+	.res	48,$00
+
+; ---------------------------------------------------------------
+; char __near__ AsmHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHandler: near
+
+	.dbg	func, "AsmHandler", "00", static, "_AsmHandler"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "Last", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 892
+	jsr     decsp3
+	.dbg	line, "dbg/dbg.c", 895
+L0002:	jsr     _UpdateAsm
+	jsr     stax0sp
+	.dbg	line, "dbg/dbg.c", 898
+	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 948
+	cmp     #$2B
+	beq     L0007
+	cmp     #$2D
+	beq     L0008
+	cmp     #$61
+	beq     L000E
+	cmp     #$66
+	beq     L000A
+	cmp     #$67
+	beq     L000B
+	cmp     #$6F
+	beq     L000C
+	cmp     #$70
+	beq     L000D
+	cmp     #$74
+	beq     L0009
+	cmp     #$7A
+	beq     L000F
+	jmp     L0011
+	.dbg	line, "dbg/dbg.c", 901
+L0007:	jsr     ldax0sp
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	.dbg	line, "dbg/dbg.c", 902
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 905
+L0008:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     _AsmFrame+9
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	.dbg	line, "dbg/dbg.c", 906
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 912
+L0009:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgToggleUserBreak
+	.dbg	line, "dbg/dbg.c", 913
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 916
+L000A:	jsr     _AsmFollow
+	.dbg	line, "dbg/dbg.c", 917
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 920
+L000B:	lda     #<(_AsmAddr)
+	ldx     #>(_AsmAddr)
+	jsr     _InputGoto
+	.dbg	line, "dbg/dbg.c", 921
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 924
+L000C:	jsr     _AsmHome
+	.dbg	line, "dbg/dbg.c", 925
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 928
+L000D:	lda     _AsmAddr+1
+	sta     _brk_pc+1
+	lda     _AsmAddr
+	sta     _brk_pc
+	.dbg	line, "dbg/dbg.c", 929
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 935
+L000E:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$01
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	.dbg	line, "dbg/dbg.c", 936
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 942
+L000F:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _AsmAddr
+	sta     _AsmAddr
+	txa
+	adc     _AsmAddr+1
+	sta     _AsmAddr+1
+	.dbg	line, "dbg/dbg.c", 943
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 946
+L0011:	ldx     #$00
+	lda     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 950
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ RegHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RegHandler: near
+
+	.dbg	func, "RegHandler", "00", static, "_RegHandler"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 994
+	jmp     _GetKeyUpdate
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ StackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHandler: near
+
+	.dbg	func, "StackHandler", "00", static, "_StackHandler"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "BytesPerPage", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1046
+	jsr     decsp1
+	lda     _StackFrame+9
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1051
+L0002:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1082
+	cmp     #$2B
+	beq     L0007
+	cmp     #$2D
+	beq     L0008
+	cmp     #$61
+	beq     L000A
+	cmp     #$6F
+	beq     L0009
+	cmp     #$7A
+	beq     L000B
+	jmp     L000D
+	.dbg	line, "dbg/dbg.c", 1054
+L0007:	dey
+	lda     (c_sp),y
+	clc
+	adc     _StackAddr
+	sta     _StackAddr
+	.dbg	line, "dbg/dbg.c", 1055
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1058
+L0008:	dey
+	lda     (c_sp),y
+	eor     #$FF
+	sec
+	adc     _StackAddr
+	sta     _StackAddr
+	.dbg	line, "dbg/dbg.c", 1059
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1062
+L0009:	jsr     _StackHome
+	.dbg	line, "dbg/dbg.c", 1063
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1069
+L000A:	dec     _StackAddr
+	.dbg	line, "dbg/dbg.c", 1070
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1076
+L000B:	inc     _StackAddr
+	.dbg	line, "dbg/dbg.c", 1077
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1080
+L000D:	ldx     #$00
+	lda     (c_sp),y
+	jmp     incsp2
+	.dbg	line, "dbg/dbg.c", 1085
+L0006:	jsr     _UpdateStack
+	.dbg	line, "dbg/dbg.c", 1048
+	jmp     L0002
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ CStackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHandler: near
+
+	.dbg	func, "CStackHandler", "00", static, "_CStackHandler"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "BytesPerPage", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1136
+	jsr     decsp1
+	lda     _CStackFrame+9
+	asl     a
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1141
+L0002:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1172
+	cmp     #$2B
+	beq     L0007
+	cmp     #$2D
+	beq     L0008
+	cmp     #$61
+	beq     L000A
+	cmp     #$6F
+	beq     L0009
+	cmp     #$7A
+	beq     L000C
+	jmp     L000F
+	.dbg	line, "dbg/dbg.c", 1144
+L0007:	dey
+	lda     (c_sp),y
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	tya
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	.dbg	line, "dbg/dbg.c", 1145
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1148
+L0008:	dey
+	lda     (c_sp),y
+	eor     #$FF
+	sec
+	adc     _CStackAddr
+	sta     _CStackAddr
+	lda     #$FF
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	.dbg	line, "dbg/dbg.c", 1149
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1152
+L0009:	jsr     _CStackHome
+	.dbg	line, "dbg/dbg.c", 1153
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1159
+L000A:	lda     _CStackAddr
+	sec
+	sbc     #$02
+	sta     _CStackAddr
+	bcs     L0006
+	dec     _CStackAddr+1
+	.dbg	line, "dbg/dbg.c", 1160
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1166
+L000C:	lda     #$02
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	bcc     L0006
+	inc     _CStackAddr+1
+	.dbg	line, "dbg/dbg.c", 1167
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1170
+L000F:	ldx     #$00
+	lda     (c_sp),y
+	jmp     incsp2
+	.dbg	line, "dbg/dbg.c", 1175
+L0006:	jsr     _UpdateCStack
+	.dbg	line, "dbg/dbg.c", 1138
+	jmp     L0002
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ DumpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHandler: near
+
+	.dbg	func, "DumpHandler", "00", static, "_DumpHandler"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "BytesPerPage", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1217
+	jsr     decsp1
+	ldx     #$00
+	lda     _DumpFrame+9
+	jsr     shlax3
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 1222
+L0002:	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1257
+	cmp     #$2B
+	beq     L0007
+	cmp     #$2D
+	beq     L0008
+	cmp     #$61
+	beq     L000B
+	cmp     #$67
+	beq     L0009
+	cmp     #$6F
+	beq     L000A
+	cmp     #$7A
+	beq     L000D
+	jmp     L0010
+	.dbg	line, "dbg/dbg.c", 1225
+L0007:	jsr     ldax0sp
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	.dbg	line, "dbg/dbg.c", 1226
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1229
+L0008:	jsr     ldax0sp
+	eor     #$FF
+	sec
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	eor     #$FF
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	.dbg	line, "dbg/dbg.c", 1230
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1233
+L0009:	lda     #<(_DumpAddr)
+	ldx     #>(_DumpAddr)
+	jsr     _InputGoto
+	.dbg	line, "dbg/dbg.c", 1234
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1237
+L000A:	jsr     _DumpHome
+	.dbg	line, "dbg/dbg.c", 1238
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1244
+L000B:	lda     _DumpAddr
+	sec
+	sbc     #$08
+	sta     _DumpAddr
+	bcs     L0006
+	dec     _DumpAddr+1
+	.dbg	line, "dbg/dbg.c", 1245
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1251
+L000D:	lda     #$08
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	bcc     L0006
+	inc     _DumpAddr+1
+	.dbg	line, "dbg/dbg.c", 1252
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1255
+L0010:	ldx     #$00
+	lda     (c_sp),y
+	jmp     incsp3
+	.dbg	line, "dbg/dbg.c", 1260
+L0006:	jsr     _UpdateDump
+	.dbg	line, "dbg/dbg.c", 1219
+	jmp     L0002
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ HelpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpHandler: near
+
+	.dbg	func, "HelpHandler", "00", static, "_HelpHandler"
+	.dbg	sym, "OldActive", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1276
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 1277
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     _ActivateFrame
+	.dbg	line, "dbg/dbg.c", 1280
+	jsr     _AnyKeyPrompt
+	.dbg	line, "dbg/dbg.c", 1283
+	jsr     _cgetc
+	.dbg	line, "dbg/dbg.c", 1286
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _Redraw
+	.dbg	line, "dbg/dbg.c", 1289
+	ldx     #$00
+	txa
+	.dbg	line, "dbg/dbg.c", 1290
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DisplayPrompt (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DisplayPrompt: near
+
+	.dbg	func, "DisplayPrompt", "00", static, "_DisplayPrompt"
+	.dbg	sym, "s", "00", auto, 0
+	.dbg	sym, "OldColor", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 466
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 470
+	jsr     decsp1
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 473
+	lda     _ActivePrompt
+	ora     _ActivePrompt+1
+	beq     L0002
+	.dbg	line, "dbg/dbg.c", 474
+	lda     _PromptColor
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 475
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	ldx     #$00
+	bcs     L0003
+	dex
+L0003:	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _PromptLength
+	jsr     _chlinexy
+	.dbg	line, "dbg/dbg.c", 479
+L0002:	ldy     #$02
+	jsr     ldaxysp
+	sta     _ActivePrompt
+	stx     _ActivePrompt+1
+	.dbg	line, "dbg/dbg.c", 480
+	ldy     #$00
+	lda     (c_sp),y
+	sta     _PromptColor
+	.dbg	line, "dbg/dbg.c", 481
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _strlen
+	sta     _PromptLength
+	.dbg	line, "dbg/dbg.c", 484
+	lda     #$01
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 485
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	ldx     #$00
+	bcs     L0004
+	dex
+L0004:	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 488
+	lda     _PromptColor
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 489
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SingleStep (char StepInto)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SingleStep: near
+
+	.dbg	func, "SingleStep", "00", static, "_SingleStep"
+	.dbg	sym, "StepInto", "00", auto, 0
+	.dbg	sym, "Offs", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1325
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1328
+	jsr     decsp1
+	lda     _brk_pc+1
+	sta     ptr1+1
+	lda     _brk_pc
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 1374
+	cmp     #$10
+	beq     L0006
+	cmp     #$20
+	beq     L0012
+	cmp     #$30
+	beq     L0006
+	cmp     #$40
+	beq     L0015
+	cmp     #$4C
+	beq     L0004
+	cmp     #$50
+	beq     L0006
+	cmp     #$60
+	beq     L0010
+	cmp     #$6C
+	beq     L0005
+	cmp     #$70
+	beq     L0006
+	cmp     #$90
+	beq     L0006
+	cmp     #$B0
+	beq     L0006
+	cmp     #$D0
+	beq     L0006
+	cmp     #$F0
+	beq     L0006
+	jmp     L0003
+	.dbg	line, "dbg/dbg.c", 1332
+L0004:	jsr     _GetArg16
+	.dbg	line, "dbg/dbg.c", 1333
+	jmp     L0014
+	.dbg	line, "dbg/dbg.c", 1337
+L0005:	jsr     _GetArg16
+	jsr     ldaxi
+	.dbg	line, "dbg/dbg.c", 1338
+	jmp     L0014
+	.dbg	line, "dbg/dbg.c", 1351
+L0006:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     incax1
+	jsr     ldaidx
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1352
+	lda     (c_sp),y
+	beq     L0003
+	.dbg	line, "dbg/dbg.c", 1353
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000F
+	dex
+L000F:	clc
+	adc     _brk_pc
+	pha
+	txa
+	adc     _brk_pc+1
+	tax
+	pla
+	jsr     incax2
+	jsr     _DbgSetTmpBreak
+	.dbg	line, "dbg/dbg.c", 1355
+	jmp     L0003
+	.dbg	line, "dbg/dbg.c", 1359
+L0010:	jsr     _SetRTSBreak
+	.dbg	line, "dbg/dbg.c", 1360
+	jmp     incsp2
+	.dbg	line, "dbg/dbg.c", 1364
+L0015:	lda     #$01
+	jsr     _GetStack16
+	.dbg	line, "dbg/dbg.c", 1365
+	jmp     L0014
+	.dbg	line, "dbg/dbg.c", 1368
+L0012:	iny
+	lda     (c_sp),y
+	beq     L0003
+	.dbg	line, "dbg/dbg.c", 1370
+	jsr     _GetArg16
+	.dbg	line, "dbg/dbg.c", 1371
+	jmp     L0014
+	.dbg	line, "dbg/dbg.c", 1377
+L0003:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     pushax
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	jsr     tosaddax
+L0014:	jsr     _DbgSetTmpBreak
+	.dbg	line, "dbg/dbg.c", 1378
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ RedrawStatic (char Frame)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RedrawStatic: near
+
+	.dbg	func, "RedrawStatic", "00", static, "_RedrawStatic"
+	.dbg	sym, "Frame", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1390
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1392
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	.dbg	line, "dbg/dbg.c", 1395
+	lda     #$00
+	jsr     _bordercolor
+	.dbg	line, "dbg/dbg.c", 1396
+	lda     #$00
+	jsr     _bgcolor
+	.dbg	line, "dbg/dbg.c", 1397
+	jsr     _clrscr
+	.dbg	line, "dbg/dbg.c", 1398
+	lda     #$00
+	jsr     _cursor
+	.dbg	line, "dbg/dbg.c", 1401
+	lda     #$01
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 1402
+	jsr     _DrawFrames
+	.dbg	line, "dbg/dbg.c", 1405
+	jsr     _HelpPrompt
+	.dbg	line, "dbg/dbg.c", 1408
+	ldx     #$00
+	lda     (c_sp,x)
+	jsr     pusha0
+	lda     #$00
+	jsr     _ActivateFrame
+	.dbg	line, "dbg/dbg.c", 1409
+	jmp     incsp1
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Redraw (char Frame)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Redraw: near
+
+	.dbg	func, "Redraw", "00", static, "_Redraw"
+	.dbg	sym, "Frame", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1415
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1417
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _RedrawStatic
+	.dbg	line, "dbg/dbg.c", 1420
+	jsr     _UpdateAsm
+	.dbg	line, "dbg/dbg.c", 1421
+	jsr     _UpdateReg
+	.dbg	line, "dbg/dbg.c", 1422
+	jsr     _UpdateStack
+	.dbg	line, "dbg/dbg.c", 1423
+	jsr     _UpdateCStack
+	.dbg	line, "dbg/dbg.c", 1424
+	jsr     _UpdateDump
+	.dbg	line, "dbg/dbg.c", 1425
+	jmp     incsp1
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ GetKeyUpdate (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetKeyUpdate: near
+
+	.dbg	func, "GetKeyUpdate", "00", static, "_GetKeyUpdate"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1435
+	jmp     L0004
+	.dbg	line, "dbg/dbg.c", 1437
+L000B:	lda     M0001
+	.dbg	line, "dbg/dbg.c", 1454
+	beq     L0007
+	cmp     #$01
+	beq     L0008
+	cmp     #$02
+	beq     L0009
+	cmp     #$03
+	beq     L000A
+	jmp     L000C
+	.dbg	line, "dbg/dbg.c", 1440
+L0007:	jsr     _UpdateAsm
+	.dbg	line, "dbg/dbg.c", 1441
+	jmp     L000C
+	.dbg	line, "dbg/dbg.c", 1444
+L0008:	jsr     _UpdateStack
+	.dbg	line, "dbg/dbg.c", 1445
+	jmp     L000C
+	.dbg	line, "dbg/dbg.c", 1448
+L0009:	jsr     _UpdateCStack
+	.dbg	line, "dbg/dbg.c", 1449
+	jmp     L000C
+	.dbg	line, "dbg/dbg.c", 1452
+L000A:	jsr     _UpdateDump
+	.dbg	line, "dbg/dbg.c", 1456
+L000C:	lda     M0001
+	clc
+	adc     #$01
+	and     #$03
+	sta     M0001
+	.dbg	line, "dbg/dbg.c", 1435
+L0004:	jsr     _kbhit
+	tax
+	beq     L000B
+	.dbg	line, "dbg/dbg.c", 1461
+	jmp     _cgetc
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrame (register const struct $anon-struct-0016 *F, char Active)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrame: near
+
+	.dbg	func, "DrawFrame", "00", static, "_DrawFrame"
+	.dbg	sym, "F", "00", register, "regbank", 4
+	.dbg	sym, "Active", "00", auto, 0
+	.dbg	sym, "T", "00", auto, -2
+	.dbg	sym, "Count", "00", auto, -3
+	.dbg	sym, "tl", "00", auto, -4
+	.dbg	sym, "tr", "00", auto, -5
+	.dbg	sym, "bl", "00", auto, -6
+	.dbg	sym, "br", "00", auto, -7
+	.dbg	sym, "x1", "00", auto, -8
+	.dbg	sym, "y1", "00", auto, -9
+	.dbg	sym, "width", "00", auto, -10
+	.dbg	sym, "OldColor", "00", auto, -11
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 350
+	jsr     pusha
+	ldy     #$01
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "dbg/dbg.c", 358
+	ldy     #$0B
+	jsr     subysp
+	ldy     #$0B
+	lda     (c_sp),y
+	beq     L0002
+	.dbg	line, "dbg/dbg.c", 359
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 360
+	lda     #$2B
+	ldy     #$07
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 361
+	dey
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 362
+	dey
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 364
+	jmp     L000A
+	.dbg	line, "dbg/dbg.c", 365
+L0002:	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 366
+	lda     (regbank+4),y
+	ldy     #$07
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 367
+	ldy     #$01
+	lda     (regbank+4),y
+	ldy     #$06
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 368
+	ldy     #$02
+	lda     (regbank+4),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 369
+	ldy     #$03
+	lda     (regbank+4),y
+L000A:	ldy     #$04
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 373
+	lda     (regbank+4),y
+	dey
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 374
+	ldy     #$05
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 375
+	ldy     #$08
+	lda     (regbank+4),y
+	ldy     #$01
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 378
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (c_sp),y
+	jsr     _cputcxy
+	.dbg	line, "dbg/dbg.c", 379
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     _chline
+	.dbg	line, "dbg/dbg.c", 380
+	ldy     #$06
+	lda     (c_sp),y
+	jsr     _cputc
+	.dbg	line, "dbg/dbg.c", 383
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	.dbg	line, "dbg/dbg.c", 386
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     _cputc
+	.dbg	line, "dbg/dbg.c", 387
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     _chline
+	.dbg	line, "dbg/dbg.c", 388
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     _cputc
+	.dbg	line, "dbg/dbg.c", 391
+	ldy     #$06
+	lda     (regbank+4),y
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	.dbg	line, "dbg/dbg.c", 394
+	lda     #$01
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 395
+	ldy     #$0D
+	lda     (regbank+4),y
+	ldy     #$08
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 396
+	ldy     #$0F
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$09
+	jsr     staxysp
+	.dbg	line, "dbg/dbg.c", 397
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 398
+L0004:	ldy     #$03
+	lda     (c_sp),y
+	sta     sreg
+	ldy     #$0A
+	jsr     ldptr1ysp
+	ldy     #$00
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	sta     sreg
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	jsr     pusha
+	ldy     #$0C
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 399
+	ldy     #$09
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	.dbg	line, "dbg/dbg.c", 397
+L0006:	ldy     #$08
+	lda     (c_sp),y
+	php
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	sta     (c_sp),y
+	plp
+	bne     L0004
+	.dbg	line, "dbg/dbg.c", 403
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 404
+	ldy     #$0C
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	iny
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrames (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrames: near
+
+	.dbg	func, "DrawFrames", "00", static, "_DrawFrames"
+	.dbg	sym, "I", "00", auto, -1
+	.dbg	sym, "F", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 415
+	jsr     decsp3
+	lda     #$00
+	ldy     #$02
+L0008:	sta     (c_sp),y
+	cmp     #$06
+	bcs     L0003
+	.dbg	line, "dbg/dbg.c", 416
+	ldx     #$00
+	lda     (c_sp),y
+	asl     a
+	bcc     L0009
+	inx
+	clc
+L0009:	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     stax0sp
+	.dbg	line, "dbg/dbg.c", 417
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0A
+	lda     (ptr1),y
+	beq     L0004
+	.dbg	line, "dbg/dbg.c", 418
+	jsr     pushw0sp
+	lda     #$00
+	jsr     _DrawFrame
+	.dbg	line, "dbg/dbg.c", 415
+L0004:	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0008
+	.dbg	line, "dbg/dbg.c", 421
+L0003:	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ActivateFrame (int Num, unsigned char Clear)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ActivateFrame: near
+
+	.dbg	func, "ActivateFrame", "00", static, "_ActivateFrame"
+	.dbg	sym, "Num", "00", auto, 1
+	.dbg	sym, "Clear", "00", auto, 0
+	.dbg	sym, "y", "00", auto, -1
+	.dbg	sym, "F", "00", register, "regbank", 4
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 427
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 429
+	jsr     decsp1
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 431
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     _ActiveFrame+1
+	bne     L000C
+	cmp     _ActiveFrame
+	jeq     L0002
+	.dbg	line, "dbg/dbg.c", 434
+L000C:	ldx     _ActiveFrame+1
+	bmi     L0003
+	.dbg	line, "dbg/dbg.c", 435
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     pushw
+	lda     #$00
+	jsr     _DrawFrame
+	.dbg	line, "dbg/dbg.c", 439
+L0003:	ldy     #$05
+	jsr     ldaxysp
+	sta     _ActiveFrame
+	stx     _ActiveFrame+1
+	txa
+	bmi     L0004
+	.dbg	line, "dbg/dbg.c", 440
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "dbg/dbg.c", 442
+	ldy     #$03
+	lda     (c_sp),y
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 443
+	ldy     #$05
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	ldy     #$02
+L000B:	sta     (c_sp),y
+	ldy     #$07
+	lda     (regbank+4),y
+	ldy     #$02
+	cmp     (c_sp),y
+	bcc     L0007
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 444
+	ldy     #$04
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$08
+	lda     (regbank+4),y
+	jsr     _cclearxy
+	.dbg	line, "dbg/dbg.c", 443
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L000B
+	.dbg	line, "dbg/dbg.c", 447
+L0007:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$01
+	jsr     _DrawFrame
+	.dbg	line, "dbg/dbg.c", 451
+L0004:	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _DisplayPrompt
+	.dbg	line, "dbg/dbg.c", 454
+L0002:	ldy     #$00
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ HelpPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpPrompt: near
+
+	.dbg	func, "HelpPrompt", "00", static, "_HelpPrompt"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 496
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jmp     _DisplayPrompt
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AnyKeyPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AnyKeyPrompt: near
+
+	.dbg	func, "AnyKeyPrompt", "00", static, "_AnyKeyPrompt"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 503
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jmp     _DisplayPrompt
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ IsAbortKey (char C)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsAbortKey: near
+
+	.dbg	func, "IsAbortKey", "00", static, "_IsAbortKey"
+	.dbg	sym, "C", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 510
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 525
+	ldx     #$00
+	txa
+	.dbg	line, "dbg/dbg.c", 526
+	jmp     incsp1
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ Input (char *Prompt, char *Buf, unsigned char Count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Input: near
+
+	.dbg	func, "Input", "00", static, "_Input"
+	.dbg	sym, "Prompt", "00", auto, 3
+	.dbg	sym, "Buf", "00", auto, 1
+	.dbg	sym, "Count", "00", auto, 0
+	.dbg	sym, "Frame", "00", auto, -2
+	.dbg	sym, "OldColor", "00", auto, -3
+	.dbg	sym, "OldCursor", "00", auto, -4
+	.dbg	sym, "x1", "00", auto, -5
+	.dbg	sym, "i", "00", auto, -6
+	.dbg	sym, "done", "00", auto, -7
+	.dbg	sym, "c", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 532
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 542
+	jsr     decsp8
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$28
+	jsr     _cclearxy
+	.dbg	line, "dbg/dbg.c", 545
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 546
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 547
+	lda     #$01
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 550
+	jsr     _wherex
+	ldy     #$03
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 551
+	lda     #$01
+	jsr     _cursor
+	ldy     #$04
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 554
+	lda     #$00
+	ldy     #$01
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 556
+L0002:	jsr     _cgetc
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 557
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isalnum
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$02
+	lda     (c_sp),y
+	ldy     #$08
+	cmp     (c_sp),y
+	bcs     L0005
+	.dbg	line, "dbg/dbg.c", 558
+	ldy     #$02
+	lda     (c_sp),y
+	clc
+	ldy     #$09
+	adc     (c_sp),y
+	sta     ptr1
+	lda     #$00
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (c_sp),y
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 559
+	ldy     #$02
+	lda     (c_sp),y
+	clc
+	iny
+	adc     (c_sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     _cputcxy
+	.dbg	line, "dbg/dbg.c", 560
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 561
+	jmp     L0015
+L0005:	ldy     #$02
+	lda     (c_sp),y
+	beq     L000A
+	ldy     #$00
+	lda     (c_sp),y
+	cmp     #$08
+	bne     L001D
+	.dbg	line, "dbg/dbg.c", 562
+	ldy     #$02
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 563
+	clc
+	iny
+	adc     (c_sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$20
+	jsr     _cputcxy
+	.dbg	line, "dbg/dbg.c", 564
+	ldy     #$02
+	lda     (c_sp),y
+	clc
+	iny
+	adc     (c_sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     _gotoxy
+	.dbg	line, "dbg/dbg.c", 565
+	jmp     L0011
+L000A:	tay
+L001D:	lda     (c_sp),y
+	cmp     #$0A
+	bne     L001B
+	.dbg	line, "dbg/dbg.c", 566
+	ldy     #$02
+	lda     (c_sp),y
+	clc
+	ldy     #$09
+	adc     (c_sp),y
+	sta     ptr1
+	lda     #$00
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 567
+	lda     #$01
+	.dbg	line, "dbg/dbg.c", 568
+	jmp     L001C
+L001B:	lda     (c_sp),y
+	jsr     _IsAbortKey
+	tax
+	beq     L0011
+	.dbg	line, "dbg/dbg.c", 570
+	lda     #$02
+L001C:	ldy     #$01
+L0015:	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 572
+L0011:	ldy     #$01
+	lda     (c_sp),y
+	jeq     L0002
+	.dbg	line, "dbg/dbg.c", 575
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     _cursor
+	.dbg	line, "dbg/dbg.c", 576
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     _textcolor
+	.dbg	line, "dbg/dbg.c", 577
+	jsr     _DrawFrames
+	.dbg	line, "dbg/dbg.c", 578
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "dbg/dbg.c", 579
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	.dbg	line, "dbg/dbg.c", 580
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$00
+	jsr     _ActivateFrame
+	.dbg	line, "dbg/dbg.c", 582
+	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$01
+	jsr     booleq
+	.dbg	line, "dbg/dbg.c", 583
+	ldy     #$0D
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ InputHex (char *Prompt, unsigned int *Val)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputHex: near
+
+	.dbg	func, "InputHex", "00", static, "_InputHex"
+	.dbg	sym, "Prompt", "00", auto, 2
+	.dbg	sym, "Val", "00", auto, 0
+	.dbg	sym, "Buf", "00", auto, -5
+	.dbg	sym, "P", "00", auto, -7
+	.dbg	sym, "C", "00", auto, -8
+	.dbg	sym, "V", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 589
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 596
+	ldy     #$0A
+	jsr     subysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     #$07
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$04
+	jsr     _Input
+	tax
+	jeq     L000E
+	ldy     #$05
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	tax
+	jmp     L000E
+	.dbg	line, "dbg/dbg.c", 599
+L0004:	lda     #$05
+	jsr     leaa0sp
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "dbg/dbg.c", 600
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	.dbg	line, "dbg/dbg.c", 601
+	jmp     L0008
+	.dbg	line, "dbg/dbg.c", 602
+L0006:	jsr     ldax0sp
+	jsr     shlax4
+	jsr     stax0sp
+	.dbg	line, "dbg/dbg.c", 603
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+	.dbg	line, "dbg/dbg.c", 604
+	ldy     #$02
+	lda     (c_sp),y
+	sec
+	sbc     #$30
+	.dbg	line, "dbg/dbg.c", 605
+	jmp     L0010
+	.dbg	line, "dbg/dbg.c", 606
+L000C:	ldy     #$02
+	tax
+	lda     (c_sp),y
+	jsr     _toupper
+	ldy     #$37
+	jsr     decaxy
+	ldy     #$02
+L0010:	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 608
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     addeq0sp
+	.dbg	line, "dbg/dbg.c", 609
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "dbg/dbg.c", 601
+L0008:	ldy     #$04
+	jsr     ldptr1ysp
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (c_sp),y
+	tax
+	beq     L000F
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+	.dbg	line, "dbg/dbg.c", 613
+L000F:	ldy     #$0B
+	jsr     ldptr1ysp
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 616
+	ldx     #$00
+	tya
+	.dbg	line, "dbg/dbg.c", 624
+L000E:	ldy     #$0E
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ErrorPrompt (const char *Msg)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ErrorPrompt: near
+
+	.dbg	func, "ErrorPrompt", "00", static, "_ErrorPrompt"
+	.dbg	sym, "Msg", "00", auto, 0
+	.dbg	sym, "OldPrompt", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 630
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 632
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 635
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DisplayPrompt
+	.dbg	line, "dbg/dbg.c", 638
+	jsr     _cgetc
+	.dbg	line, "dbg/dbg.c", 641
+	jsr     ldax0sp
+	jsr     _DisplayPrompt
+	.dbg	line, "dbg/dbg.c", 642
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ InputGoto (unsigned int *Addr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputGoto: near
+
+	.dbg	func, "InputGoto", "00", static, "_InputGoto"
+	.dbg	sym, "Addr", "00", auto, 0
+	.dbg	sym, "Ok", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 648
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 650
+	jsr     decsp1
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _InputHex
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 651
+	lda     (c_sp),y
+	bne     L0003
+	.dbg	line, "dbg/dbg.c", 652
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     _ErrorPrompt
+	.dbg	line, "dbg/dbg.c", 654
+L0003:	ldx     #$00
+	lda     (c_sp,x)
+	.dbg	line, "dbg/dbg.c", 655
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ BreakInRomError (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_BreakInRomError: near
+
+	.dbg	func, "BreakInRomError", "00", static, "_BreakInRomError"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 662
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jmp     _ErrorPrompt
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgSetTmpBreak (unsigned int Addr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgSetTmpBreak: near
+
+	.dbg	func, "DbgSetTmpBreak", "00", static, "_DbgSetTmpBreak"
+	.dbg	sym, "Addr", "00", auto, 0
+	.dbg	sym, "B", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 675
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 676
+	jsr     _DbgGetBreakSlot
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 677
+	jsr     ldptr10sp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 678
+	jsr     ldptr10sp
+	lda     #$80
+	ldy     #$03
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 679
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgToggleUserBreak (unsigned int Addr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgToggleUserBreak: near
+
+	.dbg	func, "DbgToggleUserBreak", "00", static, "_DbgToggleUserBreak"
+	.dbg	sym, "Addr", "00", auto, 0
+	.dbg	sym, "B", "00", register, "regbank", 4
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 685
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 686
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	jsr     _DbgIsBreak
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "dbg/dbg.c", 688
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0002
+	.dbg	line, "dbg/dbg.c", 690
+	lda     #$00
+	ldy     #$03
+	sta     (regbank+4),y
+	.dbg	line, "dbg/dbg.c", 691
+	dec     _DbgBreakCount
+	.dbg	line, "dbg/dbg.c", 692
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 694
+L0002:	lda     _DbgBreakCount
+	cmp     #$0A
+	bcc     L0004
+	.dbg	line, "dbg/dbg.c", 695
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     _ErrorPrompt
+	.dbg	line, "dbg/dbg.c", 696
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 698
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+	.dbg	line, "dbg/dbg.c", 699
+	jsr     _BreakInRomError
+	.dbg	line, "dbg/dbg.c", 700
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 702
+L0006:	jsr     _DbgGetBreakSlot
+	sta     regbank+4
+	stx     regbank+4+1
+	.dbg	line, "dbg/dbg.c", 703
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 704
+	tya
+	ldy     #$03
+	sta     (regbank+4),y
+	.dbg	line, "dbg/dbg.c", 705
+	inc     _DbgBreakCount
+	.dbg	line, "dbg/dbg.c", 709
+L0007:	ldy     #$00
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgResetTmpBreaks (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgResetTmpBreaks: near
+
+	.dbg	func, "DbgResetTmpBreaks", "00", static, "_DbgResetTmpBreaks"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "B", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 717
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 719
+	lda     #$00
+	ldy     #$02
+L0007:	sta     (c_sp),y
+	cmp     #$0A
+	bcs     L0003
+	.dbg	line, "dbg/dbg.c", 720
+	jsr     ldptr10sp
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0006
+	.dbg	line, "dbg/dbg.c", 721
+	jsr     ldptr10sp
+	lda     #$00
+	ldy     #$03
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 723
+L0006:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	.dbg	line, "dbg/dbg.c", 719
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 725
+L0003:	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DbgTmpBreaksOk (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgTmpBreaksOk: near
+
+	.dbg	func, "DbgTmpBreaksOk", "00", static, "_DbgTmpBreaksOk"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "B", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 735
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 736
+	lda     #$00
+	ldy     #$02
+L000A:	sta     (c_sp),y
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$0A
+	bcs     L000C
+	.dbg	line, "dbg/dbg.c", 737
+	jsr     ldptr10sp
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0006
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+	.dbg	line, "dbg/dbg.c", 738
+	jsr     _BreakInRomError
+	.dbg	line, "dbg/dbg.c", 739
+	jsr     _DbgResetTmpBreaks
+	.dbg	line, "dbg/dbg.c", 740
+	ldx     #$00
+	txa
+	jmp     incsp3
+	.dbg	line, "dbg/dbg.c", 742
+L0006:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	.dbg	line, "dbg/dbg.c", 736
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L000A
+	.dbg	line, "dbg/dbg.c", 744
+L000C:	lda     #$01
+	.dbg	line, "dbg/dbg.c", 745
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmBack (unsigned int mem, unsigned char lines)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmBack: near
+
+	.dbg	func, "AsmBack", "00", static, "_AsmBack"
+	.dbg	sym, "mem", "00", auto, 1
+	.dbg	sym, "lines", "00", auto, 0
+	.dbg	sym, "cur", "00", auto, -2
+	.dbg	sym, "adr", "00", auto, -66
+	.dbg	sym, "in", "00", auto, -67
+	.dbg	sym, "offs", "00", auto, -69
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 759
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 764
+	ldy     #$43
+	jsr     subysp
+	lda     #$06
+	jsr     pusha0
+	.dbg	line, "dbg/dbg.c", 766
+L0002:	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 767
+	ldy     #$49
+	jsr     pushwysp
+	ldy     #$47
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     mulax3
+	jsr     tossubax
+	sec
+	ldy     #$00
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	ldy     #$43
+	jsr     staxysp
+	.dbg	line, "dbg/dbg.c", 769
+L0005:	ldy     #$44
+	jsr     ldaxysp
+	jsr     _DbgDisAsmLen
+	ldy     #$43
+	jsr     addeqysp
+	.dbg	line, "dbg/dbg.c", 770
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	asl     a
+	bcc     L000E
+	inx
+L000E:	jsr     incax3
+	jsr     leaaxsp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 771
+	iny
+	lda     (c_sp),y
+	clc
+	adc     #$01
+	and     #$1F
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 772
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bcc     L0005
+	.dbg	line, "dbg/dbg.c", 773
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (c_sp),y
+	bne     L0011
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L000A
+L0011:	ldy     #$01
+	lda     (c_sp),y
+	bne     L0013
+	dey
+	lda     (c_sp),y
+	cmp     #$0C
+	bne     L0013
+	.dbg	line, "dbg/dbg.c", 775
+L000A:	ldy     #$02
+	lda     (c_sp),y
+	sec
+	ldy     #$45
+	sbc     (c_sp),y
+	sec
+	sbc     #$01
+	ldx     #$00
+	and     #$1F
+	asl     a
+	bcc     L000F
+	inx
+L000F:	jsr     incax3
+	jsr     leaaxsp
+	jsr     ldaxi
+	jmp     L0003
+	.dbg	line, "dbg/dbg.c", 780
+L0013:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	.dbg	line, "dbg/dbg.c", 781
+	jmp     L0002
+	.dbg	line, "dbg/dbg.c", 786
+L0003:	ldy     #$48
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateAsm: near
+
+	.dbg	func, "UpdateAsm", "00", static, "_UpdateAsm"
+	.dbg	sym, "buf", "00", auto, -40
+	.dbg	sym, "len", "00", auto, -41
+	.dbg	sym, "y", "00", auto, -42
+	.dbg	sym, "width", "00", auto, -43
+	.dbg	sym, "x", "00", auto, -44
+	.dbg	sym, "m", "00", auto, -46
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 796
+	ldy     #$2A
+	jsr     subysp
+	lda     _AsmFrame+8
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 797
+	lda     _AsmFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 798
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$02
+	jsr     _AsmBack
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 800
+	lda     _AsmFrame+5
+	clc
+	adc     #$01
+	ldy     #$04
+L000C:	sta     (c_sp),y
+	cmp     _AsmFrame+7
+	jcs     L0003
+	.dbg	line, "dbg/dbg.c", 801
+	jsr     pushw0sp
+	lda     #$08
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	jsr     _DbgDisAsm
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 802
+	jsr     ldax0sp
+	cpx     _brk_pc+1
+	bne     L0006
+	cmp     _brk_pc
+	bne     L0006
+	.dbg	line, "dbg/dbg.c", 803
+	lda     #$2D
+	ldy     #$0A
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 804
+	lda     #$3E
+	iny
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 806
+L0006:	jsr     pushw0sp
+	jsr     _DbgIsBreak
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 807
+	lda     #$2A
+	ldy     #$0B
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 809
+L0007:	jsr     ldax0sp
+	cpx     _AsmAddr+1
+	bne     L0008
+	cmp     _AsmAddr
+	bne     L0008
+	.dbg	line, "dbg/dbg.c", 810
+	lda     #$01
+	jsr     _revers
+	.dbg	line, "dbg/dbg.c", 811
+	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 812
+	lda     #$00
+	jsr     _revers
+	.dbg	line, "dbg/dbg.c", 813
+	jmp     L0009
+	.dbg	line, "dbg/dbg.c", 814
+L0008:	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 816
+L0009:	ldy     #$05
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     addeq0sp
+	.dbg	line, "dbg/dbg.c", 800
+	ldy     #$04
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L000C
+	.dbg	line, "dbg/dbg.c", 818
+L0003:	jsr     ldax0sp
+	.dbg	line, "dbg/dbg.c", 819
+	ldy     #$2E
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmArg16: near
+
+	.dbg	func, "AsmArg16", "00", static, "_AsmArg16"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 826
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	ldy     #$02
+	jmp     ldaxidx
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmFollow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmFollow: near
+
+	.dbg	func, "AsmFollow", "00", static, "_AsmFollow"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 834
+	lda     _AsmAddr+1
+	sta     ptr1+1
+	lda     _AsmAddr
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	.dbg	line, "dbg/dbg.c", 864
+	cmp     #$10
+	beq     L0007
+	cmp     #$20
+	beq     L0004
+	cmp     #$30
+	beq     L0007
+	cmp     #$40
+	beq     L0015
+	cmp     #$4C
+	beq     L0004
+	cmp     #$50
+	beq     L0007
+	cmp     #$60
+	beq     L0014
+	cmp     #$6C
+	beq     L0006
+	cmp     #$70
+	beq     L0007
+	cmp     #$90
+	beq     L0007
+	cmp     #$B0
+	beq     L0007
+	cmp     #$D0
+	beq     L0007
+	cmp     #$F0
+	beq     L0007
+	rts
+	.dbg	line, "dbg/dbg.c", 838
+L0004:	jsr     _AsmArg16
+	.dbg	line, "dbg/dbg.c", 839
+	jmp     L0016
+	.dbg	line, "dbg/dbg.c", 842
+L0006:	jsr     _AsmArg16
+	.dbg	line, "dbg/dbg.c", 843
+	jmp     L0012
+	.dbg	line, "dbg/dbg.c", 853
+L0007:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax2
+	sta     sreg
+	stx     sreg+1
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	jsr     ldaidx
+	clc
+	adc     sreg
+	sta     _AsmAddr
+	txa
+	adc     sreg+1
+	tax
+	.dbg	line, "dbg/dbg.c", 854
+	jmp     L0013
+	.dbg	line, "dbg/dbg.c", 857
+L0014:	ldx     #$01
+	txa
+	clc
+	adc     _DbgSP
+	bcc     L0011
+	inx
+L0011:	jsr     ldaxi
+	jsr     incax1
+	.dbg	line, "dbg/dbg.c", 858
+	jmp     L0016
+	.dbg	line, "dbg/dbg.c", 861
+L0015:	ldx     #$01
+	lda     #$02
+	clc
+	adc     _DbgSP
+	bcc     L0012
+	inx
+L0012:	jsr     ldaxi
+L0016:	sta     _AsmAddr
+L0013:	stx     _AsmAddr+1
+	.dbg	line, "dbg/dbg.c", 865
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHome: near
+
+	.dbg	func, "AsmHome", "00", static, "_AsmHome"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 872
+	lda     _brk_pc+1
+	sta     _AsmAddr+1
+	lda     _brk_pc
+	sta     _AsmAddr
+	.dbg	line, "dbg/dbg.c", 873
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitAsm: near
+
+	.dbg	func, "InitAsm", "00", static, "_InitAsm"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 880
+	jsr     _AsmHome
+	.dbg	line, "dbg/dbg.c", 881
+	jmp     _UpdateAsm
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateReg: near
+
+	.dbg	func, "UpdateReg", "00", static, "_UpdateReg"
+	.dbg	sym, "x1", "00", auto, -1
+	.dbg	sym, "x2", "00", auto, -2
+	.dbg	sym, "y", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 963
+	lda     _RegFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 964
+	ldy     #$00
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 965
+	lda     _RegFrame+5
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 968
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _cputhex16
+	.dbg	line, "dbg/dbg.c", 969
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _brk_sr
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 970
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _brk_a
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 971
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _brk_x
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 972
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _brk_y
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 973
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _DbgSP
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 974
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _DbgCS
+	ldx     _DbgCS+1
+	jsr     _cputhex16
+	.dbg	line, "dbg/dbg.c", 975
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jsr     _gotoxy
+	lda     _DbgHI
+	ldx     _DbgHI+1
+	jsr     _cputhex16
+	.dbg	line, "dbg/dbg.c", 978
+	ldx     #$00
+	txa
+	.dbg	line, "dbg/dbg.c", 979
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitReg: near
+
+	.dbg	func, "InitReg", "00", static, "_InitReg"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 986
+	jmp     _UpdateReg
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateStack: near
+
+	.dbg	func, "UpdateStack", "00", static, "_UpdateStack"
+	.dbg	sym, "mem", "00", auto, -1
+	.dbg	sym, "x1", "00", auto, -2
+	.dbg	sym, "x2", "00", auto, -3
+	.dbg	sym, "y", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1008
+	lda     _StackAddr
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1009
+	lda     _StackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1010
+	ldy     #$00
+	lda     (c_sp),y
+	clc
+	adc     #$06
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1013
+	jsr     decsp1
+	lda     _StackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L0007:	sta     (c_sp),y
+	cmp     _StackFrame+5
+	bcc     L0003
+	beq     L0003
+	.dbg	line, "dbg/dbg.c", 1014
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     _gotoxy
+	.dbg	line, "dbg/dbg.c", 1015
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 1016
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     _gotoxy
+	.dbg	line, "dbg/dbg.c", 1017
+	ldx     #$01
+	clc
+	ldy     #$03
+	lda     (c_sp),y
+	bcc     L0006
+	inx
+L0006:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cputhex8
+	.dbg	line, "dbg/dbg.c", 1018
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1013
+	ldy     #$00
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1020
+L0003:	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1021
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ StackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHome: near
+
+	.dbg	func, "StackHome", "00", static, "_StackHome"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1028
+	lda     _DbgSP
+	clc
+	adc     #$01
+	sta     _StackAddr
+	.dbg	line, "dbg/dbg.c", 1029
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitStack: near
+
+	.dbg	func, "InitStack", "00", static, "_InitStack"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1036
+	jsr     _StackHome
+	.dbg	line, "dbg/dbg.c", 1037
+	jmp     _UpdateStack
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateCStack: near
+
+	.dbg	func, "UpdateCStack", "00", static, "_UpdateCStack"
+	.dbg	sym, "mem", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -3
+	.dbg	sym, "y", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1100
+	lda     _CStackAddr
+	ldx     _CStackAddr+1
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 1101
+	lda     _CStackFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1104
+	jsr     decsp1
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L0006:	sta     (c_sp),y
+	cmp     _CStackFrame+5
+	bcc     L0007
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 1105
+	iny
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     _gotoxy
+	.dbg	line, "dbg/dbg.c", 1106
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     _cputhex16
+	.dbg	line, "dbg/dbg.c", 1107
+	ldy     #$02
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	.dbg	line, "dbg/dbg.c", 1104
+	ldy     #$00
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1109
+L0007:	lda     _CStackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	jsr     pusha
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 1110
+	ldy     #$03
+	jsr     ldaxysp
+	.dbg	line, "dbg/dbg.c", 1111
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CStackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHome: near
+
+	.dbg	func, "CStackHome", "00", static, "_CStackHome"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1118
+	lda     _DbgCS+1
+	sta     _CStackAddr+1
+	lda     _DbgCS
+	sta     _CStackAddr
+	.dbg	line, "dbg/dbg.c", 1119
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitCStack: near
+
+	.dbg	func, "InitCStack", "00", static, "_InitCStack"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1126
+	jsr     _CStackHome
+	.dbg	line, "dbg/dbg.c", 1127
+	jmp     _UpdateCStack
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateDump (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateDump: near
+
+	.dbg	func, "UpdateDump", "00", static, "_UpdateDump"
+	.dbg	sym, "Buf", "00", auto, -40
+	.dbg	sym, "y", "00", auto, -41
+	.dbg	sym, "mem", "00", auto, -43
+	.dbg	sym, "x", "00", auto, -44
+	.dbg	sym, "p", "00", auto, -46
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1192
+	ldy     #$29
+	jsr     subysp
+	lda     _DumpAddr
+	ldx     _DumpAddr+1
+	jsr     pushax
+	.dbg	line, "dbg/dbg.c", 1193
+	lda     _DumpFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1194
+	ldy     #$04
+	jsr     pushwysp
+	.dbg	line, "dbg/dbg.c", 1196
+	lda     _DumpFrame+5
+	clc
+	adc     #$01
+	ldy     #$05
+L0006:	sta     (c_sp),y
+	cmp     _DumpFrame+7
+	bcs     L0003
+	.dbg	line, "dbg/dbg.c", 1197
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$06
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$0A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	jsr     _DbgMemDump
+	jsr     _cputsxy
+	.dbg	line, "dbg/dbg.c", 1198
+	ldy     #$03
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dbg/dbg.c", 1196
+	ldy     #$05
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0006
+	.dbg	line, "dbg/dbg.c", 1200
+L0003:	dey
+	jsr     ldaxysp
+	.dbg	line, "dbg/dbg.c", 1201
+	ldy     #$2E
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DumpHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHome: near
+
+	.dbg	func, "DumpHome", "00", static, "_DumpHome"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1208
+	lda     #$00
+	sta     _DumpAddr
+	sta     _DumpAddr+1
+	.dbg	line, "dbg/dbg.c", 1209
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetArg16: near
+
+	.dbg	func, "GetArg16", "00", static, "_GetArg16"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1303
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	ldy     #$02
+	jmp     ldaxidx
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetStack16 (unsigned char Offs)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetStack16: near
+
+	.dbg	func, "GetStack16", "00", static, "_GetStack16"
+	.dbg	sym, "Offs", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1310
+	jsr     pusha
+	.dbg	line, "dbg/dbg.c", 1311
+	ldx     #$00
+	lda     (c_sp,x)
+	clc
+	adc     _DbgSP
+	bcc     L0002
+	inx
+L0002:	sta     ptr1
+	stx     ptr1+1
+	ldx     #$01
+	txa
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	.dbg	line, "dbg/dbg.c", 1312
+	jmp     incsp1
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SetRTSBreak (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SetRTSBreak: near
+
+	.dbg	func, "SetRTSBreak", "00", static, "_SetRTSBreak"
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1319
+	lda     #$00
+	jsr     _GetStack16
+	jsr     incax1
+	jmp     _DbgSetTmpBreak
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgEntry (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgEntry: near
+
+	.dbg	func, "DbgEntry", "00", static, "_DbgEntry"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "done", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dbg/dbg.c", 1480
+	jsr     decsp2
+	lda     M0001
+	beq     L0002
+	.dbg	line, "dbg/dbg.c", 1481
+	lda     #$00
+	sta     M0001
+	.dbg	line, "dbg/dbg.c", 1484
+	jsr     _RedrawStatic
+	.dbg	line, "dbg/dbg.c", 1485
+	jsr     _InitAsm
+	.dbg	line, "dbg/dbg.c", 1486
+	jsr     _InitReg
+	.dbg	line, "dbg/dbg.c", 1487
+	jsr     _InitStack
+	.dbg	line, "dbg/dbg.c", 1488
+	jsr     _InitCStack
+	.dbg	line, "dbg/dbg.c", 1489
+	jsr     _UpdateDump
+	.dbg	line, "dbg/dbg.c", 1495
+L0002:	jsr     _AsmHome
+	.dbg	line, "dbg/dbg.c", 1496
+	jsr     _UpdateReg
+	.dbg	line, "dbg/dbg.c", 1497
+	jsr     _StackHome
+	.dbg	line, "dbg/dbg.c", 1498
+	jsr     _CStackHome
+	.dbg	line, "dbg/dbg.c", 1501
+	lda     #$00
+	tay
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1502
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1503
+L0003:	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$0C
+	jsr     ldaxidx
+	jsr     callax
+	ldy     #$01
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1504
+	ldx     #$00
+	lda     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1588
+	jeq     L001F
+	cmp     #$0A
+	jeq     L001E
+	cmp     #$20
+	jeq     L001D
+	cmp     #$31
+	beq     L001C
+	cmp     #$32
+	beq     L001C
+	cmp     #$33
+	beq     L001C
+	cmp     #$34
+	beq     L001C
+	cmp     #$35
+	beq     L001C
+	cmp     #$3F
+	beq     L000D
+	cmp     #$63
+	jeq     L001F
+	cmp     #$68
+	beq     L000F
+	cmp     #$71
+	jeq     L0019
+	cmp     #$72
+	jeq     L0020
+	cmp     #$73
+	beq     L0017
+	cmp     #$75
+	beq     L000E
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1511
+L001C:	lda     (c_sp),y
+	ldy     #$31
+	jsr     decaxy
+	jsr     pushax
+	lda     #$00
+	jsr     _ActivateFrame
+	.dbg	line, "dbg/dbg.c", 1512
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1518
+L000D:	jsr     _HelpHandler
+	.dbg	line, "dbg/dbg.c", 1519
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1526
+L000E:	jsr     _SetRTSBreak
+	.dbg	line, "dbg/dbg.c", 1527
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1528
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1535
+L000F:	lda     _brk_pc
+	ldx     _brk_pc+1
+	cpx     _AsmAddr+1
+	bne     L0022
+	cmp     _AsmAddr
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 1536
+L0022:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgSetTmpBreak
+	.dbg	line, "dbg/dbg.c", 1537
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1539
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1545
+L001D:	tya
+	jsr     _SingleStep
+	.dbg	line, "dbg/dbg.c", 1546
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 1548
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1550
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1556
+L001E:	txa
+	jsr     _SingleStep
+	.dbg	line, "dbg/dbg.c", 1557
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0007
+	.dbg	line, "dbg/dbg.c", 1559
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1561
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1565
+L001F:	tya
+	dey
+	sta     (c_sp),y
+	.dbg	line, "dbg/dbg.c", 1566
+	jmp     L0021
+	.dbg	line, "dbg/dbg.c", 1570
+L0017:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _brk_pc
+	sta     _brk_pc
+	txa
+	adc     _brk_pc+1
+	sta     _brk_pc+1
+	.dbg	line, "dbg/dbg.c", 1571
+	jsr     _InitAsm
+	.dbg	line, "dbg/dbg.c", 1572
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1576
+L0020:	lda     _ActiveFrame
+	jsr     _Redraw
+	.dbg	line, "dbg/dbg.c", 1577
+	jmp     L0007
+	.dbg	line, "dbg/dbg.c", 1581
+L0019:	jsr     _clrscr
+	.dbg	line, "dbg/dbg.c", 1586
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "dbg/dbg.c", 1502
+L0007:	ldy     #$00
+L0021:	lda     (c_sp),y
+	jeq     L0003
+	.dbg	line, "dbg/dbg.c", 1590
+	jmp     incsp2
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$01
+
+.endproc
+
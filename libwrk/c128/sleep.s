@@ -0,0 +1,69 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/sleep.c", 418, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.import		_clock
+	.export		_sleep
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ sleep (unsigned int wait)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sleep: near
+
+	.dbg	func, "sleep", "00", static, "_sleep"
+	.dbg	sym, "wait", "00", auto, 0
+	.dbg	sym, "goal", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "common/sleep.c", 19
+	jsr     pushax
+	.dbg	line, "common/sleep.c", 20
+	jsr     _clock
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	lda     #$3C
+	ldx     #$00
+	jsr     tosumul0ax
+	jsr     tosaddeax
+	jsr     pusheax
+	.dbg	line, "common/sleep.c", 21
+L0002:	jsr     ldeax0sp
+	jsr     pusheax
+	jsr     _clock
+	jsr     tossubeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosgeeax
+	bne     L0002
+	.dbg	line, "common/sleep.c", 22
+	ldx     #$00
+	txa
+	.dbg	line, "common/sleep.c", 23
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
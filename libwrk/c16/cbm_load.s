@@ -0,0 +1,80 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/cbm_load.c", 709, 1779181050
+	.dbg		file, "/root/repo/include/cbm.h", 12033, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/c16.h", 2983, 1779181050
+	.dbg		file, "/root/repo/include/cbm264.h", 7189, 1779181050
+	.dbg		file, "/root/repo/include/_ted.h", 5018, 1779181050
+	.dbg		file, "/root/repo/include/cbm_filetype.h", 4949, 1779181050
+	.import		_cbm_k_load
+	.import		_cbm_k_setlfs
+	.import		_cbm_k_setnam
+	.export		_cbm_load
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ cbm_load (const char *name, unsigned char device, void *data)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cbm_load: near
+
+	.dbg	func, "cbm_load", "00", static, "_cbm_load"
+	.dbg	sym, "name", "00", auto, 3
+	.dbg	sym, "device", "00", auto, 2
+	.dbg	sym, "data", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/cbm_load.c", 15
+	jsr     pushax
+	.dbg	line, "cbm/cbm_load.c", 19
+	lda     #$00
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	jsr     _cbm_k_setlfs
+	.dbg	line, "cbm/cbm_load.c", 20
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _cbm_k_setnam
+	.dbg	line, "cbm/cbm_load.c", 21
+	lda     #$00
+	jsr     pusha
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     _cbm_k_load
+	sec
+	ldy     #$00
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	.dbg	line, "cbm/cbm_load.c", 22
+	jmp     incsp5
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,341 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/readdir.c", 3589, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/cbm.h", 12033, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/c16.h", 2983, 1779181050
+	.dbg		file, "/root/repo/include/cbm264.h", 7189, 1779181050
+	.dbg		file, "/root/repo/include/_ted.h", 5018, 1779181050
+	.dbg		file, "/root/repo/include/cbm_filetype.h", 4949, 1779181050
+	.dbg		file, "cbm/dir.h", 1417, 1779181050
+	.dbg		file, "/root/repo/include/dirent.h", 4989, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		___errno
+	.import		__cbm_filetype
+	.export		_readdir
+	.import		__dirread
+	.import		__dirread1
+
+; ---------------------------------------------------------------
+; struct dirent *__near__ __fastcall__ readdir (register struct DIR *dir)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_readdir: near
+
+	.dbg	func, "readdir", "00", static, "_readdir"
+	.dbg	sym, "dir", "00", register, "regbank", 4
+	.dbg	sym, "b", "00", register, "regbank", 2
+	.dbg	sym, "i", "00", register, "regbank", 1
+	.dbg	sym, "count", "00", register, "regbank", 0
+	.dbg	sym, "buffer", "00", auto, -68
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/readdir.c", 19
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "cbm/readdir.c", 20
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	.dbg	line, "cbm/readdir.c", 21
+	lda     regbank+1
+	jsr     pusha
+	.dbg	line, "cbm/readdir.c", 22
+	lda     regbank+0
+	jsr     pusha
+	.dbg	line, "cbm/readdir.c", 30
+	ldy     #$40
+	jsr     subysp
+	ldy     #$03
+	lda     (regbank+4),y
+	sta     M0003+17+1
+	dey
+	lda     (regbank+4),y
+	sta     M0003+17
+	.dbg	line, "cbm/readdir.c", 33
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	.dbg	line, "cbm/readdir.c", 35
+	jeq     L0001
+	.dbg	line, "cbm/readdir.c", 39
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #<(M0003+19)
+	ldx     #>(M0003+19)
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	.dbg	line, "cbm/readdir.c", 40
+	jeq     L0001
+	.dbg	line, "cbm/readdir.c", 44
+	lda     #$00
+	sta     regbank+0
+	lda     c_sp+1
+	sta     regbank+2+1
+	lda     c_sp
+	sta     regbank+2
+L0005:	lda     regbank+0
+	cmp     #$40
+	bcs     L0006
+	.dbg	line, "cbm/readdir.c", 45
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     __dirread1
+	tax
+	.dbg	line, "cbm/readdir.c", 46
+	jeq     L0001
+	.dbg	line, "cbm/readdir.c", 48
+	inc     regbank+0
+	.dbg	line, "cbm/readdir.c", 49
+	ldy     #$00
+	lda     (regbank+2),y
+	.dbg	line, "cbm/readdir.c", 50
+	beq     L0006
+	.dbg	line, "cbm/readdir.c", 44
+	inc     regbank+2
+	bne     L0005
+	inc     regbank+2+1
+	jmp     L0005
+	.dbg	line, "cbm/readdir.c", 55
+L0006:	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     regbank+0
+	jsr     incax4
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$02
+	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	.dbg	line, "cbm/readdir.c", 61
+	ldx     #$00
+	lda     (c_sp,x)
+	.dbg	line, "cbm/readdir.c", 65
+	cmp     #$42
+	jeq     L0033
+	cmp     #$4D
+	jeq     L0033
+	.dbg	line, "cbm/readdir.c", 68
+	txa
+	sta     regbank+1
+	.dbg	line, "cbm/readdir.c", 69
+	sta     M0002
+	.dbg	line, "cbm/readdir.c", 70
+	sta     M0001
+	.dbg	line, "cbm/readdir.c", 71
+	lda     c_sp+1
+	sta     regbank+2+1
+	lda     c_sp
+	sta     regbank+2
+	.dbg	line, "cbm/readdir.c", 72
+	jmp     L0032
+	.dbg	line, "cbm/readdir.c", 73
+L002D:	lda     M0001
+	.dbg	line, "cbm/readdir.c", 123
+	beq     L0015
+	cmp     #$01
+	beq     L0017
+	cmp     #$02
+	beq     L001F
+	cmp     #$03
+	jeq     L0023
+	jmp     L0031
+	.dbg	line, "cbm/readdir.c", 76
+L0015:	tay
+	lda     (regbank+2),y
+	cmp     #$22
+	jne     L0031
+	.dbg	line, "cbm/readdir.c", 77
+	lda     #$01
+	sta     M0001
+	.dbg	line, "cbm/readdir.c", 79
+	jmp     L0031
+	.dbg	line, "cbm/readdir.c", 83
+L0017:	ldy     #$00
+	lda     (regbank+2),y
+	cmp     #$22
+	bne     L002F
+	.dbg	line, "cbm/readdir.c", 85
+	ldy     M0002
+	lda     #$00
+	sta     M0003,y
+	.dbg	line, "cbm/readdir.c", 86
+	lda     M0002
+	sta     M0003+22
+	.dbg	line, "cbm/readdir.c", 87
+	lda     M0003+17
+	cmp     #$03
+	lda     M0003+17+1
+	sbc     #$00
+	bcc     L002E
+	.dbg	line, "cbm/readdir.c", 89
+	lda     #$02
+	sta     M0001
+	.dbg	line, "cbm/readdir.c", 90
+	jmp     L0031
+	.dbg	line, "cbm/readdir.c", 92
+L002E:	lda     #$05
+	sta     M0003+21
+	.dbg	line, "cbm/readdir.c", 93
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jmp     L0001
+	.dbg	line, "cbm/readdir.c", 95
+L002F:	lda     M0002
+	cmp     #$10
+	bcs     L0031
+	.dbg	line, "cbm/readdir.c", 96
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	clc
+	adc     M0002
+	bcc     L001E
+	inx
+L001E:	sta     ptr1
+	stx     ptr1+1
+	lda     (regbank+2),y
+	sta     (ptr1),y
+	.dbg	line, "cbm/readdir.c", 97
+	inc     M0002
+	.dbg	line, "cbm/readdir.c", 99
+	jmp     L0031
+	.dbg	line, "cbm/readdir.c", 103
+L001F:	ldy     #$00
+	lda     (regbank+2),y
+	cmp     #$20
+	beq     L0031
+	.dbg	line, "cbm/readdir.c", 104
+	jsr     __cbm_filetype
+	sta     M0003+21
+	.dbg	line, "cbm/readdir.c", 105
+	ldy     #$00
+	lda     (regbank+2),y
+	cmp     #$44
+	bne     L0021
+	.dbg	line, "cbm/readdir.c", 107
+	lda     #$03
+	sta     M0001
+	.dbg	line, "cbm/readdir.c", 108
+	jmp     L0031
+	.dbg	line, "cbm/readdir.c", 110
+L0021:	lda     #<(M0003)
+	ldx     #>(M0003)
+	jmp     L0001
+	.dbg	line, "cbm/readdir.c", 117
+L0023:	ldy     #$00
+	lda     (regbank+2),y
+	.dbg	line, "cbm/readdir.c", 121
+	cmp     #$45
+	beq     L0025
+	cmp     #$49
+	bne     L0030
+	.dbg	line, "cbm/readdir.c", 119
+	lda     #$02
+	jmp     L002B
+	.dbg	line, "cbm/readdir.c", 120
+L0030:	lda     #$04
+L002B:	sta     M0003+21
+	.dbg	line, "cbm/readdir.c", 122
+L0025:	lda     #<(M0003)
+	ldx     #>(M0003)
+	jmp     L0001
+	.dbg	line, "cbm/readdir.c", 124
+L0031:	inc     regbank+1
+	.dbg	line, "cbm/readdir.c", 125
+	inc     regbank+2
+	bne     L0032
+	inc     regbank+2+1
+	.dbg	line, "cbm/readdir.c", 72
+L0032:	lda     regbank+1
+	cmp     regbank+0
+	jcc     L002D
+	.dbg	line, "cbm/readdir.c", 129
+	ldx     #$00
+	lda     #$0B
+	sta     ___errno
+	stx     ___errno+1
+	.dbg	line, "cbm/readdir.c", 131
+L0033:	txa
+	.dbg	line, "cbm/readdir.c", 132
+L0001:	pha
+	stx     tmp1
+	ldy     #$45
+	ldx     #$05
+L002A:	lda     (c_sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L002A
+	ldx     tmp1
+	pla
+	ldy     #$46
+	jmp     addysp
+
+	.dbg	line
+.segment	"RODATA"
+
+M0004:
+	.word	$0000
+M0005:
+	.word	$0000
+M0006:
+	.word	$0000
+M0007:
+	.word	$0000
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+M0002:
+	.res	1,$00
+M0003:
+	.res	23,$00
+
+.endproc
+
@@ -0,0 +1,487 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/cbm_dir.c", 5589, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.dbg		file, "/root/repo/include/cbm.h", 12033, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/c64.h", 7187, 1779181050
+	.dbg		file, "/root/repo/include/_vic2.h", 10835, 1779181050
+	.dbg		file, "/root/repo/include/_sid.h", 3626, 1779181050
+	.dbg		file, "/root/repo/include/_6526.h", 3962, 1779181050
+	.dbg		file, "/root/repo/include/cbm_filetype.h", 4949, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		sym, "__oserror", "00", extern, "___oserror"
+	.import		__cbm_filetype
+	.import		_cbm_k_basin
+	.import		_cbm_k_chkin
+	.import		_cbm_k_clrch
+	.import		_cbm_k_readst
+	.import		_cbm_open
+	.import		_cbm_close
+	.export		_cbm_opendir
+	.export		_cbm_readdir
+	.export		_cbm_closedir
+	.import		___oserror
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$24,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ cbm_opendir (unsigned char lfn, unsigned char device, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cbm_opendir: near
+
+	.dbg	func, "cbm_opendir", "00", static, "_cbm_opendir"
+	.dbg	sym, "lfn", "00", auto, 2
+	.dbg	sym, "device", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "ap", "00", auto, -2
+	.dbg	sym, "name", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/cbm_dir.c", 29
+	jsr     enter
+	.dbg	line, "cbm/cbm_dir.c", 31
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "cbm/cbm_dir.c", 34
+	ldy     #$04
+	lda     (c_sp),y
+	cmp     #$04
+	bne     L0006
+	.dbg	line, "cbm/cbm_dir.c", 35
+	jsr     leaa0sp
+	jsr     incax3
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cbm/cbm_dir.c", 36
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jsr     stax0sp
+	.dbg	line, "cbm/cbm_dir.c", 41
+	ldy     #$04
+L0006:	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     pusha
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _cbm_open
+	cmp     #$00
+	bne     L0005
+	.dbg	line, "cbm/cbm_dir.c", 42
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cbm_k_chkin
+	sta     ___oserror
+	cmp     #$00
+	bne     L0005
+	.dbg	line, "cbm/cbm_dir.c", 44
+	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 45
+	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 46
+	jsr     _cbm_k_clrch
+	.dbg	line, "cbm/cbm_dir.c", 47
+	jsr     _cbm_k_readst
+	tax
+	beq     L0007
+	.dbg	line, "cbm/cbm_dir.c", 48
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cbm_close
+	.dbg	line, "cbm/cbm_dir.c", 49
+	lda     #$04
+	sta     ___oserror
+	.dbg	line, "cbm/cbm_dir.c", 53
+L0005:	ldx     #$00
+L0007:	lda     ___oserror
+	.dbg	line, "cbm/cbm_dir.c", 54
+	ldy     #$04
+	jmp     leavey
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ cbm_readdir (unsigned char lfn, register struct cbm_dirent *l_dirent)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cbm_readdir: near
+
+	.dbg	func, "cbm_readdir", "00", static, "_cbm_readdir"
+	.dbg	sym, "lfn", "00", auto, 2
+	.dbg	sym, "l_dirent", "00", register, "regbank", 4
+	.dbg	sym, "byte", "00", auto, -1
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "is_header", "00", auto, -3
+	.dbg	sym, "rv", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/cbm_dir.c", 64
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "cbm/cbm_dir.c", 65
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "cbm/cbm_dir.c", 66
+	jsr     pusha
+	.dbg	line, "cbm/cbm_dir.c", 67
+	lda     #$01
+	jsr     pusha
+	.dbg	line, "cbm/cbm_dir.c", 69
+	ldy     #$06
+	lda     (c_sp),y
+	jsr     _cbm_k_chkin
+	tax
+	jne     L0003
+	.dbg	line, "cbm/cbm_dir.c", 70
+	jsr     _cbm_k_readst
+	tax
+	jne     L0003
+	.dbg	line, "cbm/cbm_dir.c", 72
+	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 73
+	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 76
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	jsr     _cbm_k_basin
+	jsr     pushax
+	jsr     _cbm_k_basin
+	tax
+	lda     #$00
+	jsr     tosorax
+	ldy     #$11
+	jsr     staxspidx
+	.dbg	line, "cbm/cbm_dir.c", 78
+	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 94
+	cmp     #$12
+	beq     L002F
+	cmp     #$42
+	beq     L000A
+	cmp     #$4D
+	beq     L000A
+	jmp     L0031
+	.dbg	line, "cbm/cbm_dir.c", 86
+L0008:	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 85
+L000A:	jsr     _cbm_k_readst
+	tax
+	beq     L0008
+	.dbg	line, "cbm/cbm_dir.c", 88
+	lda     #$02
+	.dbg	line, "cbm/cbm_dir.c", 89
+	jmp     L0037
+	.dbg	line, "cbm/cbm_dir.c", 93
+L002F:	lda     #$01
+	tay
+	.dbg	line, "cbm/cbm_dir.c", 94
+	jmp     L002E
+	.dbg	line, "cbm/cbm_dir.c", 98
+L000D:	jsr     _cbm_k_readst
+	tax
+	beq     L0010
+	.dbg	line, "cbm/cbm_dir.c", 99
+	lda     #$03
+	.dbg	line, "cbm/cbm_dir.c", 100
+	jmp     L0037
+	.dbg	line, "cbm/cbm_dir.c", 102
+L0010:	jsr     _cbm_k_basin
+	ldy     #$03
+L002E:	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 96
+	ldy     #$03
+L0031:	lda     (c_sp),y
+	cmp     #$22
+	bne     L000D
+	.dbg	line, "cbm/cbm_dir.c", 105
+	jmp     L0015
+	.dbg	line, "cbm/cbm_dir.c", 107
+L0011:	jsr     _cbm_k_readst
+	tax
+	beq     L0014
+	.dbg	line, "cbm/cbm_dir.c", 108
+	lda     #$04
+	.dbg	line, "cbm/cbm_dir.c", 109
+	jmp     L0037
+	.dbg	line, "cbm/cbm_dir.c", 112
+L0014:	ldy     #$02
+	lda     (c_sp),y
+	cmp     #$10
+	bcs     L0015
+	.dbg	line, "cbm/cbm_dir.c", 113
+	clc
+	adc     regbank+4
+	ldx     regbank+4+1
+	bcc     L002B
+	inx
+L002B:	sta     ptr1
+	stx     ptr1+1
+	iny
+	lda     (c_sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	.dbg	line, "cbm/cbm_dir.c", 114
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 105
+L0015:	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	cmp     #$22
+	bne     L0011
+	.dbg	line, "cbm/cbm_dir.c", 117
+	dey
+	lda     (c_sp),y
+	clc
+	adc     regbank+4
+	ldx     regbank+4+1
+	bcc     L002C
+	inx
+L002C:	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	.dbg	line, "cbm/cbm_dir.c", 119
+	iny
+	lda     (c_sp),y
+	beq     L001E
+	.dbg	line, "cbm/cbm_dir.c", 120
+	lda     #$05
+	ldy     #$13
+	sta     (regbank+4),y
+	.dbg	line, "cbm/cbm_dir.c", 123
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 125
+L0017:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	jsr     _cbm_k_basin
+	ldy     #$05
+	sta     (c_sp),y
+	ldy     #$14
+	jsr     staspidx
+	.dbg	line, "cbm/cbm_dir.c", 126
+	ldy     #$02
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	sta     (c_sp),y
+	cmp     #$00
+	bne     L0017
+	.dbg	line, "cbm/cbm_dir.c", 128
+	jmp     L0029
+	.dbg	line, "cbm/cbm_dir.c", 132
+L001B:	jsr     _cbm_k_readst
+	tax
+	beq     L001E
+	.dbg	line, "cbm/cbm_dir.c", 133
+	lda     #$05
+	.dbg	line, "cbm/cbm_dir.c", 134
+	jmp     L0037
+	.dbg	line, "cbm/cbm_dir.c", 130
+L001E:	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	cmp     #$20
+	beq     L001B
+	.dbg	line, "cbm/cbm_dir.c", 138
+	tya
+	ldy     #$14
+	sta     (regbank+4),y
+	.dbg	line, "cbm/cbm_dir.c", 141
+	tay
+	lda     (c_sp),y
+	cmp     #$2A
+	bne     L001F
+	.dbg	line, "cbm/cbm_dir.c", 142
+	lda     #$02
+	ldy     #$14
+	sta     (regbank+4),y
+	.dbg	line, "cbm/cbm_dir.c", 143
+	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 147
+L001F:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     __cbm_filetype
+	ldy     #$13
+	jsr     staspidx
+	.dbg	line, "cbm/cbm_dir.c", 150
+	jsr     _cbm_k_basin
+	cmp     #$49
+	bne     L0020
+	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$44
+	bne     L0020
+	.dbg	line, "cbm/cbm_dir.c", 151
+	lda     #$02
+	ldy     #$13
+	sta     (regbank+4),y
+	.dbg	line, "cbm/cbm_dir.c", 153
+L0020:	jsr     _cbm_k_basin
+	.dbg	line, "cbm/cbm_dir.c", 156
+	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	cmp     #$3C
+	bne     L0036
+	.dbg	line, "cbm/cbm_dir.c", 157
+	ldy     #$14
+	lda     (regbank+4),y
+	cmp     #$02
+	.dbg	line, "cbm/cbm_dir.c", 158
+	bne     L0033
+	lda     #$00
+	jmp     L0035
+L0033:	lda     #$01
+L0035:	sta     (regbank+4),y
+	.dbg	line, "cbm/cbm_dir.c", 163
+	jmp     L0029
+	.dbg	line, "cbm/cbm_dir.c", 165
+L0027:	jsr     _cbm_k_readst
+	tax
+	beq     L002A
+	.dbg	line, "cbm/cbm_dir.c", 166
+	lda     #$06
+	.dbg	line, "cbm/cbm_dir.c", 167
+	jmp     L0037
+	.dbg	line, "cbm/cbm_dir.c", 169
+L002A:	jsr     _cbm_k_basin
+	ldy     #$03
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 163
+L0029:	ldy     #$03
+L0036:	lda     (c_sp),y
+	bne     L0027
+	.dbg	line, "cbm/cbm_dir.c", 172
+L0037:	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "cbm/cbm_dir.c", 177
+L0003:	jsr     _cbm_k_clrch
+	.dbg	line, "cbm/cbm_dir.c", 178
+	ldx     #$00
+	lda     (c_sp,x)
+	.dbg	line, "cbm/cbm_dir.c", 179
+	pha
+	ldy     #$04
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp7
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+M0005:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ cbm_closedir (unsigned char lfn)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cbm_closedir: near
+
+	.dbg	func, "cbm_closedir", "00", static, "_cbm_closedir"
+	.dbg	sym, "lfn", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/cbm_dir.c", 184
+	jsr     pusha
+	.dbg	line, "cbm/cbm_dir.c", 185
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _cbm_close
+	.dbg	line, "cbm/cbm_dir.c", 186
+	jmp     incsp1
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,81 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/cbm_save.c", 700, 1779181050
+	.dbg		file, "/root/repo/include/cbm.h", 12033, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/c64.h", 7187, 1779181050
+	.dbg		file, "/root/repo/include/_vic2.h", 10835, 1779181050
+	.dbg		file, "/root/repo/include/_sid.h", 3626, 1779181050
+	.dbg		file, "/root/repo/include/_6526.h", 3962, 1779181050
+	.dbg		file, "/root/repo/include/cbm_filetype.h", 4949, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		sym, "__oserror", "00", extern, "___oserror"
+	.import		_cbm_k_save
+	.import		_cbm_k_setlfs
+	.import		_cbm_k_setnam
+	.export		_cbm_save
+	.import		___oserror
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ cbm_save (const char *name, unsigned char device, const void *data, unsigned int size)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cbm_save: near
+
+	.dbg	func, "cbm_save", "00", static, "_cbm_save"
+	.dbg	sym, "name", "00", auto, 5
+	.dbg	sym, "device", "00", auto, 4
+	.dbg	sym, "data", "00", auto, 2
+	.dbg	sym, "size", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/cbm_save.c", 19
+	jsr     pushax
+	.dbg	line, "cbm/cbm_save.c", 20
+	lda     #$00
+	jsr     pusha
+	ldy     #$05
+	lda     (c_sp),y
+	jsr     pusha
+	lda     #$00
+	jsr     _cbm_k_setlfs
+	.dbg	line, "cbm/cbm_save.c", 21
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     _cbm_k_setnam
+	.dbg	line, "cbm/cbm_save.c", 23
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     _cbm_k_save
+	sta     ___oserror
+	.dbg	line, "cbm/cbm_save.c", 24
+	jmp     incsp7
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,205 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/opendir.c", 1427, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "cbm/dir.h", 1417, 1779181050
+	.dbg		file, "/root/repo/include/dirent.h", 4989, 1779181050
+	.dbg		file, "/root/repo/include/target.h", 3090, 1779181050
+	.dbg		file, "/root/repo/include/cbm.h", 12033, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/c64.h", 7187, 1779181050
+	.dbg		file, "/root/repo/include/_vic2.h", 10835, 1779181050
+	.dbg		file, "/root/repo/include/_sid.h", 3626, 1779181050
+	.dbg		file, "/root/repo/include/_6526.h", 3962, 1779181050
+	.dbg		file, "/root/repo/include/cbm_filetype.h", 4949, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_malloc
+	.import		_memcpy
+	.import		_open
+	.import		___errno
+	.export		_opendir
+	.import		__dirread
+
+; ---------------------------------------------------------------
+; struct DIR *__near__ __fastcall__ opendir (register const char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_opendir: near
+
+	.dbg	func, "opendir", "00", static, "_opendir"
+	.dbg	sym, "name", "00", register, "regbank", 4
+	.dbg	sym, "buf", "00", auto, -2
+	.dbg	sym, "dir", "00", auto, -4
+	.dbg	sym, "d", "00", auto, -25
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/opendir.c", 15
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "cbm/opendir.c", 17
+	jsr     decsp2
+	jsr     push0
+	.dbg	line, "cbm/opendir.c", 23
+	ldy     #$15
+	jsr     subysp
+	lda     #$24
+	ldy     #$04
+	sta     (c_sp),y
+	.dbg	line, "cbm/opendir.c", 24
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0028
+	ldy     #$00
+	lda     (regbank+4),y
+	beq     L0028
+	cmp     #$2E
+	bne     L0020
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1),y
+	bne     L0020
+	.dbg	line, "cbm/opendir.c", 25
+L0028:	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "cbm/opendir.c", 26
+	jmp     L0026
+L0020:	lda     (regbank+4),y
+	cmp     #$30
+	beq     L0021
+	cmp     #$31
+	bne     L0025
+L0021:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     #$3A
+	bne     L0025
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax2
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	beq     L0024
+	ldx     #$00
+	jmp     L0025
+	.dbg	line, "cbm/opendir.c", 27
+L0024:	lda     (regbank+4),y
+	ldy     #$05
+	sta     (c_sp),y
+	.dbg	line, "cbm/opendir.c", 28
+	ldx     #$00
+	txa
+	iny
+	sta     (c_sp),y
+	.dbg	line, "cbm/opendir.c", 29
+	jmp     L0026
+	.dbg	line, "cbm/opendir.c", 30
+L0025:	lda     #$07
+	.dbg	line, "cbm/opendir.c", 31
+	jmp     L0027
+	.dbg	line, "cbm/opendir.c", 35
+L0026:	lda     #$02
+	tay
+	jsr     staxysp
+	.dbg	line, "cbm/opendir.c", 38
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	jsr     stax0sp
+	.dbg	line, "cbm/opendir.c", 39
+	txa
+	bmi     L0015
+	.dbg	line, "cbm/opendir.c", 42
+	lda     c_sp
+	ldx     c_sp+1
+	jsr     pushax
+	lda     #$19
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	beq     L0015
+	.dbg	line, "cbm/opendir.c", 45
+	ldx     #$00
+	lda     #$15
+	jsr     _malloc
+	ldy     #$15
+	jsr     staxysp
+	.dbg	line, "cbm/opendir.c", 48
+	ldy     #$16
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0014
+	.dbg	line, "cbm/opendir.c", 49
+	ldy     #$18
+	jsr     pushwysp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$15
+	jsr     _memcpy
+	.dbg	line, "cbm/opendir.c", 50
+	jmp     L0015
+	.dbg	line, "cbm/opendir.c", 52
+L0014:	tax
+	lda     #$02
+L0027:	sta     ___errno
+	stx     ___errno+1
+	.dbg	line, "cbm/opendir.c", 59
+L0015:	ldy     #$16
+	jsr     ldaxysp
+	.dbg	line, "cbm/opendir.c", 60
+	pha
+	ldy     #$19
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
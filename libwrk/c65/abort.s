@@ -0,0 +1,61 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"4510"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/abort.c", 244, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/signal.h", 3345, 1779181050
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.import		_stderr
+	.import		_fputs
+	.export		_abort
+	.import		_exit
+	.import		_raise
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$C1,$C2,$CE,$CF,$D2,$CD,$C1,$CC,$20,$D0,$D2,$CF,$C7,$D2,$C1,$CD
+	.byte	$20,$D4,$C5,$D2,$CD,$C9,$CE,$C1,$D4,$C9,$CF,$CE,$0D,$00
+
+; ---------------------------------------------------------------
+; void __near__ abort (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_abort: near
+
+	.dbg	func, "abort", "00", static, "_abort"
+
+.segment	"CODE"
+
+	.dbg	line, "common/abort.c", 16
+	ldx     #$00
+	txa
+	jsr     _raise
+	.dbg	line, "common/abort.c", 17
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	.dbg	line, "common/abort.c", 18
+	ldx     #$00
+	lda     #$03
+	jmp     _exit
+
+	.dbg	line
+.endproc
+
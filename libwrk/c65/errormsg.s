@@ -0,0 +1,87 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"4510"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/errormsg.c", 1028, 1779181050
+	.export		__sys_errlist
+
+.segment	"RODATA"
+
+__sys_errlist:
+	.addr	S0001
+	.addr	S0002
+	.addr	S0003
+	.addr	S0004
+	.addr	S0005
+	.addr	S0006
+	.addr	S0007
+	.addr	S0008
+	.addr	S0009
+	.addr	S000A
+	.addr	S000B
+	.addr	S000C
+	.addr	S000D
+	.addr	S000E
+	.addr	S000F
+	.addr	S0010
+	.addr	S0011
+	.addr	S0012
+	.addr	S0013
+S0002:
+	.byte	$CE,$4F,$20,$53,$55,$43,$48,$20,$46,$49,$4C,$45,$20,$4F,$52,$20
+	.byte	$44,$49,$52,$45,$43,$54,$4F,$52,$59,$00
+S000E:
+	.byte	$C6,$55,$4E,$43,$54,$49,$4F,$4E,$20,$4E,$4F,$54,$20,$49,$4D,$50
+	.byte	$4C,$45,$4D,$45,$4E,$54,$45,$44,$00
+S0009:
+	.byte	$CE,$4F,$20,$53,$50,$41,$43,$45,$20,$4C,$45,$46,$54,$20,$4F,$4E
+	.byte	$20,$44,$45,$56,$49,$43,$45,$00
+S0007:
+	.byte	$C4,$45,$56,$49,$43,$45,$20,$4F,$52,$20,$52,$45,$53,$4F,$55,$52
+	.byte	$43,$45,$20,$42,$55,$53,$59,$00
+S000D:
+	.byte	$C9,$4E,$54,$45,$52,$52,$55,$50,$54,$45,$44,$20,$53,$59,$53,$54
+	.byte	$45,$4D,$20,$43,$41,$4C,$4C,$00
+S0013:
+	.byte	$D5,$4E,$4B,$4E,$4F,$57,$4E,$20,$CF,$D3,$20,$45,$52,$52,$4F,$52
+	.byte	$20,$43,$4F,$44,$45,$00
+S0006:
+	.byte	$D4,$4F,$4F,$20,$4D,$41,$4E,$59,$20,$4F,$50,$45,$4E,$20,$46,$49
+	.byte	$4C,$45,$53,$00
+S0004:
+	.byte	$D0,$45,$52,$4D,$49,$53,$53,$49,$4F,$4E,$20,$44,$45,$4E,$49,$45
+	.byte	$44,$00
+S0012:
+	.byte	$C5,$58,$45,$43,$20,$46,$4F,$52,$4D,$41,$54,$20,$45,$52,$52,$4F
+	.byte	$52,$00
+S0008:
+	.byte	$C9,$4E,$56,$41,$4C,$49,$44,$20,$41,$52,$47,$55,$4D,$45,$4E,$54
+	.byte	$00
+S0011:
+	.byte	$C2,$41,$44,$20,$46,$49,$4C,$45,$20,$4E,$55,$4D,$42,$45,$52,$00
+S0005:
+	.byte	$CE,$4F,$20,$53,$55,$43,$48,$20,$44,$45,$56,$49,$43,$45,$00
+S0003:
+	.byte	$CF,$55,$54,$20,$4F,$46,$20,$4D,$45,$4D,$4F,$52,$59,$00
+S0001:
+	.byte	$D5,$4E,$4B,$4E,$4F,$57,$4E,$20,$45,$52,$52,$4F,$52,$00
+S000F:
+	.byte	$C9,$4C,$4C,$45,$47,$41,$4C,$20,$53,$45,$45,$4B,$00
+S000A:
+	.byte	$C6,$49,$4C,$45,$20,$45,$58,$49,$53,$54,$53,$00
+S0010:
+	.byte	$D2,$41,$4E,$47,$45,$20,$45,$52,$52,$4F,$52,$00
+S000C:
+	.byte	$C9,$2F,$CF,$20,$45,$52,$52,$4F,$52,$00
+S000B:
+	.byte	$D4,$52,$59,$20,$41,$47,$41,$49,$4E,$00
+
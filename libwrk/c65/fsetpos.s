@@ -0,0 +1,50 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"4510"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/fsetpos.c", 432, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.export		_fsetpos
+	.import		_fseek
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fsetpos (struct _FILE *f, const unsigned long *pos)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fsetpos: near
+
+	.dbg	func, "fsetpos", "00", static, "_fsetpos"
+	.dbg	sym, "f", "00", auto, 2
+	.dbg	sym, "pos", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/fsetpos.c", 20
+	jsr     pushax
+	.dbg	line, "common/fsetpos.c", 21
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     pusheax
+	ldx     #$00
+	lda     #$02
+	jsr     _fseek
+	.dbg	line, "common/fsetpos.c", 22
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
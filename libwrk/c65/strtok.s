@@ -0,0 +1,158 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"4510"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/strtok.c", 1607, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.import		_strchr
+	.export		_strtok
+
+.segment	"DATA"
+
+_Last:
+	.word	$0000
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ strtok (register char *s1, const char *s2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strtok: near
+
+	.dbg	func, "strtok", "00", static, "_strtok"
+	.dbg	sym, "s1", "00", register, "regbank", 4
+	.dbg	sym, "s2", "00", auto, 0
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "start", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "common/strtok.c", 31
+	jsr     pushax
+	ldy     #$02
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "common/strtok.c", 36
+	jsr     decsp3
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0002
+	.dbg	line, "common/strtok.c", 37
+	lda     _Last+1
+	sta     regbank+4+1
+	lda     _Last
+	sta     regbank+4
+	.dbg	line, "common/strtok.c", 41
+L0002:	ldy     #$00
+	lda     (regbank+4),y
+	bne     L001B
+	.dbg	line, "common/strtok.c", 42
+	tax
+	jmp     L0001
+	.dbg	line, "common/strtok.c", 49
+L0005:	inc     regbank+4
+	bne     L000C
+	inc     regbank+4+1
+	.dbg	line, "common/strtok.c", 48
+L000C:	ldy     #$00
+L001B:	lda     (regbank+4),y
+	ldy     #$02
+	sta     (c_sp),y
+	tax
+	beq     L0021
+	ldy     #$06
+	jsr     pushwysp
+	ldy     #$04
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _strchr
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+	bne     L0005
+	.dbg	line, "common/strtok.c", 51
+	ldy     #$02
+L0021:	lda     (c_sp),y
+	bne     L000D
+	.dbg	line, "common/strtok.c", 53
+	lda     regbank+4+1
+	sta     _Last+1
+	lda     regbank+4
+	sta     _Last
+	.dbg	line, "common/strtok.c", 54
+	txa
+	jmp     L0001
+	.dbg	line, "common/strtok.c", 58
+L000D:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     stax0sp
+	.dbg	line, "common/strtok.c", 61
+	jmp     L0010
+	.dbg	line, "common/strtok.c", 62
+L000E:	inc     regbank+4
+	bne     L0010
+	inc     regbank+4+1
+	.dbg	line, "common/strtok.c", 61
+L0010:	ldy     #$00
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (c_sp),y
+	tax
+	beq     L0022
+	ldy     #$06
+	jsr     pushwysp
+	ldy     #$04
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _strchr
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+	beq     L000E
+	.dbg	line, "common/strtok.c", 64
+L0019:	ldy     #$02
+L0022:	lda     (c_sp),y
+	bne     L0016
+	.dbg	line, "common/strtok.c", 66
+	lda     regbank+4+1
+	sta     _Last+1
+	lda     regbank+4
+	sta     _Last
+	.dbg	line, "common/strtok.c", 67
+	jmp     L0017
+	.dbg	line, "common/strtok.c", 68
+L0016:	lda     #$00
+	tay
+	sta     (regbank+4),y
+	.dbg	line, "common/strtok.c", 69
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax1
+	sta     _Last
+	stx     _Last+1
+	.dbg	line, "common/strtok.c", 73
+L0017:	jsr     ldax0sp
+	.dbg	line, "common/strtok.c", 74
+L0001:	pha
+	ldy     #$05
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp7
+
+	.dbg	line
+.endproc
+
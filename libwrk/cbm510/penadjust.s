@@ -0,0 +1,148 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cbm/penadjust.c", 1372, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "/root/repo/include/pen.h", 3700, 1779181050
+	.dbg		sym, "pen_adjuster", "00", extern, "_pen_adjuster"
+	.import		_open
+	.import		_close
+	.import		_write
+	.import		_read
+	.import		_pen_adjuster
+	.import		_pen_calibrate
+	.export		_pen_adjust
+
+.segment	"BSS"
+
+_name:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ pen_adjust (const char *filename)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pen_adjust: near
+
+	.dbg	func, "pen_adjust", "00", static, "_pen_adjust"
+	.dbg	sym, "filename", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/penadjust.c", 47
+	jsr     pushax
+	.dbg	line, "cbm/penadjust.c", 48
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	beq     L0002
+	jsr     ldptr10sp
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L0002
+	.dbg	line, "cbm/penadjust.c", 49
+	jsr     ldax0sp
+	sta     _name
+	stx     _name+1
+	.dbg	line, "cbm/penadjust.c", 50
+	lda     #>(_adjuster)
+	sta     _pen_adjuster+1
+	lda     #<(_adjuster)
+	.dbg	line, "cbm/penadjust.c", 51
+	jmp     L0008
+	.dbg	line, "cbm/penadjust.c", 52
+L0002:	lda     #>(_pen_calibrate)
+	sta     _pen_adjuster+1
+	lda     #<(_pen_calibrate)
+L0008:	sta     _pen_adjuster
+	.dbg	line, "cbm/penadjust.c", 54
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ adjuster (unsigned char *XOffset)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_adjuster: near
+
+	.dbg	func, "adjuster", "00", static, "_adjuster"
+	.dbg	sym, "XOffset", "00", auto, 0
+	.dbg	sym, "fd", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cbm/penadjust.c", 23
+	jsr     pushax
+	.dbg	line, "cbm/penadjust.c", 24
+	lda     _name
+	ldx     _name+1
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	jsr     pushax
+	.dbg	line, "cbm/penadjust.c", 26
+	jsr     ldax0sp
+	cpx     #$80
+	bcc     L0002
+	.dbg	line, "cbm/penadjust.c", 27
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _pen_calibrate
+	.dbg	line, "cbm/penadjust.c", 28
+	lda     _name
+	ldx     _name+1
+	jsr     pushax
+	lda     #$92
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	jsr     stax0sp
+	.dbg	line, "cbm/penadjust.c", 29
+	txa
+	bmi     L0004
+	.dbg	line, "cbm/penadjust.c", 30
+	jsr     pushw0sp
+	ldy     #$07
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$01
+	jsr     _write
+	.dbg	line, "cbm/penadjust.c", 33
+	jmp     L0007
+	.dbg	line, "cbm/penadjust.c", 34
+L0002:	jsr     pushw0sp
+	ldy     #$07
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$01
+	jsr     _read
+	.dbg	line, "cbm/penadjust.c", 35
+L0007:	jsr     ldax0sp
+	jsr     _close
+	.dbg	line, "cbm/penadjust.c", 37
+L0004:	jmp     incsp4
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,78 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/fdopen.c", 799, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "common/_file.h", 786, 1779181050
+	.export		_fdopen
+	.import		___seterrno
+	.import		__fdesc
+
+; ---------------------------------------------------------------
+; struct _FILE *__near__ __fastcall__ fdopen (int handle, const char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fdopen: near
+
+	.dbg	func, "fdopen", "00", static, "_fdopen"
+	.dbg	sym, "handle", "00", auto, 2
+	.dbg	sym, "$anon-param-0001", "00", auto, 0
+	.dbg	sym, "f", "00", register, "regbank", 4
+
+.segment	"CODE"
+
+	.dbg	line, "common/fdopen.c", 23
+	jsr     pushax
+	.dbg	line, "common/fdopen.c", 24
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "common/fdopen.c", 27
+	jsr     __fdesc
+	sta     regbank+4
+	stx     regbank+4+1
+	ora     regbank+4+1
+	beq     L0002
+	.dbg	line, "common/fdopen.c", 29
+	ldy     #$04
+	lda     (c_sp),y
+	sta     (regbank+4)
+	.dbg	line, "common/fdopen.c", 30
+	lda     #$01
+	tay
+	sta     (regbank+4),y
+	.dbg	line, "common/fdopen.c", 31
+	bra     L0003
+	.dbg	line, "common/fdopen.c", 33
+L0002:	lda     #$05
+	jsr     ___seterrno
+	.dbg	line, "common/fdopen.c", 37
+L0003:	lda     regbank+4
+	ldx     regbank+4+1
+	.dbg	line, "common/fdopen.c", 38
+	pha
+	lda     (c_sp)
+	sta     regbank+4
+	ldy     #$01
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
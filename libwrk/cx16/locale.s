@@ -0,0 +1,119 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/locale.c", 1884, 1779181050
+	.dbg		file, "/root/repo/include/locale.h", 3637, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.export		_localeconv
+	.export		_setlocale
+
+.segment	"DATA"
+
+_EmptyString:
+	.byte	$00
+_lc:
+	.addr	_EmptyString
+	.addr	S0002
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.addr	_EmptyString
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+	.byte	$FF
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$2E,$00
+S0003:
+	.byte	$C3,$00
+
+; ---------------------------------------------------------------
+; struct lconv *__near__ localeconv (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_localeconv: near
+
+	.dbg	func, "localeconv", "00", static, "_localeconv"
+
+.segment	"CODE"
+
+	.dbg	line, "common/locale.c", 54
+	lda     #<(_lc)
+	ldx     #>(_lc)
+	.dbg	line, "common/locale.c", 55
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ setlocale (int, const char *locale)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_setlocale: near
+
+	.dbg	func, "setlocale", "00", static, "_setlocale"
+	.dbg	sym, "$anon-param-0001", "00", auto, 2
+	.dbg	sym, "locale", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/locale.c", 60
+	jsr     pushax
+	.dbg	line, "common/locale.c", 61
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	beq     L000F
+	jsr     ldptr10sp
+	lda     (ptr1)
+	cmp     #$C3
+	bne     L000B
+	jsr     ldax0sp
+	ina
+	bne     L0006
+	inx
+L0006:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	beq     L000F
+L000B:	jsr     ldptr10sp
+	lda     (ptr1)
+	beq     L000F
+	ldx     #$00
+	txa
+	jmp     incsp4
+	.dbg	line, "common/locale.c", 63
+L000F:	lda     #<(S0003)
+	ldx     #>(S0003)
+	.dbg	line, "common/locale.c", 68
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
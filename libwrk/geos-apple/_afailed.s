@@ -0,0 +1,145 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/common/_afailed.c", 649, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.import		_exit
+	.import		_ExitTurbo
+	.import		_SetPattern
+	.import		_Rectangle
+	.import		_FrameRectangle
+	.import		_PutString
+	.import		_PutDecimal
+	.import		_DlgBoxOk
+	.export		___afailed
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$50,$52,$4F,$47,$52,$41,$4D,$20,$54,$45,$52,$4D,$49,$4E,$41,$54
+	.byte	$45,$44,$1B,$00
+S0005:
+	.byte	$18,$41,$53,$53,$45,$52,$54,$49,$4F,$4E,$20,$46,$41,$49,$4C,$45
+	.byte	$44,$00
+S0003:
+	.byte	$18,$20,$20,$6C,$69,$6E,$65,$3A,$20,$00
+S0001:
+	.byte	$18,$66,$69,$6C,$65,$3A,$20,$00
+
+; ---------------------------------------------------------------
+; void __near__ __afailed (char *file, unsigned int line)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	___afailed: near
+
+	.dbg	func, "__afailed", "00", static, "___afailed"
+	.dbg	sym, "file", "00", auto, 2
+	.dbg	sym, "line", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/common/_afailed.c", 12
+	jsr     pushax
+	.dbg	line, "geos-common/common/_afailed.c", 13
+	jsr     _ExitTurbo
+	.dbg	line, "geos-common/common/_afailed.c", 15
+	stz     $0004
+	.dbg	line, "geos-common/common/_afailed.c", 16
+	stz     $0006
+	stz     $0006+1
+	.dbg	line, "geos-common/common/_afailed.c", 17
+	lda     #$0F
+	sta     $0005
+	.dbg	line, "geos-common/common/_afailed.c", 18
+	lda     #$96
+	sta     $0008
+	stz     $0008+1
+	.dbg	line, "geos-common/common/_afailed.c", 19
+	lda     #$C0
+	sta     $021D
+	.dbg	line, "geos-common/common/_afailed.c", 20
+	lda     #$00
+	jsr     _SetPattern
+	.dbg	line, "geos-common/common/_afailed.c", 21
+	jsr     _Rectangle
+	.dbg	line, "geos-common/common/_afailed.c", 22
+	lda     #$FF
+	jsr     _FrameRectangle
+	.dbg	line, "geos-common/common/_afailed.c", 24
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha
+	ldx     #$00
+	jsr     _PutString
+	.dbg	line, "geos-common/common/_afailed.c", 25
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$0A
+	jsr     pusha
+	lda     $0016
+	ldx     $0016+1
+	jsr     _PutString
+	.dbg	line, "geos-common/common/_afailed.c", 26
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha
+	lda     $0016
+	ldx     $0016+1
+	jsr     _PutString
+	.dbg	line, "geos-common/common/_afailed.c", 27
+	lda     #$00
+	jsr     pusha
+	ldy     #$04
+	jsr     pushwysp
+	lda     #$0A
+	jsr     pusha
+	lda     $0016
+	ldx     $0016+1
+	jsr     _PutDecimal
+	.dbg	line, "geos-common/common/_afailed.c", 29
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _DlgBoxOk
+	.dbg	line, "geos-common/common/_afailed.c", 31
+	ldx     #$00
+	lda     #$02
+	jsr     _exit
+	.dbg	line, "geos-common/common/_afailed.c", 32
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
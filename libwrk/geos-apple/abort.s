@@ -0,0 +1,70 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/common/abort.c", 234, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.export		_abort
+	.import		_exit
+	.import		_ExitTurbo
+	.import		_DlgBoxOk
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$18,$41,$42,$4E,$4F,$52,$4D,$41,$4C,$20,$50,$52,$4F,$47,$52,$41
+	.byte	$4D,$00
+S0003:
+	.byte	$54,$45,$52,$4D,$49,$4E,$41,$54,$49,$4F,$4E,$2E,$1B,$00
+
+; ---------------------------------------------------------------
+; void __near__ abort (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_abort: near
+
+	.dbg	func, "abort", "00", static, "_abort"
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/common/abort.c", 12
+	jsr     _ExitTurbo
+	.dbg	line, "geos-common/common/abort.c", 13
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _DlgBoxOk
+	.dbg	line, "geos-common/common/abort.c", 14
+	ldx     #$00
+	lda     #$03
+	jmp     _exit
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,130 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/system/gettime.c", 707, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.export		_clock
+	.import		_mktime
+	.export		_clock_gettime
+
+; ---------------------------------------------------------------
+; unsigned long __near__ clock (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock: near
+
+	.dbg	func, "clock", "00", static, "_clock"
+	.dbg	sym, "currentTime", "00", auto, -18
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/system/gettime.c", 14
+	ldy     #$12
+	jsr     subysp
+	ldx     #$00
+	lda     $F205
+	jsr     stax0sp
+	.dbg	line, "geos-common/system/gettime.c", 15
+	lda     $F204
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 16
+	lda     $F203
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 17
+	lda     $F202
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 18
+	lda     $F201
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 19
+	lda     $F200
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 20
+	lda     $F200
+	cmp     #$57
+	bcs     L0002
+	.dbg	line, "geos-common/system/gettime.c", 21
+	ldy     #$0A
+	lda     #$64
+	jsr     addeqysp
+	.dbg	line, "geos-common/system/gettime.c", 23
+L0002:	ldx     #$FF
+	txa
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "geos-common/system/gettime.c", 25
+	lda     c_sp
+	ldx     c_sp+1
+	jsr     _mktime
+	.dbg	line, "geos-common/system/gettime.c", 26
+	ldy     #$12
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ clock_gettime (unsigned char, struct timespec *tp)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_gettime: near
+
+	.dbg	func, "clock_gettime", "00", static, "_clock_gettime"
+	.dbg	sym, "$anon-param-0003", "00", auto, 2
+	.dbg	sym, "tp", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/system/gettime.c", 29
+	jsr     pushax
+	.dbg	line, "geos-common/system/gettime.c", 30
+	jsr     pushw0sp
+	jsr     _clock
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "geos-common/system/gettime.c", 31
+	jsr     pushw0sp
+	lda     #$00
+	stz     sreg+1
+	stz     sreg
+	tax
+	ldy     #$04
+	jsr     steaxspidx
+	.dbg	line, "geos-common/system/gettime.c", 34
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
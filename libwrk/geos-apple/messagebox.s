@@ -0,0 +1,249 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/dlgbox/messagebox.c", 1781, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.import		_PutString
+	.import		_UseSystemFont
+	.import		_DoDlgBox
+	.import		_RstrFrmDialogue
+	.export		_MessageBox
+	.import		_vsprintf
+	.export		__mbprintout
+
+.segment	"RODATA"
+
+__mbdlg_EMPTY:
+	.byte	$81
+	.byte	$11
+	.addr	_RstrFrmDialogue
+	.byte	$13
+	.addr	__mbprintout
+	.byte	$00
+__mbdlg_OK:
+	.byte	$81
+	.byte	$13
+	.addr	__mbprintout
+	.byte	$01
+	.byte	$09
+	.byte	$48
+	.byte	$00
+__mbdlg_OKCANCEL:
+	.byte	$81
+	.byte	$13
+	.addr	__mbprintout
+	.byte	$01
+	.byte	$01
+	.byte	$48
+	.byte	$02
+	.byte	$11
+	.byte	$48
+	.byte	$00
+__mbdlg_YESNO:
+	.byte	$81
+	.byte	$13
+	.addr	__mbprintout
+	.byte	$03
+	.byte	$01
+	.byte	$48
+	.byte	$04
+	.byte	$11
+	.byte	$48
+	.byte	$00
+__mbboxes:
+	.addr	__mbdlg_EMPTY
+	.addr	__mbdlg_OK
+	.addr	__mbdlg_OKCANCEL
+	.addr	__mbdlg_YESNO
+
+.segment	"BSS"
+
+__mbbuffer:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; char __near__ MessageBox (char mode, const char *format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_MessageBox: near
+
+	.dbg	func, "MessageBox", "00", static, "_MessageBox"
+	.dbg	sym, "mode", "00", auto, 3
+	.dbg	sym, "format", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "buf", "00", register, "regbank", 4
+	.dbg	sym, "ap", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 54
+	jsr     enter
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 55
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 59
+	jsr     decsp2
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax2
+	jsr     stax0sp
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 60
+	lda     #<(__mbbuffer)
+	ldx     #>(__mbbuffer)
+	jsr     pushax
+	ldy     #$06
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 64
+	lda     #>(__mbbuffer)
+	sta     regbank+4+1
+	lda     #<(__mbbuffer)
+	sta     regbank+4
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 65
+	bra     L0004
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 66
+L000B:	lda     (regbank+4),y
+	cmp     #$0A
+	bne     L0005
+	lda     #$0D
+	sta     (regbank+4),y
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 67
+L0005:	inc     regbank+4
+	bne     L0004
+	inc     regbank+4+1
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 65
+L0004:	ldy     #$00
+	lda     (regbank+4)
+	bne     L000B
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 71
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$04
+	bcc     L0007
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 72
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 74
+L0007:	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax4
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	asl     a
+	bcc     L0009
+	inx
+	clc
+L0009:	adc     #<(__mbboxes)
+	tay
+	txa
+	adc     #>(__mbboxes)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _DoDlgBox
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 75
+	pha
+	ldy     #$02
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     leavey
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ _mbprintout (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__mbprintout: near
+
+	.dbg	func, "_mbprintout", "00", static, "__mbprintout"
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 79
+	jsr     _UseSystemFont
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 80
+	lda     #$20
+	sta     $021E
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 81
+	lda     #$4A
+	sta     $0220
+	stz     $0220+1
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 82
+	lda     #$F5
+	sta     $0222
+	stz     $0222+1
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 83
+	lda     #$7F
+	sta     $021F
+	.dbg	line, "geos-common/dlgbox/messagebox.c", 84
+	lda     #<(__mbbuffer)
+	ldx     #>(__mbbuffer)
+	jsr     pushax
+	ldx     #$00
+	lda     $021A
+	ldy     #$2A
+	jsr     incaxy
+	jsr     pusha
+	ldx     #$00
+	lda     #$4A
+	jmp     _PutString
+
+	.dbg	line
+.endproc
+
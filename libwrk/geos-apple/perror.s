@@ -0,0 +1,93 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/common/perror.c", 354, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.export		_perror
+	.import		_strerror
+	.import		___errno
+	.import		_ExitTurbo
+	.import		_DlgBoxOk
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ perror (const char *msg)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_perror: near
+
+	.dbg	func, "perror", "00", static, "_perror"
+	.dbg	sym, "msg", "00", auto, 0
+	.dbg	sym, "errmsg", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/common/perror.c", 13
+	jsr     pushax
+	.dbg	line, "geos-common/common/perror.c", 14
+	lda     ___errno
+	ldx     ___errno+1
+	jsr     _strerror
+	jsr     pushax
+	.dbg	line, "geos-common/common/perror.c", 16
+	jsr     _ExitTurbo
+	.dbg	line, "geos-common/common/perror.c", 17
+	ldy     #$03
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+	iny
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	beq     L0002
+	.dbg	line, "geos-common/common/perror.c", 18
+	ldy     #$03
+	jsr     ldaxysp
+	.dbg	line, "geos-common/common/perror.c", 19
+	bra     L000B
+	.dbg	line, "geos-common/common/perror.c", 20
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+L000B:	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DlgBoxOk
+	.dbg	line, "geos-common/common/perror.c", 22
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
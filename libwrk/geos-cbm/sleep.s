@@ -0,0 +1,76 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "geos-common/common/sleep.c", 278, 1779181050
+	.dbg		file, "/root/repo/include/geos.h", 3127, 1779181050
+	.dbg		file, "/root/repo/include/geos/gconst.h", 1493, 1779181050
+	.dbg		file, "/root/repo/include/geos/gstruct.h", 5199, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsym.h", 12804, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdisk.h", 2287, 1779181050
+	.dbg		file, "/root/repo/include/geos/gfile.h", 2118, 1779181050
+	.dbg		file, "/root/repo/include/geos/gprocess.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/geos/ggraph.h", 5463, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmenu.h", 1221, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsprite.h", 2353, 1779181050
+	.dbg		file, "/root/repo/include/geos/gmemory.h", 1099, 1779181050
+	.dbg		file, "/root/repo/include/geos/gsys.h", 1300, 1779181050
+	.dbg		file, "/root/repo/include/geos/gdlgbox.h", 3490, 1779181050
+	.import		_Sleep
+	.import		_get_tv
+	.export		_sleep
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ sleep (unsigned int wait)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sleep: near
+
+	.dbg	func, "sleep", "00", static, "_sleep"
+	.dbg	sym, "wait", "00", auto, 0
+	.dbg	sym, "typ", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "geos-common/common/sleep.c", 11
+	jsr     pushax
+	.dbg	line, "geos-common/common/sleep.c", 14
+	jsr     decsp1
+	jsr     _get_tv
+	and     #$80
+	beq     L0005
+	.dbg	line, "geos-common/common/sleep.c", 15
+	lda     #$3C
+	.dbg	line, "geos-common/common/sleep.c", 16
+	jmp     L0006
+	.dbg	line, "geos-common/common/sleep.c", 17
+L0005:	lda     #$32
+L0006:	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "geos-common/common/sleep.c", 20
+	ldy     #$04
+	jsr     pushwysp
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     tosumula0
+	jsr     _Sleep
+	.dbg	line, "geos-common/common/sleep.c", 22
+	ldx     #$00
+	txa
+	.dbg	line, "geos-common/common/sleep.c", 23
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,63 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65SC02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/fgetpos.c", 455, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.export		_fgetpos
+	.import		_ftell
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fgetpos (struct _FILE *f, unsigned long *pos)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fgetpos: near
+
+	.dbg	func, "fgetpos", "00", static, "_fgetpos"
+	.dbg	sym, "f", "00", auto, 2
+	.dbg	sym, "pos", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/fgetpos.c", 20
+	jsr     pushax
+	.dbg	line, "common/fgetpos.c", 21
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ftell
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "common/fgetpos.c", 23
+	jsr     ldax0sp
+	jsr     ldeaxi
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0002
+	.dbg	line, "common/fgetpos.c", 24
+	ldx     #$00
+	bra     L0003
+	.dbg	line, "common/fgetpos.c", 25
+L0002:	ldx     #$FF
+L0003:	txa
+	.dbg	line, "common/fgetpos.c", 26
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
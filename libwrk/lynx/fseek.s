@@ -0,0 +1,115 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65SC02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/fseek.c", 1416, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.dbg		file, "common/_file.h", 786, 1779181050
+	.export		_fseek
+	.import		___seterrno
+	.import		_lseek
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fseek (register struct _FILE *f, long offset, int whence)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fseek: near
+
+	.dbg	func, "fseek", "00", static, "_fseek"
+	.dbg	sym, "f", "00", register, "regbank", 4
+	.dbg	sym, "offset", "00", auto, 2
+	.dbg	sym, "whence", "00", auto, 0
+	.dbg	sym, "res", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "common/fseek.c", 24
+	jsr     pushax
+	ldy     #$06
+	ldx     #$04
+	jsr     regswap2
+	.dbg	line, "common/fseek.c", 28
+	jsr     decsp4
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L000D
+	.dbg	line, "common/fseek.c", 29
+	lda     #$07
+	jsr     ___seterrno
+	.dbg	line, "common/fseek.c", 30
+	bra     L0011
+	.dbg	line, "common/fseek.c", 36
+L000D:	lda     (regbank+4),y
+	and     #$08
+	beq     L0004
+	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0004
+	.dbg	line, "common/fseek.c", 37
+	stz     sreg+1
+	stz     sreg
+	ina
+	ldx     #$00
+	iny
+	jsr     lsubeqysp
+	.dbg	line, "common/fseek.c", 41
+L0004:	lda     (regbank+4)
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _lseek
+	jsr     steax0sp
+	.dbg	line, "common/fseek.c", 49
+	jsr     ldeax0sp
+	lda     sreg+1
+	bmi     L0009
+	.dbg	line, "common/fseek.c", 50
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$F5
+	sta     (regbank+4),y
+	.dbg	line, "common/fseek.c", 51
+	ldx     #$00
+	bra     L0012
+	.dbg	line, "common/fseek.c", 53
+L0009:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	.dbg	line, "common/fseek.c", 54
+L0011:	ldx     #$FF
+L0012:	txa
+	.dbg	line, "common/fseek.c", 56
+	pha
+	ldy     #$0A
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,50 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"65SC02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "common/system.c", 316, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.export		_system
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ system (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_system: near
+
+	.dbg	func, "system", "00", static, "_system"
+	.dbg	sym, "s", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/system.c", 12
+	jsr     pushax
+	.dbg	line, "common/system.c", 13
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	bne     L0002
+	.dbg	line, "common/system.c", 14
+	tax
+	jmp     incsp2
+	.dbg	line, "common/system.c", 16
+L0002:	ldx     #$FF
+	txa
+	.dbg	line, "common/system.c", 18
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,75 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"45GS02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/freopen.c", 960, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "common/_file.h", 786, 1779181050
+	.export		_freopen
+	.import		_close
+	.import		___seterrno
+	.import		__fopen
+
+; ---------------------------------------------------------------
+; struct _FILE *__near__ __fastcall__ freopen (const char *name, const char *mode, struct _FILE *f)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_freopen: near
+
+	.dbg	func, "freopen", "00", static, "_freopen"
+	.dbg	sym, "name", "00", auto, 4
+	.dbg	sym, "mode", "00", auto, 2
+	.dbg	sym, "f", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/freopen.c", 23
+	jsr     pushax
+	.dbg	line, "common/freopen.c", 25
+	jsr     ldptr10sp
+	ldy     #$01
+	lda     (ptr1),y
+	and     #$01
+	bne     L0005
+	.dbg	line, "common/freopen.c", 27
+	lda     #$07
+	jsr     ___seterrno
+	jmp     incsp6
+	.dbg	line, "common/freopen.c", 33
+L0005:	jsr     ldptr10sp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _close
+	cpx     #$80
+	bcc     L0004
+	.dbg	line, "common/freopen.c", 35
+	ldx     #$00
+	txa
+	jmp     incsp6
+	.dbg	line, "common/freopen.c", 39
+L0004:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     __fopen
+	.dbg	line, "common/freopen.c", 40
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
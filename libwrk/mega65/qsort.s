@@ -0,0 +1,387 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"45GS02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/qsort.c", 1493, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.export		_qsort
+	.import		___swap
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ qsort (void *base, unsigned int nmemb, unsigned int size, int (__fastcall__ *compare)(const void *, const void *))
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_qsort: near
+
+	.dbg	func, "qsort", "00", static, "_qsort"
+	.dbg	sym, "base", "00", auto, 6
+	.dbg	sym, "nmemb", "00", auto, 4
+	.dbg	sym, "size", "00", auto, 2
+	.dbg	sym, "compare", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/qsort.c", 58
+	jsr     pushax
+	.dbg	line, "common/qsort.c", 59
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bcc     L0002
+	.dbg	line, "common/qsort.c", 60
+	ldy     #$09
+	jsr     pushwysp
+	jsr     push0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _QuickSort
+	.dbg	line, "common/qsort.c", 62
+L0002:	jmp     incsp8
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ QuickSort (register unsigned char *Base, int Lo, int Hi, register unsigned int Size, int (__fastcall__ *Compare)(const void *, const void *))
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_QuickSort: near
+
+	.dbg	func, "QuickSort", "00", static, "_QuickSort"
+	.dbg	sym, "Base", "00", register, "regbank", 4
+	.dbg	sym, "Lo", "00", auto, 6
+	.dbg	sym, "Hi", "00", auto, 4
+	.dbg	sym, "Size", "00", register, "regbank", 2
+	.dbg	sym, "Compare", "00", auto, 0
+	.dbg	sym, "I", "00", auto, -2
+	.dbg	sym, "J", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "common/qsort.c", 20
+	jsr     pushax
+	ldy     #$08
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$02
+	ldx     #$02
+	jsr     regswap2
+	.dbg	line, "common/qsort.c", 24
+	jsr     decsp4
+	jmp     L0017
+	.dbg	line, "common/qsort.c", 25
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "common/qsort.c", 26
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     stax0sp
+	.dbg	line, "common/qsort.c", 27
+	jmp     L0014
+	.dbg	line, "common/qsort.c", 29
+L0008:	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$02
+	jsr     addeqysp
+	.dbg	line, "common/qsort.c", 28
+L000A:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L001C
+	bpl     L0010
+L001C:	ldy     #$07
+	jsr     pushwysp
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	pha
+	ldy     #$02
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	txa
+	bpl     L0008
+	jmp     L0010
+	.dbg	line, "common/qsort.c", 32
+L000E:	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     subeq0sp
+	.dbg	line, "common/qsort.c", 31
+L0010:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L001D
+	bpl     L001A
+L001D:	ldy     #$07
+	jsr     pushwysp
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	pha
+	ldy     #$02
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	cpx     #$80
+	bcs     L000E
+	.dbg	line, "common/qsort.c", 34
+L001A:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L001E
+	bpl     L0014
+	.dbg	line, "common/qsort.c", 35
+L001E:	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     ___swap
+	.dbg	line, "common/qsort.c", 36
+	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$02
+	jsr     addeqysp
+	.dbg	line, "common/qsort.c", 37
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     subeq0sp
+	.dbg	line, "common/qsort.c", 27
+L0014:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	jmi     L000A
+	jeq     L000A
+	.dbg	line, "common/qsort.c", 40
+	jsr     ldax0sp
+	ldy     #$0A
+	cmp     (c_sp),y
+	bne     L0021
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L0015
+	.dbg	line, "common/qsort.c", 41
+L0021:	jsr     ldax0sp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     ___swap
+	.dbg	line, "common/qsort.c", 43
+L0015:	jsr     ldax0sp
+	jsr     shlax1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	clc
+	ldy     #$0A
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L0016
+	beq     L0016
+	.dbg	line, "common/qsort.c", 44
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _QuickSort
+	.dbg	line, "common/qsort.c", 45
+	jsr     ldax0sp
+	sec
+	sbc     regbank+2
+	pha
+	txa
+	sbc     regbank+2+1
+	tax
+	pla
+	ldy     #$08
+	.dbg	line, "common/qsort.c", 46
+	jmp     L001B
+	.dbg	line, "common/qsort.c", 47
+L0016:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	sec
+	sbc     regbank+2
+	pha
+	txa
+	sbc     regbank+2+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _QuickSort
+	.dbg	line, "common/qsort.c", 48
+	jsr     ldax0sp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	ldy     #$0A
+L001B:	jsr     staxysp
+	.dbg	line, "common/qsort.c", 24
+L0017:	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L001F
+	jpl     L0002
+	.dbg	line, "common/qsort.c", 51
+L001F:	ldy     #$0C
+	lda     (c_sp),y
+	sta     regbank+4
+	iny
+	lda     (c_sp),y
+	sta     regbank+5
+	ldy     #$06
+	lda     (c_sp),y
+	sta     regbank+2
+	iny
+	lda     (c_sp),y
+	sta     regbank+3
+	ldy     #$0E
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
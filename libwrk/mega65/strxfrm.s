@@ -0,0 +1,54 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"45GS02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "common/strxfrm.c", 221, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.import		_strlen
+	.import		_strncpy
+	.export		_strxfrm
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ strxfrm (char *dest, const char *src, unsigned int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strxfrm: near
+
+	.dbg	func, "strxfrm", "00", static, "_strxfrm"
+	.dbg	sym, "dest", "00", auto, 4
+	.dbg	sym, "src", "00", auto, 2
+	.dbg	sym, "count", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "common/strxfrm.c", 14
+	jsr     pushax
+	.dbg	line, "common/strxfrm.c", 15
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strncpy
+	.dbg	line, "common/strxfrm.c", 16
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _strlen
+	.dbg	line, "common/strxfrm.c", 17
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
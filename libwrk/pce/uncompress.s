@@ -0,0 +1,177 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"HUC6280"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "zlib/uncompress.c", 1257, 1779181050
+	.dbg		file, "/root/repo/include/zlib.h", 7112, 1779181050
+	.import		_inflatemem
+	.export		_uncompress
+	.import		_adler32
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ uncompress (unsigned char *dest, unsigned int *destLen, const unsigned char *source, unsigned int sourceLen)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_uncompress: near
+
+	.dbg	func, "uncompress", "00", static, "_uncompress"
+	.dbg	sym, "dest", "00", auto, 6
+	.dbg	sym, "destLen", "00", auto, 4
+	.dbg	sym, "source", "00", auto, 2
+	.dbg	sym, "sourceLen", "00", auto, 0
+	.dbg	sym, "len", "00", auto, -2
+	.dbg	sym, "ptr", "00", auto, -4
+	.dbg	sym, "csum", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "zlib/uncompress.c", 11
+	jsr     pushax
+	.dbg	line, "zlib/uncompress.c", 13
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     decax4
+	jsr     pushax
+	.dbg	line, "zlib/uncompress.c", 23
+	jsr     decsp4
+	ldy     #$0B
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$8F
+	cmp     #$08
+	jne     L000E
+	ldy     #$0B
+	jsr     ldaxysp
+	ina
+	bne     L0005
+	inx
+L0005:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	and     #$20
+	.dbg	line, "zlib/uncompress.c", 24
+	jne     L000E
+	.dbg	line, "zlib/uncompress.c", 25
+	ldy     #$0B
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	sta     sreg+1
+	ldy     #$0B
+	jsr     ldaxysp
+	ina
+	bne     L0008
+	inx
+L0008:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	ldx     sreg+1
+	jsr     pushax
+	lda     #$1F
+	jsr     tosumoda0
+	stx     tmp1
+	ora     tmp1
+	.dbg	line, "zlib/uncompress.c", 26
+	jne     L000E
+	.dbg	line, "zlib/uncompress.c", 27
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     _inflatemem
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "zlib/uncompress.c", 28
+	jsr     pushl0
+	jsr     push0
+	jsr     _adler32
+	jsr     pusheax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _adler32
+	jsr     steax0sp
+	.dbg	line, "zlib/uncompress.c", 29
+	lda     (c_sp)
+	sta     sreg
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax3
+	.dbg	line, "zlib/uncompress.c", 30
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     sreg
+	bne     L000E
+	jsr     ldeax0sp
+	stx     sreg
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	.dbg	line, "zlib/uncompress.c", 31
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     sreg
+	bne     L000E
+	jsr     ldeax0sp
+	lda     sreg
+	sta     ptr2
+	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L000B
+	inx
+	.dbg	line, "zlib/uncompress.c", 32
+L000B:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     ptr2
+	bne     L000E
+	jsr     ldeax0sp
+	lda     sreg+1
+	sta     ptr2
+	ldy     #$05
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	cmp     ptr2
+	bne     L000E
+	ldx     #$00
+	txa
+	bra     L0001
+	.dbg	line, "zlib/uncompress.c", 33
+L000E:	ldx     #$FF
+	lda     #$FD
+	.dbg	line, "zlib/uncompress.c", 35
+L0001:	ldy     #$10
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,137 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/_localtime.c", 690, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.dbg		file, "/root/repo/include/stdbool.h", 2506, 1779181050
+	.dbg		sym, "_tz", "00", extern, "__tz"
+	.import		_ria_set_axsreg
+	.import		_ria_call_int
+	.import		_ria_call_long
+	.export		_tzset
+	.import		__tz
+	.import		__time_t_to_tm
+	.export		__localtime
+
+.segment	"DATA"
+
+_tzset_set:
+	.byte	$00
+
+; ---------------------------------------------------------------
+; void __near__ tzset (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tzset: near
+
+	.dbg	func, "tzset", "00", static, "_tzset"
+	.dbg	sym, "ax", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/_localtime.c", 23
+	lda     #$0D
+	jsr     _ria_call_int
+	jsr     pushax
+	.dbg	line, "rp6502/_localtime.c", 24
+	jsr     ldax0sp
+	txa
+	bmi     L0002
+	.dbg	line, "rp6502/_localtime.c", 26
+	jsr     decsp1
+	lda     #$00
+L0008:	sta     (c_sp)
+	cmp     #$0F
+	bcs     L0009
+	.dbg	line, "rp6502/_localtime.c", 27
+	lda     (c_sp)
+	tay
+	lda     $FFEC
+	sta     __tz,y
+	.dbg	line, "rp6502/_localtime.c", 26
+	clc
+	lda     #$01
+	adc     (c_sp)
+	bra     L0008
+	.dbg	line, "rp6502/_localtime.c", 29
+L0009:	lda     #$01
+	sta     _tzset_set
+	.dbg	line, "rp6502/_localtime.c", 30
+	jsr     incsp1
+	.dbg	line, "rp6502/_localtime.c", 31
+L0002:	jmp     incsp2
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; struct tm *__near__ __fastcall__ _localtime (const unsigned long *timep)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__localtime: near
+
+	.dbg	func, "_localtime", "00", static, "__localtime"
+	.dbg	sym, "timep", "00", auto, 0
+	.dbg	sym, "tm", "00", auto, -2
+	.dbg	sym, "time", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/_localtime.c", 10
+	jsr     pushax
+	.dbg	line, "rp6502/_localtime.c", 12
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     pusheax
+	.dbg	line, "rp6502/_localtime.c", 13
+	jsr     ldeax0sp
+	jsr     _ria_set_axsreg
+	.dbg	line, "rp6502/_localtime.c", 14
+	lda     #$0E
+	jsr     _ria_call_long
+	jsr     laddeq0sp
+	.dbg	line, "rp6502/_localtime.c", 15
+	jsr     ldeax0sp
+	jsr     __time_t_to_tm
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "rp6502/_localtime.c", 16
+	sta     ptr1
+	stx     ptr1+1
+	lda     $FFEC
+	ldy     #$10
+	sta     (ptr1),y
+	iny
+	lda     #$00
+	sta     (ptr1),y
+	.dbg	line, "rp6502/_localtime.c", 17
+	lda     _tzset_set
+	bne     L0002
+	jsr     _tzset
+	.dbg	line, "rp6502/_localtime.c", 18
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	.dbg	line, "rp6502/_localtime.c", 19
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
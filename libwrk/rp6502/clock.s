@@ -0,0 +1,39 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/clock.c", 118, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.import		_ria_call_long
+	.export		_clock
+
+; ---------------------------------------------------------------
+; unsigned long __near__ clock (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock: near
+
+	.dbg	func, "clock", "00", static, "_clock"
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/clock.c", 6
+	lda     #$0F
+	jmp     _ria_call_long
+
+	.dbg	line
+.endproc
+
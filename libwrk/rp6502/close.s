@@ -0,0 +1,48 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/close.c", 137, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/fcntl.h", 3550, 1779181050
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_close
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ close (int fd)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_close: near
+
+	.dbg	func, "close", "00", static, "_close"
+	.dbg	sym, "fd", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/close.c", 5
+	jsr     pushax
+	.dbg	line, "rp6502/close.c", 6
+	jsr     ldax0sp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/close.c", 7
+	lda     #$15
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/close.c", 8
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
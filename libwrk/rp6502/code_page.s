@@ -0,0 +1,47 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/code_page.c", 126, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_code_page
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ code_page (int cp)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_code_page: near
+
+	.dbg	func, "code_page", "00", static, "_code_page"
+	.dbg	sym, "cp", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/code_page.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/code_page.c", 5
+	jsr     ldax0sp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/code_page.c", 6
+	lda     #$03
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/code_page.c", 7
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
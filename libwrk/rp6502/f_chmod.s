@@ -0,0 +1,95 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_chmod.c", 428, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_call_int
+	.export		_f_chmod
+	.import		___errno
+	.import		_strlen
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_chmod (const char *path, unsigned char attr, unsigned char mask)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_chmod: near
+
+	.dbg	func, "f_chmod", "00", static, "_f_chmod"
+	.dbg	sym, "path", "00", auto, 2
+	.dbg	sym, "attr", "00", auto, 1
+	.dbg	sym, "mask", "00", auto, 0
+	.dbg	sym, "pathlen", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_chmod.c", 6
+	jsr     pusha
+	.dbg	line, "rp6502/f_chmod.c", 8
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	sta     $FFF4
+	.dbg	line, "rp6502/f_chmod.c", 9
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     stax0sp
+	.dbg	line, "rp6502/f_chmod.c", 10
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/f_chmod.c", 11
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_chmod.c", 12
+	ldx     #$FF
+	txa
+	jmp     incsp6
+	.dbg	line, "rp6502/f_chmod.c", 15
+L0003:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/f_chmod.c", 14
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/f_chmod.c", 17
+	ldy     #$03
+	lda     (c_sp),y
+	sta     $FFEC
+	.dbg	line, "rp6502/f_chmod.c", 18
+	lda     #$26
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/f_chmod.c", 19
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,104 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_getcwd.c", 357, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_call_int
+	.export		_f_getcwd
+	.import		___errno
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_getcwd (char *name, int size)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_getcwd: near
+
+	.dbg	func, "f_getcwd", "00", static, "_f_getcwd"
+	.dbg	sym, "name", "00", auto, 2
+	.dbg	sym, "size", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "ax", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_getcwd.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/f_getcwd.c", 8
+	jsr     decsp4
+	lda     #$2B
+	jsr     _ria_call_int
+	jsr     stax0sp
+	.dbg	line, "rp6502/f_getcwd.c", 9
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosicmp
+	bmi     L0002
+	beq     L0002
+	.dbg	line, "rp6502/f_getcwd.c", 10
+	stz     $FFEF
+	.dbg	line, "rp6502/f_getcwd.c", 11
+	lda     #$02
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_getcwd.c", 12
+	ldx     #$FF
+	txa
+	jmp     incsp8
+	.dbg	line, "rp6502/f_getcwd.c", 14
+L0002:	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0003:	ldy     #$03
+	jsr     ldaxysp
+	cmp     (c_sp)
+	txa
+	ldy     #$01
+	sbc     (c_sp),y
+	bvc     L0007
+	eor     #$80
+L0007:	bpl     L0008
+	.dbg	line, "rp6502/f_getcwd.c", 15
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     $FFEC
+	sta     (ptr1)
+	.dbg	line, "rp6502/f_getcwd.c", 14
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0003
+	.dbg	line, "rp6502/f_getcwd.c", 17
+L0008:	jsr     ldax0sp
+	.dbg	line, "rp6502/f_getcwd.c", 18
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,111 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_getfree.c", 491, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_pop_long
+	.import		_ria_call_int
+	.export		_f_getfree
+	.import		___errno
+	.import		_strlen
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_getfree (const char *name, unsigned long *free, unsigned long *total)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_getfree: near
+
+	.dbg	func, "f_getfree", "00", static, "_f_getfree"
+	.dbg	sym, "name", "00", auto, 4
+	.dbg	sym, "free", "00", auto, 2
+	.dbg	sym, "total", "00", auto, 0
+	.dbg	sym, "ax", "00", auto, -2
+	.dbg	sym, "namelen", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_getfree.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/f_getfree.c", 8
+	jsr     decsp2
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     pushax
+	.dbg	line, "rp6502/f_getfree.c", 9
+	jsr     ldax0sp
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/f_getfree.c", 10
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_getfree.c", 11
+	ldx     #$FF
+	txa
+	bra     L0001
+	.dbg	line, "rp6502/f_getfree.c", 14
+L0003:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/f_getfree.c", 13
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/f_getfree.c", 16
+	lda     #$2E
+	jsr     _ria_call_int
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "rp6502/f_getfree.c", 17
+	txa
+	bmi     L0006
+	.dbg	line, "rp6502/f_getfree.c", 18
+	ldy     #$09
+	jsr     pushwysp
+	jsr     _ria_pop_long
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "rp6502/f_getfree.c", 19
+	ldy     #$07
+	jsr     pushwysp
+	jsr     _ria_pop_long
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "rp6502/f_getfree.c", 21
+L0006:	ldy     #$03
+	jsr     ldaxysp
+	.dbg	line, "rp6502/f_getfree.c", 22
+L0001:	ldy     #$0A
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,128 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_getlabel.c", 447, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_call_int
+	.export		_f_getlabel
+	.import		___errno
+	.import		_strlen
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_getlabel (const char *path, char *label)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_getlabel: near
+
+	.dbg	func, "f_getlabel", "00", static, "_f_getlabel"
+	.dbg	sym, "path", "00", auto, 2
+	.dbg	sym, "label", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "ax", "00", auto, -4
+	.dbg	sym, "pathlen", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_getlabel.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/f_getlabel.c", 8
+	jsr     decsp4
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     pushax
+	.dbg	line, "rp6502/f_getlabel.c", 9
+	jsr     ldax0sp
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/f_getlabel.c", 10
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_getlabel.c", 11
+	ldx     #$FF
+	txa
+	bra     L0001
+	.dbg	line, "rp6502/f_getlabel.c", 14
+L0003:	ldx     #$00
+	tya
+	jsr     subeq0sp
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/f_getlabel.c", 13
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/f_getlabel.c", 16
+	lda     #$2D
+	jsr     _ria_call_int
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "rp6502/f_getlabel.c", 17
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+L0006:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvc     L000A
+	eor     #$80
+L000A:	bpl     L000B
+	.dbg	line, "rp6502/f_getlabel.c", 18
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     $FFEC
+	sta     (ptr1)
+	.dbg	line, "rp6502/f_getlabel.c", 17
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0006
+	.dbg	line, "rp6502/f_getlabel.c", 20
+L000B:	jsr     ldaxysp
+	.dbg	line, "rp6502/f_getlabel.c", 21
+L0001:	ldy     #$0A
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,58 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_lseek.c", 211, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_push_long
+	.import		_ria_set_ax
+	.import		_ria_call_long
+	.export		_f_lseek
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ f_lseek (long offset, int whence, int fildes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_lseek: near
+
+	.dbg	func, "f_lseek", "00", static, "_f_lseek"
+	.dbg	sym, "offset", "00", auto, 4
+	.dbg	sym, "whence", "00", auto, 2
+	.dbg	sym, "fildes", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_lseek.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/f_lseek.c", 5
+	jsr     ldax0sp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/f_lseek.c", 6
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     _ria_push_long
+	.dbg	line, "rp6502/f_lseek.c", 7
+	ldy     #$02
+	lda     (c_sp),y
+	sta     $FFEC
+	.dbg	line, "rp6502/f_lseek.c", 8
+	lda     #$1A
+	jsr     _ria_call_long
+	.dbg	line, "rp6502/f_lseek.c", 9
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
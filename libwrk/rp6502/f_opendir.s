@@ -0,0 +1,84 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_opendir.c", 331, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_call_int
+	.export		_f_opendir
+	.import		___errno
+	.import		_strlen
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_opendir (const char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_opendir: near
+
+	.dbg	func, "f_opendir", "00", static, "_f_opendir"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "namelen", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_opendir.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/f_opendir.c", 7
+	jsr     ldax0sp
+	jsr     _strlen
+	jsr     pushax
+	.dbg	line, "rp6502/f_opendir.c", 8
+	jsr     ldax0sp
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/f_opendir.c", 9
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_opendir.c", 10
+	ldx     #$FF
+	txa
+	jmp     incsp4
+	.dbg	line, "rp6502/f_opendir.c", 13
+L0003:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/f_opendir.c", 12
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/f_opendir.c", 15
+	lda     #$20
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/f_opendir.c", 16
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
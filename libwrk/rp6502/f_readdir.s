@@ -0,0 +1,87 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_readdir.c", 276, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_f_readdir
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_readdir (struct $anon-struct-0001 *dirent, int dirdes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_readdir: near
+
+	.dbg	func, "f_readdir", "00", static, "_f_readdir"
+	.dbg	sym, "dirent", "00", auto, 2
+	.dbg	sym, "dirdes", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "ax", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_readdir.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/f_readdir.c", 6
+	jsr     decsp4
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/f_readdir.c", 7
+	lda     #$21
+	jsr     _ria_call_int
+	jsr     stax0sp
+	.dbg	line, "rp6502/f_readdir.c", 8
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$01
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$1A
+L0006:	bcs     L0003
+	.dbg	line, "rp6502/f_readdir.c", 9
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     $FFEC
+	sta     (ptr1)
+	.dbg	line, "rp6502/f_readdir.c", 8
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+	.dbg	line, "rp6502/f_readdir.c", 11
+L0003:	jsr     ldax0sp
+	.dbg	line, "rp6502/f_readdir.c", 12
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
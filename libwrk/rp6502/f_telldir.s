@@ -0,0 +1,47 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_telldir.c", 134, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_set_ax
+	.import		_ria_call_long
+	.export		_f_telldir
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ f_telldir (int dirdes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_telldir: near
+
+	.dbg	func, "f_telldir", "00", static, "_f_telldir"
+	.dbg	sym, "dirdes", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_telldir.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/f_telldir.c", 5
+	jsr     ldax0sp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/f_telldir.c", 6
+	lda     #$23
+	jsr     _ria_call_long
+	.dbg	line, "rp6502/f_telldir.c", 7
+	jmp     incsp2
+
+	.dbg	line
+.endproc
+
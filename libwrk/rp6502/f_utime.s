@@ -0,0 +1,108 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/f_utime.c", 510, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_push_int
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_f_utime
+	.import		___errno
+	.import		_strlen
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ f_utime (const char *path, unsigned int fdate, unsigned int ftime, unsigned int crdate, unsigned int crtime)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f_utime: near
+
+	.dbg	func, "f_utime", "00", static, "_f_utime"
+	.dbg	sym, "path", "00", auto, 8
+	.dbg	sym, "fdate", "00", auto, 6
+	.dbg	sym, "ftime", "00", auto, 4
+	.dbg	sym, "crdate", "00", auto, 2
+	.dbg	sym, "crtime", "00", auto, 0
+	.dbg	sym, "pathlen", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/f_utime.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/f_utime.c", 8
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/f_utime.c", 9
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     stax0sp
+	.dbg	line, "rp6502/f_utime.c", 10
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/f_utime.c", 11
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/f_utime.c", 12
+	ldx     #$FF
+	txa
+	bra     L0001
+	.dbg	line, "rp6502/f_utime.c", 15
+L0003:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$0A
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/f_utime.c", 14
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/f_utime.c", 17
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/f_utime.c", 18
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/f_utime.c", 19
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/f_utime.c", 20
+	lda     #$27
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/f_utime.c", 21
+L0001:	ldy     #$0C
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,52 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/gettime.c", 262, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.import		_ria_set_ax
+	.export		_clock_gettime
+	.import		___clock_gettimespec
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ clock_gettime (unsigned char clock_id, struct timespec *tp)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_gettime: near
+
+	.dbg	func, "clock_gettime", "00", static, "_clock_gettime"
+	.dbg	sym, "clock_id", "00", auto, 2
+	.dbg	sym, "tp", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/gettime.c", 7
+	jsr     pushax
+	.dbg	line, "rp6502/gettime.c", 8
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/gettime.c", 9
+	jsr     pushw0sp
+	lda     #$11
+	jsr     ___clock_gettimespec
+	.dbg	line, "rp6502/gettime.c", 10
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,66 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/gettimespec.c", 320, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.import		_ria_pop_long
+	.import		_ria_call_int
+	.export		___clock_gettimespec
+
+; ---------------------------------------------------------------
+; int __near__ __clock_gettimespec (struct timespec *ts, unsigned char op)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	___clock_gettimespec: near
+
+	.dbg	func, "__clock_gettimespec", "00", static, "___clock_gettimespec"
+	.dbg	sym, "ts", "00", auto, 1
+	.dbg	sym, "op", "00", auto, 0
+	.dbg	sym, "ax", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/gettimespec.c", 6
+	jsr     pusha
+	.dbg	line, "rp6502/gettimespec.c", 7
+	lda     (c_sp)
+	jsr     _ria_call_int
+	jsr     pushax
+	.dbg	line, "rp6502/gettimespec.c", 8
+	jsr     ldax0sp
+	txa
+	bmi     L0002
+	.dbg	line, "rp6502/gettimespec.c", 9
+	ldy     #$06
+	jsr     pushwysp
+	jsr     _ria_pop_long
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "rp6502/gettimespec.c", 10
+	ldy     #$06
+	jsr     pushwysp
+	jsr     _ria_pop_long
+	ldy     #$04
+	jsr     steaxspidx
+	.dbg	line, "rp6502/gettimespec.c", 12
+L0002:	jsr     ldax0sp
+	.dbg	line, "rp6502/gettimespec.c", 13
+	jmp     incsp5
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,38 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/lrand.c", 97, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_call_long
+	.export		_lrand
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ lrand (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lrand: near
+
+	.dbg	func, "lrand", "00", static, "_lrand"
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/lrand.c", 5
+	lda     #$04
+	jmp     _ria_call_long
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,59 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/lseek.c", 223, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.import		_ria_push_long
+	.import		_ria_set_ax
+	.import		_ria_call_long
+	.export		_lseek
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ lseek (int fd, long offset, int whence)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lseek: near
+
+	.dbg	func, "lseek", "00", static, "_lseek"
+	.dbg	sym, "fd", "00", auto, 6
+	.dbg	sym, "offset", "00", auto, 2
+	.dbg	sym, "whence", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/lseek.c", 5
+	jsr     pushax
+	.dbg	line, "rp6502/lseek.c", 6
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     _ria_push_long
+	.dbg	line, "rp6502/lseek.c", 7
+	lda     (c_sp)
+	sta     $FFEC
+	.dbg	line, "rp6502/lseek.c", 8
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/lseek.c", 9
+	lda     #$1A
+	jsr     _ria_call_long
+	.dbg	line, "rp6502/lseek.c", 10
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,38 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/phi2.c", 93, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_call_int
+	.export		_phi2
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ phi2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_phi2: near
+
+	.dbg	func, "phi2", "00", static, "_phi2"
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/phi2.c", 5
+	lda     #$02
+	jmp     _ria_call_int
+
+	.dbg	line
+.endproc
+
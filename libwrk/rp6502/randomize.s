@@ -0,0 +1,41 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/randomize.c", 109, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.import		_ria_call_int
+	.import		_srand
+	.export		___randomize
+
+; ---------------------------------------------------------------
+; void __near__ __randomize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	___randomize: near
+
+	.dbg	func, "__randomize", "00", static, "___randomize"
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/randomize.c", 6
+	lda     #$04
+	jsr     _ria_call_int
+	jmp     _srand
+
+	.dbg	line
+.endproc
+
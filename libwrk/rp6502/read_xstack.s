@@ -0,0 +1,95 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/read_xstack.c", 299, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_push_int
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_read_xstack
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ read_xstack (void *buf, unsigned int count, int fildes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_xstack: near
+
+	.dbg	func, "read_xstack", "00", static, "_read_xstack"
+	.dbg	sym, "buf", "00", auto, 4
+	.dbg	sym, "count", "00", auto, 2
+	.dbg	sym, "fildes", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "ax", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/read_xstack.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/read_xstack.c", 6
+	jsr     decsp4
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/read_xstack.c", 7
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/read_xstack.c", 8
+	lda     #$16
+	jsr     _ria_call_int
+	jsr     stax0sp
+	.dbg	line, "rp6502/read_xstack.c", 9
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     (c_sp)
+	txa
+	ldy     #$01
+	sbc     (c_sp),y
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0007
+	.dbg	line, "rp6502/read_xstack.c", 10
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     $FFEC
+	sta     (ptr1)
+	.dbg	line, "rp6502/read_xstack.c", 9
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+	.dbg	line, "rp6502/read_xstack.c", 12
+L0007:	jsr     ldax0sp
+	.dbg	line, "rp6502/read_xstack.c", 13
+	ldy     #$0A
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,61 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/settime.c", 249, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/time.h", 5353, 1779181050
+	.import		_ria_push_long
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_clock_settime
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ clock_settime (unsigned char clock_id, const struct timespec *tp)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_settime: near
+
+	.dbg	func, "clock_settime", "00", static, "_clock_settime"
+	.dbg	sym, "clock_id", "00", auto, 2
+	.dbg	sym, "tp", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/settime.c", 5
+	jsr     pushax
+	.dbg	line, "rp6502/settime.c", 6
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/settime.c", 7
+	jsr     ldax0sp
+	ldy     #$07
+	jsr     ldeaxidx
+	jsr     _ria_push_long
+	.dbg	line, "rp6502/settime.c", 8
+	jsr     ldax0sp
+	jsr     ldeaxi
+	jsr     _ria_push_long
+	.dbg	line, "rp6502/settime.c", 9
+	lda     #$12
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/settime.c", 10
+	jmp     incsp3
+
+	.dbg	line
+.endproc
+
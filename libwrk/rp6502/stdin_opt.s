@@ -0,0 +1,52 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/stdin_opt.c", 207, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_push_long
+	.import		_ria_call_int
+	.export		_stdin_opt
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ stdin_opt (unsigned long ctrl_bits, unsigned char str_length)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_stdin_opt: near
+
+	.dbg	func, "stdin_opt", "00", static, "_stdin_opt"
+	.dbg	sym, "ctrl_bits", "00", auto, 1
+	.dbg	sym, "str_length", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/stdin_opt.c", 4
+	jsr     pusha
+	.dbg	line, "rp6502/stdin_opt.c", 5
+	ldy     #$04
+	jsr     ldeaxysp
+	jsr     _ria_push_long
+	.dbg	line, "rp6502/stdin_opt.c", 6
+	lda     (c_sp)
+	sta     $FFF4
+	.dbg	line, "rp6502/stdin_opt.c", 7
+	lda     #$05
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/stdin_opt.c", 8
+	jmp     incsp5
+
+	.dbg	line
+.endproc
+
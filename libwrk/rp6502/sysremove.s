@@ -0,0 +1,83 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/sysremove.c", 349, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.import		_ria_call_int
+	.import		_strlen
+	.export		__sysremove
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _sysremove (const char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__sysremove: near
+
+	.dbg	func, "_sysremove", "00", static, "__sysremove"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "namelen", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/sysremove.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/sysremove.c", 8
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     stax0sp
+	.dbg	line, "rp6502/sysremove.c", 9
+	cpx     #$00
+	beq     L0005
+	.dbg	line, "rp6502/sysremove.c", 10
+	lda     #$07
+	sta     $FFED
+	stz     $FFED+1
+	.dbg	line, "rp6502/sysremove.c", 11
+	ldx     #$FF
+	txa
+	jmp     incsp4
+	.dbg	line, "rp6502/sysremove.c", 14
+L0003:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/sysremove.c", 13
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0003
+	.dbg	line, "rp6502/sysremove.c", 16
+	lda     #$1B
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/sysremove.c", 17
+	jmp     incsp4
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,127 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/sysrename.c", 550, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_call_int
+	.import		___errno
+	.import		_strlen
+	.export		__sysrename
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _sysrename (const char *oldpath, const char *newpath)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__sysrename: near
+
+	.dbg	func, "_sysrename", "00", static, "__sysrename"
+	.dbg	sym, "oldpath", "00", auto, 2
+	.dbg	sym, "newpath", "00", auto, 0
+	.dbg	sym, "oldpathlen", "00", auto, -2
+	.dbg	sym, "newpathlen", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/sysrename.c", 6
+	jsr     pushax
+	.dbg	line, "rp6502/sysrename.c", 8
+	jsr     decsp4
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strlen
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "rp6502/sysrename.c", 9
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     stax0sp
+	.dbg	line, "rp6502/sysrename.c", 10
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	cmp     #$FF
+	txa
+	sbc     #$01
+	bcc     L000A
+	.dbg	line, "rp6502/sysrename.c", 11
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/sysrename.c", 12
+	ldx     #$FF
+	txa
+	jmp     incsp8
+	.dbg	line, "rp6502/sysrename.c", 15
+L0003:	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     subeqysp
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/sysrename.c", 14
+	ldy     #$03
+L000A:	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	bne     L0003
+	.dbg	line, "rp6502/sysrename.c", 18
+	bra     L0009
+	.dbg	line, "rp6502/sysrename.c", 19
+L0006:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+L0009:	sta     $FFEC
+	.dbg	line, "rp6502/sysrename.c", 18
+	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	bne     L0006
+	.dbg	line, "rp6502/sysrename.c", 21
+	lda     #$1C
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/sysrename.c", 22
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,125 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/write.c", 462, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.import		_write_xstack
+	.export		_write
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ write (int fildes, const void *buf, unsigned int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write: near
+
+	.dbg	func, "write", "00", static, "_write"
+	.dbg	sym, "fildes", "00", auto, 4
+	.dbg	sym, "buf", "00", auto, 2
+	.dbg	sym, "count", "00", auto, 0
+	.dbg	sym, "ax", "00", auto, -2
+	.dbg	sym, "total", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/write.c", 5
+	jsr     pushax
+	.dbg	line, "rp6502/write.c", 6
+	jsr     decsp2
+	jsr     push0
+	.dbg	line, "rp6502/write.c", 7
+	bra     L0004
+	.dbg	line, "rp6502/write.c", 8
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$02
+	bcc     L0005
+	ldx     #$02
+	lda     #$00
+	bra     L0006
+L0005:	ldy     #$05
+	jsr     ldaxysp
+L0006:	jsr     pushax
+	.dbg	line, "rp6502/write.c", 9
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _write_xstack
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "rp6502/write.c", 10
+	cpx     #$80
+	bcc     L0007
+	.dbg	line, "rp6502/write.c", 11
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incsp2
+	bra     L0001
+	.dbg	line, "rp6502/write.c", 13
+L0007:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     addeqysp
+	.dbg	line, "rp6502/write.c", 14
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "rp6502/write.c", 15
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     (c_sp)
+	txa
+	ldy     #$01
+	sbc     (c_sp),y
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0008
+	.dbg	line, "rp6502/write.c", 16
+	jsr     incsp2
+	bra     L0003
+	.dbg	line, "rp6502/write.c", 18
+L0008:	jsr     incsp2
+	.dbg	line, "rp6502/write.c", 7
+L0004:	ldy     #$05
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	jne     L0002
+	.dbg	line, "rp6502/write.c", 19
+L0003:	jsr     ldax0sp
+	.dbg	line, "rp6502/write.c", 20
+L0001:	ldy     #$0A
+	jmp     addysp
+
+	.dbg	line
+.endproc
+
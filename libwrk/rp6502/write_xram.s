@@ -0,0 +1,58 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/write_xram.c", 216, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.import		_ria_push_int
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_write_xram
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ write_xram (unsigned int buf, unsigned int count, int fildes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_xram: near
+
+	.dbg	func, "write_xram", "00", static, "_write_xram"
+	.dbg	sym, "buf", "00", auto, 4
+	.dbg	sym, "count", "00", auto, 2
+	.dbg	sym, "fildes", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/write_xram.c", 4
+	jsr     pushax
+	.dbg	line, "rp6502/write_xram.c", 5
+	jsr     ldax0sp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/write_xram.c", 6
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/write_xram.c", 7
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _ria_push_int
+	.dbg	line, "rp6502/write_xram.c", 8
+	lda     #$19
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/write_xram.c", 9
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
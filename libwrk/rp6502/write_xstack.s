@@ -0,0 +1,94 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/write_xstack.c", 355, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		sym, "__errno", "00", extern, "___errno"
+	.import		_ria_set_ax
+	.import		_ria_call_int
+	.export		_write_xstack
+	.import		___errno
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ write_xstack (const void *buf, unsigned int count, int fildes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_xstack: near
+
+	.dbg	func, "write_xstack", "00", static, "_write_xstack"
+	.dbg	sym, "buf", "00", auto, 4
+	.dbg	sym, "count", "00", auto, 2
+	.dbg	sym, "fildes", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/write_xstack.c", 5
+	jsr     pushax
+	.dbg	line, "rp6502/write_xstack.c", 7
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$02
+	bcc     L0002
+	.dbg	line, "rp6502/write_xstack.c", 8
+	lda     #$07
+	sta     ___errno
+	stz     ___errno+1
+	.dbg	line, "rp6502/write_xstack.c", 9
+	ldx     #$FF
+	txa
+	jmp     incsp8
+	.dbg	line, "rp6502/write_xstack.c", 11
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	jsr     stax0sp
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	beq     L0004
+	.dbg	line, "rp6502/write_xstack.c", 12
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/write_xstack.c", 13
+	bra     L0003
+	.dbg	line, "rp6502/write_xstack.c", 14
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _ria_set_ax
+	.dbg	line, "rp6502/write_xstack.c", 15
+	lda     #$18
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/write_xstack.c", 16
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,119 @@
+;
+; File generated by cc65 v 2.19 - Git 5c7f1c9
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 5c7f1c9"
+	.setcpu		"W65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "rp6502/xregn.c", 449, 1779181050
+	.dbg		file, "/root/repo/include/rp6502.h", 10678, 1779181050
+	.dbg		file, "/root/repo/include/_6522.h", 3781, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.import		_ria_call_int
+	.export		_xregn
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ xregn (char device, char channel, unsigned char address, unsigned int count, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xregn: near
+
+	.dbg	func, "xregn", "00", static, "_xregn"
+	.dbg	sym, "device", "00", auto, 5
+	.dbg	sym, "channel", "00", auto, 4
+	.dbg	sym, "address", "00", auto, 3
+	.dbg	sym, "count", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "args", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "rp6502/xregn.c", 6
+	jsr     enter
+	.dbg	line, "rp6502/xregn.c", 8
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     decax2
+	jsr     stax0sp
+	.dbg	line, "rp6502/xregn.c", 9
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax2
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/xregn.c", 10
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0002
+	inx
+L0002:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/xregn.c", 11
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     $FFEC
+	.dbg	line, "rp6502/xregn.c", 12
+	bra     L0005
+	.dbg	line, "rp6502/xregn.c", 13
+L0003:	ldx     #$00
+	lda     #$02
+	jsr     subeq0sp
+	jsr     pushw
+	.dbg	line, "rp6502/xregn.c", 14
+	ldy     #$01
+	lda     (c_sp),y
+	sta     $FFEC
+	.dbg	line, "rp6502/xregn.c", 15
+	lda     (c_sp)
+	sta     $FFEC
+	.dbg	line, "rp6502/xregn.c", 16
+	jsr     incsp2
+	.dbg	line, "rp6502/xregn.c", 12
+L0005:	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     decax2
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	jsr     decax1
+	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+	lda     regsave
+	ora     regsave+1
+	bne     L0003
+	.dbg	line, "rp6502/xregn.c", 18
+	tya
+	jsr     _ria_call_int
+	.dbg	line, "rp6502/xregn.c", 19
+	ldy     #$02
+	jmp     leavey
+
+	.dbg	line
+.endproc
+
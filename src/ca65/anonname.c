@@ -49,6 +49,9 @@
 
 static const char AnonTag[] = "$anon";
 
+/* Number of anonymous names created so far */
+static unsigned ACount = 0;
+
 
 
 /*****************************************************************************/
@@ -63,7 +66,6 @@ StrBuf* AnonName (StrBuf* Buf, const char* Spec)
 ** identifier if given. A pointer to the buffer is returned.
 */
 {
-    static unsigned ACount = 0;
     SB_Printf (Buf, "%s-%s-%04X", AnonTag, Spec, ++ACount);
     return Buf;
 }
@@ -79,3 +81,11 @@ int IsAnonName (const StrBuf* Name)
     }
     return (strncmp (SB_GetConstBuf (Name), AnonTag, sizeof (AnonTag) - 1) == 0);
 }
+
+
+
+void ResetAnonNames (void)
+/* Restart the numbering of anonymous names, so another file can be assembled */
+{
+    ACount = 0;
+}
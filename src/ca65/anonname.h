@@ -58,6 +58,9 @@ StrBuf* AnonName (StrBuf* Buf, const char* Spec);
 int IsAnonName (const StrBuf* Name);
 /* Check if the given symbol name is that of an anonymous symbol */
 
+void ResetAnonNames (void);
+/* Restart the numbering of anonymous names, so another file can be assembled */
+
 
 
 /* End of anonname.h */
@@ -176,3 +176,11 @@ void WriteAssertions (void)
     /* Done writing the assertions */
     ObjEndAssertions ();
 }
+
+
+
+void ResetAssertions (void)
+/* Remove all assertions, so another file can be assembled */
+{
+    CollDeleteAll (&Assertions);
+}
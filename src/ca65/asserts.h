@@ -69,6 +69,9 @@ void CheckAssertions (void);
 void WriteAssertions (void);
 /* Write the assertion table to the object file */
 
+void ResetAssertions (void);
+/* Remove all assertions, so another file can be assembled */
+
 
 
 /* End of asserts.h */
@@ -631,3 +631,14 @@ void CleanupIfStack (unsigned SP)
     /* Calculate the new overall .IF condition */
     CalcOverallIfCond ();
 }
+
+
+
+void ResetConditionals (void)
+/* Drop the .IF stack left over from a file with errors, so another file can
+** be assembled.
+*/
+{
+    IfCount = 0;
+    IfCond  = 1;
+}
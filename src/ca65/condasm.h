@@ -75,6 +75,11 @@ unsigned GetIfStack (void);
 void CleanupIfStack (unsigned SP);
 /* Cleanup the .IF stack, remove anything above the given stack pointer */
 
+void ResetConditionals (void);
+/* Drop the .IF stack left over from a file with errors, so another file can
+** be assembled.
+*/
+
 
 
 /* End of condasm.h */
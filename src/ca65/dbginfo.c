@@ -39,6 +39,7 @@
 #include "chartype.h"
 #include "coll.h"
 #include "filepos.h"
+#include "hashfunc.h"
 #include "hlldbgsym.h"
 #include "scopedefs.h"
 #include "strbuf.h"
@@ -461,7 +462,8 @@ void DbgInfoCheck (void)
         CHECK (S->Sym == 0 && S->Scope != 0);
 
         /* Search for the symbol name */
-        S->Sym = SymFindAny (S->Scope, GetStrBuf (S->AsmName));
+        S->Sym = SymFindAny (S->Scope, GetStrBuf (S->AsmName),
+                             HashStr (GetString (S->AsmName)));
         if (S->Sym == 0) {
             PError (&S->Pos, "Assembler symbol `%s' not found",
                     GetString (S->AsmName));
@@ -522,3 +524,14 @@ void WriteHLLDbgSyms (void)
 
     }
 }
+
+
+
+void ResetDbgInfo (void)
+/* Remove all high level language debug symbols, so another file can be
+** assembled.
+*/
+{
+    CurLineInfo = 0;
+    CollDeleteAll (&HLLDbgSyms);
+}
@@ -62,6 +62,11 @@ void DbgInfoCheck (void);
 void WriteHLLDbgSyms (void);
 /* Write a list of all high level language symbols to the object file. */
 
+void ResetDbgInfo (void);
+/* Remove all high level language debug symbols, so another file can be
+** assembled.
+*/
+
 
 
 /* End of dbginfo.h */
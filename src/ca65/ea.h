@@ -45,6 +45,8 @@
 
 /* EffAddr Flags */
 #define EFFADDR_OVERRIDE_ZP     0x00000001UL
+#define EFFADDR_RELAX_ZP        0x00000002UL    /* Zero page may be used */
+#define EFFADDR_RELAX_JMP       0x00000004UL    /* JMP may become BRA */
 
 
 
@@ -61,6 +63,7 @@ struct EffAddr {
     unsigned            AddrMode;       /* Actual addressing mode used */
     unsigned long       AddrModeBit;    /* Addressing mode as bit mask */
     unsigned char       Opcode;         /* Opcode */
+    unsigned char       ZPOpcode;       /* Opcode if EFFADDR_RELAX_ZP is set */
 };
 
 
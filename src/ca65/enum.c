@@ -105,7 +105,7 @@ void DoEnum (void)
         }
 
         /* We have an identifier, generate a symbol */
-        Sym = SymFind (CurrentScope, &CurTok.SVal, SYM_ALLOC_NEW);
+        Sym = SymFind (CurrentScope, &CurTok.SVal, CurTok.Hash, SYM_ALLOC_NEW);
 
         /* Skip the member name */
         NextTok ();
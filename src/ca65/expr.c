@@ -57,6 +57,7 @@
 #include "instr.h"
 #include "nexttok.h"
 #include "objfile.h"
+#include "relax.h"
 #include "segment.h"
 #include "sizeof.h"
 #include "studyexpr.h"
@@ -765,6 +766,7 @@ static ExprNode* FuncAddrSize (void)
 {
     StrBuf    ScopeName = STATIC_STRBUF_INITIALIZER;
     StrBuf    Name = STATIC_STRBUF_INITIALIZER;
+    unsigned  Hash;
     SymEntry* Sym;
     int       AddrSize;
     int       NoScope;
@@ -777,7 +779,8 @@ static ExprNode* FuncAddrSize (void)
     if (CurTok.Tok == TOK_LOCAL_IDENT) {
 
         /* Cheap local symbol */
-        Sym = SymFindLocal (SymLast, &CurTok.SVal, SYM_FIND_EXISTING);
+        Sym = SymFindLocal (SymLast, &CurTok.SVal, CurTok.Hash,
+                            SYM_FIND_EXISTING);
         if (Sym == 0) {
             Error ("Unknown symbol or scope: `%m%p'", &CurTok.SVal);
         } else {
@@ -792,7 +795,7 @@ static ExprNode* FuncAddrSize (void)
     } else {
 
         /* Parse the scope and the name */
-        SymTable* ParentScope = ParseScopedIdent (&Name, &ScopeName);
+        SymTable* ParentScope = ParseScopedIdent (&Name, &Hash, &ScopeName);
 
         /* Check if the parent scope is valid */
         if (ParentScope == 0) {
@@ -811,9 +814,9 @@ static ExprNode* FuncAddrSize (void)
         ** size, otherwise search for a symbol entry with the name and scope.
         */
         if (NoScope) {
-            Sym = SymFindAny (ParentScope, &Name);
+            Sym = SymFindAny (ParentScope, &Name, Hash);
         } else {
-            Sym = SymFind (ParentScope, &Name, SYM_FIND_EXISTING);
+            Sym = SymFind (ParentScope, &Name, Hash, SYM_FIND_EXISTING);
         }
         /* If we found the symbol retrieve the size, otherwise complain */
         if (Sym) {
@@ -844,6 +847,7 @@ static ExprNode* FuncSizeOf (void)
 {
     StrBuf    ScopeName = STATIC_STRBUF_INITIALIZER;
     StrBuf    Name = STATIC_STRBUF_INITIALIZER;
+    unsigned  Hash;
     SymTable* Scope;
     SymEntry* Sym;
     SymEntry* SizeSym;
@@ -858,7 +862,8 @@ static ExprNode* FuncSizeOf (void)
     if (CurTok.Tok == TOK_LOCAL_IDENT) {
 
         /* Cheap local symbol */
-        Sym = SymFindLocal (SymLast, &CurTok.SVal, SYM_FIND_EXISTING);
+        Sym = SymFindLocal (SymLast, &CurTok.SVal, CurTok.Hash,
+                            SYM_FIND_EXISTING);
         if (Sym == 0) {
             Error ("Unknown symbol or scope: `%m%p'", &CurTok.SVal);
         } else {
@@ -873,7 +878,7 @@ static ExprNode* FuncSizeOf (void)
     } else {
 
         /* Parse the scope and the name */
-        SymTable* ParentScope = ParseScopedIdent (&Name, &ScopeName);
+        SymTable* ParentScope = ParseScopedIdent (&Name, &Hash, &ScopeName);
 
         /* Check if the parent scope is valid */
         if (ParentScope == 0) {
@@ -903,9 +908,9 @@ static ExprNode* FuncSizeOf (void)
             SizeSym = GetSizeOfScope (Scope);
         } else {
             if (NoScope) {
-                Sym = SymFindAny (ParentScope, &Name);
+                Sym = SymFindAny (ParentScope, &Name, Hash);
             } else {
-                Sym = SymFind (ParentScope, &Name, SYM_FIND_EXISTING);
+                Sym = SymFind (ParentScope, &Name, Hash, SYM_FIND_EXISTING);
             }
 
             /* If we found the symbol retrieve the size, otherwise complain */
@@ -918,7 +923,16 @@ static ExprNode* FuncSizeOf (void)
         }
     }
 
-    /* Check if we have a size */
+    /* Check if we have a size. The size of code containing relaxed
+    ** instructions is known only at the end of assembly, so use a
+    ** reference to the size symbol in this case.
+    */
+    if (SizeSym != 0 && SymIsDef (SizeSym) && RelaxCode &&
+        !SymIsConst (SizeSym, &Size)) {
+        SB_Done (&ScopeName);
+        SB_Done (&Name);
+        return GenSymExpr (SizeSym);
+    }
     if (SizeSym == 0 || !SymIsConst (SizeSym, &Size)) {
         Error ("Size of `%m%p%m%p' is unknown", &ScopeName, &Name);
         Size = 0;
@@ -1806,11 +1820,18 @@ ExprNode* GenCurrentPC (void)
 /* Return the current program counter as expression */
 {
     ExprNode* Root;
+    int       Mark;
 
     if (GetRelocMode ()) {
         /* Create SegmentBase + Offset */
         Root = GenAddExpr (GenSectionExpr (GetCurrentSegNum ()),
                            GenLiteralExpr (GetPC ()));
+
+        /* Add the size changes of preceeding relaxed instructions */
+        Mark = GetRelaxMark ();
+        if (Mark >= 0) {
+            Root = GenAddExpr (Root, GenRelaxExpr (Mark));
+        }
     } else {
         /* Absolute mode, just return PC value */
         Root = GenLiteralExpr (GetPC ());
@@ -1836,12 +1857,21 @@ ExprNode* GenBranchExpr (unsigned Offs)
 ** offset and the target expression (that is, Expression() - (*+Offs) ).
 */
 {
-    ExprNode* N;
+    return GenPCRelExpr (Expression (), Offs);
+}
+
+
+
+ExprNode* GenPCRelExpr (ExprNode* N, unsigned Offs)
+/* Return an expression that encodes the difference between current PC plus
+** offset and the given target expression (that is, N - (*+Offs) ).
+*/
+{
     ExprNode* Root;
     long      Val;
 
-    /* Read Expression() */
-    N = Expression ();
+    /* Size changes of preceeding relaxed instructions move the PC */
+    int Mark = GetRelaxMark ();
 
     /* If the expression is a cheap constant, generate a simpler tree */
     if (IsEasyConst (N, &Val)) {
@@ -1856,6 +1886,12 @@ ExprNode* GenBranchExpr (unsigned Offs)
         ** (Val - PC - Offs) - Seg
         */
         Root = GenLiteralExpr (Val - GetPC () - Offs);
+        if (Mark >= 0) {
+            N = Root;
+            Root = NewExprNode (EXPR_MINUS);
+            Root->Left  = N;
+            Root->Right = GenRelaxExpr (Mark);
+        }
         if (GetRelocMode ()) {
             N = Root;
             Root = NewExprNode (EXPR_MINUS);
@@ -1874,6 +1910,9 @@ ExprNode* GenBranchExpr (unsigned Offs)
         Root = NewExprNode (EXPR_MINUS);
         Root->Left  = N;
         Root->Right = GenLiteralExpr (GetPC () + Offs);
+        if (Mark >= 0) {
+            Root->Right = GenAddExpr (Root->Right, GenRelaxExpr (Mark));
+        }
         if (GetRelocMode ()) {
             N = Root;
             Root = NewExprNode (EXPR_MINUS);
@@ -1900,6 +1939,45 @@ ExprNode* GenULabelExpr (unsigned Num)
 
 
 
+ExprNode* GenRelaxExpr (unsigned Mark)
+/* Return an expression for the size changes of relaxed instructions up to
+** the given mark.
+*/
+{
+    ExprNode* Node = NewExprNode (EXPR_RELAX);
+    Node->V.IVal        = Mark;
+
+    /* Return the new node */
+    return Node;
+}
+
+
+
+ExprNode* GenRelaxedSizeExpr (unsigned long Size, int StartMark, int EndMark)
+/* Return an expression for the size of a range of data in one segment. Size
+** is the size when the data was assembled, StartMark and EndMark are the
+** relaxation marks (see GetRelaxMark) at the start and end of the range.
+*/
+{
+    ExprNode* Root = GenLiteralExpr (Size);
+
+    /* Marks increase within a segment */
+    if (EndMark > StartMark) {
+        Root = GenAddExpr (Root, GenRelaxExpr (EndMark));
+        if (StartMark >= 0) {
+            ExprNode* N = Root;
+            Root = NewExprNode (EXPR_MINUS);
+            Root->Left  = N;
+            Root->Right = GenRelaxExpr (StartMark);
+        }
+    }
+
+    /* Return the result */
+    return Root;
+}
+
+
+
 ExprNode* GenByteExpr (ExprNode* Expr)
 /* Force the given expression into a byte and return the result */
 {
@@ -2040,6 +2118,10 @@ ExprNode* CloneExpr (ExprNode* Expr)
             Clone = GenULabelExpr (Expr->V.IVal);
             break;
 
+        case EXPR_RELAX:
+            Clone = GenRelaxExpr (Expr->V.IVal);
+            break;
+
         case EXPR_SYMBOL:
             Clone = GenSymExpr (Expr->V.Sym);
             break;
@@ -2067,9 +2149,135 @@ ExprNode* CloneExpr (ExprNode* Expr)
 
 
 
+static int WrittenSizeExceeds (ExprNode* Expr, unsigned* Size)
+/* Count the nodes of an expression as they are written to the object file,
+** where symbols and unnamed labels are replaced by their values. Return true
+** as soon as more than Size nodes were found.
+*/
+{
+    if (Expr == 0) {
+        return 0;
+    }
+    if (Expr->Op == EXPR_SYMBOL && !SymIsImport (Expr->V.Sym)) {
+        return WrittenSizeExceeds (GetSymExpr (Expr->V.Sym), Size);
+    }
+    if (Expr->Op == EXPR_ULABEL) {
+        return WrittenSizeExceeds (ULabResolve (Expr->V.IVal), Size);
+    }
+    if (*Size == 0) {
+        return 1;
+    }
+    --*Size;
+    if (EXPR_NODETYPE (Expr->Op) == EXPR_LEAFNODE) {
+        return 0;
+    }
+    return WrittenSizeExceeds (Expr->Left, Size) ||
+           WrittenSizeExceeds (Expr->Right, Size);
+}
+
+
+
+static unsigned NodeCount (const ExprNode* Expr)
+/* Return the number of nodes in an expression tree */
+{
+    if (Expr == 0) {
+        return 0;
+    } else if (EXPR_NODETYPE (Expr->Op) == EXPR_LEAFNODE) {
+        return 1;
+    } else {
+        return 1 + NodeCount (Expr->Left) + NodeCount (Expr->Right);
+    }
+}
+
+
+
+static ExprNode* AddTerm (ExprNode* Sum, ExprNode* Term, long Count)
+/* Add Count times Term to Sum, which may be NULL */
+{
+    ExprNode* Root;
+
+    if (Count == -1 && Sum != 0) {
+        Root = NewExprNode (EXPR_MINUS);
+        Root->Left  = Sum;
+        Root->Right = Term;
+        return Root;
+    }
+    if (Count != 1) {
+        Root = NewExprNode (EXPR_MUL);
+        Root->Left  = GenLiteralExpr (Count);
+        Root->Right = Term;
+        Term = Root;
+    }
+    return (Sum == 0)? Term : GenAddExpr (Sum, Term);
+}
+
+
+
+ExprNode* FlattenExpr (ExprNode* Expr, const ExprDesc* D)
+/* D is the result of studying Expr after assembly. If D is valid, Expr is the
+** sum of D's section, import and relax mark references plus its value. Marks
+** of instructions relaxed by the linker are written with the size changes
+** known to the assembler, so these are taken from the value. If this sum is
+** smaller than Expr with all symbols replaced by their values, return the
+** sum and free Expr. Otherwise return Expr. Symbols defined relative to each
+** other in long chains would otherwise be written to the object file again
+** for each use.
+*/
+{
+    ExprNode* Sum = 0;
+    long      Val = D->Val;
+    long      Delta;
+    unsigned  Size;
+    unsigned  I;
+
+    /* Only expressions without errors can be replaced */
+    if (D->Flags != ED_OK) {
+        return Expr;
+    }
+
+    /* Build the sum */
+    for (I = 0; I < D->SymCount; ++I) {
+        if (D->SymRef[I].Count != 0) {
+            Sum = AddTerm (Sum, GenSymExpr (D->SymRef[I].Ref), D->SymRef[I].Count);
+        }
+    }
+    for (I = 0; I < D->SecCount; ++I) {
+        if (D->SecRef[I].Count != 0) {
+            Sum = AddTerm (Sum, GenSectionExpr (D->SecRef[I].Ref), D->SecRef[I].Count);
+        }
+    }
+    for (I = 0; I < D->RelaxCount; ++I) {
+        if (D->RelaxRef[I].Count != 0) {
+            GetRelaxDelta (D->RelaxRef[I].Ref, &Delta);
+            Sum = AddTerm (Sum, GenRelaxExpr (D->RelaxRef[I].Ref), D->RelaxRef[I].Count);
+            Val -= D->RelaxRef[I].Count * Delta;
+        }
+    }
+    if (Sum == 0) {
+        Sum = GenLiteralExpr (Val);
+    } else if (Val != 0) {
+        Sum = GenAddExpr (Sum, GenLiteralExpr (Val));
+    }
+
+    /* Use the smaller one */
+    Size = NodeCount (Sum);
+    if (WrittenSizeExceeds (Expr, &Size)) {
+        FreeExpr (Expr);
+        return Sum;
+    } else {
+        FreeExpr (Sum);
+        return Expr;
+    }
+}
+
+
+
 void WriteExpr (ExprNode* Expr)
 /* Write the given expression to the object file */
 {
+    long Delta;
+    int  Link;
+
     /* Null expressions are encoded by a type byte of zero */
     if (Expr == 0) {
         ObjWrite8 (EXPR_NULL);
@@ -2104,6 +2312,24 @@ void WriteExpr (ExprNode* Expr)
             WriteExpr (ULabResolve (Expr->V.IVal));
             break;
 
+        case EXPR_RELAX:
+            if (!GetRelaxDelta (Expr->V.IVal, &Delta)) {
+                Internal ("Relaxed instruction sizes are unknown");
+            }
+            Link = GetRelaxLink (Expr->V.IVal);
+            if (Link >= 0) {
+                /* Add the size changes made by the linker */
+                ObjWrite8 (EXPR_PLUS);
+                ObjWrite8 (EXPR_LITERAL);
+                ObjWrite32 (Delta);
+                ObjWrite8 (EXPR_RELAX);
+                ObjWriteVar (GetRelaxLinkId (Link));
+            } else {
+                ObjWrite8 (EXPR_LITERAL);
+                ObjWrite32 (Delta);
+            }
+            break;
+
         default:
             /* Not a leaf node */
             ObjWrite8 (Expr->Op);
@@ -77,6 +77,13 @@ void FreeExpr (ExprNode* Root);
 ExprNode* SimplifyExpr (ExprNode* Expr, const struct ExprDesc* D);
 /* Try to simplify the given expression tree */
 
+ExprNode* FlattenExpr (ExprNode* Expr, const struct ExprDesc* D);
+/* D is the result of studying Expr after assembly. If the sum of D's section
+** and import references plus its value is smaller than Expr with all symbols
+** replaced by their values, return the sum and free Expr. Otherwise return
+** Expr.
+*/
+
 ExprNode* GenLiteralExpr (long Val);
 /* Return an expression tree that encodes the given literal value */
 
@@ -100,9 +107,25 @@ ExprNode* GenBranchExpr (unsigned Offs);
 ** offset and the target expression (that is, Expression() - (*+Offs) ).
 */
 
+ExprNode* GenPCRelExpr (ExprNode* N, unsigned Offs);
+/* Return an expression that encodes the difference between current PC plus
+** offset and the given target expression (that is, N - (*+Offs) ).
+*/
+
 ExprNode* GenULabelExpr (unsigned Num);
 /* Return an expression for an unnamed label with the given index */
 
+ExprNode* GenRelaxExpr (unsigned Mark);
+/* Return an expression for the size changes of relaxed instructions up to
+** the given mark.
+*/
+
+ExprNode* GenRelaxedSizeExpr (unsigned long Size, int StartMark, int EndMark);
+/* Return an expression for the size of a range of data in one segment. Size
+** is the size when the data was assembled, StartMark and EndMark are the
+** relaxation marks (see GetRelaxMark) at the start and end of the range.
+*/
+
 ExprNode* GenByteExpr (ExprNode* Expr);
 /* Force the given expression into a byte and return the result */
 
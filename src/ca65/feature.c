@@ -68,6 +68,7 @@ static const char* const FeatureKeys[FEAT_COUNT] = {
     "string_escapes",
     "long_jsr_jmp_rts",
     "line_continuations",
+    "relax_code",
 };
 
 
@@ -123,6 +124,7 @@ void SetFeature (feature_t Feature, unsigned char On)
         case FEAT_STRING_ESCAPES:             StringEscapes     = On;    break;
         case FEAT_LONG_JSR_JMP_RTS:           LongJsrJmpRts     = On;    break;
         case FEAT_LINE_CONTINUATIONS:         LineCont          = On;    break;
+        case FEAT_RELAX_CODE:                 RelaxCode         = On;    break;
         default:                                                         break;
     }
 }
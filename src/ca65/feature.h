@@ -70,6 +70,7 @@ typedef enum {
     FEAT_STRING_ESCAPES,
     FEAT_LONG_JSR_JMP_RTS,
     FEAT_LINE_CONTINUATIONS,
+    FEAT_RELAX_CODE,
 
     /* Special value: Number of features available */
     FEAT_COUNT
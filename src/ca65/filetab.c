@@ -352,3 +352,13 @@ void CreateDependencies (void)
                        FT_MAIN | FT_INCLUDE | FT_BINARY | FT_DBGINFO);
     }
 }
+
+
+
+void ResetFileTab (void)
+/* Remove all files from the file table, so another file can be assembled */
+{
+    CollDeleteAll (&FileTab);
+    DoneHashTable (&HashTab);
+    InitHashTable (&HashTab, HASHTAB_COUNT, &HashFunc);
+}
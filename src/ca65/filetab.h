@@ -85,6 +85,9 @@ void WriteFiles (void);
 void CreateDependencies (void);
 /* Create dependency files requested by the user */
 
+void ResetFileTab (void);
+/* Remove all files from the file table, so another file can be assembled */
+
 
 
 /* End of filetab.h */
@@ -33,7 +33,11 @@
 
 
 
+#include <string.h>
+
 /* common */
+#include "check.h"
+#include "fragdefs.h"
 #include "xmalloc.h"
 
 /* ca65 */
@@ -62,7 +66,47 @@ Fragment* NewFragment (unsigned char Type, unsigned short Len)
     GetFullLineInfo (&F->LI);
     F->Len      = Len;
     F->Type     = Type;
+    F->Shared   = 0;
 
     /* And return it */
     return F;
 }
+
+
+
+static unsigned BufSize (unsigned Len)
+/* Return the size of the data buffer of a literal fragment with the given
+** length, if the data doesn't fit into the fragment itself.
+*/
+{
+    unsigned Size = 16;
+    while (Size < Len) {
+        Size *= 2;
+    }
+    return Size;
+}
+
+
+
+void AppendFragData (Fragment* F, const unsigned char* Data, unsigned Len)
+/* Append data to a literal fragment. The resulting length of the fragment
+** must not exceed MAX_FRAG_LEN, and the fragment must not be shared.
+*/
+{
+    unsigned NewLen = F->Len + Len;
+
+    PRECONDITION (F->Type == FRAG_LITERAL && !F->Shared && NewLen <= MAX_FRAG_LEN);
+
+    if (NewLen > sizeof (F->V.Data)) {
+        if (F->Len <= sizeof (F->V.Data)) {
+            /* Move the data out of the fragment */
+            unsigned char* Buf = xmalloc (BufSize (NewLen));
+            memcpy (Buf, F->V.Data, F->Len);
+            F->V.Buf = Buf;
+        } else if (BufSize (NewLen) > BufSize (F->Len)) {
+            F->V.Buf = xrealloc (F->V.Buf, BufSize (NewLen));
+        }
+    }
+    F->Len = (unsigned short) NewLen;
+    memcpy (GetFragData (F) + NewLen - Len, Data, Len);
+}
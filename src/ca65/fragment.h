@@ -60,12 +60,19 @@ struct Fragment {
     Collection          LI;         /* Line info for this fragment */
     unsigned short      Len;        /* Length for this fragment */
     unsigned char       Type;       /* Fragment type */
+    unsigned char       Shared;     /* V.Buf is not owned by the fragment */
     union {
         unsigned char   Data[sizeof (ExprNode*)];       /* Literal values */
+        unsigned char*  Buf;                            /* Literal values if
+                                                        ** Len > sizeof Data
+                                                        */
         ExprNode*       Expr;                           /* Expression */
     } V;
 };
 
+/* Maximum length of a literal fragment */
+#define MAX_FRAG_LEN    0xFFFFU
+
 
 
 /*****************************************************************************/
@@ -79,6 +86,17 @@ Fragment* NewFragment (unsigned char Type, unsigned short Len);
 ** into the current segment.
 */
 
+static inline unsigned char* GetFragData (Fragment* F)
+/* Return the data of a literal fragment */
+{
+    return (F->Len <= sizeof (F->V.Data))? F->V.Data : F->V.Buf;
+}
+
+void AppendFragData (Fragment* F, const unsigned char* Data, unsigned Len);
+/* Append data to a literal fragment. The resulting length of the fragment
+** must not exceed MAX_FRAG_LEN, and the fragment must not be shared.
+*/
+
 
 
 /* End of fragment.h */
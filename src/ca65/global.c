@@ -57,6 +57,8 @@ StrBuf FullDepName = STATIC_STRBUF_INITIALIZER; /* Full dependency file */
 /* Default extensions */
 const char ObjExt[]              = ".o";/* Default object extension */
 
+unsigned MaxJobs                 = 1;   /* Files assembled in parallel */
+
 char LocalStart                  = '@'; /* This char starts local symbols */
 
 unsigned char IgnoreCase         = 0;   /* Ignore case on identifiers? */
@@ -66,12 +68,15 @@ unsigned char DbgSyms            = 0;   /* Add debug symbols */
 unsigned char LineCont           = 0;   /* Allow line continuation */
 unsigned char LargeAlignment     = 0;   /* Don't warn about large alignments */
 unsigned char RelaxChecks        = 0;   /* Relax a few assembler checks */
+unsigned char ProcSections       = 0;   /* Put each .proc into its own section */
 unsigned char StringEscapes      = 0;   /* Allow C-style escapes in strings */
 unsigned char LongJsrJmpRts      = 0;   /* Allow JSR/JMP/RTS as alias for JSL/JML/RTL */
+unsigned char RelaxCode          = 0;   /* Choose size of branches and addresses */
 unsigned char WarnAlignWaste     = 0;   /* Warn about "wasted" bytes when aligning */
 unsigned char WarningsAsErrors   = 0;   /* Error if any warnings */
 unsigned char SegList            = 0;   /* Show segments in listing */
 unsigned char ExpandMacros       = 0;   /* Expand macros in listing */
+unsigned char StreamListing      = 0;   /* Write listing while assembling */
 
 /* Emulation features */
 unsigned char DollarIsPC         = 0;   /* Allow the $ symbol as current PC */
@@ -89,3 +94,72 @@ unsigned char CComments          = 0;   /* Allow C like comments */
 unsigned char ForceRange         = 0;   /* Force values into expected range */
 unsigned char UnderlineInNumbers = 0;   /* Allow underlines in numbers */
 unsigned char BracketAsIndirect  = 0;   /* Use '[]' not '()' for indirection */
+
+/* Flags that may be changed by directives, and their values saved by
+** SaveGlobals.
+*/
+static unsigned char* const Flags[] = {
+    &IgnoreCase,
+    &AutoImport,
+    &SmartMode,
+    &DbgSyms,
+    &LineCont,
+    &LargeAlignment,
+    &RelaxChecks,
+    &ProcSections,
+    &StringEscapes,
+    &LongJsrJmpRts,
+    &RelaxCode,
+    &WarnAlignWaste,
+    &WarningsAsErrors,
+    &SegList,
+    &ExpandMacros,
+    &StreamListing,
+    &DollarIsPC,
+    &NoColonLabels,
+    &LooseStringTerm,
+    &LooseCharTerm,
+    &AtInIdents,
+    &DollarInIdents,
+    &LeadingDotInIdents,
+    &PCAssignment,
+    &MissingCharTerm,
+    &UbiquitousIdents,
+    &OrgPerSeg,
+    &CComments,
+    &ForceRange,
+    &UnderlineInNumbers,
+    &BracketAsIndirect,
+};
+static unsigned char SavedFlags[sizeof (Flags) / sizeof (Flags[0])];
+static char SavedLocalStart;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void SaveGlobals (void)
+/* Save the values of the flags that may be changed by directives */
+{
+    unsigned I;
+    for (I = 0; I < sizeof (Flags) / sizeof (Flags[0]); ++I) {
+        SavedFlags[I] = *Flags[I];
+    }
+    SavedLocalStart = LocalStart;
+}
+
+
+
+void RestoreGlobals (void)
+/* Restore the flags saved by SaveGlobals, so another file can be assembled */
+{
+    unsigned I;
+    for (I = 0; I < sizeof (Flags) / sizeof (Flags[0]); ++I) {
+        *Flags[I] = SavedFlags[I];
+    }
+    LocalStart = SavedLocalStart;
+}
@@ -59,6 +59,8 @@ extern StrBuf           FullDepName;        /* Name of full dependencies file */
 /* Default extensions */
 extern const char       ObjExt[];           /* Default object extension */
 
+extern unsigned         MaxJobs;            /* Files assembled in parallel */
+
 extern char             LocalStart;         /* This char starts local symbols */
 
 extern unsigned char    IgnoreCase;         /* Ignore case on identifiers? */
@@ -68,12 +70,15 @@ extern unsigned char    DbgSyms;            /* Add debug symbols */
 extern unsigned char    LineCont;           /* Allow line continuation */
 extern unsigned char    LargeAlignment;     /* Don't warn about large alignments */
 extern unsigned char    RelaxChecks;        /* Relax a few assembler checks */
+extern unsigned char    ProcSections;       /* Put each .proc into its own section */
 extern unsigned char    StringEscapes;      /* Allow C-style escapes in strings */
 extern unsigned char    LongJsrJmpRts;      /* Allow JSR/JMP/RTS as alias for JSL/JML/RTL */
+extern unsigned char    RelaxCode;          /* Choose size of branches and addresses */
 extern unsigned char    WarnAlignWaste;     /* Warn about "wasted" bytes when aligning */
 extern unsigned char    WarningsAsErrors;   /* Error if any warnings */
 extern unsigned char    SegList;            /* Show segments in listing */
 extern unsigned char    ExpandMacros;       /* Expand macros in listing */
+extern unsigned char    StreamListing;      /* Write listing while assembling */
 
 /* Emulation features */
 extern unsigned char    DollarIsPC;         /* Allow the $ symbol as current PC */
@@ -94,6 +99,20 @@ extern unsigned char    BracketAsIndirect;  /* Use '[]' not '()' for indirection
 
 
 
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void SaveGlobals (void);
+/* Save the values of the flags that may be changed by directives */
+
+void RestoreGlobals (void);
+/* Restore the flags saved by SaveGlobals, so another file can be assembled */
+
+
+
 
 /* End of global.h */
 
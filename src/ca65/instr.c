@@ -42,7 +42,9 @@
 #include "attrib.h"
 #include "bitops.h"
 #include "check.h"
+#include "hashfunc.h"
 #include "mmodel.h"
+#include "xmalloc.h"
 
 /* ca65 */
 #include "asserts.h"
@@ -55,6 +57,8 @@
 #include "instr.h"
 #include "nexttok.h"
 #include "objcode.h"
+#include "relax.h"
+#include "segment.h"
 #include "spool.h"
 #include "studyexpr.h"
 #include "symtab.h"
@@ -1625,6 +1629,22 @@ static const InsTable* InsTabs[CPU_COUNT] = {
 };
 const InsTable* InsTab = (const InsTable*) &InsTab6502;
 
+/* Hash index for the mnemonics of an instruction table. The slots contain
+** the index of the instruction plus one, or zero for an empty slot.
+*/
+typedef struct InsIndex InsIndex;
+struct InsIndex {
+    const InsTable*     Tab;                    /* Indexed table */
+    unsigned            Mask;                   /* Number of slots minus one */
+    unsigned short      Slots[1];               /* Varying length */
+};
+
+/* Hash indices for the instruction tables, created when first needed */
+static InsIndex* InsIndices[CPU_COUNT];
+
+/* Hash index for the active instruction table */
+static const InsIndex* CurIndex = 0;
+
 /* Table to build the effective 65xx opcode from a base opcode and an
 ** addressing mode. (The value in the table is ORed with the base opcode)
 ** NOTE: each table has one entry per addressing mode!
@@ -1799,6 +1819,8 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
 ** this function. The function returns true on success and false on errors.
 */
 {
+    unsigned ZPMode = 0;
+
     /* Get the set of possible addressing modes */
     GetEA (A);
 
@@ -1840,14 +1862,32 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
                 ** allowed by the instruction, mark all symbols in the
                 ** expression tree. This mark will be checked at end of
                 ** assembly, and a warning is issued, if a zero page symbol
-                ** was guessed wrong here.
+                ** was guessed wrong here. If code relaxation is enabled,
+                ** remember the zero page mode instead, so the decision can
+                ** be made at the end of assembly.
                 */
                 if (ED.AddrSize > ADDR_SIZE_ZP && (A->AddrModeSet & AM65_SET_ZP)) {
-                    ExprGuessedAddrSize (A->Expr, ADDR_SIZE_ZP);
+                    if (RelaxCode && GetRelocMode ()) {
+                        ZPMode = BitFind (A->AddrModeSet & AM65_SET_ZP);
+                        A->Flags |= EFFADDR_RELAX_ZP;
+                    } else {
+                        ExprGuessedAddrSize (A->Expr, ADDR_SIZE_ZP);
+                    }
                 }
             }
         }
 
+        /* Imports are often zero page symbols that weren't declared as
+        ** such. With code relaxation, leave the choice to the linker in this
+        ** case.
+        */
+        if (ED.AddrSize == ADDR_SIZE_ABS && ED.SymCount > 0 &&
+            (A->AddrModeSet & AM65_SET_ZP) && !(A->Flags & EFFADDR_RELAX_ZP) &&
+            RelaxCode && GetRelocMode () && LinkerMayRelax ()) {
+            ZPMode = BitFind (A->AddrModeSet & AM65_SET_ZP);
+            A->Flags |= EFFADDR_RELAX_ZP;
+        }
+
         /* Check the size */
         switch (ED.AddrSize) {
 
@@ -1897,6 +1937,21 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
     /* Build the opcode */
     A->Opcode = Ins->BaseCode | EATab[Ins->ExtCode][A->AddrMode];
 
+    /* Check if the instruction may be relaxed at the end of assembly. This is
+    ** possible for zero page versions of absolute addressing modes, and for
+    ** "JMP abs" on CPUs that have BRA.
+    */
+    if (A->Flags & EFFADDR_RELAX_ZP) {
+        if (ExtBytes[ZPMode] == 1 && ExtBytes[A->AddrMode] == 2) {
+            A->ZPOpcode = Ins->BaseCode | EATab[Ins->ExtCode][ZPMode];
+        } else {
+            A->Flags &= ~EFFADDR_RELAX_ZP;
+        }
+    } else if (RelaxCode && GetRelocMode () && A->AddrModeBit == AM65_ABS &&
+               A->Opcode == 0x4C && CPUHasCap (CAP_CPU_HAS_BRA8)) {
+        A->Flags |= EFFADDR_RELAX_JMP;
+    }
+
     /* If feature force_range is active, and we have immediate addressing mode,
     ** limit the expression to the maximum possible value.
     */
@@ -1928,7 +1983,13 @@ static void EmitCode (EffAddr* A)
             break;
 
         case 2:
-            if (CPU == CPU_65816 && (A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y | AM65_ABS_X_IND))) {
+            if (A->Flags & EFFADDR_RELAX_ZP) {
+                /* The address size is chosen at the end of assembly */
+                RelaxAddr (A->ZPOpcode, A->Opcode, A->Expr);
+            } else if (A->Flags & EFFADDR_RELAX_JMP) {
+                /* May be replaced by BRA at the end of assembly */
+                RelaxJump (A->Expr);
+            } else if (CPU == CPU_65816 && (A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y | AM65_ABS_X_IND))) {
                 /* This is a 16 bit mode that uses an address. If in 65816,
                 ** mode, force this address into 16 bit range to allow
                 ** addressing inside a 64K segment.
@@ -2005,7 +2066,15 @@ static long PutImmed8 (const InsDesc* Ins)
 static void PutPCRel8 (const InsDesc* Ins)
 /* Handle branches with a 8 bit distance */
 {
-    EmitPCRel (Ins->BaseCode, GenBranchExpr (2), 1);
+    /* If code relaxation is enabled, the conditional branches and BRA get
+    ** their final size at the end of assembly.
+    */
+    if (RelaxCode && GetRelocMode () &&
+        ((Ins->BaseCode & 0x1F) == 0x10 || Ins->BaseCode == 0x80)) {
+        RelaxBranch (Ins->BaseCode, Expression ());
+    } else {
+        EmitPCRel (Ins->BaseCode, GenBranchExpr (2), 1);
+    }
 }
 
 
@@ -2596,10 +2665,46 @@ static void PutSweet16Branch (const InsDesc* Ins)
 
 
 
-static int CmpName (const void* Key, const void* Instr)
-/* Compare function for bsearch */
+static const InsIndex* GetInsIndex (void)
+/* Return the hash index for the active instruction table, creating it if
+** it doesn't exist.
+*/
 {
-    return strcmp ((const char*)Key, ((const InsDesc*) Instr)->Mnemonic);
+    unsigned  C;
+    unsigned  I;
+    unsigned  Size;
+    InsIndex* X;
+
+    /* Search for the CPU with the active table */
+    for (C = 0; InsTabs[C] != InsTab; ++C) {
+        CHECK (C < CPU_COUNT - 1);
+    }
+    if (InsIndices[C] != 0) {
+        return InsIndices[C];
+    }
+
+    /* Use at least twice as many slots as there are instructions, so the
+    ** chains of probed slots are short.
+    */
+    Size = 16;
+    while (Size < InsTab->Count * 2) {
+        Size *= 2;
+    }
+    X = xmalloc (sizeof (InsIndex) + (Size - 1) * sizeof (X->Slots[0]));
+    X->Tab  = InsTab;
+    X->Mask = Size - 1;
+    memset (X->Slots, 0, Size * sizeof (X->Slots[0]));
+
+    /* Insert the instructions using linear probing */
+    for (I = 0; I < InsTab->Count; ++I) {
+        unsigned H = HashStr (InsTab->Ins[I].Mnemonic) & X->Mask;
+        while (X->Slots[H] != 0) {
+            H = (H + 1) & X->Mask;
+        }
+        X->Slots[H] = I + 1;
+    }
+
+    return InsIndices[C] = X;
 }
 
 
@@ -2635,8 +2740,8 @@ int FindInstruction (const StrBuf* Ident)
 */
 {
     unsigned I;
-    const InsDesc* ID;
-    char Key[sizeof (ID->Mnemonic)];
+    unsigned H;
+    char Key[sizeof (InsTab->Ins[0].Mnemonic)];
 
     /* Shortcut for the "none" CPU: If there are no instructions to search
     ** for, bail out early.
@@ -2661,15 +2766,22 @@ int FindInstruction (const StrBuf* Ident)
     }
     Key[I] = '\0';
 
-    /* Search for the key */
-    ID = bsearch (Key, InsTab->Ins, InsTab->Count, sizeof (InsDesc), CmpName);
-    if (ID == 0) {
-        /* Not found */
-        return -1;
-    } else {
-        /* Found, return the entry */
-        return ID - InsTab->Ins;
+    /* Search for the key in the hash index of the active table */
+    if (CurIndex == 0 || CurIndex->Tab != InsTab) {
+        CurIndex = GetInsIndex ();
+    }
+    H = HashStr (Key) & CurIndex->Mask;
+    while (CurIndex->Slots[H] != 0) {
+        I = CurIndex->Slots[H] - 1;
+        if (strcmp (Key, InsTab->Ins[I].Mnemonic) == 0) {
+            /* Found, return the entry */
+            return I;
+        }
+        H = (H + 1) & CurIndex->Mask;
     }
+
+    /* Not found */
+    return -1;
 }
 
 
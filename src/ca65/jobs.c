@@ -0,0 +1,154 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   jobs.c                                  */
+/*                                                                           */
+/*                    Assembling several files in parallel                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* Check out if we have a fork() function on the system */
+#if !defined(_WIN32) && !defined(_AMIGA)
+#  define HAVE_FORK 1
+#endif
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(HAVE_FORK)
+#  include <unistd.h>
+#  include <sys/types.h>
+#  include <sys/wait.h>
+#endif
+
+/* common */
+#include "abend.h"
+#include "coll.h"
+
+/* ca65 */
+#include "jobs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static int RunSerial (const Collection* Files, unsigned First, unsigned Step,
+                      JobFunc Func)
+/* Call Func for the files starting with the one at index First, and then for
+** every Step'th file. Return true if all calls were successful.
+*/
+{
+    int Ok = 1;
+    unsigned I;
+    for (I = First; I < CollCount (Files); I += Step) {
+        if (!Func (CollConstAt (Files, I))) {
+            Ok = 0;
+        }
+    }
+    return Ok;
+}
+
+
+
+#if defined(HAVE_FORK)
+
+static int WaitJob (void)
+/* Wait for one job to finish and return true if it was successful */
+{
+    int Status;
+
+    while (wait (&Status) < 0) {
+        if (errno != EINTR) {
+            AbEnd ("Failure waiting for assembler job: %s", strerror (errno));
+        }
+    }
+    return WIFEXITED (Status) && WEXITSTATUS (Status) == EXIT_SUCCESS;
+}
+
+#endif
+
+
+
+int RunJobs (const Collection* Files, unsigned MaxJobs, JobFunc Func)
+/* Call Func for each of the given files. If MaxJobs is greater than one, up
+** to MaxJobs subprocesses are started, each of which handles a share of the
+** files one after another. Otherwise, or if the platform cannot start
+** subprocesses, all files are handled in the calling process. Return true if
+** all calls of Func were successful.
+*/
+{
+#if defined(HAVE_FORK)
+
+    unsigned I;
+    int      Ok = 1;
+
+    /* Use no more jobs than there are files */
+    if (MaxJobs > CollCount (Files)) {
+        MaxJobs = CollCount (Files);
+    }
+
+    /* Without parallel jobs, there's no need for a subprocess */
+    if (MaxJobs <= 1) {
+        return RunSerial (Files, 0, 1, Func);
+    }
+
+    /* Don't let output buffered so far appear in each of the jobs */
+    fflush (stdout);
+    fflush (stderr);
+
+    /* Start the jobs. Job I handles files I, I+MaxJobs, I+2*MaxJobs, ... */
+    for (I = 0; I < MaxJobs; ++I) {
+        pid_t Pid = fork ();
+        if (Pid < 0) {
+            AbEnd ("Cannot fork: %s", strerror (errno));
+        } else if (Pid == 0) {
+            exit (RunSerial (Files, I, MaxJobs, Func)? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+
+    /* Wait for all jobs */
+    for (I = 0; I < MaxJobs; ++I) {
+        if (!WaitJob ()) {
+            Ok = 0;
+        }
+    }
+    return Ok;
+
+#else
+
+    /* No subprocesses on this platform */
+    (void) MaxJobs;
+    return RunSerial (Files, 0, 1, Func);
+
+#endif
+}
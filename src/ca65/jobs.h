@@ -0,0 +1,72 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   jobs.h                                  */
+/*                                                                           */
+/*                    Assembling several files in parallel                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef JOBS_H
+#define JOBS_H
+
+
+
+/* common */
+#include "coll.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Function called for each file. Returns true if it was successful. */
+typedef int (*JobFunc) (const char* Name);
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int RunJobs (const Collection* Files, unsigned MaxJobs, JobFunc Func);
+/* Call Func for each of the given files. If MaxJobs is greater than one, up
+** to MaxJobs subprocesses are started, each of which handles a share of the
+** files one after another. Otherwise, or if the platform cannot start
+** subprocesses, all files are handled in the calling process. Return true if
+** all calls of Func were successful.
+*/
+
+
+
+/* End of jobs.h */
+
+#endif
@@ -509,3 +509,17 @@ void WriteLineInfos (void)
     /* End of line infos */
     ObjEndLineInfos ();
 }
+
+
+
+void ResetLineInfo (void)
+/* Remove all line infos, so another file can be assembled. InitLineInfo must
+** be called afterwards.
+*/
+{
+    CollDeleteAll (&LineInfoList);
+    CollDeleteAll (&CurLineInfo);
+    DoneHashTable (&LineInfoTab);
+    InitHashTable (&LineInfoTab, 1051, &HashFunc);
+    AsmLineInfo = 0;
+}
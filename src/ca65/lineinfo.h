@@ -112,6 +112,11 @@ void WriteLineInfo (const Collection* LineInfos);
 void WriteLineInfos (void);
 /* Write a list of all line infos to the object file. */
 
+void ResetLineInfo (void);
+/* Remove all line infos, so another file can be assembled. InitLineInfo must
+** be called afterwards.
+*/
+
 
 
 /* End of lineinfo.h */
@@ -50,7 +50,9 @@
 #include "filetab.h"
 #include "global.h"
 #include "listing.h"
+#include "relax.h"
 #include "segment.h"
+#include "studyexpr.h"
 
 
 
@@ -74,6 +76,28 @@ static unsigned ListBytes  = 12;        /* Number of bytes to list for one line
 /* Switch the listing on/off */
 static int      ListingEnabled = 1;     /* Enabled if > 0 */
 
+/* The listing file */
+static FILE*    ListFile   = 0;         /* Listing file if it was opened */
+static int      BreakFile  = -1;        /* File for a pending page header */
+
+/* Lines not yet written when streaming the listing */
+static unsigned PendingLines = 0;       /* Number of lines in the list */
+static unsigned RetryLines   = 0;       /* Try to write when this many */
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+static void FlushListing (void);
+/* Write and free the lines before the current one, up to the first line that
+** may still change.
+*/
+
+
 
 /*****************************************************************************/
 /*                                   Code                                    */
@@ -121,6 +145,7 @@ void NewListingLine (const StrBuf* Line, unsigned char File, unsigned char Depth
             LineLast->Next = L;
         }
         LineLast = L;
+        ++PendingLines;
     }
 }
 
@@ -197,6 +222,11 @@ void InitListingLine (void)
         LineCur->Reloc      = GetRelocMode ();
         LineCur->Output     = (ListingEnabled > 0);
         LineCur->ListBytes  = (unsigned char) ListBytes;
+
+        /* Write the lines before the current one if possible */
+        if (StreamListing) {
+            FlushListing ();
+        }
     }
 }
 
@@ -217,13 +247,13 @@ static char* AddHex (char* S, unsigned Val)
 
 
 
-static void PrintPageHeader (FILE* F, const ListLine* L)
-/* Print the header for a new page. It is assumed that the given line is the
-** last line of the previous page.
+static void PrintPageHeader (FILE* F, unsigned File)
+/* Print the header for a new page. File is the input file of the last line
+** of the previous page.
 */
 {
     /* Gte a pointer to the current input file */
-    const StrBuf* CurFile = GetFileName (L->File);
+    const StrBuf* CurFile = GetFileName (File);
 
     /* Print the header on the new page */
     fprintf (F,
@@ -251,14 +281,11 @@ static void PrintLine (FILE* F, const char* Header, const char* Line, const List
     /* Increment the current line */
     ++PageLines;
 
-    /* Switch to a new page if needed. Do not switch, if the current line is
-    ** the last one, to avoid pages that consist of just the header.
+    /* Switch to a new page if needed. The new page is started when the next
+    ** line is written, to avoid pages that consist of just the header.
     */
-    if (PageLength > 0 && PageLines >= PageLength && L->Next != 0) {
-        /* Do a formfeed */
-        putc ('\f', F);
-        /* Print the header on the new page */
-        PrintPageHeader (F, L);
+    if (PageLength > 0 && PageLines >= PageLength) {
+        BreakFile = L->File;
     }
 }
 
@@ -304,17 +331,11 @@ static char* MakeLineHeader (char* H, const ListLine* L)
 
 
 
-void CreateListing (void)
-/* Create the listing */
+static void OpenListing (void)
+/* Open the listing file and print the header for the first page */
 {
-    FILE* F;
-    Fragment* Frag;
-    ListLine* L;
-    char HeaderBuf [LINE_HEADER_LEN+1];
-
-    /* Open the real listing file */
-    F = fopen (SB_GetConstBuf (&ListingName), "w");
-    if (F == 0) {
+    ListFile = fopen (SB_GetConstBuf (&ListingName), "w");
+    if (ListFile == 0) {
         Fatal ("Cannot open listing file `%s': %s",
                SB_GetConstBuf (&ListingName),
                strerror (errno));
@@ -322,149 +343,306 @@ void CreateListing (void)
 
     /* Reset variables, print the header for the first page */
     PageNumber = 0;
-    PrintPageHeader (F, LineList);
+    PrintPageHeader (ListFile, LineList->File);
+}
+
+
+
+static char* AddExpr (char* S, const Fragment* Frag)
+/* Add the bytes of an expression fragment to the given string and return the
+** new pointer. When streaming, the fragment may be written before SegDone
+** replaced a constant expression by its value, so the value is used in this
+** case.
+*/
+{
+    ExprDesc ED;
+    unsigned I;
+    long     Val;
+
+    if (StreamListing) {
+        ED_Init (&ED);
+        StudyFinalExpr (Frag->V.Expr, &ED);
+        if (ED_IsConst (&ED)) {
+            Val = ED.Val;
+            for (I = 0; I < Frag->Len; ++I) {
+                S = AddHex (S, (unsigned) (Val & 0xFF));
+                Val >>= 8;
+            }
+            ED_Done (&ED);
+            return S;
+        }
+        ED_Done (&ED);
+    }
+    return AddMult (S, 'r', Frag->Len*2);
+}
+
+
+
+static void WriteLine (ListLine* L)
+/* Write one listing line to the listing file */
+{
+    FILE* F = ListFile;
+    Fragment* Frag;
+    char HeaderBuf [LINE_HEADER_LEN+1];
+    char* Buf;
+    char* B;
+    unsigned Count;
+    unsigned I;
+    char* Line;
 
     /* Terminate the header buffer. The last byte will never get overwritten
     ** the - 3 adjust is for when the segnum gets prepended to the header.
     */
-
     HeaderBuf [(SegList ? LINE_HEADER_LEN : LINE_HEADER_LEN - 3)] = '\0';
 
-    /* Walk through all listing lines */
-    L = LineList;
-    while (L) {
-
-        char* Buf;
-        char* B;
-        unsigned Count;
-        unsigned I;
-        char* Line;
-
-        /* If we should not output this line, go to the next */
-        if (L->Output == 0) {
-            L = L->Next;
-            continue;
-        }
+    /* If the last line filled the page, start a new one */
+    if (BreakFile >= 0) {
+        /* Do a formfeed */
+        putc ('\f', F);
+        /* Print the header on the new page */
+        PrintPageHeader (F, (unsigned) BreakFile);
+        BreakFile = -1;
+    }
 
-        /* If we don't have a fragment list for this line, things are easy */
-        if (L->FragList == 0) {
-            PrintLine (F, MakeLineHeader (HeaderBuf, L), L->Line, L);
-            L = L->Next;
-            continue;
-        }
+    /* If we should not output this line, we're done */
+    if (L->Output == 0) {
+        return;
+    }
 
-        /* Count the number of bytes in the complete fragment list */
-        Count = 0;
-        Frag = L->FragList;
-        while (Frag) {
-            Count += Frag->Len;
-            Frag = Frag->LineList;
-        }
+    /* Account for size changes of relaxed instructions */
+    if (L->Reloc) {
+        L->PC = GetRelaxedOffs (L->Seg, L->PC);
+    }
+
+    /* If we don't have a fragment list for this line, things are easy */
+    if (L->FragList == 0) {
+        PrintLine (F, MakeLineHeader (HeaderBuf, L), L->Line, L);
+        return;
+    }
 
-        /* Allocate memory for the given number of bytes */
-        Buf = xmalloc (Count*2+1);
+    /* Count the number of bytes in the complete fragment list */
+    Count = 0;
+    Frag = L->FragList;
+    while (Frag) {
+        Count += Frag->Len;
+        Frag = Frag->LineList;
+    }
 
-        /* Copy an ASCII representation of the bytes into the buffer */
-        B = Buf;
-        Frag = L->FragList;
-        while (Frag) {
+    /* Allocate memory for the given number of bytes */
+    Buf = xmalloc (Count*2+1);
 
-            /* Write data depending on the type */
-            switch (Frag->Type) {
+    /* Copy an ASCII representation of the bytes into the buffer */
+    B = Buf;
+    Frag = L->FragList;
+    while (Frag) {
 
-                case FRAG_LITERAL:
-                    for (I = 0; I < Frag->Len; ++I) {
-                        B = AddHex (B, Frag->V.Data[I]);
-                    }
-                    break;
+        /* Write data depending on the type */
+        switch (Frag->Type) {
 
-                case FRAG_EXPR:
-                case FRAG_SEXPR:
-                    B = AddMult (B, 'r', Frag->Len*2);
-                    break;
+            case FRAG_LITERAL:
+                for (I = 0; I < Frag->Len; ++I) {
+                    B = AddHex (B, GetFragData (Frag)[I]);
+                }
+                break;
 
-                case FRAG_FILL:
-                    B = AddMult (B, 'x', Frag->Len*2);
-                    break;
+            case FRAG_EXPR:
+            case FRAG_SEXPR:
+                B = AddExpr (B, Frag);
+                break;
 
-                default:
-                    Internal ("Invalid fragment type: %u", Frag->Type);
+            case FRAG_RELAX:
+                /* Opcode of the long form, the linker may choose another */
+                B = AddHex (B, GetFragData (Frag)[0]);
+                break;
 
-            }
+            case FRAG_FILL:
+                B = AddMult (B, 'x', Frag->Len*2);
+                break;
 
-            /* Next fragment */
-            Frag = Frag->LineList;
+            default:
+                Internal ("Invalid fragment type: %u", Frag->Type);
 
         }
 
-        /* Limit the number of bytes actually printed */
-        if (L->ListBytes != 0) {
-            /* Not unlimited */
-            if (Count > L->ListBytes) {
-                Count = L->ListBytes;
-            }
+        /* Next fragment */
+        Frag = Frag->LineList;
+
+    }
+
+    /* Limit the number of bytes actually printed */
+    if (L->ListBytes != 0) {
+        /* Not unlimited */
+        if (Count > L->ListBytes) {
+            Count = L->ListBytes;
+        }
+    }
+
+    /* Output the data. The format of a listing line is:
+    **
+    **      PPPPPPm I  11 22 33 44
+    **
+    ** where
+    **
+    **      PPPPPP  is the PC
+    **      m       is the mode ('r' or empty)
+    **      I       is the include level
+    **      11 ..   are code or data bytes
+    */
+    Line = L->Line;
+    B    = Buf;
+    while (Count) {
+
+        unsigned    Chunk;
+        char*       P;
+
+        /* Prepare the line header */
+        MakeLineHeader (HeaderBuf, L);
+
+        /* Get the number of bytes for the next line */
+        Chunk = Count;
+        if (Chunk > 4) {
+            Chunk = 4;
         }
+        Count -= Chunk;
 
-        /* Output the data. The format of a listing line is:
-        **
-        **      PPPPPPm I  11 22 33 44
-        **
-        ** where
-        **
-        **      PPPPPP  is the PC
-        **      m       is the mode ('r' or empty)
-        **      I       is the include level
-        **      11 ..   are code or data bytes
+        /* Increment the program counter. Since we don't need the PC stored
+        ** in the LineList object for anything else, just increment this
+        ** variable.
         */
-        Line = L->Line;
-        B    = Buf;
-        while (Count) {
+        L->PC += Chunk;
+
+        /* Copy the bytes into the line */
+        P = HeaderBuf + (SegList?14: 11);
+        for (I = 0; I < Chunk; ++I) {
+            *P++ = *B++;
+            *P++ = *B++;
+            *P++ = ' ';
+        }
+
+        /* Output this line */
+        PrintLine (F, HeaderBuf, Line, L);
+
+        /* Don't output a line twice */
+        Line = "";
+
+    }
+
+    /* Delete the temporary buffer */
+    xfree (Buf);
+}
+
 
-            unsigned    Chunk;
-            char*       P;
 
-            /* Prepare the line header */
-            MakeLineHeader (HeaderBuf, L);
+static int LineIsFinal (const ListLine* L)
+/* Return true if a listing line will not change any longer */
+{
+    const Fragment* Frag;
+    unsigned long   Size = 0;
+
+    /* Lines that are not output don't change */
+    if (L->Output == 0) {
+        return 1;
+    }
 
-            /* Get the number of bytes for the next line */
-            Chunk = Count;
-            if (Chunk > 4) {
-                Chunk = 4;
+    /* Expressions must have their final value. Relaxed instructions get
+    ** their operand expression only at the end of assembly.
+    */
+    for (Frag = L->FragList; Frag; Frag = Frag->LineList) {
+        if (Frag->Type == FRAG_EXPR || Frag->Type == FRAG_SEXPR) {
+            ExprDesc ED;
+            int      Final;
+            if (Frag->V.Expr == 0) {
+                return 0;
             }
-            Count -= Chunk;
-
-            /* Increment the program counter. Since we don't need the PC stored
-            ** in the LineList object for anything else, just increment this
-            ** variable.
-            */
-            L->PC += Chunk;
-
-            /* Copy the bytes into the line */
-            P = HeaderBuf + (SegList?14: 11);
-            for (I = 0; I < Chunk; ++I) {
-                *P++ = *B++;
-                *P++ = *B++;
-                *P++ = ' ';
+            ED_Init (&ED);
+            Final = StudyFinalExpr (Frag->V.Expr, &ED);
+            ED_Done (&ED);
+            if (!Final) {
+                return 0;
             }
+        }
+        Size += Frag->Len;
+    }
+
+    /* Relaxed instructions up to the end of the line change the PC and the
+    ** code of the line at the end of assembly.
+    */
+    return !L->Reloc || GetRelaxMarkAt (L->Seg, L->PC + Size) < 0;
+}
 
-            /* Output this line */
-            PrintLine (F, HeaderBuf, Line, L);
 
-            /* Don't output a line twice */
-            Line = "";
 
+static void FlushListing (void)
+/* Write and free the lines before the current one, up to the first line that
+** may still change.
+*/
+{
+    /* A line that may still change is checked again only after the number
+    ** of pending lines has doubled, so the time spent checking stays linear
+    ** while the memory used stays bounded by twice the unresolved window.
+    */
+    if (PendingLines < RetryLines) {
+        return;
+    }
+
+    while (LineList != LineCur) {
+
+        ListLine* L = LineList;
+
+        if (!LineIsFinal (L)) {
+            RetryLines = PendingLines * 2;
+            return;
+        }
+
+        /* Open the listing file with the first line */
+        if (ListFile == 0) {
+            OpenListing ();
         }
 
-        /* Delete the temporary buffer */
-        xfree (Buf);
+        /* Write the line and free it */
+        WriteLine (L);
+        LineList = L->Next;
+        xfree (L);
+        --PendingLines;
+    }
+    RetryLines = 0;
+}
+
 
-        /* Next line */
-        L = L->Next;
 
+void CreateListing (void)
+/* Create the listing */
+{
+    ListLine* L;
+
+    /* Open the real listing file if this wasn't done while assembling */
+    if (ListFile == 0) {
+        OpenListing ();
+    }
+
+    /* Walk through all listing lines */
+    for (L = LineList; L; L = L->Next) {
+        WriteLine (L);
     }
     if (SegList) {
-        ListSegments (F);
+        ListSegments (ListFile);
     }
+
     /* Close the listing file */
-    (void) fclose (F);
+    (void) fclose (ListFile);
+    ListFile = 0;
+}
+
+
+
+void RemoveListing (void)
+/* Remove a listing file that was written while assembling, because the
+** assembly failed.
+*/
+{
+    if (ListFile) {
+        (void) fclose (ListFile);
+        ListFile = 0;
+        remove (SB_GetConstBuf (&ListingName));
+    }
 }
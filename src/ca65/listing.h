@@ -119,6 +119,11 @@ void InitListingLine (void);
 void CreateListing (void);
 /* Create the listing */
 
+void RemoveListing (void);
+/* Remove a listing file that was written while assembling, because the
+** assembly failed.
+*/
+
 
 
 /* End of listing.h */
@@ -37,6 +37,7 @@
 #include <string.h>
 
 /* common */
+#include "attrib.h"
 #include "check.h"
 #include "hashfunc.h"
 #include "hashtab.h"
@@ -79,6 +80,9 @@ static int HT_Compare (const void* Key1, const void* Key2);
 static char* GetTokenString (Token* T);
 /* decompile a token back to a string */
 
+static StrBuf MakeLineFromMacro (Macro* M, unsigned Index);
+/* Reconstitute a line of a macro body starting with the token at Index */
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -103,8 +107,8 @@ struct Macro {
     unsigned        ParamCount; /* Parameter count of macro */
     IdDesc*         Params;     /* Identifiers of macro parameters */
     unsigned        TokCount;   /* Number of tokens for this macro */
-    TokNode*        TokRoot;    /* Root of token list */
-    TokNode*        TokLast;    /* Pointer to last token in list */
+    unsigned        TokSize;    /* Number of allocated tokens */
+    Token*          Toks;       /* Preprocessed tokens of the macro body */
     FilePos         DefPos;     /* Position of definition */
     StrBuf          Name;       /* Macro name, dynamically allocated */
     unsigned        Expansions; /* Number of active macro expansions */
@@ -123,24 +127,37 @@ static const HashFunctions HashFunc = {
 /* Macro hash table */
 static HashTable MacroTab = STATIC_HASHTABLE_INITIALIZER (117, &HashFunc);
 
-/* Structs that holds data for a macro expansion */
+/* Structs that holds data for a macro expansion. The tokens of the actual
+** parameters are kept in one array per expansion. Expansion structures are
+** not freed but kept in a pool, so the arrays (and the string buffers of the
+** tokens in it) are reused by later expansions.
+*/
 typedef struct MacExp MacExp;
 struct MacExp {
     MacExp*     Next;           /* Pointer to next expansion */
     Macro*      M;              /* Which macro do we expand? */
     unsigned    IfSP;           /* .IF stack pointer at start of expansion */
-    TokNode*    Exp;            /* Pointer to current token */
-    TokNode*    Final;          /* Pointer to final token */
+    unsigned    Exp;            /* Index of current token */
+    unsigned    HasFinal;       /* True if we have a final token */
+    Token       Final;          /* Final token */
     unsigned    MacExpansions;  /* Number of active macro expansions */
     unsigned    LocalStart;     /* Start of counter for local symbol names */
     unsigned    ParamCount;     /* Number of actual parameters */
-    TokNode**   Params;         /* List of actual parameters */
-    TokNode*    ParamExp;       /* Node for expanding parameters */
+    unsigned*   Params;         /* Start of actual parameters in ParamToks */
+    unsigned    ParamSize;      /* Number of allocated entries in Params */
+    Token*      ParamToks;      /* Tokens of actual parameters */
+    unsigned    ParamTokCount;  /* Number of tokens in ParamToks */
+    unsigned    ParamTokSize;   /* Number of allocated tokens in ParamToks */
+    unsigned    ParamExp;       /* Index for expanding parameters */
+    unsigned    ParamEnd;       /* End of the expanded parameter */
     LineInfo*   LI;             /* Line info for the expansion */
     LineInfo*   ParamLI;        /* Line info for parameter expansion */
     unsigned    ExpandStart;    /* First pass through expansion ?*/
 };
 
+/* Pool of unused macro expansion structures */
+static MacExp* FreeMacExps = 0;
+
 /* Maximum number of nested macro expansions */
 #define MAX_MACEXPANSIONS       256U
 
@@ -156,6 +173,11 @@ static unsigned LocalName = 0;
 /* Define-style macros disabled if != 0 */
 static unsigned DisableDefines = 0;
 
+/* Number of define-style macros. Since the scanner searches for such a macro
+** for each identifier, the search is skipped if there are none.
+*/
+static unsigned DefineCount = 0;
+
 
 
 /*****************************************************************************/
@@ -251,8 +273,8 @@ static Macro* NewMacro (const StrBuf* Name, const FilePos* P, unsigned char Styl
     M->ParamCount = 0;
     M->Params     = 0;
     M->TokCount   = 0;
-    M->TokRoot    = 0;
-    M->TokLast    = 0;
+    M->TokSize    = 0;
+    M->Toks       = 0;
     M->DefPos     = *P;
     SB_Init (&M->Name);
     SB_Copy (&M->Name, Name);
@@ -264,6 +286,9 @@ static Macro* NewMacro (const StrBuf* Name, const FilePos* P, unsigned char Styl
 
     /* Insert the macro into the hash table */
     HT_Insert (&MacroTab, &M->Node);
+    if (Style == MAC_STYLE_DEFINE) {
+        ++DefineCount;
+    }
 
     /* Return the new macro struct */
     return M;
@@ -274,7 +299,7 @@ static Macro* NewMacro (const StrBuf* Name, const FilePos* P, unsigned char Styl
 static void FreeMacro (Macro* M)
 /* Free a macro entry which has already been removed from the macro table. */
 {
-    TokNode* T;
+    unsigned I;
 
     /* Free locals */
     FreeIdDescList (M->Locals);
@@ -282,11 +307,11 @@ static void FreeMacro (Macro* M)
     /* Free identifiers of parameters */
     FreeIdDescList (M->Params);
 
-    /* Free the token list for the macro */
-    while ((T = M->TokRoot) != 0) {
-        M->TokRoot = T->Next;
-        FreeTokNode (T);
+    /* Free the tokens of the macro body */
+    for (I = 0; I < M->TokCount; ++I) {
+        SB_Done (&M->Toks[I].SVal);
     }
+    xfree (M->Toks);
 
     /* Free the macro name */
     SB_Done (&M->Name);
@@ -297,28 +322,76 @@ static void FreeMacro (Macro* M)
 
 
 
+static Token* AddToken (Token** Toks, unsigned* Count, unsigned* Size)
+/* Append a copy of the current token to a token array, growing it if needed.
+** Entries beyond Count that were allocated before keep their string buffers,
+** so reusing an array doesn't need any new memory for short tokens.
+*/
+{
+    Token* T;
+
+    if (*Count >= *Size) {
+        unsigned NewSize = (*Size == 0)? 16 : *Size * 2;
+        *Toks = xrealloc (*Toks, NewSize * sizeof (Token));
+        while (*Size < NewSize) {
+            SB_Init (&(*Toks)[*Size].SVal);
+            ++*Size;
+        }
+    }
+    T = *Toks + (*Count)++;
+    CopyToken (T, &CurTok);
+    return T;
+}
+
+
+
+static void SetMacToken (const Token* T)
+/* Set the scanner token from a token of a macro body or parameter */
+{
+    CopyToken (&CurTok, T);
+    SB_Terminate (&CurTok.SVal);
+}
+
+
+
 static MacExp* NewMacExp (Macro* M)
 /* Create a new expansion structure for the given macro */
 {
-    unsigned I;
+    MacExp* E;
 
-    /* Allocate memory */
-    MacExp* E = xmalloc (sizeof (MacExp));
+    /* Take a structure from the pool or allocate a new one */
+    if (FreeMacExps) {
+        E = FreeMacExps;
+        FreeMacExps = E->Next;
+    } else {
+        E = xmalloc (sizeof (MacExp));
+        SB_Init (&E->Final.SVal);
+        E->Params       = 0;
+        E->ParamSize    = 0;
+        E->ParamToks    = 0;
+        E->ParamTokSize = 0;
+    }
+
+    /* We need one entry per parameter plus one for the end of the last */
+    if (E->ParamSize <= M->ParamCount) {
+        E->ParamSize = M->ParamCount + 1;
+        E->Params    = xrealloc (E->Params, E->ParamSize * sizeof (unsigned));
+    }
 
     /* Initialize the data */
+    E->Next             = 0;
     E->M                = M;
     E->IfSP             = GetIfStack ();
-    E->Exp              = M->TokRoot;
-    E->Final            = 0;
+    E->Exp              = 0;
+    E->HasFinal         = 0;
     E->MacExpansions    = ++MacExpansions;      /* One macro expansion more */
     E->LocalStart       = LocalName;
     LocalName          += M->LocalCount;
     E->ParamCount       = 0;
-    E->Params           = xmalloc (M->ParamCount * sizeof (TokNode*));
-    for (I = 0; I < M->ParamCount; ++I) {
-        E->Params[I] = 0;
-    }
+    E->Params[0]        = 0;
+    E->ParamTokCount    = 0;
     E->ParamExp         = 0;
+    E->ParamEnd         = 0;
     E->LI               = 0;
     E->ParamLI          = 0;
     E->ExpandStart      = 1; /* set up detection of first call */
@@ -333,28 +406,14 @@ static MacExp* NewMacExp (Macro* M)
 
 
 static void FreeMacExp (MacExp* E)
-/* Remove and free the current macro expansion */
+/* Remove the current macro expansion and return it to the pool */
 {
-    unsigned I;
-
     /* One macro expansion less */
     --MacExpansions;
 
     /* No longer expanding this macro */
     --E->M->Expansions;
 
-    /* Free the parameter lists */
-    for (I = 0; I < E->ParamCount; ++I) {
-        /* Free one parameter list */
-        TokNode* N = E->Params[I];
-        while (N) {
-            TokNode* P = N->Next;
-            FreeTokNode (N);
-            N = P;
-        }
-    }
-    xfree (E->Params);
-
     /* Free the additional line info */
     if (E->ParamLI) {
         EndLine (E->ParamLI);
@@ -363,13 +422,11 @@ static void FreeMacExp (MacExp* E)
         EndLine (E->LI);
     }
 
-    /* Free the final token if we have one */
-    if (E->Final) {
-        FreeTokNode (E->Final);
-    }
-
-    /* Free the structure itself */
-    xfree (E);
+    /* Put the structure into the pool. The tokens of the parameters are
+    ** kept for the next expansion.
+    */
+    E->Next = FreeMacExps;
+    FreeMacExps = E;
 }
 
 
@@ -404,12 +461,41 @@ static void MacSkipDef (unsigned Style, const FilePos* StartPos)
 
 
 
+static void ResolveLocals (Macro* M)
+/* Mark all identifiers in the macro body that are local symbols, so they
+** don't have to be searched by name on each expansion. The attribute of
+** such a token is the index of the local symbol plus one, all other
+** identifiers get a zero attribute.
+*/
+{
+    unsigned I;
+
+    for (I = 0; I < M->TokCount; ++I) {
+        Token* T = M->Toks + I;
+        if (T->Tok == TOK_IDENT || T->Tok == TOK_LOCAL_IDENT) {
+            unsigned Index = 0;
+            IdDesc* L = M->Locals;
+            T->IVal = 0;
+            while (L) {
+                if (SB_Compare (&T->SVal, &L->Id) == 0) {
+                    T->IVal = Index + 1;
+                    break;
+                }
+                ++Index;
+                L = L->Next;
+            }
+        }
+    }
+}
+
+
+
 void MacDef (unsigned Style)
 /* Parse a macro definition */
 {
     Macro* Existing;
     Macro* M;
-    TokNode* N;
+    Token* T;
     int HaveParams;
 
     /* Remember the current file position */
@@ -585,8 +671,8 @@ void MacDef (unsigned Style)
             continue;
         }
 
-        /* Create a token node for the current token */
-        N = NewTokNode ();
+        /* Add the current token to the macro body */
+        T = AddToken (&M->Toks, &M->TokCount, &M->TokSize);
 
         /* If the token is an identifier, check if it is a local parameter */
         if (CurTok.Tok == TOK_IDENT) {
@@ -596,8 +682,8 @@ void MacDef (unsigned Style)
             while (I) {
                 if (SB_Compare (&I->Id, &CurTok.SVal) == 0) {
                     /* Local param name, replace it */
-                    N->T.Tok  = TOK_MACPARAM;
-                    N->T.IVal = Count;
+                    T->Tok  = TOK_MACPARAM;
+                    T->IVal = Count;
                     break;
                 }
                 ++Count;
@@ -605,17 +691,6 @@ void MacDef (unsigned Style)
             }
         }
 
-        /* Insert the new token in the list */
-        if (M->TokCount == 0) {
-            /* First token */
-            M->TokRoot = M->TokLast = N;
-        } else {
-            /* We have already tokens */
-            M->TokLast->Next = N;
-            M->TokLast = N;
-        }
-        ++M->TokCount;
-
         /* Save if last token was a separator to know if .endmacro is at
         ** the start of a line
         */
@@ -630,6 +705,11 @@ void MacDef (unsigned Style)
         NextTok ();
     }
 
+    /* Resolve the local symbols of the macro */
+    if (M->LocalCount > 0) {
+        ResolveLocals (M);
+    }
+
     /* Reset the Incomplete flag now that parsing is done */
     M->Incomplete = 0;
 
@@ -661,6 +741,9 @@ void MacUndef (const StrBuf* Name, unsigned char Style)
 
     /* Remove the macro from the macro table */
     HT_Remove (&MacroTab, M);
+    if (Style == MAC_STYLE_DEFINE) {
+        --DefineCount;
+    }
 
     /* Free the macro structure */
     FreeMacro (M);
@@ -694,10 +777,10 @@ static int MacExpand (void* Data)
     ** macro parameters.
     */
 ExpandParam:
-    if (Mac->ParamExp) {
+    if (Mac->ParamExp < Mac->ParamEnd) {
 
         /* Ok, use token from parameter list */
-        TokSet (Mac->ParamExp);
+        SetMacToken (Mac->ParamToks + Mac->ParamExp);
 
         /* Create new line info for this parameter token */
         if (Mac->ParamLI) {
@@ -705,8 +788,8 @@ ExpandParam:
         }
         Mac->ParamLI = StartLine (&CurTok.Pos, LI_TYPE_MACPARAM, Mac->MacExpansions);
 
-        /* Set pointer to next token */
-        Mac->ParamExp = Mac->ParamExp->Next;
+        /* Set index of next token */
+        ++Mac->ParamExp;
 
         /* Done */
         return 1;
@@ -724,10 +807,10 @@ ExpandParam:
     /* We're not expanding macro parameters. Check if we have tokens left from
     ** the macro itself.
     */
-    if (Mac->Exp) {
+    if (Mac->Exp < Mac->M->TokCount) {
 
         /* Use next macro token */
-        TokSet (Mac->Exp);
+        SetMacToken (Mac->M->Toks + Mac->Exp);
         if (ExpandMacros && SB_GetLen (&ListingName) > 0) {
             if (new_expand_line) {
                 /* Suppress unneeded lines if short expansion
@@ -741,7 +824,7 @@ ExpandParam:
                     LineCur->Output--;
                 }
                 Mac->ExpandStart = 0;
-                StrBuf mac_line = MakeLineFromTokens (Mac->Exp);
+                StrBuf mac_line = MakeLineFromMacro (Mac->M, Mac->Exp);
                 NewListingLine (&mac_line, 0, 0);
                 InitListingLine ();
                 if (CurTok.Tok == TOK_SEGMENT) {
@@ -761,8 +844,8 @@ ExpandParam:
         }
         Mac->LI = StartLine (&CurTok.Pos, LI_TYPE_MACRO, Mac->MacExpansions);
 
-        /* Set pointer to next token */
-        Mac->Exp = Mac->Exp->Next;
+        /* Set index of next token */
+        ++Mac->Exp;
 
         /* Is it a request for actual parameter count? */
         if (CurTok.Tok == TOK_PARAMCOUNT) {
@@ -774,41 +857,40 @@ ExpandParam:
         /* Is it the name of a macro parameter? */
         if (CurTok.Tok == TOK_MACPARAM) {
 
-            /* Start to expand the parameter token list */
-            Mac->ParamExp = Mac->Params[CurTok.IVal];
+            /* Start to expand the parameter token list. Parameters that
+            ** were not given are empty.
+            */
+            if ((unsigned long) CurTok.IVal < Mac->ParamCount) {
+                Mac->ParamExp = Mac->Params[CurTok.IVal];
+                Mac->ParamEnd = Mac->Params[CurTok.IVal + 1];
+            }
 
             /* Go back and expand the parameter */
             goto ExpandParam;
         }
 
-        /* If it's an identifier, it may in fact be a local symbol */
+        /* If it's an identifier, it may in fact be a local symbol. These
+        ** were marked when the macro was defined.
+        */
         if ((CurTok.Tok == TOK_IDENT || CurTok.Tok == TOK_LOCAL_IDENT) &&
-            Mac->M->LocalCount) {
-            /* Search for the local symbol in the list */
-            unsigned Index = 0;
-            IdDesc* I = Mac->M->Locals;
-            while (I) {
-                if (SB_Compare (&CurTok.SVal, &I->Id) == 0) {
-                    /* This is in fact a local symbol, change the name. Be sure
-                    ** to generate a local label name if the original name was
-                    ** a local label, and also generate a name that cannot be
-                    ** generated by a user.
-                    */
-                    if (SB_At (&I->Id, 0) == LocalStart) {
-                        /* Must generate a local symbol */
-                        SB_Printf (&CurTok.SVal, "%cLOCAL-MACRO_SYMBOL-%04X",
-                                   LocalStart, Mac->LocalStart + Index);
-                    } else {
-                        /* Global symbol */
-                        SB_Printf (&CurTok.SVal, "LOCAL-MACRO_SYMBOL-%04X",
-                                   Mac->LocalStart + Index);
-                    }
-                    break;
-                }
-                /* Next symbol */
-                ++Index;
-                I = I->Next;
+            Mac->M->LocalCount && CurTok.IVal > 0) {
+            /* This is in fact a local symbol, change the name. Be sure to
+            ** generate a local label name if the original name was a local
+            ** label, and also generate a name that cannot be generated by a
+            ** user.
+            */
+            unsigned Index = CurTok.IVal - 1;
+            if (SB_At (&CurTok.SVal, 0) == LocalStart) {
+                /* Must generate a local symbol */
+                SB_Printf (&CurTok.SVal, "%cLOCAL-MACRO_SYMBOL-%04X",
+                           LocalStart, Mac->LocalStart + Index);
+            } else {
+                /* Global symbol */
+                SB_Printf (&CurTok.SVal, "LOCAL-MACRO_SYMBOL-%04X",
+                           Mac->LocalStart + Index);
             }
+            CurTok.Hash = HashBuf (&CurTok.SVal);
+            CurTok.IVal = 0;
 
             /* Done */
             return 1;
@@ -819,12 +901,11 @@ ExpandParam:
     }
 
     /* No more macro tokens. Do we have a final token? */
-    if (Mac->Final) {
+    if (Mac->HasFinal) {
 
         /* Set the final token and remove it */
-        TokSet (Mac->Final);
-        FreeTokNode (Mac->Final);
-        Mac->Final = 0;
+        SetMacToken (&Mac->Final);
+        Mac->HasFinal = 0;
 
         /* Problem: When a .define-style macro is expanded within the call
         ** of a classic one, the latter may be terminated and removed while
@@ -867,7 +948,6 @@ static void StartExpClassic (MacExp* E)
 
         /* Read the actual parameters */
         while (1) {
-            TokNode* Last;
 
             /* Check for maximum parameter count */
             if (E->ParamCount >= E->M->ParamCount) {
@@ -883,9 +963,7 @@ static void StartExpClassic (MacExp* E)
             Term = GetTokListTerm (TOK_COMMA);
 
             /* Read tokens for one parameter, accept empty params */
-            Last = 0;
             while (CurTok.Tok != Term && CurTok.Tok != TOK_SEP) {
-                TokNode* T;
 
                 /* Check for end of file */
                 if (CurTok.Tok == TOK_EOF) {
@@ -894,23 +972,15 @@ static void StartExpClassic (MacExp* E)
                     return;
                 }
 
-                /* Get the next token in a node */
-                T = NewTokNode ();
-
-                /* Insert it into the list */
-                if (Last == 0) {
-                    E->Params [E->ParamCount] = T;
-                } else {
-                    Last->Next = T;
-                }
-                Last = T;
+                /* Add the token to the parameter */
+                AddToken (&E->ParamToks, &E->ParamTokCount, &E->ParamTokSize);
 
                 /* And skip it... */
                 NextTok ();
             }
 
             /* One parameter more */
-            ++E->ParamCount;
+            E->Params[++E->ParamCount] = E->ParamTokCount;
 
             /* If the macro argument was enclosed in curly braces, end-of-line
             ** is an error. Skip the closing curly brace.
@@ -951,7 +1021,6 @@ static void StartExpDefine (MacExp* E)
 
     /* Read the actual parameters */
     while (Count--) {
-        TokNode* Last;
 
         /* The macro argument optionally may be enclosed in curly braces */
         token_t Term = GetTokListTerm (TOK_COMMA);
@@ -964,20 +1033,10 @@ static void StartExpDefine (MacExp* E)
         }
 
         /* Read tokens for one parameter */
-        Last = 0;
         do {
-            TokNode* T;
 
-            /* Get the next token in a node */
-            T = NewTokNode ();
-
-            /* Insert it into the list */
-            if (Last == 0) {
-                E->Params [E->ParamCount] = T;
-            } else {
-                Last->Next = T;
-            }
-            Last = T;
+            /* Add the token to the parameter */
+            AddToken (&E->ParamToks, &E->ParamTokCount, &E->ParamTokSize);
 
             /* And skip it... */
             NextTok ();
@@ -985,7 +1044,7 @@ static void StartExpDefine (MacExp* E)
         } while (CurTok.Tok != Term && !TokIsSep (CurTok.Tok));
 
         /* One parameter more */
-        ++E->ParamCount;
+        E->Params[++E->ParamCount] = E->ParamTokCount;
 
         /* If the macro argument was enclosed in curly braces, end-of-line
         ** is an error. Skip the closing curly brace.
@@ -1011,7 +1070,8 @@ static void StartExpDefine (MacExp* E)
     ** To avoid it, remember the current token and re-insert it, once macro
     ** expansion is done.
     */
-    E->Final = NewTokNode ();
+    CopyToken (&E->Final, &CurTok);
+    E->HasFinal = 1;
 
     /* Insert a new token input function */
     PushInput (MacExpand, E, ".DEFINE");
@@ -1102,8 +1162,8 @@ Macro* FindDefine (const StrBuf* Name)
 {
     Macro* M;
 
-    /* Never if disabled */
-    if (DisableDefines) {
+    /* Never if disabled or if there are none */
+    if (DisableDefines || DefineCount == 0) {
         return 0;
     }
 
@@ -1138,42 +1198,53 @@ void EnableDefineStyleMacros (void)
     PRECONDITION (DisableDefines > 0);
     --DisableDefines;
 }
+static void AppendLineToken (StrBuf* S, Token* token)
+/* Append the text of one token to a reconstituted line */
+{
+    char* token_string;
+    /* leading white space?*/
+    if (token->WS) SB_AppendChar (S, ' ');
+    /* is it a string of some sort?*/
+    unsigned len = SB_GetLen (&token->SVal);
+    if (len > 0) {
+        SB_Append (S, &token->SVal);
+    } else if (token->Tok == TOK_INTCON) {
+        char ival[12]; // max size a long can be
+        snprintf (ival, sizeof(ival), "%ld", token->IVal);
+        SB_AppendStr (S, ival);
+    } else if ((token_string = GetTokenString (token)) != NULL)   {
+        SB_AppendStr (S, token_string);
+    }
+}
+
+
+
+static void AppendLineDepth (StrBuf* S)
+/* Prepend the depth indicator to a reconstituted line */
+{
+    unsigned I;
+    for (I = 0; I < GetStackDepth (); I++) {
+        SB_AppendStr (S, ">");
+    }
+    SB_AppendStr (S, " ");
+}
+
+
+
 StrBuf MakeLineFromTokens (TokNode* first)
 {
     /* This code reconstitutes a Macro line from the 'compiled' tokens*/
-    unsigned I;
     /* string to be returned */
     StrBuf S = STATIC_STRBUF_INITIALIZER;
 
-
     /* prepend depth indicator */
-    for (I = 0; I < GetStackDepth (); I++) {
-        SB_AppendStr (&S, ">");
-    }
-    SB_AppendStr (&S, " ");
+    AppendLineDepth (&S);
 
     TokNode* tn = first;
     while (tn) {
-        /* per token string */
-        StrBuf T = STATIC_STRBUF_INITIALIZER;
-
         Token* token = &tn->T;
         tn = tn->Next;
-        char* token_string;
-        /* leading white space?*/
-        if (token->WS) SB_AppendChar (&T, ' ');
-        /* is it a string of some sort?*/
-        unsigned len = SB_GetLen (&token->SVal);
-        if (len > 0) {
-            SB_Append (&T, &token->SVal);
-        } else if (token->Tok == TOK_INTCON) {
-            char ival[12]; // max size a long can be
-            snprintf (ival, sizeof(ival), "%ld", token->IVal);
-            SB_AppendStr (&T, ival);
-        } else if ((token_string = GetTokenString (token)) != NULL)   {
-            SB_AppendStr (&T, token_string);
-        }
-        SB_Append (&S, &T);
+        AppendLineToken (&S, token);
         if (token->Tok == TOK_SEP) {
             return S;
         }
@@ -1181,6 +1252,29 @@ StrBuf MakeLineFromTokens (TokNode* first)
     return S;
 }
 
+
+
+static StrBuf MakeLineFromMacro (Macro* M, unsigned Index)
+/* Reconstitute a line of a macro body starting with the token at Index */
+{
+    /* string to be returned */
+    StrBuf S = STATIC_STRBUF_INITIALIZER;
+
+    /* prepend depth indicator */
+    AppendLineDepth (&S);
+
+    while (Index < M->TokCount) {
+        Token* token = M->Toks + Index++;
+        AppendLineToken (&S, token);
+        if (token->Tok == TOK_SEP) {
+            break;
+        }
+    }
+    return S;
+}
+
+
+
 static char* GetTokenString (Token* T)
 {
     switch (T->Tok) {
@@ -1228,3 +1322,25 @@ static char* GetTokenString (Token* T)
         default: return NULL;
     }
 }
+
+
+
+static int DeleteMacro (void* Entry, void* Data attribute ((unused)))
+/* Helper function for MacReset: Free a macro and remove it from the table */
+{
+    FreeMacro (Entry);
+    return 1;
+}
+
+
+
+void MacReset (void)
+/* Remove all macros, so another file can be assembled */
+{
+    HT_Walk (&MacroTab, DeleteMacro, 0);
+    MacExpansions  = 0;
+    DoMacAbort     = 0;
+    LocalName      = 0;
+    DisableDefines = 0;
+    DefineCount    = 0;
+}
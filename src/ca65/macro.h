@@ -107,6 +107,11 @@ void EnableDefineStyleMacros (void);
 
 StrBuf MakeLineFromTokens (TokNode* first);
 
+void MacReset (void);
+/* Remove all macros, so another file can be assembled */
+
+
+
 /* End of macro.h */
 
 #endif
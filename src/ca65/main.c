@@ -43,7 +43,9 @@
 #include "chartype.h"
 #include "cmdline.h"
 #include "consprop.h"
+#include "cpu.h"
 #include "debugflag.h"
+#include "hashfunc.h"
 #include "mmodel.h"
 #include "print.h"
 #include "scopedefs.h"
@@ -51,10 +53,13 @@
 #include "target.h"
 #include "tgttrans.h"
 #include "version.h"
+#include "xmalloc.h"
 
 /* ca65 */
 #include "abend.h"
+#include "anonname.h"
 #include "asserts.h"
+#include "condasm.h"
 #include "dbginfo.h"
 #include "error.h"
 #include "expect.h"
@@ -65,6 +70,7 @@
 #include "incpath.h"
 #include "instr.h"
 #include "istack.h"
+#include "jobs.h"
 #include "lineinfo.h"
 #include "listing.h"
 #include "macro.h"
@@ -72,17 +78,46 @@
 #include "objfile.h"
 #include "options.h"
 #include "pseudo.h"
+#include "relax.h"
 #include "scanner.h"
 #include "segment.h"
 #include "sizeof.h"
 #include "span.h"
 #include "spool.h"
+#include "studyexpr.h"
 #include "symbol.h"
 #include "symtab.h"
+#include "toklist.h"
 #include "ulabel.h"
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A symbol defined before the first input file is assembled */
+typedef struct PredefSym PredefSym;
+struct PredefSym {
+    long        Val;            /* Value of the symbol */
+    char        Name[1];        /* Name of the symbol, dynamically allocated */
+};
+
+/* Symbols from the command line and the CPU symbols. When several input
+** files are assembled in one process, they're defined again for each file.
+*/
+static Collection PredefSyms = STATIC_COLLECTION_INITIALIZER;
+
+/* The CPU set on the command line */
+static cpu_t CmdLineCPU = CPU_UNKNOWN;
+
+/* Name of the global name space */
+static const StrBuf GlobalNameSpace = STATIC_STRBUF_INITIALIZER;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -92,7 +127,7 @@
 static void Usage (void)
 /* Print usage information and exit */
 {
-    printf ("Usage: %s [options] file\n"
+    printf ("Usage: %s [options] file ...\n"
             "Short options:\n"
             "  -D name[=value]\t\tDefine a symbol\n"
             "  -I dir\t\t\tSet an include directory search path\n"
@@ -103,6 +138,7 @@ static void Usage (void)
             "  -g\t\t\t\tAdd debug info to object file\n"
             "  -h\t\t\t\tHelp (this text)\n"
             "  -i\t\t\t\tIgnore case of symbols\n"
+            "  -j n\t\t\t\tAssemble up to n files in parallel\n"
             "  -l name\t\t\tCreate a listing file if assembly was ok\n"
             "  -mm model\t\t\tSet the memory model\n"
             "  -o name\t\t\tName the output file\n"
@@ -126,15 +162,18 @@ static void Usage (void)
             "  --help\t\t\tHelp (this text)\n"
             "  --ignore-case\t\t\tIgnore case of symbols\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
+            "  --jobs n\t\t\tAssemble up to n files in parallel\n"
             "  --large-alignment\t\tDon't warn about large alignments\n"
             "  --listing name\t\tCreate a listing file if assembly was ok\n"
             "  --list-bytes n\t\tMaximum number of bytes per listing line\n"
             "  --memory-model model\t\tSet the memory model\n"
             "  --no-utf8\t\t\tDisable use of UTF-8 in diagnostics\n"
             "  --pagelength n\t\tSet the page length for the listing\n"
+            "  --proc-sections\t\tPut each .proc into its own section\n"
             "  --relax-checks\t\tRelax some checks (see docs)\n"
             "  --segment-list\t\tEnable segment offset listing\n"
             "  --smart\t\t\tEnable smart mode\n"
+            "  --stream-listing\t\tWrite the listing while assembling\n"
             "  --target sys\t\t\tSet the target system\n"
             "  --verbose\t\t\tIncrease verbosity\n"
             "  --version\t\t\tPrint the assembler version\n"
@@ -163,7 +202,7 @@ static void SetOptions (void)
 
 
 
-static void NewSymbol (const char* SymName, long Val)
+static void DefineNumSymbol (const char* SymName, long Val)
 /* Define a symbol with a fixed numeric value in the current scope */
 {
     ExprNode* Expr;
@@ -174,7 +213,7 @@ static void NewSymbol (const char* SymName, long Val)
     SB_CopyStr (&SymBuf, SymName);
 
     /* Search for the symbol, allocate a new one if it doesn't exist */
-    Sym = SymFind (CurrentScope, &SymBuf, SYM_ALLOC_NEW);
+    Sym = SymFind (CurrentScope, &SymBuf, HashBuf (&SymBuf), SYM_ALLOC_NEW);
 
     /* Check if have already a symbol with this name */
     if (SymIsDef (Sym)) {
@@ -193,6 +232,21 @@ static void NewSymbol (const char* SymName, long Val)
 
 
 
+static void NewSymbol (const char* SymName, long Val)
+/* Define a symbol with a fixed numeric value in the current scope, and
+** remember it, so it can be defined again for the next input file.
+*/
+{
+    PredefSym* S = xmalloc (sizeof (PredefSym) + strlen (SymName));
+    S->Val = Val;
+    strcpy (S->Name, SymName);
+    CollAppend (&PredefSyms, S);
+
+    DefineNumSymbol (SymName, Val);
+}
+
+
+
 static void CBMSystem (const char* Sys)
 /* Define a CBM system */
 {
@@ -412,6 +466,11 @@ static void SetSys (const char* Sys)
 
     }
 
+    /* Tell assembler code where the zero page argument block lives */
+    if (GetTargetProperties (Target)->ZPArgs) {
+        NewSymbol ("__ZPARGS_ZP__", 1);
+    }
+
     /* Initialize the translation tables for the target system */
     TgtTranslateInit ();
 }
@@ -604,6 +663,23 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptJobs (const char* Opt, const char* Arg)
+/* Set the number of files that are assembled in parallel */
+{
+    unsigned Num;
+    char     Check;
+
+    /* Convert the argument to a number */
+    if (sscanf (Arg, "%u%c", &Num, &Check) != 1 || Num == 0) {
+        InvArg (Opt, Arg);
+    }
+
+    /* Use the value */
+    MaxJobs = Num;
+}
+
+
+
 static void OptLargeAlignment (const char* Opt attribute ((unused)),
                                const char* Arg attribute ((unused)))
 /* Don't warn about large alignments */
@@ -697,6 +773,15 @@ static void OptPageLength (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptProcSections (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Handle the --proc-sections option */
+{
+    ProcSections = 1;
+}
+
+
+
 static void OptRelaxChecks (const char* Opt attribute ((unused)),
                             const char* Arg attribute ((unused)))
 /* Handle the --relax-checks options */
@@ -715,6 +800,15 @@ static void OptSmart (const char* Opt attribute ((unused)),
 
 
 
+static void OptStreamListing (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Handle the --stream-listing option */
+{
+    StreamListing = 1;
+}
+
+
+
 static void OptTarget (const char* Opt attribute ((unused)), const char* Arg)
 /* Set the target system */
 {
@@ -800,6 +894,7 @@ static void OneLine (void)
 {
     Segment*      Seg   = 0;
     unsigned long PC    = 0;
+    int           Mark  = -1;
     SymEntry*     Sym   = 0;
     Macro*        Mac   = 0;
     int           Instr = -1;
@@ -909,8 +1004,9 @@ static void OneLine (void)
             /* A label. Remember the current segment, so we can later
             ** determine the size of the data stored under the label.
             */
-            Seg = ActiveSeg;
-            PC  = GetPC ();
+            Seg  = ActiveSeg;
+            PC   = GetPC ();
+            Mark = GetRelaxMark ();
 
             /* Skip the colon. If NoColonLabels is enabled, allow labels
             ** without a colon if there is no whitespace before the
@@ -985,13 +1081,13 @@ static void OneLine (void)
     ** come here.
     */
     if (Sym) {
-        unsigned long Size;
+        ExprNode* Size;
         if (Seg == ActiveSeg) {
-            /* Same segment */
-            Size = GetPC () - PC;
+            /* Same segment. Account for relaxed instructions in between */
+            Size = GenRelaxedSizeExpr (GetPC () - PC, Mark, GetRelaxMark ());
         } else {
             /* The line has switched the segment */
-            Size = 0;
+            Size = GenLiteralExpr (0);
         }
         /* Suppress .size Symbol if this Symbol already has a multiply-defined error,
         ** as it will only create its own additional unnecessary error.
@@ -1068,6 +1164,149 @@ static void CreateObjFile (void)
 
 
 
+static void ResetAssembler (void)
+/* Reset the assembler to the state after the command line was processed, so
+** another input file can be assembled. Data that doesn't depend on the input
+** file, like the search paths, the keyword indices and the contents of
+** include files, is kept.
+*/
+{
+    unsigned I;
+
+    /* Remove everything created for the last file */
+    ResetAnonNames ();
+    ResetAssertions ();
+    ResetConditionals ();
+    ResetDbgInfo ();
+    ResetFileTab ();
+    ResetLineInfo ();
+    ResetOptions ();
+    ResetPseudo ();
+    ResetSpans ();
+    ResetTokLists ();
+    MacReset ();
+    RelaxReset ();
+    SegReset ();
+    SymReset ();
+    ThawSymbols ();
+    ULabReset ();
+    FreeStringPool (StrPool);
+    ErrorCount   = 0;
+    WarningCount = 0;
+    OutFile      = 0;
+
+    /* Restore the options that may have been changed by directives */
+    RestoreGlobals ();
+    SetCPU (CmdLineCPU);
+
+    /* Create the initial state in the same order as main () */
+    InitStrPool ();
+    SegInit ();
+    SymEnterLevel (&GlobalNameSpace, SCOPE_FILE, ADDR_SIZE_DEFAULT, 0);
+    InitLineInfo ();
+    for (I = 0; I < CollCount (&PredefSyms); ++I) {
+        const PredefSym* S = CollConstAt (&PredefSyms, I);
+        DefineNumSymbol (S->Name, S->Val);
+    }
+}
+
+
+
+static int AssembleFile (const char* Name)
+/* Assemble one input file and create the output files. Return true if there
+** were no errors.
+*/
+{
+    /* The first file starts with the state after the command line was
+    ** processed. For later ones, this state must be restored.
+    */
+    static int First = 1;
+    if (First) {
+        First = 0;
+    } else {
+        ResetAssembler ();
+    }
+    InFile = Name;
+
+    /* Initialize the scanner, open the input file */
+    InitScanner (InFile);
+
+    /* Define the default options */
+    SetOptions ();
+
+    /* Assemble the input */
+    Assemble ();
+
+    /* If we didn't have any errors, check the pseudo insn stacks */
+    if (ErrorCount == 0) {
+        CheckPseudo ();
+    }
+
+    /* If we didn't have any errors, check and cleanup the unnamed labels */
+    if (ErrorCount == 0) {
+        ULabDone ();
+    }
+
+    /* If we didn't have any errors, check the symbol table */
+    if (ErrorCount == 0) {
+        SymCheck ();
+    }
+
+    /* If we didn't have any errors, check the hll debug symbols */
+    if (ErrorCount == 0) {
+        DbgInfoCheck ();
+    }
+
+    /* If we didn't have any errors, close the file scope lexical level */
+    if (ErrorCount == 0) {
+        SymLeaveLevel ();
+    }
+
+    /* If we didn't have any errors, check and resolve the segment data */
+    if (ErrorCount == 0) {
+        SegDone ();
+    }
+
+    /* If we didn't have any errors, check the assertions */
+    if (ErrorCount == 0) {
+        CheckAssertions ();
+    }
+
+    /* Dump the data */
+    if (Verbosity >= 2) {
+        SymDump (stdout);
+        SegDump ();
+    }
+
+    if (WarningCount > 0 && WarningsAsErrors) {
+        Error ("Warnings as errors");
+    }
+
+    /* If we didn't have an errors, finish off the line infos */
+    DoneLineInfo ();
+
+    /* If we didn't have any errors, create the object, listing and
+    ** dependency files
+    */
+    if (ErrorCount == 0) {
+        CreateObjFile ();
+        if (SB_GetLen (&ListingName) > 0) {
+            CreateListing ();
+        }
+       CreateDependencies ();
+    } else {
+        RemoveListing ();
+    }
+
+    /* Close the input file */
+    DoneScanner ();
+
+    /* Return true if there were no errors */
+    return (ErrorCount == 0);
+}
+
+
+
 int main (int argc, char* argv [])
 /* Assembler main program */
 {
@@ -1086,15 +1325,18 @@ int main (int argc, char* argv [])
         { "--help",                0,      OptHelp                 },
         { "--ignore-case",         0,      OptIgnoreCase           },
         { "--include-dir",         1,      OptIncludeDir           },
+        { "--jobs",                1,      OptJobs                 },
         { "--large-alignment",     0,      OptLargeAlignment       },
         { "--list-bytes",          1,      OptListBytes            },
         { "--listing",             1,      OptListing              },
         { "--memory-model",        1,      OptMemoryModel          },
         { "--no-utf8",             0,      OptNoUtf8               },
         { "--pagelength",          1,      OptPageLength           },
+        { "--proc-sections",       0,      OptProcSections         },
         { "--relax-checks",        0,      OptRelaxChecks          },
         { "--segment-list",        0,      OptSeglist              },
         { "--smart",               0,      OptSmart                },
+        { "--stream-listing",      0,      OptStreamListing        },
         { "--target",              1,      OptTarget               },
         { "--verbose",             0,      OptVerbose              },
         { "--version",             0,      OptVersion              },
@@ -1102,8 +1344,8 @@ int main (int argc, char* argv [])
         { "--warnings-as-errors",  0,      OptWarningsAsErrors     },
     };
 
-    /* Name of the global name space */
-    static const StrBuf GlobalNameSpace = STATIC_STRBUF_INITIALIZER;
+    /* Input files */
+    Collection InFiles = STATIC_COLLECTION_INITIALIZER;
 
     unsigned I;
 
@@ -1163,6 +1405,10 @@ int main (int argc, char* argv [])
                     OptIgnoreCase (Arg, 0);
                     break;
 
+                case 'j':
+                    OptJobs (Arg, GetArg (&I, 2));
+                    break;
+
                 case 'l':
                     OptListing (Arg, GetArg (&I, 2));
                     break;
@@ -1225,14 +1471,8 @@ int main (int argc, char* argv [])
 
             }
         } else {
-            /* Filename. Check if we already had one */
-            if (InFile) {
-                fprintf (stderr, "%s: Don't know what to do with '%s'\n",
-                         ProgName, Arg);
-                exit (EXIT_FAILURE);
-            } else {
-                InFile = Arg;
-            }
+            /* Filename */
+            CollAppend (&InFiles, (void*) Arg);
         }
 
         /* Next argument */
@@ -1240,11 +1480,23 @@ int main (int argc, char* argv [])
     }
 
     /* Do we have an input file? */
-    if (InFile == 0) {
+    if (CollCount (&InFiles) == 0) {
         fprintf (stderr, "%s: No input files\n", ProgName);
         exit (EXIT_FAILURE);
     }
 
+    /* With several input files, the names of the output files are derived
+    ** from the names of the input files.
+    */
+    if (CollCount (&InFiles) > 1) {
+        if (OutFile || SB_GetLen (&ListingName) > 0 ||
+            SB_GetLen (&DepName) > 0 || SB_GetLen (&FullDepName) > 0) {
+            fprintf (stderr, "%s: Cannot name output files for more than one "
+                     "input file\n", ProgName);
+            exit (EXIT_FAILURE);
+        }
+    }
+
     /* Add the default include search paths. */
     FinishIncludePaths ();
 
@@ -1268,77 +1520,14 @@ int main (int argc, char* argv [])
     /* Set the default segment sizes according to the memory model */
     SetSegmentSizes ();
 
-    /* Initialize the scanner, open the input file */
-    InitScanner (InFile);
-
-    /* Define the default options */
-    SetOptions ();
-
-    /* Assemble the input */
-    Assemble ();
-
-    /* If we didn't have any errors, check the pseudo insn stacks */
-    if (ErrorCount == 0) {
-        CheckPseudo ();
-    }
-
-    /* If we didn't have any errors, check and cleanup the unnamed labels */
-    if (ErrorCount == 0) {
-        ULabDone ();
-    }
-
-    /* If we didn't have any errors, check the symbol table */
-    if (ErrorCount == 0) {
-        SymCheck ();
-    }
-
-    /* If we didn't have any errors, check the hll debug symbols */
-    if (ErrorCount == 0) {
-        DbgInfoCheck ();
-    }
-
-    /* If we didn't have any errors, close the file scope lexical level */
-    if (ErrorCount == 0) {
-        SymLeaveLevel ();
-    }
-
-    /* If we didn't have any errors, check and resolve the segment data */
-    if (ErrorCount == 0) {
-        SegDone ();
-    }
-
-    /* If we didn't have any errors, check the assertions */
-    if (ErrorCount == 0) {
-        CheckAssertions ();
-    }
-
-    /* Dump the data */
-    if (Verbosity >= 2) {
-        SymDump (stdout);
-        SegDump ();
-    }
-
-    if (WarningCount > 0 && WarningsAsErrors) {
-        Error ("Warnings as errors");
-    }
-
-    /* If we didn't have an errors, finish off the line infos */
-    DoneLineInfo ();
-
-    /* If we didn't have any errors, create the object, listing and
-    ** dependency files
+    /* Remember the state after the command line was processed, so it can be
+    ** restored for each input file.
     */
-    if (ErrorCount == 0) {
-        CreateObjFile ();
-        if (SB_GetLen (&ListingName) > 0) {
-            CreateListing ();
-        }
-       CreateDependencies ();
-    }
-
-    /* Close the input file */
-    DoneScanner ();
+    SaveGlobals ();
+    CmdLineCPU = GetCPU ();
 
-    /* Return an apropriate exit code */
-    return (ErrorCount == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+    /* Assemble the input files. With several ones, they may be assembled in
+    ** parallel jobs.
+    */
+    return RunJobs (&InFiles, MaxJobs, AssembleFile)? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -39,6 +39,7 @@
 /* common */
 #include "chartype.h"
 #include "check.h"
+#include "hashfunc.h"
 #include "strbuf.h"
 
 /* ca65 */
@@ -259,6 +260,7 @@ static void FuncIdent (void)
         CurTok.Tok = Id;
         SB_Copy (&CurTok.SVal, &Buf);
         SB_Terminate (&CurTok.SVal);
+        CurTok.Hash = HashBuf (&CurTok.SVal);
     }
 
     /* Free buffer memory */
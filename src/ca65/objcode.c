@@ -53,8 +53,7 @@
 void Emit0 (unsigned char OPC)
 /* Emit an instruction with a zero sized operand */
 {
-    Fragment* F = GenFragment (FRAG_LITERAL, 1);
-    F->V.Data[0] = OPC;
+    GenLiteral (&OPC, 1);
 }
 
 
@@ -64,6 +63,7 @@ void Emit1 (unsigned char OPC, ExprNode* Value)
 {
     long V;
     Fragment* F;
+    unsigned char Data[2];
 
     if (IsEasyConst (Value, &V)) {
 
@@ -72,10 +72,10 @@ void Emit1 (unsigned char OPC, ExprNode* Value)
             Error ("Range error (%ld not in [0..255])", V);
         }
 
-        /* Create a literal fragment */
-        F = GenFragment (FRAG_LITERAL, 2);
-        F->V.Data[0] = OPC;
-        F->V.Data[1] = (unsigned char) V;
+        /* Emit literal data */
+        Data[0] = OPC;
+        Data[1] = (unsigned char) V;
+        GenLiteral (Data, sizeof (Data));
         FreeExpr (Value);
 
     } else {
@@ -96,6 +96,7 @@ void Emit2 (unsigned char OPC, ExprNode* Value)
 {
     long V;
     Fragment* F;
+    unsigned char Data[3];
 
     if (IsEasyConst (Value, &V)) {
 
@@ -104,11 +105,11 @@ void Emit2 (unsigned char OPC, ExprNode* Value)
             Error ("Range error (%ld not in [0..65535])", V);
         }
 
-        /* Create a literal fragment */
-        F = GenFragment (FRAG_LITERAL, 3);
-        F->V.Data[0] = OPC;
-        F->V.Data[1] = (unsigned char) V;
-        F->V.Data[2] = (unsigned char) (V >> 8);
+        /* Emit literal data */
+        Data[0] = OPC;
+        Data[1] = (unsigned char) V;
+        Data[2] = (unsigned char) (V >> 8);
+        GenLiteral (Data, sizeof (Data));
         FreeExpr (Value);
 
     } else {
@@ -154,30 +155,17 @@ void EmitPCRel (unsigned char OPC, ExprNode* Expr, unsigned Size)
 void EmitData (const void* D, unsigned Size)
 /* Emit data into the current segment */
 {
-    /* Make a useful pointer from Data */
-    const unsigned char* Data = D;
-
-    /* Create lots of fragments for the data */
-    while (Size) {
-        Fragment* F;
-
-        /* Determine the length of the next fragment */
-        unsigned Len = Size;
-        if (Len > sizeof (F->V.Data)) {
-            Len = sizeof (F->V.Data);
-        }
-
-        /* Create a new fragment */
-        F = GenFragment (FRAG_LITERAL, Len);
+    GenLiteral (D, Size);
+}
 
-        /* Copy the data */
-        memcpy (F->V.Data, Data, Len);
 
-        /* Next chunk */
-        Data += Len;
-        Size -= Len;
 
-    }
+void EmitSharedData (const void* D, unsigned long Size)
+/* Emit data into the current segment without copying it. The data must stay
+** valid until the object file is written.
+*/
+{
+    GenSharedLiteral (D, Size);
 }
 
 
@@ -196,6 +184,7 @@ void EmitByte (ExprNode* Expr)
 {
     long V;
     Fragment* F;
+    unsigned char Data;
 
     if (IsEasyConst (Expr, &V)) {
         /* Must be in byte range */
@@ -203,9 +192,9 @@ void EmitByte (ExprNode* Expr)
             Error ("Range error (%ld not in [0..255])", V);
         }
 
-        /* Create a literal fragment */
-        F = GenFragment (FRAG_LITERAL, 1);
-        F->V.Data[0] = (unsigned char) V;
+        /* Emit literal data */
+        Data = (unsigned char) V;
+        GenLiteral (&Data, 1);
         FreeExpr (Expr);
     } else {
         /* Emit the argument as an expression */
@@ -221,6 +210,7 @@ void EmitWord (ExprNode* Expr)
 {
     long V;
     Fragment* F;
+    unsigned char Data[2];
 
     if (IsEasyConst (Expr, &V)) {
         /* Must be in byte range */
@@ -228,14 +218,14 @@ void EmitWord (ExprNode* Expr)
             Error ("Range error (%ld not in [0..65535])", V);
         }
 
-        /* Create a literal fragment */
-        F = GenFragment (FRAG_LITERAL, 2);
-        F->V.Data[0] = (unsigned char) V;
-        F->V.Data[1] = (unsigned char) (V >> 8);
+        /* Emit literal data */
+        Data[0] = (unsigned char) V;
+        Data[1] = (unsigned char) (V >> 8);
+        GenLiteral (Data, sizeof (Data));
         FreeExpr (Expr);
     } else {
         /* Emit the argument as an expression */
-        Fragment* F = GenFragment (FRAG_EXPR, 2);
+        F = GenFragment (FRAG_EXPR, 2);
         F->V.Expr = Expr;
     }
 }
@@ -71,6 +71,11 @@ void EmitPCRel (unsigned char OPC, ExprNode* Expr, unsigned Size);
 void EmitData (const void* Data, unsigned Size);
 /* Emit data into the current segment */
 
+void EmitSharedData (const void* Data, unsigned long Size);
+/* Emit data into the current segment without copying it. The data must stay
+** valid until the object file is written.
+*/
+
 void EmitStrBuf (const StrBuf* Data);
 /* Emit a string into the current segment */
 
@@ -190,6 +190,8 @@ void ObjClose (void)
     /* If we have debug infos, set the flag in the header */
     if (DbgSyms) {
         Header.Flags |= OBJ_FLAGS_DBGINFO;
+    } else {
+        Header.Flags &= ~OBJ_FLAGS_DBGINFO;
     }
 
     /* Write the updated header */
@@ -182,4 +182,10 @@ void WriteOptions (void)
 
 
 
-
+void ResetOptions (void)
+/* Remove all options, so another file can be assembled */
+{
+    OptRoot  = 0;
+    OptLast  = 0;
+    OptCount = 0;
+}
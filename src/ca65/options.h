@@ -68,6 +68,9 @@ void OptDateTime (unsigned long DateTime);
 void WriteOptions (void);
 /* Write the options to the object file */
 
+void ResetOptions (void);
+/* Remove all options, so another file can be assembled */
+
 
 
 /* End of options.h */
@@ -45,11 +45,13 @@
 #include "bitops.h"
 #include "cddefs.h"
 #include "coll.h"
-#include "filestat.h"
+#include "filecache.h"
 #include "gentype.h"
+#include "hashfunc.h"
 #include "intstack.h"
 #include "scopedefs.h"
 #include "symdefs.h"
+#include "target.h"
 #include "tgttrans.h"
 #include "xmalloc.h"
 
@@ -226,7 +228,7 @@ static void ExportImport (void (*Func) (SymEntry*, unsigned char, unsigned),
         }
 
         /* Find the symbol table entry, allocate a new one if necessary */
-        Sym = SymFind (CurrentScope, &CurTok.SVal, SYM_ALLOC_NEW);
+        Sym = SymFind (CurrentScope, &CurTok.SVal, CurTok.Hash, SYM_ALLOC_NEW);
 
         /* Skip the name */
         NextTok ();
@@ -278,7 +280,7 @@ static void ConDes (const StrBuf* Name, unsigned Type)
 
 
     /* Find the symbol table entry, allocate a new one if necessary */
-    SymEntry* Sym = SymFind (CurrentScope, Name, SYM_ALLOC_NEW);
+    SymEntry* Sym = SymFind (CurrentScope, Name, HashBuf (Name), SYM_ALLOC_NEW);
 
     /* Optional constructor priority */
     if (CurTok.Tok == TOK_COMMA) {
@@ -328,6 +330,21 @@ static StrBuf* GenArrayType (StrBuf* Type, unsigned SpanSize,
 
 
 
+static int InProc (void)
+/* Return true if the current scope is a named .PROC or within one */
+{
+    const SymTable* S = CurrentScope;
+    while (S) {
+        if (S->Label) {
+            return 1;
+        }
+        S = S->Parent;
+    }
+    return 0;
+}
+
+
+
 /*****************************************************************************/
 /*                             Handler functions                             */
 /*****************************************************************************/
@@ -921,6 +938,11 @@ static void DoEndProc (void)
         ErrorSkip ("No open .PROC");
     } else {
         SymLeaveLevel ();
+
+        /* Code following the outermost .PROC must not be removed with it */
+        if (ProcSections && !InProc ()) {
+            EndSplitSeg ();
+        }
     }
 }
 
@@ -1236,11 +1258,10 @@ static void DoIncBin (void)
 /* Include a binary file */
 {
     StrBuf Name = STATIC_STRBUF_INITIALIZER;
-    struct stat StatBuf;
+    const CachedFile* CF;
     long Start = 0L;
     long Count = -1L;
     long Size;
-    FILE* F;
 
     /* Name must follow */
     if (!ExpectSkip (TOK_STRCON, "Expected a string constant")) {
@@ -1263,13 +1284,15 @@ static void DoIncBin (void)
 
     }
 
-    /* Try to open the file */
-    F = fopen (SB_GetConstBuf (&Name), "rb");
-    if (F == 0) {
+    /* Try to get the file from the file cache, so a file that is included
+    ** more than once is read only once.
+    */
+    CF = GetCachedFile (SB_GetConstBuf (&Name));
+    if (CF == 0) {
 
         /* Search for the file in the binary include directory */
         char* PathName = SearchFile (BinSearchPath, SB_GetConstBuf (&Name));
-        if (PathName == 0 || (F = fopen (PathName, "rb")) == 0) {
+        if (PathName == 0 || (CF = GetCachedFile (PathName)) == 0) {
             /* Not found or cannot open, print an error and bail out */
             ErrorSkip ("Cannot open include file `%m%p': %s", &Name, strerror (errno));
             xfree (PathName);
@@ -1283,25 +1306,9 @@ static void DoIncBin (void)
         xfree (PathName);
     }
 
-    /* Get the size of the file */
-    fseek (F, 0, SEEK_END);
-    Size = ftell (F);
-
-    /* Stat the file and remember the values. There's a race condition here,
-    ** since we cannot use fileno() (non-standard identifier in standard
-    ** header file), and therefore not fstat. When using stat with the
-    ** file name, there's a risk that the file was deleted and recreated
-    ** while it was open. Since mtime and size are only used to check
-    ** if a file has changed in the debugger, we will ignore this problem
-    ** here.
-    */
-    SB_Terminate (&Name);
-    if (FileStat (SB_GetConstBuf (&Name), &StatBuf) != 0) {
-        Fatal ("Cannot stat input file `%m%p': %s", &Name, strerror (errno));
-    }
-
     /* Add the file to the input file table */
-    AddFile (&Name, FT_BINARY, Size, (unsigned long) StatBuf.st_mtime);
+    Size = (long) CF->Size;
+    AddFile (&Name, FT_BINARY, CF->Size, CF->MTime);
 
     /* If a count was not given, calculate it now */
     if (Count < 0) {
@@ -1309,49 +1316,27 @@ static void DoIncBin (void)
         if (Count < 0) {
             /* Nothing to read - flag this as a range error */
             ErrorSkip ("Start offset is larger than file size");
-            goto Done;
+            goto ExitPoint;
         }
     } else {
         /* Count was given, check if it is valid */
         if (Start > Size) {
             ErrorSkip ("Start offset is larger than file size");
-            goto Done;
+            goto ExitPoint;
         } else if (Start + Count > Size) {
             ErrorSkip ("Not enough bytes left in file at offset %ld", Start);
-            goto Done;
+            goto ExitPoint;
         }
     }
-
-    /* Seek to the start position */
-    fseek (F, Start, SEEK_SET);
-
-    /* Read chunks and insert them into the output */
-    while (Count > 0) {
-
-        unsigned char Buf [1024];
-
-        /* Calculate the number of bytes to read */
-        size_t BytesToRead = (Count > (long)sizeof(Buf))? sizeof(Buf) : (size_t) Count;
-
-        /* Read chunk */
-        size_t BytesRead = fread (Buf, 1, BytesToRead, F);
-        if (BytesToRead != BytesRead) {
-            /* Some sort of error */
-            ErrorSkip ("Cannot read from include file `%m%p': %s",
-                       &Name, strerror (errno));
-            break;
-        }
-
-        /* Insert it into the output */
-        EmitData (Buf, BytesRead);
-
-        /* Keep the counters current */
-        Count -= BytesRead;
+    if (Start < 0) {
+        ErrorSkip ("Range error");
+        goto ExitPoint;
     }
 
-Done:
-    /* Close the file, ignore errors since it's r/o */
-    (void) fclose (F);
+    /* Insert the data into the output. It stays in the file cache until the
+    ** object file is written, so it doesn't need to be copied.
+    */
+    EmitSharedData (CF->F->Buf + Start, (unsigned long) Count);
 
 ExitPoint:
     /* Free string memory */
@@ -1690,6 +1675,36 @@ static void DoPopSeg (void)
 
 
 
+static void ProcOptions (void)
+/* Parse the options of a .PROC following the address size. The only one is
+** ZPARGS, which marks the procedure as using the zero page argument block.
+** The block is declared global with the address size the target system
+** places it at, so the procedure may access its parameters as zpargs+N.
+*/
+{
+    static const char* const Keys[] = {
+        "ZPARGS",
+    };
+    static const StrBuf ZPArgs = LIT_STRBUF_INITIALIZER ("zpargs");
+
+    SymEntry* Sym;
+
+    if (CurTok.Tok != TOK_IDENT ||
+        GetSubKey (Keys, sizeof (Keys) / sizeof (Keys [0])) != 0) {
+        ErrorExpect ("Expected ZPARGS");
+        SkipUntilSep ();
+        return;
+    }
+    NextTok ();
+
+    Sym = SymFind (RootScope, &ZPArgs, HashBuf (&ZPArgs), SYM_ALLOC_NEW);
+    SymGlobal (Sym,
+               GetTargetProperties (Target)->ZPArgs? ADDR_SIZE_ZP : ADDR_SIZE_ABS,
+               0);
+}
+
+
+
 static void DoProc (void)
 /* Start a new lexical scope */
 {
@@ -1704,7 +1719,7 @@ static void DoProc (void)
         SB_Copy (&Name, &CurTok.SVal);
 
         /* Search for the symbol, generate a new one if needed */
-        Sym = SymFind (CurrentScope, &Name, SYM_ALLOC_NEW);
+        Sym = SymFind (CurrentScope, &Name, CurTok.Hash, SYM_ALLOC_NEW);
 
         /* Skip the scope name */
         NextTok ();
@@ -1712,6 +1727,20 @@ static void DoProc (void)
         /* Read an optional address size specifier */
         AddrSize = OptionalAddrSize ();
 
+        /* Read optional procedure options */
+        if (CurTok.Tok == TOK_COMMA) {
+            NextTok ();
+            ProcOptions ();
+        }
+
+        /* If requested, put the .PROC into a section of its own, so the
+        ** linker may remove it if it isn't referenced. Nested .PROCs stay
+        ** with the enclosing one.
+        */
+        if (ProcSections && !InProc ()) {
+            SplitSeg ();
+        }
+
         /* Mark the symbol as defined */
         SymDef (Sym, GenCurrentPC (), AddrSize, SF_LABEL);
 
@@ -2314,3 +2343,20 @@ void CheckPseudo (void)
         Warning (1, "Charmap stack is not empty");
     }
 }
+
+
+
+void ResetPseudo (void)
+/* Empty the CPU, segment and charmap stacks, and restore the character
+** translation of the target, so another file can be assembled.
+*/
+{
+    while (!IS_IsEmpty (&CPUStack)) {
+        IS_Drop (&CPUStack);
+    }
+    CollDeleteAll (&SegStack);
+    while (!TgtTranslateStackIsEmpty ()) {
+        TgtTranslatePop ();
+    }
+    TgtTranslateInit ();
+}
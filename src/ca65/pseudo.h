@@ -50,6 +50,11 @@ void HandlePseudo (void);
 void CheckPseudo (void);
 /* Check if the stacks are empty at end of assembly */
 
+void ResetPseudo (void);
+/* Empty the CPU, segment and charmap stacks, and restore the character
+** translation of the target, so another file can be assembled.
+*/
+
 
 
 /* End of pseudo.h */
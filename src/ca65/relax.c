@@ -0,0 +1,653 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.c                                  */
+/*                                                                           */
+/*          Relaxation of branches and addresses for the ca65 assembler      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* If relaxation is enabled, the size of some instructions is left open when
+** they are assembled: Branches may become an inverted branch around a JMP,
+** "JMP abs" may become a BRA, and instructions with a forward referenced
+** operand may use zero page addressing. Such an instruction is assembled with
+** a guessed size and remembered as a relax item.
+**
+** Labels behind relax items get a mark added to their value (an EXPR_RELAX
+** node), which stands for the size changes of all items up to the mark. The
+** value of the mark is unknown while assembling, so expressions depending on
+** it are not constant before the end of assembly. RelaxDone then calculates
+** the layout of each segment repeatedly until no item changes its size, and
+** replaces the items by the final code.
+**
+** Items that need their long form because the operand references imports or
+** other segments are left to the linker, which knows the final addresses. The
+** linker may choose the short form for them, so marks behind such an item
+** also stand for the size changes made by the linker.
+*/
+
+
+
+#include <string.h>
+
+/* common */
+#include "addrsize.h"
+#include "alignment.h"
+#include "check.h"
+#include "coll.h"
+#include "cpu.h"
+#include "xmalloc.h"
+
+/* ca65 */
+#include "expr.h"
+#include "fragment.h"
+#include "relax.h"
+#include "segment.h"
+#include "studyexpr.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Kinds of relax items */
+enum {
+    RELAX_BRANCH,               /* Conditional branch */
+    RELAX_JUMP,                 /* BRA or JMP */
+    RELAX_ADDR,                 /* Zero page or absolute address */
+    RELAX_ALIGN,                /* Alignment */
+};
+
+/* A relaxed instruction or alignment */
+typedef struct RelaxItem RelaxItem;
+struct RelaxItem {
+    unsigned            Mark;           /* Index in ItemList */
+    unsigned char       Kind;           /* Kind of item, see above */
+    unsigned char       OPC;            /* Opcode of the short form */
+    unsigned char       LongOPC;        /* Opcode of the long form */
+    unsigned            InitSize;       /* Size when assembled */
+    unsigned            Size;           /* Current size */
+    unsigned long       Offs;           /* Offset in the segment when assembled */
+    long                Delta;          /* Size change up to this item */
+    unsigned char       Linkable;       /* May be relaxed by the linker */
+    int                 Link;           /* Last item up to this one relaxed by the linker or -1 */
+    unsigned            LinkId;         /* Index of the item in the object file if relaxed by the linker */
+    Fragment*           Code;           /* Fragment holding the opcode */
+    Fragment*           Arg;            /* Fragment holding operand or fill */
+    ExprNode*           Short;          /* Operand of the short form */
+    ExprNode*           Long;           /* Operand of the long form */
+    unsigned long       Alignment;      /* Alignment for RELAX_ALIGN */
+    int                 FillVal;        /* Fill value for RELAX_ALIGN or -1 */
+};
+
+/* All relax items in the order they were created */
+static Collection ItemList = STATIC_COLLECTION_INITIALIZER;
+
+/* The relax items of each segment, indexed by segment number */
+static Collection SegItems = STATIC_COLLECTION_INITIALIZER;
+
+/* True if the final sizes of all items are known */
+static int Resolved = 0;
+
+/* Number of items relaxed by the linker */
+static unsigned LinkCount = 0;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static Collection* GetSegItems (unsigned SegNum)
+/* Return the relax items of a segment or NULL if there are none */
+{
+    if (SegNum < CollCount (&SegItems)) {
+        return CollAtUnchecked (&SegItems, SegNum);
+    }
+    return 0;
+}
+
+
+
+static RelaxItem* NewRelaxItem (unsigned char Kind, unsigned InitSize)
+/* Create a new relax item at the current PC of the active segment */
+{
+    Collection* Items = GetSegItems (ActiveSeg->Num);
+
+    /* Create the item. Instructions start with their short form. */
+    RelaxItem* I = xmalloc (sizeof (RelaxItem));
+    I->Mark      = CollCount (&ItemList);
+    I->Kind      = Kind;
+    I->OPC       = 0;
+    I->LongOPC   = 0;
+    I->InitSize  = InitSize;
+    I->Size      = (Kind == RELAX_ALIGN)? InitSize : 2;
+    I->Offs      = ActiveSeg->PC;
+    I->Delta     = 0;
+    I->Linkable  = (Kind == RELAX_ADDR || Kind == RELAX_JUMP) && LinkerMayRelax ();
+    I->Link      = -1;
+    I->LinkId    = 0;
+    I->Code      = 0;
+    I->Arg       = 0;
+    I->Short     = 0;
+    I->Long      = 0;
+    I->Alignment = 0;
+    I->FillVal   = -1;
+
+    /* Remember it */
+    if (Items == 0) {
+        Items = NewCollection ();
+        CollReplaceExpand (&SegItems, Items, ActiveSeg->Num);
+    }
+    CollAppend (Items, I);
+    CollAppend (&ItemList, I);
+
+    /* Return the new item */
+    return I;
+}
+
+
+
+static void GenItemCode (RelaxItem* I, unsigned char OPC, unsigned short ArgLen)
+/* Emit the fragments for a relaxed instruction as it was assembled */
+{
+    I->Code = GenFragment (FRAG_LITERAL, 1);
+    I->Code->V.Data[0] = OPC;
+    I->Arg = GenFragment (FRAG_EXPR, ArgLen);
+    I->Arg->V.Expr = 0;
+}
+
+
+
+static ExprNode* GenAbsOperand (ExprNode* Expr)
+/* Return the operand for absolute addressing */
+{
+    /* For the 65816, force the address into 16 bit range to allow addressing
+    ** inside a 64K segment.
+    */
+    return (CPU == CPU_65816)? GenNearAddrExpr (Expr) : Expr;
+}
+
+
+
+int LinkerMayRelax (void)
+/* Return true if the linker may relax instructions for the current CPU. This
+** needs a zero page at a fixed address, and jumps that don't depend on the
+** bank.
+*/
+{
+    switch (CPU) {
+        case CPU_6502:
+        case CPU_6502X:
+        case CPU_6502DTV:
+        case CPU_65SC02:
+        case CPU_65C02:
+        case CPU_W65C02:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+
+
+void RelaxBranch (unsigned char OPC, ExprNode* Target)
+/* Emit a branch to Target whose size is chosen at the end of assembly. OPC
+** is either a conditional branch, which becomes an inverted branch around a
+** JMP if the target is out of reach, or BRA, which becomes a JMP.
+*/
+{
+    /* The distance must be calculated before the item is created */
+    ExprNode* Short = GenPCRelExpr (CloneExpr (Target), 2);
+
+    RelaxItem* I = NewRelaxItem ((OPC == 0x80)? RELAX_JUMP : RELAX_BRANCH, 2);
+    I->OPC     = OPC;
+    I->LongOPC = 0x4C;
+    I->Short   = Short;
+    I->Long    = GenAbsOperand (Target);
+    GenItemCode (I, OPC, 1);
+}
+
+
+
+void RelaxJump (ExprNode* Target)
+/* Emit a "JMP abs" that is replaced by a BRA if the target is in reach */
+{
+    /* The distance must be calculated before the item is created */
+    ExprNode* Short = GenPCRelExpr (CloneExpr (Target), 2);
+
+    RelaxItem* I = NewRelaxItem (RELAX_JUMP, 3);
+    I->OPC     = 0x80;
+    I->LongOPC = 0x4C;
+    I->Short   = Short;
+    I->Long    = GenAbsOperand (Target);
+    GenItemCode (I, 0x4C, 2);
+}
+
+
+
+void RelaxAddr (unsigned char ZPOPC, unsigned char AbsOPC, ExprNode* Expr)
+/* Emit an instruction with an address operand whose address size wasn't
+** known when the instruction was assembled. ZPOPC and AbsOPC are the opcodes
+** for zero page and absolute addressing.
+*/
+{
+    RelaxItem* I = NewRelaxItem (RELAX_ADDR, 3);
+    I->OPC     = ZPOPC;
+    I->LongOPC = AbsOPC;
+    I->Short   = CloneExpr (Expr);
+    I->Long    = GenAbsOperand (Expr);
+    GenItemCode (I, AbsOPC, 2);
+}
+
+
+
+int RelaxAlign (unsigned long Alignment, int FillVal, unsigned long Count)
+/* If relaxed instructions were emitted into the active segment, emit an
+** alignment that is recalculated together with their sizes and return true.
+** Otherwise return false and let the caller emit Count fill bytes.
+*/
+{
+    RelaxItem* I;
+
+    if (!GetRelocMode () || GetSegItems (ActiveSeg->Num) == 0) {
+        return 0;
+    }
+
+    I = NewRelaxItem (RELAX_ALIGN, Count);
+    I->Alignment = Alignment;
+    I->FillVal   = FillVal;
+    I->Arg       = GenFragment (FRAG_FILL, Count);
+    return 1;
+}
+
+
+
+int GetRelaxMark (void)
+/* Return a mark for the size changes of all relaxed instructions before the
+** current PC, or -1 if there are none or the segment is in absolute mode.
+*/
+{
+    Collection* Items = GetSegItems (ActiveSeg->Num);
+    if (Items == 0 || !GetRelocMode ()) {
+        return -1;
+    }
+    return ((const RelaxItem*) CollLast (Items))->Mark;
+}
+
+
+
+static const RelaxItem* FindItem (unsigned SegNum, unsigned long Offs)
+/* Return the last relax item of a segment that ends at or before the given
+** offset, or NULL if there is none.
+*/
+{
+    const RelaxItem* Found = 0;
+    Collection* Items = GetSegItems (SegNum);
+
+    if (Items) {
+        /* Items don't overlap, so their end offsets are sorted */
+        int Lo = 0;
+        int Hi = (int) CollCount (Items) - 1;
+        while (Lo <= Hi) {
+            int Cur = (Lo + Hi) / 2;
+            const RelaxItem* I = CollAtUnchecked (Items, Cur);
+            if (I->Offs + I->InitSize <= Offs) {
+                Found = I;
+                Lo = Cur + 1;
+            } else {
+                Hi = Cur - 1;
+            }
+        }
+    }
+    return Found;
+}
+
+
+
+int GetRelaxMarkAt (unsigned SegNum, unsigned long Offs)
+/* Return the mark for the size changes of all relaxed instructions that end
+** at or before the given offset in a segment, or -1 if there are none.
+*/
+{
+    const RelaxItem* I = FindItem (SegNum, Offs);
+    return I? (int) I->Mark : -1;
+}
+
+
+
+int GetRelaxDelta (unsigned Mark, long* Delta)
+/* If the final sizes of the relaxed instructions are known, store the size
+** change for the given mark in Delta and return true. Otherwise return false.
+*/
+{
+    if (!Resolved) {
+        return 0;
+    }
+    *Delta = ((const RelaxItem*) CollAt (&ItemList, Mark))->Delta;
+    return 1;
+}
+
+
+
+int GetRelaxLink (unsigned Mark)
+/* Return the mark of the last instruction up to the given mark that is
+** relaxed by the linker, or -1 if there is none.
+*/
+{
+    return ((const RelaxItem*) CollAt (&ItemList, Mark))->Link;
+}
+
+
+
+unsigned GetRelaxLinkId (unsigned Mark)
+/* Return the index in the object file of an instruction that is relaxed by
+** the linker.
+*/
+{
+    const RelaxItem* I = CollAt (&ItemList, Mark);
+    CHECK (I->Link == (int) Mark);
+    return I->LinkId;
+}
+
+
+
+unsigned long GetRelaxedOffs (unsigned SegNum, unsigned long Offs)
+/* Translate an offset in a segment as it was when assembling into the final
+** offset after relaxation.
+*/
+{
+    const RelaxItem* I = FindItem (SegNum, Offs);
+    return I? Offs + I->Delta : Offs;
+}
+
+
+
+static int InReach (ExprNode* Distance)
+/* Return true if Distance is known and fits into a branch */
+{
+    int Ok;
+    ExprDesc ED;
+    ED_Init (&ED);
+
+    StudyExpr (Distance, &ED);
+    Ok = ED_IsConst (&ED) && ED.Val >= -128 && ED.Val <= 127;
+
+    ED_Done (&ED);
+    return Ok;
+}
+
+
+
+static int IsZPAddr (ExprNode* Expr)
+/* Return true if Expr is a zero page address */
+{
+    int Ok;
+    ExprDesc ED;
+    ED_Init (&ED);
+
+    StudyExpr (Expr, &ED);
+    Ok = (ED.AddrSize == ADDR_SIZE_ZP);
+
+    ED_Done (&ED);
+    return Ok;
+}
+
+
+
+static int LayoutSeg (Collection* Items)
+/* Recalculate the sizes of the relax items of one segment. Instructions are
+** only made larger, so repeating this will terminate. Return true if any size
+** or position has changed.
+*/
+{
+    unsigned J;
+    long     Delta   = 0;
+    int      Changed = 0;
+
+    for (J = 0; J < CollCount (Items); ++J) {
+
+        RelaxItem* I = CollAtUnchecked (Items, J);
+        unsigned Size = I->Size;
+
+        switch (I->Kind) {
+
+            case RELAX_BRANCH:
+                if (Size == 2 && !InReach (I->Short)) {
+                    Size = 5;
+                }
+                break;
+
+            case RELAX_JUMP:
+                if (Size == 2 && !InReach (I->Short)) {
+                    Size = 3;
+                }
+                break;
+
+            case RELAX_ADDR:
+                if (Size == 2 && !IsZPAddr (I->Short)) {
+                    Size = 3;
+                }
+                break;
+
+            case RELAX_ALIGN:
+                Size = AlignCount (I->Offs + Delta, I->Alignment);
+                break;
+
+        }
+
+        /* Update the item and all following positions */
+        Delta += (long) Size - (long) I->InitSize;
+        if (Size != I->Size || Delta != I->Delta) {
+            I->Size  = Size;
+            I->Delta = Delta;
+            Changed  = 1;
+        }
+    }
+
+    return Changed;
+}
+
+
+
+static int IsLinkItem (const RelaxItem* I)
+/* Return true if an item that needs its long form may be relaxed by the
+** linker. This is the case for addresses of imports, and for jumps to imports
+** or other segments.
+*/
+{
+    int Ok;
+    ExprDesc ED;
+
+    if (!I->Linkable || I->Size != 3) {
+        return 0;
+    }
+
+    ED_Init (&ED);
+    StudyExpr (I->Short, &ED);
+    if (ED.Flags != ED_OK) {
+        Ok = 0;
+    } else if (I->Kind == RELAX_ADDR) {
+        Ok = (ED.SymCount > 0);
+    } else {
+        Ok = (ED.SymCount > 0 || ED.SecCount > 0);
+    }
+
+    ED_Done (&ED);
+    return Ok;
+}
+
+
+
+static void SetArg (Fragment* F, unsigned char Type, unsigned short Len, ExprNode* Expr)
+/* Set the final operand of a relaxed instruction */
+{
+    F->Type     = Type;
+    F->Len      = Len;
+    F->V.Expr   = Expr;
+}
+
+
+
+static void FinishItem (RelaxItem* I)
+/* Replace a relax item by the final code */
+{
+    if (I->Kind == RELAX_ALIGN) {
+
+        I->Arg->Len = I->Size;
+        if (I->FillVal != -1) {
+            /* Convert the fill fragment into literal data */
+            unsigned char* Buf = xmalloc (I->Size + 1);
+            memset (Buf, I->FillVal, I->Size);
+            I->Arg->Type = FRAG_LITERAL;
+            I->Arg->Len  = 0;
+            AppendFragData (I->Arg, Buf, I->Size);
+            xfree (Buf);
+        }
+
+    } else if (I->Link == (int) I->Mark) {
+
+        /* The linker chooses the form. The opcode fragment holds the opcodes
+        ** of both forms, and is written together with the operand of the long
+        ** form.
+        */
+        I->Code->Type = FRAG_RELAX;
+        I->Code->V.Data[0] = I->LongOPC;
+        I->Code->V.Data[1] = I->OPC;
+        I->Code->V.Data[2] = (I->Kind == RELAX_ADDR)? FRAG_RELAX_ZP : FRAG_RELAX_BRA;
+        SetArg (I->Arg, FRAG_EXPR, 2, I->Long);
+        FreeExpr (I->Short);
+
+    } else if (I->Size == 2) {
+
+        /* Short form */
+        I->Code->V.Data[0] = I->OPC;
+        SetArg (I->Arg, (I->Kind == RELAX_ADDR)? FRAG_EXPR : FRAG_SEXPR, 1, I->Short);
+        FreeExpr (I->Long);
+
+    } else {
+
+        /* Long form, for a conditional branch that is the inverted branch
+        ** skipping the jump.
+        */
+        if (I->Kind == RELAX_BRANCH) {
+            I->Code->Len = 3;
+            I->Code->V.Data[0] = I->OPC ^ 0x20;
+            I->Code->V.Data[1] = 0x03;
+            I->Code->V.Data[2] = I->LongOPC;
+        } else {
+            I->Code->V.Data[0] = I->LongOPC;
+        }
+        SetArg (I->Arg, FRAG_EXPR, 2, I->Long);
+        FreeExpr (I->Short);
+
+    }
+}
+
+
+
+void RelaxDone (void)
+/* Choose the final form of all relaxed instructions. Must be called before
+** the segment data is checked and written.
+*/
+{
+    unsigned S;
+    unsigned J;
+    int      Changed;
+
+    /* From now on, the marks have a value */
+    Resolved = 1;
+
+    /* Calculate the layout until it doesn't change any longer */
+    do {
+        Changed = 0;
+        for (S = 0; S < CollCount (&SegItems); ++S) {
+            Collection* Items = CollAtUnchecked (&SegItems, S);
+            if (Items && LayoutSeg (Items)) {
+                Changed = 1;
+            }
+        }
+    } while (Changed);
+
+    /* Find the items relaxed by the linker. They are numbered in the order
+    ** they are written to the object file. Alignments are calculated here,
+    ** so only items behind the last alignment of a segment may change their
+    ** size later.
+    */
+    for (S = 0; S < CollCount (&SegItems); ++S) {
+        Collection* Items = CollAtUnchecked (&SegItems, S);
+        if (Items) {
+            int      Link  = -1;
+            unsigned First = 0;
+            for (J = 0; J < CollCount (Items); ++J) {
+                if (((const RelaxItem*) CollAtUnchecked (Items, J))->Kind == RELAX_ALIGN) {
+                    First = J + 1;
+                }
+            }
+            for (J = 0; J < CollCount (Items); ++J) {
+                RelaxItem* I = CollAtUnchecked (Items, J);
+                if (J >= First && IsLinkItem (I)) {
+                    I->LinkId = LinkCount++;
+                    Link = I->Mark;
+                }
+                I->Link = Link;
+            }
+        }
+    }
+
+    /* Generate the final code and adjust the segment sizes */
+    for (S = 0; S < CollCount (&SegItems); ++S) {
+        Collection* Items = CollAtUnchecked (&SegItems, S);
+        if (Items) {
+            Segment* Seg = CollAt (&SegmentList, S);
+            for (J = 0; J < CollCount (Items); ++J) {
+                RelaxItem* I = CollAtUnchecked (Items, J);
+                FinishItem (I);
+                if (I->Link == (int) I->Mark) {
+                    /* The operand is written together with the opcodes */
+                    --Seg->FragCount;
+                }
+            }
+            Seg->PC += ((const RelaxItem*) CollLast (Items))->Delta;
+        }
+    }
+}
+
+
+
+void RelaxReset (void)
+/* Remove all relax items, so another file can be assembled */
+{
+    CollDeleteAll (&ItemList);
+    CollDeleteAll (&SegItems);
+    Resolved  = 0;
+    LinkCount = 0;
+}
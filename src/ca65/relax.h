@@ -0,0 +1,118 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.h                                  */
+/*                                                                           */
+/*          Relaxation of branches and addresses for the ca65 assembler      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef RELAX_H
+#define RELAX_H
+
+
+
+/* common */
+#include "exprdefs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int LinkerMayRelax (void);
+/* Return true if the linker may relax instructions for the current CPU. This
+** needs a zero page at a fixed address, and jumps that don't depend on the
+** bank.
+*/
+
+void RelaxBranch (unsigned char OPC, ExprNode* Target);
+/* Emit a branch to Target whose size is chosen at the end of assembly. OPC
+** is either a conditional branch, which becomes an inverted branch around a
+** JMP if the target is out of reach, or BRA, which becomes a JMP.
+*/
+
+void RelaxJump (ExprNode* Target);
+/* Emit a "JMP abs" that is replaced by a BRA if the target is in reach */
+
+void RelaxAddr (unsigned char ZPOPC, unsigned char AbsOPC, ExprNode* Expr);
+/* Emit an instruction with an address operand whose address size wasn't
+** known when the instruction was assembled. ZPOPC and AbsOPC are the opcodes
+** for zero page and absolute addressing.
+*/
+
+int RelaxAlign (unsigned long Alignment, int FillVal, unsigned long Count);
+/* If relaxed instructions were emitted into the active segment, emit an
+** alignment that is recalculated together with their sizes and return true.
+** Otherwise return false and let the caller emit Count fill bytes.
+*/
+
+int GetRelaxMark (void);
+/* Return a mark for the size changes of all relaxed instructions before the
+** current PC, or -1 if there are none or the segment is in absolute mode.
+*/
+
+int GetRelaxMarkAt (unsigned SegNum, unsigned long Offs);
+/* Return the mark for the size changes of all relaxed instructions that end
+** at or before the given offset in a segment, or -1 if there are none.
+*/
+
+int GetRelaxDelta (unsigned Mark, long* Delta);
+/* If the final sizes of the relaxed instructions are known, store the size
+** change for the given mark in Delta and return true. Otherwise return false.
+*/
+
+int GetRelaxLink (unsigned Mark);
+/* Return the mark of the last instruction up to the given mark that is
+** relaxed by the linker, or -1 if there is none.
+*/
+
+unsigned GetRelaxLinkId (unsigned Mark);
+/* Return the index in the object file of an instruction that is relaxed by
+** the linker.
+*/
+
+unsigned long GetRelaxedOffs (unsigned SegNum, unsigned long Offs);
+/* Translate an offset in a segment as it was when assembling into the final
+** offset after relaxation.
+*/
+
+void RelaxDone (void);
+/* Choose the final form of all relaxed instructions. Must be called before
+** the segment data is checked and written.
+*/
+
+void RelaxReset (void);
+/* Remove all relax items, so another file can be assembled */
+
+
+
+/* End of relax.h */
+
+#endif
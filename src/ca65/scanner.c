@@ -44,8 +44,10 @@
 #include "attrib.h"
 #include "chartype.h"
 #include "check.h"
-#include "filestat.h"
+#include "filecache.h"
 #include "fname.h"
+#include "hashfunc.h"
+#include "srcfile.h"
 #include "tgttrans.h"
 #include "xmalloc.h"
 
@@ -77,7 +79,7 @@ Token CurTok = STATIC_TOKEN_INITIALIZER;
 /* Struct to handle include files. */
 typedef struct InputFile InputFile;
 struct InputFile {
-    FILE*           F;                  /* Input file descriptor */
+    SrcFile*        F;                  /* Input file */
     FilePos         Pos;                /* Position in file */
     token_t         Tok;                /* Last token */
     int             C;                  /* Last character */
@@ -114,7 +116,6 @@ struct CharSource {
     CharSource*                 Next;   /* Linked list of char sources */
     token_t                     Tok;    /* Last token */
     int                         C;      /* Last character */
-    int                         SkipN;  /* For '\r\n' line endings, skip '\n\ if next */
     InputStack                  IStack; /* Saved input stack */
     const CharSourceFunctions*  Func;   /* Pointer to function table */
     union {
@@ -132,9 +133,9 @@ static int         C            = 0;    /* Current input character */
 int               ForcedEnd     = 0;
 
 /* List of dot keywords with the corresponding tokens */
-/* CAUTION: table must be sorted for bsearch */
+/* CAUTION: table must be sorted */
 struct DotKeyword {
-    const char* Key;                    /* MUST be first field */
+    const char* Key;
     token_t     Tok;
 } DotKeywords [] = {
 /* BEGIN SORTED.SH */
@@ -328,6 +329,12 @@ struct DotKeyword {
 /* END SORTED.SH */
 };
 
+/* Hash index for the dot keywords. The slots contain the index of the
+** keyword plus one, or zero for an empty slot.
+*/
+#define DOT_INDEX_SIZE  512             /* Must be a power of two */
+static unsigned short DotIndex[DOT_INDEX_SIZE];
+
 
 
 /*****************************************************************************/
@@ -351,7 +358,6 @@ static void UseCharSource (CharSource* S)
     Source      = S;
 
     /* Read the first character from the new file */
-    S->SkipN    = 0;
     S->Func->NextChar (S);
 
     /* Setup the next token so it will be skipped on the next call to
@@ -419,59 +425,30 @@ static void IFNextChar (CharSource* S)
     /* Check for end of line, read the next line if needed */
     while (SB_GetIndex (&S->V.File.Line) >= SB_GetLen (&S->V.File.Line)) {
 
-        unsigned Len;
-
-        /* End of current line reached, read next line */
-        SB_Clear (&S->V.File.Line);
-        while (1) {
-
-            int N = fgetc (S->V.File.F);
-            if (N == '\n' && S->SkipN) {
-                N = fgetc (S->V.File.F);
-            }
-            S->SkipN = 0;
-
-            if (N == EOF) {
-                /* End of file. Accept files without a newline at the end */
-                if (SB_NotEmpty (&S->V.File.Line)) {
-                    break;
-                }
-
-                /* No more data - add an empty line to the listing. This
-                ** is a small hack needed to keep the PC output in sync.
-                */
-                NewListingLine (&EmptyStrBuf, S->V.File.Pos.Name, FCount);
-                C = EOF;
-                return;
-
-            /* Check for end of line */
-            } else if (N == '\n') {
-                /* End of line */
-                break;
-            } else if (N == '\r') {
-                /* End of line, skip '\n' if it's the next character */
-                S->SkipN = 1;
-                break;
+        unsigned    Len;
+        int         Terminated;
 
-            /* Collect other stuff */
-            } else {
-
-                /* Append data to line */
-                SB_AppendChar (&S->V.File.Line, N);
-
-            }
+        /* End of current line reached, read next line. A line ends with
+        ** CR, LF or CR LF.
+        */
+        const char* L = ReadSrcLine (S->V.File.F, &Len, &Terminated);
+        if (L == 0) {
+            /* No more data - add an empty line to the listing. This
+            ** is a small hack needed to keep the PC output in sync.
+            */
+            NewListingLine (&EmptyStrBuf, S->V.File.Pos.Name, FCount);
+            C = EOF;
+            return;
         }
 
-
-        /* If we come here, we have a new input line. To avoid problems
-        ** with strange line terminators, remove all whitespace from the
-        ** end of the line, then add a single newline.
+        /* To avoid problems with strange line terminators, remove all
+        ** whitespace from the end of the line, then add a single newline.
         */
-        Len = SB_GetLen (&S->V.File.Line);
-        while (Len > 0 && IsSpace (SB_AtUnchecked (&S->V.File.Line, Len-1))) {
+        while (Len > 0 && IsSpace (L[Len-1])) {
             --Len;
         }
-        SB_Drop (&S->V.File.Line, SB_GetLen (&S->V.File.Line) - Len);
+        SB_Clear (&S->V.File.Line);
+        SB_AppendBuf (&S->V.File.Line, L, Len);
         SB_AppendChar (&S->V.File.Line, '\n');
 
         /* Terminate the string buffer */
@@ -520,7 +497,7 @@ void IFDone (CharSource* S)
     /* Close the input file and decrement the file count. We will ignore
     ** errors here, since we were just reading from the file.
     */
-    (void) fclose (S->V.File.F);
+    CloseSrcFile (S->V.File.F);
     --FCount;
 }
 
@@ -540,23 +517,25 @@ int NewInputFile (const char* Name)
 ** and false otherwise.
 */
 {
-    int         RetCode = 0;            /* Return code. Assume an error. */
-    char*       PathName = 0;
-    FILE*       F;
-    struct stat Buf;
-    StrBuf      NameBuf;                /* No need to initialize */
-    StrBuf      Path = AUTO_STRBUF_INITIALIZER;
-    unsigned    FileIdx;
-    CharSource* S;
+    int               RetCode = 0;      /* Return code. Assume an error. */
+    char*             PathName = 0;
+    const CachedFile* CF;
+    StrBuf            NameBuf;          /* No need to initialize */
+    StrBuf            Path = AUTO_STRBUF_INITIALIZER;
+    unsigned          FileIdx;
+    CharSource*       S;
 
 
     /* If this is the main file, just try to open it. If it's an include file,
-    ** search for it using the include path list.
+    ** search for it using the include path list. The contents of the file
+    ** come from the file cache, so a file that is included more than once
+    ** is read only once. The cache also remembers size and mtime, which
+    ** are stored in the file table for the debugger.
     */
     if (FCount == 0) {
         /* Main file */
-        F = fopen (Name, "r");
-        if (F == 0) {
+        CF = GetCachedFile (Name);
+        if (CF == 0) {
             Fatal ("Cannot open input file `%s': %s", Name, strerror (errno));
         }
     } else {
@@ -564,7 +543,7 @@ int NewInputFile (const char* Name)
         ** directories.
         */
         PathName = SearchFile (IncSearchPath, Name);
-        if (PathName == 0 || (F = fopen (PathName, "r")) == 0) {
+        if (PathName == 0 || (CF = GetCachedFile (PathName)) == 0) {
             /* Not found or cannot open, print an error and bail out */
             Error ("Cannot open include file `%s': %s", Name, strerror (errno));
             goto ExitPoint;
@@ -574,27 +553,15 @@ int NewInputFile (const char* Name)
         Name = PathName;
     }
 
-    /* Stat the file and remember the values. There's a race condition here,
-    ** since we cannot use fileno() (non-standard identifier in standard
-    ** header file), and therefore not fstat. When using stat with the
-    ** file name, there's a risk that the file was deleted and recreated
-    ** while it was open. Since mtime and size are only used to check
-    ** if a file has changed in the debugger, we will ignore this problem
-    ** here.
-    */
-    if (FileStat (Name, &Buf) != 0) {
-        Fatal ("Cannot stat input file `%s': %s", Name, strerror (errno));
-    }
-
     /* Add the file to the input file table and remember the index */
     FileIdx = AddFile (SB_InitFromString (&NameBuf, Name),
                        (FCount == 0)? FT_MAIN : FT_INCLUDE,
-                       Buf.st_size, (unsigned long) Buf.st_mtime);
+                       CF->Size, CF->MTime);
 
     /* Create a new input source variable and initialize it */
     S                   = xmalloc (sizeof (*S));
     S->Func             = &IFFunc;
-    S->V.File.F         = F;
+    S->V.File.F         = OpenSrcBuf (CF->F->Buf, CF->Size, SRC_EOL_ANY);
     S->V.File.Pos.Line  = 0;
     S->V.File.Pos.Col   = 0;
     S->V.File.Pos.Name  = FileIdx;
@@ -743,25 +710,43 @@ static void NextChar (void)
 
 
 void LocaseSVal (void)
-/* Make SVal lower case */
+/* Make SVal lower case and update its hash */
 {
     SB_ToLower (&CurTok.SVal);
+    CurTok.Hash = HashBuf (&CurTok.SVal);
 }
 
 
 
 void UpcaseSVal (void)
-/* Make SVal upper case */
+/* Make SVal upper case and update its hash */
 {
     SB_ToUpper (&CurTok.SVal);
+    CurTok.Hash = HashBuf (&CurTok.SVal);
 }
 
 
 
-static int CmpDotKeyword (const void* K1, const void* K2)
-/* Compare function for the dot keyword search */
+static void InitDotIndex (void)
+/* Build the hash index for the dot keywords if this wasn't done before */
 {
-    return strcmp (((struct DotKeyword*)K1)->Key, ((struct DotKeyword*)K2)->Key);
+    static int Done = 0;
+    unsigned I;
+
+    if (Done) {
+        return;
+    }
+    Done = 1;
+
+    CHECK (sizeof (DotKeywords) / sizeof (DotKeywords[0]) * 2 <= DOT_INDEX_SIZE);
+
+    for (I = 0; I < sizeof (DotKeywords) / sizeof (DotKeywords[0]); ++I) {
+        unsigned H = HashStr (DotKeywords[I].Key) & (DOT_INDEX_SIZE - 1);
+        while (DotIndex[H] != 0) {
+            H = (H + 1) & (DOT_INDEX_SIZE - 1);
+        }
+        DotIndex[H] = I + 1;
+    }
 }
 
 
@@ -771,12 +756,8 @@ static token_t FindDotKeyword (void)
 ** return TOK_NONE if not found.
 */
 {
-    struct DotKeyword K;
-    struct DotKeyword* R;
-
-    /* Initialize K */
-    K.Key = SB_GetConstBuf (&CurTok.SVal);
-    K.Tok = 0;
+    const char* Key;
+    unsigned    H;
 
     /* If we aren't in ignore case mode, we have to uppercase the keyword */
     if (!IgnoreCase) {
@@ -784,13 +765,16 @@ static token_t FindDotKeyword (void)
     }
 
     /* Search for the keyword */
-    R = bsearch (&K, DotKeywords, sizeof (DotKeywords) / sizeof (DotKeywords [0]),
-                 sizeof (DotKeywords [0]), CmpDotKeyword);
-    if (R != 0) {
-        return R->Tok;
-    } else {
-        return TOK_NONE;
+    Key = SB_GetConstBuf (&CurTok.SVal);
+    H = CurTok.Hash & (DOT_INDEX_SIZE - 1);
+    while (DotIndex[H] != 0) {
+        const struct DotKeyword* K = DotKeywords + DotIndex[H] - 1;
+        if (strcmp (Key, K->Key) == 0) {
+            return K->Tok;
+        }
+        H = (H + 1) & (DOT_INDEX_SIZE - 1);
     }
+    return TOK_NONE;
 }
 
 
@@ -809,9 +793,14 @@ static void ReadIdent (void)
     } while (IsIdChar (C));
     SB_Terminate (&CurTok.SVal);
 
-    /* If we should ignore case, convert the identifier to upper case */
+    /* If we should ignore case, convert the identifier to upper case. Set
+    ** the hash of the name, so the symbol table doesn't need to calculate
+    ** it again.
+    */
     if (IgnoreCase) {
         UpcaseSVal ();
+    } else {
+        CurTok.Hash = HashBuf (&CurTok.SVal);
     }
 }
 
@@ -1718,6 +1707,12 @@ unsigned char ParseAddrSize (void)
 void InitScanner (const char* InFile)
 /* Initialize the scanner, open the given input file */
 {
+    /* Build the hash index for the dot keywords */
+    InitDotIndex ();
+
+    /* No .END seen so far */
+    ForcedEnd = 0;
+
     /* Open the input file */
     NewInputFile (InFile);
 }
@@ -76,10 +76,10 @@ void NewInputData (char* Text, int Malloced);
 /* Add a chunk of input data to the input stream */
 
 void LocaseSVal (void);
-/* Make SVal lower case */
+/* Make SVal lower case and update its hash */
 
 void UpcaseSVal (void);
-/* Make SVal upper case */
+/* Make SVal upper case and update its hash */
 
 void NextRawTok (void);
 /* Read the next raw token from the input stream */
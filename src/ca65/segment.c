@@ -53,6 +53,7 @@
 #include "listing.h"
 #include "objcode.h"
 #include "objfile.h"
+#include "relax.h"
 #include "segment.h"
 #include "span.h"
 #include "spool.h"
@@ -87,6 +88,9 @@ Collection SegmentList = STATIC_COLLECTION_INITIALIZER;
 /* Currently active segment */
 Segment* ActiveSeg;
 
+/* Removable section started by SplitSeg, if any */
+static Segment* SplitPart = 0;
+
 
 
 /*****************************************************************************/
@@ -143,6 +147,25 @@ static Segment* NewSegment (const char* Name, unsigned char AddrSize)
 
 
 
+static void IncPC (unsigned Len)
+/* Increment the program counter of the current segment */
+{
+    ActiveSeg->PC += Len;
+    if (OrgPerSeg) {
+        /* Relocatable mode is switched per segment */
+        if (!ActiveSeg->RelocMode) {
+            ActiveSeg->AbsPC += Len;
+        }
+    } else {
+        /* Relocatable mode is switched globally */
+        if (!RelocMode) {
+            AbsPC += Len;
+        }
+    }
+}
+
+
+
 Fragment* GenFragment (unsigned char Type, unsigned short Len)
 /* Generate a new fragment, add it to the current segment and return it. */
 {
@@ -169,18 +192,7 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
     }
 
     /* Increment the program counter */
-    ActiveSeg->PC += F->Len;
-    if (OrgPerSeg) {
-        /* Relocatable mode is switched per segment */
-        if (!ActiveSeg->RelocMode) {
-            ActiveSeg->AbsPC += F->Len;
-        }
-    } else {
-        /* Relocatable mode is switched globally */
-        if (!RelocMode) {
-            AbsPC += F->Len;
-        }
-    }
+    IncPC (F->Len);
 
     /* Return the fragment */
     return F;
@@ -188,11 +200,91 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
 
 
 
+void GenLiteral (const void* Data, unsigned Len)
+/* Add literal data to the current segment. If the last fragment of the
+** segment is a literal fragment, the data is appended to it, so runs of
+** literal data need only one fragment. Since the listing shows the
+** fragments of each line, this is not done across listing lines.
+*/
+{
+    const unsigned char* D = Data;
+
+    while (Len > 0) {
+
+        Fragment* F    = ActiveSeg->Last;
+        unsigned  Size = Len;
+
+        if (F != 0                      &&
+            F->Type == FRAG_LITERAL     &&
+            !F->Shared                  &&
+            F->Len < MAX_FRAG_LEN       &&
+            (LineCur == 0 || LineCur->FragLast == F)) {
+
+            /* Append as much as possible to the last fragment */
+            if (Size > MAX_FRAG_LEN - F->Len) {
+                Size = MAX_FRAG_LEN - F->Len;
+            }
+            AppendFragData (F, D, Size);
+            IncPC (Size);
+
+        } else {
+
+            /* Start a new fragment */
+            if (Size > sizeof (F->V.Data)) {
+                Size = sizeof (F->V.Data);
+            }
+            F = GenFragment (FRAG_LITERAL, Size);
+            memcpy (F->V.Data, D, Size);
+
+        }
+
+        D   += Size;
+        Len -= Size;
+    }
+}
+
+
+
+void GenSharedLiteral (const void* Data, unsigned long Len)
+/* Add literal data to the current segment without copying it. The data must
+** stay valid until the object file is written. Small amounts of data are
+** copied anyway, since they fit into the fragment itself.
+*/
+{
+    const unsigned char* D = Data;
+
+    while (Len > 0) {
+
+        /* Each fragment may hold at most MAX_FRAG_LEN bytes */
+        unsigned Size = (Len > MAX_FRAG_LEN)? MAX_FRAG_LEN : (unsigned) Len;
+
+        if (Size <= sizeof (((Fragment*) 0)->V.Data)) {
+            /* The fragment keeps data of this size inline, so copy it. This
+            ** may also be the last part of a large block.
+            */
+            GenLiteral (D, Size);
+        } else {
+            /* Reference the data instead of copying it */
+            Fragment* F = GenFragment (FRAG_LITERAL, Size);
+            F->Shared = 1;
+            F->V.Buf  = (unsigned char*) D;
+        }
+
+        D   += Size;
+        Len -= Size;
+    }
+}
+
+
+
 void UseSeg (const SegDef* D)
 /* Use the segment with the given name */
 {
-    unsigned I;
-    for (I = 0; I < CollCount (&SegmentList); ++I) {
+    /* Search backwards, so if the segment was split by SplitSeg, the last
+    ** part is used.
+    */
+    unsigned I = CollCount (&SegmentList);
+    while (I-- > 0) {
         Segment* Seg = CollAtUnchecked (&SegmentList, I);
         if (strcmp (Seg->Def->Name, D->Name) == 0) {
             /* We found this segment. Check if the type is identical */
@@ -217,6 +309,65 @@ void UseSeg (const SegDef* D)
 
 
 
+void SplitSeg (void)
+/* Continue the active segment in a new section, that the linker may remove
+** if nothing references it. This is not done in absolute mode.
+*/
+{
+    if (!GetRelocMode ()) {
+        return;
+    }
+
+    /* If the active segment is still empty, it may be removed itself.
+    ** Otherwise create a new section for the segment and make it the active
+    ** one.
+    */
+    if (ActiveSeg->FragCount != 0) {
+        ActiveSeg = NewSegFromDef (ActiveSeg->Def);
+    }
+    ActiveSeg->Flags |= SEG_FLAG_REMOVABLE;
+    SplitPart = ActiveSeg;
+}
+
+
+
+void EndSplitSeg (void)
+/* End the removable section started by the last call to SplitSeg. If it is
+** still the last section of its segment, the segment is continued in a new
+** section that isn't removable.
+*/
+{
+    unsigned I;
+
+    if (SplitPart == 0) {
+        return;
+    }
+
+    /* Search for the last section of the segment */
+    I = CollCount (&SegmentList);
+    while (I-- > 0) {
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        if (Seg->Def == SplitPart->Def) {
+            break;
+        }
+    }
+
+    if (CollAtUnchecked (&SegmentList, I) == SplitPart) {
+        if (SplitPart->FragCount == 0) {
+            /* Nothing was added, so just keep the section */
+            SplitPart->Flags &= ~SEG_FLAG_REMOVABLE;
+        } else {
+            Segment* S = NewSegFromDef (SplitPart->Def);
+            if (ActiveSeg == SplitPart) {
+                ActiveSeg = S;
+            }
+        }
+    }
+    SplitPart = 0;
+}
+
+
+
 unsigned long GetPC (void)
 /* Get the program counter of the current segment */
 {
@@ -319,6 +470,13 @@ void SegAlign (unsigned long Alignment, int FillVal)
     }
 
 
+    /* If there are relaxed instructions in the segment, the number of fill
+    ** bytes is recalculated at the end of assembly.
+    */
+    if (RelaxAlign (Alignment, FillVal, Count)) {
+        return;
+    }
+
     /* Emit the data or a fill fragment */
     if (FillVal != -1) {
         /* User defined fill value */
@@ -354,8 +512,8 @@ unsigned char GetSegAddrSize (unsigned SegNum)
 
 
 
-void SegDone (void)
-/* Check the segments for range and other errors. Do cleanup. */
+static void CheckRange (const Fragment* F, long Val)
+/* Check if the value of an expression fragment fits into the fragment */
 {
     static const unsigned long U_Hi[4] = {
         0x000000FFUL, 0x0000FFFFUL, 0x00FFFFFFUL, 0xFFFFFFFFUL
@@ -364,7 +522,37 @@ void SegDone (void)
         0x0000007FL, 0x00007FFFL, 0x007FFFFFL, 0x7FFFFFFFL
     };
 
+    CHECK (F->Len <= 4);
+    if (F->Type == FRAG_SEXPR) {
+        long Hi = S_Hi[F->Len-1];
+        long Lo = ~Hi;
+        if (Val > Hi || Val < Lo) {
+            LIError (&F->LI,
+                     "Range error (%ld not in [%ld..%ld])",
+                     Val, Lo, Hi);
+        }
+    } else {
+        if (((unsigned long)Val) > U_Hi[F->Len-1]) {
+            LIError (&F->LI,
+                     "Range error (%lu not in [0..%lu])",
+                     (unsigned long)Val, U_Hi[F->Len-1]);
+        }
+    }
+}
+
+
+
+void SegDone (void)
+/* Check the segments for range and other errors. Do cleanup. */
+{
     unsigned I;
+
+    /* Choose the final size of relaxed instructions. After that, symbols
+    ** don't change any longer.
+    */
+    RelaxDone ();
+    FreezeSymbols ();
+
     for (I = 0; I < CollCount (&SegmentList); ++I) {
         Segment* S = CollAtUnchecked (&SegmentList, I);
         Fragment* F = S->Root;
@@ -382,22 +570,7 @@ void SegDone (void)
                     unsigned J;
 
                     /* The expression is constant. Check for range errors. */
-                    CHECK (F->Len <= 4);
-                    if (F->Type == FRAG_SEXPR) {
-                        long Hi = S_Hi[F->Len-1];
-                        long Lo = ~Hi;
-                        if (ED.Val > Hi || ED.Val < Lo) {
-                            LIError (&F->LI,
-                                     "Range error (%ld not in [%ld..%ld])",
-                                     ED.Val, Lo, Hi);
-                        }
-                    } else {
-                        if (((unsigned long)ED.Val) > U_Hi[F->Len-1]) {
-                            LIError (&F->LI,
-                                     "Range error (%lu not in [0..%lu])",
-                                     (unsigned long)ED.Val, U_Hi[F->Len-1]);
-                        }
-                    }
+                    CheckRange (F, ED.Val);
 
                     /* We don't need the expression tree any longer */
                     FreeExpr (F->V.Expr);
@@ -409,18 +582,28 @@ void SegDone (void)
                     }
                     F->Type = FRAG_LITERAL;
 
-                } else if (RelaxChecks == 0) {
+                } else {
 
                     /* We cannot evaluate the expression now, leave the job for
                     ** the linker. However, we can check if the address size
                     ** matches the fragment size. Mismatches are errors in
-                    ** most situations.
+                    ** most situations. If the value depends only on the sizes
+                    ** of instructions relaxed by the linker, check it with
+                    ** the sizes used by the assembler. These are the largest
+                    ** ones, and the linker checks the final value again.
                     */
-                    if ((F->Len == 1 && ED.AddrSize > ADDR_SIZE_ZP)  ||
-                        (F->Len == 2 && ED.AddrSize > ADDR_SIZE_ABS) ||
-                        (F->Len == 3 && ED.AddrSize > ADDR_SIZE_FAR)) {
-                        LIError (&F->LI, "Range error (Address size %u does not match fragment size %u)", ED.AddrSize, F->Len);
+                    if (ED.Flags == ED_OK && ED.SymCount == 0 && ED.SecCount == 0) {
+                        CheckRange (F, ED.Val);
+                    } else if (RelaxChecks == 0) {
+                        if ((F->Len == 1 && ED.AddrSize > ADDR_SIZE_ZP)  ||
+                            (F->Len == 2 && ED.AddrSize > ADDR_SIZE_ABS) ||
+                            (F->Len == 3 && ED.AddrSize > ADDR_SIZE_FAR)) {
+                            LIError (&F->LI, "Range error (Address size %u does not match fragment size %u)", ED.AddrSize, F->Len);
+                        }
                     }
+
+                    /* Write the expression in its smallest form */
+                    F->V.Expr = FlattenExpr (F->V.Expr, &ED);
                 }
 
                 /* Release memory allocated for the expression decriptor */
@@ -455,13 +638,17 @@ void SegDump (void)
                     State = 0;
                 }
                 for (I = 0; I < F->Len; ++I) {
-                    printf (" %02X", F->V.Data [I]);
+                    printf (" %02X", GetFragData (F) [I]);
                     X += 3;
                 }
             } else if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
                 State = 1;
                 printf ("\n  Expression (%u): ", F->Len);
                 DumpExpr (F->V.Expr, SymResolve);
+            } else if (F->Type == FRAG_RELAX) {
+                State = 1;
+                printf ("\n  Relaxed by the linker: %02X/%02X",
+                        F->V.Data[0], F->V.Data[1]);
             } else if (F->Type == FRAG_FILL) {
                 State = 1;
                 printf ("\n  Fill bytes (%u)", F->Len);
@@ -568,7 +755,7 @@ static void WriteOneSeg (Segment* Seg)
             case FRAG_LITERAL:
                 ObjWrite8 (FRAG_LITERAL);
                 ObjWriteVar (Frag->Len);
-                ObjWriteData (Frag->V.Data, Frag->Len);
+                ObjWriteData (GetFragData (Frag), Frag->Len);
                 break;
 
             case FRAG_EXPR:
@@ -598,6 +785,17 @@ static void WriteOneSeg (Segment* Seg)
                 ObjWriteVar (Frag->Len);
                 break;
 
+            case FRAG_RELAX:
+                /* Both opcodes, followed by the operand of the long form
+                ** which is in the next fragment.
+                */
+                ObjWrite8 (Frag->V.Data[2]);
+                ObjWrite8 (Frag->V.Data[1]);
+                ObjWrite8 (Frag->V.Data[0]);
+                Frag = Frag->Next;
+                WriteExpr (Frag->V.Expr);
+                break;
+
             default:
                 Internal ("Invalid fragment type: %u", Frag->Type);
 
@@ -640,3 +838,17 @@ void WriteSegments (void)
     /* Done writing segments */
     ObjEndSegments ();
 }
+
+
+
+void SegReset (void)
+/* Remove all segments, so another file can be assembled. SegInit must be
+** called afterwards.
+*/
+{
+    CollDeleteAll (&SegmentList);
+    ActiveSeg = 0;
+    SplitPart = 0;
+    RelocMode = 1;
+    AbsPC     = 0;
+}
@@ -95,12 +95,33 @@ extern Segment* ActiveSeg;
 Fragment* GenFragment (unsigned char Type, unsigned short Len);
 /* Generate a new fragment, add it to the current segment and return it. */
 
+void GenLiteral (const void* Data, unsigned Len);
+/* Add literal data to the current segment. If the last fragment of the
+** segment is a literal fragment, the data is appended to it.
+*/
+
+void GenSharedLiteral (const void* Data, unsigned long Len);
+/* Add literal data to the current segment without copying it. The data must
+** stay valid until the object file is written.
+*/
+
 void ListSegments (FILE* destination);
 /* List the segments to the given file when seglist set */
 
 void UseSeg (const SegDef* D);
 /* Use the given segment */
 
+void SplitSeg (void);
+/* Continue the active segment in a new section, that the linker may remove
+** if nothing references it. This is not done in absolute mode.
+*/
+
+void EndSplitSeg (void);
+/* End the removable section started by the last call to SplitSeg. If it is
+** still the last section of its segment, the segment is continued in a new
+** section that isn't removable.
+*/
+
 static inline const SegDef* GetCurrentSegDef (void)
 /* Get a pointer to the segment defininition of the current segment */
 {
@@ -159,6 +180,11 @@ void SetSegmentSizes (void);
 void WriteSegments (void);
 /* Write the segment data to the object file */
 
+void SegReset (void);
+/* Remove all segments, so another file can be assembled. SegInit must be
+** called afterwards.
+*/
+
 
 
 /* End of segment.h */
@@ -35,6 +35,7 @@
 
 /* common */
 #include "addrsize.h"
+#include "hashfunc.h"
 
 /* ca65 */
 #include "expr.h"
@@ -77,7 +78,8 @@ SymEntry* FindSizeOfScope (SymTable* Scope)
 ** encodes the size or NULL if there is no such entry.
 */
 {
-    return SymFind (Scope, &SizeEntryName, SYM_FIND_EXISTING);
+    return SymFind (Scope, &SizeEntryName, HashBuf (&SizeEntryName),
+                    SYM_FIND_EXISTING);
 }
 
 
@@ -87,7 +89,8 @@ SymEntry* FindSizeOfSymbol (SymEntry* Sym)
 ** entry that encodes the size of the symbol or NULL if there is no such entry.
 */
 {
-    return SymFindLocal (Sym, &SizeEntryName, SYM_FIND_EXISTING);
+    return SymFindLocal (Sym, &SizeEntryName, HashBuf (&SizeEntryName),
+                         SYM_FIND_EXISTING);
 }
 
 
@@ -97,7 +100,8 @@ SymEntry* GetSizeOfScope (SymTable* Scope)
 ** encodes the size, and will create a new entry if it does not exist.
 */
 {
-    return SymFind (Scope, &SizeEntryName, SYM_ALLOC_NEW);
+    return SymFind (Scope, &SizeEntryName, HashBuf (&SizeEntryName),
+                    SYM_ALLOC_NEW);
 }
 
 
@@ -108,25 +112,26 @@ SymEntry* GetSizeOfSymbol (SymEntry* Sym)
 ** does not exist.
 */
 {
-    return SymFindLocal (Sym, &SizeEntryName, SYM_ALLOC_NEW);
+    return SymFindLocal (Sym, &SizeEntryName, HashBuf (&SizeEntryName),
+                         SYM_ALLOC_NEW);
 }
 
 
 
-SymEntry* DefSizeOfScope (SymTable* Scope, long Size)
+SymEntry* DefSizeOfScope (SymTable* Scope, ExprNode* Size)
 /* Define the size of a scope and return the size symbol */
 {
     SymEntry* SizeSym = GetSizeOfScope (Scope);
-    SymDef (SizeSym, GenLiteralExpr (Size), ADDR_SIZE_DEFAULT, SF_NONE);
+    SymDef (SizeSym, Size, ADDR_SIZE_DEFAULT, SF_NONE);
     return SizeSym;
 }
 
 
 
-SymEntry* DefSizeOfSymbol (SymEntry* Sym, long Size)
+SymEntry* DefSizeOfSymbol (SymEntry* Sym, ExprNode* Size)
 /* Define the size of a symbol and return the size symbol */
 {
     SymEntry* SizeSym = GetSizeOfSymbol (Sym);
-    SymDef (SizeSym, GenLiteralExpr (Size), ADDR_SIZE_DEFAULT, SF_NONE);
+    SymDef (SizeSym, Size, ADDR_SIZE_DEFAULT, SF_NONE);
     return SizeSym;
 }
@@ -49,6 +49,7 @@
 
 
 
+struct ExprNode;
 struct SymEntry;
 struct SymTable;
 
@@ -86,10 +87,10 @@ struct SymEntry* GetSizeOfSymbol (struct SymEntry* Sym);
 ** does not exist.
 */
 
-struct SymEntry* DefSizeOfScope (struct SymTable* Scope, long Size);
+struct SymEntry* DefSizeOfScope (struct SymTable* Scope, struct ExprNode* Size);
 /* Define the size of a scope and return the size symbol */
 
-struct SymEntry* DefSizeOfSymbol (struct SymEntry* Sym, long Size);
+struct SymEntry* DefSizeOfSymbol (struct SymEntry* Sym, struct ExprNode* Size);
 /* Define the size of a symbol and return the size symbol */
 
 
@@ -41,6 +41,7 @@
 /* ca65 */
 #include "global.h"
 #include "objfile.h"
+#include "relax.h"
 #include "segment.h"
 #include "span.h"
 #include "spool.h"
@@ -380,6 +381,9 @@ void WriteSpans (void)
         /* Write all spans */
         for (I = 0; I < CollCount (&SpanList); ++I) {
 
+            unsigned long Start;
+            unsigned long End;
+
             /* Get the span and check it */
             const Span* S = CollAtUnchecked (&SpanList, I);
             CHECK (S->End > S->Start);
@@ -388,9 +392,13 @@ void WriteSpans (void)
             ** end offset to save some bytes, since most spans are expected
             ** to be rather small.
             */
+            /* Get the final offsets after relaxation */
+            Start = GetRelaxedOffs (S->Seg->Num, S->Start);
+            End   = GetRelaxedOffs (S->Seg->Num, S->End);
+
             ObjWriteVar (S->Seg->Num);
-            ObjWriteVar (S->Start);
-            ObjWriteVar (S->End - S->Start);
+            ObjWriteVar (Start);
+            ObjWriteVar (End - Start);
             ObjWriteVar (S->Type);
         }
 
@@ -407,3 +415,12 @@ void WriteSpans (void)
     /* Done writing the spans */
     ObjEndSpans ();
 }
+
+
+
+void ResetSpans (void)
+/* Remove all spans, so another file can be assembled */
+{
+    DoneHashTable (&SpanTab);
+    InitHashTable (&SpanTab, 1051, &HashFunc);
+}
@@ -107,6 +107,9 @@ void WriteSpanList (const Collection* Spans);
 void WriteSpans (void);
 /* Write all spans to the object file */
 
+void ResetSpans (void);
+/* Remove all spans, so another file can be assembled */
+
 
 
 /* End of span.h */
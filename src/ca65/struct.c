@@ -154,7 +154,8 @@ static long DoStructInternal (long Offs, unsigned Type)
             }
 
             /* We have an identifier, generate a symbol */
-            Sym = SymFind (CurrentScope, &CurTok.SVal, SYM_ALLOC_NEW);
+            Sym = SymFind (CurrentScope, &CurTok.SVal, CurTok.Hash,
+                           SYM_ALLOC_NEW);
 
             /* Assign the symbol the offset of the current member */
             SymDef (Sym, GenLiteralExpr (Offs), ADDR_SIZE_DEFAULT, SF_NONE);
@@ -252,7 +253,7 @@ static long DoStructInternal (long Offs, unsigned Type)
 
         /* Assign the size to the member if it has a name */
         if (Sym) {
-            DefSizeOfSymbol (Sym, MemberSize);
+            DefSizeOfSymbol (Sym, GenLiteralExpr (MemberSize));
         }
 
         /* Next member */
@@ -44,6 +44,7 @@
 /* ca65 */
 #include "error.h"
 #include "expr.h"
+#include "relax.h"
 #include "segment.h"
 #include "studyexpr.h"
 #include "symtab.h"
@@ -51,6 +52,28 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* True if symbols don't change any longer, so the results of studying their
+** expressions may be cached.
+*/
+static int SymsFrozen = 0;
+
+/* True if the sizes of relaxed instructions were used while they were still
+** being calculated. Results are not cached from then on until symbols are
+** frozen.
+*/
+static int RelaxPending = 0;
+
+/* Don't print errors if greater than zero */
+static unsigned Quiet = 0;
+
+
+
 /*****************************************************************************/
 /*                              struct ExprDesc                              */
 /*****************************************************************************/
@@ -69,6 +92,9 @@ ExprDesc* ED_Init (ExprDesc* ED)
     ED->SecCount  = 0;
     ED->SecLimit  = 0;
     ED->SecRef    = 0;
+    ED->RelaxCount = 0;
+    ED->RelaxLimit = 0;
+    ED->RelaxRef   = 0;
     return ED;
 }
 
@@ -79,6 +105,7 @@ void ED_Done (ExprDesc* ED)
 {
     xfree (ED->SymRef);
     xfree (ED->SecRef);
+    xfree (ED->RelaxRef);
 }
 
 
@@ -101,6 +128,11 @@ int ED_IsConst (const ExprDesc* D)
             return 0;
         }
     }
+    for (I = 0; I < D->RelaxCount; ++I) {
+        if (D->RelaxRef[I].Count != 0) {
+            return 0;
+        }
+    }
     return 1;
 }
 
@@ -124,6 +156,16 @@ static int ED_HasError (const ExprDesc* D)
 
 
 
+static int ED_IsEmpty (const ExprDesc* D)
+/* Return true if nothing was placed into D since it was initialized */
+{
+    return (D->Flags == ED_OK && D->AddrSize == ADDR_SIZE_DEFAULT &&
+            D->Val == 0 && D->SymCount == 0 && D->SecCount == 0 &&
+            D->RelaxCount == 0);
+}
+
+
+
 static void ED_Invalidate (ExprDesc* D)
 /* Set the TOO_COMPLEX flag for D */
 {
@@ -287,6 +329,23 @@ static ED_SecRef* ED_FindSecRef (ExprDesc* ED, unsigned Sec)
 
 
 
+static ED_RelaxRef* ED_FindRelaxRef (ExprDesc* ED, unsigned Mark)
+/* Find a reference to a relax mark and return it. Return NULL if the
+** reference does not exist.
+*/
+{
+    unsigned I;
+    ED_RelaxRef* RelaxRef;
+    for (I = 0, RelaxRef = ED->RelaxRef; I < ED->RelaxCount; ++I, ++RelaxRef) {
+        if (RelaxRef->Ref == Mark) {
+            return RelaxRef;
+        }
+    }
+    return 0;
+}
+
+
+
 static ED_SymRef* ED_AllocSymRef (ExprDesc* ED, SymEntry* Sym)
 /* Allocate a new symbol reference and return it. The count of the new
 ** reference will be set to zero, and the reference itself to Sym.
@@ -341,6 +400,33 @@ static ED_SecRef* ED_AllocSecRef (ExprDesc* ED, unsigned Sec)
 
 
 
+static ED_RelaxRef* ED_AllocRelaxRef (ExprDesc* ED, unsigned Mark)
+/* Allocate a new reference to a relax mark and return it. The count of the
+** new reference will be set to zero, and the reference itself to Mark.
+*/
+{
+    ED_RelaxRef* RelaxRef;
+
+    /* Make sure we have enough RelaxRef slots */
+    if (ED->RelaxCount >= ED->RelaxLimit) {
+        ED->RelaxLimit *= 2;
+        if (ED->RelaxLimit == 0) {
+            ED->RelaxLimit = 2;
+        }
+        ED->RelaxRef = xrealloc (ED->RelaxRef, ED->RelaxLimit * sizeof (ED->RelaxRef[0]));
+    }
+
+    /* Allocate a new slot */
+    RelaxRef = ED->RelaxRef + ED->RelaxCount++;
+
+    /* Initialize the new struct and return it */
+    RelaxRef->Count = 0;
+    RelaxRef->Ref   = Mark;
+    return RelaxRef;
+}
+
+
+
 static ED_SymRef* ED_GetSymRef (ExprDesc* ED, SymEntry* Sym)
 /* Get a symbol reference and return it. If the symbol reference does not
 ** exist, a new one is created and returned.
@@ -369,6 +455,20 @@ static ED_SecRef* ED_GetSecRef (ExprDesc* ED, unsigned Sec)
 
 
 
+static ED_RelaxRef* ED_GetRelaxRef (ExprDesc* ED, unsigned Mark)
+/* Get a reference to a relax mark and return it. If the reference does not
+** exist, a new one is created and returned.
+*/
+{
+    ED_RelaxRef* RelaxRef = ED_FindRelaxRef (ED, Mark);
+    if (RelaxRef == 0) {
+        RelaxRef = ED_AllocRelaxRef (ED, Mark);
+    }
+    return RelaxRef;
+}
+
+
+
 static void ED_MergeSymRefs (ExprDesc* ED, const ExprDesc* New)
 /* Merge the symbol references from New into ED */
 {
@@ -407,11 +507,31 @@ static void ED_MergeSecRefs (ExprDesc* ED, const ExprDesc* New)
 
 
 
+static void ED_MergeRelaxRefs (ExprDesc* ED, const ExprDesc* New)
+/* Merge the references to relax marks from New into ED */
+{
+    unsigned I;
+    for (I = 0; I < New->RelaxCount; ++I) {
+
+        /* Get a pointer to the RelaxRef entry */
+        const ED_RelaxRef* NewRef = New->RelaxRef + I;
+
+        /* Get the corresponding entry in ED */
+        ED_RelaxRef* RelaxRef = ED_GetRelaxRef (ED, NewRef->Ref);
+
+        /* Sum up the references */
+        RelaxRef->Count += NewRef->Count;
+    }
+}
+
+
+
 static void ED_MergeRefs (ExprDesc* ED, const ExprDesc* New)
 /* Merge all references from New into ED */
 {
     ED_MergeSymRefs (ED, New);
     ED_MergeSecRefs (ED, New);
+    ED_MergeRelaxRefs (ED, New);
 }
 
 
@@ -426,6 +546,9 @@ static void ED_NegRefs (ExprDesc* D)
     for (I = 0; I < D->SecCount; ++I) {
         D->SecRef[I].Count = -D->SecRef[I].Count;
     }
+    for (I = 0; I < D->RelaxCount; ++I) {
+        D->RelaxRef[I].Count = -D->RelaxRef[I].Count;
+    }
 }
 
 
@@ -465,6 +588,9 @@ static void ED_Mul (ExprDesc* ED, const ExprDesc* Right)
     for (I = 0; I < ED->SecCount; ++I) {
         ED->SecRef[I].Count *= Right->Val;
     }
+    for (I = 0; I < ED->RelaxCount; ++I) {
+        ED->RelaxRef[I].Count *= Right->Val;
+    }
     ED_MergeAddrSize (ED, Right);
 }
 
@@ -592,13 +718,25 @@ static void StudySymbol (ExprNode* Expr, ExprDesc* D)
     if (SymHasExpr (Sym)) {
 
         if (SymHasUserMark (Sym)) {
-            LIError (&Sym->DefLines,
-                     "Circular reference in definition of symbol `%m%p'",
-                     GetSymName (Sym));
+            if (Quiet == 0) {
+                LIError (&Sym->DefLines,
+                         "Circular reference in definition of symbol `%m%p'",
+                         GetSymName (Sym));
+            }
             ED_SetError (D);
         } else {
 
             unsigned char AddrSize;
+            int           Empty = ED_IsEmpty (D);
+
+            /* If the result for this symbol was cached, use it */
+            if (Sym->Study && Empty) {
+                D->Flags    = Sym->Study->Flags;
+                D->AddrSize = Sym->Study->AddrSize;
+                D->Val      = Sym->Study->Val;
+                ED_MergeRefs (D, Sym->Study);
+                return;
+            }
 
             /* Mark the symbol and study its associated expression */
             SymMarkUser (Sym);
@@ -619,6 +757,24 @@ static void StudySymbol (ExprNode* Expr, ExprDesc* D)
             if (AddrSize != ADDR_SIZE_DEFAULT && AddrSize < D->AddrSize) {
                 D->AddrSize = AddrSize;
             }
+
+            /* Remember the result, so symbols referenced from many places
+            ** are studied only once. A valid result cannot change, since all
+            ** symbols it depends on are defined, and only variables may be
+            ** redefined. The exception are the sizes of relaxed instructions
+            ** while they are calculated. Other results are cached only when
+            ** symbols don't change any longer. Errors are never cached, so
+            ** they are reported for every use.
+            */
+            if (Empty && !SymIsVar (Sym) &&
+                ((ED_IsValid (D) && !RelaxPending) ||
+                 (SymsFrozen && !ED_HasError (D)))) {
+                Sym->Study = ED_Init (xmalloc (sizeof (ExprDesc)));
+                Sym->Study->Flags    = D->Flags;
+                Sym->Study->AddrSize = D->AddrSize;
+                Sym->Study->Val      = D->Val;
+                ED_MergeRefs (Sym->Study, D);
+            }
         }
 
     } else if (SymIsImport (Sym)) {
@@ -654,7 +810,7 @@ static void StudySymbol (ExprNode* Expr, ExprDesc* D)
         Parent = GetSymParentScope (Sym);
         if (AddrSize == ADDR_SIZE_DEFAULT && Parent != 0 &&
             Sym->Sym.Tab == CurrentScope) {
-            SymEntry* H = SymFindAny (Parent, GetSymName (Sym));
+            SymEntry* H = SymFindAny (Parent, GetSymName (Sym), Sym->Hash);
             if (H) {
                 AddrSize = GetSymAddrSize (H);
                 if (AddrSize != ADDR_SIZE_DEFAULT) {
@@ -698,6 +854,35 @@ static void StudyULabel (ExprNode* Expr, ExprDesc* D)
 
 
 
+static void StudyRelax (ExprNode* Expr, ExprDesc* D)
+/* Study a node for the size changes of relaxed instructions */
+{
+    int Link;
+
+    /* The size changes are unknown until the end of assembly. They don't
+    ** change the address size of an expression, so use the smallest one
+    ** in this case.
+    */
+    if (!GetRelaxDelta (Expr->V.IVal, &D->Val)) {
+        ED_Invalidate (D);
+        D->AddrSize = ADDR_SIZE_ZP;
+        return;
+    }
+    if (!SymsFrozen) {
+        RelaxPending = 1;
+    }
+
+    /* If instructions before the mark are relaxed by the linker, the size
+    ** changes known here are completed by the ones of the linker.
+    */
+    Link = GetRelaxLink (Expr->V.IVal);
+    if (Link >= 0) {
+        ++ED_GetRelaxRef (D, Link)->Count;
+    }
+}
+
+
+
 static void StudyPlus (ExprNode* Expr, ExprDesc* D)
 /* Study an EXPR_PLUS binary expression node */
 {
@@ -824,7 +1009,9 @@ static void StudyDiv (ExprNode* Expr, ExprDesc* D)
     /* If the result is valid, apply the operation */
     if (ED_IsValid (D)) {
         if (D->Right == 0) {
-            Error ("Division by zero");
+            if (Quiet == 0) {
+                Error ("Division by zero");
+            }
             ED_SetError (D);
         } else {
             D->Val /= D->Right;
@@ -843,7 +1030,9 @@ static void StudyMod (ExprNode* Expr, ExprDesc* D)
     /* If the result is valid, apply the operation */
     if (ED_IsValid (D)) {
         if (D->Right == 0) {
-            Error ("Modulo operation with zero");
+            if (Quiet == 0) {
+                Error ("Modulo operation with zero");
+            }
             ED_SetError (D);
         } else {
             D->Val %= D->Right;
@@ -1392,6 +1581,10 @@ static void StudyExprInternal (ExprNode* Expr, ExprDesc* D)
             StudyULabel (Expr, D);
             break;
 
+        case EXPR_RELAX:
+            StudyRelax (Expr, D);
+            break;
+
         case EXPR_PLUS:
             StudyPlus (Expr, D);
             break;
@@ -1540,6 +1733,26 @@ static void StudyExprInternal (ExprNode* Expr, ExprDesc* D)
 
 
 
+void FreezeSymbols (void)
+/* Tell StudyExpr that symbols and the sizes of relaxed instructions will not
+** change any longer. From now on, the results of studying the expressions of
+** symbols are cached even if they are not valid.
+*/
+{
+    SymsFrozen = 1;
+}
+
+
+
+void ThawSymbols (void)
+/* Undo FreezeSymbols, so another file can be assembled */
+{
+    SymsFrozen   = 0;
+    RelaxPending = 0;
+}
+
+
+
 void StudyExpr (ExprNode* Expr, ExprDesc* D)
 /* Study an expression tree and place the contents into D */
 {
@@ -1576,6 +1789,20 @@ void StudyExpr (ExprNode* Expr, ExprDesc* D)
         }
     }
 
+    /* Remove references to relax marks with count zero */
+    I = 0;
+    while (I < D->RelaxCount) {
+        if (D->RelaxRef[I].Count == 0) {
+            /* Delete the entry */
+            --D->RelaxCount;
+            memmove (D->RelaxRef + I, D->RelaxRef + I + 1,
+                     (D->RelaxCount - I) * sizeof (D->RelaxRef[0]));
+        } else {
+            /* Next entry */
+            ++I;
+        }
+    }
+
     /* If we don't have an address size, assign one if the expression is a
     ** constant.
     */
@@ -1636,3 +1863,17 @@ void StudyExpr (ExprNode* Expr, ExprDesc* D)
     printf ("%u sections:\n", D->SecCount);
 #endif
 }
+
+
+
+int StudyFinalExpr (ExprNode* Expr, ExprDesc* D)
+/* Study an expression tree like StudyExpr, but don't print errors. Return
+** true if the result is final, that is, if studying the expression at the
+** end of assembly would give the same result.
+*/
+{
+    ++Quiet;
+    StudyExpr (Expr, D);
+    --Quiet;
+    return (ED_IsValid (D) && !RelaxPending) || (SymsFrozen && !ED_HasError (D));
+}
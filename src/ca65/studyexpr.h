@@ -68,6 +68,13 @@ struct ED_SecRef {
     unsigned            Ref;            /* Actual reference */
 };
 
+/* Reference to the size changes of instructions relaxed by the linker */
+typedef struct ED_RelaxRef ED_RelaxRef;
+struct ED_RelaxRef {
+    long                Count;          /* Number of references */
+    unsigned            Ref;            /* Mark of the relaxed instruction */
+};
+
 /* Structure for parsing expression trees */
 typedef struct ExprDesc ExprDesc;
 struct ExprDesc {
@@ -85,6 +92,11 @@ struct ExprDesc {
     unsigned            SecCount;       /* Number of sections referenced */
     unsigned            SecLimit;       /* Memory allocated */
     ED_SecRef*          SecRef;         /* Section references */
+
+    /* Reference management for instructions relaxed by the linker */
+    unsigned            RelaxCount;     /* Number of marks referenced */
+    unsigned            RelaxLimit;     /* Memory allocated */
+    ED_RelaxRef*        RelaxRef;       /* References to relax marks */
 };
 
 
@@ -112,9 +124,24 @@ int ED_IsConst (const ExprDesc* ED);
 
 
 
+void FreezeSymbols (void);
+/* Tell StudyExpr that symbols and the sizes of relaxed instructions will not
+** change any longer. From now on, the results of studying the expressions of
+** symbols are cached even if they are not valid.
+*/
+
+void ThawSymbols (void);
+/* Undo FreezeSymbols, so another file can be assembled */
+
 void StudyExpr (ExprNode* Expr, ExprDesc* D);
 /* Study an expression tree and place the contents into D */
 
+int StudyFinalExpr (ExprNode* Expr, ExprDesc* D);
+/* Study an expression tree like StudyExpr, but don't print errors. Return
+** true if the result is final, that is, if studying the expression at the
+** end of assembly would give the same result.
+*/
+
 
 
 /* End of studyexpr.h */
@@ -53,13 +53,13 @@
 
 
 
-SymTable* ParseScopedIdent (StrBuf* Name, StrBuf* FullName)
+SymTable* ParseScopedIdent (StrBuf* Name, unsigned* Hash, StrBuf* FullName)
 /* Parse a (possibly scoped) identifer. The scope of the name must exist and
 ** is returned as function result, while the last part (the identifier) which
 ** may be either a symbol or a scope depending on the context is returned in
-** Name. FullName is a string buffer that is used to store the full name of
-** the identifier including the scope. It is used internally and may be used
-** by the caller for error messages or similar.
+** Name, and its hash in Hash. FullName is a string buffer that is used to
+** store the full name of the identifier including the scope. It is used
+** internally and may be used by the caller for error messages or similar.
 */
 {
     SymTable* Scope;
@@ -78,6 +78,7 @@ SymTable* ParseScopedIdent (StrBuf* Name, StrBuf* FullName)
 
         /* Remember the name and skip it */
         SB_Copy (Name, &CurTok.SVal);
+        *Hash = CurTok.Hash;
         NextTok ();
 
         /* If no namespace symbol follows, we're already done */
@@ -126,6 +127,7 @@ SymTable* ParseScopedIdent (StrBuf* Name, StrBuf* FullName)
 
         /* Remember and skip the identifier */
         SB_Copy (Name, &CurTok.SVal);
+        *Hash = CurTok.Hash;
         NextTok ();
 
         /* If a namespace token follows, we search for another scope, otherwise
@@ -162,11 +164,12 @@ SymEntry* ParseScopedSymName (SymFindAction Action)
 {
     StrBuf    ScopeName = STATIC_STRBUF_INITIALIZER;
     StrBuf    Ident = STATIC_STRBUF_INITIALIZER;
+    unsigned  Hash = 0;
     int       NoScope;
     SymEntry* Sym;
 
     /* Parse the scoped symbol name */
-    SymTable* Scope = ParseScopedIdent (&Ident, &ScopeName);
+    SymTable* Scope = ParseScopedIdent (&Ident, &Hash, &ScopeName);
 
     /* If ScopeName is empty, no scope was specified */
     NoScope = SB_IsEmpty (&ScopeName);
@@ -182,9 +185,9 @@ SymEntry* ParseScopedSymName (SymFindAction Action)
         ** search also in the upper levels.
         */
         if (NoScope && (Action & SYM_ALLOC_NEW) == 0) {
-            Sym = SymFindAny (Scope, &Ident);
+            Sym = SymFindAny (Scope, &Ident, Hash);
         } else {
-            Sym = SymFind (Scope, &Ident, Action);
+            Sym = SymFind (Scope, &Ident, Hash, Action);
         }
     } else {
         /* No scope ==> no symbol. To avoid errors in the calling routine that
@@ -192,7 +195,7 @@ SymEntry* ParseScopedSymName (SymFindAction Action)
         ** create a new symbol.
         */
         if (Action & SYM_ALLOC_NEW) {
-            Sym = NewSymEntry (&Ident, SF_NONE);
+            Sym = NewSymEntry (&Ident, Hash, SF_NONE);
         } else {
             Sym = 0;
         }
@@ -214,11 +217,12 @@ SymTable* ParseScopedSymTable (void)
 {
     StrBuf    ScopeName = STATIC_STRBUF_INITIALIZER;
     StrBuf    Name = STATIC_STRBUF_INITIALIZER;
+    unsigned  Hash;
     int       NoScope;
 
 
     /* Parse the scoped symbol name */
-    SymTable* Scope = ParseScopedIdent (&Name, &ScopeName);
+    SymTable* Scope = ParseScopedIdent (&Name, &Hash, &ScopeName);
 
     /* If ScopeName is empty, no scope was specified */
     NoScope = SB_IsEmpty (&ScopeName);
@@ -257,7 +261,7 @@ SymEntry* ParseAnySymName (SymFindAction Action)
 
     /* Distinguish cheap locals and other symbols */
     if (CurTok.Tok == TOK_LOCAL_IDENT) {
-        Sym = SymFindLocal (SymLast, &CurTok.SVal, Action);
+        Sym = SymFindLocal (SymLast, &CurTok.SVal, CurTok.Hash, Action);
         NextTok ();
     } else {
         Sym = ParseScopedSymName (Action);
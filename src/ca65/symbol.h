@@ -59,13 +59,14 @@ struct StrBuf;
 
 
 
-struct SymTable* ParseScopedIdent (struct StrBuf* Name, struct StrBuf* FullName);
+struct SymTable* ParseScopedIdent (struct StrBuf* Name, unsigned* Hash,
+                                   struct StrBuf* FullName);
 /* Parse a (possibly scoped) identifer. The scope of the name must exist and
 ** is returned as function result, while the last part (the identifier) which
 ** may be either a symbol or a scope depending on the context is returned in
-** Name. FullName is a string buffer that is used to store the full name of
-** the identifier including the scope. It is used internally and may be used
-** by the caller for error messages or similar.
+** Name, and its hash in Hash. FullName is a string buffer that is used to
+** store the full name of the identifier including the scope. It is used
+** internally and may be used by the caller for error messages or similar.
 */
 
 struct SymEntry* ParseScopedSymName (SymFindAction Action);
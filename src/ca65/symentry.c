@@ -73,8 +73,10 @@ SymEntry* SymLast = 0;
 
 
 
-SymEntry* NewSymEntry (const StrBuf* Name, unsigned Flags)
-/* Allocate a symbol table entry, initialize and return it */
+SymEntry* NewSymEntry (const StrBuf* Name, unsigned Hash, unsigned Flags)
+/* Allocate a symbol table entry, initialize and return it. Hash is the hash
+** of Name as returned by HashBuf.
+*/
 {
     unsigned I;
 
@@ -98,10 +100,12 @@ SymEntry* NewSymEntry (const StrBuf* Name, unsigned Flags)
     S->ExportId   = ~0U;
     S->Expr       = 0;
     S->ExprRefs   = AUTO_COLLECTION_INITIALIZER;
+    S->Study      = 0;
     S->ExportSize = ADDR_SIZE_DEFAULT;
     S->AddrSize   = ADDR_SIZE_DEFAULT;
     memset (S->ConDesPrio, 0, sizeof (S->ConDesPrio));
     S->Name       = GetStrBufId (Name);
+    S->Hash       = Hash;
 
     /* Insert it into the list of all entries */
     S->List = SymList;
@@ -113,13 +117,14 @@ SymEntry* NewSymEntry (const StrBuf* Name, unsigned Flags)
 
 
 
-int SymSearchTree (SymEntry* T, const StrBuf* Name, SymEntry** E)
-/* Search in the given tree for a name. If we find the symbol, the function
-** will return 0 and put the entry pointer into E. If we did not find the
-** symbol, and the tree is empty, E is set to NULL. If the tree is not empty,
-** E will be set to the last entry, and the result of the function is <0 if
-** the entry should be inserted on the left side, and >0 if it should get
-** inserted on the right side.
+int SymSearchTree (SymEntry* T, const StrBuf* Name, unsigned Hash, SymEntry** E)
+/* Search in the given tree for a name with the given hash. The tree is sorted
+** by hash first and by name second, so names are only compared if the hashes
+** match. If we find the symbol, the function will return 0 and put the entry
+** pointer into E. If we did not find the symbol, and the tree is empty, E is
+** set to NULL. If the tree is not empty, E will be set to the last entry, and
+** the result of the function is <0 if the entry should be inserted on the
+** left side, and >0 if it should get inserted on the right side.
 */
 {
     /* Is there a tree? */
@@ -131,11 +136,15 @@ int SymSearchTree (SymEntry* T, const StrBuf* Name, SymEntry** E)
     /* We have a table, search it */
     while (1) {
 
-        /* Get the symbol name */
-        const StrBuf* SymName = GetStrBuf (T->Name);
-
         /* Choose next entry */
-        int Cmp = SB_Compare (Name, SymName);
+        int Cmp;
+        if (Hash < T->Hash) {
+            Cmp = -1;
+        } else if (Hash > T->Hash) {
+            Cmp = 1;
+        } else {
+            Cmp = SB_Compare (Name, GetStrBuf (T->Name));
+        }
         if (Cmp < 0 && T->Left) {
             T = T->Left;
         } else if (Cmp > 0 && T->Right) {
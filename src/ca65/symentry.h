@@ -103,11 +103,13 @@ struct SymEntry {
     unsigned            ExportId;       /* Id of export if this is one */
     struct ExprNode*    Expr;           /* Symbol expression */
     Collection          ExprRefs;       /* Expressions using this symbol */
+    struct ExprDesc*    Study;          /* Cached result of studying Expr */
     unsigned char       ExportSize;     /* Export address size */
     unsigned char       AddrSize;       /* Address size of label */
     unsigned char       ConDesPrio[CD_TYPE_COUNT];      /* ConDes priorities... */
                                         /* ...actually value+1 (used as flag) */
     unsigned            Name;           /* Name index in global string pool */
+    unsigned            Hash;           /* Hash of the name */
 };
 
 /* List of all symbol table entries */
@@ -124,16 +126,19 @@ extern SymEntry* SymLast;
 
 
 
-SymEntry* NewSymEntry (const StrBuf* Name, unsigned Flags);
-/* Allocate a symbol table entry, initialize and return it */
+SymEntry* NewSymEntry (const StrBuf* Name, unsigned Hash, unsigned Flags);
+/* Allocate a symbol table entry, initialize and return it. Hash is the hash
+** of Name as returned by HashBuf.
+*/
 
-int SymSearchTree (SymEntry* T, const StrBuf* Name, SymEntry** E);
-/* Search in the given tree for a name. If we find the symbol, the function
-** will return 0 and put the entry pointer into E. If we did not find the
-** symbol, and the tree is empty, E is set to NULL. If the tree is not empty,
-** E will be set to the last entry, and the result of the function is <0 if
-** the entry should be inserted on the left side, and >0 if it should get
-** inserted on the right side.
+int SymSearchTree (SymEntry* T, const StrBuf* Name, unsigned Hash, SymEntry** E);
+/* Search in the given tree for a name with the given hash. The tree is sorted
+** by hash first and by name second, so names are only compared if the hashes
+** match. If we find the symbol, the function will return 0 and put the entry
+** pointer into E. If we did not find the symbol, and the tree is empty, E is
+** set to NULL. If the tree is not empty, E will be set to the last entry, and
+** the result of the function is <0 if the entry should be inserted on the
+** left side, and >0 if it should get inserted on the right side.
 */
 
 static inline void SymAddExprRef (SymEntry* Sym, struct ExprNode* Expr)
@@ -50,6 +50,7 @@
 #include "expr.h"
 #include "global.h"
 #include "objfile.h"
+#include "relax.h"
 #include "scanner.h"
 #include "segment.h"
 #include "sizeof.h"
@@ -103,7 +104,7 @@ static int IsDbgSym (const SymEntry* S)
 
 
 static unsigned ScopeTableSize (unsigned Level)
-/* Get the size of a table for the given lexical level */
+/* Get the initial size of a table for the given lexical level */
 {
     switch (Level) {
         case 0:         return 213;
@@ -114,6 +115,64 @@ static unsigned ScopeTableSize (unsigned Level)
 
 
 
+static void InsertSymEntry (SymTable* S, SymEntry* E)
+/* Insert a symbol entry that isn't in the table yet into its hash slot */
+{
+    SymEntry* T;
+    int Cmp = SymSearchTree (S->Table[E->Hash % S->TableSlots],
+                             GetStrBuf (E->Name), E->Hash, &T);
+    CHECK (Cmp != 0);
+    if (T == 0) {
+        S->Table[E->Hash % S->TableSlots] = E;
+    } else if (Cmp < 0) {
+        T->Left = E;
+    } else {
+        T->Right = E;
+    }
+}
+
+
+
+static void RehashTree (SymTable* S, SymEntry* T)
+/* Insert all entries of a tree from the old hash table into the new one */
+{
+    while (T) {
+        SymEntry* Right = T->Right;
+        RehashTree (S, T->Left);
+        T->Left  = 0;
+        T->Right = 0;
+        InsertSymEntry (S, T);
+        T = Right;
+    }
+}
+
+
+
+static void GrowSymTable (SymTable* S)
+/* Double the number of hash slots in a symbol table */
+{
+    unsigned   OldSlots = S->TableSlots;
+    SymEntry** OldTable = S->Table;
+    unsigned   I;
+
+    /* Allocate the new table. Keep the number of slots odd, since the hash
+    ** function doesn't spread the names well over the low bits.
+    */
+    S->TableSlots = OldSlots * 2 + 1;
+    S->Table      = xmalloc (S->TableSlots * sizeof (SymEntry*));
+    for (I = 0; I < S->TableSlots; ++I) {
+        S->Table[I] = 0;
+    }
+
+    /* Move the entries over */
+    for (I = 0; I < OldSlots; ++I) {
+        RehashTree (S, OldTable[I]);
+    }
+    xfree (OldTable);
+}
+
+
+
 static SymTable* NewSymTable (SymTable* Parent, const StrBuf* Name)
 /* Allocate a symbol table on the heap and return it */
 {
@@ -122,7 +181,7 @@ static SymTable* NewSymTable (SymTable* Parent, const StrBuf* Name)
     unsigned Slots = ScopeTableSize (Level);
 
     /* Allocate memory */
-    SymTable* S = xmalloc (sizeof (SymTable) + (Slots-1) * sizeof (SymEntry*));
+    SymTable* S = xmalloc (sizeof (SymTable));
 
     /* Set variables and clear hash table entries */
     S->Next         = 0;
@@ -140,6 +199,7 @@ static SymTable* NewSymTable (SymTable* Parent, const StrBuf* Name)
     S->TableEntries = 0;
     S->Parent       = Parent;
     S->Name         = GetStrBufId (Name);
+    S->Table        = xmalloc (Slots * sizeof (SymEntry*));
     while (Slots--) {
         S->Table[Slots] = 0;
     }
@@ -262,9 +322,12 @@ void SymLeaveLevel (void)
     if (CollCount (&CurrentScope->Spans) > 0) {
         const Span* S = CollAtUnchecked (&CurrentScope->Spans, 0);
         unsigned long Size = GetSpanSize (S);
-        DefSizeOfScope (CurrentScope, Size);
+        int Start = GetRelaxMarkAt (S->Seg->Num, S->Start);
+        int End   = GetRelaxMarkAt (S->Seg->Num, S->End);
+        DefSizeOfScope (CurrentScope, GenRelaxedSizeExpr (Size, Start, End));
         if (CurrentScope->Label) {
-            DefSizeOfSymbol (CurrentScope->Label, Size);
+            DefSizeOfSymbol (CurrentScope->Label,
+                             GenRelaxedSizeExpr (Size, Start, End));
         }
     }
 
@@ -327,10 +390,12 @@ SymTable* SymFindAnyScope (SymTable* Parent, const StrBuf* Name)
 
 
 
-SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, SymFindAction Action)
-/* Find a cheap local symbol. If Action contains SYM_ALLOC_NEW and the entry is
-** not found, create a new one. Return the entry found, or the new entry
-** created, or - in case Action is SYM_FIND_EXISTING - return 0.
+SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, unsigned Hash,
+                        SymFindAction Action)
+/* Find a cheap local symbol. Hash is the hash of Name as returned by HashBuf.
+** If Action contains SYM_ALLOC_NEW and the entry is not found, create a new
+** one. Return the entry found, or the new entry created, or - in case Action
+** is SYM_FIND_EXISTING - return 0.
 */
 
 {
@@ -342,14 +407,14 @@ SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, SymFindAction Acti
         /* No last global, so there's no local table */
         Error ("No preceeding global symbol");
         if (Action & SYM_ALLOC_NEW) {
-            return NewSymEntry (Name, SF_LOCAL);
+            return NewSymEntry (Name, Hash, SF_LOCAL);
         } else {
             return 0;
         }
     }
 
     /* Search for the symbol if we have a table */
-    Cmp = SymSearchTree (Parent->Locals, Name, &S);
+    Cmp = SymSearchTree (Parent->Locals, Name, Hash, &S);
 
     /* If we found an entry, return it */
     if (Cmp == 0) {
@@ -359,7 +424,7 @@ SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, SymFindAction Acti
     if (Action & SYM_ALLOC_NEW) {
 
         /* Otherwise create a new entry, insert and return it */
-        SymEntry* N = NewSymEntry (Name, SF_LOCAL);
+        SymEntry* N = NewSymEntry (Name, Hash, SF_LOCAL);
         N->Sym.Entry = Parent;
         if (S == 0) {
             Parent->Locals = N;
@@ -377,20 +442,19 @@ SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, SymFindAction Acti
 
 
 
-SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, SymFindAction Action)
-/* Find a new symbol table entry in the given table. If Action contains
-** SYM_ALLOC_NEW and the entry is not found, create a new one. Return the
-** entry found, or the new entry created, or - in case Action is
-** SYM_FIND_EXISTING - return 0.
+SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, unsigned Hash,
+                   SymFindAction Action)
+/* Find a new symbol table entry in the given table. Hash is the hash of Name
+** as returned by HashBuf. If Action contains SYM_ALLOC_NEW and the entry is
+** not found, create a new one. Return the entry found, or the new entry
+** created, or - in case Action is SYM_FIND_EXISTING - return 0.
 */
 {
     SymEntry* S;
 
-    /* Global symbol: Get the hash value for the name */
-    unsigned Hash = HashBuf (Name) % Scope->TableSlots;
-
     /* Search for the entry */
-    int Cmp = SymSearchTree (Scope->Table[Hash], Name, &S);
+    int Cmp = SymSearchTree (Scope->Table[Hash % Scope->TableSlots], Name,
+                             Hash, &S);
 
     /* If we found an entry, return it */
     if (Cmp == 0) {
@@ -406,19 +470,23 @@ SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, SymFindAction Action)
         ** already closed, mark the symbol as fixed so it won't be resolved
         ** by a symbol in the enclosing scopes later.
         */
-        SymEntry* N = NewSymEntry (Name, SF_NONE);
+        SymEntry* N = NewSymEntry (Name, Hash, SF_NONE);
         if (SymTabIsClosed (Scope)) {
             N->Flags |= SF_FIXED;
         }
         N->Sym.Tab = Scope;
         if (S == 0) {
-            Scope->Table[Hash] = N;
+            Scope->Table[Hash % Scope->TableSlots] = N;
         } else if (Cmp < 0) {
             S->Left = N;
         } else {
             S->Right = N;
         }
-        ++Scope->TableEntries;
+
+        /* Keep the trees in the hash slots short */
+        if (++Scope->TableEntries > Scope->TableSlots) {
+            GrowSymTable (Scope);
+        }
         return N;
 
     }
@@ -429,15 +497,12 @@ SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, SymFindAction Action)
 
 
 
-SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name)
-/* Find a symbol in the given or any of its parent scopes. The function will
-** never create a new symbol, since this can only be done in one specific
-** scope.
+SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name, unsigned Hash)
+/* Find a symbol in the given or any of its parent scopes. Hash is the hash of
+** Name as returned by HashBuf. The function will never create a new symbol,
+** since this can only be done in one specific scope.
 */
 {
-    /* Generate the name hash */
-    unsigned Hash = HashBuf (Name);
-
     /* Search for the symbol */
     SymEntry* Sym;
     do {
@@ -445,7 +510,7 @@ SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name)
         ** because for such symbols there is a real entry in one of the parent
         ** scopes.
         */
-        if (SymSearchTree (Scope->Table[Hash % Scope->TableSlots], Name, &Sym) == 0) {
+        if (SymSearchTree (Scope->Table[Hash % Scope->TableSlots], Name, Hash, &Sym) == 0) {
             if (Sym->Flags & SF_UNUSED) {
                 Sym = 0;
             } else {
@@ -484,7 +549,8 @@ static void SymCheckUndefined (SymEntry* S)
     if ((S->Flags & SF_FIXED) == 0) {
         SymTable* Tab = GetSymParentScope (S);
         while (Tab) {
-            Sym = SymFind (Tab, GetStrBuf (S->Name), SYM_FIND_EXISTING | SYM_CHECK_ONLY);
+            Sym = SymFind (Tab, GetStrBuf (S->Name), S->Hash,
+                           SYM_FIND_EXISTING | SYM_CHECK_ONLY);
             if (Sym && (Sym->Flags & (SF_DEFINED | SF_IMPORT)) != 0) {
                 /* We've found a symbol in a higher level that is
                 ** either defined in the source, or an import.
@@ -1036,3 +1102,20 @@ void WriteScopes (void)
     /* Done writing the scopes */
     ObjEndScopes ();
 }
+
+
+
+void SymReset (void)
+/* Remove all scopes and symbols, so another file can be assembled. The next
+** call to SymEnterLevel creates a new root scope.
+*/
+{
+    CurrentScope = 0;
+    RootScope    = 0;
+    LastScope    = 0;
+    ScopeCount   = 0;
+    ImportCount  = 0;
+    ExportCount  = 0;
+    SymList      = 0;
+    SymLast      = 0;
+}
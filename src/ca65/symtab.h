@@ -84,7 +84,7 @@ struct SymTable {
     unsigned            TableSlots;     /* Number of hash table slots */
     unsigned            TableEntries;   /* Number of entries in the table */
     unsigned            Name;           /* Name of the scope */
-    SymEntry*           Table[1];       /* Dynamic allocation */
+    SymEntry**          Table;          /* Hash table, grows with entries */
 };
 
 /* Symbol tables */
@@ -115,23 +115,26 @@ SymTable* SymFindAnyScope (SymTable* Parent, const StrBuf* Name);
 ** scope.
 */
 
-SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, SymFindAction Action);
-/* Find a cheap local symbol. If Action contains SYM_ALLOC_NEW and the entry is
-** not found, create a new one. Return the entry found, or the new entry
-** created, or - in case Action is SYM_FIND_EXISTING - return 0.
+SymEntry* SymFindLocal (SymEntry* Parent, const StrBuf* Name, unsigned Hash,
+                        SymFindAction Action);
+/* Find a cheap local symbol. Hash is the hash of Name as returned by HashBuf.
+** If Action contains SYM_ALLOC_NEW and the entry is not found, create a new
+** one. Return the entry found, or the new entry created, or - in case Action
+** is SYM_FIND_EXISTING - return 0.
 */
 
-SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, SymFindAction Action);
-/* Find a new symbol table entry in the given table. If Action contains
-** SYM_ALLOC_NEW and the entry is not found, create a new one. Return the
-** entry found, or the new entry created, or - in case Action is
-** SYM_FIND_EXISTING - return 0.
+SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, unsigned Hash,
+                   SymFindAction Action);
+/* Find a new symbol table entry in the given table. Hash is the hash of Name
+** as returned by HashBuf. If Action contains SYM_ALLOC_NEW and the entry is
+** not found, create a new one. Return the entry found, or the new entry
+** created, or - in case Action is SYM_FIND_EXISTING - return 0.
 */
 
-SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name);
-/* Find a symbol in the given or any of its parent scopes. The function will
-** never create a new symbol, since this can only be done in one specific
-** scope.
+SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name, unsigned Hash);
+/* Find a symbol in the given or any of its parent scopes. Hash is the hash of
+** Name as returned by HashBuf. The function will never create a new symbol,
+** since this can only be done in one specific scope.
 */
 
 static inline unsigned char GetSymTabType (const SymTable* S)
@@ -164,6 +167,11 @@ void WriteDbgSyms (void);
 void WriteScopes (void);
 /* Write the scope table to the object file */
 
+void SymReset (void);
+/* Remove all scopes and symbols, so another file can be assembled. The next
+** call to SymEnterLevel creates a new root scope.
+*/
+
 
 
 /* End of symtab.h */
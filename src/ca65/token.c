@@ -301,6 +301,7 @@ void CopyToken (Token* Dst, const Token* Src)
     Dst->WS   = Src->WS;
     Dst->IVal = Src->IVal;
     SB_Copy (&Dst->SVal, &Src->SVal);
+    Dst->Hash = Src->Hash;
     Dst->Pos  = Src->Pos;
 }
 
@@ -301,6 +301,7 @@ struct Token {
     int         WS;             /* Flag for "whitespace before token" */
     long        IVal;           /* Integer attribute value */
     StrBuf      SVal;           /* String attribute value */
+    unsigned    Hash;           /* Hash of SVal for identifiers */
     FilePos     Pos;            /* Position from which token was read */
 };
 
@@ -310,6 +311,7 @@ struct Token {
     0,                                  \
     0,                                  \
     STATIC_STRBUF_INITIALIZER,          \
+    0,                                  \
     STATIC_FILEPOS_INITIALIZER          \
 }
 
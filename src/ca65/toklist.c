@@ -305,3 +305,13 @@ void PushTokList (TokList* List, const char* Desc)
     ++PushCounter;
     PushInput (ReplayTokList, List, Desc);
 }
+
+
+
+void ResetTokLists (void)
+/* Reset the nesting counter of pushed token lists, so another file can be
+** assembled.
+*/
+{
+    PushCounter = 0;
+}
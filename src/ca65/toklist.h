@@ -124,6 +124,11 @@ void PushTokList (TokList* List, const char* Desc);
 ** PushInput directly.
 */
 
+void ResetTokLists (void);
+/* Reset the nesting counter of pushed token lists, so another file can be
+** assembled.
+*/
+
 
 
 /* End of toklist.h */
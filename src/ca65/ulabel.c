@@ -227,3 +227,12 @@ void ULabDone (void)
         ReleaseFullLineInfo (&L->LineInfos);
     }
 }
+
+
+
+void ULabReset (void)
+/* Remove all unnamed labels, so another file can be assembled */
+{
+    CollDeleteAll (&ULabList);
+    ULabDefCount = 0;
+}
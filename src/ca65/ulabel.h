@@ -69,6 +69,9 @@ void ULabDone (void);
 ** necessary cleanups.
 */
 
+void ULabReset (void);
+/* Remove all unnamed labels, so another file can be assembled */
+
 
 
 /* End of ulabel.h */
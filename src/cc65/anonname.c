@@ -53,6 +53,9 @@
 
 static const char AnonTag[] = "$anon";
 
+/* Counter for anonymous names */
+static unsigned ACount = 0;
+
 
 
 /*****************************************************************************/
@@ -77,7 +80,6 @@ char* AnonName (char* Buf, const char* Spec)
 ** to be IDENTSIZE characters long. A pointer to the buffer is returned.
 */
 {
-    static unsigned ACount = 0;
     xsprintf (Buf, IDENTSIZE, "%s-%s-%04X", AnonTag, Spec, ++ACount);
     return Buf;
 }
@@ -89,3 +91,33 @@ int IsAnonName (const char* Name)
 {
     return (strncmp (Name, AnonTag, sizeof (AnonTag) - 1) == 0);
 }
+
+
+
+unsigned GetAnonCount (void)
+/* Return the number of anonymous names generated so far */
+{
+    return ACount;
+}
+
+
+
+void SetAnonCount (unsigned Count)
+/* Continue numbering anonymous names after Count. The counter is never moved
+** backwards.
+*/
+{
+    if (Count > ACount) {
+        ACount = Count;
+    }
+}
+
+
+
+void ResetAnonNames (void)
+/* Start numbering anonymous names from the beginning, so another translation
+** unit can be compiled.
+*/
+{
+    ACount = 0;
+}
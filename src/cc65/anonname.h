@@ -57,6 +57,19 @@ char* AnonName (char* Buf, const char* Spec);
 int IsAnonName (const char* Name);
 /* Check if the given symbol name is that of an anonymous symbol */
 
+unsigned GetAnonCount (void);
+/* Return the number of anonymous names generated so far */
+
+void SetAnonCount (unsigned Count);
+/* Continue numbering anonymous names after Count. The counter is never moved
+** backwards.
+*/
+
+void ResetAnonNames (void);
+/* Start numbering anonymous names from the beginning, so another translation
+** unit can be compiled.
+*/
+
 
 
 /* End of anonname.h */
@@ -54,6 +54,9 @@
 
 static struct SegContext* CurrentFunctionSegment;
 
+/* Number to generate unique literal labels */
+static unsigned NextLiteralLabel = 0;
+
 
 
 /*****************************************************************************/
@@ -70,6 +73,15 @@ void UseLabelPoolFromSegments (struct SegContext* Seg)
 
 
 
+void ResetLabels (void)
+/* Start the label numbers over, so another translation unit can be compiled */
+{
+    CurrentFunctionSegment = 0;
+    NextLiteralLabel       = 0;
+}
+
+
+
 unsigned GetLocalLabel (void)
 /* Get an unused assembler label for the function. Will never return zero. */
 {
@@ -150,16 +162,13 @@ const char* LocalDataLabelName (unsigned L)
 unsigned GetPooledLiteralLabel (void)
 /* Get an unused literal label. Will never return zero. */
 {
-    /* Number to generate unique labels */
-    static unsigned NextLabel = 0;
-
     /* Check for an overflow */
-    if (NextLabel >= 0xFFFF) {
+    if (NextLiteralLabel >= 0xFFFF) {
         Internal ("Literal label overflow");
     }
 
     /* Return the next label */
-    return ++NextLabel;
+    return ++NextLiteralLabel;
 }
 
 
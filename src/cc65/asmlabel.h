@@ -57,6 +57,9 @@ struct SegContext;
 void UseLabelPoolFromSegments (struct SegContext* Seg);
 /* Use the info in segments for generating new label numbers */
 
+void ResetLabels (void);
+/* Start the label numbers over, so another translation unit can be compiled */
+
 unsigned GetLocalLabel (void);
 /* Get an unused assembler label for the function. Will never return zero. */
 
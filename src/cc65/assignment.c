@@ -40,9 +40,11 @@
 #include "datatype.h"
 #include "error.h"
 #include "expr.h"
+#include "global.h"
 #include "loadexpr.h"
 #include "scanner.h"
 #include "stackptr.h"
+#include "stdfunc.h"
 #include "stdnames.h"
 #include "symentry.h"
 #include "typecmp.h"
@@ -65,19 +67,25 @@ static void CopyStruct (ExprDesc* LExpr, ExprDesc* RExpr)
     const Type* ltype  = LExpr->Type;
     const Type* stype  = GetStructReplacementType (ltype);
     int         UseReg = (stype != ltype);
+    CodeMark    Start;
+    CodeMark    Pushed;
+    CodeMark    End;
 
     if (UseReg) {
         /* Back up the address of lhs only if it is in the primary */
         PushAddr (LExpr);
     } else {
         /* Push the address of lhs as the destination of memcpy */
+        GetCodePos (&Start);
         ED_AddrExpr (LExpr);
         LoadExpr (CF_NONE, LExpr);
         g_push (CF_PTR | CF_UNSIGNED, 0);
+        GetCodePos (&Pushed);
     }
 
     /* Get the expression on the right of the '=' */
     hie1 (RExpr);
+    GetCodePos (&End);
 
     /* Check for equality of the structs/unions */
     if (TypeCmp (ltype, RExpr->Type).C < TC_STRICT_COMPATIBLE) {
@@ -102,6 +110,28 @@ static void CopyStruct (ExprDesc* LExpr, ExprDesc* RExpr)
         /* Value is in primary as an rvalue */
         ED_FinalizeRValLoad (LExpr);
 
+    } else if (IS_Get (&InlineStdFuncs)                         &&
+               SizeOf (ltype) <= 256                            &&
+               ED_IsConstAddr (LExpr)                           &&
+               ED_IsLVal (RExpr)                                &&
+               ED_IsLocConst (RExpr)                            &&
+               CodeRangeIsEmpty (&Pushed, &End)) {
+
+        /* Both structs are at constant addresses and the rhs didn't generate
+        ** any code, so copy them inline instead of calling memcpy.
+        */
+        ExprDesc Src = *RExpr;
+        ED_AddrExpr (&Src);
+
+        /* Drop the push of the lhs address */
+        RemoveCode (&Start);
+
+        /* Generate the copy code */
+        AddCopyCode (LExpr, &Src, SizeOf (ltype), 0);
+
+        /* Restore the lhs */
+        ED_IndExpr (LExpr);
+
     } else {
 
         /* Load the address of rhs into the primary */
@@ -758,6 +788,7 @@ void OpAddSubAssign (const GenDesc* Gen, ExprDesc *Expr, const char* Op)
         case E_LOC_REGISTER:
         case E_LOC_LITERAL:
         case E_LOC_CODE:
+        case E_LOC_ZPARG:
             /* Absolute numeric addressed variable, global variable, local
             ** static variable, register variable, pooled literal or code
             ** label location.
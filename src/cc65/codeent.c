@@ -593,7 +593,9 @@ void PreparseArg (CodeEntry* E)
 
     /* Parse the argument string */
     if (ParseOpcArgStr (E->Arg, &E->ArgInfo, &B, &E->ArgOff)) {
+        /* Keep the name, the cooked buffer is not needed */
         E->ArgBase = SB_GetBuf (&B);
+        xfree (SB_GetCooked (&B));
 
         if ((E->ArgInfo & (AIF_HAS_NAME | AIF_HAS_OFFSET)) == AIF_HAS_OFFSET) {
             E->Flags |= CEF_NUMARG;
@@ -156,6 +156,11 @@ static const char* GetLabelName (unsigned Flags, uintptr_t Label, long Offs)
             xsprintf (Buf, sizeof (Buf), "regbank+%u", (unsigned)((Label+Offs) & 0xFFFF));
             break;
 
+        case CF_ZPARG:
+            /* Parameter in the zero page argument block */
+            xsprintf (Buf, sizeof (Buf), "zpargs+%u", (unsigned)((Label+Offs) & 0xFFFF));
+            break;
+
         case CF_CODE:
             /* Code label location */
             if (Offs) {
@@ -227,6 +232,11 @@ void g_preamble (void)
     ** the stack pointer.  Don't worry, the preprocessor will concatenate them.
     */
     AddTextLine ("\t.importzp\ttmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4");
+    if (ZPArgsInZP) {
+        AddTextLine ("\t.importzp\tzpargs");
+    } else {
+        AddTextLine ("\t.import\t\tzpargs");
+    }
 
     /* Define long branch macros */
     AddTextLine ("\t.macpack\tlongbranch");
@@ -707,6 +717,36 @@ void g_restore_regvars (int StackOffs, int RegOffs, unsigned Bytes)
 
 
 
+/*****************************************************************************/
+/*                        Zero page argument block                           */
+/*****************************************************************************/
+
+
+
+void g_pushzpargs (unsigned Bytes)
+/* Push the given number of bytes from the zero page argument block onto the
+** stack. The primary register is preserved.
+*/
+{
+    AddCodeLine ("ldy #$%02X", Bytes);
+    AddCodeLine ("jsr pushzpargs");
+    StackPtr -= Bytes;
+}
+
+
+
+void g_popzpargs (unsigned Bytes)
+/* Pop the given number of bytes from the stack into the zero page argument
+** block. The primary register including sreg is preserved.
+*/
+{
+    AddCodeLine ("ldy #$%02X", Bytes);
+    AddCodeLine ("jsr popzpargs");
+    StackPtr += Bytes;
+}
+
+
+
 /*****************************************************************************/
 /*                           Fetching memory cells                           */
 /*****************************************************************************/
@@ -88,6 +88,7 @@
 #define CF_ABSOLUTE     0x1000  /* Numeric absolute address */
 #define CF_EXTERNAL     0x2000  /* External */
 #define CF_REGVAR       0x4000  /* Register variable */
+#define CF_ZPARG        0x5000  /* Parameter in zero page arg block */
 #define CF_LITERAL      0x7000  /* Literal */
 #define CF_PRIMARY      0x8000  /* Value is in primary register */
 #define CF_EXPR         0x9000  /* Value is addressed by primary register */
@@ -269,6 +270,24 @@ void g_restore_regvars (int StackOffs, int RegOffs, unsigned Bytes);
 
 
 
+/*****************************************************************************/
+/*                        Zero page argument block                           */
+/*****************************************************************************/
+
+
+
+void g_pushzpargs (unsigned Bytes);
+/* Push the given number of bytes from the zero page argument block onto the
+** stack. The primary register is preserved.
+*/
+
+void g_popzpargs (unsigned Bytes);
+/* Pop the given number of bytes from the stack into the zero page argument
+** block. The primary register including sreg is preserved.
+*/
+
+
+
 /*****************************************************************************/
 /*                           Fetching memory cells                           */
 /*****************************************************************************/
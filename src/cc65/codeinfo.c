@@ -216,6 +216,7 @@ static const FuncInfo FuncInfoTable[] = {
     { "popa",       SLV_TOP,            PSTATE_ALL | REG_SP | REG_AY                },
     { "popax",      SLV_TOP,            PSTATE_ALL | REG_SP | REG_AXY               },
     { "popeax",     SLV_TOP,            PSTATE_ALL | REG_SP | REG_EAXY              },
+    { "popzpargs",  SLV_IND | REG_Y,    PSTATE_ALL | REG_SP | REG_Y | REG_TMP1      },
     { "push0",      REG_SP,             PSTATE_ALL | REG_SP | REG_AXY               },
     { "push0ax",    REG_SP | REG_AX,    PSTATE_ALL | REG_SP | REG_Y | REG_SREG      },
     { "push1",      REG_SP,             PSTATE_ALL | REG_SP | REG_AXY               },
@@ -240,6 +241,7 @@ static const FuncInfo FuncInfoTable[] = {
     { "pushw0sp",   SLV_TOP,            PSTATE_ALL | REG_SP | REG_AXY               },
     { "pushwidx",   REG_SP | REG_AXY,   PSTATE_ALL | REG_SP | REG_AXY | REG_PTR1    },
     { "pushwysp",   SLV_IND | REG_Y,    PSTATE_ALL | REG_SP | REG_AXY               },
+    { "pushzpargs", REG_SP | REG_Y,     PSTATE_ALL | REG_SP | REG_Y                 },
     { "regswap",    REG_AXY,            PSTATE_ALL | REG_AXY | REG_TMP1             },
     { "regswap1",   REG_XY,             PSTATE_ALL | REG_A                          },
     { "regswap2",   REG_XY,             PSTATE_ALL | REG_A | REG_Y                  },
@@ -551,7 +553,7 @@ fncls_t GetFuncInfo (const char* Name, unsigned int* Use, unsigned int* Chg)
                             default:
                                 *Use = REG_EAX;
                         }
-                        if (D->ParamCount > 1) {
+                        if (D->ParamCount > 1 && (D->Flags & FD_ZPARGS) == 0) {
                             /* Passes other params on the stack */
                             *Use |= REG_SP | SLV_TOP;
                         }
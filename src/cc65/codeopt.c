@@ -431,6 +431,24 @@ void EnableOpt (const char* Name)
 
 
 
+void ResetOptSteps (void)
+/* Enable all optimization steps again and clear their statistics, so another
+** translation unit can be compiled with the default settings.
+*/
+{
+    unsigned I;
+    for (I = 0; I < OPTFUNC_COUNT; ++I) {
+        OptFunc* F = OptFuncs[I];
+        F->TotalRuns    = 0;
+        F->LastRuns     = 0;
+        F->TotalChanges = 0;
+        F->LastChanges  = 0;
+        F->Disabled     = 0;
+    }
+}
+
+
+
 void ListOptSteps (FILE* F)
 /* List all optimization steps */
 {
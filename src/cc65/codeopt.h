@@ -55,6 +55,11 @@ void DisableOpt (const char* Name);
 void EnableOpt (const char* Name);
 /* Enable the optimization with the given name */
 
+void ResetOptSteps (void);
+/* Enable all optimization steps again and clear their statistics, so another
+** translation unit can be compiled with the default settings.
+*/
+
 void ListOptSteps (FILE* F);
 /* List all optimization steps */
 
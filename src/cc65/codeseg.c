@@ -541,6 +541,35 @@ CodeSeg* NewCodeSeg (const char* SegName, SymEntry* Func)
 
 
 
+void FreeCodeSeg (CodeSeg* S)
+/* Free a code segment including its entries and labels */
+{
+    unsigned I;
+
+    /* Free the entries */
+    for (I = 0; I < CollCount (&S->Entries); ++I) {
+        FreeCodeEntry (CollAtUnchecked (&S->Entries, I));
+    }
+    DoneCollection (&S->Entries);
+
+    /* All labels of the segment are in the hash table */
+    for (I = 0; I < sizeof(S->LabelHash) / sizeof(S->LabelHash[0]); ++I) {
+        CodeLabel* L = S->LabelHash[I];
+        while (L) {
+            CodeLabel* Next = L->Next;
+            FreeCodeLabel (L);
+            L = Next;
+        }
+    }
+    DoneCollection (&S->Labels);
+
+    /* Free the segment itself */
+    xfree (S->SegName);
+    xfree (S);
+}
+
+
+
 void CS_AddEntry (CodeSeg* S, struct CodeEntry* E)
 /* Add an entry to the given code segment */
 {
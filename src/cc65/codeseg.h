@@ -96,6 +96,9 @@ struct CodeSeg {
 CodeSeg* NewCodeSeg (const char* SegName, SymEntry* Func);
 /* Create a new code segment, initialize and return it */
 
+void FreeCodeSeg (CodeSeg* S);
+/* Free a code segment including its entries and labels */
+
 void CS_AddEntry (CodeSeg* S, struct CodeEntry* E);
 /* Add an entry to the given code segment */
 
@@ -61,6 +61,7 @@
 #include "litpool.h"
 #include "macrotab.h"
 #include "output.h"
+#include "pch.h"
 #include "pragma.h"
 #include "preproc.h"
 #include "standard.h"
@@ -483,9 +484,23 @@ void Compile (const char* FileName)
     /* Init preprocessor */
     InitPreprocess ();
 
+    /* Remember the environment a precompiled header is created or used in.
+    ** Opening the main file adds to the include paths, so do this first.
+    */
+    if (CreatePCH || (SB_NotEmpty (&PCHName) && !PreprocessOnly)) {
+        BeginPCH ();
+    }
+
     /* Open the input file */
     OpenMainFile (FileName);
 
+    /* Read the precompiled header given on the command line. It is used
+    ** when the first #include reads the header it was created from.
+    */
+    if (SB_NotEmpty (&PCHName) && !PreprocessOnly) {
+        LoadPCH (SB_GetConstBuf (&PCHName));
+    }
+
     /* Are we supposed to compile or just preprocess the input? */
     if (PreprocessOnly) {
 
@@ -68,6 +68,20 @@ DataSeg* NewDataSeg (const char* Name, SymEntry* Func)
 
 
 
+void FreeDataSeg (DataSeg* S)
+/* Free a data segment including its lines */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&S->Lines); ++I) {
+        xfree (CollAtUnchecked (&S->Lines, I));
+    }
+    DoneCollection (&S->Lines);
+    xfree (S->SegName);
+    xfree (S);
+}
+
+
+
 void DS_Append (DataSeg* Target, const DataSeg* Source)
 /* Append the data from Source to Target */
 {
@@ -73,6 +73,9 @@ struct DataSeg {
 DataSeg* NewDataSeg (const char* SegName, SymEntry* Func);
 /* Create a new data segment, initialize and return it */
 
+void FreeDataSeg (DataSeg* S);
+/* Free a data segment including its lines */
+
 void DS_Append (DataSeg* Target, const DataSeg* Source);
 /* Append the data from Source to Target. */
 
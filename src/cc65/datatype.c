@@ -1092,7 +1092,19 @@ int IsFastcallFunc (const Type* T)
         /* Pointer to function */
         ++T;
     }
-    return !IsVariadicFunc (T) && (AutoCDecl ? IsQualFastcall (T) : !IsQualCDecl (T));
+    return !IsVariadicFunc (T) &&
+           (IsZPArgsFunc (T) || (AutoCDecl ? IsQualFastcall (T) : !IsQualCDecl (T)));
+}
+
+
+
+int IsZPArgsFunc (const Type* T)
+/* Return true if this is a function type or pointer to function type that
+** passes its parameters in the zero page argument block.
+** Check fails if the type is not a function or a pointer to function.
+*/
+{
+    return (GetFuncDesc (T)->Flags & FD_ZPARGS) != 0;
 }
 
 
@@ -1484,6 +1496,11 @@ static struct StrBuf* GetFullTypeNameWestEast (struct StrBuf* West, struct StrBu
             }
         }
 
+        /* The calling convention attribute is part of the type */
+        if ((D->Flags & FD_ZPARGS) != 0) {
+            SB_AppendStr (&Buf, "__attribute__ ((zpargs)) ");
+        }
+
         if (SB_IsEmpty (West)) {
             /* Use no parentheses */
             SB_Terminate (&Buf);
@@ -1667,6 +1684,9 @@ void PrintFuncSig (FILE* F, const char* Name, const Type* T)
         /* Append a space between the qualifiers and the name */
         SB_AppendChar (&Buf, ' ');
     }
+    if ((D->Flags & FD_ZPARGS) != 0) {
+        SB_AppendStr (&Buf, "__attribute__ ((zpargs)) ");
+    }
     SB_Terminate (&Buf);
 
     /* Get the signature string without the return type */
@@ -786,6 +786,12 @@ int IsFastcallFunc (const Type* T) attribute ((const));
 ** Check fails if the type is not a function or a pointer to function.
 */
 
+int IsZPArgsFunc (const Type* T) attribute ((const));
+/* Return true if this is a function type or pointer to function type that
+** passes its parameters in the zero page argument block.
+** Check fails if the type is not a function or a pointer to function.
+*/
+
 FuncDesc* GetFuncDesc (const Type* T) attribute ((const));
 /* Get the FuncDesc pointer from a function or pointer-to-function type */
 
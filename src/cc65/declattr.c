@@ -39,6 +39,7 @@
 #include "xmalloc.h"
 
 /* cc65 */
+#include "datatype.h"
 #include "declare.h"
 #include "declattr.h"
 #include "error.h"
@@ -57,6 +58,7 @@
 /* Forwards for attribute handlers */
 static void NoReturnAttr (Declarator* D);
 static void UnusedAttr (Declarator* D);
+static void ZPArgsAttr (Declarator* D);
 
 
 
@@ -69,8 +71,10 @@ struct AttrDesc {
 static const AttrDesc AttrTable [] = {
     { "__noreturn__",   NoReturnAttr    },
     { "__unused__",     UnusedAttr      },
+    { "__zpargs__",     ZPArgsAttr      },
     { "noreturn",       NoReturnAttr    },
     { "unused",         UnusedAttr      },
+    { "zpargs",         ZPArgsAttr      },
 };
 
 
@@ -177,6 +181,41 @@ static void UnusedAttr (Declarator* D)
 
 
 
+static void ZPArgsAttr (Declarator* D)
+/* Parse the "zpargs" attribute */
+{
+    const Type* T = D->Type;
+    FuncDesc*   F;
+
+    /* The attribute changes the calling convention, so it is only valid for
+    ** functions and pointers to functions.
+    */
+    if (!IsTypeFuncLike (T)) {
+        Error ("Attribute 'zpargs' only applies to functions");
+        return;
+    }
+    if (IsTypeFuncPtr (T)) {
+        ++T;
+    }
+    F = GetFuncDesc (T);
+
+    /* The arguments are placed by the caller, so we need a prototype. The
+    ** rightmost parameter is passed in the primary register as with
+    ** __fastcall__, so variadic and __cdecl__ functions are not possible.
+    */
+    if ((F->Flags & (FD_EMPTY | FD_OLDSTYLE)) != 0) {
+        Error ("Attribute 'zpargs' requires a function prototype");
+    } else if ((F->Flags & FD_VARIADIC) != 0) {
+        Error ("Variadic functions cannot have attribute 'zpargs'");
+    } else if (IsQualCDecl (T)) {
+        Error ("__cdecl__ functions cannot have attribute 'zpargs'");
+    } else {
+        F->Flags |= FD_ZPARGS;
+    }
+}
+
+
+
 void ParseAttribute (Declarator* D)
 /* Parse an additional __attribute__ modifier */
 {
@@ -38,6 +38,7 @@
 #include <stdarg.h>
 
 /* common */
+#include "abend.h"
 #include "coll.h"
 #include "debugflag.h"
 #include "print.h"
@@ -203,7 +204,7 @@ void Fatal_ (const char* file, int line, const char* Format, ...)
     if (Line) {
         Print (stderr, 1, "Input: %.*s\n", (int) SB_GetLen (Line), SB_GetConstBuf (Line));
     }
-    exit (EXIT_FAILURE);
+    Terminate (EXIT_FAILURE);
 }
 
 
@@ -594,6 +595,21 @@ void ErrorReport (void)
 
 
 
+void ResetDiagnosticCounts (void)
+/* Reset the error and warning counts, so another translation unit can be
+** compiled.
+*/
+{
+    PPErrorCount     = 0;
+    PPWarningCount   = 0;
+    ErrorCount       = 0;
+    WarningCount     = 0;
+    RecentLineNo     = 0;
+    RecentErrorCount = 0;
+}
+
+
+
 /*****************************************************************************/
 /*                              Tracked StrBufs                              */
 /*****************************************************************************/
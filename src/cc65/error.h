@@ -177,6 +177,11 @@ unsigned GetTotalWarnings (void);
 void ErrorReport (void);
 /* Report errors (called at end of compile) */
 
+void ResetDiagnosticCounts (void);
+/* Reset the error and warning counts, so another translation unit can be
+** compiled.
+*/
+
 void InitDiagnosticStrBufs (void);
 /* Init tracking string buffers used for diagnostics */
 
@@ -95,6 +95,7 @@ unsigned CG_AddrModeFlags (const ExprDesc* Expr)
         case E_LOC_EXPR:        return CF_EXPR;
         case E_LOC_LITERAL:     return CF_LITERAL;
         case E_LOC_CODE:        return CF_CODE;
+        case E_LOC_ZPARG:       return CF_ZPARG;
         default:
             Internal ("CG_AddrModeFlags: Invalid location flags value: 0x%04X", Expr->Flags);
             /* NOTREACHED */
@@ -535,6 +536,7 @@ static void DoInc (ExprDesc* Expr, unsigned KeepResult)
             case E_LOC_REGISTER:
             case E_LOC_LITERAL:
             case E_LOC_CODE:
+            case E_LOC_ZPARG:
                 /* Global variabl, static variable, register variable, pooled
                 ** literal or code label location.
                 */
@@ -622,6 +624,7 @@ static void DoDec (ExprDesc* Expr, unsigned KeepResult)
             case E_LOC_REGISTER:
             case E_LOC_LITERAL:
             case E_LOC_CODE:
+            case E_LOC_ZPARG:
                 /* Global variabl, static variable, register variable, pooled
                 ** literal or code label location.
                 */
@@ -775,10 +778,24 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
     unsigned  FrameParams = 0;  /* Number of parameters in frame */
     int       FrameOffs   = 0;  /* Offset into parameter frame */
     int       Ellipsis    = 0;  /* Function is variadic */
+    int       ZPArgs      = 0;  /* Pass arguments in the zero page block */
+    int       ZPDirect    = 0;  /* Store directly into the zero page block */
+    unsigned  ZPStaged    = 0;  /* Bytes pushed for the zero page block */
 
     /* Make sure the size of all parameters are known */
     int ParamComplete = F_CheckParamList (Func, 1);
 
+    /* Arguments of a zpargs function (except the last one) go into the zero
+    ** page argument block. If the block isn't in use, they are stored there
+    ** as they come. Otherwise its current contents may still be needed while
+    ** evaluating the arguments, so they are pushed and moved into the block
+    ** right before the call.
+    */
+    if ((Func->Flags & FD_ZPARGS) != 0 && ParamComplete && CurrentFunc != 0) {
+        ZPArgs   = 1;
+        ZPDirect = (CurrentFunc->ZPArgsLive == 0);
+    }
+
     /* As an optimization, we may allocate the complete parameter frame at
     ** once instead of pushing into each parameter as it comes. We may do that,
     ** if...
@@ -792,7 +809,7 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
     ** (instead of pushing) is enabled.
     **
     */
-    if (ParamComplete && IS_Get (&CodeSizeFactor) >= 200) {
+    if (ParamComplete && !ZPArgs && IS_Get (&CodeSizeFactor) >= 200) {
         /* Calculate the number and size of the parameters */
         FrameParams = Func->ParamCount;
         FrameSize   = Func->ParamSize;
@@ -902,7 +919,15 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
             if ((CurTok.Tok == TOK_COMMA && NextTok.Tok != TOK_RPAREN) || !IsFastcall) {
                 unsigned ArgSize = sizeofarg (Flags);
 
-                if (FrameSize > 0) {
+                if (ZPDirect && !Ellipsis) {
+                    /* Store into the zero page argument block. These bytes
+                    ** must be saved by calls in the remaining arguments.
+                    */
+                    g_putstatic (Flags | CF_ZPARG, Param->V.Offs, 0);
+                    if (CurrentFunc->ZPArgsLive < Param->V.Offs + ArgSize) {
+                        CurrentFunc->ZPArgsLive = Param->V.Offs + ArgSize;
+                    }
+                } else if (FrameSize > 0) {
                     /* We have the space already allocated, store in the frame.
                     ** Because of invalid type conversions (that have produced an
                     ** error before), we can end up here with a non-aligned stack
@@ -923,7 +948,11 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
                 }
 
                 /* Calculate total parameter size */
-                PushedSize += ArgSize;
+                if (!ZPArgs || Ellipsis) {
+                    PushedSize += ArgSize;
+                } else if (!ZPDirect) {
+                    ZPStaged += ArgSize;
+                }
             }
         }
 
@@ -950,6 +979,15 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
     */
     DoDeferred (IsFastcall && PushedCount > 0 ? SQP_KEEP_EAX : SQP_KEEP_NONE, &Expr);
 
+    /* Finish the zero page argument block */
+    if (ZPStaged > 0) {
+        /* Move the pushed arguments into the block */
+        g_popzpargs (ZPStaged);
+    } else if (ZPDirect) {
+        /* The block is owned by the called function from now on */
+        CurrentFunc->ZPArgsLive = 0;
+    }
+
     /* Check if we had enough arguments */
     if (PushedCount < Func->ParamCount) {
         Error ("Too few arguments in function call");
@@ -968,6 +1006,20 @@ static unsigned FunctionArgList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
 
 
 
+static unsigned SaveZPArgs (void)
+/* Save the part of the zero page argument block that is in use, since the
+** called function may use the block itself. Return the number of bytes saved.
+*/
+{
+    unsigned Bytes = (CurrentFunc != 0)? CurrentFunc->ZPArgsLive : 0;
+    if (Bytes > 0) {
+        g_pushzpargs (Bytes);
+    }
+    return Bytes;
+}
+
+
+
 static void FunctionCall (ExprDesc* Expr)
 /* Perform a function call. */
 {
@@ -978,6 +1030,7 @@ static void FunctionCall (ExprDesc* Expr)
     int           PtrOffs = 0;    /* Offset of function pointer on stack */
     int           IsFastcall = 0; /* True if we are fast-calling the function */
     int           PtrOnStack = 0; /* True if a pointer copy is on stack */
+    unsigned      ZPSave = 0;     /* Bytes of zero page arg block saved */
     const Type*   ReturnType;
 
     /* Skip the left paren */
@@ -998,6 +1051,9 @@ static void FunctionCall (ExprDesc* Expr)
         IsFastcall = (Func->ParamCount > 0 || (Func->Flags & FD_EMPTY) != 0) &&
                      IsFastcallFunc (Expr->Type + 1);
 
+        /* Save the zero page argument block if needed */
+        ZPSave = SaveZPArgs ();
+
         /* Things may be difficult, depending on where the function pointer
         ** resides. If the function pointer is an expression of some sort
         ** (not a local or global variable), we have to evaluate this
@@ -1043,6 +1099,9 @@ static void FunctionCall (ExprDesc* Expr)
         /* If we didn't inline the function, get fastcall info */
         IsFastcall = (Func->ParamCount > 0 || (Func->Flags & FD_EMPTY) != 0) &&
                      IsFastcallFunc (Expr->Type);
+
+        /* Save the zero page argument block if needed */
+        ZPSave = SaveZPArgs ();
     }
 
     /* Parse the argument list and pass them to the called function */
@@ -1156,6 +1215,11 @@ static void FunctionCall (ExprDesc* Expr)
 
     }
 
+    /* Restore the zero page argument block */
+    if (ZPSave > 0) {
+        g_popzpargs (ZPSave);
+    }
+
     /* The function result is an rvalue in the primary register */
     ED_FinalizeRValLoad (Expr);
     ReturnType = GetFuncReturnType (Expr->Type);
@@ -1255,6 +1319,11 @@ static void Primary (ExprDesc* E)
                         /* Variadic parameter */
                         g_leavariadic (Sym->V.Offs - F_GetParamSize (CurrentFunc));
                         E->Flags = E_LOC_EXPR | E_RTYPE_LVAL;
+                    } else if ((Sym->Flags & SC_PARAM) == SC_PARAM &&
+                               F_IsZPParam (CurrentFunc, Sym)) {
+                        /* Parameter in the zero page argument block */
+                        E->Flags = E_LOC_ZPARG | E_RTYPE_LVAL;
+                        E->Name  = Sym->V.Offs;
                     } else {
                         /* Normal parameter */
                         E->Flags = E_LOC_STACK | E_RTYPE_LVAL;
@@ -1695,6 +1764,7 @@ void Store (ExprDesc* Expr, const Type* StoreType)
         case E_LOC_REGISTER:
         case E_LOC_LITERAL:
         case E_LOC_CODE:
+        case E_LOC_ZPARG:
             /* Global variabl, static variable, register variable, pooled
             ** literal or code label location.
             */
@@ -2062,6 +2132,13 @@ void hie10 (ExprDesc* Expr)
         case TOK_AND:
             NextToken ();
             ExprWithCheck (hie10, Expr);
+            /* Parameters in the zero page argument block are saved and
+            ** restored around calls, so writes through a pointer to them
+            ** would get lost.
+            */
+            if (ED_IsLocZPArg (Expr)) {
+                Error ("Cannot take the address of a parameter passed in zero page");
+            }
             /* The & operator may be applied to any lvalue, and it may be
             ** applied to functions and arrays, even if they're not lvalues.
             */
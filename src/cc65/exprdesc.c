@@ -42,6 +42,7 @@
 #include "datatype.h"
 #include "error.h"
 #include "exprdesc.h"
+#include "global.h"
 #include "stackptr.h"
 #include "symentry.h"
 
@@ -108,6 +109,11 @@ const char* ED_GetLabelName (const ExprDesc* Expr, long Offs)
             SB_Printf (&Buf, "regbank+%u", (unsigned)((Offs + Expr->Name) & 0xFFFFU));
             break;
 
+        case E_LOC_ZPARG:
+            /* Parameter in the zero page argument block */
+            SB_Printf (&Buf, "zpargs+%u", (unsigned)((Offs + Expr->Name) & 0xFFFFU));
+            break;
+
         case E_LOC_LITERAL:
             /* Literal in the literal pool */
             if (Offs) {
@@ -158,7 +164,8 @@ int ED_GetStackOffs (const ExprDesc* Expr, int Offs)
 int ED_IsLocZP (const ExprDesc* Expr)
 /* Return true if the expression is in a location on a zeropage */
 {
-    return ED_IsLocRegister (Expr) ||
+    return ED_IsLocRegister (Expr)               ||
+           (ED_IsLocZPArg (Expr) && ZPArgsInZP) ||
            (ED_IsLocConst (Expr) &&
             Expr->Sym != 0       &&
             (Expr->Sym->Flags & SC_ZEROPAGE) != 0);
@@ -558,6 +565,11 @@ void PrintExprDesc (FILE* F, ExprDesc* E)
         Flags &= ~E_LOC_CODE;
         Sep = ',';
     }
+    if (Flags & E_LOC_ZPARG) {
+        fprintf (F, "%cE_LOC_ZPARG", Sep);
+        Flags &= ~E_LOC_ZPARG;
+        Sep = ',';
+    }
     if (Flags & E_NEED_TEST) {
         fprintf (F, "%cE_NEED_TEST", Sep);
         Flags &= ~E_NEED_TEST;
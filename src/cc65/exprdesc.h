@@ -93,7 +93,7 @@ enum {
     ** E_LOC_<else>   -- dereference  -> E_LOC_EXPR (pointed-to-value, must load)
     ** + E_ADDRESS_OF -- dereference  -> (lvalue reference)
     */
-    E_MASK_LOC          = 0x01FF,
+    E_MASK_LOC          = 0x03FF,
     E_LOC_NONE          = 0x0000,       /* Pure rvalue with no storage */
     E_LOC_ABS           = 0x0001,       /* Absolute numeric addressed variable */
     E_LOC_GLOBAL        = 0x0002,       /* Global variable */
@@ -104,10 +104,12 @@ enum {
     E_LOC_EXPR          = 0x0040,       /* A location that the primary register points to */
     E_LOC_LITERAL       = 0x0080,       /* Literal in the literal pool */
     E_LOC_CODE          = 0x0100,       /* C code label location (&&Label) */
+    E_LOC_ZPARG         = 0x0200,       /* Parameter in the zero page arg block */
 
     /* Immutable location addresses (immutable bases and offsets) */
     E_LOC_CONST         = E_LOC_NONE | E_LOC_ABS | E_LOC_GLOBAL | E_LOC_STATIC |
-                          E_LOC_REGISTER | E_LOC_LITERAL | E_LOC_CODE,
+                          E_LOC_REGISTER | E_LOC_LITERAL | E_LOC_CODE |
+                          E_LOC_ZPARG,
 
     /* Not-so-immutable location addresses (stack offsets may change dynamically) */
     E_LOC_QUASICONST    = E_LOC_CONST | E_LOC_STACK,
@@ -283,6 +285,12 @@ static inline int ED_IsLocRegister (const ExprDesc* Expr)
     return (Expr->Flags & E_MASK_LOC) == E_LOC_REGISTER;
 }
 
+static inline int ED_IsLocZPArg (const ExprDesc* Expr)
+/* Return true if the expression is located in the zero page argument block */
+{
+    return (Expr->Flags & E_MASK_LOC) == E_LOC_ZPARG;
+}
+
 static inline int ED_IsLocStack (const ExprDesc* Expr)
 /* Return true if the expression is located on the stack */
 {
@@ -34,6 +34,7 @@
 
 
 /* common */
+#include "coll.h"
 #include "xmalloc.h"
 
 /* cc65 */
@@ -41,6 +42,17 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* All function descriptors of the translation unit, so they can be freed */
+static Collection FuncDescs = STATIC_COLLECTION_INITIALIZER;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -59,9 +71,13 @@ FuncDesc* NewFuncDesc (void)
     F->TagTab          = 0;
     F->ParamCount      = 0;
     F->ParamSize       = 0;
+    F->ZPParamSize     = 0;
     F->LastParam       = 0;
     F->FuncDef         = 0;
 
+    /* Remember the descriptor */
+    CollAppend (&FuncDescs, F);
+
     /* Return the new struct */
     return F;
 }
@@ -71,6 +87,23 @@ FuncDesc* NewFuncDesc (void)
 void FreeFuncDesc (FuncDesc* F)
 /* Free a function descriptor */
 {
+    /* Forget the descriptor */
+    CollDeleteItem (&FuncDescs, F);
+
     /* Free the structure */
     xfree (F);
 }
+
+
+
+void ResetFuncDescs (void)
+/* Free all function descriptors, so another translation unit can be
+** compiled.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&FuncDescs); ++I) {
+        xfree (CollAtUnchecked (&FuncDescs, I));
+    }
+    CollDeleteAll (&FuncDescs);
+}
@@ -54,12 +54,16 @@
 #define FD_OLDSTYLE_INTRET      0x0020U /* K&R func has implicit int return    */
 #define FD_UNNAMED_PARAMS       0x0040U /* Function has unnamed params         */
 #define FD_CALL_WRAPPER         0x0080U /* This function is used as a wrapper  */
+#define FD_ZPARGS               0x0100U /* Params passed in zero page block    */
 
 /* Bits that must be ignored when comparing funcs */
 #define FD_IGNORE   (FD_INCOMPLETE_PARAM | FD_OLDSTYLE | FD_OLDSTYLE_INTRET | FD_UNNAMED_PARAMS | FD_CALL_WRAPPER)
 
 #define WRAPPED_CALL_USE_BANK   0x0100U /* WrappedCall uses .bank() */
 
+/* Size of the zero page argument block used by FD_ZPARGS functions */
+#define ZPARGS_SIZE             8U
+
 /* Function descriptor */
 typedef struct FuncDesc FuncDesc;
 struct FuncDesc {
@@ -68,6 +72,7 @@ struct FuncDesc {
     struct SymTable*    TagTab;          /* Symbol table for structs/enums    */
     unsigned            ParamCount;      /* Number of parameters              */
     unsigned            ParamSize;       /* Size of the parameters            */
+    unsigned            ZPParamSize;     /* Size of params in zp arg block    */
     struct SymEntry*    LastParam;       /* Pointer to last parameter         */
     struct FuncDesc*    FuncDef;         /* Descriptor used in definition     */
 };
@@ -86,6 +91,11 @@ FuncDesc* NewFuncDesc (void);
 void FreeFuncDesc (FuncDesc* D);
 /* Free a function descriptor */
 
+void ResetFuncDescs (void);
+/* Free all function descriptors, so another translation unit can be
+** compiled.
+*/
+
 
 
 /* End of funcdesc.h */
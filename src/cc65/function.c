@@ -87,6 +87,7 @@ static Function* NewFunction (struct SymEntry* Sym, FuncDesc* D)
     F->RetLab     = 0;
     F->TopLevelSP = 0;
     F->RegOffs    = RegisterSpace;
+    F->ZPArgsLive = 0;
     F->Flags      = IsTypeVoid (F->ReturnType) ? FF_VOID_RETURN : FF_NONE;
 
     InitCollection (&F->LocalsBlockStack);
@@ -116,6 +117,7 @@ int F_CheckParamList (FuncDesc* D, int RequireAll)
     unsigned    Offs;
     SymEntry*   Param;
     unsigned    ParamSize = 0;
+    unsigned    ZPParamSize = 0;
     unsigned    IncompleteCount = 0;
 
     /* Don't bother to check unnecessarily */
@@ -142,22 +144,41 @@ int F_CheckParamList (FuncDesc* D, int RequireAll)
             }
             ++IncompleteCount;
         }
-        if (SymIsRegVar (Param)) {
-            Param->V.R.SaveOffs = Offs;
+        if ((D->Flags & FD_ZPARGS) != 0 && Param != D->LastParam) {
+            /* Passed in the zero page argument block, which is laid out like
+            ** the stack frame would be. Register parameters are not possible
+            ** here, since the block would have to be swapped with the
+            ** register bank on each call.
+            */
+            if (SymIsRegVar (Param)) {
+                SymCvtRegVarToAuto (Param);
+            }
+            Param->V.Offs = ZPParamSize;
+            ZPParamSize += Size;
         } else {
-            Param->V.Offs = Offs;
+            if (SymIsRegVar (Param)) {
+                Param->V.R.SaveOffs = Offs;
+            } else {
+                Param->V.Offs = Offs;
+            }
+            Offs += Size;
+            ParamSize += Size;
         }
-        Offs += Size;
-        ParamSize += Size;
         Param = Param->PrevSym;
         ++I;
     }
 
+    /* Check the size of the zero page argument block */
+    if (ZPParamSize > ZPARGS_SIZE) {
+        Error ("Parameters passed in zero page exceed %u bytes", ZPARGS_SIZE);
+    }
+
     /* If all parameters have complete types, set the total size description,
     ** clear the FD_INCOMPLETE_PARAM flag and return true.
     */
     if (IncompleteCount == 0) {
         D->ParamSize = ParamSize;
+        D->ZPParamSize = ZPParamSize;
         D->Flags &= ~FD_INCOMPLETE_PARAM;
         return 1;
     }
@@ -240,6 +261,16 @@ int F_IsVariadic (const Function* F)
 
 
 
+int F_IsZPParam (const Function* F, const SymEntry* Param)
+/* Return true if the given parameter of the function is passed in the zero
+** page argument block.
+*/
+{
+    return (F->Desc->Flags & FD_ZPARGS) != 0 && Param != F->Desc->LastParam;
+}
+
+
+
 int F_IsOldStyle (const Function* F)
 /* Return true if this is an old style (K&R) function */
 {
@@ -567,6 +598,9 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     /* Setup the stack */
     StackPtr = 0;
 
+    /* Parameters passed in zero page must survive calls made by this function */
+    CurrentFunc->ZPArgsLive = D->ZPParamSize;
+
     /* Emit code to handle the parameters if all of them have complete types */
     if (ParamComplete) {
         /* Walk through the parameter list and allocate register variable space
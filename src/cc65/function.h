@@ -60,6 +60,7 @@ struct Function {
     unsigned            RetLab;           /* Return code label */
     int                 TopLevelSP;       /* SP at function top level */
     unsigned            RegOffs;          /* Register variable space offset */
+    unsigned            ZPArgsLive;       /* Bytes of zp arg block in use */
     funcflags_t         Flags;            /* Function flags */
     Collection          LocalsBlockStack; /* Stack of blocks with local vars */
 };
@@ -114,6 +115,11 @@ int F_IsMainFunc (const Function* F);
 int F_IsVariadic (const Function* F);
 /* Return true if this is a variadic function */
 
+int F_IsZPParam (const Function* F, const struct SymEntry* Param);
+/* Return true if the given parameter of the function is passed in the zero
+** page argument block.
+*/
+
 int F_IsOldStyle (const Function* F);
 /* Return true if this is an old style (K&R) function */
 
@@ -46,12 +46,14 @@
 unsigned char AddSource         = 0;    /* Add source lines as comments */
 unsigned char AllowNewComments  = 0;    /* Allow new style comments in C89 mode */
 unsigned char AutoCDecl         = 0;    /* Make functions default to __cdecl__ */
+unsigned char CreatePCH         = 0;    /* Create a precompiled header */
 unsigned char DebugInfo         = 0;    /* Add debug info to the obj */
 unsigned char DumpPredefMacros  = 0;    /* Output predefined macros */
 unsigned char DumpUserMacros    = 0;    /* Output user macros */
 unsigned char PreprocessOnly    = 0;    /* Just preprocess the input */
 unsigned char DebugOptOutput    = 0;    /* Output debug stuff */
 unsigned      RegisterSpace     = 6;    /* Space available for register vars */
+unsigned char ZPArgsInZP        = 0;    /* zpargs block is in the zero page */
 
 /* Stackable options */
 IntStack WritableStrings    = INTSTACK(0);  /* Literal strings are r/w */
@@ -73,3 +75,4 @@ StrBuf DepName        = STATIC_STRBUF_INITIALIZER; /* Name of dependencies file
 StrBuf FullDepName    = STATIC_STRBUF_INITIALIZER; /* Name of full dependencies file */
 StrBuf DepTarget      = STATIC_STRBUF_INITIALIZER; /* Name of dependency target */
 StrBuf DebugTableName = STATIC_STRBUF_INITIALIZER; /* Name of debug table dump file */
+StrBuf PCHName        = STATIC_STRBUF_INITIALIZER; /* Name of precompiled header to use */
@@ -65,6 +65,19 @@ void InitIncludePaths (void)
 
 
 
+void ResetIncludePaths (void)
+/* Free the include path search lists, so InitIncludePaths may be called
+** again.
+*/
+{
+    FreeSearchPath (SysIncSearchPath);
+    FreeSearchPath (UsrIncSearchPath);
+    SysIncSearchPath = 0;
+    UsrIncSearchPath = 0;
+}
+
+
+
 void FinishIncludePaths (void)
 /* Finish creating the include path search lists. */
 {
@@ -63,6 +63,11 @@ extern SearchPaths*     UsrIncSearchPath;       /* User include path */
 void InitIncludePaths (void);
 /* Initialize the include path search list */
 
+void ResetIncludePaths (void);
+/* Free the include path search lists, so InitIncludePaths may be called
+** again.
+*/
+
 void FinishIncludePaths (void);
 /* Finish creating the include path search lists. */
 
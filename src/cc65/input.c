@@ -41,9 +41,11 @@
 #include "check.h"
 #include "coll.h"
 #include "debugflag.h"
+#include "filecache.h"
 #include "filestat.h"
 #include "fname.h"
 #include "print.h"
+#include "srcfile.h"
 #include "strbuf.h"
 #include "xmalloc.h"
 
@@ -55,6 +57,7 @@
 #include "input.h"
 #include "lineinfo.h"
 #include "output.h"
+#include "pch.h"
 #include "preproc.h"
 
 
@@ -82,7 +85,7 @@ char NextC = '\0';
 typedef struct AFile AFile;
 struct AFile {
     unsigned    LineNum;        /* Actual line number for this file */
-    FILE*       F;              /* Input file stream */
+    SrcFile*    F;              /* Input file */
     IFile*      Input;          /* Points to corresponding IFile */
     int         SearchPath;     /* True if we've added a path for this file */
     unsigned    LineOffs;       /* Offset to presumed line number for this file */
@@ -146,7 +149,7 @@ static IFile* NewIFile (const char* Name, InputType Type)
 
 
 
-static AFile* NewAFile (IFile* IF, FILE* F)
+static AFile* NewAFile (IFile* IF, SrcFile* F)
 /* Create a new AFile, push it onto the stack, add the path of the file to
 ** the path search list, and finally return a pointer to the new AFile struct.
 */
@@ -249,6 +252,21 @@ static IFile* FindFile (const char* Name)
 
 
 
+static SrcFile* OpenInputFile (const char* Name)
+/* Open an input file through the file cache, so a compile server reads files
+** used by several translation units only once. Returns NULL and sets errno if
+** the file cannot be read.
+*/
+{
+    const CachedFile* CF = GetCachedFile (Name);
+    if (CF == 0) {
+        return 0;
+    }
+    return OpenSrcBuf (CF->F->Buf, CF->Size, SRC_EOL_LF);
+}
+
+
+
 void OpenMainFile (const char* Name)
 /* Open the main file. Will call Fatal() in case of failures. */
 {
@@ -259,7 +277,7 @@ void OpenMainFile (const char* Name)
     IFile* IF = NewIFile (Name, IT_MAIN);
 
     /* Open the file for reading */
-    FILE* F = fopen (Name, "r");
+    SrcFile* F = OpenInputFile (Name);
     if (F == 0) {
         /* Cannot open */
         Fatal ("Cannot open input file '%s': %s", Name, strerror (errno));
@@ -291,9 +309,9 @@ void OpenMainFile (const char* Name)
 void OpenIncludeFile (const char* Name, InputType IT)
 /* Open an include file and insert it into the tables. */
 {
-    char*  N;
-    FILE*  F;
-    IFile* IF;
+    char*    N;
+    SrcFile* F;
+    IFile*   IF;
     AFile* AF;
 
     /* Check for the maximum include nesting */
@@ -309,6 +327,12 @@ void OpenIncludeFile (const char* Name, InputType IT)
         return;
     }
 
+    /* The first include may be replaced by a precompiled header */
+    if (UsePCH (N)) {
+        xfree (N);
+        return;
+    }
+
     /* Search the list of all input files for this file. If we don't find
     ** it, create a new IFile object. If we do already know the file and it
     ** has an include guard, check for the include guard before opening the
@@ -331,7 +355,7 @@ void OpenIncludeFile (const char* Name, InputType IT)
     xfree (N);
 
     /* Open the file */
-    F = fopen (IF->Name, "r");
+    F = OpenInputFile (IF->Name);
     if (F == 0) {
         /* Error opening the file */
         PPError ("Cannot open include file '%s': %s", IF->Name, strerror (errno));
@@ -374,7 +398,7 @@ void CloseIncludeFile (void)
     PreprocessEnd (NextInput->Input);
 
     /* Close the current input file (we're just reading so no error check) */
-    fclose (Input->F);
+    CloseSrcFile (Input->F);
 
     /* If we had added an extra search path for this AFile, remove it */
     if (Input->SearchPath) {
@@ -392,6 +416,78 @@ void CloseIncludeFile (void)
 
 
 
+void ResetInput (void)
+/* Close all input files and forget them, so another translation unit can be
+** compiled.
+*/
+{
+    unsigned I;
+
+    /* Close the active files, including the main file */
+    while (CollCount (&AFiles) > 0) {
+        AFile* AF = CollPop (&AFiles);
+        CloseSrcFile (AF->F);
+        FreeAFile (AF);
+    }
+
+    /* Forget all input files */
+    for (I = 0; I < CollCount (&IFiles); ++I) {
+        IFile* IF = CollAtUnchecked (&IFiles, I);
+        SB_Done (&IF->GuardMacro);
+        xfree (IF);
+    }
+    CollDeleteAll (&IFiles);
+
+    /* Forget the input lines */
+    Line              = 0;
+    CurReusedLine     = 0;
+    CurC              = '\0';
+    NextC             = '\0';
+    CurrentInputStack = 0;
+    PrevDiagnosticLI  = 0;
+}
+
+
+
+void AddPrecompiledFile (const char* Name, InputType Type,
+                         unsigned long Size, unsigned long MTime,
+                         const char* Guard)
+/* Register a file whose contents were loaded from a precompiled header. If
+** Guard is not empty, it is the include guard macro of the file, and the
+** preprocessor will not open the file again while it is defined.
+*/
+{
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, Type);
+    }
+    IF->Size  = Size;
+    IF->MTime = MTime;
+    if (Guard[0] != '\0') {
+        IF->GFlags |= IG_ISGUARDED;
+        SB_CopyStr (&IF->GuardMacro, Guard);
+        SB_Terminate (&IF->GuardMacro);
+    }
+}
+
+
+
+unsigned GetInputFileCount (void)
+/* Return the number of input files seen so far */
+{
+    return CollCount (&IFiles);
+}
+
+
+
+const IFile* GetInputFile (unsigned Index)
+/* Return the input file with the given index */
+{
+    return CollConstAt (&IFiles, Index);
+}
+
+
+
 static void GetInputChar (void)
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
@@ -487,6 +583,20 @@ StrBuf* InitLine (StrBuf* Buf)
 
 
 
+static void AppendInputLine (StrBuf* B, const char* L, unsigned Len)
+/* Append a line read from an input file to B, ignoring embedded NULs */
+{
+    const char* Z;
+    while ((Z = memchr (L, '\0', Len)) != 0) {
+        SB_AppendBuf (B, L, Z - L);
+        Len -= Z - L + 1;
+        L = Z + 1;
+    }
+    SB_AppendBuf (B, L, Len);
+}
+
+
+
 int NextLine (void)
 /* Get a line from the current input. Returns 0 on end of file with no new
 ** input bytes.
@@ -542,14 +652,17 @@ int NextLine (void)
     /* Get the current input file */
     Input = CollLast (&AFiles);
 
-    /* Read characters until we have one complete line */
+    /* Read input lines until we have one complete line */
     while (1) {
 
-        /* Read the next character */
-        C = fgetc (Input->F);
+        unsigned    Len;
+        int         Terminated;
+
+        /* Read the next line */
+        const char* L = ReadSrcLine (Input->F, &Len, &Terminated);
 
         /* Check for EOF */
-        if (C == EOF) {
+        if (L == 0) {
 
             if (!Input->MissingNL || SB_NotEmpty (Line)) {
 
@@ -560,42 +673,42 @@ int NextLine (void)
                 Input->MissingNL = 1;
 
             }
+            C = EOF;
             break;
         }
 
         /* Assume no new line */
         Input->MissingNL = 1;
 
-        /* Check for end of line */
-        if (C == '\n') {
+        /* Add the line to the buffer */
+        AppendInputLine (Line, L, Len);
 
-            /* We got a new line */
-            ++Input->LineNum;
-
-            /* If the \n is preceeded by a \r, remove the \r, so we can read
-            ** DOS/Windows files under *nix.
-            */
-            if (SB_LookAtLast (Line) == '\r') {
-                SB_Drop (Line, 1);
-            }
-
-            /* If we don't have a line continuation character at the end, we
-            ** are done with this line. Otherwise just skip the character and
-            ** continue reading.
-            */
-            if (SB_LookAtLast (Line) != '\\') {
-                Input->MissingNL = 0;
-                break;
-            } else {
-                SB_Drop (Line, 1);
-                ContinueLine ();
-            }
+        /* The last line of the file may have no newline */
+        if (!Terminated) {
+            continue;
+        }
 
-        } else if (C != '\0') {         /* Ignore embedded NULs */
+        /* We got a new line */
+        C = '\n';
+        ++Input->LineNum;
 
-            /* Just some character, add it to the line */
-            SB_AppendChar (Line, C);
+        /* If the \n is preceeded by a \r, remove the \r, so we can read
+        ** DOS/Windows files under *nix.
+        */
+        if (SB_LookAtLast (Line) == '\r') {
+            SB_Drop (Line, 1);
+        }
 
+        /* If we don't have a line continuation character at the end, we
+        ** are done with this line. Otherwise just skip the character and
+        ** continue reading.
+        */
+        if (SB_LookAtLast (Line) != '\\') {
+            Input->MissingNL = 0;
+            break;
+        } else {
+            SB_Drop (Line, 1);
+            ContinueLine ();
         }
     }
 
@@ -718,7 +831,7 @@ void FreeFileInclusionInfo (struct LineInfo* LI)
     if (LI->IncFiles != 0) {
         unsigned I;
         for (I = 0; I < CollCount (LI->IncFiles); ++I) {
-            CollAtUnchecked (LI->IncFiles, I);
+            xfree (CollAtUnchecked (LI->IncFiles, I));
         }
         FreeCollection (LI->IncFiles);
         LI->IncFiles = 0;
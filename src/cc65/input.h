@@ -113,6 +113,25 @@ void CloseIncludeFile (void);
 ** NULL if this was the main file.
 */
 
+void ResetInput (void);
+/* Close all input files and forget them, so another translation unit can be
+** compiled.
+*/
+
+void AddPrecompiledFile (const char* Name, InputType Type,
+                         unsigned long Size, unsigned long MTime,
+                         const char* Guard);
+/* Register a file whose contents were loaded from a precompiled header. If
+** Guard is not empty, it is the include guard macro of the file, and the
+** preprocessor will not open the file again while it is defined.
+*/
+
+unsigned GetInputFileCount (void);
+/* Return the number of input files seen so far */
+
+const struct IFile* GetInputFile (unsigned Index);
+/* Return the input file with the given index */
+
 void NextChar (void);
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
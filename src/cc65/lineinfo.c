@@ -151,6 +151,17 @@ void ReleaseLineInfo (LineInfo* LI)
 
 
 
+void ResetLineInfo (void)
+/* Forget the line infos of the last translation unit, so another one can be
+** compiled.
+*/
+{
+    CurLineInfo   = 0;
+    PrevCheckedLI = 0;
+}
+
+
+
 LineInfo* GetCurLineInfo (void)
 /* Return a pointer to the current line info. The reference count is NOT
 ** increased, use UseLineInfo for that purpose.
@@ -96,6 +96,11 @@ void ReleaseLineInfo (LineInfo* LI);
 ** reference count drops to zero.
 */
 
+void ResetLineInfo (void);
+/* Forget the line infos of the last translation unit, so another one can be
+** compiled.
+*/
+
 LineInfo* GetCurLineInfo (void);
 /* Return a pointer to the current line info. The reference count is NOT
 ** increased, use UseLineInfo for that purpose.
@@ -84,6 +84,9 @@ static LiteralPool*     LP         = 0;
 */
 static Collection       LPStack  = STATIC_COLLECTION_INITIALIZER;
 
+/* All literal pools of the translation unit, so they can be freed */
+static Collection       LPList   = STATIC_COLLECTION_INITIALIZER;
+
 
 
 /*****************************************************************************/
@@ -227,6 +230,9 @@ static LiteralPool* NewLiteralPool (struct SymEntry* Func)
     InitCollection (&LP->WritableLiterals);
     InitCollection (&LP->ReadOnlyLiterals);
 
+    /* Remember the pool */
+    CollAppend (&LPList, LP);
+
     /* Return the new pool */
     return LP;
 }
@@ -240,6 +246,9 @@ static void FreeLiteralPool (LiteralPool* LP)
     DoneCollection (&LP->WritableLiterals);
     DoneCollection (&LP->ReadOnlyLiterals);
 
+    /* Forget the pool */
+    CollDeleteItem (&LPList, LP);
+
     /* Free the struct itself */
     xfree (LP);
 }
@@ -265,6 +274,29 @@ void InitLiteralPool (void)
 
 
 
+void ResetLiteralPool (void)
+/* Free the literal pools of the last translation unit including the literals
+** in them, so another one can be compiled.
+*/
+{
+    while (CollCount (&LPList) > 0) {
+        LiteralPool* P = CollLast (&LPList);
+        unsigned I;
+        for (I = 0; I < CollCount (&P->WritableLiterals); ++I) {
+            FreeLiteral (CollAtUnchecked (&P->WritableLiterals, I));
+        }
+        for (I = 0; I < CollCount (&P->ReadOnlyLiterals); ++I) {
+            FreeLiteral (CollAtUnchecked (&P->ReadOnlyLiterals, I));
+        }
+        FreeLiteralPool (P);
+    }
+    CollDeleteAll (&LPStack);
+    GlobalPool = 0;
+    LP         = 0;
+}
+
+
+
 void PushLiteralPool (struct SymEntry* Func)
 /* Push the current literal pool onto the stack and create a new one */
 {
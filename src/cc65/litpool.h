@@ -103,6 +103,11 @@ unsigned GetLiteralSize (const Literal* L);
 void InitLiteralPool (void);
 /* Initialize the literal pool */
 
+void ResetLiteralPool (void);
+/* Free the literal pools of the last translation unit including the literals
+** in them, so another one can be compiled.
+*/
+
 void PushLiteralPool (struct SymEntry* Func);
 /* Push the current literal pool onto the stack and create a new one */
 
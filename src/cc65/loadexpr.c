@@ -84,6 +84,11 @@ static void LoadAddress (unsigned Flags, ExprDesc* Expr)
             g_getimmed ((Flags | CF_REGVAR) & ~CF_CONST, Expr->Name, Expr->IVal);
             break;
 
+        case E_LOC_ZPARG:
+            /* Parameter in the zero page argument block, load address */
+            g_getimmed ((Flags | CF_ZPARG) & ~CF_CONST, Expr->Name, Expr->IVal);
+            break;
+
         case E_LOC_CODE:
             /* Code label, load address */
             g_getimmed ((Flags | CF_CODE) & ~CF_CONST, Expr->Name, Expr->IVal);
@@ -203,6 +208,11 @@ void LoadExpr (unsigned Flags, struct ExprDesc* Expr)
                 g_getstatic (Flags | CF_REGVAR, Expr->Name, Expr->IVal);
                 break;
 
+            case E_LOC_ZPARG:
+                /* Parameter in the zero page argument block */
+                g_getstatic (Flags | CF_ZPARG, Expr->Name, Expr->IVal);
+                break;
+
             case E_LOC_CODE:
                 /* Code label location */
                 g_getstatic (Flags | CF_CODE, Expr->Name, Expr->IVal);
@@ -98,3 +98,13 @@ void DelLoop (void)
     LoopStack = LoopStack->Next;
     xfree (L);
 }
+
+
+
+void ResetLoops (void)
+/* Remove all loops, so another translation unit can be compiled */
+{
+    while (LoopStack != 0) {
+        DelLoop ();
+    }
+}
@@ -69,6 +69,9 @@ LoopDesc* CurrentLoop (void);
 void DelLoop (void);
 /* Remove the current loop */
 
+void ResetLoops (void);
+/* Remove all loops, so another translation unit can be compiled */
+
 
 
 /* End of loop.h */
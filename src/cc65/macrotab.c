@@ -149,6 +149,7 @@ Macro* NewMacro (const char* Name, unsigned char Predefined)
     M->ParamCount   = -1;        /* Flag: Not a function-like macro */
     InitCollection (&M->Params);
     SB_Init (&M->Replacement);
+    InitCollection (&M->Tokens);
     M->Predefined   = Predefined;
     M->Variadic     = 0;
     memcpy (M->Name, Name, Len+1);
@@ -171,11 +172,28 @@ void FreeMacro (Macro* M)
     }
     DoneCollection (&M->Params);
     SB_Done (&M->Replacement);
+    FreeMacroTokens (M);
+    DoneCollection (&M->Tokens);
     xfree (M);
 }
 
 
 
+void FreeMacroTokens (Macro* M)
+/* Free the tokenized replacement list of a macro. The preprocessor will
+** rebuild it from the replacement text when the macro is expanded next time.
+*/
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&M->Tokens); ++I) {
+        xfree (CollAtUnchecked (&M->Tokens, I));
+    }
+    CollDeleteAll (&M->Tokens);
+}
+
+
+
 Macro* CloneMacro (const Macro* M)
 /* Clone a macro definition. The function is not insert the macro into the
 ** macro table, thus the cloned instance cannot be freed with UndefineMacro.
@@ -301,6 +319,22 @@ void FreeUndefinedMacros (void)
 
 
 
+void ResetMacros (void)
+/* Remove all macros, so another translation unit can be compiled */
+{
+    unsigned I;
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        while (MacroTab[I]) {
+            Macro* M = MacroTab[I];
+            MacroTab[I] = M->Next;
+            FreeMacro (M);
+        }
+    }
+    FreeUndefinedMacros ();
+}
+
+
+
 Macro* FindMacro (const char* Name)
 /* Find a macro with the given name. Return the macro definition or NULL */
 {
@@ -395,6 +429,21 @@ int MacroCmp (const Macro* M1, const Macro* M2)
 
 
 
+void CollectMacros (Collection* C)
+/* Append all macros in the macro table to the given collection */
+{
+    unsigned I;
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        Macro* M = MacroTab[I];
+        while (M) {
+            CollAppend (C, M);
+            M = M->Next;
+        }
+    }
+}
+
+
+
 void PrintMacroStats (FILE* F)
 /* Print macro statistics to the given text file. */
 {
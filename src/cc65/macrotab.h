@@ -57,6 +57,7 @@ struct Macro {
     int           ParamCount;   /* Number of parameters, -1 = no parens */
     Collection    Params;       /* Parameter list (char*) */
     StrBuf        Replacement;  /* Replacement text */
+    Collection    Tokens;       /* Tokenized replacement, built on first use */
     unsigned char Predefined;   /* True if this is a predefined macro */
     unsigned char Variadic;     /* C99 variadic macro */
     char          Name[1];      /* Name, dynamically allocated */
@@ -80,6 +81,11 @@ void FreeMacro (Macro* M);
 ** table, use UndefineMacro for that.
 */
 
+void FreeMacroTokens (Macro* M);
+/* Free the tokenized replacement list of a macro. The preprocessor will
+** rebuild it from the replacement text when the macro is expanded next time.
+*/
+
 Macro* CloneMacro (const Macro* M);
 /* Clone a macro definition. The function is not insert the macro into the
 ** macro table, thus the cloned instance cannot be freed with UndefineMacro.
@@ -105,6 +111,9 @@ Macro* UndefineMacro (const char* Name);
 void FreeUndefinedMacros (void);
 /* Free all undefined macros */
 
+void ResetMacros (void);
+/* Remove all macros, so another translation unit can be compiled */
+
 Macro* FindMacro (const char* Name);
 /* Find a macro with the given name. Return the macro definition or NULL */
 
@@ -125,6 +134,9 @@ void AddMacroParam (Macro* M, const char* Param);
 int MacroCmp (const Macro* M1, const Macro* M2);
 /* Compare two macros and return zero if both are identical. */
 
+void CollectMacros (Collection* C);
+/* Append all macros in the macro table to the given collection */
+
 void PrintMacroStats (FILE* F);
 /* Print macro statistics to the given text file. */
 
@@ -55,18 +55,116 @@
 #include "xmalloc.h"
 
 /* cc65 */
+#include "anonname.h"
 #include "asmcode.h"
+#include "asmlabel.h"
 #include "compile.h"
 #include "codeopt.h"
 #include "error.h"
+#include "funcdesc.h"
+#include "function.h"
 #include "global.h"
 #include "incpath.h"
 #include "input.h"
+#include "lineinfo.h"
+#include "litpool.h"
+#include "loop.h"
 #include "macrotab.h"
 #include "output.h"
+#include "pch.h"
+#include "preproc.h"
 #include "scanner.h"
 #include "segments.h"
+#include "seqpoint.h"
+#include "server.h"
+#include "stackptr.h"
 #include "standard.h"
+#include "swstmt.h"
+#include "symtab.h"
+#include "wrappedcall.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Variables that are set by command line options or changed while compiling.
+** In compile server mode, their values from before the first job are saved,
+** and restored before each of the following jobs.
+*/
+typedef struct OptionVar OptionVar;
+struct OptionVar {
+    void*       Var;                    /* Address of the variable */
+    size_t      Size;                   /* Size of the variable */
+    void*       Saved;                  /* Saved value */
+};
+#define OPTVAR(V)       { &(V), sizeof (V), 0 }
+
+static OptionVar OptionVars[] = {
+    OPTVAR (AddSource),
+    OPTVAR (AllowNewComments),
+    OPTVAR (AutoCDecl),
+    OPTVAR (CreatePCH),
+    OPTVAR (DebugInfo),
+    OPTVAR (DumpPredefMacros),
+    OPTVAR (DumpUserMacros),
+    OPTVAR (PreprocessOnly),
+    OPTVAR (DebugOptOutput),
+    OPTVAR (RegisterSpace),
+    OPTVAR (ZPArgsInZP),
+    OPTVAR (WritableStrings),
+    OPTVAR (LocalStrings),
+    OPTVAR (InlineStdFuncs),
+    OPTVAR (EagerlyInlineFuncs),
+    OPTVAR (EnableRegVars),
+    OPTVAR (AllowRegVarAddr),
+    OPTVAR (RegVarsToCallStack),
+    OPTVAR (StaticLocals),
+    OPTVAR (SignedChars),
+    OPTVAR (CheckStack),
+    OPTVAR (Optimize),
+    OPTVAR (CodeSizeFactor),
+    OPTVAR (DataAlignment),
+    OPTVAR (WarnEnable),
+    OPTVAR (WarningsAreErrors),
+    OPTVAR (WarnConstComparison),
+    OPTVAR (WarnPointerSign),
+    OPTVAR (WarnPointerTypes),
+    OPTVAR (WarnNoEffect),
+    OPTVAR (WarnRemapZero),
+    OPTVAR (WarnReturnType),
+    OPTVAR (WarnStructParam),
+    OPTVAR (WarnUnknownPragma),
+    OPTVAR (WarnUnreachableCode),
+    OPTVAR (WarnUnusedLabel),
+    OPTVAR (WarnUnusedParam),
+    OPTVAR (WarnUnusedVar),
+    OPTVAR (WarnUnusedFunc),
+    OPTVAR (WarnConstOverflow),
+    OPTVAR (Standard),
+    OPTVAR (CPU),
+    OPTVAR (MemoryModel),
+    OPTVAR (CodeAddrSize),
+    OPTVAR (DataAddrSize),
+    OPTVAR (ZpAddrSize),
+    OPTVAR (Target),
+    OPTVAR (Debug),
+    OPTVAR (Verbosity),
+};
+#define OPTVAR_COUNT    (sizeof (OptionVars) / sizeof (OptionVars[0]))
+
+/* File names set by command line options. They are emptied between jobs. */
+static StrBuf* const NameOptions[] = {
+    &DepName,
+    &FullDepName,
+    &DepTarget,
+    &DebugTableName,
+    &PCHName,
+};
+#define NAMEOPT_COUNT   (sizeof (NameOptions) / sizeof (NameOptions[0]))
 
 
 
@@ -114,6 +212,7 @@ static void Usage (void)
             "  --cpu type\t\t\tSet cpu type (6502, 65c02)\n"
             "  --create-dep name\t\tCreate a make dependency file\n"
             "  --create-full-dep name\tCreate a full make dependency file\n"
+            "  --create-pch\t\t\tCreate a precompiled header\n"
             "  --data-name seg\t\tSet the name of the DATA segment\n"
             "  --debug\t\t\tDebug mode\n"
             "  --debug-tables name\t\tWrite symbol table debug info to a file\n"
@@ -131,9 +230,11 @@ static void Usage (void)
             "  --list-warnings\t\tList available warning types for -W\n"
             "  --local-strings\t\tEmit string literals immediately\n"
             "  --memory-model model\t\tSet the memory model\n"
+            "  --pch name\t\t\tUse a precompiled header\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
             "  --rodata-name seg\t\tSet the name of the RODATA segment\n"
+            "  --server name\t\t\tRun as compile server on a local socket\n"
             "  --signed-chars\t\tDefault characters are signed\n"
             "  --standard std\t\tLanguage standard (c89, c99, cc65)\n"
             "  --static-locals\t\tMake local variables static\n"
@@ -326,6 +427,9 @@ static void SetSys (const char* Sys)
             AbEnd ("Unknown target system '%s'", Sys);
     }
 
+    /* Place the zero page argument block as the target's table says */
+    ZPArgsInZP = GetTargetProperties (Target)->ZPArgs;
+
     /* Initialize the translation tables for the target system */
     TgtTranslateInit ();
 }
@@ -583,6 +687,15 @@ static void OptCreateFullDep (const char* Opt attribute ((unused)),
 
 
 
+static void OptCreatePCH (const char* Opt attribute ((unused)),
+                          const char* Arg attribute ((unused)))
+/* Handle the --create-pch option */
+{
+    CreatePCH = 1;
+}
+
+
+
 static void OptCPU (const char* Opt, const char* Arg)
 /* Handle the --cpu option */
 {
@@ -748,7 +861,7 @@ static void OptHelp (const char* Opt attribute ((unused)),
 /* Print usage information and exit */
 {
     Usage ();
-    exit (EXIT_SUCCESS);
+    Terminate (EXIT_SUCCESS);
 }
 
 
@@ -779,7 +892,7 @@ static void OptListOptSteps (const char* Opt attribute ((unused)),
     ListOptSteps (stdout);
 
     /* Terminate */
-    exit (EXIT_SUCCESS);
+    Terminate (EXIT_SUCCESS);
 }
 
 
@@ -792,7 +905,7 @@ static void OptListWarnings (const char* Opt attribute ((unused)),
     ListWarnings (stdout);
 
     /* Terminate */
-    exit (EXIT_SUCCESS);
+    Terminate (EXIT_SUCCESS);
 }
 
 
@@ -830,6 +943,14 @@ static void OptMemoryModel (const char* Opt, const char* Arg)
 
 
 
+static void OptPCH (const char* Opt, const char* Arg)
+/* Handle the --pch option */
+{
+    FileNameOption (Opt, Arg, &PCHName);
+}
+
+
+
 static void OptRegisterSpace (const char* Opt, const char* Arg)
 /* Handle the --register-space option */
 {
@@ -862,6 +983,17 @@ static void OptRodataName (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptServer (const char* Opt attribute ((unused)),
+                       const char* Arg attribute ((unused)))
+/* Handle the --server option. It is checked for before the command line is
+** parsed, so this is only reached if there are more options.
+*/
+{
+    AbEnd ("Option '--server' must be the only option");
+}
+
+
+
 static void OptSignedChars (const char* Opt attribute ((unused)),
                             const char* Arg attribute ((unused)))
 /* Use 'signed char' as the underlying type of 'char' */
@@ -918,7 +1050,7 @@ static void OptVersion (const char* Opt attribute ((unused)),
 /* Print the compiler version */
 {
     fprintf (stderr, "%s V%s\n", ProgName, GetVersionAsString ());
-    exit (EXIT_SUCCESS);
+    Terminate (EXIT_SUCCESS);
 }
 
 
@@ -987,7 +1119,78 @@ static void OptWritableStrings (const char* Opt attribute ((unused)),
 
 
 
-int main (int argc, char* argv[])
+static void SaveOptions (void)
+/* Save the values of the options before the first compile job */
+{
+    unsigned I;
+    for (I = 0; I < OPTVAR_COUNT; ++I) {
+        OptionVars[I].Saved = xdup (OptionVars[I].Var, OptionVars[I].Size);
+    }
+}
+
+
+
+static void RestoreOptions (void)
+/* Restore the values of the options saved by SaveOptions */
+{
+    unsigned I;
+    for (I = 0; I < OPTVAR_COUNT; ++I) {
+        memcpy (OptionVars[I].Var, OptionVars[I].Saved, OptionVars[I].Size);
+    }
+    for (I = 0; I < NAMEOPT_COUNT; ++I) {
+        SB_Done (NameOptions[I]);
+        SB_Init (NameOptions[I]);
+    }
+}
+
+
+
+static void ResetCompiler (void)
+/* Reset the compiler after a compile job, so the next translation unit is
+** compiled as if by a new process. The cached input files are kept. The
+** symbol tables and code segments of the last job are not freed, as in a
+** normal run.
+*/
+{
+    ResetMacros ();
+    ResetSymTab ();
+    ResetFuncDescs ();
+    ResetSegContexts ();
+    ResetSegNames ();
+    ResetLiteralPool ();
+    ResetLabels ();
+    ResetInput ();
+    ResetOutput ();
+    ResetDiagnosticCounts ();
+    ResetLineInfo ();
+    ResetPreprocess ();
+    ResetScanner ();
+    ResetOptSteps ();
+    ResetIncludePaths ();
+    ResetPCH ();
+    ResetLoops ();
+    ResetSwitch ();
+    ResetWrappedCalls ();
+    ResetAnonNames ();
+    SetSQPFlags (SQP_KEEP_NONE);
+    CurrentFunc = 0;
+    StackPtr    = 0;
+
+    /* Drop the character maps pushed by #pragma charmap */
+    while (TgtTranslatePop ()) {
+    }
+
+    /* Restore the options, then the character map of the default target */
+    RestoreOptions ();
+    TgtTranslateInit ();
+}
+
+
+
+static int CompileJob (void)
+/* Compile the translation unit given on the command line. Return the exit
+** code.
+*/
 {
     /* Program long options */
     static const LongOpt OptTab[] = {
@@ -1000,6 +1203,7 @@ int main (int argc, char* argv[])
         { "--cpu",                  1,      OptCPU                  },
         { "--create-dep",           1,      OptCreateDep            },
         { "--create-full-dep",      1,      OptCreateFullDep        },
+        { "--create-pch",           0,      OptCreatePCH            },
         { "--data-name",            1,      OptDataName             },
         { "--debug",                0,      OptDebug                },
         { "--debug-tables",         1,      OptDebugTables          },
@@ -1017,9 +1221,11 @@ int main (int argc, char* argv[])
         { "--list-warnings",        0,      OptListWarnings         },
         { "--local-strings",        0,      OptLocalStrings         },
         { "--memory-model",         1,      OptMemoryModel          },
+        { "--pch",                  1,      OptPCH                  },
         { "--register-space",       1,      OptRegisterSpace        },
         { "--register-vars",        0,      OptRegisterVars         },
         { "--rodata-name",          1,      OptRodataName           },
+        { "--server",               1,      OptServer               },
         { "--signed-chars",         0,      OptSignedChars          },
         { "--standard",             1,      OptStandard             },
         { "--static-locals",        0,      OptStaticLocals         },
@@ -1035,9 +1241,6 @@ int main (int argc, char* argv[])
     /* Initialize the input file name */
     const char* InputFile  = 0;
 
-    /* Initialize the cmdline module */
-    InitCmdLine (&argc, &argv, "cc65");
-
     /* Initialize the default segment names */
     InitSegNames ();
 
@@ -1209,6 +1412,11 @@ int main (int argc, char* argv[])
         AbEnd ("Preprocessor macro output can only be used together with -E");
     }
 
+    /* A precompiled header is either created or used, and never with -E */
+    if (CreatePCH && (PreprocessOnly || SB_NotEmpty (&PCHName))) {
+        AbEnd ("Option '--create-pch' cannot be used together with -E or '--pch'");
+    }
+
     /* Add the default include search paths. */
     FinishIncludePaths ();
 
@@ -1243,8 +1451,22 @@ int main (int argc, char* argv[])
     /* Go! */
     Compile (InputFile);
 
-    /* Create the output file if we didn't had any errors */
-    if (PreprocessOnly == 0 && (GetTotalErrors () == 0 || Debug)) {
+    /* Create the output file if we didn't had any errors. When creating a
+    ** precompiled header, it replaces the assembler output.
+    */
+    if (CreatePCH) {
+
+        if (GetTotalErrors () == 0) {
+
+            /* Write the header */
+            WritePCH (OutputFilename);
+            Print (stdout, 1, "Wrote precompiled header to '%s'\n", OutputFilename);
+
+            /* Create dependencies if requested */
+            CreateDependencies ();
+        }
+
+    } else if (PreprocessOnly == 0 && (GetTotalErrors () == 0 || Debug)) {
 
         /* Emit literals, do cleanup and optimizations */
         FinishCompile ();
@@ -1272,3 +1494,40 @@ int main (int argc, char* argv[])
     /* Return an apropriate exit code */
     return (GetTotalErrors () > 0)? EXIT_FAILURE : EXIT_SUCCESS;
 }
+
+
+
+static int ServerJob (void)
+/* Run one job of the compile server */
+{
+    /* The state left by the last job must be reset. The first job starts
+    ** from the state of a new process.
+    */
+    static int First = 1;
+    if (First) {
+        First = 0;
+    } else {
+        ResetCompiler ();
+    }
+    return CompileJob ();
+}
+
+
+
+int main (int argc, char* argv[])
+{
+    /* Initialize the cmdline module */
+    InitCmdLine (&argc, &argv, "cc65");
+
+    /* In compile server mode, CompileJob runs once for each job, with the
+    ** command line of that job.
+    */
+    if (ArgCount == 3 && strcmp (ArgVec[1], "--server") == 0) {
+        SaveOptions ();
+        RunServer (ArgVec[2], ServerJob);
+        return EXIT_SUCCESS;
+    }
+
+    /* Compile the file given on the command line */
+    return CompileJob ();
+}
@@ -86,7 +86,7 @@ void MakeDefaultOutputName (const char* InputFilename)
 {
     if (OutputFilename == 0 || *OutputFilename == '\0') {
         /* We don't have an output file for now */
-        const char* Ext = PreprocessOnly? ".i" : ".s";
+        const char* Ext = PreprocessOnly? ".i" : CreatePCH? ".pch" : ".s";
         OutputFilename = MakeFilename (InputFilename, Ext);
     }
 }
@@ -145,6 +145,20 @@ void CloseOutputFile ()
 
 
 
+void ResetOutput (void)
+/* Close the output file if the compiler stopped before doing so, and forget
+** its name, so another translation unit can be compiled.
+*/
+{
+    if (OutputFile != 0) {
+        fclose (OutputFile);
+        OutputFile = 0;
+    }
+    OutputFilename = 0;
+}
+
+
+
 int WriteOutput (const char* Format, ...)
 /* Write to the output file using printf like formatting. Returns the number
 ** of chars written.
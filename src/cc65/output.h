@@ -84,6 +84,11 @@ void OpenDebugOutputFile (const char* Name);
 void CloseOutputFile ();
 /* Close the output file. Will call Fatal() in case of failures. */
 
+void ResetOutput (void);
+/* Close the output file if the compiler stopped before doing so, and forget
+** its name, so another translation unit can be compiled.
+*/
+
 int WriteOutput (const char* Format, ...) attribute ((format (printf, 1, 2)));
 /* Write to the output file using printf like formatting. Returns the number
 ** of chars written.
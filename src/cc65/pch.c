@@ -0,0 +1,1400 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.c                                   */
+/*                                                                           */
+/*             Precompiled header support for the cc65 C compiler            */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* A precompiled header contains the state of the compiler after a header
+** file was compiled as main file: The macros defined or undefined by the
+** header, the declarations it made (including all symbol tables, types and
+** function descriptors reachable from them) and the names, sizes, modification
+** times, content hashes and include guards of all files read. It is only used if the compiler
+** options, include paths and predefined macros are identical, none of the
+** files has changed, and the header is the first file included by the
+** translation unit, with nothing declared or defined before.
+*/
+
+
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "cpu.h"
+#include "filecache.h"
+#include "filestat.h"
+#include "hashfunc.h"
+#include "hashtab.h"
+#include "mmodel.h"
+#include "print.h"
+#include "strbuf.h"
+#include "target.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "anonname.h"
+#include "declattr.h"
+#include "error.h"
+#include "funcdesc.h"
+#include "global.h"
+#include "incpath.h"
+#include "input.h"
+#include "macrotab.h"
+#include "pch.h"
+#include "preproc.h"
+#include "standard.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* File format */
+static const char PCHMagic[] = "cc65pch";
+#define PCH_VERSION     4U
+
+/* Ids of the symbol tables that exist in every translation unit. Ids of
+** tables stored in the file start after these.
+*/
+#define PCH_TAB_GLOBALSYM       1U
+#define PCH_TAB_GLOBALTAG       2U
+#define PCH_TAB_EMPTY           3U
+#define PCH_TAB_COUNT           3U
+
+/* Environment at the time BeginPCH was called */
+static StrBuf       Env         = STATIC_STRBUF_INITIALIZER;
+static StrBuf       EnvDefs     = STATIC_STRBUF_INITIALIZER;
+static Collection   EnvMacros   = STATIC_COLLECTION_INITIALIZER;
+
+/* Mapping of objects to ids used while writing. Symbol tables, symbols and
+** function descriptors are numbered separately starting with 1, id 0 is a
+** NULL pointer.
+*/
+typedef struct ObjId ObjId;
+struct ObjId {
+    HashNode            Node;           /* Hash node, must be first */
+    const void*         Obj;            /* The object */
+    unsigned            Id;             /* Its id */
+};
+
+/* Hash table functions */
+static unsigned HT_GenHash (const void* Key);
+static const void* HT_GetKey (const void* Entry);
+static int HT_Compare (const void* Key1, const void* Key2);
+
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+static HashTable    ObjIds      = STATIC_HASHTABLE_INITIALIZER (4093, &HashFunc);
+static Collection   Tables      = STATIC_COLLECTION_INITIALIZER;
+static Collection   Syms        = STATIC_COLLECTION_INITIALIZER;
+static Collection   Funcs       = STATIC_COLLECTION_INITIALIZER;
+static unsigned     Unresolved  = 0;
+
+/* Data of the precompiled header being loaded. It is kept in memory from
+** LoadPCH until the first #include.
+*/
+static const char*      InName  = 0;
+static char*            InHeader = 0;
+static StrBuf           In      = STATIC_STRBUF_INITIALIZER;
+static SymTable**       InTabs  = 0;
+static unsigned         InTabCount;
+static SymEntry**       InSyms  = 0;
+static unsigned         InSymCount;
+static FuncDesc**       InFuncs = 0;
+static unsigned         InFuncCount;
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key. */
+{
+    return HashInt ((unsigned) (uintptr_t) *(const void* const*) Key);
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return &((const ObjId*) Entry)->Obj;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+{
+    uintptr_t P1 = (uintptr_t) *(const void* const*) Key1;
+    uintptr_t P2 = (uintptr_t) *(const void* const*) Key2;
+    return (P1 < P2)? -1 : (P1 > P2);
+}
+
+
+
+/*****************************************************************************/
+/*                              Writing helpers                              */
+/*****************************************************************************/
+
+
+
+static void PutVar (StrBuf* B, unsigned long V)
+/* Write a variable sized unsigned value, 7 bits per byte */
+{
+    do {
+        unsigned char C = (unsigned char) (V & 0x7F);
+        V >>= 7;
+        if (V != 0) {
+            C |= 0x80;
+        }
+        SB_AppendChar (B, C);
+    } while (V != 0);
+}
+
+
+
+static void PutLong (StrBuf* B, long V)
+/* Write a signed value. The sign is moved into bit 0, so small negative
+** values need few bytes.
+*/
+{
+    if (V < 0) {
+        PutVar (B, ((~(unsigned long) V) << 1) | 1UL);
+    } else {
+        PutVar (B, ((unsigned long) V) << 1);
+    }
+}
+
+
+
+static void PutBuf (StrBuf* B, const StrBuf* S)
+/* Write the contents of a string buffer preceeded by its length */
+{
+    PutVar (B, SB_GetLen (S));
+    SB_AppendBuf (B, SB_GetConstBuf (S), SB_GetLen (S));
+}
+
+
+
+static void PutStr (StrBuf* B, const char* S)
+/* Write a string preceeded by its length */
+{
+    unsigned Len = strlen (S);
+    PutVar (B, Len);
+    SB_AppendBuf (B, S, Len);
+}
+
+
+
+static void PutRef (StrBuf* B, const void* Obj)
+/* Write the id of an object. Objects without an id are counted, so the
+** caller can refuse to write the header.
+*/
+{
+    const ObjId* E = 0;
+    if (Obj != 0) {
+        E = HT_Find (&ObjIds, &Obj);
+        if (E == 0) {
+            ++Unresolved;
+        }
+    }
+    PutVar (B, E? E->Id : 0);
+}
+
+
+
+/*****************************************************************************/
+/*                              Reading helpers                              */
+/*****************************************************************************/
+
+
+
+static unsigned char GetByte (void)
+/* Read one byte from the input */
+{
+    if (SB_GetIndex (&In) >= SB_GetLen (&In)) {
+        Fatal ("Precompiled header '%s' is damaged", InName);
+    }
+    return (unsigned char) SB_Get (&In);
+}
+
+
+
+static unsigned long GetVar (void)
+/* Read a variable sized unsigned value */
+{
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    unsigned char C;
+    do {
+        C = GetByte ();
+        V |= ((unsigned long) (C & 0x7F)) << Shift;
+        Shift += 7;
+    } while (C & 0x80);
+    return V;
+}
+
+
+
+static long GetLong (void)
+/* Read a signed value */
+{
+    unsigned long V = GetVar ();
+    if (V & 1UL) {
+        return (long) ~(V >> 1);
+    } else {
+        return (long) (V >> 1);
+    }
+}
+
+
+
+static void GetBuf (StrBuf* S)
+/* Read the contents of a string buffer */
+{
+    unsigned long Len = GetVar ();
+    if (Len > SB_GetLen (&In) - SB_GetIndex (&In)) {
+        Fatal ("Precompiled header '%s' is damaged", InName);
+    }
+    SB_CopyBuf (S, SB_GetConstBuf (&In) + SB_GetIndex (&In), Len);
+    SB_Terminate (S);
+    SB_SkipMultiple (&In, Len);
+}
+
+
+
+static char* GetStr (void)
+/* Read a string and return it as an allocated copy */
+{
+    StrBuf S = AUTO_STRBUF_INITIALIZER;
+    char* Str;
+    GetBuf (&S);
+    Str = xstrdup (SB_GetConstBuf (&S));
+    SB_Done (&S);
+    return Str;
+}
+
+
+
+static unsigned GetId (unsigned Count)
+/* Read an object id and check it against the number of objects */
+{
+    unsigned long Id = GetVar ();
+    if (Id > Count) {
+        Fatal ("Precompiled header '%s' is damaged", InName);
+    }
+    return (unsigned) Id;
+}
+
+
+
+static SymTable* GetTab (void)
+/* Read a reference to a symbol table */
+{
+    return InTabs[GetId (InTabCount)];
+}
+
+
+
+static SymEntry* GetSym (void)
+/* Read a reference to a symbol */
+{
+    return InSyms[GetId (InSymCount)];
+}
+
+
+
+static FuncDesc* GetFunc (void)
+/* Read a reference to a function descriptor */
+{
+    return InFuncs[GetId (InFuncCount)];
+}
+
+
+
+/*****************************************************************************/
+/*                           Options and macros                              */
+/*****************************************************************************/
+
+
+
+static int IsVolatileMacro (const Macro* M)
+/* Return true if this is a macro whose value depends on the time of the
+** compilation and which must therefore not be stored.
+*/
+{
+    return strcmp (M->Name, "__DATE__") == 0 || strcmp (M->Name, "__TIME__") == 0;
+}
+
+
+
+static int CmpMacroNames (void* Data attribute ((unused)),
+                          const void* M1, const void* M2)
+/* Compare function for CollSort */
+{
+    return strcmp (((const Macro*) M1)->Name, ((const Macro*) M2)->Name);
+}
+
+
+
+static void PutMacro (StrBuf* B, const Macro* M)
+/* Write a macro definition */
+{
+    unsigned I;
+
+    PutStr (B, M->Name);
+    PutLong (B, M->ParamCount);
+    PutVar (B, CollCount (&M->Params));
+    for (I = 0; I < CollCount (&M->Params); ++I) {
+        PutStr (B, CollConstAt (&M->Params, I));
+    }
+    PutBuf (B, &M->Replacement);
+    PutVar (B, M->Predefined);
+    PutVar (B, M->Variadic);
+}
+
+
+
+static Macro* GetMacro (void)
+/* Read a macro definition */
+{
+    unsigned long Count;
+    char* Name = GetStr ();
+    Macro* M = NewMacro (Name, 0);
+    xfree (Name);
+
+    M->ParamCount = (int) GetLong ();
+    Count = GetVar ();
+    while (Count--) {
+        CollAppend (&M->Params, GetStr ());
+    }
+    GetBuf (&M->Replacement);
+    M->Predefined = (unsigned char) GetVar ();
+    M->Variadic   = (unsigned char) GetVar ();
+
+    return M;
+}
+
+
+
+static void PutSearchPath (StrBuf* B, SearchPaths* P)
+/* Write the directories of a search path */
+{
+    unsigned I;
+    PutVar (B, CollCount (P));
+    for (I = 0; I < CollCount (P); ++I) {
+        PutStr (B, GetSearchPath (P, I));
+    }
+}
+
+
+
+static void PutMacroDefs (StrBuf* B)
+/* Write all macros that are currently defined */
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    /* The order of the macros in the table depends on the order in which they
+    ** were defined, so sort them by name.
+    */
+    CollectMacros (&Macros);
+    CollSort (&Macros, CmpMacroNames, 0);
+    for (I = 0; I < CollCount (&Macros); ++I) {
+        const Macro* M = CollConstAt (&Macros, I);
+        if (!IsVolatileMacro (M)) {
+            PutMacro (B, M);
+        }
+    }
+    DoneCollection (&Macros);
+}
+
+
+
+static void PutEnvironment (StrBuf* B)
+/* Write everything that must be identical when creating and when using a
+** precompiled header: The compiler version, the options that change the
+** meaning of declarations, the include paths and all macros.
+*/
+{
+    PutStr (B, GetVersionAsString ());
+    PutLong (B, Target);
+    PutLong (B, CPU);
+    PutLong (B, MemoryModel);
+    PutLong (B, IS_Get (&Standard));
+    PutLong (B, IS_Get (&SignedChars));
+    PutVar (B, AutoCDecl);
+    PutVar (B, AllowNewComments);
+    PutSearchPath (B, SysIncSearchPath);
+    PutSearchPath (B, UsrIncSearchPath);
+    PutMacroDefs (B);
+}
+
+
+
+static void PutMacros (StrBuf* B)
+/* Write the macros undefined and defined by the header */
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    Collection Changed = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    /* Macros from the environment that are gone now */
+    for (I = 0; I < CollCount (&EnvMacros); ++I) {
+        const Macro* M = CollConstAt (&EnvMacros, I);
+        if (FindMacro (M->Name) == 0) {
+            CollAppend (&Changed, (void*) M);
+        }
+    }
+    PutVar (B, CollCount (&Changed));
+    for (I = 0; I < CollCount (&Changed); ++I) {
+        PutStr (B, ((const Macro*) CollConstAt (&Changed, I))->Name);
+    }
+    CollDeleteAll (&Changed);
+
+    /* Macros that are new or were redefined */
+    CollectMacros (&Macros);
+    for (I = 0; I < CollCount (&Macros); ++I) {
+        const Macro* M = CollConstAt (&Macros, I);
+        unsigned J;
+        if (IsVolatileMacro (M)) {
+            continue;
+        }
+        for (J = 0; J < CollCount (&EnvMacros); ++J) {
+            const Macro* E = CollConstAt (&EnvMacros, J);
+            if (strcmp (E->Name, M->Name) == 0) {
+                break;
+            }
+        }
+        if (J == CollCount (&EnvMacros) ||
+            MacroCmp (CollConstAt (&EnvMacros, J), M) != 0) {
+            CollAppend (&Changed, (void*) M);
+        }
+    }
+    PutVar (B, CollCount (&Changed));
+    for (I = 0; I < CollCount (&Changed); ++I) {
+        PutMacro (B, CollConstAt (&Changed, I));
+    }
+
+    DoneCollection (&Changed);
+    DoneCollection (&Macros);
+}
+
+
+
+static void GetMacros (void)
+/* Read the macros undefined and defined by the header and apply them */
+{
+    unsigned long Count;
+
+    /* Remove macros undefined by the header */
+    Count = GetVar ();
+    while (Count--) {
+        char* Name = GetStr ();
+        UndefineMacro (Name);
+        xfree (Name);
+    }
+
+    /* Add macros defined by the header */
+    Count = GetVar ();
+    while (Count--) {
+        Macro* M = GetMacro ();
+        Macro* Old = FindMacro (M->Name);
+        if (Old != 0 && MacroCmp (Old, M) == 0) {
+            FreeMacro (M);
+        } else {
+            if (Old != 0) {
+                UndefineMacro (M->Name);
+            }
+            InsertMacro (M);
+        }
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                Input files                                */
+/*****************************************************************************/
+
+
+
+static int HashFile (const char* Name, unsigned long* Hash)
+/* Compute a FNV-1a hash of the contents of a file. Return false if the file
+** cannot be read.
+*/
+{
+    const unsigned char* P;
+    const unsigned char* End;
+    unsigned long H = 2166136261UL;
+
+    /* The file is usually read anyway, so use the cache */
+    const CachedFile* CF = GetCachedFile (Name);
+    if (CF == 0) {
+        return 0;
+    }
+    P   = (const unsigned char*) CF->F->Buf;
+    End = P + CF->Size;
+    while (P < End) {
+        H = ((H ^ *P++) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+
+    *Hash = H;
+    return 1;
+}
+
+
+
+static void PutFiles (StrBuf* B)
+/* Write the names, sizes, modification times, content hashes and include
+** guards of all input files.
+*/
+{
+    unsigned      I;
+    unsigned long Hash;
+    unsigned      Count = GetInputFileCount ();
+
+    PutVar (B, Count);
+    for (I = 0; I < Count; ++I) {
+        const IFile* IF = GetInputFile (I);
+
+        /* The main file will be included by a user include directive */
+        PutStr (B, IF->Name);
+        PutVar (B, (IF->Type == IT_MAIN)? IT_USRINC : IF->Type);
+        PutVar (B, IF->Size);
+        PutVar (B, IF->MTime);
+
+        /* The modification time has a resolution of one second, so a file
+        ** written again within the same second with the same size is only
+        ** detected by its contents.
+        */
+        if (!HashFile (IF->Name, &Hash)) {
+            Fatal ("Cannot read '%s': %s", IF->Name, strerror (errno));
+        }
+        PutVar (B, Hash);
+
+        /* Later includes of a file with an include guard are skipped as
+        ** usual, files without one are read again.
+        */
+        if ((IF->GFlags & IG_ISGUARDED) != 0) {
+            PutBuf (B, &IF->GuardMacro);
+        } else {
+            PutStr (B, "");
+        }
+    }
+}
+
+
+
+static int CheckFiles (StrBuf* Reason)
+/* Read the list of input files and check that none of them has changed.
+** Return true if so, otherwise set Reason and return false.
+*/
+{
+    unsigned long Count = GetVar ();
+    while (Count--) {
+        struct stat Buf;
+        char* Name = GetStr ();
+        unsigned long Size, MTime, Hash, NewHash;
+
+        (void) GetVar ();
+        Size  = GetVar ();
+        MTime = GetVar ();
+        Hash  = GetVar ();
+        xfree (GetStr ());
+        if (FileStat (Name, &Buf) != 0                  ||
+            (unsigned long) Buf.st_size  != Size        ||
+            (unsigned long) Buf.st_mtime != MTime       ||
+            !HashFile (Name, &NewHash)                  ||
+            NewHash != Hash) {
+            SB_Printf (Reason, "'%s' has changed", Name);
+            xfree (Name);
+            return 0;
+        }
+        xfree (Name);
+    }
+    return 1;
+}
+
+
+
+static void GetFiles (void)
+/* Read the list of input files and register them as already included */
+{
+    unsigned long Count = GetVar ();
+    while (Count--) {
+        char* Name = GetStr ();
+        InputType Type      = (InputType) GetVar ();
+        unsigned long Size  = GetVar ();
+        unsigned long MTime = GetVar ();
+        char* Guard;
+
+        /* The content hash was checked by CheckFiles */
+        (void) GetVar ();
+        Guard = GetStr ();
+        AddPrecompiledFile (Name, Type, Size, MTime, Guard);
+        xfree (Guard);
+        xfree (Name);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                          Symbols and type strings                         */
+/*****************************************************************************/
+
+
+
+static void AddObj (Collection* C, const void* Obj)
+/* Give an object the next id of its kind if it doesn't have one */
+{
+    if (Obj != 0 && HT_Find (&ObjIds, &Obj) == 0) {
+        ObjId* E = xmalloc (sizeof (ObjId));
+        InitHashNode (&E->Node);
+        E->Obj = Obj;
+        CollAppend (C, (void*) Obj);
+        E->Id = CollCount (C);
+        HT_Insert (&ObjIds, E);
+    }
+}
+
+
+
+static void AddSymOwner (const SymEntry* Sym)
+/* Make sure the table containing Sym is stored, so Sym gets an id */
+{
+    if (Sym != 0) {
+        AddObj (&Tables, Sym->Owner);
+    }
+}
+
+
+
+static void AddTypeRefs (const Type* T)
+/* Register the objects a type string refers to */
+{
+    if (T != 0) {
+        while (T->C != T_END) {
+            switch (GetRawTypeRank (T)) {
+                case T_RANK_FUNC:
+                    AddObj (&Funcs, T->A.F);
+                    break;
+                case T_RANK_ENUM:
+                case T_RANK_STRUCT:
+                case T_RANK_UNION:
+                    AddSymOwner (T->A.S);
+                    break;
+                default:
+                    break;
+            }
+            ++T;
+        }
+    }
+}
+
+
+
+static void AddSymRefs (const SymEntry* Sym)
+/* Register the objects a symbol refers to */
+{
+    unsigned Flags = Sym->Flags;
+
+    AddTypeRefs (Sym->Type);
+    if ((Flags & SC_ALIAS) == SC_ALIAS) {
+        AddSymOwner (Sym->V.A.Field);
+    } else {
+        switch (Flags & SC_TYPEMASK) {
+            case SC_STRUCT:
+            case SC_UNION:
+                AddObj (&Tables, Sym->V.S.SymTab);
+                break;
+            case SC_ENUM:
+                AddObj (&Tables, Sym->V.E.SymTab);
+                AddTypeRefs (Sym->V.E.Type);
+                break;
+            case SC_FUNC:
+                AddSymOwner (Sym->V.F.WrappedCall);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+
+
+static void CollectObjects (void)
+/* Number all symbol tables, symbols and function descriptors reachable from
+** the global symbol and tag tables.
+*/
+{
+    unsigned TI = 0;
+    unsigned SI = 0;
+    unsigned FI = 0;
+
+    /* The tables every translation unit has come first */
+    AddObj (&Tables, GetGlobalSymTab ());
+    AddObj (&Tables, GetGlobalTagTab ());
+    AddObj (&Tables, &EmptySymTab);
+
+    /* Follow references until nothing new is found */
+    while (TI < CollCount (&Tables) ||
+           SI < CollCount (&Syms)   ||
+           FI < CollCount (&Funcs)) {
+
+        while (TI < CollCount (&Tables)) {
+            const SymTable* Tab = CollConstAt (&Tables, TI++);
+            const SymEntry* Sym;
+            AddObj (&Tables, Tab->PrevTab);
+            for (Sym = Tab->SymHead; Sym; Sym = Sym->NextSym) {
+                AddObj (&Syms, Sym);
+            }
+        }
+        while (SI < CollCount (&Syms)) {
+            AddSymRefs (CollConstAt (&Syms, SI++));
+        }
+        while (FI < CollCount (&Funcs)) {
+            const FuncDesc* F = CollConstAt (&Funcs, FI++);
+            AddObj (&Tables, F->SymTab);
+            AddObj (&Tables, F->TagTab);
+            AddObj (&Funcs, F->FuncDef);
+            AddSymOwner (F->LastParam);
+        }
+    }
+}
+
+
+
+static int CheckGlobalSyms (void)
+/* Check that the header contains declarations only. Return the number of
+** errors.
+*/
+{
+    unsigned Errors = 0;
+    const SymEntry* Sym;
+
+    for (Sym = GetGlobalSymTab ()->SymHead; Sym; Sym = Sym->NextSym) {
+        unsigned Flags = Sym->Flags;
+        if (SymIsTypeDef (Sym) || (Flags & SC_CONST) == SC_CONST) {
+            continue;
+        }
+        if ((Flags & (SC_DEF | SC_TU_STORAGE)) != 0                  ||
+            ((Flags & SC_TYPEMASK) == SC_FUNC &&
+             (Sym->V.F.Seg != 0 || Sym->V.F.LitPool != 0))) {
+            Error ("Definition of '%s' cannot be stored in a precompiled header",
+                   Sym->Name);
+            ++Errors;
+        }
+    }
+    return Errors;
+}
+
+
+
+static void PutType (StrBuf* B, const Type* T)
+/* Write a type string */
+{
+    if (T == 0) {
+        PutVar (B, 0);
+        return;
+    }
+    PutVar (B, TypeLen (T) + 1);
+    while (T->C != T_END) {
+        PutVar (B, T->C);
+        switch (GetRawTypeRank (T)) {
+            case T_RANK_FUNC:
+                PutRef (B, T->A.F);
+                break;
+            case T_RANK_ENUM:
+            case T_RANK_STRUCT:
+            case T_RANK_UNION:
+                PutRef (B, T->A.S);
+                break;
+            case T_RANK_BITFIELD:
+                PutVar (B, T->A.B.Offs);
+                PutVar (B, T->A.B.Width);
+                break;
+            case T_RANK_VOID:
+            case T_RANK_ARRAY:
+                /* Size of a void object or number of elements */
+                PutLong (B, T->A.L);
+                break;
+            default:
+                /* Not used and may be uninitialized */
+                break;
+        }
+        ++T;
+    }
+}
+
+
+
+static Type* GetType (void)
+/* Read a type string */
+{
+    Type* T;
+    unsigned I;
+    unsigned long Len = GetVar ();
+
+    if (Len == 0) {
+        return 0;
+    }
+    T = TypeAlloc (Len);
+    for (I = 0; I < Len - 1; ++I) {
+        T[I].C = (TypeCode) GetVar ();
+        switch (GetRawTypeRank (T + I)) {
+            case T_RANK_FUNC:
+                T[I].A.F = GetFunc ();
+                break;
+            case T_RANK_ENUM:
+            case T_RANK_STRUCT:
+            case T_RANK_UNION:
+                T[I].A.S = GetSym ();
+                break;
+            case T_RANK_BITFIELD:
+                T[I].A.B.Offs  = (unsigned) GetVar ();
+                T[I].A.B.Width = (unsigned) GetVar ();
+                break;
+            case T_RANK_VOID:
+            case T_RANK_ARRAY:
+                T[I].A.L = GetLong ();
+                break;
+            default:
+                T[I].A.L = 0;
+                break;
+        }
+    }
+    T[I].C   = T_END;
+    T[I].A.L = 0;
+    return T;
+}
+
+
+
+static void PutSym (StrBuf* B, const SymEntry* Sym)
+/* Write the data of a symbol */
+{
+    unsigned Flags = Sym->Flags;
+
+    PutType (B, Sym->Type);
+    PutStr (B, Sym->AsmName? Sym->AsmName : "");
+    if (Sym->Attr) {
+        unsigned I;
+        PutVar (B, CollCount (Sym->Attr) + 1);
+        for (I = 0; I < CollCount (Sym->Attr); ++I) {
+            PutVar (B, ((const DeclAttr*) CollConstAt (Sym->Attr, I))->AttrType);
+        }
+    } else {
+        PutVar (B, 0);
+    }
+
+    /* Symbol type specific data */
+    if ((Flags & SC_ALIAS) == SC_ALIAS) {
+        PutLong (B, Sym->V.A.Offs);
+        PutVar (B, Sym->V.A.ANumber);
+        PutRef (B, Sym->V.A.Field);
+    } else {
+        switch (Flags & SC_TYPEMASK) {
+            case SC_STRUCT:
+            case SC_UNION:
+                PutRef (B, Sym->V.S.SymTab);
+                PutVar (B, Sym->V.S.Size);
+                PutVar (B, Sym->V.S.ACount);
+                break;
+            case SC_ENUM:
+                PutRef (B, Sym->V.E.SymTab);
+                PutType (B, Sym->V.E.Type);
+                break;
+            case SC_FUNC:
+                PutRef (B, Sym->V.F.WrappedCall);
+                PutVar (B, Sym->V.F.WrappedCallData);
+                break;
+            default:
+                if ((Flags & SC_CONST) == SC_CONST) {
+                    PutLong (B, Sym->V.ConstVal);
+                } else {
+                    PutLong (B, Sym->V.R.RegOffs);
+                    PutLong (B, Sym->V.R.SaveOffs);
+                }
+                break;
+        }
+    }
+}
+
+
+
+static void GetSymData (SymEntry* Sym)
+/* Read the data of a symbol */
+{
+    unsigned Flags = Sym->Flags;
+    unsigned long Count;
+    char* AsmName;
+
+    Sym->Type = GetType ();
+    AsmName = GetStr ();
+    if (*AsmName) {
+        Sym->AsmName = AsmName;
+    } else {
+        xfree (AsmName);
+    }
+    Count = GetVar ();
+    if (Count > 0) {
+        Sym->Attr = NewCollection ();
+        while (--Count) {
+            DeclAttr* A = xmalloc (sizeof (DeclAttr));
+            A->AttrType = (DeclAttrType) GetVar ();
+            CollAppend (Sym->Attr, A);
+        }
+    }
+
+    /* Symbol type specific data */
+    if ((Flags & SC_ALIAS) == SC_ALIAS) {
+        Sym->V.A.Offs    = (int) GetLong ();
+        Sym->V.A.ANumber = (unsigned) GetVar ();
+        Sym->V.A.Field   = GetSym ();
+    } else {
+        switch (Flags & SC_TYPEMASK) {
+            case SC_STRUCT:
+            case SC_UNION:
+                Sym->V.S.SymTab = GetTab ();
+                Sym->V.S.Size   = (unsigned) GetVar ();
+                Sym->V.S.ACount = (unsigned) GetVar ();
+                break;
+            case SC_ENUM:
+                Sym->V.E.SymTab = GetTab ();
+                Sym->V.E.Type   = GetType ();
+                break;
+            case SC_FUNC:
+                Sym->V.F.WrappedCall     = GetSym ();
+                Sym->V.F.WrappedCallData = (unsigned) GetVar ();
+                break;
+            default:
+                if ((Flags & SC_CONST) == SC_CONST) {
+                    Sym->V.ConstVal = GetLong ();
+                } else {
+                    Sym->V.R.RegOffs  = (int) GetLong ();
+                    Sym->V.R.SaveOffs = (int) GetLong ();
+                }
+                break;
+        }
+    }
+}
+
+
+
+static void PutSymbols (StrBuf* B)
+/* Write all symbol tables, symbols and function descriptors */
+{
+    unsigned I;
+
+    /* Number everything */
+    CollectObjects ();
+
+    /* Create the tables first, then the symbols in them, so references can
+    ** be resolved when reading the remaining data.
+    */
+    PutVar (B, CollCount (&Tables));
+    for (I = PCH_TAB_COUNT; I < CollCount (&Tables); ++I) {
+        PutVar (B, ((const SymTable*) CollConstAt (&Tables, I))->Size);
+    }
+    PutVar (B, CollCount (&Funcs));
+    PutVar (B, CollCount (&Syms));
+    for (I = 0; I < CollCount (&Syms); ++I) {
+        const SymEntry* Sym = CollConstAt (&Syms, I);
+        PutRef (B, Sym->Owner);
+        PutStr (B, Sym->Name);
+        PutVar (B, Sym->Flags);
+    }
+
+    /* Now the data */
+    for (I = PCH_TAB_COUNT; I < CollCount (&Tables); ++I) {
+        PutRef (B, ((const SymTable*) CollConstAt (&Tables, I))->PrevTab);
+    }
+    for (I = 0; I < CollCount (&Syms); ++I) {
+        PutSym (B, CollConstAt (&Syms, I));
+    }
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        const FuncDesc* F = CollConstAt (&Funcs, I);
+        PutVar (B, F->Flags);
+        PutRef (B, F->SymTab);
+        PutRef (B, F->TagTab);
+        PutVar (B, F->ParamCount);
+        PutVar (B, F->ParamSize);
+        PutVar (B, F->ZPParamSize);
+        PutRef (B, F->LastParam);
+        PutRef (B, F->FuncDef);
+    }
+}
+
+
+
+static void GetSymbols (void)
+/* Read all symbol tables, symbols and function descriptors and add the
+** symbols to their tables.
+*/
+{
+    unsigned I;
+
+    /* Tables */
+    InTabCount = (unsigned) GetVar ();
+    if (InTabCount < PCH_TAB_COUNT) {
+        Fatal ("Precompiled header '%s' is damaged", InName);
+    }
+    InTabs = xmalloc ((InTabCount + 1) * sizeof (SymTable*));
+    InTabs[0]                 = 0;
+    InTabs[PCH_TAB_GLOBALSYM] = GetGlobalSymTab ();
+    InTabs[PCH_TAB_GLOBALTAG] = GetGlobalTagTab ();
+    InTabs[PCH_TAB_EMPTY]     = &EmptySymTab;
+    for (I = PCH_TAB_COUNT + 1; I <= InTabCount; ++I) {
+        InTabs[I] = NewSymTable ((unsigned) GetVar ());
+    }
+
+    /* Function descriptors */
+    InFuncCount = (unsigned) GetVar ();
+    InFuncs = xmalloc ((InFuncCount + 1) * sizeof (FuncDesc*));
+    InFuncs[0] = 0;
+    for (I = 1; I <= InFuncCount; ++I) {
+        InFuncs[I] = NewFuncDesc ();
+    }
+
+    /* Symbols */
+    InSymCount = (unsigned) GetVar ();
+    InSyms = xmalloc ((InSymCount + 1) * sizeof (SymEntry*));
+    InSyms[0] = 0;
+    for (I = 1; I <= InSymCount; ++I) {
+        SymTable* Tab = GetTab ();
+        char* Name = GetStr ();
+        SymEntry* Sym = NewSymEntry (Name, (unsigned) GetVar ());
+        xfree (Name);
+        if (Tab == 0 || Tab == &EmptySymTab) {
+            Fatal ("Precompiled header '%s' is damaged", InName);
+        }
+        AddSymEntry (Tab, Sym);
+        InSyms[I] = Sym;
+    }
+
+    /* Data */
+    for (I = PCH_TAB_COUNT + 1; I <= InTabCount; ++I) {
+        InTabs[I]->PrevTab = GetTab ();
+    }
+    for (I = 1; I <= InSymCount; ++I) {
+        GetSymData (InSyms[I]);
+    }
+    for (I = 1; I <= InFuncCount; ++I) {
+        FuncDesc* F = InFuncs[I];
+        F->Flags        = (unsigned) GetVar ();
+        F->SymTab       = GetTab ();
+        F->TagTab       = GetTab ();
+        F->ParamCount   = (unsigned) GetVar ();
+        F->ParamSize    = (unsigned) GetVar ();
+        F->ZPParamSize  = (unsigned) GetVar ();
+        F->LastParam    = GetSym ();
+        F->FuncDef      = GetFunc ();
+    }
+
+    /* The id tables are no longer needed */
+    xfree (InTabs);
+    xfree (InSyms);
+    xfree (InFuncs);
+    InTabs  = 0;
+    InSyms  = 0;
+    InFuncs = 0;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static int FreeObjId (void* Entry, void* Data attribute ((unused)))
+/* Helper function for ResetPCH: Free an object id and remove it from the
+** table.
+*/
+{
+    xfree (Entry);
+    return 1;
+}
+
+
+
+void ResetPCH (void)
+/* Forget the environment and a loaded precompiled header, so another
+** translation unit can be compiled.
+*/
+{
+    unsigned I;
+
+    SB_Clear (&Env);
+    SB_Clear (&EnvDefs);
+    for (I = 0; I < CollCount (&EnvMacros); ++I) {
+        FreeMacro (CollAtUnchecked (&EnvMacros, I));
+    }
+    CollDeleteAll (&EnvMacros);
+
+    HT_Walk (&ObjIds, FreeObjId, 0);
+    CollDeleteAll (&Tables);
+    CollDeleteAll (&Syms);
+    CollDeleteAll (&Funcs);
+    Unresolved = 0;
+
+    /* A header is only loaded until the first #include */
+    if (InHeader != 0) {
+        SB_Done (&In);
+        xfree (InHeader);
+        InHeader = 0;
+    }
+    InName = 0;
+    xfree (InTabs);
+    xfree (InSyms);
+    xfree (InFuncs);
+    InTabs  = 0;
+    InSyms  = 0;
+    InFuncs = 0;
+}
+
+
+
+void BeginPCH (void)
+/* Remember the environment (options, include paths and macros) a precompiled
+** header is created or used in. Must be called before the main file is
+** opened.
+*/
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    PutEnvironment (&Env);
+
+    /* When using a header, remember the macros to check that none are
+    ** changed before the header is included.
+    */
+    PutMacroDefs (&EnvDefs);
+
+    /* When creating a header, keep the macros to find out later which ones
+    ** the header changed.
+    */
+    if (CreatePCH) {
+        CollectMacros (&Macros);
+        for (I = 0; I < CollCount (&Macros); ++I) {
+            CollAppend (&EnvMacros, CloneMacro (CollConstAt (&Macros, I)));
+        }
+        DoneCollection (&Macros);
+    }
+}
+
+
+
+void WritePCH (const char* Name)
+/* Write the macros, declarations and input files of the translation unit to
+** a precompiled header with the given name.
+*/
+{
+    StrBuf B = AUTO_STRBUF_INITIALIZER;
+    unsigned I;
+    FILE* F;
+
+    /* The header may not contain anything that generates code or data */
+    if (CheckGlobalSyms () > 0) {
+        return;
+    }
+
+    /* Build the file contents in memory */
+    SB_AppendBuf (&B, PCHMagic, sizeof (PCHMagic));
+    PutVar (&B, PCH_VERSION);
+    PutBuf (&B, &Env);
+    for (I = 0; I < GetInputFileCount (); ++I) {
+        const IFile* IF = GetInputFile (I);
+        if (IF->Type == IT_MAIN) {
+            PutStr (&B, IF->Name);
+            break;
+        }
+    }
+    PutFiles (&B);
+    PutVar (&B, GetAnonCount ());
+    PutMacros (&B);
+    PutSymbols (&B);
+
+    /* Don't write a header that cannot be loaded */
+    if (Unresolved > 0) {
+        Error ("Declarations of the header cannot be stored in a precompiled header");
+        SB_Done (&B);
+        return;
+    }
+
+    /* Write it */
+    F = fopen (Name, "wb");
+    if (F == 0) {
+        Fatal ("Cannot open precompiled header '%s': %s", Name, strerror (errno));
+    }
+    if (fwrite (SB_GetConstBuf (&B), 1, SB_GetLen (&B), F) != SB_GetLen (&B) ||
+        fclose (F) != 0) {
+        remove (Name);
+        Fatal ("Cannot write to precompiled header '%s' (disk full?)", Name);
+    }
+
+    SB_Done (&B);
+}
+
+
+
+void LoadPCH (const char* Name)
+/* Read a precompiled header. If it was created in a different environment,
+** or one of its input files has changed since, a warning is output and the
+** header is ignored. Otherwise it is used by UsePCH.
+*/
+{
+    StrBuf FileEnv = AUTO_STRBUF_INITIALIZER;
+    StrBuf Reason  = AUTO_STRBUF_INITIALIZER;
+    unsigned FileStart;
+    const CachedFile* CF;
+
+    /* Get the contents of the file */
+    CF = GetCachedFile (Name);
+    if (CF == 0) {
+        Fatal ("Cannot open precompiled header '%s': %s", Name, strerror (errno));
+    }
+    SB_Init (&In);
+    SB_CopyBuf (&In, CF->F->Buf, (unsigned) CF->Size);
+    SB_SetIndex (&In, 0);
+    InName = Name;
+
+    /* Check the format, then the environment and the input files */
+    if (SB_GetLen (&In) < sizeof (PCHMagic) ||
+        memcmp (SB_GetConstBuf (&In), PCHMagic, sizeof (PCHMagic)) != 0) {
+        Fatal ("'%s' is not a precompiled header", Name);
+    }
+    SB_SkipMultiple (&In, sizeof (PCHMagic));
+    if (GetVar () != PCH_VERSION) {
+        SB_CopyStr (&Reason, "format version mismatch");
+    } else {
+        GetBuf (&FileEnv);
+        if (SB_Compare (&FileEnv, &Env) != 0) {
+            SB_CopyStr (&Reason, "options, include paths or macros differ");
+        } else {
+            InHeader = GetStr ();
+            FileStart = SB_GetIndex (&In);
+            if (CheckFiles (&Reason)) {
+                SB_SetIndex (&In, FileStart);
+            }
+        }
+    }
+    SB_Terminate (&Reason);
+    SB_Done (&FileEnv);
+
+    if (SB_NotEmpty (&Reason)) {
+        Warning ("Precompiled header '%s' not used: %s",
+                 Name, SB_GetConstBuf (&Reason));
+        xfree (InHeader);
+        InHeader = 0;
+        SB_Done (&In);
+        InName = 0;
+    }
+
+    SB_Done (&Reason);
+}
+
+
+
+int UsePCH (const char* FileName)
+/* Called for each #include with the name of the file found. If a precompiled
+** header was loaded, this is the first #include, and the file is the header
+** it was created from, take over the state of the compiler after the header
+** and return true. In this case, the file must not be read. Otherwise, return
+** false.
+*/
+{
+    StrBuf Reason  = AUTO_STRBUF_INITIALIZER;
+    StrBuf Defs    = AUTO_STRBUF_INITIALIZER;
+    int    Used    = 0;
+
+    /* Only the first #include may be replaced */
+    if (InHeader == 0) {
+        return 0;
+    }
+
+    /* The header must be the file included, and nothing may have been
+    ** declared or defined before, since the state after the header would
+    ** be different otherwise.
+    */
+    PutMacroDefs (&Defs);
+    if (strcmp (FileName, InHeader) != 0) {
+        SB_Printf (&Reason, "the first #include is not '%s'", InHeader);
+    } else if (PreprocessSawCode ()) {
+        SB_CopyStr (&Reason, "there is code before the #include");
+    } else if (SB_Compare (&Defs, &EnvDefs) != 0) {
+        SB_CopyStr (&Reason, "macros were changed before the #include");
+    }
+    SB_Terminate (&Reason);
+    SB_Done (&Defs);
+
+    if (SB_NotEmpty (&Reason)) {
+        PPWarning ("Precompiled header '%s' not used: %s",
+                   InName, SB_GetConstBuf (&Reason));
+    } else {
+        /* Take over the state of the compiler after the header */
+        GetFiles ();
+        SetAnonCount ((unsigned) GetVar ());
+        GetMacros ();
+        GetSymbols ();
+        Print (stdout, 1, "Loaded precompiled header '%s'\n", InName);
+        Used = 1;
+    }
+
+    SB_Done (&Reason);
+    SB_Done (&In);
+    xfree (InHeader);
+    InHeader = 0;
+    InName = 0;
+    return Used;
+}
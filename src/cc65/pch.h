@@ -0,0 +1,78 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.h                                   */
+/*                                                                           */
+/*             Precompiled header support for the cc65 C compiler            */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PCH_H
+#define PCH_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ResetPCH (void);
+/* Forget the environment and a loaded precompiled header, so another
+** translation unit can be compiled.
+*/
+
+void BeginPCH (void);
+/* Remember the environment (options, include paths and macros) a precompiled
+** header is created or used in. Must be called before the main file is
+** opened.
+*/
+
+void WritePCH (const char* Name);
+/* Write the macros, declarations and input files of the translation unit to
+** a precompiled header with the given name.
+*/
+
+void LoadPCH (const char* Name);
+/* Read a precompiled header. If it was created in a different environment,
+** or one of its input files has changed since, a warning is output and the
+** header is ignored. Otherwise it is used by UsePCH.
+*/
+
+int UsePCH (const char* FileName);
+/* Called for each #include with the name of the file found. If a precompiled
+** header was loaded, this is the first #include, and the file is the header
+** it was created from, take over the state of the compiler after the header
+** and return true. In this case, the file must not be read. Otherwise, return
+** false.
+*/
+
+
+
+/* End of pch.h */
+
+#endif
@@ -897,6 +897,15 @@ static void ParsePragmaString (StrBuf* B)
         goto ExitPoint;
     }
 
+    /* A precompiled header records declarations and macros only, so pragmas
+    ** with other lasting effects cannot be used in it.
+    */
+    if (CreatePCH && Pragma != PRAGMA_MESSAGE && Pragma != PRAGMA_ZPSYM) {
+        Error ("Pragma '%s' cannot be used in a precompiled header",
+               SB_GetConstBuf (&Ident));
+        goto ExitPoint;
+    }
+
     /* Check for an open paren */
     SB_SkipWhite (B);
     if (SB_Get (B) != '(') {
@@ -121,6 +121,9 @@ static unsigned PendingNewLines;
 static unsigned ContinuedLines;
 static int FileChanged;
 
+/* Set once a line that is not a directive is passed to the compiler */
+static int SawCode = 0;
+
 /* Structure used when expanding macros */
 typedef struct MacroExp MacroExp;
 struct MacroExp {
@@ -148,6 +151,30 @@ struct HiddenMacro {
     HideRange*      HS;
 };
 
+/* Only the replacement lists of macros are kept as pp-tokens. Arguments and
+** the results of an expansion are still text that is rescanned, and hide
+** sets are ranges of identifier indices in that text, not sets attached to
+** single pp-tokens. Identifiers are not interned.
+*/
+
+/* Types of pp-tokens in a tokenized macro replacement list */
+#define MRT_IDENT       0U      /* Identifier that is no macro parameter */
+#define MRT_PARAM       1U      /* Macro parameter */
+#define MRT_PASTE       2U      /* ## operator */
+#define MRT_STRINGIZE   3U      /* # operator with its macro parameter */
+#define MRT_RPAREN      4U      /* Right parenthesis */
+#define MRT_OTHER       5U      /* Any other pp-token or single character */
+
+/* A pp-token in a tokenized macro replacement list */
+typedef struct MacroTok MacroTok;
+struct MacroTok {
+    unsigned char   Type;           /* Type of the pp-token */
+    unsigned char   Space;          /* Whitespace follows the pp-token */
+    int             Param;          /* Parameter index for MRT_PARAM/MRT_STRINGIZE */
+    unsigned        Len;            /* Length of the text */
+    char            Text[1];        /* Text of the pp-token, dynamically allocated */
+};
+
 
 
 /*****************************************************************************/
@@ -546,6 +573,27 @@ static void ME_HandleSemiNestedMacro (unsigned NameIdx, unsigned LastIdx, MacroE
 
 
 
+static void ME_DropPassedHideSets (unsigned Idx, MacroExp* E)
+/* Free the hide ranges that end before the Idx'th identifier. Once the scan
+** has passed them, they cannot affect any identifier still to be expanded.
+** Since the ranges are sorted, this is usually just popping the first ones.
+*/
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&E->HideSets); ++I) {
+        HiddenMacro* MHS = CollAtUnchecked (&E->HideSets, I);
+
+        while (MHS->HS != 0 && MHS->HS->End <= Idx) {
+            HideRange* Next = MHS->HS->Next;
+            FreeHideRange (MHS->HS);
+            MHS->HS = Next;
+        }
+    }
+}
+
+
+
 static void ME_AddArgHideSets (unsigned Idx, const MacroExp* A, MacroExp* Parent)
 /* Propagate the macro hide sets of the substituted argument starting as the
 ** Idx'th identifier of the result.
@@ -719,6 +767,7 @@ static void DoneMacroExp (MacroExp* E)
     SB_Done (&E->Tokens);
     if (E->Replaced != 0) {
         DoneMacroExp (E->Replaced);
+        xfree (E->Replaced);
     }
 }
 
@@ -1741,18 +1790,33 @@ static unsigned ReadMacroArgs (unsigned NameIdx, MacroExp* E, const Macro* M, in
 
 
 
-static unsigned SubstMacroArgs (unsigned NameIdx, StrBuf* Target, MacroExp* E, Macro* M, unsigned* IdentCount)
-/* Argument substitution according to ISO/IEC 9899:1999 (E), 6.10.3.1ff.
-** Return the length of the last pp-token in the result and output the count
-** of identifiers and right parentheses in the result to *IdentCount.
+static void AddMacroTok (Macro* M, unsigned Type, int Param, const StrBuf* Text)
+/* Append a pp-token to the tokenized replacement list of a macro */
+{
+    unsigned  Len = SB_GetLen (Text);
+    MacroTok* T   = xmalloc (sizeof (MacroTok) + Len);
+
+    T->Type  = (unsigned char) Type;
+    T->Space = 0;
+    T->Param = Param;
+    T->Len   = Len;
+    memcpy (T->Text, SB_GetConstBuf (Text), Len);
+    T->Text[Len] = '\0';
+
+    CollAppend (&M->Tokens, T);
+}
+
+
+
+static void TokenizeMacro (Macro* M)
+/* Split the replacement list of a macro into pp-tokens, so that it needn't
+** be lexed again each time the macro is expanded.
 */
 {
-    unsigned    Idx         = NameIdx;
     ident       Ident;
-    unsigned    TokLen      = 0;
     int         ParamIdx;
+    int         AfterPaste  = 0;
     StrBuf*     OldSource;
-    int         HaveSpace   = 0;
     StrBuf      Buf         = AUTO_STRBUF_INITIALIZER;  /* Temporary buffer */
 
     /* Remember the current input stack and disable it for now */
@@ -1764,130 +1828,197 @@ static unsigned SubstMacroArgs (unsigned NameIdx, StrBuf* Target, MacroExp* E, M
     SB_Reset (&M->Replacement);
     OldSource = InitLine (&M->Replacement);
 
-    /* If the macro expansion replaces an function-like macro with an argument
-    ** list containing a right parenthesis outside the hidesets of previously
-    ** replaced macros, stop those hidesets from this replacement. This is not
-    ** required by the standard but just to match up with other major C
-    ** compilers.
-    */
-    ME_HandleSemiNestedMacro (NameIdx, NameIdx + *IdentCount, E);
-
-    /* Substitution loop */
     while (CurC != '\0') {
-        int NeedPaste = 0;
+        MacroTok* T;
 
-        /* If we have an identifier, check if it's a macro */
+        SB_Clear (&Buf);
         if (IsSym (Ident)) {
+            /* An identifier, check if it's a macro parameter */
+            ParamIdx = FindMacroParam (M, Ident);
+            SB_AppendStr (&Buf, Ident);
+            AddMacroTok (M, ParamIdx >= 0 ? MRT_PARAM : MRT_IDENT, ParamIdx, &Buf);
+        } else if (!AfterPaste && CurC == '#' && NextC == '#') {
+            /* ## operator. The pp-token following it is read as-is. */
+            NextChar ();
+            NextChar ();
+            SkipWhitespace (0);
+            SB_AppendStr (&Buf, "##");
+            AddMacroTok (M, MRT_PASTE, -1, &Buf);
+            AfterPaste = 1;
+            continue;
+        } else if (IsPPNumber (CurC, NextC)) {
+            CopyPPNumber (&Buf);
+            AddMacroTok (M, MRT_OTHER, -1, &Buf);
+        } else if (IsQuotedString ()) {
+            CopyQuotedString (&Buf);
+            AddMacroTok (M, MRT_OTHER, -1, &Buf);
+        } else if (CurC == '#' && M->ParamCount >= 0) {
+            /* A # operator within a macro expansion of a function-like
+            ** macro. Read the following identifier and check if it's a
+            ** macro parameter.
+            */
+            NextChar ();
+            SkipWhitespace (0);
+            if (!IsSym (Ident) || (ParamIdx = FindMacroParam (M, Ident)) < 0) {
+                /* Should not happen, but still */
+                Internal ("'#' is not followed by a macro parameter");
+            }
+            SB_AppendChar (&Buf, '#');
+            AddMacroTok (M, MRT_STRINGIZE, ParamIdx, &Buf);
+        } else if (GetPunc (Ident)) {
+            /* Right parens are tracked just like identifiers */
+            SB_AppendStr (&Buf, Ident);
+            AddMacroTok (M, Ident[0] == ')' ? MRT_RPAREN : MRT_OTHER, -1, &Buf);
+        } else {
+            SB_AppendChar (&Buf, CurC);
+            NextChar ();
+            AddMacroTok (M, MRT_OTHER, -1, &Buf);
+        }
 
-            /* Remember and skip any following whitespace */
-            HaveSpace = SkipWhitespace (0);
+        /* Remember any following whitespace */
+        T = CollLast (&M->Tokens);
+        T->Space = SkipWhitespace (0) != 0;
+        AfterPaste = 0;
+    }
 
-            /* Check if it's a macro parameter */
-            if ((ParamIdx = FindMacroParam (M, Ident)) >= 0) {
+    /* Done with the temporary buffer */
+    SB_Done (&Buf);
 
-                /* If a ## operator follows, we have to insert the actual
-                ** argument as-is, otherwise it must be macro-replaced.
-                */
-                if (CurC == '#' && NextC == '#') {
+    /* Switch back the input */
+    UseInputStack (OldInputStack);
+    InitLine (OldSource);
+    SB_SetIndex (&M->Replacement, OldIndex);
+}
 
-                    /* Get the corresponding actual argument */
-                    const MacroExp* A = ME_GetOriginalArg (E, ParamIdx);
 
-                    /* Separate with a white space if necessary */
-                    if (CheckPastePPTok (Target, TokLen, SB_Peek (&A->Tokens))) {
-                        SB_AppendChar (Target, ' ');
-                    }
 
-                    /* For now we need no placemarkers */
-                    SB_Append (Target, &A->Tokens);
+static unsigned SubstMacroArgs (unsigned NameIdx, StrBuf* Target, MacroExp* E, Macro* M, unsigned* IdentCount)
+/* Argument substitution according to ISO/IEC 9899:1999 (E), 6.10.3.1ff.
+** Return the length of the last pp-token in the result and output the count
+** of identifiers and right parentheses in the result to *IdentCount.
+*/
+{
+    unsigned    Idx         = NameIdx;
+    unsigned    HideIdx     = NameIdx;  /* Hide sets are adjusted up to here */
+    unsigned    TokLen      = 0;
+    unsigned    I           = 0;
+    int         HaveSpace   = 0;
+    StrBuf      Buf         = AUTO_STRBUF_INITIALIZER;  /* Temporary buffer */
 
-                    /* Adjust tracking */
-                    ME_OffsetHideSets (Idx, A->IdentCount, E);
-                    Idx += A->IdentCount;
+    /* Remember the current input stack and disable it for now */
+    Collection* OldInputStack = UseInputStack (0);
 
-                    /* This will be used for concatenation */
-                    TokLen = A->LastTokLen;
+    /* Tokenize the replacement list if this hasn't been done before */
+    if (CollCount (&M->Tokens) == 0) {
+        TokenizeMacro (M);
+    }
 
-                } else {
+    /* If the macro expansion replaces an function-like macro with an argument
+    ** list containing a right parenthesis outside the hidesets of previously
+    ** replaced macros, stop those hidesets from this replacement. This is not
+    ** required by the standard but just to match up with other major C
+    ** compilers.
+    */
+    ME_HandleSemiNestedMacro (NameIdx, NameIdx + *IdentCount, E);
 
-                    /* Get the corresponding macro-replaced argument */
-                    const MacroExp* A = ME_GetReplacedArg (E, ParamIdx);
+    /* Substitution loop. Hide sets are not offset for each single tracked
+    ** pp-token, but only once for a run of them before they are needed.
+    */
+    while (I < CollCount (&M->Tokens)) {
+        const MacroTok* T = CollAtUnchecked (&M->Tokens, I++);
+        const MacroTok* N = I < CollCount (&M->Tokens) ?
+                            CollAtUnchecked (&M->Tokens, I) : 0;
+        int NeedPaste = 0;
 
-                    /* Separate with a white space if necessary */
-                    if (CheckPastePPTok (Target, TokLen, SB_Peek (&A->Tokens))) {
-                        SB_AppendChar (Target, ' ');
-                    }
+        /* If we have an identifier, check if it's a macro parameter */
+        if (T->Type == MRT_PARAM) {
 
-                    /* Append the replaced string */
-                    SB_Append (Target, &A->Tokens);
+            /* If a ## operator follows, we have to insert the actual
+            ** argument as-is, otherwise it must be macro-replaced.
+            */
+            if (N != 0 && N->Type == MRT_PASTE) {
 
-                    /* Insert the range of identifiers to parent preceding this argument */
-                    ME_OffsetHideSets (Idx, A->IdentCount, E);
+                /* Get the corresponding actual argument */
+                const MacroExp* A = ME_GetOriginalArg (E, T->Param);
 
-                    /* Add hide range */
-                    ME_AddArgHideSets (Idx, A, E);
+                /* Separate with a white space if necessary */
+                if (CheckPastePPTok (Target, TokLen, SB_Peek (&A->Tokens))) {
+                    SB_AppendChar (Target, ' ');
+                }
 
-                    /* Adjust tracking */
-                    Idx += A->IdentCount;
+                /* For now we need no placemarkers */
+                SB_Append (Target, &A->Tokens);
 
-                    /* May be used for later pp-token merge check */
-                    TokLen = A->LastTokLen;
-                }
+                /* Adjust tracking */
+                Idx += A->IdentCount;
+
+                /* This will be used for concatenation */
+                TokLen = A->LastTokLen;
 
             } else {
 
-                /* An identifier, keep it */
-                SB_AppendStr (Target, Ident);
+                /* Get the corresponding macro-replaced argument */
+                const MacroExp* A = ME_GetReplacedArg (E, T->Param);
+
+                /* Separate with a white space if necessary */
+                if (CheckPastePPTok (Target, TokLen, SB_Peek (&A->Tokens))) {
+                    SB_AppendChar (Target, ' ');
+                }
+
+                /* Append the replaced string */
+                SB_Append (Target, &A->Tokens);
+
+                /* Insert the range of identifiers to parent preceding this argument */
+                ME_OffsetHideSets (HideIdx, Idx + A->IdentCount - HideIdx, E);
+
+                /* Add hide range */
+                ME_AddArgHideSets (Idx, A, E);
 
                 /* Adjust tracking */
-                ME_OffsetHideSets (Idx, 1, E);
-                ++Idx;
+                Idx += A->IdentCount;
+                HideIdx = Idx;
 
-                /* May be used for later concatenation */
-                TokLen = strlen (Ident);
+                /* May be used for later pp-token merge check */
+                TokLen = A->LastTokLen;
             }
 
-            /* Special casing for 'L' prefixing '#' */
-            if (TokLen == 1 && SB_LookAtLast (Target) == 'L' && CurC == '#') {
-                HaveSpace = 1;
-            }
+        } else if (T->Type == MRT_IDENT) {
 
-            /* Squeeze and add the skipped whitespace back for consistency */
-            if (HaveSpace && !IsBlank (SB_LookAtLast (Target))) {
-                SB_AppendChar (Target, ' ');
-            }
+            /* An identifier, keep it */
+            SB_AppendBuf (Target, T->Text, T->Len);
 
-            /* Done with this substituted argument */
-            continue;
+            /* Adjust tracking */
+            ++Idx;
 
-        } else if (CurC == '#' && NextC == '#') {
+            /* May be used for later concatenation */
+            TokLen = T->Len;
 
-            /* ## operator */
-            NextChar ();
-            NextChar ();
-            SkipWhitespace (0);
+        } else {
 
-            /* If the next token is an identifier which is a macro argument,
-            ** replace it, otherwise just add it.
-            */
-            if (IsSym (Ident)) {
-                unsigned NewCount = 1;
+            if (T->Type == MRT_PASTE) {
+
+                /* ## operator. ParseMacroReplacement makes sure that it is
+                ** never the last pp-token.
+                */
+                T = CollAt (&M->Tokens, I++);
 
-                /* Check if it's a macro parameter */
-                if ((ParamIdx = FindMacroParam (M, Ident)) >= 0) {
+                /* If the next token is an identifier which is a macro argument,
+                ** replace it, otherwise just add it.
+                */
+                if (T->Type == MRT_PARAM) {
 
                     /* Get the corresponding actual argument */
-                    MacroExp* A = ME_GetOriginalArg (E, ParamIdx);
+                    MacroExp* A = ME_GetOriginalArg (E, T->Param);
+
+                    /* Adjust tracking */
+                    unsigned NewCount = A->IdentCount;
 
                     /* Insert the range of identifiers to parent preceding this argument */
-                    ME_OffsetHideSets (Idx, A->IdentCount, E);
+                    ME_OffsetHideSets (HideIdx, Idx + A->IdentCount - HideIdx, E);
 
                     /* Add hide range */
                     ME_AddArgHideSets (Idx, A, E);
 
-                    /* Adjust tracking */
-                    NewCount = A->IdentCount;
-
                     /* If the preceding pp-token is not a placemarker and is
                     ** concatenated to with an identifier, the count of tracked
                     ** identifiers is then one less.
@@ -1906,131 +2037,114 @@ static unsigned SubstMacroArgs (unsigned NameIdx, StrBuf* Target, MacroExp* E, M
                         TokLen = A->LastTokLen;
                     }
 
-                } else {
+                    /* Adjust tracking */
+                    Idx += NewCount;
+                    HideIdx = Idx;
 
-                    unsigned Len;
+                } else if (T->Type == MRT_IDENT) {
 
                     /* Just an ordinary identifier - add as-is */
-                    SB_CopyStr (&Buf, Ident);
+                    SB_CopyBuf (&Buf, T->Text, T->Len);
 
                     /* If the preceding pp-token is not a placemarker and is
                     ** concatenated to with an identifier, the count of tracked
                     ** identifiers is then one less.
                     */
-                    Len = SB_GetLen (&Buf);
-                    if (TryPastePPTok (Target, &Buf, TokLen, Len)) {
-                        if (TokLen > 0) {
-                            --NewCount;
+                    if (TryPastePPTok (Target, &Buf, TokLen, T->Len)) {
+                        if (TokLen == 0) {
+                            ++Idx;
                         }
-                        TokLen += Len;
+                        TokLen += T->Len;
                     } else {
-                        TokLen = Len;
+                        ++Idx;
+                        TokLen = T->Len;
                     }
 
-                    /* Adjust tracking */
-                    ME_OffsetHideSets (Idx, NewCount, E);
-
                 }
 
-                /* Adjust tracking */
-                Idx += NewCount;
+                if (T->Type == MRT_PARAM || T->Type == MRT_IDENT) {
+                    /* Keep the whitespace for consistency */
+                    if (T->Space && !IsBlank (SB_LookAtLast (Target))) {
+                        SB_AppendChar (Target, ' ');
+                    }
 
-                /* Keep the whitespace for consistency */
-                HaveSpace = SkipWhitespace (0);
-                if (HaveSpace && !IsBlank (SB_LookAtLast (Target))) {
-                    SB_AppendChar (Target, ' ');
+                    /* Done with this concatenated identifier */
+                    continue;
                 }
 
-                /* Done with this concatenated identifier */
-                continue;
-            }
-
-            if (CurC != '\0') {
                 /* Non-identifiers may still be pasted together */
                 NeedPaste = 1;
             }
 
-        }
-
-        /* Use the temporary buffer */
-        SB_Clear (&Buf);
-        if (IsPPNumber (CurC, NextC)) {
-            CopyPPNumber (&Buf);
-        } else if (IsQuotedString ()) {
-            CopyQuotedString (&Buf);
-        } else {
-            if (CurC == '#' && M->ParamCount >= 0) {
-                /* A # operator within a macro expansion of a function-like
-                ** macro. Read the following identifier and check if it's a
-                ** macro parameter.
-                */
-                NextChar ();
-                SkipWhitespace (0);
-                if (!IsSym (Ident) || (ParamIdx = FindMacroParam (M, Ident)) < 0) {
-                    /* Should not happen, but still */
-                    Internal ("'#' is not followed by a macro parameter");
-                } else {
-                    /* Make a valid string from Replacement */
-                    MacroExp* A = ME_GetOriginalArg (E, ParamIdx);
-                    SB_Reset (&A->Tokens);
-                    Stringize (&A->Tokens, &Buf);
-                }
-            } else if (GetPunc (Ident)) {
+            /* Use the temporary buffer */
+            SB_Clear (&Buf);
+            if (T->Type == MRT_STRINGIZE) {
+                /* Make a valid string from Replacement */
+                MacroExp* A = ME_GetOriginalArg (E, T->Param);
+                SB_Reset (&A->Tokens);
+                Stringize (&A->Tokens, &Buf);
+            } else {
                 /* Count right parens. This is OK since they cannot be pasted
                 ** to form different punctuators with others.
                 */
-                if (Ident[0] == ')') {
+                if (T->Type == MRT_RPAREN) {
                     /* Adjust tracking */
-                    ME_OffsetHideSets (Idx, 1, E);
                     ++Idx;
                 }
-                SB_AppendStr (&Buf, Ident);
-            } else if (CurC != '\0') {
-                SB_AppendChar (&Buf, CurC);
-                NextChar ();
+                SB_AppendBuf (&Buf, T->Text, T->Len);
             }
-        }
-
-        /* Squeeze any whitespace for consistency. Especially, comments must
-        ** be consumed before fed to the punctuator parser, or their leading
-        ** '/' characters would be parsed wrongly as division operators.
-        */
-        HaveSpace = SkipWhitespace (0);
 
-        if (NeedPaste) {
-            unsigned Len = SB_GetLen (&Buf);
+            if (NeedPaste) {
+                unsigned Len = SB_GetLen (&Buf);
 
-            /* Concatenate pp-tokens */
-            if (TryPastePPTok (Target, &Buf, TokLen, Len)) {
-                TokLen += Len;
+                /* Concatenate pp-tokens */
+                if (TryPastePPTok (Target, &Buf, TokLen, Len)) {
+                    TokLen += Len;
+                } else {
+                    TokLen = Len;
+                }
             } else {
-                TokLen = Len;
+                /* Just append the token */
+                SB_Append (Target, &Buf);
+                TokLen = SB_GetLen (&Buf);
             }
-        } else {
-            /* Just append the token */
-            SB_Append (Target, &Buf);
-            TokLen = SB_GetLen (&Buf);
+
+            if (T->Space && !IsBlank (SB_LookAtLast (Target))) {
+                SB_AppendChar (Target, ' ');
+            }
+
+            /* Done with this pp-token */
+            continue;
+        }
+
+        /* Remember the skipped whitespace */
+        HaveSpace = T->Space;
+
+        /* Special casing for 'L' prefixing '#' */
+        if (TokLen == 1 && SB_LookAtLast (Target) == 'L' && N != 0 && N->Text[0] == '#') {
+            HaveSpace = 1;
         }
 
+        /* Squeeze and add the skipped whitespace back for consistency */
         if (HaveSpace && !IsBlank (SB_LookAtLast (Target))) {
             SB_AppendChar (Target, ' ');
         }
-
     }
 
     /* Done with the temporary buffer */
     SB_Done (&Buf);
 
+    /* Offset the hide sets for the remaining tracked pp-tokens */
+    ME_OffsetHideSets (HideIdx, Idx - HideIdx, E);
+
     /* Remove the macro name itself together with the arguments (if any) */
     ME_RemoveToken (Idx, 1 + *IdentCount, E);
 
     /* Hide this macro for the whole result of this expansion */
     ME_HideMacro (NameIdx, Idx - NameIdx, E, M);
 
-    /* Switch back the input */
+    /* Switch back the input stack */
     UseInputStack (OldInputStack);
-    InitLine (OldSource);
-    SB_SetIndex (&M->Replacement, OldIndex);
 
     /* Set the count of identifiers and right parentheses in the result */
     *IdentCount = Idx - NameIdx;
@@ -2161,6 +2275,14 @@ static unsigned ReplaceMacros (StrBuf* Source, StrBuf* Target, MacroExp* E, unsi
             } else {
                 Macro* M = FindMacro (Ident);
 
+                /* The hide sets of already scanned identifiers are no longer
+                ** needed, unless this is a macro argument whose hide sets
+                ** are later propagated into the replacement list.
+                */
+                if (M != 0 && (ModeFlags & MSM_IN_ARG_EXPANSION) == 0) {
+                    ME_DropPassedHideSets (Count, E);
+                }
+
                 /* Check if it's an expandable macro */
                 if (M != 0 && ME_CanExpand (Count, E, M)) {
                     int      MultiLine = (ModeFlags & MSM_MULTILINE) != 0;
@@ -2421,7 +2543,7 @@ Loop:
     SB_Append (Target, TmpTarget);
 
     /* Done with the temporary buffer */
-    SB_Done (TmpTarget);
+    FreeStrBuf (TmpTarget);
 
     /* Drop whitespace at the end */
     if (IsBlank (SB_LookAtLast (Target))) {
@@ -3311,9 +3433,11 @@ void HandleSpecialMacro (Macro* M, const char* Name)
             PPWarning ("__COUNTER__ is a cc65 extension");
         }
         SB_Printf (&M->Replacement, "%u", GetCurrentCounter ());
+        FreeMacroTokens (M);
     } else if (strcmp (Name, "__LINE__") == 0) {
         /* Replace __LINE__ with the current line number */
         SB_Printf (&M->Replacement, "%u", GetCurrentLineNum ());
+        FreeMacroTokens (M);
     } else if (strcmp (Name, "__FILE__") == 0) {
         /* Replace __FILE__ with the current filename */
         StrBuf B = AUTO_STRBUF_INITIALIZER;
@@ -3321,6 +3445,7 @@ void HandleSpecialMacro (Macro* M, const char* Name)
         SB_Clear (&M->Replacement);
         Stringize (&B, &M->Replacement);
         SB_Done (&B);
+        FreeMacroTokens (M);
     }
 }
 
@@ -3408,6 +3533,9 @@ void Preprocess (void)
     ParseDirectives (MSM_MULTILINE);
     OLine = 0;
     CurInput->GFlags &= ~IG_NEWFILE;
+    if (CurC != '\0') {
+        SawCode = 1;
+    }
 
     /* Add the source info to preprocessor output if needed */
     AddPreLine (PLine);
@@ -3440,6 +3568,14 @@ void Preprocess (void)
 
 
 
+int PreprocessSawCode (void)
+/* Return true if a line that is not a directive was passed to the compiler */
+{
+    return SawCode;
+}
+
+
+
 void InitPreprocess (void)
 /* Init preprocessor */
 {
@@ -3460,6 +3596,25 @@ void DonePreprocess (void)
 
 
 
+void ResetPreprocess (void)
+/* Forget the state of the preprocessor, so another translation unit can be
+** compiled.
+*/
+{
+    CurInput        = 0;
+    PPStack         = 0;
+    CurRescanStack  = 0;
+    PLine           = 0;
+    MLine           = 0;
+    OLine           = 0;
+    PendingNewLines = 0;
+    ContinuedLines  = 0;
+    FileChanged     = 0;
+    SawCode         = 0;
+}
+
+
+
 void SetPPIfStack (PPIfStack* Stack)
 /* Specify which PP #if stack to use */
 {
@@ -76,12 +76,20 @@ void TranslationPhase3 (StrBuf* Source, StrBuf* Target);
 void Preprocess (void);
 /* Preprocess a line */
 
+int PreprocessSawCode (void);
+/* Return true if a line that is not a directive was passed to the compiler */
+
 void InitPreprocess (void);
 /* Init preprocessor */
 
 void DonePreprocess (void);
 /* Done with preprocessor */
 
+void ResetPreprocess (void);
+/* Forget the state of the preprocessor, so another translation unit can be
+** compiled.
+*/
+
 void SetPPIfStack (PPIfStack* Stack);
 /* Specify which PP #if stack to use */
 
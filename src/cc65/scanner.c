@@ -1589,3 +1589,18 @@ int ConsumeRCurly (void)
 {
     return Consume (TOK_RCURLY, "'}' expected");
 }
+
+
+
+void ResetScanner (void)
+/* Forget the tokens and the state of the scanner, so another translation
+** unit can be compiled.
+*/
+{
+    memset (&SavedTok, 0, sizeof (SavedTok));
+    memset (&CurTok, 0, sizeof (CurTok));
+    memset (&NextTok, 0, sizeof (NextTok));
+    PPParserRunning = 0;
+    NoCharMap       = 0;
+    InPragmaParser  = 0;
+}
@@ -360,6 +360,11 @@ int ConsumeLCurly (void);
 int ConsumeRCurly (void);
 /* Check for a right curly brace and skip it */
 
+void ResetScanner (void);
+/* Forget the tokens and the state of the scanner, so another translation
+** unit can be compiled.
+*/
+
 
 
 /* End of scanner.h */
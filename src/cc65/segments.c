@@ -88,6 +88,9 @@ static Collection SegmentAddrSizes;
 */
 static Collection SegContextStack = STATIC_COLLECTION_INITIALIZER;
 
+/* All segment contexts of the translation unit, so they can be freed */
+static Collection SegContexts = STATIC_COLLECTION_INITIALIZER;
+
 
 
 /*****************************************************************************/
@@ -186,6 +189,17 @@ void InitSegNames (void)
 
 
 
+void ResetSegNames (void)
+/* Remove the segment names, so InitSegNames may be called again */
+{
+    unsigned I;
+    for (I = 0; I < SEG_COUNT; ++I) {
+        SS_Clear (&SegmentNames[I]);
+    }
+}
+
+
+
 void SetSegName (segment_t Seg, const char* Name)
 /* Set a new name for a segment */
 {
@@ -248,6 +262,9 @@ static SegContext* NewSegContext (SymEntry* Func)
     S->NextLabel     = 0;
     S->NextDataLabel = 0;
 
+    /* Remember the context */
+    CollAppend (&SegContexts, S);
+
     /* Return the new struct */
     return S;
 }
@@ -289,6 +306,29 @@ void CreateGlobalSegments (void)
 
 
 
+void ResetSegContexts (void)
+/* Free the segment contexts of the last translation unit, so another one
+** can be compiled.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&SegContexts); ++I) {
+        SegContext* S = CollAtUnchecked (&SegContexts, I);
+        FreeTextSeg (S->Text);
+        FreeCodeSeg (S->Code);
+        FreeDataSeg (S->Data);
+        FreeDataSeg (S->ROData);
+        FreeDataSeg (S->BSS);
+        xfree (S);
+    }
+    CollDeleteAll (&SegContexts);
+    CollDeleteAll (&SegContextStack);
+    CS = 0;
+    GS = 0;
+}
+
+
+
 void UseDataSeg (segment_t DSeg)
 /* For the current segment context, use the data segment DSeg */
 {
@@ -120,6 +120,9 @@ unsigned char GetSegAddrSize (const char* Name);
 void InitSegNames (void);
 /* Initialize the segment names */
 
+void ResetSegNames (void);
+/* Remove the segment names, so InitSegNames may be called again */
+
 void SetSegName (segment_t Seg, const char* Name);
 /* Set a new name for a segment */
 
@@ -141,6 +144,11 @@ void PopSegContext (void);
 void CreateGlobalSegments (void);
 /* Create the global segments and remember them in GS */
 
+void ResetSegContexts (void);
+/* Free the segment contexts of the last translation unit, so another one
+** can be compiled.
+*/
+
 void UseDataSeg (segment_t DSeg);
 /* For the current segment context, use the data segment DSeg */
 
@@ -0,0 +1,369 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  server.c                                 */
+/*                                                                           */
+/*                Compile server mode for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* The protocol is simple: A client connects to the socket and sends the
+** working directory and the arguments of the job as a sequence of zero
+** terminated strings. With the first part of the data, it passes its
+** standard output and standard error descriptors, so the compiler writes to
+** them directly. The client then shuts down its side of the connection, and
+** receives a single byte with the exit code when the job is done.
+*/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <setjmp.h>
+#if !defined(_WIN32) && !defined(_AMIGA)
+#  include <signal.h>
+#  include <unistd.h>
+#  include <sys/types.h>
+#  include <sys/socket.h>
+#  include <sys/stat.h>
+#  include <sys/uio.h>
+#  include <sys/un.h>
+#endif
+
+/* common */
+#include "abend.h"
+#include "attrib.h"
+#include "cmdline.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "server.h"
+
+
+
+#if defined(_WIN32) || defined(_AMIGA)
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RunServer (const char* Name attribute ((unused)),
+                int (*Job) (void) attribute ((unused)))
+/* Run the compiler as a compile server listening on the local socket with
+** the given name. Not supported on this platform.
+*/
+{
+    AbEnd ("Compile server mode is not supported on this platform");
+}
+
+
+
+#else
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Name of the compiler binary, passed as argv[0] to the jobs */
+static char* BinName;
+
+/* Where a job ends if it terminates the program, and its exit code */
+static jmp_buf JobEnd;
+static int     JobCode;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void JobExit (int Code)
+/* Exit hook while a job runs: End the job instead of the program */
+{
+    JobCode = Code;
+    longjmp (JobEnd, 1);
+}
+
+
+
+static unsigned TakeFds (struct cmsghdr* H, int* Fds, unsigned Count)
+/* Get the descriptors passed in the control message H. If Fds is not NULL
+** and the message has exactly Count descriptors, store them there. All other
+** descriptors are closed. Return the number of descriptors stored.
+*/
+{
+    unsigned N = (H->cmsg_len - CMSG_LEN (0)) / sizeof (int);
+    unsigned I;
+    int      Fd;
+
+    for (I = 0; I < N; ++I) {
+        memcpy (&Fd, CMSG_DATA (H) + I * sizeof (int), sizeof (int));
+        if (Fds != 0 && N == Count) {
+            Fds[I] = Fd;
+        } else {
+            close (Fd);
+        }
+    }
+    return (Fds != 0 && N == Count)? Count : 0;
+}
+
+
+
+static int ReadRequest (int Conn, StrBuf* Req, int* Fds)
+/* Read a complete request from the connection. Store the passed standard
+** output and standard error descriptors in Fds. Return true if the request
+** is valid. On failure, no descriptors are left open.
+*/
+{
+    union {
+        struct cmsghdr  Align;
+        char            Space[CMSG_SPACE (2 * sizeof (int))];
+    } Ctrl;
+    char     Buf[1024];
+    unsigned FdCount = 0;
+
+    while (1) {
+
+        struct iovec    IOV;
+        struct msghdr   Msg;
+        struct cmsghdr* H;
+        ssize_t         Len;
+
+        IOV.iov_base = Buf;
+        IOV.iov_len  = sizeof (Buf);
+        memset (&Msg, 0, sizeof (Msg));
+        Msg.msg_iov        = &IOV;
+        Msg.msg_iovlen     = 1;
+        Msg.msg_control    = Ctrl.Space;
+        Msg.msg_controllen = sizeof (Ctrl.Space);
+
+        Len = recvmsg (Conn, &Msg, 0);
+        if (Len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        /* Take the descriptors from the first message that has them */
+        for (H = CMSG_FIRSTHDR (&Msg); H != 0; H = CMSG_NXTHDR (&Msg, H)) {
+            if (H->cmsg_level == SOL_SOCKET && H->cmsg_type == SCM_RIGHTS) {
+                if (FdCount == 0) {
+                    FdCount = TakeFds (H, Fds, 2);
+                } else {
+                    TakeFds (H, 0, 0);
+                }
+            }
+        }
+
+        if (Len == 0) {
+            /* End of the request */
+            if (FdCount == 2 && SB_GetLen (Req) > 0 &&
+                SB_LookAtLast (Req) == '\0') {
+                return 1;
+            }
+            break;
+        }
+        SB_AppendBuf (Req, Buf, Len);
+    }
+
+    /* Invalid request or read error */
+    if (FdCount == 2) {
+        close (Fds[0]);
+        close (Fds[1]);
+    }
+    return 0;
+}
+
+
+
+static const char* SetupArgs (const StrBuf* Req)
+/* Set ArgVec and ArgCount to the arguments of the job. Return the working
+** directory of the job.
+*/
+{
+    const char* P   = SB_GetConstBuf (Req);
+    const char* End = P + SB_GetLen (Req);
+    const char* Dir = P;
+
+    /* The first string is the working directory, the others are the
+    ** arguments of the job.
+    */
+    P += strlen (P) + 1;
+    ArgCount  = 1;
+    ArgVec    = xmalloc ((SB_GetLen (Req) + 1) * sizeof (ArgVec[0]));
+    ArgVec[0] = BinName;
+    while (P < End) {
+        ArgVec[ArgCount++] = (char*) P;
+        P += strlen (P) + 1;
+    }
+    ArgVec[ArgCount] = 0;
+
+    return Dir;
+}
+
+
+
+static void HandleJob (int Conn, int (*Job) (void))
+/* Read a job from the connection and run it */
+{
+    StrBuf          Req = STATIC_STRBUF_INITIALIZER;
+    const char*     Dir;
+    int             Fds[2];
+    int             SavedOut;
+    int             SavedErr;
+    unsigned char   Code;
+
+    /* Read the request, ignore it if it is invalid */
+    if (!ReadRequest (Conn, &Req, Fds)) {
+        SB_Done (&Req);
+        return;
+    }
+    Dir = SetupArgs (&Req);
+
+    /* The compiler output goes to the streams of the client */
+    fflush (stdout);
+    fflush (stderr);
+    SavedOut = dup (STDOUT_FILENO);
+    SavedErr = dup (STDERR_FILENO);
+    dup2 (Fds[0], STDOUT_FILENO);
+    dup2 (Fds[1], STDERR_FILENO);
+    close (Fds[0]);
+    close (Fds[1]);
+
+    /* Run the job. If it terminates the program, it ends up here. */
+    SetExitHook (JobExit);
+    if (setjmp (JobEnd) == 0) {
+        if (chdir (Dir) != 0) {
+            AbEnd ("Cannot change to directory '%s': %s", Dir, strerror (errno));
+        }
+        JobCode = Job ();
+    }
+    SetExitHook (0);
+
+    /* Give the server its own streams back */
+    fflush (stdout);
+    fflush (stderr);
+    clearerr (stdout);
+    clearerr (stderr);
+    dup2 (SavedOut, STDOUT_FILENO);
+    dup2 (SavedErr, STDERR_FILENO);
+    close (SavedOut);
+    close (SavedErr);
+
+    /* Send the exit code as the final byte */
+    Code = (unsigned char) JobCode;
+    if (write (Conn, &Code, 1) != 1) {
+        /* The client is gone, nothing we could do about it */
+    }
+
+    xfree (ArgVec);
+    ArgVec   = 0;
+    ArgCount = 0;
+    SB_Done (&Req);
+}
+
+
+
+void RunServer (const char* Name, int (*Job) (void))
+/* Run the compiler as a compile server listening on the local socket with
+** the given name. The server is resident: Each connection is a compile job
+** that calls Job with ArgVec and ArgCount set to the command line of the
+** job, and the standard output and error streams redirected to those of the
+** client. Jobs run one after the other. Job must reset any state left over
+** from the previous job. The function does not return.
+*/
+{
+    struct sockaddr_un  Addr;
+    struct stat         Buf;
+    int                 Listener;
+
+    /* Check the socket name */
+    if (strlen (Name) >= sizeof (Addr.sun_path)) {
+        AbEnd ("Socket name '%s' is too long", Name);
+    }
+    memset (&Addr, 0, sizeof (Addr));
+    Addr.sun_family = AF_UNIX;
+    strcpy (Addr.sun_path, Name);
+
+    /* The jobs change the working directory, so a relative path of the
+    ** binary (used to find the include directories) must be made absolute.
+    */
+    BinName = ArgVec[0];
+    if (strchr (BinName, '/') != 0) {
+        char* Path = realpath (BinName, 0);
+        if (Path != 0) {
+            BinName = Path;
+        }
+    }
+
+    /* A client that goes away must not terminate the server */
+    signal (SIGPIPE, SIG_IGN);
+
+    /* Remove a socket left over from a previous server, but nothing else */
+    if (stat (Name, &Buf) == 0 && S_ISSOCK (Buf.st_mode)) {
+        unlink (Name);
+    }
+
+    /* Create the socket and listen for jobs */
+    Listener = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (Listener < 0) {
+        AbEnd ("Cannot create socket: %s", strerror (errno));
+    }
+    if (bind (Listener, (struct sockaddr*) &Addr, sizeof (Addr)) != 0 ||
+        listen (Listener, 16) != 0) {
+        AbEnd ("Cannot listen on '%s': %s", Name, strerror (errno));
+    }
+
+    while (1) {
+        int Conn = accept (Listener, 0, 0);
+        if (Conn < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            AbEnd ("Cannot accept connection: %s", strerror (errno));
+        }
+        HandleJob (Conn, Job);
+        close (Conn);
+    }
+}
+
+
+
+#endif
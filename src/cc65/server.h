@@ -0,0 +1,58 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  server.h                                 */
+/*                                                                           */
+/*                Compile server mode for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#ifndef SERVER_H
+#define SERVER_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RunServer (const char* Name, int (*Job) (void));
+/* Run the compiler as a compile server listening on the local socket with
+** the given name. The server is resident: Each connection is a compile job
+** that calls Job with ArgVec and ArgCount set to the command line of the
+** job, and the standard output and error streams redirected to those of the
+** client. Jobs run one after the other. Job must reset any state left over
+** from the previous job. The function does not return.
+*/
+
+
+
+/* End of server.h */
+
+#endif
@@ -64,11 +64,15 @@
 
 
 
+static void StdFunc_memcmp (FuncDesc*, ExprDesc*);
 static void StdFunc_memcpy (FuncDesc*, ExprDesc*);
+static void StdFunc_memmove (FuncDesc*, ExprDesc*);
 static void StdFunc_memset (FuncDesc*, ExprDesc*);
+static void StdFunc_strchr (FuncDesc*, ExprDesc*);
 static void StdFunc_strcmp (FuncDesc*, ExprDesc*);
 static void StdFunc_strcpy (FuncDesc*, ExprDesc*);
 static void StdFunc_strlen (FuncDesc*, ExprDesc*);
+static void StdFunc_strncpy (FuncDesc*, ExprDesc*);
 
 
 
@@ -86,11 +90,15 @@ static struct StdFuncDesc {
     void                (*Handler) (FuncDesc*, ExprDesc*);
 } StdFuncs[] = {
 /* BEGIN SORTED.SH */
+    {   "memcmp",       StdFunc_memcmp          },
     {   "memcpy",       StdFunc_memcpy          },
+    {   "memmove",      StdFunc_memmove         },
     {   "memset",       StdFunc_memset          },
+    {   "strchr",       StdFunc_strchr          },
     {   "strcmp",       StdFunc_strcmp          },
     {   "strcpy",       StdFunc_strcpy          },
     {   "strlen",       StdFunc_strlen          },
+    {   "strncpy",      StdFunc_strncpy         },
 /* END SORTED.SH */
 };
 #define FUNC_COUNT      (sizeof (StdFuncs) / sizeof (StdFuncs[0]))
@@ -106,6 +114,9 @@ struct ArgDesc {
     unsigned    Flags;          /* Code generation flags */
 };
 
+/* Returned by CopyDirection if the direction of a copy cannot be determined */
+#define COPY_UNKNOWN    2
+
 
 
 /*****************************************************************************/
@@ -207,6 +218,263 @@ void AddCmpCodeIfSizeNot256 (const char* Code, long Size)
 
 
 
+static int UnrollCopy (long Size)
+/* Return true if a copy of Size bytes between two constant addresses should
+** be unrolled. An unrolled copy needs about six bytes of code per byte, while
+** the loop needs about eleven bytes in total, so weigh this against the code
+** size factor.
+*/
+{
+    return Size * 600 <= 11L * IS_Get (&CodeSizeFactor);
+}
+
+
+
+static long CopyOffs (const ExprDesc* Expr)
+/* Return the offset of a constant address relative to its base location */
+{
+    if (ED_IsLocRegister (Expr) || ED_IsLocZPArg (Expr)) {
+        /* Both blocks use Name as the offset of the variable */
+        return Expr->IVal + (long) Expr->Name;
+    }
+    return Expr->IVal;
+}
+
+
+
+static int CopyDirection (const ExprDesc* Dest, const ExprDesc* Src)
+/* Check how memory may be copied from the constant address Src to the
+** constant address Dest if the areas may overlap. Return a positive value if
+** the bytes must be copied upwards, a negative value if they must be copied
+** downwards, zero if the direction doesn't matter and COPY_UNKNOWN if we
+** cannot tell.
+*/
+{
+    unsigned DestLoc = ED_GetLoc (Dest);
+    unsigned SrcLoc  = ED_GetLoc (Src);
+    int      Same;
+
+    /* Absolute addresses may alias anything */
+    if (DestLoc == E_LOC_ABS || DestLoc == E_LOC_NONE) {
+        DestLoc = E_LOC_ABS;
+    }
+    if (SrcLoc == E_LOC_ABS || SrcLoc == E_LOC_NONE) {
+        SrcLoc = E_LOC_ABS;
+    }
+    if (DestLoc != SrcLoc) {
+        return (DestLoc == E_LOC_ABS || SrcLoc == E_LOC_ABS)? COPY_UNKNOWN : 0;
+    }
+
+    /* Both are in the same kind of location. Check if it's the same object */
+    switch (DestLoc) {
+        case E_LOC_GLOBAL:
+        case E_LOC_STATIC:
+            Same = (Dest->Sym == Src->Sym);
+            break;
+        case E_LOC_LITERAL:
+        case E_LOC_CODE:
+            Same = (Dest->Name == Src->Name);
+            break;
+        default:
+            /* Absolute, register bank and zp argument block */
+            Same = 1;
+            break;
+    }
+    if (!Same) {
+        return 0;
+    }
+
+    /* Copy upwards if the destination is below the source */
+    if (CopyOffs (Dest) < CopyOffs (Src)) {
+        return 1;
+    } else if (CopyOffs (Dest) > CopyOffs (Src)) {
+        return -1;
+    } else {
+        return 0;
+    }
+}
+
+
+
+void AddCopyCode (const ExprDesc* Dest, const ExprDesc* Src, long Size, int Dir)
+/* Add inline code that copies Size (1-256) bytes from Src to Dest. Both must
+** be constant addresses or pointers in the zero page. Dir is positive if the
+** bytes must be copied upwards, negative if they must be copied downwards,
+** and zero if the direction doesn't matter.
+*/
+{
+    const char* Load;
+    const char* Store;
+    unsigned    Label;
+
+    PRECONDITION (Size > 0 && Size <= 256);
+
+    /* Tiny copies between constant addresses are unrolled */
+    if (!ED_IsZPInd (Src) && !ED_IsZPInd (Dest) && UnrollCopy (Size)) {
+        long I;
+        for (I = 0; I < Size; ++I) {
+            long Offs = (Dir < 0)? Size - 1 - I : I;
+            AddCodeLine ("lda %s", ED_GetLabelName (Src, Offs));
+            AddCodeLine ("sta %s", ED_GetLabelName (Dest, Offs));
+        }
+        return;
+    }
+
+    if (ED_IsZPInd (Src)) {
+        Load = "lda (%s),y";
+    } else {
+        Load = "lda %s,y";
+    }
+    if (ED_IsZPInd (Dest)) {
+        Store = "sta (%s),y";
+    } else {
+        Store = "sta %s,y";
+    }
+
+    /* We need a label */
+    Label = GetLocalLabel ();
+
+    if (Dir <= 0 && Size <= 129) {
+        AddCodeLine ("ldy #$%02X", (unsigned char) (Size - 1));
+        g_defcodelabel (Label);
+        AddCodeLine (Load, ED_GetLabelName (Src, 0));
+        AddCodeLine (Store, ED_GetLabelName (Dest, 0));
+        AddCodeLine ("dey");
+        AddCodeLine ("bpl %s", LocalLabelName (Label));
+    } else if (Dir < 0) {
+        AddCodeLine ("ldy #$%02X", (unsigned char) Size);
+        g_defcodelabel (Label);
+        AddCodeLine ("dey");
+        AddCodeLine (Load, ED_GetLabelName (Src, 0));
+        AddCodeLine (Store, ED_GetLabelName (Dest, 0));
+        AddCodeLine ("tya");
+        AddCodeLine ("bne %s", LocalLabelName (Label));
+    } else {
+        AddCodeLine ("ldy #$00");
+        g_defcodelabel (Label);
+        AddCodeLine (Load, ED_GetLabelName (Src, 0));
+        AddCodeLine (Store, ED_GetLabelName (Dest, 0));
+        AddCodeLine ("iny");
+        AddCmpCodeIfSizeNot256 ("cpy #$%02X", Size);
+        AddCodeLine ("bne %s", LocalLabelName (Label));
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                  memcmp                                   */
+/*****************************************************************************/
+
+
+
+static void StdFunc_memcmp (FuncDesc* F attribute ((unused)), ExprDesc* Expr)
+/* Handle the memcmp function */
+{
+    /* Argument types: (const void*, const void*, size_t) */
+    static const Type* Arg1Type = type_c_void_p;
+    static const Type* Arg2Type = type_c_void_p;
+    static const Type* Arg3Type = type_size_t;
+
+    ArgDesc  Arg1, Arg2, Arg3;
+    unsigned ParamSize = 0;
+
+    /* Argument #1 */
+    ParseArg (&Arg1, Arg1Type, Expr);
+    g_push (Arg1.Flags, Arg1.Expr.IVal);
+    GetCodePos (&Arg1.End);
+    ParamSize += SizeOf (Arg1Type);
+    ConsumeComma ();
+
+    /* Argument #2 */
+    ParseArg (&Arg2, Arg2Type, Expr);
+    g_push (Arg2.Flags, Arg2.Expr.IVal);
+    GetCodePos (&Arg2.End);
+    ParamSize += SizeOf (Arg2Type);
+    ConsumeComma ();
+
+    /* Argument #3. Since memcmp is a fastcall function, we must load the
+    ** arg into the primary if it is not already there. This parameter is
+    ** also ignored for the calculation of the parameter size, since it is
+    ** not passed via the stack.
+    */
+    ParseArg (&Arg3, Arg3Type, Expr);
+    if (Arg3.Flags & CF_CONST) {
+        LoadExpr (CF_NONE, &Arg3.Expr);
+    }
+
+    /* We still need to append deferred inc/dec before calling into the function */
+    DoDeferred (SQP_KEEP_EAX, &Arg3.Expr);
+
+    /* Emit the actual function call. This will also cleanup the stack. */
+    g_call (CF_FIXARGC, Func_memcmp, ParamSize);
+
+    if (IS_Get (&InlineStdFuncs)) {
+
+        /* If the count is a constant that can be handled with an index
+        ** register, and both areas are at constant addresses or pointed to
+        ** by zero page pointers, we can compare inline.
+        */
+        if ((Arg3.Flags & CF_CONST) != 0 &&
+            Arg3.Expr.IVal > 0 && Arg3.Expr.IVal <= 256 &&
+            (ED_IsConstAddr (&Arg1.Expr) || ED_IsZPInd (&Arg1.Expr)) &&
+            (ED_IsConstAddr (&Arg2.Expr) || ED_IsZPInd (&Arg2.Expr))) {
+
+            unsigned    Loop, Diff, Fin;    /* Labels */
+            const char* Load;
+            const char* Compare;
+
+            if (ED_IsZPInd (&Arg1.Expr)) {
+                Load = "lda (%s),y";
+            } else {
+                Load = "lda %s,y";
+            }
+            if (ED_IsZPInd (&Arg2.Expr)) {
+                Compare = "cmp (%s),y";
+            } else {
+                Compare = "cmp %s,y";
+            }
+
+            /* Drop the generated code */
+            RemoveCode (&Arg1.Expr.Start);
+
+            /* We need labels */
+            Loop = GetLocalLabel ();
+            Diff = GetLocalLabel ();
+            Fin  = GetLocalLabel ();
+
+            /* Generate memcmp code. Only the sign of the result is defined,
+            ** so it is enough to return $01xx or $FFxx if the areas differ.
+            */
+            AddCodeLine ("ldy #$00");
+            g_defcodelabel (Loop);
+            AddCodeLine (Load, ED_GetLabelName (&Arg1.Expr, 0));
+            AddCodeLine (Compare, ED_GetLabelName (&Arg2.Expr, 0));
+            AddCodeLine ("bne %s", LocalLabelName (Diff));
+            AddCodeLine ("iny");
+            AddCmpCodeIfSizeNot256 ("cpy #$%02X", Arg3.Expr.IVal);
+            AddCodeLine ("bne %s", LocalLabelName (Loop));
+            AddCodeLine ("ldx #$00");
+            AddCodeLine ("txa");
+            AddCodeLine ("beq %s", LocalLabelName (Fin));
+            g_defcodelabel (Diff);
+            AddCodeLine ("ldx #$01");
+            AddCodeLine ("bcs %s", LocalLabelName (Fin));
+            AddCodeLine ("ldx #$FF");
+            g_defcodelabel (Fin);
+        }
+    }
+
+    /* The function result is an rvalue in the primary register */
+    ED_FinalizeRValLoad (Expr);
+    Expr->Type = GetFuncReturnType (Expr->Type);
+
+    /* We expect the closing brace */
+    ConsumeRParen ();
+}
+
+
+
 /*****************************************************************************/
 /*                                  memcpy                                   */
 /*****************************************************************************/
@@ -284,52 +552,11 @@ static void StdFunc_memcpy (FuncDesc* F attribute ((unused)), ExprDesc* Expr)
             (ED_IsConstAddr (&Arg2.Expr) || ED_IsZPInd (&Arg2.Expr)) &&
             (ED_IsConstAddr (&Arg1.Expr) || ED_IsZPInd (&Arg1.Expr))) {
 
-            int Reg1 = ED_IsZPInd (&Arg1.Expr);
-            int Reg2 = ED_IsZPInd (&Arg2.Expr);
-
             /* Drop the generated code */
             RemoveCode (&Arg1.Expr.Start);
 
-            /* We need a label */
-            Label = GetLocalLabel ();
-
             /* Generate memcpy code */
-            if (Arg3.Expr.IVal <= 129) {
-
-                AddCodeLine ("ldy #$%02X", (unsigned char) (Arg3.Expr.IVal-1));
-                g_defcodelabel (Label);
-                if (Reg2) {
-                    AddCodeLine ("lda (%s),y", ED_GetLabelName (&Arg2.Expr, 0));
-                } else {
-                    AddCodeLine ("lda %s,y", ED_GetLabelName (&Arg2.Expr, 0));
-                }
-                if (Reg1) {
-                    AddCodeLine ("sta (%s),y", ED_GetLabelName (&Arg1.Expr, 0));
-                } else {
-                    AddCodeLine ("sta %s,y", ED_GetLabelName (&Arg1.Expr, 0));
-                }
-                AddCodeLine ("dey");
-                AddCodeLine ("bpl %s", LocalLabelName (Label));
-
-            } else {
-
-                AddCodeLine ("ldy #$00");
-                g_defcodelabel (Label);
-                if (Reg2) {
-                    AddCodeLine ("lda (%s),y", ED_GetLabelName (&Arg2.Expr, 0));
-                } else {
-                    AddCodeLine ("lda %s,y", ED_GetLabelName (&Arg2.Expr, 0));
-                }
-                if (Reg1) {
-                    AddCodeLine ("sta (%s),y", ED_GetLabelName (&Arg1.Expr, 0));
-                } else {
-                    AddCodeLine ("sta %s,y", ED_GetLabelName (&Arg1.Expr, 0));
-                }
-                AddCodeLine ("iny");
-                AddCmpCodeIfSizeNot256 ("cpy #$%02X", Arg3.Expr.IVal);
-                AddCodeLine ("bne %s", LocalLabelName (Label));
-
-            }
+            AddCopyCode (&Arg1.Expr, &Arg2.Expr, Arg3.Expr.IVal, 0);
 
             /* memcpy returns the address, so the result is actually identical
             ** to the first argument.
@@ -549,6 +776,93 @@ ExitPoint:
 
 
 
+/*****************************************************************************/
+/*                                  memmove                                  */
+/*****************************************************************************/
+
+
+
+static void StdFunc_memmove (FuncDesc* F attribute ((unused)), ExprDesc* Expr)
+/* Handle the memmove function */
+{
+    /* Argument types: (void*, const void*, size_t) */
+    static const Type* Arg1Type = type_void_p;
+    static const Type* Arg2Type = type_c_void_p;
+    static const Type* Arg3Type = type_size_t;
+
+    ArgDesc  Arg1, Arg2, Arg3;
+    unsigned ParamSize = 0;
+    int      Dir;
+
+    /* Argument #1 */
+    ParseArg (&Arg1, Arg1Type, Expr);
+    g_push (Arg1.Flags, Arg1.Expr.IVal);
+    GetCodePos (&Arg1.End);
+    ParamSize += SizeOf (Arg1Type);
+    ConsumeComma ();
+
+    /* Argument #2 */
+    ParseArg (&Arg2, Arg2Type, Expr);
+    g_push (Arg2.Flags, Arg2.Expr.IVal);
+    GetCodePos (&Arg2.End);
+    ParamSize += SizeOf (Arg2Type);
+    ConsumeComma ();
+
+    /* Argument #3. Since memmove is a fastcall function, we must load the
+    ** arg into the primary if it is not already there. This parameter is
+    ** also ignored for the calculation of the parameter size, since it is
+    ** not passed via the stack.
+    */
+    ParseArg (&Arg3, Arg3Type, Expr);
+    if (Arg3.Flags & CF_CONST) {
+        LoadExpr (CF_NONE, &Arg3.Expr);
+    }
+
+    /* We still need to append deferred inc/dec before calling into the function */
+    DoDeferred (SQP_KEEP_EAX, &Arg3.Expr);
+
+    /* Emit the actual function call. This will also cleanup the stack. */
+    g_call (CF_FIXARGC, Func_memmove, ParamSize);
+
+    if (IS_Get (&InlineStdFuncs)) {
+
+        /* memmove is inlined like memcpy, but only if both areas are at
+        ** constant addresses, so we can tell in which direction the bytes
+        ** must be copied if they overlap.
+        */
+        if ((Arg3.Flags & CF_CONST) != 0 &&
+            Arg3.Expr.IVal > 0 && Arg3.Expr.IVal <= 256 &&
+            ED_IsConstAddr (&Arg1.Expr) &&
+            ED_IsConstAddr (&Arg2.Expr) &&
+            (Dir = CopyDirection (&Arg1.Expr, &Arg2.Expr)) != COPY_UNKNOWN) {
+
+            /* Drop the generated code */
+            RemoveCode (&Arg1.Expr.Start);
+
+            /* Generate the copy code */
+            AddCopyCode (&Arg1.Expr, &Arg2.Expr, Arg3.Expr.IVal, Dir);
+
+            /* memmove returns the address, so the result is actually
+            ** identical to the first argument.
+            */
+            *Expr = Arg1.Expr;
+
+            /* Bail out, no need for further processing */
+            goto ExitPoint;
+        }
+    }
+
+    /* The function result is an rvalue in the primary register */
+    ED_FinalizeRValLoad (Expr);
+    Expr->Type = GetFuncReturnType (Expr->Type);
+
+ExitPoint:
+    /* We expect the closing brace */
+    ConsumeRParen ();
+}
+
+
+
 /*****************************************************************************/
 /*                                  memset                                   */
 /*****************************************************************************/
@@ -774,6 +1088,124 @@ ExitPoint:
 
 
 
+/*****************************************************************************/
+/*                                  strchr                                   */
+/*****************************************************************************/
+
+
+
+static void StdFunc_strchr (FuncDesc* F attribute ((unused)), ExprDesc* Expr)
+/* Handle the strchr function */
+{
+    /* Argument types: (const char*, int) */
+    static const Type* Arg1Type = type_c_char_p;
+    static const Type* Arg2Type = type_int;
+
+    ArgDesc  Arg1, Arg2;
+    unsigned ParamSize = 0;
+    long     ECount;
+
+    /* Argument #1 */
+    ParseArg (&Arg1, Arg1Type, Expr);
+    g_push (Arg1.Flags, Arg1.Expr.IVal);
+    GetCodePos (&Arg1.End);
+    ParamSize += SizeOf (Arg1Type);
+    ConsumeComma ();
+
+    /* Argument #2. Since strchr is a fastcall function, we must load the
+    ** arg into the primary if it is not already there. This parameter is
+    ** also ignored for the calculation of the parameter size, since it is
+    ** not passed via the stack.
+    */
+    ParseArg (&Arg2, Arg2Type, Expr);
+    if (Arg2.Flags & CF_CONST) {
+        LoadExpr (CF_NONE, &Arg2.Expr);
+    }
+
+    /* We still need to append deferred inc/dec before calling into the function */
+    DoDeferred (SQP_KEEP_EAX, &Arg2.Expr);
+
+    /* Emit the actual function call. This will also cleanup the stack. */
+    g_call (CF_FIXARGC, Func_strchr, ParamSize);
+
+    /* Get the element count of argument 1 if it is an array */
+    ECount = ArrayElementCount (&Arg1);
+
+    if (IS_Get (&InlineStdFuncs)) {
+
+        /* If the character is a constant and the string is at a constant
+        ** address or pointed to by a zero page pointer, we can search inline.
+        ** As with strcpy, this is only safe if the string is known to fit
+        ** into the reach of an index register.
+        */
+        if ((Arg2.Flags & CF_CONST) != 0 &&
+            (ED_IsConstAddr (&Arg1.Expr) || ED_IsZPInd (&Arg1.Expr)) &&
+            (IS_Get (&EagerlyInlineFuncs) ||
+            (ECount != UNSPECIFIED && ECount < 256))) {
+
+            unsigned      Loop, Found, Fin;     /* Labels */
+            unsigned char C = (unsigned char) Arg2.Expr.IVal;
+            int           Reg = ED_IsZPInd (&Arg1.Expr);
+
+            /* Drop the generated code */
+            RemoveCode (&Arg1.Expr.Start);
+
+            /* We need labels */
+            Loop  = GetLocalLabel ();
+            Found = GetLocalLabel ();
+            Fin   = GetLocalLabel ();
+
+            /* Generate strchr code */
+            AddCodeLine ("ldy #$FF");
+            g_defcodelabel (Loop);
+            AddCodeLine ("iny");
+            if (Reg) {
+                AddCodeLine ("lda (%s),y", ED_GetLabelName (&Arg1.Expr, 0));
+            } else {
+                AddCodeLine ("lda %s,y", ED_GetLabelName (&Arg1.Expr, 0));
+            }
+            if (C == 0) {
+                /* Searching for the terminator always succeeds */
+                AddCodeLine ("bne %s", LocalLabelName (Loop));
+            } else {
+                AddCodeLine ("cmp #$%02X", C);
+                AddCodeLine ("beq %s", LocalLabelName (Found));
+                AddCodeLine ("tax");
+                AddCodeLine ("bne %s", LocalLabelName (Loop));
+
+                /* Not found, A and X are both zero */
+                AddCodeLine ("beq %s", LocalLabelName (Fin));
+                g_defcodelabel (Found);
+            }
+
+            /* Return the address of the character */
+            if (Reg) {
+                AddCodeLine ("ldx %s", ED_GetLabelName (&Arg1.Expr, 1));
+                AddCodeLine ("tya");
+                AddCodeLine ("clc");
+                AddCodeLine ("adc %s", ED_GetLabelName (&Arg1.Expr, 0));
+            } else {
+                AddCodeLine ("ldx #>(%s)", ED_GetLabelName (&Arg1.Expr, 0));
+                AddCodeLine ("tya");
+                AddCodeLine ("clc");
+                AddCodeLine ("adc #<(%s)", ED_GetLabelName (&Arg1.Expr, 0));
+            }
+            AddCodeLine ("bcc %s", LocalLabelName (Fin));
+            AddCodeLine ("inx");
+            g_defcodelabel (Fin);
+        }
+    }
+
+    /* The function result is an rvalue in the primary register */
+    ED_FinalizeRValLoad (Expr);
+    Expr->Type = GetFuncReturnType (Expr->Type);
+
+    /* We expect the closing brace */
+    ConsumeRParen ();
+}
+
+
+
 /*****************************************************************************/
 /*                                  strcmp                                   */
 /*****************************************************************************/
@@ -1373,6 +1805,124 @@ ExitPoint:
 
 
 
+/*****************************************************************************/
+/*                                  strncpy                                  */
+/*****************************************************************************/
+
+
+
+static void StdFunc_strncpy (FuncDesc* F attribute ((unused)), ExprDesc* Expr)
+/* Handle the strncpy function */
+{
+    /* Argument types: (char*, const char*, size_t) */
+    static const Type* Arg1Type = type_char_p;
+    static const Type* Arg2Type = type_c_char_p;
+    static const Type* Arg3Type = type_size_t;
+
+    ArgDesc  Arg1, Arg2, Arg3;
+    unsigned ParamSize = 0;
+
+    /* Argument #1 */
+    ParseArg (&Arg1, Arg1Type, Expr);
+    g_push (Arg1.Flags, Arg1.Expr.IVal);
+    GetCodePos (&Arg1.End);
+    ParamSize += SizeOf (Arg1Type);
+    ConsumeComma ();
+
+    /* Argument #2 */
+    ParseArg (&Arg2, Arg2Type, Expr);
+    g_push (Arg2.Flags, Arg2.Expr.IVal);
+    GetCodePos (&Arg2.End);
+    ParamSize += SizeOf (Arg2Type);
+    ConsumeComma ();
+
+    /* Argument #3. Since strncpy is a fastcall function, we must load the
+    ** arg into the primary if it is not already there. This parameter is
+    ** also ignored for the calculation of the parameter size, since it is
+    ** not passed via the stack.
+    */
+    ParseArg (&Arg3, Arg3Type, Expr);
+    if (Arg3.Flags & CF_CONST) {
+        LoadExpr (CF_NONE, &Arg3.Expr);
+    }
+
+    /* We still need to append deferred inc/dec before calling into the function */
+    DoDeferred (SQP_KEEP_EAX, &Arg3.Expr);
+
+    /* Emit the actual function call. This will also cleanup the stack. */
+    g_call (CF_FIXARGC, Func_strncpy, ParamSize);
+
+    if (IS_Get (&InlineStdFuncs)) {
+
+        /* The count limits the loop, so it is always safe to inline if it is
+        ** a constant that can be handled with an index register.
+        */
+        if ((Arg3.Flags & CF_CONST) != 0 &&
+            Arg3.Expr.IVal > 0 && Arg3.Expr.IVal <= 256 &&
+            (ED_IsConstAddr (&Arg1.Expr) || ED_IsZPInd (&Arg1.Expr)) &&
+            (ED_IsConstAddr (&Arg2.Expr) || ED_IsZPInd (&Arg2.Expr))) {
+
+            unsigned    Loop, Pad, Fin;     /* Labels */
+            const char* Load;
+            const char* Store;
+
+            if (ED_IsZPInd (&Arg2.Expr)) {
+                Load = "lda (%s),y";
+            } else {
+                Load = "lda %s,y";
+            }
+            if (ED_IsZPInd (&Arg1.Expr)) {
+                Store = "sta (%s),y";
+            } else {
+                Store = "sta %s,y";
+            }
+
+            /* Drop the generated code */
+            RemoveCode (&Arg1.Expr.Start);
+
+            /* We need labels */
+            Loop = GetLocalLabel ();
+            Pad  = GetLocalLabel ();
+            Fin  = GetLocalLabel ();
+
+            /* Generate strncpy code. Copy up to the terminator, then fill
+            ** the rest of the target with zeroes.
+            */
+            AddCodeLine ("ldy #$00");
+            g_defcodelabel (Loop);
+            AddCodeLine (Load, ED_GetLabelName (&Arg2.Expr, 0));
+            AddCodeLine ("beq %s", LocalLabelName (Pad));
+            AddCodeLine (Store, ED_GetLabelName (&Arg1.Expr, 0));
+            AddCodeLine ("iny");
+            AddCmpCodeIfSizeNot256 ("cpy #$%02X", Arg3.Expr.IVal);
+            AddCodeLine ("bne %s", LocalLabelName (Loop));
+            AddCodeLine ("beq %s", LocalLabelName (Fin));
+            g_defcodelabel (Pad);
+            AddCodeLine (Store, ED_GetLabelName (&Arg1.Expr, 0));
+            AddCodeLine ("iny");
+            AddCmpCodeIfSizeNot256 ("cpy #$%02X", Arg3.Expr.IVal);
+            AddCodeLine ("bne %s", LocalLabelName (Pad));
+            g_defcodelabel (Fin);
+
+            /* strncpy returns argument #1 */
+            *Expr = Arg1.Expr;
+
+            /* Bail out, no need for further processing */
+            goto ExitPoint;
+        }
+    }
+
+    /* The function result is an rvalue in the primary register */
+    ED_FinalizeRValLoad (Expr);
+    Expr->Type = GetFuncReturnType (Expr->Type);
+
+ExitPoint:
+    /* We expect the closing brace */
+    ConsumeRParen ();
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
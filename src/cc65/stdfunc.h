@@ -56,6 +56,13 @@ void AddCmpCodeIfSizeNot256 (const char* Code, long Size);
 ** is "bne", then this will avoid a redundant line.)
 */
 
+void AddCopyCode (const ExprDesc* Dest, const ExprDesc* Src, long Size, int Dir);
+/* Add inline code that copies Size (1-256) bytes from Src to Dest. Both must
+** be constant addresses or pointers in the zero page. Dir is positive if the
+** bytes must be copied upwards, negative if they must be copied downwards,
+** and zero if the direction doesn't matter.
+*/
+
 int FindStdFunc (const char* Name);
 /* Determine if the given function is a known standard function that may be
 ** called in a special way. If so, return the index, otherwise return -1.
@@ -45,8 +45,12 @@
 
 
 const char Func___bzero[]       = "__bzero";    /* C name of "__bzero" */
+const char Func_memcmp[]        = "memcmp";     /* C name of "memcmp" */
 const char Func_memcpy[]        = "memcpy";     /* C name of "memcpy" */
+const char Func_memmove[]       = "memmove";    /* C name of "memmove" */
 const char Func_memset[]        = "memset";     /* C name of "memset" */
+const char Func_strchr[]        = "strchr";     /* C name of "strchr" */
 const char Func_strcmp[]        = "strcmp";     /* C name of "strcmp" */
 const char Func_strcpy[]        = "strcpy";     /* C name of "strcpy" */
 const char Func_strlen[]        = "strlen";     /* C name of "strlen" */
+const char Func_strncpy[]       = "strncpy";    /* C name of "strncpy" */
@@ -503,3 +503,13 @@ void SwitchBodyStatement (struct SwitchCtrl* S, LineInfo* LI, int StmtFlags)
     /* Collect the statement flags. */
     S->StmtFlags = SF_Any (S->StmtFlags | StmtFlags);
 }
+
+
+
+void ResetSwitch (void)
+/* Forget the current switch statement, so another translation unit can be
+** compiled.
+*/
+{
+    Switch = 0;
+}
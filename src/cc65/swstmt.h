@@ -69,6 +69,11 @@ void SwitchBodyStatement (struct SwitchCtrl* Switch, LineInfo* LI, int RetFlags)
 ** a switch passing the flags for special statements.
 */
 
+void ResetSwitch (void);
+/* Forget the current switch statement, so another translation unit can be
+** compiled.
+*/
+
 
 
 /* End of swstmt.h */
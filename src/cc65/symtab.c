@@ -41,6 +41,7 @@
 
 /* common */
 #include "check.h"
+#include "coll.h"
 #include "debugflag.h"
 #include "hashfunc.h"
 #include "xmalloc.h"
@@ -99,6 +100,9 @@ static SymTable*        LabelTab        = 0;
 static SymTable*        SPAdjustTab     = 0;
 static SymTable*        FailSafeTab     = 0;    /* For errors */
 
+/* All symbol tables of the translation unit, so they can be freed */
+static Collection       SymTables       = STATIC_COLLECTION_INITIALIZER;
+
 static FILE* DebugTableFile = 0;
 
 /*****************************************************************************/
@@ -107,7 +111,7 @@ static FILE* DebugTableFile = 0;
 
 
 
-static SymTable* NewSymTable (unsigned Size)
+SymTable* NewSymTable (unsigned Size)
 /* Create and return a symbol table for the given lexical level */
 {
     unsigned I;
@@ -125,6 +129,9 @@ static SymTable* NewSymTable (unsigned Size)
         S->Tab[I] = 0;
     }
 
+    /* Remember the table */
+    CollAppend (&SymTables, S);
+
     /* Return the symbol table */
     return S;
 }
@@ -134,6 +141,8 @@ static SymTable* NewSymTable (unsigned Size)
 static void FreeSymTable (SymTable* S)
 /* Free the given symbo table including all symbols */
 {
+    unsigned I;
+
     /* Free all symbols */
     SymEntry* Sym = S->SymHead;
     while (Sym) {
@@ -142,6 +151,15 @@ static void FreeSymTable (SymTable* S)
         Sym = NextSym;
     }
 
+    /* Forget the table. It is usually one of the last ones created. */
+    I = CollCount (&SymTables);
+    while (I-- > 0) {
+        if (CollAtUnchecked (&SymTables, I) == S) {
+            CollDelete (&SymTables, I);
+            break;
+        }
+    }
+
     /* Free the table itself */
     xfree (S);
 }
@@ -341,6 +359,7 @@ void LeaveGlobalLevel (void)
         if (DebugTableFile != stdout && fclose (DebugTableFile) != 0) {
             Error ("Error closing table dump file '%s': %s", SB_GetConstBuf(&DebugTableName), strerror (errno));
         }
+        DebugTableFile = 0;
     }
 
     /* Don't delete the symbol and struct tables! */
@@ -353,6 +372,35 @@ void LeaveGlobalLevel (void)
 
 
 
+void ResetSymTab (void)
+/* Leave all lexical levels and free the symbol tables of the last
+** translation unit, so another one can be compiled.
+*/
+{
+    while (CurrentLex != 0) {
+        PopLexicalLevel ();
+    }
+    while (CollCount (&SymTables) > 0) {
+        FreeSymTable (CollLast (&SymTables));
+    }
+    SymTab0     = 0;
+    SymTab      = 0;
+    TagTab0     = 0;
+    TagTab      = 0;
+    FieldTab    = 0;
+    LabelTab    = 0;
+    SPAdjustTab = 0;
+    FailSafeTab = 0;
+
+    /* Close the table dump file if the compiler stopped before doing so */
+    if (DebugTableFile != 0 && DebugTableFile != stdout) {
+        fclose (DebugTableFile);
+    }
+    DebugTableFile = 0;
+}
+
+
+
 void EnterFunctionLevel (void)
 /* Enter function lexical level */
 {
@@ -807,7 +855,7 @@ static int HandleSymRedefinition (SymEntry* Sym, const Type* T, unsigned Flags)
 
 
 
-static void AddSymEntry (SymTable* T, SymEntry* S)
+void AddSymEntry (SymTable* T, SymEntry* S)
 /* Add a symbol to a symbol table */
 {
     /* Get the hash value for the name */
@@ -1510,6 +1558,14 @@ SymTable* GetGlobalSymTab (void)
 
 
 
+SymTable* GetGlobalTagTab (void)
+/* Return the global tag table */
+{
+    return TagTab0;
+}
+
+
+
 SymTable* GetFieldSymTab (void)
 /* Return the current field symbol table */
 {
@@ -1638,7 +1694,11 @@ void EmitDebugInfo (void)
         Sym = SymTab->SymHead;
         while (Sym) {
             if ((Sym->Flags & SC_TYPEMASK) == 0) {
-                if ((Sym->Flags & SC_STORAGEMASK) == SC_AUTO) {
+                if ((Sym->Flags & (SC_STORAGEMASK | SC_PARAM)) == (SC_AUTO | SC_PARAM) &&
+                    F_IsZPParam (CurrentFunc, Sym)) {
+                    AddTextLine ("%s, \"%s\", \"00\", register, \"zpargs\", %d",
+                                 Head, Sym->Name, Sym->V.Offs);
+                } else if ((Sym->Flags & SC_STORAGEMASK) == SC_AUTO) {
                     AddTextLine ("%s, \"%s\", \"00\", auto, %d",
                                  Head, Sym->Name, Sym->V.Offs);
                 } else if ((Sym->Flags & SC_STORAGEMASK) == SC_REGISTER) {
@@ -85,6 +85,17 @@ struct FuncDesc;
 
 
 
+/*****************************************************************************/
+/*                              struct SymTable                              */
+/*****************************************************************************/
+
+
+
+SymTable* NewSymTable (unsigned Size);
+/* Create and return a symbol table for the given lexical level */
+
+
+
 /*****************************************************************************/
 /*                        Handling of lexical levels                         */
 /*****************************************************************************/
@@ -109,6 +120,11 @@ void EnterGlobalLevel (void);
 void LeaveGlobalLevel (void);
 /* Leave the program global lexical level */
 
+void ResetSymTab (void);
+/* Leave all lexical levels and free the symbol tables of the last
+** translation unit, so another one can be compiled.
+*/
+
 void EnterFunctionLevel (void);
 /* Enter function lexical level */
 
@@ -169,6 +185,9 @@ unsigned short FindSPAdjustment (const char* Name);
 
 
 
+void AddSymEntry (SymTable* T, SymEntry* S);
+/* Add a symbol to a symbol table */
+
 SymEntry* AddEnumSym (const char* Name, unsigned Flags, const Type* Type, SymTable* Tab, unsigned* DSFlags);
 /* Add an enum tag entry and return it */
 
@@ -205,6 +224,9 @@ SymTable* GetSymTab (void);
 SymTable* GetGlobalSymTab (void);
 /* Return the global symbol table */
 
+SymTable* GetGlobalTagTab (void);
+/* Return the global tag table */
+
 SymTable* GetFieldSymTab (void);
 /* Return the current field symbol table */
 
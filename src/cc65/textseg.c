@@ -71,6 +71,19 @@ TextSeg* NewTextSeg (SymEntry* Func)
 
 
 
+void FreeTextSeg (TextSeg* S)
+/* Free a text segment including its lines */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&S->Lines); ++I) {
+        xfree (CollAtUnchecked (&S->Lines, I));
+    }
+    DoneCollection (&S->Lines);
+    xfree (S);
+}
+
+
+
 void TS_AddVLine (TextSeg* S, const char* Format, va_list ap)
 /* Add a line to the given text segment */
 {
@@ -78,6 +78,9 @@ struct TextSeg {
 TextSeg* NewTextSeg (SymEntry* Func);
 /* Create a new text segment, initialize and return it */
 
+void FreeTextSeg (TextSeg* S);
+/* Free a text segment including its lines */
+
 void TS_AddVLine (TextSeg* S, const char* Format, va_list ap) attribute ((format(printf,2,0)));
 /* Add a line to the given text segment */
 
@@ -100,3 +100,13 @@ void GetWrappedCall (void **Ptr, unsigned int *Val)
         *Val = (unsigned int) Temp;
     }
 }
+
+
+
+void ResetWrappedCalls (void)
+/* Remove all wrapped calls, so another translation unit can be compiled */
+{
+    while (!IPS_IsEmpty (&WrappedCalls)) {
+        IPS_Drop (&WrappedCalls);
+    }
+}
@@ -59,6 +59,9 @@ void PopWrappedCall (void);
 void GetWrappedCall (void **Ptr, unsigned int *Val);
 /* Get the current WrappedCall, if any */
 
+void ResetWrappedCalls (void);
+/* Remove all wrapped calls, so another translation unit can be compiled */
+
 
 /* End of wrappedcall.h */
 
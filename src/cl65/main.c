@@ -120,6 +120,9 @@ static CmdDesc RM   = { 0, 0, 0, 0, 0, 0, 0 };
 static int DoLink       = 1;
 static int DoAssemble   = 1;
 
+/* The socket of the compile server, NULL if cc65 is run directly */
+static const char* CompileServer = 0;
+
 /* The name of the output file, NULL if none given */
 static const char* OutputName = 0;
 
@@ -465,6 +468,32 @@ static void ExecProgram (CmdDesc* Cmd)
 
 
 
+#if defined(HAVE_SERVER)
+static void ExecServer (CmdDesc* Cmd)
+/* Execute a subprocess on the compile server. Exit on errors. */
+{
+    int Status;
+
+    /* If in debug mode, output the command line we will execute */
+    if (Debug) {
+        printf ("Executing on '%s': ", CompileServer);
+        CmdPrint (Cmd, stdout);
+        printf ("\n");
+    }
+
+    /* Run the job */
+    Status = SpawnServer (CompileServer, Cmd->Args);
+
+    /* Check the result code */
+    if (Status != 0) {
+        /* Called program had an error */
+        exit (Status);
+    }
+}
+#endif
+
+
+
 static void RemoveTempFiles (void)
 {
     unsigned I;
@@ -698,7 +727,14 @@ static void Compile (const char* File)
     CmdAddArg (&CC65, 0);
 
     /* Run the compiler */
-    ExecProgram (&CC65);
+#if defined(HAVE_SERVER)
+    if (CompileServer) {
+        ExecServer (&CC65);
+    } else
+#endif
+    {
+        ExecProgram (&CC65);
+    }
 
     /* Remove the excess arguments */
     CmdDelArgs (&CC65, ArgCount);
@@ -854,6 +890,7 @@ static void Usage (void)
             "  --bss-label name\t\tDefine and export a BSS segment label\n"
             "  --bss-name seg\t\tSet the name of the BSS segment\n"
             "  --cc-args options\t\tPass options to the compiler\n"
+            "  --cc-server name\t\tCompile using the cc65 server on a socket\n"
             "  --cfg-path path\t\tSpecify a config file search path\n"
             "  --check-stack\t\t\tGenerate stack overflow checks\n"
             "  --code-label name\t\tDefine and export a CODE segment label\n"
@@ -980,6 +1017,19 @@ static void OptCCArgs (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptCCServer (const char* Opt attribute ((unused)), const char* Arg)
+/* Run the compiler through a compile server */
+{
+#if defined(HAVE_SERVER)
+    CompileServer = Arg;
+#else
+    (void) Arg;
+    Error ("Compile servers are not supported on this platform");
+#endif
+}
+
+
+
 static void OptCfgPath (const char* Opt attribute ((unused)), const char* Arg)
 /* Config file search path (linker) */
 {
@@ -1472,6 +1522,7 @@ int main (int argc, char* argv [])
         { "--bss-label",           1, OptBssLabel           },
         { "--bss-name",            1, OptBssName            },
         { "--cc-args",             1, OptCCArgs             },
+        { "--cc-server",           1, OptCCServer           },
         { "--cfg-path",            1, OptCfgPath            },
         { "--check-stack",         0, OptCheckStack         },
         { "--code-label",          1, OptCodeLabel          },
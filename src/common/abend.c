@@ -42,12 +42,44 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Function called by Terminate instead of exit, may be NULL */
+static void (*ExitHook) (int Code) = 0;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
+void SetExitHook (void (*Hook) (int Code))
+/* Set a function that is called by Terminate instead of exit. The function
+** must not return. Use NULL to remove the hook.
+*/
+{
+    ExitHook = Hook;
+}
+
+
+
+void Terminate (int Code)
+/* Terminate the program with the given exit code */
+{
+    if (ExitHook) {
+        ExitHook (Code);
+    }
+    exit (Code);
+}
+
+
+
 void AbEnd (const char* Format, ...)
 /* Print a message preceeded by the program name and terminate the program
 ** with an error exit code.
@@ -67,5 +99,5 @@ void AbEnd (const char* Format, ...)
     fprintf (stderr, "\n");
 
     /* Terminate the program */
-    exit (EXIT_FAILURE);
+    Terminate (EXIT_FAILURE);
 }
@@ -48,6 +48,14 @@
 
 
 
+void SetExitHook (void (*Hook) (int Code));
+/* Set a function that is called by Terminate instead of exit. The function
+** must not return. Use NULL to remove the hook.
+*/
+
+void Terminate (int Code) attribute ((noreturn));
+/* Terminate the program with the given exit code */
+
 void AbEnd (const char* Format, ...) attribute ((format (printf, 1, 2), noreturn));
 /* Print a message preceeded by the program name and terminate the program
 ** with an error exit code.
@@ -74,6 +74,10 @@ static void InternalDumpExpr (const ExprNode* Expr, const ExprNode* (*ResolveSym
             printf (" SEC");
             break;
 
+        case EXPR_RELAX:
+            printf (" RELAX");
+            break;
+
         case EXPR_SEGMENT:
             printf (" SEG");
             break;
@@ -0,0 +1,202 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                filecache.c                                */
+/*                                                                           */
+/*                   Cache for the contents of input files                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#if !defined(_WIN32) && !defined(_AMIGA)
+#  include <unistd.h>
+#endif
+
+#include "filecache.h"
+#include "filestat.h"
+#include "hashfunc.h"
+#include "hashtab.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key);
+/* Generate the hash over a key. */
+
+static const void* HT_GetKey (const void* Entry);
+/* Given a pointer to the user entry data, return a pointer to the key. */
+
+static int HT_Compare (const void* Key1, const void* Key2);
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Hash table functions */
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+/* The files in the cache, hashed by the name they were found under, made
+** absolute.
+*/
+static HashTable CachedFiles = STATIC_HASHTABLE_INITIALIZER (127, &HashFunc);
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key. */
+{
+    return HashStr (Key);
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key. */
+{
+    return ((const CachedFile*) Entry)->Name;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+{
+    return strcmp (Key1, Key2);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void MakeKey (StrBuf* Key, const char* Name)
+/* Make the key for a file name. A relative name is prefixed with the current
+** directory, so that the same name in another directory is another file.
+*/
+{
+#if !defined(_WIN32) && !defined(_AMIGA)
+    char Dir[FILENAME_MAX];
+#endif
+
+    SB_Clear (Key);
+#if !defined(_WIN32) && !defined(_AMIGA)
+    if (Name[0] != '/' && getcwd (Dir, sizeof (Dir)) != 0) {
+        SB_AppendStr (Key, Dir);
+        SB_AppendChar (Key, '/');
+    }
+#endif
+    SB_AppendStr (Key, Name);
+    SB_Terminate (Key);
+}
+
+
+
+const CachedFile* GetCachedFile (const char* Name)
+/* Return the file with the given name. Name is the path the file was found
+** under, after searching the include paths. The file is read only if it is
+** not in the cache, or if its size or modification time have changed since it
+** was read. The cache is kept for the lifetime of the program, so a program
+** that handles several input files reads each of them only once, and the
+** contents stay valid until the program exits. Returns NULL and sets errno if
+** the file cannot be read.
+*/
+{
+    static StrBuf Key = STATIC_STRBUF_INITIALIZER;
+
+    struct stat Buf;
+    CachedFile* CF;
+    SrcFile*    F;
+
+    /* Get the current size and time of the file */
+    if (FileStat (Name, &Buf) != 0) {
+        return 0;
+    }
+
+    /* Search for the file in the cache */
+    MakeKey (&Key, Name);
+    CF = HT_Find (&CachedFiles, SB_GetConstBuf (&Key));
+    if (CF) {
+        if (CF->Size == (unsigned long) Buf.st_size &&
+            CF->MTime == (unsigned long) Buf.st_mtime) {
+            return CF;
+        }
+        /* The file has changed. Since the old contents may still be in use,
+        ** just remove the entry from the cache.
+        */
+        HT_Remove (&CachedFiles, CF);
+    }
+
+    /* Read the file */
+    F = OpenSrcFile (Name, SRC_EOL_LF);
+    if (F == 0) {
+        return 0;
+    }
+
+    /* Add it to the cache */
+    CF        = xmalloc (sizeof (CachedFile));
+    InitHashNode (&CF->Node);
+    CF->Name  = xstrdup (SB_GetConstBuf (&Key));
+    CF->Size  = (unsigned long) (F->End - F->Buf);
+    CF->MTime = (unsigned long) Buf.st_mtime;
+    CF->F     = F;
+    HT_Insert (&CachedFiles, CF);
+
+    /* Return the new entry */
+    return CF;
+}
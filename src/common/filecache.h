@@ -0,0 +1,81 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                filecache.h                                */
+/*                                                                           */
+/*                   Cache for the contents of input files                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef FILECACHE_H
+#define FILECACHE_H
+
+
+
+#include "hashtab.h"
+#include "srcfile.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A file in the cache */
+typedef struct CachedFile CachedFile;
+struct CachedFile {
+    HashNode            Node;           /* Node in the hash table */
+    char*               Name;           /* Name of the file (the hash key) */
+    unsigned long       Size;           /* Size of the file */
+    unsigned long       MTime;          /* Time of last modification */
+    SrcFile*            F;              /* Contents of the file */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+const CachedFile* GetCachedFile (const char* Name);
+/* Return the file with the given name. Name is the path the file was found
+** under, after searching the include paths. The file is read only if it is
+** not in the cache, or if its size or modification time have changed since it
+** was read. The cache is kept for the lifetime of the program, so a program
+** that handles several input files reads each of them only once, and the
+** contents stay valid until the program exits. Returns NULL and sets errno if
+** the file cannot be read.
+*/
+
+
+
+/* End of filecache.h */
+
+#endif
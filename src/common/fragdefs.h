@@ -63,6 +63,10 @@
 #define FRAG_SEXPR24    (FRAG_SEXPR | 3)/* 24 bit signed expression */
 #define FRAG_SEXPR32    (FRAG_SEXPR | 4)/* 32 bit signed expression */
 
+#define FRAG_RELAX      0x18            /* Instruction relaxed by the linker */
+#define FRAG_RELAX_ZP   (FRAG_RELAX | 1)/* Absolute or zero page address */
+#define FRAG_RELAX_BRA  (FRAG_RELAX | 2)/* JMP or BRA */
+
 #define FRAG_FILL       0x20            /* Fill bytes */
 
 
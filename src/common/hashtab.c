@@ -40,6 +40,17 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Average chain length that causes the table to grow */
+#define HT_MAX_LOAD     4U
+
+
+
 /*****************************************************************************/
 /*                             struct HashTable                              */
 /*****************************************************************************/
@@ -101,6 +112,37 @@ static void HT_Alloc (HashTable* T)
 
 
 
+static void HT_Grow (HashTable* T)
+/* Increase the number of slots in a table and rehash all entries */
+{
+    unsigned    I;
+    unsigned    OldSlots = T->Slots;
+    HashNode**  OldTable = T->Table;
+
+    /* Allocate a new, larger table */
+    T->Slots = OldSlots * 2 + 1;
+    HT_Alloc (T);
+
+    /* Move all nodes into the new table. The full hash is stored in the
+    ** node, so it hasn't to be calculated again.
+    */
+    for (I = 0; I < OldSlots; ++I) {
+        HashNode* N = OldTable[I];
+        while (N) {
+            HashNode* Next = N->Next;
+            unsigned  RHash = N->Hash % T->Slots;
+            N->Next = T->Table[RHash];
+            T->Table[RHash] = N;
+            N = Next;
+        }
+    }
+
+    /* Free the old table */
+    xfree (OldTable);
+}
+
+
+
 HashNode* HT_FindHash (const HashTable* T, const void* Key, unsigned Hash)
 /* Find the node with the given key. Differs from HT_Find in that the hash
 ** for the key is precalculated and passed to the function.
@@ -151,9 +193,13 @@ void HT_Insert (HashTable* T, void* Entry)
     HashNode* N;
     unsigned RHash;
 
-    /* If we don't have a table, we need to allocate it now */
+    /* If we don't have a table, we need to allocate it now. If the chains
+    ** get too long, increase the size of the table.
+    */
     if (T->Table == 0) {
         HT_Alloc (T);
+    } else if (T->Count >= T->Slots * HT_MAX_LOAD) {
+        HT_Grow (T);
     }
 
     /* The first member of Entry is also the hash node */
@@ -108,6 +108,18 @@ SearchPaths* NewSearchPath (void)
 
 
 
+void FreeSearchPath (SearchPaths* P)
+/* Free a search path list and all paths in it */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (P); ++I) {
+        xfree (CollAtUnchecked (P, I));
+    }
+    FreeCollection (P);
+}
+
+
+
 void AddSearchPath (SearchPaths* P, const char* NewPath)
 /* Add a new search path to the end of an existing list */
 {
@@ -223,7 +235,7 @@ static int SearchPathBin(const char* bin, char* buf, size_t buflen)
         }
         if (*p == ':') {
             p++;
-        } else if (!p) {
+        } else {
             break;
         }
     }
@@ -62,6 +62,9 @@ typedef struct Collection SearchPaths;
 SearchPaths* NewSearchPath (void);
 /* Create a new, empty search path list */
 
+void FreeSearchPath (SearchPaths* P);
+/* Free a search path list and all paths in it */
+
 void AddSearchPath (SearchPaths* P, const char* NewPath);
 /* Add a new search path to the end of an existing list */
 
@@ -46,6 +46,7 @@
 
 /* Segment flags */
 #define SEG_FLAG_NONE           0x00
+#define SEG_FLAG_REMOVABLE      0x01    /* May be removed if not referenced */
 
 
 
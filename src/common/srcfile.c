@@ -0,0 +1,236 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 srcfile.c                                 */
+/*                                                                           */
+/*                   Line oriented reading of source files                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#endif
+
+/* common */
+#include "srcfile.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Size of the blocks when reading a file that cannot be mapped */
+#define READ_BLOCK_SIZE         0x10000
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static SrcFile* NewSrcFile (const char* Buf, size_t Size, size_t MapSize,
+                            unsigned EOL)
+/* Create a new SrcFile for the given contents */
+{
+    SrcFile* F = xmalloc (sizeof (SrcFile));
+    F->Buf      = Buf;
+    F->Pos      = Buf;
+    F->End      = Buf + Size;
+    F->MapSize  = MapSize;
+    F->EOL      = EOL;
+    F->Owner    = 1;
+    return F;
+}
+
+
+
+static SrcFile* ReadSrcFile (const char* Name, unsigned EOL)
+/* Read the complete file into memory in large blocks */
+{
+    char*   Buf  = 0;
+    size_t  Size = 0;
+    size_t  Allocated = 0;
+    int     Error;
+
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        return 0;
+    }
+
+    while (1) {
+        size_t Count;
+        if (Allocated - Size < READ_BLOCK_SIZE) {
+            Allocated = (Allocated == 0)? READ_BLOCK_SIZE : Allocated * 2;
+            Buf = xrealloc (Buf, Allocated);
+        }
+        Count = fread (Buf + Size, 1, Allocated - Size, F);
+        Size += Count;
+        if (Count == 0) {
+            break;
+        }
+    }
+
+    /* Check for read errors */
+    Error = ferror (F);
+    (void) fclose (F);
+    if (Error) {
+        xfree (Buf);
+        errno = EIO;
+        return 0;
+    }
+
+    return NewSrcFile (Buf, Size, 0, EOL);
+}
+
+
+
+SrcFile* OpenSrcFile (const char* Name, unsigned EOL)
+/* Open a source file and make its contents available. Returns NULL and sets
+** errno if the file cannot be opened or read.
+*/
+{
+#if !defined(_WIN32)
+
+    struct stat Buf;
+    void*       Map;
+
+    /* Map regular files into memory. Everything else (empty files, pipes,
+    ** file systems without mmap support) is read.
+    */
+    int FD = open (Name, O_RDONLY);
+    if (FD < 0) {
+        return 0;
+    }
+    if (fstat (FD, &Buf) != 0 || !S_ISREG (Buf.st_mode) || Buf.st_size == 0) {
+        close (FD);
+        return ReadSrcFile (Name, EOL);
+    }
+    Map = mmap (0, (size_t) Buf.st_size, PROT_READ, MAP_PRIVATE, FD, 0);
+    close (FD);
+    if (Map == MAP_FAILED) {
+        return ReadSrcFile (Name, EOL);
+    }
+    return NewSrcFile (Map, (size_t) Buf.st_size, (size_t) Buf.st_size, EOL);
+
+#else
+
+    return ReadSrcFile (Name, EOL);
+
+#endif
+}
+
+
+
+SrcFile* OpenSrcBuf (const char* Buf, size_t Size, unsigned EOL)
+/* Read source lines from a buffer that was already read. The buffer is not
+** copied and must stay valid until the file is closed, which will not
+** release it.
+*/
+{
+    SrcFile* F = NewSrcFile (Buf, Size, 0, EOL);
+    F->Owner = 0;
+    return F;
+}
+
+
+
+void CloseSrcFile (SrcFile* F)
+/* Close a source file and release its contents */
+{
+    if (F->Owner) {
+#if !defined(_WIN32)
+        if (F->MapSize > 0) {
+            munmap ((void*) F->Buf, F->MapSize);
+        } else {
+            xfree ((void*) F->Buf);
+        }
+#else
+        xfree ((void*) F->Buf);
+#endif
+    }
+    xfree (F);
+}
+
+
+
+const char* ReadSrcLine (SrcFile* F, unsigned* Len, int* Terminated)
+/* Return the next line of the file, or NULL if there are no more lines. The
+** length of the line without the line terminator is returned in Len, and
+** Terminated is set to false if the last line of the file has no line
+** terminator. With SRC_EOL_LF, a CR in front of the LF is part of the line.
+** The line is not terminated with a NUL and stays valid until the file is
+** closed.
+*/
+{
+    const char* Start = F->Pos;
+    const char* P;
+
+    if (Start >= F->End) {
+        return 0;
+    }
+
+    if (F->EOL == SRC_EOL_ANY) {
+        /* Search for CR or LF */
+        P = Start;
+        while (P < F->End && *P != '\n' && *P != '\r') {
+            ++P;
+        }
+    } else {
+        /* memchr is usually much faster than a loop */
+        P = memchr (Start, '\n', F->End - Start);
+        if (P == 0) {
+            P = F->End;
+        }
+    }
+
+    *Len = (unsigned) (P - Start);
+    if (P == F->End) {
+        *Terminated = 0;
+    } else {
+        *Terminated = 1;
+        if (*P++ == '\r' && P < F->End && *P == '\n') {
+            /* CR LF */
+            ++P;
+        }
+    }
+    F->Pos = P;
+
+    return Start;
+}
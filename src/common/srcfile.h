@@ -0,0 +1,101 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 srcfile.h                                 */
+/*                                                                           */
+/*                   Line oriented reading of source files                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#ifndef SRCFILE_H
+#define SRCFILE_H
+
+
+
+#include <stddef.h>
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Line ending styles */
+#define SRC_EOL_LF      0x00            /* Lines end with LF */
+#define SRC_EOL_ANY     0x01            /* Lines end with LF, CR or CR LF */
+
+/* A source file. The complete contents are memory mapped or read into
+** memory, and lines are handed out as slices of this buffer.
+*/
+typedef struct SrcFile SrcFile;
+struct SrcFile {
+    const char*         Buf;            /* Contents of the file */
+    const char*         Pos;            /* Current read position */
+    const char*         End;            /* End of the contents */
+    size_t              MapSize;        /* Size of mapping, zero if read */
+    unsigned            EOL;            /* Line ending style */
+    int                 Owner;          /* True if contents are released */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+SrcFile* OpenSrcFile (const char* Name, unsigned EOL);
+/* Open a source file and make its contents available. Returns NULL and sets
+** errno if the file cannot be opened or read.
+*/
+
+SrcFile* OpenSrcBuf (const char* Buf, size_t Size, unsigned EOL);
+/* Read source lines from a buffer that was already read. The buffer is not
+** copied and must stay valid until the file is closed, which will not
+** release it.
+*/
+
+void CloseSrcFile (SrcFile* F);
+/* Close a source file and release its contents */
+
+const char* ReadSrcLine (SrcFile* F, unsigned* Len, int* Terminated);
+/* Return the next line of the file, or NULL if there are no more lines. The
+** length of the line without the line terminator is returned in Len, and
+** Terminated is set to false if the last line of the file has no line
+** terminator. With SRC_EOL_LF, a CR in front of the LF is part of the line.
+** The line is not terminated with a NUL and stays valid until the file is
+** closed.
+*/
+
+
+
+/* End of srcfile.h */
+
+#endif
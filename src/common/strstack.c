@@ -80,3 +80,13 @@ void SS_Push (StrStack* S, const char* Val)
     CHECK (S->Count < sizeof (S->Stack) / sizeof (S->Stack[0]));
     S->Stack[S->Count++] = xstrdup (Val);
 }
+
+
+
+void SS_Clear (StrStack* S)
+/* Remove all values from a string stack */
+{
+    while (S->Count > 0) {
+        xfree (S->Stack[--S->Count]);
+    }
+}
@@ -85,6 +85,9 @@ void SS_Drop (StrStack* S);
 void SS_Push (StrStack* S, const char* Val);
 /* Push a value onto a string stack */
 
+void SS_Clear (StrStack* S);
+/* Remove all values from a string stack */
+
 
 
 /* End of strstack.h */
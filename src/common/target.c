@@ -210,45 +210,45 @@ static const TargetEntry TargetMap[] = {
 
 /* Table with target properties by target ID */
 static const TargetProperties PropertyTable[TGT_COUNT] = {
-    { "none",           CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "module",         CPU_6502,       BINFMT_O65,         CTNone  },
-    { "atari",          CPU_6502,       BINFMT_BINARY,      CTAtari },
-    { "atari2600",      CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "atari5200",      CPU_6502,       BINFMT_BINARY,      CTAtari },
-    { "atari7800",      CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "atarixl",        CPU_6502,       BINFMT_BINARY,      CTAtari },
-    { "vic20",          CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "c16",            CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "c64",            CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "c128",           CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "plus4",          CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "cbm510",         CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "cbm610",         CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "osic1p",         CPU_6502,       BINFMT_BINARY,      CTOSI   },
-    { "pet",            CPU_6502,       BINFMT_BINARY,      CTPET   },
-    { "bbc",            CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "apple2",         CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "apple2enh",      CPU_65C02,      BINFMT_BINARY,      CTNone  },
-    { "geos-cbm",       CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "creativision",   CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "geos-apple",     CPU_65C02,      BINFMT_BINARY,      CTNone  },
-    { "lunix",          CPU_6502,       BINFMT_O65,         CTNone  },
-    { "atmos",          CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "telestrat",      CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "nes",            CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "supervision",    CPU_65SC02,     BINFMT_BINARY,      CTNone  },
-    { "lynx",           CPU_65SC02,     BINFMT_BINARY,      CTNone  },
-    { "sim6502",        CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "sim65c02",       CPU_65C02,      BINFMT_BINARY,      CTNone  },
-    { "pce",            CPU_HUC6280,    BINFMT_BINARY,      CTNone  },
-    { "gamate",         CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "c65",            CPU_4510,       BINFMT_BINARY,      CTPET   },
-    { "cx16",           CPU_W65C02,     BINFMT_BINARY,      CTPET   },
-    { "sym1",           CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "mega65",         CPU_45GS02,     BINFMT_BINARY,      CTPET   },
-    { "kim1",           CPU_6502,       BINFMT_BINARY,      CTNone  },
-    { "rp6502",         CPU_W65C02,     BINFMT_BINARY,      CTNone  },
-    { "agat",           CPU_6502,       BINFMT_BINARY,      CTAgat  },
+    { "none",           CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "module",         CPU_6502,       BINFMT_O65,         CTNone,   0 },
+    { "atari",          CPU_6502,       BINFMT_BINARY,      CTAtari,  1 },
+    { "atari2600",      CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "atari5200",      CPU_6502,       BINFMT_BINARY,      CTAtari,  1 },
+    { "atari7800",      CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "atarixl",        CPU_6502,       BINFMT_BINARY,      CTAtari,  1 },
+    { "vic20",          CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "c16",            CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "c64",            CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "c128",           CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "plus4",          CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "cbm510",         CPU_6502,       BINFMT_BINARY,      CTPET,    1 },
+    { "cbm610",         CPU_6502,       BINFMT_BINARY,      CTPET,    1 },
+    { "osic1p",         CPU_6502,       BINFMT_BINARY,      CTOSI,    1 },
+    { "pet",            CPU_6502,       BINFMT_BINARY,      CTPET,    0 },
+    { "bbc",            CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "apple2",         CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "apple2enh",      CPU_65C02,      BINFMT_BINARY,      CTNone,   0 },
+    { "geos-cbm",       CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "creativision",   CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "geos-apple",     CPU_65C02,      BINFMT_BINARY,      CTNone,   0 },
+    { "lunix",          CPU_6502,       BINFMT_O65,         CTNone,   1 },
+    { "atmos",          CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "telestrat",      CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "nes",            CPU_6502,       BINFMT_BINARY,      CTNone,   0 },
+    { "supervision",    CPU_65SC02,     BINFMT_BINARY,      CTNone,   1 },
+    { "lynx",           CPU_65SC02,     BINFMT_BINARY,      CTNone,   1 },
+    { "sim6502",        CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "sim65c02",       CPU_65C02,      BINFMT_BINARY,      CTNone,   1 },
+    { "pce",            CPU_HUC6280,    BINFMT_BINARY,      CTNone,   1 },
+    { "gamate",         CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "c65",            CPU_4510,       BINFMT_BINARY,      CTPET,    0 },
+    { "cx16",           CPU_W65C02,     BINFMT_BINARY,      CTPET,    1 },
+    { "sym1",           CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "mega65",         CPU_45GS02,     BINFMT_BINARY,      CTPET,    0 },
+    { "kim1",           CPU_6502,       BINFMT_BINARY,      CTNone,   1 },
+    { "rp6502",         CPU_W65C02,     BINFMT_BINARY,      CTNone,   1 },
+    { "agat",           CPU_6502,       BINFMT_BINARY,      CTAgat,   0 },
 };
 
 /* Target system */
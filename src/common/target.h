@@ -102,6 +102,7 @@ struct TargetProperties {
     cpu_t                   DefaultCPU; /* Default CPU for this target */
     unsigned char           BinFmt;     /* Default binary format for this target */
     const unsigned char*    CharMap;    /* Character translation table */
+    unsigned char           ZPArgs;     /* zpargs block fits into the zero page */
 };
 
 /* Target system */
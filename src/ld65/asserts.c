@@ -75,7 +75,7 @@ static Collection Assertions = STATIC_COLLECTION_INITIALIZER;
 
 
 
-Assertion* ReadAssertion (FILE* F, struct ObjData* O)
+Assertion* ReadAssertion (InFile* F, struct ObjData* O)
 /* Read an assertion from the given file */
 {
     /* Allocate memory */
@@ -100,6 +100,21 @@ Assertion* ReadAssertion (FILE* F, struct ObjData* O)
 
 
 
+void WalkAssertions (void (*F) (ExprNode* Expr))
+/* Call F with the expression of each assertion that is checked at link time */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&Assertions); ++I) {
+        Assertion* A = CollAtUnchecked (&Assertions, I);
+        if (AssertAtLinkTime (A->Action)) {
+            F (A->Expr);
+        }
+    }
+}
+
+
+
 void CheckAssertions (void)
 /* Check all assertions */
 {
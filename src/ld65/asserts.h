@@ -41,8 +41,12 @@
 #include <stdio.h>
 
 /* common */
+#include "exprdefs.h"
 #include "filepos.h"
 
+/* ld65 */
+#include "fileio.h"
+
 
 
 /*****************************************************************************/
@@ -65,9 +69,12 @@ struct ObjData;
 
 
 
-Assertion* ReadAssertion (FILE* F, struct ObjData* O);
+Assertion* ReadAssertion (InFile* F, struct ObjData* O);
 /* Read an assertion from the given file */
 
+void WalkAssertions (void (*F) (ExprNode* Expr));
+/* Call F with the expression of each assertion that is checked at link time */
+
 void CheckAssertions (void);
 /* Check all assertions */
 
@@ -35,7 +35,6 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <errno.h>
 
 /* common */
 #include "alignment.h"
@@ -65,7 +64,7 @@
 
 struct BinDesc {
     unsigned    Undef;          /* Count of undefined externals */
-    FILE*       F;              /* Output file */
+    OutFile*    F;              /* Output file */
     const char* Filename;       /* Name of output file */
 };
 
@@ -140,9 +139,9 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
     unsigned long Addr = M->Start;
 
     /* Debugging: Check that the file offset is correct */
-    if (ftell (D->F) != (long)M->FileOffs) {
-        Internal ("Invalid file offset for memory area %s: %ld/%lu",
-                  GetString (M->Name), ftell (D->F), M->FileOffs);
+    if (OutFileGetPos (D->F) != M->FileOffs) {
+        Internal ("Invalid file offset for memory area %s: %lu/%lu",
+                  GetString (M->Name), OutFileGetPos (D->F), M->FileOffs);
     }
 
     /* Walk over all segments in this memory area */
@@ -167,7 +166,7 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
         PrintBoolVal ("Dumped", S->Seg->Dumped);
         PrintBoolVal ("DoWrite", DoWrite);
         PrintNumVal  ("Address", Addr);
-        PrintNumVal  ("FileOffs", (unsigned long) ftell (D->F));
+        PrintNumVal  ("FileOffs", OutFileGetPos (D->F));
 
         /* If this is the run memory area, we must apply run alignment. If
         ** this is not the run memory area but the load memory area (which
@@ -197,13 +196,12 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
                         /* Seek in "overwrite" segments. Fill if the seek position has not been reached yet. */
                         unsigned long FileLength;
                         unsigned long SeekTarget = NewAddr - M->Start + M->FileOffs;
-                        fseek (D->F, 0, SEEK_END);
-                        FileLength = ftell (D->F);
+                        FileLength = OutFileGetSize (D->F);
                         if (SeekTarget > FileLength) {
                             WriteMult (D->F, M->FillVal, SeekTarget - FileLength);
                             PrintNumVal ("SF_OVERWRITE", SeekTarget - FileLength);
                         }
-                        fseek (D->F, NewAddr - M->Start + M->FileOffs, SEEK_SET);
+                        OutFileSetPos (D->F, NewAddr - M->Start + M->FileOffs);
                     } else {
                         WriteMult (D->F, M->FillVal, NewAddr-Addr);
                         PrintNumVal ("SF_OFFSET", NewAddr - Addr);
@@ -231,15 +229,15 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
         ** if the memory area is the load area.
         */
         if (DoWrite) {
-            unsigned long P = ftell (D->F);
+            unsigned long P = OutFileGetPos (D->F);
             SegWrite (D->Filename, D->F, S->Seg, BinWriteExpr, D);
-            PrintNumVal ("Wrote", (unsigned long) (ftell (D->F) - P));
+            PrintNumVal ("Wrote", OutFileGetPos (D->F) - P);
             /* If we have just written an OVERWRITE segement, move position to the
             ** end of file, so that subsequent segments are written in the correct
             ** place.
             */
             if (S->Flags & SF_OVERWRITE) {
-                fseek (D->F, 0, SEEK_END);
+                OutFileSetPos (D->F, OutFileGetSize (D->F));
             }
         } else if (M->Flags & MF_FILL) {
             WriteMult (D->F, S->Seg->FillVal, S->Seg->Size);
@@ -299,10 +297,7 @@ void BinWriteTarget (BinDesc* D, struct File* F)
     }
 
     /* Open the file */
-    D->F = fopen (D->Filename, "wb");
-    if (D->F == 0) {
-        Error ("Cannot open `%s': %s", D->Filename, strerror (errno));
-    }
+    D->F = OpenOutFile (D->Filename);
 
     /* Keep the user happy */
     Print (stdout, 1, "Opened `%s'...\n", D->Filename);
@@ -316,9 +311,7 @@ void BinWriteTarget (BinDesc* D, struct File* F)
     }
 
     /* Close the file */
-    if (fclose (D->F) != 0) {
-        Error ("Cannot write to `%s': %s", D->Filename, strerror (errno));
-    }
+    CloseOutFile (D->F);
 
     /* Reset the file and filename */
     D->F        = 0;
@@ -62,10 +62,12 @@
 #include "error.h"
 #include "exports.h"
 #include "expr.h"
+#include "gc.h"
 #include "global.h"
 #include "memarea.h"
 #include "o65.h"
 #include "objdata.h"
+#include "relax.h"
 #include "scanner.h"
 #include "spool.h"
 #include "xex.h"
@@ -152,6 +154,12 @@ static BinDesc* BinFmtDesc      = 0;
 static O65Desc* O65FmtDesc      = 0;
 static XexDesc* XexFmtDesc      = 0;
 
+/* Exports for the placement of the segments in the order they were defined.
+** If the segments are placed again, the exports are reused.
+*/
+static Collection       LayoutExports = STATIC_COLLECTION_INITIALIZER;
+static unsigned         LayoutIndex   = 0;
+
 
 
 /*****************************************************************************/
@@ -208,8 +216,8 @@ static void FileInsert (File* F, MemoryArea* M)
 
 
 
-static MemoryArea* CfgFindMemory (unsigned Name)
-/* Find the memory are with the given name. Return NULL if not found */
+MemoryArea* CfgFindMemory (unsigned Name)
+/* Find the memory area with the given name. Return NULL if not found */
 {
     unsigned I;
     for (I = 0; I < CollCount (&MemoryAreas); ++I) {
@@ -359,6 +367,7 @@ static SegDesc* NewSegDesc (unsigned Name)
     S->FillVal       = 0;
     S->RunAlignment  = 1;
     S->LoadAlignment = 1;
+    S->LoadAreas     = EmptyCollection;
 
     /* Insert the struct into the list ... */
     CollAppend (&SegDescList, S);
@@ -373,6 +382,7 @@ static void FreeSegDesc (SegDesc* S)
 /* Free a segment descriptor */
 {
     FreeLineInfo (S->LI);
+    DoneCollection (&S->LoadAreas);
     xfree (S);
 }
 
@@ -639,6 +649,43 @@ static void ParseFiles (void)
 
 
 
+static void ParseLoadAreas (SegDesc* S)
+/* Parse a list of memory areas in parentheses for the LOAD attribute. The
+** linker chooses one of them.
+*/
+{
+    /* Skip the opening paren */
+    CfgNextTok ();
+
+    /* Read the memory areas */
+    while (1) {
+        MemoryArea* M;
+        CfgAssureIdent ();
+        M = CfgGetMemory (GetStrBufId (&CfgSVal));
+        if (CollIndex (&S->LoadAreas, M) >= 0) {
+            PError (&CfgErrorPos, "Memory area `%s' is listed twice",
+                    GetString (M->Name));
+        }
+        CollAppend (&S->LoadAreas, M);
+        CfgNextTok ();
+        if (CfgTok != CFGTOK_COMMA) {
+            break;
+        }
+        CfgNextTok ();
+    }
+    CfgConsume (CFGTOK_RPAR, "`)' expected");
+
+    /* The first memory area is used for the checks of the config. With only
+    ** one area, there's nothing to choose.
+    */
+    S->Load = CollAtUnchecked (&S->LoadAreas, 0);
+    if (CollCount (&S->LoadAreas) > 1) {
+        S->Flags |= SF_AUTO;
+    }
+}
+
+
+
 static void ParseSegments (void)
 /* Parse a SEGMENTS section */
 {
@@ -725,8 +772,12 @@ static void ParseSegments (void)
 
                 case CFGTOK_LOAD:
                     FlagAttr (&S->Attr, SA_LOAD, "LOAD");
-                    S->Load = CfgGetMemory (GetStrBufId (&CfgSVal));
-                    CfgNextTok ();
+                    if (CfgTok == CFGTOK_LPAR) {
+                        ParseLoadAreas (S);
+                    } else {
+                        S->Load = CfgGetMemory (GetStrBufId (&CfgSVal));
+                        CfgNextTok ();
+                    }
                     break;
 
                 case CFGTOK_OFFSET:
@@ -786,6 +837,9 @@ static void ParseSegments (void)
         if ((S->Attr & SA_RUN) == 0) {
             S->Attr |= SA_RUN;
             S->Run = S->Load;
+            if (S->Flags & SF_AUTO) {
+                S->Flags |= SF_AUTO_RUN;
+            }
         }
 
         /* An attribute of ALIGN_LOAD doesn't make sense if there are no
@@ -815,6 +869,27 @@ static void ParseSegments (void)
                         "Cannot place r/w segment `%s' in r/o memory area `%s'",
                         GetString (S->Name), GetString (S->Run->Name));
             }
+            if (S->Flags & SF_AUTO_RUN) {
+                unsigned I;
+                for (I = 1; I < CollCount (&S->LoadAreas); ++I) {
+                    const MemoryArea* M = CollConstAt (&S->LoadAreas, I);
+                    if (M->Flags & MF_RO) {
+                        PError (&CfgErrorPos,
+                                "Cannot place r/w segment `%s' in r/o memory area `%s'",
+                                GetString (S->Name), GetString (M->Name));
+                    }
+                }
+            }
+        }
+
+        /* If the linker chooses the memory area, the segment is appended to
+        ** the other segments of the area, so there's no fixed address.
+        */
+        if ((S->Flags & SF_AUTO) != 0 &&
+            (S->Flags & (SF_OFFSET | SF_START | SF_OVERWRITE)) != 0) {
+            PError (&CfgErrorPos,
+                    "`START', `OFFSET' and type `overwrite' cannot be used "
+                    "with several `LOAD' memory areas");
         }
 
         /* Only one of ALIGN, START and OFFSET may be used */
@@ -1688,10 +1763,137 @@ void CfgRead (void)
 
 
 
+static unsigned long GetAreaEnd (const MemoryArea* M, unsigned long Start)
+/* Return the address behind the segments inserted into the memory area so
+** far. Start is the start address of the area. Addresses are computed as in
+** PlaceSegments, but without any checks.
+*/
+{
+    unsigned I;
+    unsigned long Addr = Start;
+    unsigned long End  = Start;
+
+    for (I = 0; I < CollCount (&M->SegList); ++I) {
+
+        /* Get the segment */
+        const SegDesc* S = CollConstAt (&M->SegList, I);
+
+        if (S->Run == M) {
+            if (S->Flags & SF_ALIGN) {
+                Addr = AlignAddr (Addr, S->RunAlignment);
+            } else if (S->Flags & (SF_OFFSET | SF_START)) {
+                unsigned long NewAddr = S->Addr;
+                if (S->Flags & SF_OFFSET) {
+                    NewAddr += Start;
+                }
+                if (NewAddr > Addr || (S->Flags & SF_OVERWRITE) != 0) {
+                    Addr = NewAddr;
+                }
+            }
+        } else if (S->Flags & SF_ALIGN_LOAD) {
+            Addr = AlignAddr (Addr, S->LoadAlignment);
+        }
+
+        /* Overwrite segments may end before the ones preceding them */
+        Addr += S->Seg->Size;
+        if (Addr > End) {
+            End = Addr;
+        }
+    }
+
+    /* Return the end address */
+    return End;
+}
+
+
+
+static void PlaceAutoSegment (SegDesc* S)
+/* Choose the load memory area of a segment from the list given in the config
+** file, and insert the segment into it. The segment goes into the first area
+** where it fits, or into the one with the smallest overflow if it doesn't fit
+** anywhere.
+*/
+{
+    unsigned      I;
+    MemoryArea*   Best     = 0;
+    unsigned long BestOver = 0;
+
+    for (I = 0; I < CollCount (&S->LoadAreas); ++I) {
+
+        unsigned long Start, End, Over;
+
+        /* Get the memory area */
+        MemoryArea* M = CollAtUnchecked (&S->LoadAreas, I);
+
+        /* Segments cannot follow overwrite segments, so skip areas that
+        ** end with one.
+        */
+        unsigned Count = CollCount (&M->SegList);
+        if (Count > 0) {
+            const SegDesc* Last = CollConstAt (&M->SegList, Count - 1);
+            if (Last->Flags & SF_OVERWRITE) {
+                continue;
+            }
+        }
+
+        /* The address range of the area must be known now */
+        if (!IsConstExpr (M->StartExpr) || !IsConstExpr (M->SizeExpr)) {
+            PError (GetSourcePos (M->LI),
+                    "Start and size of memory area `%s' must be constant "
+                    "for the placement of segment `%s'",
+                    GetString (M->Name), GetString (S->Name));
+        }
+        Start = GetExprVal (M->StartExpr);
+
+        /* Get the end of the segment if it is appended to this area */
+        End = GetAreaEnd (M, Start);
+        if (S->Flags & SF_AUTO_RUN) {
+            if (S->Flags & SF_ALIGN) {
+                End = AlignAddr (End, S->RunAlignment);
+            }
+        } else if (S->Flags & SF_ALIGN_LOAD) {
+            End = AlignAddr (End, S->LoadAlignment);
+        }
+        End += S->Seg->Size;
+
+        /* Compute the overflow and remember the best area */
+        Start += GetExprVal (M->SizeExpr);
+        Over = (End > Start)? End - Start : 0;
+        if (Best == 0 || Over < BestOver) {
+            Best     = M;
+            BestOver = Over;
+        }
+        if (Over == 0) {
+            /* First fit */
+            break;
+        }
+    }
+
+    /* Check if we found an area */
+    if (Best == 0) {
+        PError (GetSourcePos (S->LI),
+                "No memory area to place segment `%s' into",
+                GetString (S->Name));
+    }
+
+    /* Use the area and insert the segment */
+    S->Load = Best;
+    if (S->Flags & SF_AUTO_RUN) {
+        S->Run = Best;
+    }
+    MemoryInsert (S->Run, S);
+    if (S->Load != S->Run) {
+        MemoryInsert (S->Load, S);
+    }
+}
+
+
+
 static void ProcessSegments (void)
 /* Process the SEGMENTS section */
 {
     unsigned I;
+    Collection AutoSegs = STATIC_COLLECTION_INITIALIZER;
 
     /* Walk over the list of segment descriptors */
     I = 0;
@@ -1732,11 +1934,26 @@ static void ProcessSegments (void)
         */
         if (S->Seg != 0) {
 
-            /* Insert the segment into the memory area list */
-            MemoryInsert (S->Run, S);
-            if (S->Load != S->Run) {
-                /* We have separate RUN and LOAD areas */
-                MemoryInsert (S->Load, S);
+            /* Insert the segment into the memory area list. If the linker
+            ** chooses the load area, remember the segment instead, keeping
+            ** the list sorted by decreasing size.
+            */
+            if (S->Flags & SF_AUTO) {
+                unsigned J = CollCount (&AutoSegs);
+                while (J > 0) {
+                    const SegDesc* Prev = CollConstAt (&AutoSegs, J - 1);
+                    if (Prev->Seg->Size >= S->Seg->Size) {
+                        break;
+                    }
+                    --J;
+                }
+                CollInsert (&AutoSegs, S, J);
+            } else {
+                MemoryInsert (S->Run, S);
+                if (S->Load != S->Run) {
+                    /* We have separate RUN and LOAD areas */
+                    MemoryInsert (S->Load, S);
+                }
             }
 
             /* Use the fill value from the config */
@@ -1758,6 +1975,14 @@ static void ProcessSegments (void)
             CollDelete (&SegDescList, I);
         }
     }
+
+    /* Place the segments with a list of load areas behind the others, the
+    ** largest ones first.
+    */
+    for (I = 0; I < CollCount (&AutoSegs); ++I) {
+        PlaceAutoSegment (CollAtUnchecked (&AutoSegs, I));
+    }
+    DoneCollection (&AutoSegs);
 }
 
 
@@ -1801,6 +2026,9 @@ static void ProcessSymbols (void)
 
                 /* Insert the symbol into the table */
                 O65SetExport (O65FmtDesc, Sym->Name);
+
+                /* The code for the symbol must not be removed */
+                GCKeepSymbol (Sym->Name);
                 break;
 
             case CfgSymO65Import:
@@ -1848,21 +2076,73 @@ static void ProcessSymbols (void)
 
 
 
+static Export* ReuseLayoutExport (void)
+/* If the segments were placed before, return the next export defined at that
+** time with its value removed. Otherwise return NULL.
+*/
+{
+    Export* E;
+
+    if (LayoutIndex >= CollCount (&LayoutExports)) {
+        return 0;
+    }
+    E = CollAtUnchecked (&LayoutExports, LayoutIndex++);
+    FreeExpr (E->Expr);
+    return E;
+}
+
+
+
+static void AddLayoutExport (Export* E, LineInfo* LI)
+/* Remember a new export for the placement of the segments */
+{
+    CollAppend (&E->DefLines, LI);
+    CollAppend (&LayoutExports, E);
+    ++LayoutIndex;
+}
+
+
+
+static void DefConstExport (unsigned Name, long Value, LineInfo* LI)
+/* Define an export with a constant value for the placement of the segments */
+{
+    Export* E = ReuseLayoutExport ();
+    if (E) {
+        E->Expr = LiteralExpr (Value, 0);
+    } else {
+        AddLayoutExport (CreateConstExport (Name, Value), LI);
+    }
+}
+
+
+
+static void DefMemoryExport (unsigned Name, MemoryArea* Mem, unsigned long Offs, LineInfo* LI)
+/* Define an export for an offset into a memory area for the placement of the
+** segments.
+*/
+{
+    Export* E = ReuseLayoutExport ();
+    if (E) {
+        E->Expr = MemoryExpr (Mem, Offs, 0);
+    } else {
+        AddLayoutExport (CreateMemoryExport (Name, Mem, Offs), LI);
+    }
+}
+
+
+
 static void CreateRunDefines (SegDesc* S, unsigned long SegAddr)
 /* Create the defines for a RUN segment */
 {
-    Export* E;
     StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
     /* Define the run address of the segment */
     SB_Printf (&Buf, "__%s_RUN__", GetString (S->Name));
-    E = CreateMemoryExport (GetStrBufId (&Buf), S->Run, SegAddr - S->Run->Start);
-    CollAppend (&E->DefLines, S->LI);
+    DefMemoryExport (GetStrBufId (&Buf), S->Run, SegAddr - S->Run->Start, S->LI);
 
     /* Define the size of the segment */
     SB_Printf (&Buf, "__%s_SIZE__", GetString (S->Name));
-    E = CreateConstExport (GetStrBufId (&Buf), S->Seg->Size);
-    CollAppend (&E->DefLines, S->LI);
+    DefConstExport (GetStrBufId (&Buf), S->Seg->Size, S->LI);
 
     S->Flags |= SF_RUN_DEF;
     SB_Done (&Buf);
@@ -1873,13 +2153,11 @@ static void CreateRunDefines (SegDesc* S, unsigned long SegAddr)
 static void CreateLoadDefines (SegDesc* S, unsigned long SegAddr)
 /* Create the defines for a LOAD segment */
 {
-    Export* E;
     StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
     /* Define the load address of the segment */
     SB_Printf (&Buf, "__%s_LOAD__", GetString (S->Name));
-    E = CreateMemoryExport (GetStrBufId (&Buf), S->Load, SegAddr - S->Load->Start);
-    CollAppend (&E->DefLines, S->LI);
+    DefMemoryExport (GetStrBufId (&Buf), S->Load, SegAddr - S->Load->Start, S->LI);
 
     S->Flags |= SF_LOAD_DEF;
     SB_Done (&Buf);
@@ -1887,25 +2165,30 @@ static void CreateLoadDefines (SegDesc* S, unsigned long SegAddr)
 
 
 
-unsigned CfgProcess (void)
-/* Process the config file, after reading in object files and libraries. This
-** includes postprocessing of the config file data; but also assigning segments,
-** and defining segment/memory-area related symbols. The function will return
-** the number of memory area overflows (so, zero means everything went OK).
-** In case of overflows, a short mapfile can be generated later, to ease the
-** user's task of re-arranging segments.
+static unsigned PlaceSegments (int Final)
+/* Assign the start addresses of the segments, and define the symbols for the
+** segments and memory areas. Warnings are output only if Final is true. The
+** function returns the number of memory area overflows.
 */
 {
     unsigned Overflows = 0;
     unsigned I;
 
-    /* Postprocess symbols. We must do that first, since weak symbols are
-    ** defined here, which may be needed later.
-    */
-    ProcessSymbols ();
-
-    /* Postprocess segments */
-    ProcessSegments ();
+    /* The segments may have been placed before, so start from scratch */
+    LayoutIndex = 0;
+    for (I = 0; I < CollCount (&FileList); ++I) {
+        File* F = CollAtUnchecked (&FileList, I);
+        F->Size = 0;
+    }
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+        M->FillLevel = 0;
+        M->Flags &= ~(MF_PLACED | MF_OVERFLOW);
+    }
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        S->Flags &= ~(SF_RUN_DEF | SF_LOAD_DEF);
+    }
 
     /* Walk through each of the memory sections. Add up the sizes; and, check
     ** for an overflow of the section. Assign the start addresses of the
@@ -1941,13 +2224,11 @@ unsigned CfgProcess (void)
         ** may reference this symbol.
         */
         if (M->Flags & MF_DEFINE) {
-            Export* E;
             StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
             /* Define the start of the memory area */
             SB_Printf (&Buf, "__%s_START__", GetString (M->Name));
-            E = CreateMemoryExport (GetStrBufId (&Buf), M, 0);
-            CollAppend (&E->DefLines, M->LI);
+            DefMemoryExport (GetStrBufId (&Buf), M, 0, M->LI);
 
             SB_Done (&Buf);
         }
@@ -2014,7 +2295,7 @@ unsigned CfgProcess (void)
                 unsigned long AlignedBy = (S->Flags & SF_START) ? S->Addr
                     : (S->Flags & SF_OFFSET) ? (S->Addr + M->Start)
                     : S->RunAlignment;
-                if ((AlignedBy % S->Seg->Alignment) != 0) {
+                if (Final && (AlignedBy % S->Seg->Alignment) != 0) {
                     /* Segment requires another alignment than configured
                     ** in the linker.
                     */
@@ -2032,7 +2313,7 @@ unsigned CfgProcess (void)
                     ** fill bytes for the alignment, emit a warning, since
                     ** that is somewhat suspicious.
                     */
-                    if (M->FillLevel == 0 && NewAddr > Addr) {
+                    if (Final && M->FillLevel == 0 && NewAddr > Addr) {
                         PWarning (GetSourcePos (S->LI),
                                   "The first segment in memory area `%s' "
                                   "needs %lu fill bytes for alignment.",
@@ -2064,7 +2345,9 @@ unsigned CfgProcess (void)
                         if (NewAddr < Addr) {
                             /* Offset already too large */
                             ++Overflows;
-                            if (S->Flags & SF_OFFSET) {
+                            if (!Final) {
+                                /* Warn only once */
+                            } else if (S->Flags & SF_OFFSET) {
                                 PWarning (
                                     GetSourcePos (S->LI),
                                     "Segment `%s' offset is too small in `%s' by %lu byte%s",
@@ -2125,14 +2408,16 @@ unsigned CfgProcess (void)
             if (FillLevel > M->Size && (M->Flags & MF_OVERFLOW) == 0) {
                 ++Overflows;
                 M->Flags |= MF_OVERFLOW;
-                PWarning (
-                    GetSourcePos (M->LI),
-                    "Segment `%s' overflows memory area `%s' by %lu byte%s",
-                    GetString (S->Name),
-                    GetString (M->Name),
-                    FillLevel - M->Size,
-                    (FillLevel - M->Size == 1) ? "" : "s"
-                );
+                if (Final) {
+                    PWarning (
+                        GetSourcePos (M->LI),
+                        "Segment `%s' overflows memory area `%s' by %lu byte%s",
+                        GetString (S->Name),
+                        GetString (M->Name),
+                        FillLevel - M->Size,
+                        (FillLevel - M->Size == 1) ? "" : "s"
+                    );
+                }
             }
             if (FillLevel > M->FillLevel) {
                 /* Regular segments increase FillLevel. Overwrite segments may
@@ -2176,26 +2461,22 @@ unsigned CfgProcess (void)
         ** memory area
         */
         if (M->Flags & MF_DEFINE) {
-            Export* E;
             StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
             /* Define the size of the memory area */
             SB_Printf (&Buf, "__%s_SIZE__", GetString (M->Name));
-            E = CreateConstExport (GetStrBufId (&Buf), M->Size);
-            CollAppend (&E->DefLines, M->LI);
+            DefConstExport (GetStrBufId (&Buf), M->Size, M->LI);
 
             /* Define the fill level of the memory area */
             SB_Printf (&Buf, "__%s_LAST__", GetString (M->Name));
-            E = CreateMemoryExport (GetStrBufId (&Buf), M, M->FillLevel);
-            CollAppend (&E->DefLines, M->LI);
+            DefMemoryExport (GetStrBufId (&Buf), M, M->FillLevel, M->LI);
 
             /* Define the file offset of the memory area. This isn't of much
             ** use for relocatable output files.
             */
             if (!M->Relocatable) {
                 SB_Printf (&Buf, "__%s_FILEOFFS__", GetString (M->Name));
-                E = CreateConstExport (GetStrBufId (&Buf), M->FileOffs);
-                CollAppend (&E->DefLines, M->LI);
+                DefConstExport (GetStrBufId (&Buf), M->FileOffs, M->LI);
             }
 
             /* Throw away the string buffer */
@@ -2216,6 +2497,48 @@ unsigned CfgProcess (void)
 
 
 
+unsigned CfgProcess (void)
+/* Process the config file, after reading in object files and libraries. This
+** includes postprocessing of the config file data; but also assigning segments,
+** and defining segment/memory-area related symbols. The function will return
+** the number of memory area overflows (so, zero means everything went OK).
+** In case of overflows, a short mapfile can be generated later, to ease the
+** user's task of re-arranging segments.
+*/
+{
+    /* Postprocess symbols. We must do that first, since weak symbols are
+    ** defined here, which may be needed later.
+    */
+    ProcessSymbols ();
+
+    /* Remove unused sections if requested. This must be done before the
+    ** segments are placed, but after the symbols were processed, since o65
+    ** exports must be kept.
+    */
+    if (GCSections) {
+        GCRemoveSections ();
+    }
+
+    /* Postprocess segments */
+    ProcessSegments ();
+
+    /* If requested, choose the size of the instructions relaxed by the
+    ** linker. Since this depends on the addresses, the segments are placed
+    ** until no instruction changes its size.
+    */
+    if (RelaxCode) {
+        RelaxStart ();
+        do {
+            PlaceSegments (0);
+        } while (RelaxSections ());
+    }
+
+    /* Place the segments for the output */
+    return PlaceSegments (1);
+}
+
+
+
 void CfgWriteTarget (void)
 /* Write the target file(s) */
 {
@@ -2287,3 +2610,82 @@ void CfgWriteTarget (void)
         }
     }
 }
+
+
+
+unsigned CfgAutoSegmentCount (void)
+/* Return the number of segments whose load area was chosen by the linker */
+{
+    unsigned I;
+    unsigned Count = 0;
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        const SegDesc* S = CollConstAt (&SegDescList, I);
+        if (S->Flags & SF_AUTO) {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+
+
+void CfgPrintSegmentPlacement (FILE* F)
+/* Print the memory areas chosen for the segments to the given file */
+{
+    unsigned I, J;
+
+    /* Print a header */
+    fprintf (F, "Name                  Load area         Choices\n"
+                "----------------------------------------------------\n");
+
+    /* Print the segments placed by the linker */
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+
+        /* Get the segment */
+        const SegDesc* S = CollConstAt (&SegDescList, I);
+        if ((S->Flags & SF_AUTO) == 0) {
+            continue;
+        }
+
+        /* Print the chosen area followed by the list from the config */
+        fprintf (F, "%-20s  %-16s ", GetString (S->Name), GetString (S->Load->Name));
+        for (J = 0; J < CollCount (&S->LoadAreas); ++J) {
+            const MemoryArea* M = CollConstAt (&S->LoadAreas, J);
+            fprintf (F, (J == 0)? " %s" : ", %s", GetString (M->Name));
+        }
+        fputc ('\n', F);
+    }
+}
+
+
+
+int CfgCanPatchTarget (void)
+/* Return true if parts of the target files may be written again without
+** writing the complete files. This is the case if all files are in binary
+** format, and there are no overwrite segments.
+*/
+{
+    unsigned I;
+
+    /* Check the format of the files */
+    for (I = 0; I < CollCount (&FileList); ++I) {
+        const File* F = CollConstAt (&FileList, I);
+        unsigned Format = (F->Format == BINFMT_DEFAULT)? DefaultBinFmt : F->Format;
+        if (CollCount (&F->MemoryAreas) > 0   &&
+            SB_GetLen (GetStrBuf (F->Name)) > 0 &&
+            Format != BINFMT_BINARY) {
+            return 0;
+        }
+    }
+
+    /* Check for overwrite segments */
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        const SegDesc* S = CollConstAt (&SegDescList, I);
+        if (S->Flags & SF_OVERWRITE) {
+            return 0;
+        }
+    }
+
+    /* Patching is possible */
+    return 1;
+}
@@ -81,6 +81,7 @@ struct SegDesc {
     unsigned long       Addr;           /* Start address or offset into segment */
     unsigned long       RunAlignment;   /* Run area alignment if given */
     unsigned long       LoadAlignment;  /* Load area alignment if given */
+    Collection          LoadAreas;      /* Load areas the linker chooses from */
 };
 
 /* Segment flags */
@@ -97,6 +98,8 @@ struct SegDesc {
 #define SF_LOAD_DEF     0x0400          /* LOAD symbols already defined */
 #define SF_FILLVAL      0x0800          /* Segment has separate fill value */
 #define SF_OVERWRITE    0x1000          /* Segment can overwrite (part of) another one */
+#define SF_AUTO         0x2000          /* Load area is chosen by the linker */
+#define SF_AUTO_RUN     0x4000          /* Run area is the chosen load area */
 
 
 
@@ -121,6 +124,21 @@ unsigned CfgProcess (void);
 void CfgWriteTarget (void);
 /* Write the target file(s) */
 
+int CfgCanPatchTarget (void);
+/* Return true if parts of the target files may be written again without
+** writing the complete files. This is the case if all files are in binary
+** format, and there are no overwrite segments.
+*/
+
+struct MemoryArea* CfgFindMemory (unsigned Name);
+/* Find the memory area with the given name. Return NULL if not found */
+
+unsigned CfgAutoSegmentCount (void);
+/* Return the number of segments whose load area was chosen by the linker */
+
+void CfgPrintSegmentPlacement (FILE* F);
+/* Print the memory areas chosen for the segments to the given file */
+
 
 
 /* End of config.h */
@@ -59,18 +59,19 @@
 
 
 static void AssignIds (void)
-/* Assign the base ids for debug info output. Within each module, many of the
+/* Assign the ids for debug info output. Within each module, many of the
 ** items are addressed by ids which are actually the indices of the items in
-** the collections. To make them unique, we must assign a unique base to each
-** range.
+** the collections. To make them unique, each item gets an id that counts
+** the items of its kind over all modules. Items of code removed by
+** --gc-sections don't get an id, and are not output.
 */
 {
     /* Walk over all modules */
     unsigned I;
-    unsigned HLLSymBaseId = 0;
-    unsigned ScopeBaseId  = 0;
-    unsigned SpanBaseId   = 0;
-    unsigned SymBaseId    = 0;
+    unsigned HLLSymId = 0;
+    unsigned ScopeId  = 0;
+    unsigned SpanId   = 0;
+    unsigned SymId    = 0;
     for (I = 0; I < CollCount (&ObjDataList); ++I) {
 
         /* Get this module */
@@ -79,17 +80,19 @@ static void AssignIds (void)
         /* Assign the module id */
         O->Id = I;
 
-        /* Assign base ids */
-        O->HLLSymBaseId = HLLSymBaseId;
-        O->ScopeBaseId  = ScopeBaseId;
-        O->SpanBaseId   = SpanBaseId;
-        O->SymBaseId    = SymBaseId;
-
-        /* Bump the base ids */
-        HLLSymBaseId  += CollCount (&O->HLLDbgSyms);
-        ScopeBaseId   += CollCount (&O->Scopes);
-        SpanBaseId    += CollCount (&O->Spans);
-        SymBaseId     += CollCount (&O->DbgSyms);
+        /* Assign the ids of the items. Whether an item is removed depends on
+        ** the items it belongs to, so the order is important.
+        */
+        SpanId   = AssignSpanDbgIds (O, SpanId);
+        ScopeId  = AssignScopeDbgIds (O, ScopeId);
+        SymId    = AssignDbgSymDbgIds (O, SymId);
+        HLLSymId = AssignHLLDbgSymDbgIds (O, HLLSymId);
+
+        /* Assign the type ids. The hll debug symbols come first, since they
+        ** are read before the spans.
+        */
+        AssignHLLDbgSymTypeIds (O);
+        AssignSpanTypeIds (O);
     }
 
     /* Assign the ids to the file infos */
@@ -38,6 +38,19 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Debug info id of items that are not written to the debug file, because
+** they belong to sections removed by --gc-sections.
+*/
+#define INVALID_DBG_ID  (~0U)
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
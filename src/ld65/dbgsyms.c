@@ -44,14 +44,17 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "exports.h"
 #include "expr.h"
 #include "fileio.h"
+#include "gc.h"
 #include "global.h"
 #include "lineinfo.h"
 #include "objdata.h"
+#include "scopes.h"
 #include "spool.h"
 #include "tpool.h"
 
@@ -77,6 +80,7 @@ struct DbgSym {
     unsigned            Name;           /* Name */
     unsigned short      Type;           /* Type of symbol */
     unsigned short      AddrSize;       /* Address size of symbol */
+    unsigned            DbgId;          /* Id in the debug info file */
 };
 
 /* Structure used for a high level language function or symbol */
@@ -86,8 +90,10 @@ struct HLLDbgSym {
     unsigned            Name;           /* String id of name */
     DbgSym*             Sym;            /* Assembler symbol */
     int                 Offs;           /* Offset if any */
-    unsigned            Type;           /* String id of type */
+    unsigned            TypeName;       /* String id of type */
+    unsigned            Type;           /* Type id, see AssignHLLDbgSymTypeIds */
     unsigned            ScopeId;        /* Parent scope */
+    unsigned            DbgId;          /* Id in the debug info file */
 };
 
 /* We will collect all debug symbols in the following array and remove
@@ -123,6 +129,7 @@ static DbgSym* NewDbgSym (unsigned Id, unsigned Type, unsigned char AddrSize,
     D->Name       = 0;
     D->Type       = Type;
     D->AddrSize   = AddrSize;
+    D->DbgId      = INVALID_DBG_ID;
 
     /* Return the new entry */
     return D;
@@ -185,7 +192,7 @@ static void InsertDbgSym (DbgSym* D, long Val)
 
 
 
-DbgSym* ReadDbgSym (FILE* F, ObjData* O, unsigned Id)
+DbgSym* ReadDbgSym (InFile* F, ObjData* O, unsigned Id)
 /* Read a debug symbol from a file, insert and return it */
 {
     /* Read the type and address size */
@@ -236,7 +243,7 @@ DbgSym* ReadDbgSym (FILE* F, ObjData* O, unsigned Id)
 
 
 
-HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* O, unsigned Id attribute ((unused)))
+HLLDbgSym* ReadHLLDbgSym (InFile* F, ObjData* O, unsigned Id attribute ((unused)))
 /* Read a hll debug symbol from a file, insert and return it */
 {
     unsigned SC;
@@ -259,8 +266,10 @@ HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* O, unsigned Id attribute ((unused)))
     } else {
         S->Offs = 0;
     }
-    S->Type     = GetTypeId (GetObjString (O, ReadVar (F)));
+    S->TypeName = MakeGlobalStringId (O, ReadVar (F));
+    S->Type     = INVALID_TYPE_ID;
     S->ScopeId  = ReadVar (F);
+    S->DbgId    = INVALID_DBG_ID;
 
     /* Return the (now initialized) hll debug symbol */
     return S;
@@ -311,10 +320,10 @@ static void PrintLineInfo (FILE* F, const Collection* LineInfos, const char* For
 
 
 unsigned DbgSymCount (void)
-/* Return the total number of debug symbols */
+/* Return the total number of debug symbols written to the debug info file */
 {
     /* Walk over all object files */
-    unsigned I;
+    unsigned I, J;
     unsigned Count = 0;
     for (I = 0; I < CollCount (&ObjDataList); ++I) {
 
@@ -322,7 +331,12 @@ unsigned DbgSymCount (void)
         const ObjData* O = CollAtUnchecked (&ObjDataList, I);
 
         /* Count debug symbols */
-        Count += CollCount (&O->DbgSyms);
+        for (J = 0; J < CollCount (&O->DbgSyms); ++J) {
+            const DbgSym* D = CollConstAt (&O->DbgSyms, J);
+            if (D->DbgId != INVALID_DBG_ID) {
+                ++Count;
+            }
+        }
     }
     return Count;
 }
@@ -330,10 +344,12 @@ unsigned DbgSymCount (void)
 
 
 unsigned HLLDbgSymCount (void)
-/* Return the total number of high level language debug symbols */
+/* Return the total number of high level language debug symbols written to
+** the debug info file.
+*/
 {
     /* Walk over all object files */
-    unsigned I;
+    unsigned I, J;
     unsigned Count = 0;
     for (I = 0; I < CollCount (&ObjDataList); ++I) {
 
@@ -341,13 +357,97 @@ unsigned HLLDbgSymCount (void)
         const ObjData* O = CollAtUnchecked (&ObjDataList, I);
 
         /* Count debug symbols */
-        Count += CollCount (&O->HLLDbgSyms);
+        for (J = 0; J < CollCount (&O->HLLDbgSyms); ++J) {
+            const HLLDbgSym* S = CollConstAt (&O->HLLDbgSyms, J);
+            if (S->DbgId != INVALID_DBG_ID) {
+                ++Count;
+            }
+        }
     }
     return Count;
 }
 
 
 
+static int DbgSymIsRemoved (const ObjData* O, const DbgSym* D)
+/* Return true if the debug symbol isn't written to the debug info file */
+{
+    /* Symbols with a value in a removed section are removed */
+    if (D->Expr != 0 && GCIsRemoved (D->Expr)) {
+        return 1;
+    }
+
+    /* So are symbols in a removed scope, and cheap locals of a removed
+    ** symbol.
+    */
+    if (SYM_IS_STD (D->Type)) {
+        return GetScopeDbgId (O, D->OwnerId) == INVALID_DBG_ID;
+    } else {
+        return DbgSymIsRemoved (O, GetObjDbgSym (O, D->OwnerId));
+    }
+}
+
+
+
+unsigned AssignDbgSymDbgIds (ObjData* O, unsigned Id)
+/* Assign the debug info ids to the debug symbols of the given module,
+** starting with Id, and return the next free id. Symbols of code removed by
+** --gc-sections don't get an id. The ids of the scopes must have been
+** assigned before.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->DbgSyms); ++I) {
+        DbgSym* D = CollAtUnchecked (&O->DbgSyms, I);
+        if (DbgSymIsRemoved (O, D)) {
+            D->DbgId = INVALID_DBG_ID;
+        } else {
+            D->DbgId = Id++;
+        }
+    }
+    return Id;
+}
+
+
+
+unsigned GetDbgSymDbgId (const ObjData* O, unsigned Id)
+/* Return the debug info id of the debug symbol with the given id in the
+** module, or INVALID_DBG_ID if it is not written to the debug info file.
+*/
+{
+    const DbgSym* D;
+    if (Id >= CollCount (&O->DbgSyms)) {
+        Error ("Invalid debug symbol index (%u) in module `%s'",
+               Id, GetObjFileName (O));
+    }
+    D = CollConstAt (&O->DbgSyms, Id);
+    return D->DbgId;
+}
+
+
+
+unsigned AssignHLLDbgSymDbgIds (ObjData* O, unsigned Id)
+/* Assign the debug info ids to the hll debug symbols of the given module,
+** starting with Id, and return the next free id. Symbols in removed scopes
+** or attached to removed debug symbols don't get an id. The ids of the scopes
+** and debug symbols must have been assigned before.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->HLLDbgSyms); ++I) {
+        HLLDbgSym* S = CollAtUnchecked (&O->HLLDbgSyms, I);
+        if (GetScopeDbgId (O, S->ScopeId) == INVALID_DBG_ID ||
+            (HLL_HAS_SYM (S->Flags) && S->Sym->DbgId == INVALID_DBG_ID)) {
+            S->DbgId = INVALID_DBG_ID;
+        } else {
+            S->DbgId = Id++;
+        }
+    }
+    return Id;
+}
+
+
+
 void PrintDbgSyms (FILE* F)
 /* Print the debug symbols in a debug file */
 {
@@ -364,10 +464,15 @@ void PrintDbgSyms (FILE* F)
             /* Get the next debug symbol */
             const DbgSym* S = CollConstAt (&O->DbgSyms, J);
 
+            /* Skip symbols of removed code */
+            if (S->DbgId == INVALID_DBG_ID) {
+                continue;
+            }
+
             /* Emit the base data for the entry */
             fprintf (F,
                      "sym\tid=%u,name=\"%s\",addrsize=%s",
-                     O->SymBaseId + J,
+                     S->DbgId,
                      GetString (S->Name),
                      AddrSizeToStr ((unsigned char) S->AddrSize));
 
@@ -380,9 +485,9 @@ void PrintDbgSyms (FILE* F)
             ** add the owner scope.
             */
             if (SYM_IS_STD (S->Type)) {
-                fprintf (F, ",scope=%u", O->ScopeBaseId + S->OwnerId);
+                fprintf (F, ",scope=%u", GetScopeDbgId (O, S->OwnerId));
             } else {
-                fprintf (F, ",parent=%u", O->SymBaseId + S->OwnerId);
+                fprintf (F, ",parent=%u", GetDbgSymDbgId (O, S->OwnerId));
             }
 
             /* Output line infos */
@@ -406,10 +511,11 @@ void PrintDbgSyms (FILE* F)
 
                 /* If this is not a linker generated symbol, and the module
                 ** that contains the export has debug info, output the debug
-                ** symbol id for the export
+                ** symbol id for the export, unless it was removed.
                 */
-                if (Exp->Obj && OBJ_HAS_DBGINFO (Exp->Obj->Header.Flags)) {
-                    fprintf (F, ",exp=%u", Exp->Obj->SymBaseId + Exp->DbgSymId);
+                if (Exp->Obj && OBJ_HAS_DBGINFO (Exp->Obj->Header.Flags) &&
+                    GetDbgSymDbgId (Exp->Obj, Exp->DbgSymId) != INVALID_DBG_ID) {
+                    fprintf (F, ",exp=%u", GetDbgSymDbgId (Exp->Obj, Exp->DbgSymId));
                 }
 
             } else {
@@ -442,6 +548,21 @@ void PrintDbgSyms (FILE* F)
 
 
 
+void AssignHLLDbgSymTypeIds (ObjData* O)
+/* Assign the type ids of all hll debug symbols in the given module. Must be
+** called for the modules in the order they were added, so the ids don't
+** depend on the order they were read in.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->HLLDbgSyms); ++I) {
+        HLLDbgSym* S = CollAtUnchecked (&O->HLLDbgSyms, I);
+        S->Type = GetTypeId (GetStrBuf (S->TypeName));
+    }
+}
+
+
+
 void PrintHLLDbgSyms (FILE* F)
 /* Print the high level language debug symbols in a debug file */
 {
@@ -461,11 +582,16 @@ void PrintHLLDbgSyms (FILE* F)
             /* Get the storage class */
             unsigned SC = HLL_GET_SC (S->Flags);
 
+            /* Skip symbols of removed code */
+            if (S->DbgId == INVALID_DBG_ID) {
+                continue;
+            }
+
             /* Output the base info */
             fprintf (F, "csym\tid=%u,name=\"%s\",scope=%u,type=%u,sc=",
-                     O->HLLSymBaseId + J,
+                     S->DbgId,
                      GetString (S->Name),
-                     O->ScopeBaseId + S->ScopeId,
+                     GetScopeDbgId (O, S->ScopeId),
                      S->Type);
             switch (SC) {
                 case HLL_SC_AUTO:       fputs ("auto", F);      break;
@@ -484,7 +610,7 @@ void PrintHLLDbgSyms (FILE* F)
 
             /* For non auto symbols output the debug symbol id of the asm sym */
             if (HLL_HAS_SYM (S->Flags)) {
-                fprintf (F, ",sym=%u", O->SymBaseId + S->Sym->Id);
+                fprintf (F, ",sym=%u", S->Sym->DbgId);
             }
 
             /* Terminate the output line */
@@ -522,6 +648,11 @@ void PrintDbgSymLabels (FILE* F)
                 continue;
             }
 
+            /* Ignore labels in sections removed by --gc-sections */
+            if (GCIsRemoved (D->Expr)) {
+                continue;
+            }
+
             /* Get the symbol value */
             Val = GetDbgSymVal (D);
 
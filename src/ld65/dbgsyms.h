@@ -45,6 +45,7 @@
 #include "exprdefs.h"
 
 /* ld65 */
+#include "fileio.h"
 #include "objdata.h"
 
 
@@ -70,20 +71,47 @@ typedef struct DbgSym DbgSym;
 
 
 
-DbgSym* ReadDbgSym (FILE* F, ObjData* Obj, unsigned Id);
+DbgSym* ReadDbgSym (InFile* F, ObjData* Obj, unsigned Id);
 /* Read a debug symbol from a file, insert and return it */
 
-struct HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* Obj, unsigned Id);
+struct HLLDbgSym* ReadHLLDbgSym (InFile* F, ObjData* Obj, unsigned Id);
 /* Read a hll debug symbol from a file, insert and return it */
 
 void PrintDbgSyms (FILE* F);
 /* Print the debug symbols in a debug file */
 
 unsigned DbgSymCount (void);
-/* Return the total number of debug symbols */
+/* Return the total number of debug symbols written to the debug info file */
 
 unsigned HLLDbgSymCount (void);
-/* Return the total number of high level language debug symbols */
+/* Return the total number of high level language debug symbols written to
+** the debug info file.
+*/
+
+unsigned AssignDbgSymDbgIds (ObjData* O, unsigned Id);
+/* Assign the debug info ids to the debug symbols of the given module,
+** starting with Id, and return the next free id. Symbols of code removed by
+** --gc-sections don't get an id. The ids of the scopes must have been
+** assigned before.
+*/
+
+unsigned GetDbgSymDbgId (const ObjData* O, unsigned Id);
+/* Return the debug info id of the debug symbol with the given id in the
+** module, or INVALID_DBG_ID if it is not written to the debug info file.
+*/
+
+unsigned AssignHLLDbgSymDbgIds (ObjData* O, unsigned Id);
+/* Assign the debug info ids to the hll debug symbols of the given module,
+** starting with Id, and return the next free id. Symbols in removed scopes
+** or attached to removed debug symbols don't get an id. The ids of the scopes
+** and debug symbols must have been assigned before.
+*/
+
+void AssignHLLDbgSymTypeIds (ObjData* O);
+/* Assign the type ids of all hll debug symbols in the given module. Must be
+** called for the modules in the order they were added, so the ids don't
+** depend on the order they were read in.
+*/
 
 void PrintHLLDbgSyms (FILE* F);
 /* Print the high level language debug symbols in a debug file */
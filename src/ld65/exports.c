@@ -52,6 +52,7 @@
 #include "exports.h"
 #include "expr.h"
 #include "fileio.h"
+#include "gc.h"
 #include "global.h"
 #include "lineinfo.h"
 #include "memarea.h"
@@ -66,10 +67,19 @@
 
 
 
-/* Hash table */
-#define HASHTAB_MASK    0x0FFFU
-#define HASHTAB_SIZE    (HASHTAB_MASK + 1)
-static Export*          HashTab[HASHTAB_SIZE];
+/* Slot in the export hash table */
+typedef struct ExpSlot ExpSlot;
+struct ExpSlot {
+    unsigned            Hash;           /* Hash of the name */
+    Export*             Exp;            /* Export, NULL if the slot is free */
+};
+
+/* Hash table with open addressing. The size is a power of two and the table
+** is grown before it gets more than three quarters full.
+*/
+#define HASHTAB_MINSIZE 4096U
+static unsigned         HashSize = 0;           /* Number of slots */
+static ExpSlot*         HashTab  = 0;           /* Slots */
 
 /* Import management variables */
 static unsigned         ImpCount = 0;           /* Import count */
@@ -79,6 +89,12 @@ static unsigned         ImpOpen  = 0;           /* Count of open imports */
 static unsigned         ExpCount = 0;           /* Export count */
 static Export**         ExpPool  = 0;           /* Exports array */
 
+/* Cache for the values of exports. A cached value is valid if it was computed
+** in the current generation while the cache was enabled.
+*/
+static unsigned         ValCacheGen     = 0;
+static int              ValCacheEnabled = 0;
+
 /* Defines for the flags in Import */
 #define IMP_INLIST      0x0001U                 /* Import is in exports list */
 
@@ -88,6 +104,78 @@ static Export**         ExpPool  = 0;           /* Exports array */
 
 
 
+/*****************************************************************************/
+/*                                Hash table                                 */
+/*****************************************************************************/
+
+
+
+static ExpSlot* FindSlot (unsigned Name, unsigned Hash)
+/* Return the slot holding the export with the given name and hash, or the
+** free slot where it would have to be inserted.
+*/
+{
+    unsigned Mask = HashSize - 1;
+    unsigned I    = Hash & Mask;
+    while (1) {
+        ExpSlot* S = HashTab + I;
+        if (S->Exp == 0 || (S->Hash == Hash && S->Exp->Name == Name)) {
+            return S;
+        }
+        I = (I + 1) & Mask;
+    }
+}
+
+
+
+static void GrowHashTab (void)
+/* Make room for one more entry in the hash table if needed */
+{
+    unsigned OldSize = HashSize;
+    ExpSlot* OldTab  = HashTab;
+    unsigned I;
+
+    /* Nothing to do if the table is less than three quarters full after
+    ** adding another entry.
+    */
+    if ((ExpCount + 1) * 4 <= HashSize * 3) {
+        return;
+    }
+
+    /* Allocate the new table */
+    HashSize = (OldSize == 0)? HASHTAB_MINSIZE : OldSize * 2;
+    HashTab  = xmalloc (HashSize * sizeof (ExpSlot));
+    for (I = 0; I < HashSize; ++I) {
+        HashTab[I].Exp = 0;
+    }
+
+    /* Move the entries over */
+    for (I = 0; I < OldSize; ++I) {
+        if (OldTab[I].Exp) {
+            *FindSlot (OldTab[I].Exp->Name, OldTab[I].Hash) = OldTab[I];
+        }
+    }
+    xfree (OldTab);
+}
+
+
+
+static ExpSlot* GetSlot (unsigned Name)
+/* Return the slot for the given name. If there's no export with this name,
+** the slot is free and the caller must insert one.
+*/
+{
+    unsigned Hash = HashInt (Name);
+    ExpSlot* S;
+
+    GrowHashTab ();
+    S = FindSlot (Name, Hash);
+    S->Hash = Hash;
+    return S;
+}
+
+
+
 /*****************************************************************************/
 /*                              Import handling                              */
 /*****************************************************************************/
@@ -141,7 +229,7 @@ void FreeImport (Import* I)
 
 
 
-Import* ReadImport (FILE* F, ObjData* Obj)
+Import* ReadImport (InFile* F, ObjData* Obj)
 /* Read an import from a file and return it */
 {
     Import* I;
@@ -219,32 +307,14 @@ Import* InsertImport (Import* I)
     /* As long as the import is not inserted, V.Name is valid */
     unsigned Name = I->Name;
 
-    /* Create a hash value for the given name */
-    unsigned Hash = (Name & HASHTAB_MASK);
-
-    /* Search through the list in that slot for a symbol with that name */
-    if (HashTab[Hash] == 0) {
-        /* The slot is empty, we need to insert a dummy export */
-        E = HashTab[Hash] = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
+    /* Search for an export with that name */
+    ExpSlot* S = GetSlot (Name);
+    if (S->Exp == 0) {
+        /* There's none, we need to insert a dummy export */
+        S->Exp = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
         ++ExpCount;
-    } else {
-        E = HashTab [Hash];
-        while (1) {
-            if (E->Name == Name) {
-                /* We have an entry, L points to it */
-                break;
-            }
-            if (E->Next == 0) {
-                /* End of list an entry not found, insert a dummy */
-                E->Next = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
-                E = E->Next;            /* Point to dummy */
-                ++ExpCount;             /* One export more */
-                break;
-            } else {
-                E = E->Next;
-            }
-        }
     }
+    E = S->Exp;
 
     /* Ok, E now points to a valid exports entry for the given import. Insert
     ** the import into the imports list and update the counters.
@@ -298,7 +368,6 @@ static Export* NewExport (unsigned Type, unsigned char AddrSize,
 
     /* Initialize the fields */
     E->Name      = Name;
-    E->Next      = 0;
     E->Flags     = 0;
     E->Obj       = Obj;
     E->ImpCount  = 0;
@@ -308,6 +377,8 @@ static Export* NewExport (unsigned Type, unsigned char AddrSize,
     E->DefLines  = EmptyCollection;
     E->RefLines  = EmptyCollection;
     E->DbgSymId  = ~0U;
+    E->ValGen    = 0;
+    E->Val       = 0;
     E->Type      = Type | SYM_EXPORT;
     E->AddrSize  = AddrSize;
     for (I = 0; I < sizeof (E->ConDes) / sizeof (E->ConDes[0]); ++I) {
@@ -342,7 +413,7 @@ void FreeExport (Export* E)
 
 
 
-Export* ReadExport (FILE* F, ObjData* O)
+Export* ReadExport (InFile* F, ObjData* O)
 /* Read an export from a file */
 {
     unsigned    ConDesCount;
@@ -431,10 +502,9 @@ Export* ReadExport (FILE* F, ObjData* O)
 void InsertExport (Export* E)
 /* Insert an exported identifier and check if it's already in the list */
 {
-    Export* L;
-    Export* Last;
-    Import* Imp;
-    unsigned Hash;
+    Export*  L;
+    Import*  Imp;
+    ExpSlot* S;
 
     /* Mark the export as inserted */
     E->Flags |= EXP_INLIST;
@@ -444,59 +514,33 @@ void InsertExport (Export* E)
         ConDesAddExport (E);
     }
 
-    /* Create a hash value for the given name */
-    Hash = (E->Name & HASHTAB_MASK);
-
-    /* Search through the list in that slot */
-    if (HashTab[Hash] == 0) {
-        /* The slot is empty */
-        HashTab[Hash] = E;
-        ++ExpCount;
-    } else {
-
-        Last = 0;
-        L = HashTab[Hash];
-        do {
-            if (L->Name == E->Name) {
-                /* This may be an unresolved external */
-                if (L->Expr == 0) {
-
-                    /* This *is* an unresolved external. Use the actual export
-                    ** in E instead of the dummy one in L.
-                    */
-                    E->Next     = L->Next;
-                    E->ImpCount = L->ImpCount;
-                    E->ImpList  = L->ImpList;
-                    if (Last) {
-                        Last->Next = E;
-                    } else {
-                        HashTab[Hash] = E;
-                    }
-                    ImpOpen -= E->ImpCount;     /* Decrease open imports now */
-                    xfree (L);
-                    /* We must run through the import list and change the
-                    ** export pointer now.
-                    */
-                    Imp = E->ImpList;
-                    while (Imp) {
-                        Imp->Exp = E;
-                        Imp = Imp->Next;
-                    }
-                } else if (AllowMultDef == 0) {
-                    /* Duplicate entry, this is fatal unless allowed by the user */
-                    Error ("Duplicate external identifier: `%s'",
-                           GetString (L->Name));
-                }
-                return;
-            }
-            Last = L;
-            L = L->Next;
-
-        } while (L);
-
-        /* Insert export at end of queue */
-        Last->Next = E;
+    /* Search for an export with that name */
+    S = GetSlot (E->Name);
+    L = S->Exp;
+    if (L == 0) {
+        /* The name is new */
+        S->Exp = E;
         ++ExpCount;
+    } else if (L->Expr == 0) {
+        /* This is an unresolved external. Use the actual export in E instead
+        ** of the dummy one in L.
+        */
+        E->ImpCount = L->ImpCount;
+        E->ImpList  = L->ImpList;
+        S->Exp      = E;
+        ImpOpen -= E->ImpCount;     /* Decrease open imports now */
+        xfree (L);
+        /* We must run through the import list and change the export pointer
+        ** now.
+        */
+        Imp = E->ImpList;
+        while (Imp) {
+            Imp->Exp = E;
+            Imp = Imp->Next;
+        }
+    } else if (AllowMultDef == 0) {
+        /* Duplicate entry, this is fatal unless allowed by the user */
+        Error ("Duplicate external identifier: `%s'", GetString (L->Name));
     }
 }
 
@@ -610,19 +654,13 @@ Export* FindExport (unsigned Name)
 ** return a pointer to the export.
 */
 {
-    /* Get a pointer to the list with the symbols hash value */
-    Export* L = HashTab[Name & HASHTAB_MASK];
-    while (L) {
-        /* Search through the list in that slot */
-        if (L->Name == Name) {
-            /* Entry found */
-            return L;
-        }
-        L = L->Next;
+    /* Without a table there are no exports */
+    if (HashTab == 0) {
+        return 0;
     }
 
-    /* Not found */
-    return 0;
+    /* Search for the name, the slot is free if it's not there */
+    return FindSlot (Name, HashInt (Name))->Exp;
 }
 
 
@@ -645,6 +683,36 @@ int IsUnresolvedExport (const Export* E)
 
 
 
+void WalkUnresolved (void (*F) (unsigned Name))
+/* Call F with the name of each export that is currently unresolved */
+{
+    unsigned I;
+
+    for (I = 0; I < HashSize; ++I) {
+        const Export* E = HashTab[I].Exp;
+        if (E && E->Expr == 0) {
+            F (E->Name);
+        }
+    }
+}
+
+
+
+void WalkExports (void (*F) (Export* E))
+/* Call F for each export */
+{
+    unsigned I;
+
+    for (I = 0; I < HashSize; ++I) {
+        Export* E = HashTab[I].Exp;
+        if (E) {
+            F (E);
+        }
+    }
+}
+
+
+
 int IsConstExport (const Export* E)
 /* Return true if the expression associated with this export is const */
 {
@@ -658,14 +726,47 @@ int IsConstExport (const Export* E)
 
 
 
-long GetExportVal (const Export* E)
-/* Get the value of this export */
+long GetExportVal (Export* E)
+/* Get the value of this export. While the value cache is enabled, the value
+** is computed only once.
+*/
 {
     if (E->Expr == 0) {
         /* OOPS */
         Internal ("`%s' is an undefined external", GetString (E->Name));
     }
-    return GetExprVal (E->Expr);
+    if (!ValCacheEnabled) {
+        return GetExprVal (E->Expr);
+    }
+    if (E->ValGen != ValCacheGen) {
+        /* The value is stored after it was computed, so a circular reference
+        ** is still detected by the caller.
+        */
+        E->Val    = GetExprVal (E->Expr);
+        E->ValGen = ValCacheGen;
+    }
+    return E->Val;
+}
+
+
+
+void EnableExportValCache (void)
+/* Cache the values of the exports from now on. Values cached before are
+** discarded. Must be called only while the segments are not moved.
+*/
+{
+    ++ValCacheGen;
+    ValCacheEnabled = 1;
+}
+
+
+
+void DisableExportValCache (void)
+/* Stop caching the values of exports. Must be called before the segments
+** are moved.
+*/
+{
+    ValCacheEnabled = 0;
 }
 
 
@@ -828,13 +929,11 @@ static void CreateExportPool (void)
     }
     ExpPool = xmalloc (ExpCount * sizeof (Export*));
 
-    /* Walk through the list and insert the exports */
-    for (I = 0, J = 0; I < sizeof (HashTab) / sizeof (HashTab [0]); ++I) {
-        Export* E = HashTab[I];
-        while (E) {
+    /* Walk through the table and insert the exports */
+    for (I = 0, J = 0; I < HashSize; ++I) {
+        if (HashTab[I].Exp) {
             CHECK (J < ExpCount);
-            ExpPool[J++] = E;
-            E = E->Next;
+            ExpPool[J++] = HashTab[I].Exp;
         }
     }
 
@@ -897,7 +996,7 @@ static void PrintExportMap (Export** Pool, unsigned Count, FILE* F)
     /* Print all exports */
     unsigned Col = 0;
     for (I = 0; I < Count; ++I) {
-        const Export* E = Pool [I];
+        Export* E = Pool [I];
 
         /* Print unreferenced symbols only if explictly requested. If Expr is
         ** NULL, the export is undefined. This happens for imports that don't
@@ -906,7 +1005,7 @@ static void PrintExportMap (Export** Pool, unsigned Count, FILE* F)
         ** elsewhere, like o65 imports defined in the linker config.
         ** So ignore exports here that have an invalid Expr.
         */
-        if (E->Expr != 0 &&
+        if (E->Expr != 0 && !GCIsRemoved (E->Expr) &&
             (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type))) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
@@ -1043,7 +1142,11 @@ void PrintExportLabels (FILE* F)
 
     /* Print all exports */
     for (I = 0; I < ExpCount; ++I) {
-        const Export* E = ExpPool [I];
+        Export* E = ExpPool [I];
+        if (E->Expr != 0 && GCIsRemoved (E->Expr)) {
+            /* Defined in a section removed by --gc-sections */
+            continue;
+        }
         PrintLabelLine (F, E->Name, GetExportVal (E));
 
     }
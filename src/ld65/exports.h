@@ -47,6 +47,7 @@
 
 /* ld65 */
 #include "config.h"
+#include "fileio.h"
 #include "lineinfo.h"
 #include "memarea.h"
 #include "objdata.h"
@@ -78,7 +79,6 @@ struct Import {
 typedef struct Export Export;
 struct Export {
     unsigned            Name;           /* Name */
-    Export*             Next;           /* Hash table link */
     unsigned            Flags;          /* Generic flags */
     ObjData*            Obj;            /* Object file that exports the name */
     unsigned            ImpCount;       /* How many imports for this symbol? */
@@ -88,6 +88,8 @@ struct Export {
     Collection          DefLines;       /* Line infos of definition */
     Collection          RefLines;       /* Line infos of reference */
     unsigned            DbgSymId;       /* Id of debug symbol for this export */
+    unsigned            ValGen;         /* Cache generation of Val */
+    long                Val;            /* Cached value of the export */
     unsigned short      Type;           /* Type of export */
     unsigned short      AddrSize;       /* Address size of export */
     unsigned char       ConDes[CD_TYPE_COUNT];  /* Constructor/destructor decls */
@@ -117,7 +119,7 @@ void FreeImport (Import* I);
 ** aren't referenced).
 */
 
-Import* ReadImport (FILE* F, ObjData* Obj);
+Import* ReadImport (InFile* F, ObjData* Obj);
 /* Read an import from a file and insert it into the table */
 
 Import* GenImport (unsigned Name, unsigned char AddrSize);
@@ -135,7 +137,7 @@ void FreeExport (Export* E);
 ** aren't referenced).
 */
 
-Export* ReadExport (FILE* F, ObjData* Obj);
+Export* ReadExport (InFile* F, ObjData* Obj);
 /* Read an export from a file */
 
 void InsertExport (Export* E);
@@ -170,11 +172,29 @@ int IsUnresolved (unsigned Name);
 int IsUnresolvedExport (const Export* E);
 /* Return true if the given export is unresolved */
 
+void WalkUnresolved (void (*F) (unsigned Name));
+/* Call F with the name of each export that is currently unresolved */
+
+void WalkExports (void (*F) (Export* E));
+/* Call F for each export */
+
 int IsConstExport (const Export* E);
 /* Return true if the expression associated with this export is const */
 
-long GetExportVal (const Export* E);
-/* Get the value of this export */
+long GetExportVal (Export* E);
+/* Get the value of this export. While the value cache is enabled, the value
+** is computed only once.
+*/
+
+void EnableExportValCache (void);
+/* Cache the values of the exports from now on. Values cached before are
+** discarded. Must be called only while the segments are not moved.
+*/
+
+void DisableExportValCache (void);
+/* Stop caching the values of exports. Must be called before the segments
+** are moved.
+*/
 
 void CheckExports (void);
 /* Setup the list of all exports and check for export/import symbol type
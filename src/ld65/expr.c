@@ -43,6 +43,7 @@
 #include "error.h"
 #include "fileio.h"
 #include "memarea.h"
+#include "relax.h"
 #include "segments.h"
 #include "expr.h"
 
@@ -142,6 +143,10 @@ int IsConstExpr (ExprNode* Root)
                 return !Root->V.Mem->Relocatable &&
                        (Root->V.Mem->Flags & MF_PLACED);
 
+            case EXPR_RELAX:
+                /* The size changes of relaxed instructions are always known */
+                return 1;
+
             default:
                 /* Anything else is not const */
                 return 0;
@@ -311,6 +316,9 @@ long GetExprVal (ExprNode* Expr)
         case EXPR_MEMAREA:
             return Expr->V.Mem->Start;
 
+        case EXPR_RELAX:
+            return GetRelaxExprVal (Expr);
+
         case EXPR_PLUS:
             return GetExprVal (Expr->Left) + GetExprVal (Expr->Right);
 
@@ -515,6 +523,10 @@ static void GetSegExprValInternal (ExprNode* Expr, SegExprDesc* D, int Sign)
             }
             break;
 
+        case EXPR_RELAX:
+            D->Val += Sign * GetRelaxExprVal (Expr);
+            break;
+
         case EXPR_PLUS:
             GetSegExprValInternal (Expr->Left, D, Sign);
             GetSegExprValInternal (Expr->Right, D, Sign);
@@ -625,7 +637,7 @@ ExprNode* SectionExpr (Section* Sec, long Offs, ObjData* O)
 
 
 
-ExprNode* ReadExpr (FILE* F, ObjData* O)
+ExprNode* ReadExpr (InFile* F, ObjData* O)
 /* Read an expression from the given file */
 {
     ExprNode* Expr;
@@ -657,6 +669,11 @@ ExprNode* ReadExpr (FILE* F, ObjData* O)
                 Expr->V.SecNum = ReadVar (F);
                 break;
 
+            case EXPR_RELAX:
+                /* Read the index of the relaxed instruction */
+                Expr->V.IVal = ReadVar (F);
+                break;
+
             default:
                 Error ("Invalid expression op: %02X", Op);
 
@@ -715,6 +732,10 @@ int EqualExpr (ExprNode* E1, ExprNode* E2)
             /* Memory area must be identical */
             return (E1->V.Mem == E2->V.Mem);
 
+        case EXPR_RELAX:
+            /* Relaxed instruction must be identical */
+            return (E1->Obj == E2->Obj && E1->V.IVal == E2->V.IVal);
+
         default:
             /* Not a leaf node */
             return EqualExpr (E1->Left, E2->Left) && EqualExpr (E1->Right, E2->Right);
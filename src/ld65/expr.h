@@ -45,6 +45,7 @@
 #include "objdata.h"
 #include "exports.h"
 #include "config.h"
+#include "fileio.h"
 
 
 
@@ -111,7 +112,7 @@ ExprNode* SegmentExpr (Segment* Seg, long Offs, ObjData* O);
 ExprNode* SectionExpr (Section* Sec, long Offs, ObjData* O);
 /* Return an expression tree that encodes an offset into a section */
 
-ExprNode* ReadExpr (FILE* F, ObjData* O);
+ExprNode* ReadExpr (InFile* F, ObjData* O);
 /* Read an expression from the given file */
 
 int EqualExpr (ExprNode* E1, ExprNode* E2);
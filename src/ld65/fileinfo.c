@@ -133,7 +133,7 @@ static void FreeFileInfo (FileInfo* FI)
 
 
 
-FileInfo* ReadFileInfo (FILE* F, ObjData* O)
+FileInfo* ReadFileInfo (InFile* F, ObjData* O)
 /* Read a file info from a file and return it */
 {
     FileInfo* FI;
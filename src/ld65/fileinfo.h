@@ -45,6 +45,7 @@
 #include "filepos.h"
 
 /* ld65 */
+#include "fileio.h"
 #include "objdata.h"
 
 
@@ -72,7 +73,7 @@ struct FileInfo {
 
 
 
-FileInfo* ReadFileInfo (FILE* F, ObjData* O);
+FileInfo* ReadFileInfo (InFile* F, ObjData* O);
 /* Read a file info from a file and return it */
 
 unsigned FileInfoCount (void);
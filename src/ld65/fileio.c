@@ -33,10 +33,12 @@
 
 
 
-#include <string.h>
 #include <errno.h>
+#include <string.h>
 
 /* common */
+#include "check.h"
+#include "srcfile.h"
 #include "xmalloc.h"
 
 /* ld65 */
@@ -52,39 +54,215 @@
 
 
 
-void FileSetPos (FILE* F, unsigned long Pos)
+static void ReadError (const InFile* F)
+/* Print an error message for a read past the end of the file */
+{
+    Error ("Read error at position %lu (file corrupt?)", FileGetPos (F));
+}
+
+
+
+InFile* OpenInFile (const char* Name)
+/* Open an input file and make its contents available. Returns NULL and sets
+** errno if the file cannot be opened or read.
+*/
+{
+    InFile* F;
+
+    /* Map the file. The line ending style doesn't matter, since lines are
+    ** never read from the file.
+    */
+    SrcFile* Src = OpenSrcFile (Name, SRC_EOL_LF);
+    if (Src == 0) {
+        return 0;
+    }
+
+    /* Create the input file */
+    F = xmalloc (sizeof (InFile));
+    F->Buf = (const unsigned char*) Src->Buf;
+    F->Pos = F->Buf;
+    F->End = (const unsigned char*) Src->End;
+    F->Src = Src;
+    return F;
+}
+
+
+
+void CloseInFile (InFile* F)
+/* Close an input file and release its contents */
+{
+    CloseSrcFile (F->Src);
+    xfree (F);
+}
+
+
+
+void FileSetPos (InFile* F, unsigned long Pos)
 /* Seek to the given absolute position, fail on errors */
 {
-    if (fseek (F, Pos, SEEK_SET) != 0) {
-        Error ("Cannot seek: %s", strerror (errno));
+    if (Pos > FileGetSize (F)) {
+        Error ("Cannot seek to position %lu (file corrupt?)", Pos);
     }
+    F->Pos = F->Buf + Pos;
+}
+
+
+
+unsigned long FileGetPos (const InFile* F)
+/* Return the current file position */
+{
+    return (unsigned long) (F->Pos - F->Buf);
 }
 
 
 
-unsigned long FileGetPos (FILE* F)
-/* Return the current file position, fail on errors */
+unsigned long FileGetSize (const InFile* F)
+/* Return the size of the file */
 {
-    long Pos = ftell (F);
-    if (Pos < 0) {
-        Error ("Error in ftell: %s", strerror (errno));
+    return (unsigned long) (F->End - F->Buf);
+}
+
+
+
+static unsigned char* OutFileReserve (OutFile* F, unsigned long Count)
+/* Make room for Count bytes at the write position, advance the position and
+** return a pointer to the space.
+*/
+{
+    unsigned char* P;
+
+    if (F->Pos + Count > F->Allocated) {
+        unsigned long NewAlloc = F->Allocated? F->Allocated : 0x1000;
+        while (NewAlloc < F->Pos + Count) {
+            NewAlloc *= 2;
+        }
+        F->Buf = xrealloc (F->Buf, NewAlloc);
+        F->Allocated = NewAlloc;
     }
-    return Pos;
+    P = F->Buf + F->Pos;
+    F->Pos += Count;
+    if (F->Pos > F->Size) {
+        F->Size = F->Pos;
+    }
+    return P;
 }
 
 
 
-void Write8 (FILE* F, unsigned Val)
-/* Write an 8 bit value to the file */
+OutFile* OpenOutFile (const char* Name)
+/* Create an output file. Fails if the file cannot be opened for writing. */
 {
-    if (putc (Val, F) == EOF) {
-        Error ("Write error (disk full?)");
+    OutFile* F;
+
+    /* Open the file now, so errors are reported before the contents are
+    ** generated.
+    */
+    FILE* OF = fopen (Name, "wb");
+    if (OF == 0) {
+        Error ("Cannot open `%s': %s", Name, strerror (errno));
     }
+
+    /* Create the output file */
+    F            = xmalloc (sizeof (OutFile));
+    F->F         = OF;
+    F->Name      = xstrdup (Name);
+    F->Buf       = 0;
+    F->Pos       = 0;
+    F->Size      = 0;
+    F->Allocated = 0;
+    return F;
 }
 
 
 
-void Write16 (FILE* F, unsigned Val)
+OutFile* UpdateOutFile (const char* Name)
+/* Open an existing output file to change parts of it. The current contents
+** are read into memory and written back by CloseOutFile. Fails if the file
+** cannot be read or opened for writing.
+*/
+{
+    OutFile* F;
+    FILE*    OF;
+
+    /* Read the current contents */
+    InFile* IF = OpenInFile (Name);
+    if (IF == 0) {
+        Error ("Cannot open `%s': %s", Name, strerror (errno));
+    }
+
+    /* Open the file for writing without truncating it */
+    OF = fopen (Name, "r+b");
+    if (OF == 0) {
+        Error ("Cannot open `%s': %s", Name, strerror (errno));
+    }
+
+    /* Create the output file and copy the contents */
+    F            = xmalloc (sizeof (OutFile));
+    F->F         = OF;
+    F->Name      = xstrdup (Name);
+    F->Buf       = 0;
+    F->Pos       = 0;
+    F->Size      = 0;
+    F->Allocated = 0;
+    WriteData (F, IF->Buf, FileGetSize (IF));
+    F->Pos       = 0;
+
+    /* The input file isn't needed any longer */
+    CloseInFile (IF);
+    return F;
+}
+
+
+
+void CloseOutFile (OutFile* F)
+/* Write the contents of an output file to disk and release it */
+{
+    if (fwrite (F->Buf, 1, F->Size, F->F) != F->Size || fclose (F->F) != 0) {
+        Error ("Cannot write to `%s': %s", F->Name, strerror (errno));
+    }
+    xfree (F->Name);
+    xfree (F->Buf);
+    xfree (F);
+}
+
+
+
+void OutFileSetPos (OutFile* F, unsigned long Pos)
+/* Set the write position of an output file. Pos must not be beyond the end
+** of the data written so far.
+*/
+{
+    PRECONDITION (Pos <= F->Size);
+    F->Pos = Pos;
+}
+
+
+
+unsigned long OutFileGetPos (const OutFile* F)
+/* Return the write position of an output file */
+{
+    return F->Pos;
+}
+
+
+
+unsigned long OutFileGetSize (const OutFile* F)
+/* Return the size of the data written to an output file */
+{
+    return F->Size;
+}
+
+
+
+void Write8 (OutFile* F, unsigned Val)
+/* Write an 8 bit value to the file */
+{
+    *OutFileReserve (F, 1) = (unsigned char) Val;
+}
+
+
+
+void Write16 (OutFile* F, unsigned Val)
 /* Write a 16 bit value to the file */
 {
     Write8 (F, (unsigned char) Val);
@@ -93,7 +271,7 @@ void Write16 (FILE* F, unsigned Val)
 
 
 
-void Write24 (FILE* F, unsigned long Val)
+void Write24 (OutFile* F, unsigned long Val)
 /* Write a 24 bit value to the file */
 {
     Write8 (F, (unsigned char) Val);
@@ -103,7 +281,7 @@ void Write24 (FILE* F, unsigned long Val)
 
 
 
-void Write32 (FILE* F, unsigned long Val)
+void Write32 (OutFile* F, unsigned long Val)
 /* Write a 32 bit value to the file */
 {
     Write8 (F, (unsigned char) Val);
@@ -114,7 +292,7 @@ void Write32 (FILE* F, unsigned long Val)
 
 
 
-void WriteVal (FILE* F, unsigned long Val, unsigned Size)
+void WriteVal (OutFile* F, unsigned long Val, unsigned Size)
 /* Write a value of the given size to the output file */
 {
     switch (Size) {
@@ -143,7 +321,7 @@ void WriteVal (FILE* F, unsigned long Val, unsigned Size)
 
 
 
-void WriteVar (FILE* F, unsigned long V)
+void WriteVar (OutFile* F, unsigned long V)
 /* Write a variable sized value to the file in special encoding */
 {
     /* We will write the value to the file in 7 bit chunks. If the 8th bit
@@ -163,7 +341,7 @@ void WriteVar (FILE* F, unsigned long V)
 
 
 
-void WriteStr (FILE* F, const char* S)
+void WriteStr (OutFile* F, const char* S)
 /* Write a string to the file */
 {
     unsigned Len = strlen (S);
@@ -173,50 +351,48 @@ void WriteStr (FILE* F, const char* S)
 
 
 
-void WriteData (FILE* F, const void* Data, unsigned Size)
+void WriteData (OutFile* F, const void* Data, unsigned Size)
 /* Write data to the file */
 {
-    if (fwrite (Data, 1, Size, F) != Size) {
-        Error ("Write error (disk full?)");
-    }
+    memcpy (OutFileReserve (F, Size), Data, Size);
 }
 
 
 
-void WriteMult (FILE* F, unsigned char Val, unsigned long Count)
+void WriteMult (OutFile* F, unsigned char Val, unsigned long Count)
 /* Write one byte several times to the file */
 {
-    while (Count--) {
-        Write8 (F, Val);
-    }
+    memset (OutFileReserve (F, Count), Val, Count);
 }
 
 
 
-unsigned Read8 (FILE* F)
+unsigned Read8 (InFile* F)
 /* Read an 8 bit value from the file */
 {
-    int C = getc (F);
-    if (C == EOF) {
-        long Pos = ftell (F);
-        Error ("Read error at position %ld (file corrupt?)", Pos);
+    if (F->Pos >= F->End) {
+        ReadError (F);
     }
-    return C;
+    return *F->Pos++;
 }
 
 
 
-unsigned Read16 (FILE* F)
+unsigned Read16 (InFile* F)
 /* Read a 16 bit value from the file */
 {
-    unsigned Lo = Read8 (F);
-    unsigned Hi = Read8 (F);
-    return (Hi << 8) | Lo;
+    unsigned Val;
+    if (F->End - F->Pos < 2) {
+        ReadError (F);
+    }
+    Val = F->Pos[0] | (F->Pos[1] << 8);
+    F->Pos += 2;
+    return Val;
 }
 
 
 
-unsigned long Read24 (FILE* F)
+unsigned long Read24 (InFile* F)
 /* Read a 24 bit value from the file */
 {
     unsigned long Lo = Read16 (F);
@@ -226,17 +402,24 @@ unsigned long Read24 (FILE* F)
 
 
 
-unsigned long Read32 (FILE* F)
+unsigned long Read32 (InFile* F)
 /* Read a 32 bit value from the file */
 {
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read16 (F);
-    return (Hi << 16) | Lo;
+    unsigned long Val;
+    if (F->End - F->Pos < 4) {
+        ReadError (F);
+    }
+    Val = F->Pos[0]                         |
+          ((unsigned long) F->Pos[1] << 8)  |
+          ((unsigned long) F->Pos[2] << 16) |
+          ((unsigned long) F->Pos[3] << 24);
+    F->Pos += 4;
+    return Val;
 }
 
 
 
-long Read32Signed (FILE* F)
+long Read32Signed (InFile* F)
 /* Read a 32 bit value from the file. Sign extend the value. */
 {
     /* Read a 32 bit value */
@@ -254,7 +437,7 @@ long Read32Signed (FILE* F)
 
 
 
-unsigned long ReadVar (FILE* F)
+unsigned long ReadVar (InFile* F)
 /* Read a variable size value from the file */
 {
     /* The value was written to the file in 7 bit chunks LSB first. If there
@@ -265,7 +448,10 @@ unsigned long ReadVar (FILE* F)
     unsigned Shift = 0;
     do {
         /* Read one byte */
-        C = Read8 (F);
+        if (F->Pos >= F->End) {
+            ReadError (F);
+        }
+        C = *F->Pos++;
         /* Encode it into the target value */
         V |= ((unsigned long)(C & 0x7F)) << Shift;
         /* Next value */
@@ -278,37 +464,28 @@ unsigned long ReadVar (FILE* F)
 
 
 
-unsigned ReadStr (FILE* F)
+unsigned ReadStr (InFile* F)
 /* Read a string from the file, place it into the global string pool, and
 ** return its string id.
 */
 {
-    unsigned    Id;
-    StrBuf      Buf = STATIC_STRBUF_INITIALIZER;
+    StrBuf Buf = AUTO_STRBUF_INITIALIZER;
 
     /* Read the length */
     unsigned Len = ReadVar (F);
 
-    /* Expand the string buffer memory */
-    SB_Realloc (&Buf, Len);
+    /* Use the string in place, the string pool will copy it */
+    Buf.Buf    = (char*) ReadMem (F, Len);
+    Buf.Cooked = Buf.Buf;
+    Buf.Len    = Len;
 
-    /* Read the string */
-    ReadData (F, SB_GetBuf (&Buf), Len);
-    Buf.Len = Len;
-
-    /* Insert it into the string pool and remember the id */
-    Id = GetStrBufId (&Buf);
-
-    /* Free the memory buffer */
-    SB_Done (&Buf);
-
-    /* Return the string id */
-    return Id;
+    /* Insert it into the string pool and return the id */
+    return GetStrBufId (&Buf);
 }
 
 
 
-FilePos* ReadFilePos (FILE* F, FilePos* Pos)
+FilePos* ReadFilePos (InFile* F, FilePos* Pos)
 /* Read a file position from the file */
 {
     /* Read the data fields */
@@ -320,15 +497,27 @@ FilePos* ReadFilePos (FILE* F, FilePos* Pos)
 
 
 
-void* ReadData (FILE* F, void* Data, unsigned Size)
+void* ReadData (InFile* F, void* Data, unsigned Size)
 /* Read data from the file */
 {
     /* Explicitly allow reading zero bytes */
     if (Size > 0) {
-        if (fread (Data, 1, Size, F) != Size) {
-            long Pos = ftell (F);
-            Error ("Read error at position %ld (file corrupt?)", Pos);
-        }
+        memcpy (Data, ReadMem (F, Size), Size);
+    }
+    return Data;
+}
+
+
+
+const unsigned char* ReadMem (InFile* F, unsigned Size)
+/* Skip Size bytes of the file and return a pointer to them. The data is not
+** copied and stays valid until the file is closed.
+*/
+{
+    const unsigned char* Data = F->Pos;
+    if ((unsigned long) (F->End - F->Pos) < Size) {
+        ReadError (F);
     }
+    F->Pos += Size;
     return Data;
 }
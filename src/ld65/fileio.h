@@ -42,6 +42,39 @@
 
 /* common */
 #include "filepos.h"
+#include "srcfile.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An input file. The complete contents are memory mapped or read into
+** memory, and all data is decoded directly from there.
+*/
+typedef struct InFile InFile;
+struct InFile {
+    const unsigned char*    Buf;        /* Contents of the file */
+    const unsigned char*    Pos;        /* Current read position */
+    const unsigned char*    End;        /* End of the contents */
+    SrcFile*                Src;        /* Mapped file */
+};
+
+/* An output file. The complete contents are built in memory and written to
+** disk with one call when the file is closed.
+*/
+typedef struct OutFile OutFile;
+struct OutFile {
+    FILE*                   F;          /* The file on disk */
+    char*                   Name;       /* Name of the file */
+    unsigned char*          Buf;        /* Contents of the file */
+    unsigned long           Pos;        /* Current write position */
+    unsigned long           Size;       /* Size of the contents */
+    unsigned long           Allocated;  /* Size of the buffer */
+};
 
 
 
@@ -51,68 +84,107 @@
 
 
 
-void FileSetPos (FILE* F, unsigned long Pos);
+InFile* OpenInFile (const char* Name);
+/* Open an input file and make its contents available. Returns NULL and sets
+** errno if the file cannot be opened or read.
+*/
+
+void CloseInFile (InFile* F);
+/* Close an input file and release its contents */
+
+void FileSetPos (InFile* F, unsigned long Pos);
 /* Seek to the given absolute position, fail on errors */
 
-unsigned long FileGetPos (FILE* F);
-/* Return the current file position, fail on errors */
+unsigned long FileGetPos (const InFile* F);
+/* Return the current file position */
+
+unsigned long FileGetSize (const InFile* F);
+/* Return the size of the file */
+
+OutFile* OpenOutFile (const char* Name);
+/* Create an output file. Fails if the file cannot be opened for writing. */
+
+OutFile* UpdateOutFile (const char* Name);
+/* Open an existing output file to change parts of it. The current contents
+** are read into memory and written back by CloseOutFile. Fails if the file
+** cannot be read or opened for writing.
+*/
+
+void CloseOutFile (OutFile* F);
+/* Write the contents of an output file to disk and release it */
 
-void Write8 (FILE* F, unsigned Val);
+void OutFileSetPos (OutFile* F, unsigned long Pos);
+/* Set the write position of an output file. Pos must not be beyond the end
+** of the data written so far.
+*/
+
+unsigned long OutFileGetPos (const OutFile* F);
+/* Return the write position of an output file */
+
+unsigned long OutFileGetSize (const OutFile* F);
+/* Return the size of the data written to an output file */
+
+void Write8 (OutFile* F, unsigned Val);
 /* Write an 8 bit value to the file */
 
-void Write16 (FILE* F, unsigned Val);
+void Write16 (OutFile* F, unsigned Val);
 /* Write a 16 bit value to the file */
 
-void Write24 (FILE* F, unsigned long Val);
+void Write24 (OutFile* F, unsigned long Val);
 /* Write a 24 bit value to the file */
 
-void Write32 (FILE* F, unsigned long Val);
+void Write32 (OutFile* F, unsigned long Val);
 /* Write a 32 bit value to the file */
 
-void WriteVal (FILE* F, unsigned long Val, unsigned Size);
+void WriteVal (OutFile* F, unsigned long Val, unsigned Size);
 /* Write a value of the given size to the output file */
 
-void WriteVar (FILE* F, unsigned long V);
+void WriteVar (OutFile* F, unsigned long V);
 /* Write a variable sized value to the file in special encoding */
 
-void WriteStr (FILE* F, const char* S);
+void WriteStr (OutFile* F, const char* S);
 /* Write a string to the file */
 
-void WriteData (FILE* F, const void* Data, unsigned Size);
+void WriteData (OutFile* F, const void* Data, unsigned Size);
 /* Write data to the file */
 
-void WriteMult (FILE* F, unsigned char Val, unsigned long Count);
+void WriteMult (OutFile* F, unsigned char Val, unsigned long Count);
 /* Write one byte several times to the file */
 
-unsigned Read8 (FILE* F);
+unsigned Read8 (InFile* F);
 /* Read an 8 bit value from the file */
 
-unsigned Read16 (FILE* F);
+unsigned Read16 (InFile* F);
 /* Read a 16 bit value from the file */
 
-unsigned long Read24 (FILE* F);
+unsigned long Read24 (InFile* F);
 /* Read a 24 bit value from the file */
 
-unsigned long Read32 (FILE* F);
+unsigned long Read32 (InFile* F);
 /* Read a 32 bit value from the file */
 
-long Read32Signed (FILE* F);
+long Read32Signed (InFile* F);
 /* Read a 32 bit value from the file. Sign extend the value. */
 
-unsigned long ReadVar (FILE* F);
+unsigned long ReadVar (InFile* F);
 /* Read a variable size value from the file */
 
-unsigned ReadStr (FILE* F);
+unsigned ReadStr (InFile* F);
 /* Read a string from the file, place it into the global string pool, and
 ** return its string id.
 */
 
-FilePos* ReadFilePos (FILE* F, FilePos* Pos);
+FilePos* ReadFilePos (InFile* F, FilePos* Pos);
 /* Read a file position from the file */
 
-void* ReadData (FILE* F, void* Data, unsigned Size);
+void* ReadData (InFile* F, void* Data, unsigned Size);
 /* Read data from the file */
 
+const unsigned char* ReadMem (InFile* F, unsigned Size);
+/* Skip Size bytes of the file and return a pointer to them. The data is not
+** copied and stays valid until the file is closed.
+*/
+
 
 
 /* End of fileio.h */
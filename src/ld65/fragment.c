@@ -54,18 +54,8 @@
 Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
 /* Create a new fragment and insert it into the section S */
 {
-    Fragment* F;
-
-    /* Calculate the size of the memory block. LitBuf is only needed if the
-    ** fragment contains literal data.
-    */
-    unsigned FragSize = sizeof (Fragment) - 1;
-    if (Type == FRAG_LITERAL) {
-        FragSize += Size;
-    }
-
     /* Allocate memory */
-    F = xmalloc (FragSize);
+    Fragment* F = xmalloc (sizeof (Fragment));
 
     /* Initialize the data */
     F->Next      = 0;
@@ -74,6 +64,7 @@ Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
     F->Size      = Size;
     F->Expr      = 0;
     F->LineInfos = EmptyCollection;
+    F->LitBuf    = 0;
     F->Type      = Type;
 
     /* Insert the code fragment into the section */
@@ -88,8 +79,12 @@ Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
     /* Increment the size of the section by the size of the fragment */
     S->Size += Size;
 
-    /* Increment the size of the segment that contains the section */
-    S->Seg->Size += Size;
+    /* Increment the size of the segment that contains the section. Sections
+    ** read from object files are added to their segment later.
+    */
+    if (S->Seg) {
+        S->Seg->Size += Size;
+    }
 
     /* Return the new fragment */
     return F;
@@ -72,8 +72,8 @@ struct Fragment {
     unsigned            Size;           /* Size of data/expression */
     struct ExprNode*    Expr;           /* Expression if FRAG_EXPR */
     Collection          LineInfos;      /* Line info for this fragment */
+    const unsigned char* LitBuf;        /* Literal data in the input file */
     unsigned char       Type;           /* Type of fragment */
-    unsigned char       LitBuf [1];     /* Dynamically alloc'ed literal buffer */
 };
 
 
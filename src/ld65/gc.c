@@ -0,0 +1,243 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                    gc.c                                   */
+/*                                                                           */
+/*               Removal of unused sections for the ld65 linker              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* common */
+#include "cddefs.h"
+#include "coll.h"
+#include "print.h"
+#include "segdefs.h"
+
+/* ld65 */
+#include "asserts.h"
+#include "condes.h"
+#include "exports.h"
+#include "expr.h"
+#include "fragment.h"
+#include "gc.h"
+#include "objdata.h"
+#include "segments.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Exports that must be kept */
+static Collection Kept = STATIC_COLLECTION_INITIALIZER;
+
+/* Sections that are used, but whose fragments were not yet checked */
+static Collection Pending = STATIC_COLLECTION_INITIALIZER;
+
+/* Exports that were marked while walking the references */
+static Collection Marked = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void KeepSection (Section* S)
+/* Mark a section as used */
+{
+    if (!S->Used) {
+        S->Used = 1;
+        CollAppend (&Pending, S);
+    }
+}
+
+
+
+static void KeepExpr (ExprNode* Expr);
+/* Keep everything referenced by an expression */
+
+
+
+static void KeepExport (Export* E)
+/* Keep everything referenced by an export */
+{
+    if (E != 0 && !ExportHasMark (E)) {
+        MarkExport (E);
+        CollAppend (&Marked, E);
+        if (E->Expr) {
+            KeepExpr (E->Expr);
+        }
+    }
+}
+
+
+
+static void KeepExpr (ExprNode* Expr)
+/* Keep everything referenced by an expression */
+{
+    switch (Expr->Op) {
+
+        case EXPR_SYMBOL:
+            KeepExport (GetExprExport (Expr));
+            break;
+
+        case EXPR_SECTION:
+            KeepSection (GetExprSection (Expr));
+            break;
+
+        default:
+            if (Expr->Left) {
+                KeepExpr (Expr->Left);
+            }
+            if (Expr->Right) {
+                KeepExpr (Expr->Right);
+            }
+            break;
+    }
+}
+
+
+
+static void KeepRootExport (Export* E)
+/* Keep an export if it is needed even without references from the code:
+** Exports imported by the linker config or the command line, forced imports,
+** and constructors, destructors and interruptors.
+*/
+{
+    unsigned      I;
+    const Import* Imp;
+
+    /* Condes exports are needed for the tables, together with the imports
+    ** that their types declare.
+    */
+    for (I = 0; I < CD_TYPE_COUNT; ++I) {
+        if (E->ConDes[I] != CD_PRIO_NONE) {
+            const ConDesImport* CDI = ConDesGetImport (I);
+            KeepExport (E);
+            if (CDI) {
+                KeepExport (FindExport (CDI->Name));
+            }
+        }
+    }
+
+    /* Imports without a module come from the linker. Imports without a
+    ** reference are forced imports.
+    */
+    for (Imp = E->ImpList; Imp; Imp = Imp->Next) {
+        if (Imp->Obj == 0 || CollCount (&Imp->RefLines) == 0) {
+            KeepExport (E);
+            break;
+        }
+    }
+}
+
+
+
+int GCIsRemoved (ExprNode* Expr)
+/* Return true if the expression references a section that was removed. A
+** symbol with such a value is not part of the output.
+*/
+{
+    if (Expr->Op == EXPR_SECTION) {
+        return !GetExprSection (Expr)->Used;
+    }
+    return (Expr->Left && GCIsRemoved (Expr->Left)) ||
+           (Expr->Right && GCIsRemoved (Expr->Right));
+}
+
+
+
+void GCKeepSymbol (unsigned Name)
+/* Keep the sections needed by the symbol with the given name, even if the
+** symbol is not referenced.
+*/
+{
+    Export* E = FindExport (Name);
+    if (E) {
+        CollAppend (&Kept, E);
+    }
+}
+
+
+
+void GCRemoveSections (void)
+/* Remove the sections of the linked modules that aren't needed. Only sections
+** marked as removable in the object file are candidates.
+*/
+{
+    unsigned      I, J;
+    unsigned long Removed;
+
+    /* Sections that cannot be removed are needed, removable ones are needed
+    ** if they are referenced. Linker generated sections are never removed.
+    */
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            Section* S = CollAtUnchecked (&O->Sections, J);
+            if (S->Flags & SEG_FLAG_REMOVABLE) {
+                S->Used = 0;
+            } else {
+                CollAppend (&Pending, S);
+            }
+        }
+    }
+
+    /* Add the other roots */
+    WalkExports (KeepRootExport);
+    for (I = 0; I < CollCount (&Kept); ++I) {
+        KeepExport (CollAtUnchecked (&Kept, I));
+    }
+    WalkAssertions (KeepExpr);
+
+    /* Everything referenced by a needed section is needed */
+    while (CollCount (&Pending) > 0) {
+        const Section*  S = CollPop (&Pending);
+        const Fragment* F;
+        for (F = S->FragRoot; F; F = F->Next) {
+            if (F->Expr) {
+                KeepExpr (F->Expr);
+            }
+        }
+    }
+
+    /* Remove the marks from the exports */
+    for (I = 0; I < CollCount (&Marked); ++I) {
+        UnmarkExport (CollAtUnchecked (&Marked, I));
+    }
+    CollDeleteAll (&Marked);
+    CollDeleteAll (&Kept);
+
+    /* Remove the unused sections from their segments */
+    Removed = SegRemoveUnused ();
+    Print (stdout, 1, "Removed %lu bytes of unused sections\n", Removed);
+}
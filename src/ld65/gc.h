@@ -0,0 +1,68 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                    gc.h                                   */
+/*                                                                           */
+/*               Removal of unused sections for the ld65 linker              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef GC_H
+#define GC_H
+
+
+
+/* common */
+#include "exprdefs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int GCIsRemoved (ExprNode* Expr);
+/* Return true if the expression references a section that was removed. A
+** symbol with such a value is not part of the output.
+*/
+
+void GCKeepSymbol (unsigned Name);
+/* Keep the sections needed by the symbol with the given name, even if the
+** symbol is not referenced.
+*/
+
+void GCRemoveSections (void);
+/* Remove the sections of the linked modules that aren't needed. Only sections
+** marked as removable in the object file are candidates.
+*/
+
+
+
+/* End of gc.h */
+
+#endif
@@ -57,7 +57,11 @@ unsigned char AllowMultDef      = 0;        /* Allow multiple definitions */
 unsigned char LargeAlignment    = 0;        /* Don't warn about large alignments */
 unsigned char WarnAlignWaste    = 0;        /* Warn about "wasted" bytes when aligning */
 unsigned char WarningsAsErrors  = 0;        /* Error if any warnings */
+unsigned char GCSections        = 0;        /* Remove unused sections */
+unsigned char RelaxCode         = 0;        /* Shorten relaxed instructions */
+unsigned MaxJobs                = 1;        /* Object files read in parallel */
 
 const char* MapFileName         = 0;        /* Name of the map file */
 const char* LabelFileName       = 0;        /* Name of the label file */
 const char* DbgFileName         = 0;        /* Name of the debug file */
+const char* StateFileName       = 0;        /* Name of the link state file */
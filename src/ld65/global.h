@@ -57,10 +57,14 @@ extern unsigned char    AllowMultDef;      /* Allow multiple definitions */
 extern unsigned char    LargeAlignment;    /* Don't warn about large alignments */
 extern unsigned char    WarnAlignWaste;    /* Warn about "wasted" bytes when aligning */
 extern unsigned char    WarningsAsErrors;  /* Error if any warnings */
+extern unsigned char    GCSections;        /* Remove unused sections */
+extern unsigned char    RelaxCode;         /* Shorten relaxed instructions */
+extern unsigned         MaxJobs;           /* Object files read in parallel */
 
 extern const char*      MapFileName;       /* Name of the map file */
 extern const char*      LabelFileName;     /* Name of the label file */
 extern const char*      DbgFileName;       /* Name of the debug file */
+extern const char*      StateFileName;     /* Name of the link state file */
 
 
 
@@ -0,0 +1,1144 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  incr.c                                   */
+/*                                                                           */
+/*                  Incremental linking for the ld65 linker                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+
+
+/* An incremental link starts from the state of the last link, which is saved
+** in a file: The checksums of the input and output files, the placement of
+** the segments and of the sections of all modules, and the values of all
+** exported symbols.
+**
+** If only object files have changed, and the new sections have the same
+** sizes and the exports the same values as before, the placement of all
+** segments and sections stays the same. In this case, only the changed
+** object files are read, their imports are defined with the values from the
+** last link, and their sections are written over the old ones in the output
+** files. Everything else needs a full link.
+*/
+
+
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* common */
+#include "cddefs.h"
+#include "cmdline.h"
+#include "exprdefs.h"
+#include "fragdefs.h"
+#include "objdefs.h"
+#include "print.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "asserts.h"
+#include "config.h"
+#include "error.h"
+#include "exports.h"
+#include "expr.h"
+#include "fileio.h"
+#include "fragment.h"
+#include "global.h"
+#include "incr.h"
+#include "memarea.h"
+#include "objdata.h"
+#include "objfile.h"
+#include "scanner.h"
+#include "segments.h"
+#include "spool.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Signature and version of the link state file */
+#define STATE_MAGIC     0x5453444CUL    /* "LDST" */
+#define STATE_VERSION   1U
+
+/* Checksums of the contents of a file */
+typedef struct FileSum FileSum;
+struct FileSum {
+    unsigned long       Size;           /* Size of the file */
+    unsigned long       Hash;           /* FNV-1a hash */
+    unsigned long       Sum;            /* Adler-32 checksum */
+};
+
+/* An input or output file */
+typedef struct StateFile StateFile;
+struct StateFile {
+    unsigned            Name;           /* Name of the file */
+    unsigned            Mod;            /* Module number + 1 of object files */
+    unsigned long       Magic;          /* Signature of the file */
+    FileSum             Sum;            /* Checksums of the contents */
+};
+
+/* A segment */
+typedef struct StateSeg StateSeg;
+struct StateSeg {
+    unsigned            Name;           /* Name of the segment */
+    unsigned            AddrSize;       /* Address size of the segment */
+    unsigned long       PC;             /* Run address of the segment */
+    unsigned            FillVal;        /* Value for fill bytes */
+    unsigned            MemArea;        /* Name of the run memory area */
+    unsigned            Output;         /* Name of the output file */
+    unsigned long       OutputOffs;     /* Offset in the output file */
+    Segment*            Tmp;            /* Stand-in for checking modules */
+};
+
+/* A section of a module */
+typedef struct StateSec StateSec;
+struct StateSec {
+    unsigned            Seg;            /* Index of the segment */
+    unsigned long       Offs;           /* Offset within the segment */
+    unsigned long       Size;           /* Size of the section */
+    unsigned long       Alignment;      /* Alignment of the section */
+};
+
+/* An exported symbol */
+typedef struct StateSym StateSym;
+struct StateSym {
+    unsigned            Name;           /* Name of the symbol */
+    unsigned            AddrSize;       /* Address size of the symbol */
+    long                Val;            /* Value of the symbol */
+};
+
+/* A module from an object file */
+typedef struct StateMod StateMod;
+struct StateMod {
+    unsigned            Patchable;      /* Module may be replaced */
+    unsigned            SecCount;       /* Number of sections */
+    StateSec*           Secs;           /* Sections */
+    unsigned            ExpCount;       /* Number of exports */
+    StateSym*           Exps;           /* Exports */
+    unsigned            ImpCount;       /* Number of imports */
+    unsigned*           Imps;           /* Names of the imports */
+    ObjData*            Obj;            /* New module if changed */
+    InFile*             F;              /* Object file, holds the data of Obj */
+};
+
+/* The state of a link */
+typedef struct LinkState LinkState;
+struct LinkState {
+    unsigned            Version;        /* Version of the linker */
+    unsigned            ArgCount;       /* Number of arguments */
+    unsigned*           Args;           /* Command line arguments */
+    StateFile           Config;         /* The config file */
+    Collection          Inputs;         /* Object files and libraries */
+    Collection          Outputs;        /* Output files */
+    Collection          Segs;           /* Segments */
+    Collection          Mods;           /* Modules from object files */
+    unsigned            SymCount;       /* Number of exported symbols */
+    StateSym*           Syms;           /* Exported symbols sorted by name */
+};
+
+/* The input files of this link */
+static Collection       InputList = STATIC_COLLECTION_INITIALIZER;
+
+/* Exports collected by SaveExport */
+static Collection       ExportList = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static void InitLinkState (LinkState* S)
+/* Initialize an empty link state */
+{
+    S->Version          = INVALID_STRING_ID;
+    S->ArgCount         = 0;
+    S->Args             = 0;
+    S->Config.Name      = INVALID_STRING_ID;
+    S->Config.Mod       = 0;
+    S->Config.Magic     = 0;
+    InitCollection (&S->Inputs);
+    InitCollection (&S->Outputs);
+    InitCollection (&S->Segs);
+    InitCollection (&S->Mods);
+    S->SymCount         = 0;
+    S->Syms             = 0;
+}
+
+
+
+static StateFile* NewStateFile (unsigned Name)
+/* Create a new file entry */
+{
+    StateFile* F = xmalloc (sizeof (StateFile));
+    F->Name     = Name;
+    F->Mod      = 0;
+    F->Magic    = 0;
+    F->Sum.Size = 0;
+    F->Sum.Hash = 0;
+    F->Sum.Sum  = 0;
+    return F;
+}
+
+
+
+static void ComputeSum (FileSum* Sum, const unsigned char* Buf, unsigned long Size)
+/* Compute the checksums of a block of memory */
+{
+    unsigned long Hash = 2166136261UL;
+    unsigned long A    = 1;
+    unsigned long B    = 0;
+
+    Sum->Size = Size;
+    while (Size > 0) {
+
+        /* The sums of Adler-32 don't overflow within 5552 bytes */
+        unsigned long N = (Size < 5552)? Size : 5552;
+        Size -= N;
+        while (N--) {
+            Hash = ((Hash ^ *Buf) * 16777619UL) & 0xFFFFFFFFUL;
+            A   += *Buf++;
+            B   += A;
+        }
+        A %= 65521;
+        B %= 65521;
+    }
+    Sum->Hash = Hash;
+    Sum->Sum  = (B << 16) | A;
+}
+
+
+
+static int ReadFileSum (StateFile* F)
+/* Read the signature of a file and compute the checksums of its contents.
+** Return false if the file cannot be read.
+*/
+{
+    InFile* In = OpenInFile (GetString (F->Name));
+    if (In == 0) {
+        return 0;
+    }
+    F->Magic = (FileGetSize (In) >= 4)? Read32 (In) : 0;
+    ComputeSum (&F->Sum, In->Buf, FileGetSize (In));
+    CloseInFile (In);
+    return 1;
+}
+
+
+
+static int EqualSum (const FileSum* A, const FileSum* B)
+/* Return true if the checksums are equal */
+{
+    return A->Size == B->Size && A->Hash == B->Hash && A->Sum == B->Sum;
+}
+
+
+
+static int CmpSym (const void* A, const void* B)
+/* Compare two symbols by name for qsort and bsearch */
+{
+    unsigned NameA = ((const StateSym*) A)->Name;
+    unsigned NameB = ((const StateSym*) B)->Name;
+    return (NameA < NameB)? -1 : (NameA > NameB);
+}
+
+
+
+static int CmpName (const void* A, const void* B)
+/* Compare two string ids for qsort */
+{
+    unsigned NameA = *(const unsigned*) A;
+    unsigned NameB = *(const unsigned*) B;
+    return (NameA < NameB)? -1 : (NameA > NameB);
+}
+
+
+
+static const StateSym* FindSym (const LinkState* S, unsigned Name)
+/* Find an exported symbol of the last link. Return NULL if not found. */
+{
+    StateSym Key;
+    Key.Name = Name;
+    return bsearch (&Key, S->Syms, S->SymCount, sizeof (StateSym), CmpSym);
+}
+
+
+
+static int IsPatchableExpr (const ExprNode* E, int AllowSymbols)
+/* Check if the value of an expression depends only on the addresses of the
+** sections of its module and, if AllowSymbols is true, on the values of
+** symbols.
+*/
+{
+    if (E == 0) {
+        return 1;
+    }
+    switch (E->Op) {
+        case EXPR_LITERAL:
+        case EXPR_SECTION:
+            return 1;
+        case EXPR_SYMBOL:
+            return AllowSymbols;
+        case EXPR_SEGMENT:
+        case EXPR_MEMAREA:
+        case EXPR_RELAX:
+        case EXPR_BANK:
+            return 0;
+        default:
+            return IsPatchableExpr (E->Left, AllowSymbols) &&
+                   IsPatchableExpr (E->Right, AllowSymbols);
+    }
+}
+
+
+
+static int IsPatchableModule (const ObjData* O)
+/* Check if the sections of a module may be written again in an incremental
+** link. The module must not have constructors or destructors, instructions
+** relaxed by the linker, or references to banks, and the values of the
+** exports must depend only on the addresses of its own sections.
+*/
+{
+    unsigned I, J;
+
+    /* Relaxation may change the size of sections */
+    if (CollCount (&O->RelaxFrags) > 0) {
+        return 0;
+    }
+
+    /* Check the expressions of the data */
+    for (I = 0; I < CollCount (&O->Sections); ++I) {
+        const Section*  Sec  = CollConstAt (&O->Sections, I);
+        const Fragment* Frag = Sec->FragRoot;
+        while (Frag) {
+            if ((Frag->Type == FRAG_EXPR || Frag->Type == FRAG_SEXPR) &&
+                !IsPatchableExpr (Frag->Expr, 1)) {
+                return 0;
+            }
+            Frag = Frag->Next;
+        }
+    }
+
+    /* Check the exports */
+    for (I = 0; I < CollCount (&O->Exports); ++I) {
+        const Export* E = CollConstAt (&O->Exports, I);
+        for (J = 0; J < CD_TYPE_COUNT; ++J) {
+            if (E->ConDes[J] != CD_PRIO_NONE) {
+                return 0;
+            }
+        }
+        if (!IsPatchableExpr (E->Expr, 0)) {
+            return 0;
+        }
+    }
+
+    /* The module may be replaced */
+    return 1;
+}
+
+
+
+static int FullLink (const char* Reason)
+/* Tell the user why a full link is needed and return false */
+{
+    Print (stdout, 1, "Full link needed: %s\n", Reason);
+    return 0;
+}
+
+
+
+/*****************************************************************************/
+/*                          Reading and writing state                        */
+/*****************************************************************************/
+
+
+
+static void WriteName (OutFile* F, unsigned Name)
+/* Write a string id to the state file. An invalid id is an empty string. */
+{
+    WriteStr (F, (Name == INVALID_STRING_ID)? "" : GetString (Name));
+}
+
+
+
+static unsigned ReadName (InFile* F)
+/* Read a string id written by WriteName */
+{
+    unsigned Name = ReadStr (F);
+    return (SB_GetLen (GetStrBuf (Name)) > 0)? Name : INVALID_STRING_ID;
+}
+
+
+
+static void WriteSum (OutFile* F, const FileSum* Sum)
+/* Write the checksums of a file */
+{
+    WriteVar (F, Sum->Size);
+    Write32 (F, Sum->Hash);
+    Write32 (F, Sum->Sum);
+}
+
+
+
+static void ReadSum (InFile* F, FileSum* Sum)
+/* Read the checksums of a file */
+{
+    Sum->Size = ReadVar (F);
+    Sum->Hash = Read32 (F);
+    Sum->Sum  = Read32 (F);
+}
+
+
+
+static void WriteSym (OutFile* F, const StateSym* S)
+/* Write an exported symbol */
+{
+    WriteName (F, S->Name);
+    Write8 (F, S->AddrSize);
+    Write32 (F, (unsigned long) S->Val);
+}
+
+
+
+static void ReadSym (InFile* F, StateSym* S)
+/* Read an exported symbol */
+{
+    S->Name     = ReadName (F);
+    S->AddrSize = Read8 (F);
+    S->Val      = Read32Signed (F);
+}
+
+
+
+static void WriteState (const LinkState* S)
+/* Write the link state file */
+{
+    unsigned I, J;
+
+    OutFile* F = OpenOutFile (StateFileName);
+
+    /* Header */
+    Write32 (F, STATE_MAGIC);
+    WriteVar (F, STATE_VERSION);
+    WriteName (F, S->Version);
+
+    /* Command line and config file */
+    WriteVar (F, S->ArgCount);
+    for (I = 0; I < S->ArgCount; ++I) {
+        WriteStr (F, GetString (S->Args[I]));
+    }
+    WriteName (F, S->Config.Name);
+    WriteSum (F, &S->Config.Sum);
+
+    /* Input and output files */
+    WriteVar (F, CollCount (&S->Inputs));
+    for (I = 0; I < CollCount (&S->Inputs); ++I) {
+        const StateFile* In = CollConstAt (&S->Inputs, I);
+        WriteName (F, In->Name);
+        WriteVar (F, In->Mod);
+        WriteSum (F, &In->Sum);
+    }
+    WriteVar (F, CollCount (&S->Outputs));
+    for (I = 0; I < CollCount (&S->Outputs); ++I) {
+        const StateFile* Out = CollConstAt (&S->Outputs, I);
+        WriteName (F, Out->Name);
+        WriteSum (F, &Out->Sum);
+    }
+
+    /* Segments */
+    WriteVar (F, CollCount (&S->Segs));
+    for (I = 0; I < CollCount (&S->Segs); ++I) {
+        const StateSeg* Seg = CollConstAt (&S->Segs, I);
+        WriteName (F, Seg->Name);
+        Write8 (F, Seg->AddrSize);
+        Write32 (F, Seg->PC);
+        Write8 (F, Seg->FillVal);
+        WriteName (F, Seg->MemArea);
+        WriteName (F, Seg->Output);
+        Write32 (F, Seg->OutputOffs);
+    }
+
+    /* Modules */
+    WriteVar (F, CollCount (&S->Mods));
+    for (I = 0; I < CollCount (&S->Mods); ++I) {
+        const StateMod* M = CollConstAt (&S->Mods, I);
+        Write8 (F, M->Patchable);
+        WriteVar (F, M->SecCount);
+        for (J = 0; J < M->SecCount; ++J) {
+            WriteVar (F, M->Secs[J].Seg);
+            WriteVar (F, M->Secs[J].Offs);
+            WriteVar (F, M->Secs[J].Size);
+            WriteVar (F, M->Secs[J].Alignment);
+        }
+        WriteVar (F, M->ExpCount);
+        for (J = 0; J < M->ExpCount; ++J) {
+            WriteSym (F, M->Exps + J);
+        }
+        WriteVar (F, M->ImpCount);
+        for (J = 0; J < M->ImpCount; ++J) {
+            WriteName (F, M->Imps[J]);
+        }
+    }
+
+    /* Exported symbols */
+    WriteVar (F, S->SymCount);
+    for (I = 0; I < S->SymCount; ++I) {
+        WriteSym (F, S->Syms + I);
+    }
+
+    CloseOutFile (F);
+}
+
+
+
+static int ReadState (LinkState* S)
+/* Read the link state file. Return false if there is no file, or if it was
+** written by another version of the linker.
+*/
+{
+    unsigned I, J, Count;
+
+    InFile* F = OpenInFile (StateFileName);
+    if (F == 0) {
+        return 0;
+    }
+
+    /* Header */
+    if (FileGetSize (F) < 4 || Read32 (F) != STATE_MAGIC ||
+        ReadVar (F) != STATE_VERSION) {
+        CloseInFile (F);
+        return 0;
+    }
+    S->Version = ReadName (F);
+    if (S->Version != GetStringId (GetVersionAsString ())) {
+        CloseInFile (F);
+        return 0;
+    }
+
+    /* Command line and config file */
+    S->ArgCount = ReadVar (F);
+    S->Args = xmalloc (S->ArgCount * sizeof (unsigned));
+    for (I = 0; I < S->ArgCount; ++I) {
+        S->Args[I] = ReadStr (F);
+    }
+    S->Config.Name = ReadName (F);
+    ReadSum (F, &S->Config.Sum);
+
+    /* Input and output files */
+    Count = ReadVar (F);
+    for (I = 0; I < Count; ++I) {
+        StateFile* In = NewStateFile (ReadName (F));
+        In->Mod = ReadVar (F);
+        ReadSum (F, &In->Sum);
+        CollAppend (&S->Inputs, In);
+    }
+    Count = ReadVar (F);
+    for (I = 0; I < Count; ++I) {
+        StateFile* Out = NewStateFile (ReadName (F));
+        ReadSum (F, &Out->Sum);
+        CollAppend (&S->Outputs, Out);
+    }
+
+    /* Segments */
+    Count = ReadVar (F);
+    for (I = 0; I < Count; ++I) {
+        StateSeg* Seg   = xmalloc (sizeof (StateSeg));
+        Seg->Name       = ReadName (F);
+        Seg->AddrSize   = Read8 (F);
+        Seg->PC         = Read32 (F);
+        Seg->FillVal    = Read8 (F);
+        Seg->MemArea    = ReadName (F);
+        Seg->Output     = ReadName (F);
+        Seg->OutputOffs = Read32 (F);
+        Seg->Tmp        = 0;
+        CollAppend (&S->Segs, Seg);
+    }
+
+    /* Modules */
+    Count = ReadVar (F);
+    for (I = 0; I < Count; ++I) {
+        StateMod* M  = xmalloc (sizeof (StateMod));
+        M->Patchable = Read8 (F);
+        M->SecCount  = ReadVar (F);
+        M->Secs      = xmalloc (M->SecCount * sizeof (StateSec));
+        for (J = 0; J < M->SecCount; ++J) {
+            M->Secs[J].Seg       = ReadVar (F);
+            M->Secs[J].Offs      = ReadVar (F);
+            M->Secs[J].Size      = ReadVar (F);
+            M->Secs[J].Alignment = ReadVar (F);
+        }
+        M->ExpCount  = ReadVar (F);
+        M->Exps      = xmalloc (M->ExpCount * sizeof (StateSym));
+        for (J = 0; J < M->ExpCount; ++J) {
+            ReadSym (F, M->Exps + J);
+        }
+        M->ImpCount  = ReadVar (F);
+        M->Imps      = xmalloc (M->ImpCount * sizeof (unsigned));
+        for (J = 0; J < M->ImpCount; ++J) {
+            M->Imps[J] = ReadName (F);
+        }
+        qsort (M->Imps, M->ImpCount, sizeof (unsigned), CmpName);
+        M->Obj       = 0;
+        M->F         = 0;
+        CollAppend (&S->Mods, M);
+    }
+
+    /* Exported symbols */
+    S->SymCount = ReadVar (F);
+    S->Syms = xmalloc (S->SymCount * sizeof (StateSym));
+    for (I = 0; I < S->SymCount; ++I) {
+        ReadSym (F, S->Syms + I);
+    }
+    qsort (S->Syms, S->SymCount, sizeof (StateSym), CmpSym);
+
+    CloseInFile (F);
+    return 1;
+}
+
+
+
+/*****************************************************************************/
+/*                         Saving the state of a link                        */
+/*****************************************************************************/
+
+
+
+static void SaveExport (Export* E)
+/* Remember an export with a constant value */
+{
+    if (E->Expr != 0 && IsConstExport (E)) {
+        CollAppend (&ExportList, E);
+    }
+}
+
+
+
+static StateMod* NewStateMod (ObjData* O)
+/* Create the state of a module after a full link */
+{
+    unsigned I;
+
+    StateMod* M  = xmalloc (sizeof (StateMod));
+    M->Patchable = IsPatchableModule (O);
+
+    /* Sections */
+    M->SecCount = CollCount (&O->Sections);
+    M->Secs     = xmalloc (M->SecCount * sizeof (StateSec));
+    for (I = 0; I < M->SecCount; ++I) {
+        const Section* Sec = CollConstAt (&O->Sections, I);
+        M->Secs[I].Seg       = Sec->Seg->Id;
+        M->Secs[I].Offs      = Sec->Offs;
+        M->Secs[I].Size      = Sec->Size;
+        M->Secs[I].Alignment = Sec->Alignment;
+    }
+
+    /* Exports. The values are needed to check a changed module. */
+    M->ExpCount = CollCount (&O->Exports);
+    M->Exps     = xmalloc (M->ExpCount * sizeof (StateSym));
+    for (I = 0; I < M->ExpCount; ++I) {
+        Export* E = CollAtUnchecked (&O->Exports, I);
+        M->Exps[I].Name     = E->Name;
+        M->Exps[I].AddrSize = E->AddrSize;
+        if (E->Expr != 0 && IsConstExport (E)) {
+            M->Exps[I].Val  = GetExportVal (E);
+        } else {
+            M->Exps[I].Val  = 0;
+            M->Patchable    = 0;
+        }
+    }
+
+    /* Imports */
+    M->ImpCount = CollCount (&O->Imports);
+    M->Imps     = xmalloc (M->ImpCount * sizeof (unsigned));
+    for (I = 0; I < M->ImpCount; ++I) {
+        const Import* Imp = CollConstAt (&O->Imports, I);
+        M->Imps[I] = Imp->Name;
+    }
+
+    M->Obj = 0;
+    M->F   = 0;
+    return M;
+}
+
+
+
+static unsigned SkipArgs (unsigned I)
+/* Return the number of command line arguments starting with ArgVec[I] that
+** don't change the result of the link, or zero if ArgVec[I] isn't one of
+** them. These are the options for verbosity, the number of jobs and the
+** form of the diagnostics.
+*/
+{
+    const char* Arg = ArgVec[I];
+    if (strcmp (Arg, "-v") == 0 || strcmp (Arg, "--no-utf8") == 0) {
+        return 1;
+    }
+    if (strcmp (Arg, "--jobs") == 0 || strcmp (Arg, "--color") == 0 ||
+        strcmp (Arg, "-j") == 0) {
+        /* The value is a separate argument */
+        return (I + 1 < ArgCount)? 2 : 1;
+    }
+    if (strncmp (Arg, "-j", 2) == 0) {
+        /* The value is appended to the option */
+        return 1;
+    }
+    return 0;
+}
+
+
+
+static unsigned* GetLinkArgs (unsigned* Count)
+/* Return the command line arguments as string ids, leaving out those that
+** don't change the result of the link, so they don't force a full link. The
+** number of arguments is returned in Count.
+*/
+{
+    unsigned  I;
+    unsigned* Args = xmalloc (ArgCount * sizeof (unsigned));
+
+    *Count = 0;
+    I = 1;
+    while (I < ArgCount) {
+        unsigned Skip = SkipArgs (I);
+        if (Skip) {
+            I += Skip;
+        } else {
+            Args[(*Count)++] = GetStringId (ArgVec[I++]);
+        }
+    }
+    return Args;
+}
+
+
+
+static void BuildState (LinkState* S)
+/* Collect the state of a full link */
+{
+    unsigned I, J;
+
+    /* Linker version and command line */
+    S->Version  = GetStringId (GetVersionAsString ());
+    S->Args     = GetLinkArgs (&S->ArgCount);
+
+    /* Config file */
+    S->Config.Name = GetStringId (CfgGetName ());
+    (void) ReadFileSum (&S->Config);
+
+    /* Input files. Modules that don't come from libraries were added to the
+    ** module list in the order of the object files.
+    */
+    J = 0;
+    for (I = 0; I < CollCount (&InputList); ++I) {
+        StateFile* In = CollAtUnchecked (&InputList, I);
+        if (ReadFileSum (In) && In->Magic == OBJ_MAGIC) {
+            ObjData* O;
+            do {
+                O = CollAt (&ObjDataList, J++);
+            } while (O->Lib != 0);
+            CollAppend (&S->Mods, NewStateMod (O));
+            In->Mod = CollCount (&S->Mods);
+        }
+        CollAppend (&S->Inputs, In);
+    }
+
+    /* Segments and output files */
+    for (I = 0; I < SegmentCount (); ++I) {
+        const Segment* Seg = SegById (I);
+        StateSeg* SS   = xmalloc (sizeof (StateSeg));
+        SS->Name       = Seg->Name;
+        SS->AddrSize   = Seg->AddrSize;
+        SS->PC         = Seg->PC;
+        SS->FillVal    = Seg->FillVal;
+        SS->MemArea    = Seg->MemArea? Seg->MemArea->Name : INVALID_STRING_ID;
+        SS->Output     = Seg->OutputName? GetStringId (Seg->OutputName) : INVALID_STRING_ID;
+        SS->OutputOffs = Seg->OutputOffs;
+        SS->Tmp        = 0;
+        CollAppend (&S->Segs, SS);
+
+        /* Remember the output file */
+        if (SS->Output != INVALID_STRING_ID) {
+            for (J = 0; J < CollCount (&S->Outputs); ++J) {
+                const StateFile* Out = CollConstAt (&S->Outputs, J);
+                if (Out->Name == SS->Output) {
+                    break;
+                }
+            }
+            if (J == CollCount (&S->Outputs)) {
+                StateFile* Out = NewStateFile (SS->Output);
+                (void) ReadFileSum (Out);
+                CollAppend (&S->Outputs, Out);
+            }
+        }
+    }
+
+    /* Exported symbols */
+    WalkExports (SaveExport);
+    S->SymCount = CollCount (&ExportList);
+    S->Syms     = xmalloc (S->SymCount * sizeof (StateSym));
+    for (I = 0; I < S->SymCount; ++I) {
+        Export* E = CollAtUnchecked (&ExportList, I);
+        S->Syms[I].Name     = E->Name;
+        S->Syms[I].AddrSize = E->AddrSize;
+        S->Syms[I].Val      = GetExportVal (E);
+    }
+    CollDeleteAll (&ExportList);
+}
+
+
+
+/*****************************************************************************/
+/*                          Relinking changed modules                        */
+/*****************************************************************************/
+
+
+
+static int CheckModule (const LinkState* S, StateMod* M)
+/* Check if a changed module may replace the old one in the output files. Its
+** sections must match the old ones, the exports must have the same values,
+** and it must import the same symbols. The sections are placed like the old
+** ones, using stand-ins for the segments, since nothing global may change
+** before it is known that a full link isn't needed.
+*/
+{
+    unsigned  I;
+    unsigned* Names;
+    int       Equal;
+    ObjData*  O = M->Obj;
+
+    if (!IsPatchableModule (O)) {
+        return 0;
+    }
+
+    /* Check and place the sections */
+    if (CollCount (&O->Sections) != M->SecCount) {
+        return 0;
+    }
+    for (I = 0; I < M->SecCount; ++I) {
+        Section*        Sec = CollAtUnchecked (&O->Sections, I);
+        const StateSec* SS  = M->Secs + I;
+        StateSeg*       Seg = CollAt (&S->Segs, SS->Seg);
+        if (Sec->Name != Seg->Name || Sec->AddrSize != Seg->AddrSize ||
+            Sec->Size != SS->Size  || Sec->Alignment != SS->Alignment) {
+            return 0;
+        }
+        if (Seg->Tmp == 0) {
+            Seg->Tmp = xmalloc (sizeof (Segment));
+            Seg->Tmp->Name     = Seg->Name;
+            Seg->Tmp->PC       = Seg->PC;
+            Seg->Tmp->AddrSize = Seg->AddrSize;
+        }
+        Sec->Seg  = Seg->Tmp;
+        Sec->Offs = SS->Offs;
+    }
+
+    /* Check the exports */
+    if (CollCount (&O->Exports) != M->ExpCount) {
+        return 0;
+    }
+    for (I = 0; I < M->ExpCount; ++I) {
+        const Export*   E = CollConstAt (&O->Exports, I);
+        const StateSym* X = M->Exps + I;
+        if (E->Name != X->Name || E->AddrSize != X->AddrSize ||
+            E->Expr == 0 || GetExprVal (E->Expr) != X->Val) {
+            return 0;
+        }
+    }
+
+    /* Check the imports. Their values must be known. */
+    if (CollCount (&O->Imports) != M->ImpCount) {
+        return 0;
+    }
+    Names = xmalloc (M->ImpCount * sizeof (unsigned));
+    for (I = 0; I < M->ImpCount; ++I) {
+        const Import* Imp = CollConstAt (&O->Imports, I);
+        Names[I] = Imp->Name;
+    }
+    qsort (Names, M->ImpCount, sizeof (unsigned), CmpName);
+    Equal = 1;
+    for (I = 0; I < M->ImpCount && Equal; ++I) {
+        Equal = (Names[I] == M->Imps[I] && FindSym (S, Names[I]) != 0);
+    }
+    xfree (Names);
+
+    return Equal;
+}
+
+
+
+static unsigned IncrWriteExpr (ExprNode* E, int Signed, unsigned Size,
+                               unsigned long Offs attribute ((unused)),
+                               void* Data)
+/* Called from SegWriteSection for an expression */
+{
+    return SegWriteConstExpr ((OutFile*) Data, E, Signed, Size);
+}
+
+
+
+static void InsertModules (const LinkState* S)
+/* Add the changed modules to the module list, define their imports with the
+** values of the last link, and place their sections like the old ones.
+*/
+{
+    unsigned I, J;
+
+    /* Insert the modules first, so exports between them are resolved */
+    for (I = 0; I < CollCount (&S->Mods); ++I) {
+        StateMod* M = CollAtUnchecked (&S->Mods, I);
+        if (M->Obj) {
+            ObjInsert (M->Obj, M->F);
+        }
+    }
+
+    for (I = 0; I < CollCount (&S->Mods); ++I) {
+
+        const StateMod* M = CollAtUnchecked (&S->Mods, I);
+        if (M->Obj == 0) {
+            continue;
+        }
+
+        /* Define the imports that are still open */
+        for (J = 0; J < M->ImpCount; ++J) {
+            Export* E = FindExport (M->Imps[J]);
+            if (E == 0 || E->Expr == 0) {
+                const StateSym* X = FindSym (S, M->Imps[J]);
+                E = CreateConstExport (X->Name, X->Val);
+                E->AddrSize = X->AddrSize;
+            }
+        }
+
+        /* Place the sections and their segments */
+        for (J = 0; J < M->SecCount; ++J) {
+            Section*        Sec = CollAtUnchecked (&M->Obj->Sections, J);
+            const StateSeg* SS  = CollConstAt (&S->Segs, M->Secs[J].Seg);
+            Segment*        Seg = Sec->Seg;
+            Sec->Offs       = M->Secs[J].Offs;
+            Seg->PC         = SS->PC;
+            Seg->FillVal    = SS->FillVal;
+            Seg->OutputName = (SS->Output == INVALID_STRING_ID)? 0 : GetString (SS->Output);
+            Seg->OutputOffs = SS->OutputOffs;
+            Seg->MemArea    = CfgFindMemory (SS->MemArea);
+            if (Seg->MemArea) {
+                Seg->MemArea->Flags |= MF_PLACED;
+            }
+        }
+    }
+}
+
+
+
+static void WriteModules (LinkState* S)
+/* Write the sections of the changed modules over the old ones in the output
+** files. All output files are written, so their time stamps are updated.
+*/
+{
+    unsigned I, J, K;
+
+    for (I = 0; I < CollCount (&S->Outputs); ++I) {
+
+        StateFile*  Out  = CollAtUnchecked (&S->Outputs, I);
+        const char* Name = GetString (Out->Name);
+        OutFile*    F;
+
+        Print (stdout, 1, "Updating `%s'\n", Name);
+        F = UpdateOutFile (Name);
+
+        for (J = 0; J < CollCount (&S->Mods); ++J) {
+            const StateMod* M = CollAtUnchecked (&S->Mods, J);
+            if (M->Obj == 0) {
+                continue;
+            }
+            for (K = 0; K < M->SecCount; ++K) {
+                const StateSeg* SS = CollConstAt (&S->Segs, M->Secs[K].Seg);
+                if (SS->Output == Out->Name) {
+                    SegWriteSection (F, CollAtUnchecked (&M->Obj->Sections, K),
+                                     IncrWriteExpr, F);
+                }
+            }
+        }
+
+        CloseOutFile (F);
+        (void) ReadFileSum (Out);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void IncrAddInput (const char* Name)
+/* Add an input file of the link. This must be done for all object files and
+** libraries, in the order they are linked.
+*/
+{
+    CollAppend (&InputList, NewStateFile (GetStringId (Name)));
+}
+
+
+
+int IncrRelink (void)
+/* Try to update the output files of the last link using the saved link
+** state, reading only the object files that have changed. Return true if
+** this was successful, and false if a full link is needed.
+*/
+{
+    unsigned  I;
+    unsigned  Count;
+    unsigned* Args;
+    int       Same;
+    StateFile Cfg;
+    LinkState S;
+
+    /* Read the state of the last link */
+    InitLinkState (&S);
+    if (!ReadState (&S)) {
+        return FullLink ("no usable link state");
+    }
+
+    /* Files that depend on all modules are always created by a full link,
+    ** and so are target files that cannot be patched.
+    */
+    if (MapFileName || LabelFileName || DbgFileName) {
+        return FullLink ("map, label or debug file requested");
+    }
+    if (RelaxCode || GCSections) {
+        return FullLink ("relaxation or removal of sections requested");
+    }
+    if (!CfgCanPatchTarget ()) {
+        return FullLink ("output format cannot be updated");
+    }
+
+    /* The command line and the config file must be the same */
+    Args = GetLinkArgs (&Count);
+    Same = (Count == S.ArgCount);
+    for (I = 0; Same && I < Count; ++I) {
+        Same = (Args[I] == S.Args[I]);
+    }
+    xfree (Args);
+    if (!Same) {
+        return FullLink ("command line has changed");
+    }
+    Cfg.Name = GetStringId (CfgGetName ());
+    if (Cfg.Name != S.Config.Name || !ReadFileSum (&Cfg) ||
+        !EqualSum (&Cfg.Sum, &S.Config.Sum)) {
+        return FullLink ("config file has changed");
+    }
+
+    /* The output files must not have been changed by someone else */
+    for (I = 0; I < CollCount (&S.Outputs); ++I) {
+        const StateFile* Out = CollConstAt (&S.Outputs, I);
+        StateFile Cur = *Out;
+        if (!ReadFileSum (&Cur) || !EqualSum (&Cur.Sum, &Out->Sum)) {
+            return FullLink ("output file has changed");
+        }
+    }
+
+    /* Read the object files that have changed and check them */
+    if (CollCount (&S.Inputs) != CollCount (&InputList)) {
+        return FullLink ("input files have changed");
+    }
+    for (I = 0; I < CollCount (&InputList); ++I) {
+
+        StateFile*  Old = CollAtUnchecked (&S.Inputs, I);
+        StateFile*  New = CollAtUnchecked (&InputList, I);
+        const char* Name;
+        StateMod*   M;
+
+        if (Old->Name != New->Name || !ReadFileSum (New)) {
+            return FullLink ("input files have changed");
+        }
+        New->Mod = Old->Mod;
+        if (EqualSum (&Old->Sum, &New->Sum)) {
+            continue;
+        }
+        if (Old->Mod == 0 || New->Magic != OBJ_MAGIC) {
+            return FullLink ("library has changed");
+        }
+        M = CollAt (&S.Mods, Old->Mod - 1);
+        if (!M->Patchable) {
+            return FullLink ("changed module cannot be replaced");
+        }
+
+        Name = GetString (New->Name);
+        Print (stdout, 1, "Reading changed module `%s'\n", Name);
+        M->F = OpenInFile (Name);
+        if (M->F == 0) {
+            Error ("Cannot open `%s': %s", Name, strerror (errno));
+        }
+        (void) Read32 (M->F);
+        M->Obj = ObjRead (M->F, Name);
+        if (!CheckModule (&S, M)) {
+            return FullLink ("size or exports of changed module differ");
+        }
+    }
+
+    /* Replace the old modules */
+    InsertModules (&S);
+
+    /* Check module assertions and import/export mismatches */
+    CheckAssertions ();
+    CheckExports ();
+    if (WarningCount > 0 && WarningsAsErrors) {
+        Error ("Warnings as errors");
+    }
+
+    /* Update the output files and the link state */
+    WriteModules (&S);
+    for (I = 0; I < CollCount (&InputList); ++I) {
+        StateFile* Old = CollAtUnchecked (&S.Inputs, I);
+        StateFile* New = CollAtUnchecked (&InputList, I);
+        Old->Sum = New->Sum;
+    }
+    WriteState (&S);
+
+    /* Done */
+    return 1;
+}
+
+
+
+void IncrSaveState (void)
+/* Save the state of a successful full link for the next incremental one */
+{
+    LinkState S;
+    InitLinkState (&S);
+    BuildState (&S);
+    WriteState (&S);
+}
@@ -0,0 +1,62 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  incr.h                                   */
+/*                                                                           */
+/*                  Incremental linking for the ld65 linker                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef INCR_H
+#define INCR_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void IncrAddInput (const char* Name);
+/* Add an input file of the link. This must be done for all object files and
+** libraries, in the order they are linked.
+*/
+
+int IncrRelink (void);
+/* Try to update the output files of the last link using the saved link
+** state, reading only the object files that have changed. Return true if
+** this was successful, and false if a full link is needed.
+*/
+
+void IncrSaveState (void);
+/* Save the state of a successful full link for the next incremental one */
+
+
+
+/* End of incr.h */
+
+#endif
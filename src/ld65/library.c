@@ -35,11 +35,12 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <errno.h>
 
 /* common */
 #include "coll.h"
 #include "exprdefs.h"
+#include "hashfunc.h"
+#include "hashtab.h"
 #include "libdefs.h"
 #include "objdefs.h"
 #include "symdefs.h"
@@ -62,14 +63,34 @@
 
 
 
+/* Entry in the export index of a library */
+typedef struct LibExport LibExport;
+struct LibExport {
+    HashNode    Node;           /* Node in the hash table */
+    unsigned    Name;           /* String id of the exported name */
+    unsigned    Module;         /* Index of the exporting module */
+    LibExport*  Next;           /* Next module exporting the same name */
+};
+
 /* Library data structure */
 typedef struct Library Library;
 struct Library {
     unsigned    Id;             /* Id of library */
     unsigned    Name;           /* String id of the name */
-    FILE*       F;              /* Open file stream */
+    InFile*     F;              /* Open file */
     LibHeader   Header;         /* Library header */
     Collection  Modules;        /* Modules */
+    unsigned    Base;           /* Sweep position of first module */
+    HashTable   Exports;        /* Index of all exports by name */
+    LibExport*  ExportPool;     /* Memory for the index entries */
+};
+
+/* A heap of sweep positions of modules */
+typedef struct PosHeap PosHeap;
+struct PosHeap {
+    unsigned    Count;          /* Number of positions in the heap */
+    unsigned    Size;           /* Allocated size */
+    unsigned*   Pos;            /* Positions */
 };
 
 /* List of open libraries */
@@ -81,6 +102,63 @@ static Collection LibraryList = STATIC_COLLECTION_INITIALIZER;
 /* Flag for library grouping */
 static int Grouping = 0;
 
+/* Functions for the export index */
+static unsigned HT_GenHash (const void* Key);
+static const void* HT_GetKey (const void* Entry);
+static int HT_Compare (const void* Key1, const void* Key2);
+
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+/* Modules of the open libraries in the order they are searched, the heaps of
+** modules that may resolve something in the current and in the next search
+** round, and the sweep position in the current round.
+*/
+static ObjData**        Sweep;
+static unsigned char*   Queued;
+static PosHeap          CurRound;
+static PosHeap          NextRound;
+static unsigned         SweepPos;
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key. */
+{
+    /* The key is a string id */
+    return HashInt (*(const unsigned*) Key);
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return &((const LibExport*) Entry)->Name;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+{
+    unsigned N1 = *(const unsigned*) Key1;
+    unsigned N2 = *(const unsigned*) Key2;
+    return (N1 < N2)? -1 : (N1 > N2)? 1 : 0;
+}
+
 
 
 /*****************************************************************************/
@@ -89,7 +167,7 @@ static int Grouping = 0;
 
 
 
-static Library* NewLibrary (FILE* F, const char* Name)
+static Library* NewLibrary (InFile* F, const char* Name)
 /* Create a new Library structure and return it */
 {
     /* Allocate memory */
@@ -100,6 +178,9 @@ static Library* NewLibrary (FILE* F, const char* Name)
     L->Name     = GetStringId (Name);
     L->F        = F;
     L->Modules  = EmptyCollection;
+    L->Base     = 0;
+    InitHashTable (&L->Exports, 1, &HashFunc);
+    L->ExportPool = 0;
 
     /* Return the new struct */
     return L;
@@ -108,13 +189,15 @@ static Library* NewLibrary (FILE* F, const char* Name)
 
 
 static void CloseLibrary (Library* L)
-/* Close a library file and remove the list of modules */
+/* Remove the export index of a library. The file itself stays open, since
+** the literal data of the modules taken from it is used in place.
+*/
 {
-    /* Close the library file */
-    if (fclose (L->F) != 0) {
-        Error ("Error closing `%s': %s", GetString (L->Name), strerror (errno));
-    }
-    L->F = 0;
+    /* The export index isn't needed any longer */
+    DoneHashTable (&L->Exports);
+    InitHashTable (&L->Exports, 1, &HashFunc);
+    xfree (L->ExportPool);
+    L->ExportPool = 0;
 }
 
 
@@ -124,6 +207,7 @@ static void FreeLibrary (Library* L)
 {
     /* Close the library */
     CloseLibrary (L);
+    CloseInFile (L->F);
 
     /* Free the module index */
     DoneCollection (&L->Modules);
@@ -143,10 +227,11 @@ static void FreeLibrary (Library* L)
 static void LibSeek (Library* L, unsigned long Offs)
 /* Do a seek in the library checking for errors */
 {
-    if (fseek (L->F, Offs, SEEK_SET) != 0) {
-        Error ("Seek error in `%s' (%lu): %s",
-               GetString (L->Name), Offs, strerror (errno));
+    if (Offs > FileGetSize (L->F)) {
+        Error ("Seek error in `%s' (%lu): Offset beyond end of file",
+               GetString (L->Name), Offs);
     }
+    FileSetPos (L->F, Offs);
 }
 
 
@@ -284,6 +369,129 @@ static void LibReadIndex (Library* L)
 
 
 
+static void LibBuildExportIndex (Library* L)
+/* Build the index of all exports of the modules in a library */
+{
+    unsigned   I, J;
+    unsigned   Count;
+    LibExport* E;
+
+    /* Count the exports and allocate memory for the index */
+    Count = 0;
+    for (I = 0; I < CollCount (&L->Modules); ++I) {
+        const ObjData* O = CollConstAt (&L->Modules, I);
+        Count += CollCount (&O->Exports);
+    }
+    E = L->ExportPool = xmalloc (Count * sizeof (LibExport));
+    InitHashTable (&L->Exports, Count + 1, &HashFunc);
+
+    /* Add all exports. If several modules export the same name, they're
+    ** chained in the order of the library, which is the search order.
+    */
+    for (I = 0; I < CollCount (&L->Modules); ++I) {
+        const ObjData* O = CollConstAt (&L->Modules, I);
+        for (J = 0; J < CollCount (&O->Exports); ++J, ++E) {
+            LibExport* Prev;
+            InitHashNode (&E->Node);
+            E->Name   = ((const Export*) CollConstAt (&O->Exports, J))->Name;
+            E->Module = I;
+            E->Next   = 0;
+            Prev = HT_Find (&L->Exports, &E->Name);
+            if (Prev == 0) {
+                HT_Insert (&L->Exports, E);
+            } else {
+                while (Prev->Next) {
+                    Prev = Prev->Next;
+                }
+                Prev->Next = E;
+            }
+        }
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                             Module search heap                            */
+/*****************************************************************************/
+
+
+
+static void HeapPush (PosHeap* H, unsigned Pos)
+/* Add a position to a heap */
+{
+    unsigned I;
+
+    /* Grow the heap if needed */
+    if (H->Count >= H->Size) {
+        H->Size = (H->Size == 0)? 64 : H->Size * 2;
+        H->Pos  = xrealloc (H->Pos, H->Size * sizeof (H->Pos[0]));
+    }
+
+    /* Move the position up from the end to its place */
+    I = H->Count++;
+    while (I > 0 && H->Pos[(I - 1) / 2] > Pos) {
+        H->Pos[I] = H->Pos[(I - 1) / 2];
+        I = (I - 1) / 2;
+    }
+    H->Pos[I] = Pos;
+}
+
+
+
+static unsigned HeapPop (PosHeap* H)
+/* Remove the smallest position from a heap that must not be empty and
+** return it.
+*/
+{
+    unsigned Min  = H->Pos[0];
+    unsigned Last = H->Pos[--H->Count];
+    unsigned I    = 0;
+
+    /* Move the last position down from the top to its place */
+    while (2 * I + 1 < H->Count) {
+        unsigned C = 2 * I + 1;
+        if (C + 1 < H->Count && H->Pos[C + 1] < H->Pos[C]) {
+            ++C;
+        }
+        if (Last <= H->Pos[C]) {
+            break;
+        }
+        H->Pos[I] = H->Pos[C];
+        I = C;
+    }
+    if (H->Count > 0) {
+        H->Pos[I] = Last;
+    }
+    return Min;
+}
+
+
+
+static void QueueModules (unsigned Name)
+/* Queue all modules in the open libraries that export the given name and
+** weren't added before. Modules that come later than the current sweep
+** position are checked in the current round, all others in the next one.
+*/
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+        const Library* L = CollConstAt (&OpenLibs, I);
+        const LibExport* E = HT_Find (&L->Exports, &Name);
+        while (E) {
+            unsigned Pos = L->Base + E->Module;
+            if (!Queued[Pos] && (Sweep[Pos]->Flags & OBJ_REF) == 0) {
+                Queued[Pos] = 1;
+                HeapPush (Pos >= SweepPos? &CurRound : &NextRound, Pos);
+            }
+            E = E->Next;
+        }
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                             High level stuff                              */
 /*****************************************************************************/
@@ -311,7 +519,7 @@ static void LibCheckExports (ObjData* O)
 
 
 
-static void LibOpen (FILE* F, const char* Name)
+static void LibOpen (InFile* F, const char* Name)
 /* Open the library for use */
 {
     /* Create a new library structure */
@@ -323,6 +531,9 @@ static void LibOpen (FILE* F, const char* Name)
     /* Seek to the index position and read the index */
     LibReadIndex (L);
 
+    /* Index the exports of all modules */
+    LibBuildExportIndex (L);
+
     /* Add the library to the list of open libraries */
     CollAppend (&OpenLibs, L);
 }
@@ -333,42 +544,71 @@ static void LibResolve (void)
 /* Resolve all externals from the list of all currently open libraries */
 {
     unsigned I, J;
-    unsigned Additions;
-
-    /* Walk repeatedly over all open libraries until there's nothing more
-    ** to add.
-    */
-    do {
-
-        Additions = 0;
-
-        /* Walk over all libraries */
-        for (I = 0; I < CollCount (&OpenLibs); ++I) {
+    unsigned Count;
 
-            /* Get the next library */
-            Library* L = CollAt (&OpenLibs, I);
+    /* Number the modules of all open libraries in search order */
+    Count = 0;
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+        Library* L = CollAt (&OpenLibs, I);
+        L->Base = Count;
+        Count += CollCount (&L->Modules);
+    }
+    Sweep  = xmalloc (Count * sizeof (ObjData*));
+    Queued = xmalloc (Count);
+    memset (Queued, 0, Count);
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+        Library* L = CollAt (&OpenLibs, I);
+        for (J = 0; J < CollCount (&L->Modules); ++J) {
+            Sweep[L->Base + J] = CollAtUnchecked (&L->Modules, J);
+        }
+    }
 
-            /* Walk through all modules in this library and check for each
-            ** module if there are unresolved externals in existing modules
-            ** that may be resolved by adding the module.
-            */
-            for (J = 0; J < CollCount (&L->Modules); ++J) {
+    /* The libraries are searched in rounds over all modules in order, and a
+    ** module is added if it resolves an open import at the time it is
+    ** visited, until a round adds nothing. Instead of visiting all modules,
+    ** only those exporting an open import are queued and checked in the same
+    ** order. Start with the imports that are currently open.
+    */
+    SweepPos = 0;
+    WalkUnresolved (QueueModules);
+    while (1) {
+
+        unsigned Pos;
+        ObjData* O;
+
+        /* Start a new round if the current one is done */
+        if (CurRound.Count == 0) {
+            PosHeap Tmp;
+            if (NextRound.Count == 0) {
+                break;
+            }
+            Tmp       = CurRound;
+            CurRound  = NextRound;
+            NextRound = Tmp;
+            SweepPos  = 0;
+        }
 
-                /* Get the next module */
-                ObjData* O = CollAtUnchecked (&L->Modules, J);
+        /* Check the next queued module */
+        Pos = HeapPop (&CurRound);
+        Queued[Pos] = 0;
+        SweepPos = Pos + 1;
+        O = Sweep[Pos];
+        LibCheckExports (O);
 
-                /* We only need to check this module if it wasn't added before */
-                if ((O->Flags & OBJ_REF) == 0) {
-                    LibCheckExports (O);
-                    if (O->Flags & OBJ_REF) {
-                        /* The routine added the file */
-                        ++Additions;
-                    }
+        /* If the module was added, queue the modules that may resolve the
+        ** imports it left open.
+        */
+        if (O->Flags & OBJ_REF) {
+            for (J = 0; J < CollCount (&O->Imports); ++J) {
+                const Import* Imp = CollConstAt (&O->Imports, J);
+                if (IsUnresolvedExport (Imp->Exp)) {
+                    QueueModules (Imp->Exp->Name);
                 }
             }
         }
-
-    } while (Additions > 0);
+    }
+    xfree (Sweep);
+    xfree (Queued);
 
     /* We do know now which modules must be added, so we can load the data
     ** for these modues into memory. Since we're walking over all modules
@@ -451,7 +691,7 @@ static void LibResolve (void)
 
 
 
-void LibAdd (FILE* F, const char* Name)
+void LibAdd (InFile* F, const char* Name)
 /* Add files from the library to the list if there are references that could
 ** be satisfied.
 */
@@ -38,6 +38,11 @@
 
 
 
+/* ld65 */
+#include "fileio.h"
+
+
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -55,7 +60,7 @@ struct Library;
 
 
 
-void LibAdd (FILE* F, const char* Name);
+void LibAdd (InFile* F, const char* Name);
 /* Add files from the library to the list if there are references that could
 ** be satisfied.
 */
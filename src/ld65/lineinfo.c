@@ -42,6 +42,7 @@
 #include "error.h"
 #include "fileinfo.h"
 #include "fileio.h"
+#include "global.h"
 #include "lineinfo.h"
 #include "objdata.h"
 #include "segments.h"
@@ -121,7 +122,7 @@ LineInfo* GenLineInfo (const FilePos* Pos)
 
 
 
-LineInfo* ReadLineInfo (FILE* F, ObjData* O)
+LineInfo* ReadLineInfo (InFile* F, ObjData* O)
 /* Read a line info from a file and return it */
 {
     /* Create a new LineInfo struct */
@@ -133,7 +134,13 @@ LineInfo* ReadLineInfo (FILE* F, ObjData* O)
     LI->File     = CollAt (&O->Files, ReadVar (F));
     LI->Pos.Name = LI->File->Name;
     LI->Type     = ReadVar (F);
-    LI->Spans    = ReadSpanList (F);
+
+    /* Spans are only used for the debug info file */
+    if (DbgFileName) {
+        LI->Spans = ReadSpanList (F);
+    } else {
+        SkipSpanList (F);
+    }
 
     /* Return the struct read */
     return LI;
@@ -141,7 +148,7 @@ LineInfo* ReadLineInfo (FILE* F, ObjData* O)
 
 
 
-void ReadLineInfoList (FILE* F, ObjData* O, Collection* LineInfos)
+void ReadLineInfoList (InFile* F, ObjData* O, Collection* LineInfos)
 /* Read a list of line infos stored as a list of indices in the object file,
 ** make real line infos from them and place them into the passed collection.
 */
@@ -45,6 +45,7 @@
 #include "filepos.h"
 
 /* ld65 */
+#include "fileio.h"
 #include "span.h"
 #include "spool.h"
 
@@ -91,7 +92,7 @@ struct LineInfo {
 LineInfo* GenLineInfo (const FilePos* Pos);
 /* Generate a new (internally used) line info with the given information */
 
-LineInfo* ReadLineInfo (FILE* F, struct ObjData* O);
+LineInfo* ReadLineInfo (InFile* F, struct ObjData* O);
 /* Read a line info from a file and return it */
 
 void FreeLineInfo (LineInfo* LI);
@@ -100,7 +101,7 @@ void FreeLineInfo (LineInfo* LI);
 LineInfo* DupLineInfo (const LineInfo* LI);
 /* Creates a duplicate of a line info structure */
 
-void ReadLineInfoList (FILE* F, struct ObjData* O, Collection* LineInfos);
+void ReadLineInfoList (InFile* F, struct ObjData* O, Collection* LineInfos);
 /* Read a list of line infos stored as a list of indices in the object file,
 ** make real line infos from them and place them into the passed collection.
 */
@@ -62,6 +62,7 @@
 #include "fileio.h"
 #include "filepath.h"
 #include "global.h"
+#include "incr.h"
 #include "library.h"
 #include "mapfile.h"
 #include "objfile.h"
@@ -151,6 +152,7 @@ static void Usage (void)
             "  -S addr\t\tSet the default start address\n"
             "  -V\t\t\tPrint the linker version\n"
             "  -h\t\t\tHelp (this text)\n"
+            "  -j n\t\t\tRead up to n object files in parallel\n"
             "  -m name\t\tCreate a map file\n"
             "  -o name\t\tName the default output file\n"
             "  -t sys\t\tSet the target system\n"
@@ -167,7 +169,10 @@ static void Usage (void)
             "  --define sym=val\t\tDefine a symbol\n"
             "  --end-group\t\t\tEnd a library group\n"
             "  --force-import sym\t\tForce an import of symbol 'sym'\n"
+            "  --gc-sections\t\t\tRemove unused sections\n"
             "  --help\t\t\tHelp (this text)\n"
+            "  --incremental name\t\tRelink using the state saved in a file\n"
+            "  --jobs n\t\t\tRead up to n object files in parallel\n"
             "  --large-alignment\t\tDon't warn about large alignments\n"
             "  --lib file\t\t\tLink this library\n"
             "  --lib-path path\t\tSpecify a library search path\n"
@@ -176,6 +181,7 @@ static void Usage (void)
             "  --no-utf8\t\t\tDisable use of UTF-8 in diagnostics\n"
             "  --obj file\t\t\tLink this object file\n"
             "  --obj-path path\t\tSpecify an object file search path\n"
+            "  --relax\t\t\tShorten instructions marked by the assembler\n"
             "  --start-addr addr\t\tSet the default start address\n"
             "  --start-group\t\t\tStart a library group\n"
             "  --target sys\t\t\tSet the target system\n"
@@ -214,48 +220,58 @@ static unsigned long CvtNumber (const char* Arg, const char* Number)
 
 
 
-static void LinkFile (const char* Name, FILETYPE Type)
-/* Handle one file */
+static char* FindInputFile (const char* Name, FILETYPE* Type)
+/* Search an input file and return its path name, or NULL if it was not
+** found. If the type is unknown, it is determined from the extension.
+*/
 {
-    char*         PathName;
-    FILE*         F;
-    unsigned long Magic;
-
+    char* PathName;
 
     /* If we don't know the file type, determine it from the extension */
-    if (Type == FILETYPE_UNKNOWN) {
-        Type = GetTypeOfFile (Name);
+    if (*Type == FILETYPE_UNKNOWN) {
+        *Type = GetTypeOfFile (Name);
     }
 
     /* For known file types, search the file in the directory list */
-    switch (Type) {
+    switch (*Type) {
 
         case FILETYPE_LIB:
             PathName = SearchFile (LibSearchPath, Name);
             if (PathName == 0) {
                 PathName = SearchFile (LibDefaultPath, Name);
             }
-            break;
+            return PathName;
 
         case FILETYPE_OBJ:
             PathName = SearchFile (ObjSearchPath, Name);
             if (PathName == 0) {
                 PathName = SearchFile (ObjDefaultPath, Name);
             }
-            break;
+            return PathName;
 
         default:
-            PathName = xstrdup (Name);   /* Use the name as is */
-            break;
+            return xstrdup (Name);   /* Use the name as is */
     }
+}
+
+
+
+static void LinkFile (const char* Name, FILETYPE Type)
+/* Handle one file */
+{
+    char*         PathName;
+    InFile*       F;
+    unsigned long Magic;
+
 
-    /* We must have a valid name now */
+    /* Search the file. We must have a valid name then. */
+    PathName = FindInputFile (Name, &Type);
     if (PathName == 0) {
         Error ("Input file `%s' not found", Name);
     }
 
     /* Try to open the file */
-    F = fopen (PathName, "rb");
+    F = OpenInFile (PathName);
     if (F == 0) {
         Error ("Cannot open `%s': %s", PathName, strerror (errno));
     }
@@ -277,12 +293,16 @@ static void LinkFile (const char* Name, FILETYPE Type)
             break;
 
         case LIB_MAGIC:
+            /* The library may only resolve imports of the object files
+            ** before it, so these must be read now.
+            */
+            ObjLoadPending ();
             LibAdd (F, PathName);
             ++LibFiles;
             break;
 
         default:
-            fclose (F);
+            CloseInFile (F);
             Error ("File `%s' has unknown type", PathName);
 
     }
@@ -445,6 +465,15 @@ static void OptForceImport (const char* Opt attribute ((unused)), const char* Ar
 
 
 
+static void OptGCSections (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Remove unused sections */
+{
+    GCSections = 1;
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print usage information and exit */
@@ -455,6 +484,31 @@ static void OptHelp (const char* Opt attribute ((unused)),
 
 
 
+static void OptIncremental (const char* Opt attribute ((unused)), const char* Arg)
+/* Give the name of the link state file */
+{
+    StateFileName = Arg;
+}
+
+
+
+static void OptJobs (const char* Opt, const char* Arg)
+/* Set the number of object files that are read in parallel */
+{
+    unsigned Num;
+    char     Check;
+
+    /* Convert the argument to a number */
+    if (sscanf (Arg, "%u%c", &Num, &Check) != 1 || Num == 0) {
+        InvArg (Opt, Arg);
+    }
+
+    /* Use the value */
+    MaxJobs = Num;
+}
+
+
+
 static void OptLargeAlignment (const char* Opt attribute ((unused)),
                                const char* Arg attribute ((unused)))
 /* Don't warn about large alignments */
@@ -540,6 +594,15 @@ static void OptOutputName (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptRelax (const char* Opt attribute ((unused)),
+                      const char* Arg attribute ((unused)))
+/* Shorten instructions marked by the assembler */
+{
+    RelaxCode = 1;
+}
+
+
+
 static void OptStartAddr (const char* Opt, const char* Arg)
 /* Set the default start address */
 {
@@ -689,7 +752,10 @@ static void ParseCommandLine (void)
         { "--define",                    1,      OptDefine               },
         { "--end-group",                 0,      CmdlOptEndGroup         },
         { "--force-import",              1,      OptForceImport          },
+        { "--gc-sections",               0,      OptGCSections           },
         { "--help",                      0,      OptHelp                 },
+        { "--incremental",               1,      OptIncremental          },
+        { "--jobs",                      1,      OptJobs                 },
         { "--large-alignment",           0,      OptLargeAlignment       },
         { "--lib",                       1,      OptLib                  },
         { "--lib-path",                  1,      OptLibPath              },
@@ -698,6 +764,7 @@ static void ParseCommandLine (void)
         { "--no-utf8",                   0,      OptNoUtf8               },
         { "--obj",                       1,      OptObj                  },
         { "--obj-path",                  1,      OptObjPath              },
+        { "--relax",                     0,      OptRelax                },
         { "--start-addr",                1,      OptStartAddr            },
         { "--start-group",               0,      CmdlOptStartGroup       },
         { "--target",                    1,      CmdlOptTarget           },
@@ -739,6 +806,10 @@ static void ParseCommandLine (void)
                     OptHelp (Arg, 0);
                     break;
 
+                case 'j':
+                    OptJobs (Arg, GetArg (&I, 2));
+                    break;
+
                 case 'm':
                     OptMapFile (Arg, GetArg (&I, 2));
                     break;
@@ -814,6 +885,46 @@ static void ParseCommandLine (void)
     } else if (CmdlineCfgFile) {
         OptConfig (NULL, CmdlineCfgFile);
     }
+}
+
+
+
+static void AddIncrInputs (void)
+/* Pass the names of the input files to the incremental linker */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&InputFiles); ++I) {
+
+        FILETYPE Type;
+        char*    PathName;
+
+        /* Get the entry and its type. Library groups don't matter here. */
+        const InputFile* F = CollConstAt (&InputFiles, I);
+        switch (F->Type) {
+            case INPUT_FILES_FILE:      Type = FILETYPE_UNKNOWN;        break;
+            case INPUT_FILES_FILE_LIB:  Type = FILETYPE_LIB;            break;
+            case INPUT_FILES_FILE_OBJ:  Type = FILETYPE_OBJ;            break;
+            default:                    continue;
+        }
+
+        /* Search the file. Missing files are reported by the full link. */
+        PathName = FindInputFile (F->FileName, &Type);
+        if (PathName) {
+            IncrAddInput (PathName);
+            xfree (PathName);
+        } else {
+            IncrAddInput (F->FileName);
+        }
+    }
+}
+
+
+
+static void LinkInputFiles (void)
+/* Read the object files and libraries given on the command line */
+{
+    unsigned I;
 
     /* Process input files and delete the entries while doing so */
     for (I = 0; I < CollCount (&InputFiles); ++I) {
@@ -832,6 +943,7 @@ static void ParseCommandLine (void)
                 OptStartGroup (NULL, 0);
                 break;
             case INPUT_FILES_EGROUP:
+                ObjLoadPending ();
                 OptEndGroup (NULL, 0);
                 break;
             default:
@@ -840,6 +952,9 @@ static void ParseCommandLine (void)
         FreeInputFile (F);
     }
 
+    /* Read the object files that are still pending */
+    ObjLoadPending ();
+
     /* Free memory used for input file array */
     DoneCollection (&InputFiles);
     InitCollection (&InputFiles);       /* Don't leave dangling pointers */
@@ -870,6 +985,19 @@ int main (int argc, char* argv [])
     /* Parse the command line */
     ParseCommandLine ();
 
+    /* If requested, try to update the output files of the last link, reading
+    ** only the object files that have changed.
+    */
+    if (StateFileName && CfgAvail ()) {
+        AddIncrInputs ();
+        if (IncrRelink ()) {
+            return EXIT_SUCCESS;
+        }
+    }
+
+    /* Read the object files and libraries */
+    LinkInputFiles ();
+
     /* Check if we had any object files */
     if (ObjFiles == 0) {
         Error ("No object files to link");
@@ -892,6 +1020,11 @@ int main (int argc, char* argv [])
     */
     MemoryAreaOverflows = CfgProcess ();
 
+    /* The segments don't move anymore, so the values of exports needn't be
+    ** computed more than once.
+    */
+    EnableExportValCache ();
+
     /* Check module assertions */
     CheckAssertions ();
 
@@ -931,6 +1064,11 @@ int main (int argc, char* argv [])
         CreateDbgFile ();
     }
 
+    /* Save the state of the link for the next incremental one */
+    if (StateFileName) {
+        IncrSaveState ();
+    }
+
     /* Dump the data for debugging */
     if (Verbosity > 1) {
         SegDump ();
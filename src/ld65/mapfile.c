@@ -89,10 +89,10 @@ void CreateMapFile (int ShortMap)
         }
         for (J = 0; J < CollCount (&O->Sections); ++J) {
             const Section* S = CollConstAt (&O->Sections, J);
-            /* Don't include zero sized sections if not explicitly
-            ** requested
+            /* Don't include removed sections, and zero sized sections if
+            ** not explicitly requested
             */
-            if (VerboseMap || S->Size > 0) {
+            if (S->Used && (VerboseMap || S->Size > 0)) {
                 fprintf (F,
                          "    %-17s Offs=%06lX  Size=%06lX  "
                          "Align=%05lX  Fill=%04lX\n",
@@ -108,6 +108,14 @@ void CreateMapFile (int ShortMap)
                 "-------------\n");
     PrintSegmentMap (F);
 
+    /* Write the load areas chosen by the linker if there are any */
+    if (CfgAutoSegmentCount () > 0) {
+        fprintf (F, "\n\n"
+                    "Segment placement:\n"
+                    "------------------\n");
+        CfgPrintSegmentPlacement (F);
+    }
+
     /* The remainder is not written for short map files */
     if (!ShortMap) {
 
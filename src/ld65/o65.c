@@ -36,7 +36,6 @@
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
-#include <errno.h>
 #include <time.h>
 
 /* common */
@@ -56,6 +55,7 @@
 #include "lineinfo.h"
 #include "memarea.h"
 #include "o65.h"
+#include "relax.h"
 #include "spool.h"
 
 
@@ -151,7 +151,7 @@ struct O65Desc {
     ExtSymTab*      Exports;            /* Table with exported symbols */
     ExtSymTab*      Imports;            /* Table with imported symbols */
     unsigned        Undef;              /* Count of undefined symbols */
-    FILE*           F;                  /* The file we're writing to */
+    OutFile*        F;                  /* The file we're writing to */
     const char*     Filename;           /* Name of the output file */
     O65RelocTab*    TextReloc;          /* Relocation table for text segment */
     O65RelocTab*    DataReloc;          /* Relocation table for data segment */
@@ -418,6 +418,10 @@ static void O65ParseExpr (ExprNode* Expr, ExprDesc* D, int Sign)
             }
             break;
 
+        case EXPR_RELAX:
+            D->Val += Sign * GetRelaxExprVal (Expr);
+            break;
+
         case EXPR_PLUS:
             O65ParseExpr (Expr->Left, D, Sign);
             O65ParseExpr (Expr->Right, D, Sign);
@@ -499,7 +503,7 @@ static void O65RelocPutWord (O65RelocTab* R, unsigned W)
 
 
 
-static void O65WriteReloc (O65RelocTab* R, FILE* F)
+static void O65WriteReloc (O65RelocTab* R, OutFile* F)
 /* Write the relocation table to the given file */
 {
     WriteData (F, R->Buf, R->Fill);
@@ -1370,10 +1374,7 @@ void O65WriteTarget (O65Desc* D, File* F)
     O65SetupHeader (D);
 
     /* Open the file */
-    D->F = fopen (D->Filename, "wb");
-    if (D->F == 0) {
-        Error ("Cannot open `%s': %s", D->Filename, strerror (errno));
-    }
+    D->F = OpenOutFile (D->Filename);
 
     /* Keep the user happy */
     Print (stdout, 1, "Opened '%s'...\n", D->Filename);
@@ -1425,13 +1426,11 @@ void O65WriteTarget (O65Desc* D, File* F)
     O65UpdateHeader (D);
 
     /* Seek back to the start and write the updated header */
-    fseek (D->F, 0, SEEK_SET);
+    OutFileSetPos (D->F, 0);
     O65WriteHeader (D);
 
     /* Close the file */
-    if (fclose (D->F) != 0) {
-        Error ("Cannot write to `%s': %s", D->Filename, strerror (errno));
-    }
+    CloseOutFile (D->F);
 
     /* Reset the file and filename */
     D->F        = 0;
@@ -79,10 +79,6 @@ ObjData* NewObjData (void)
     O->MTime            = 0;
     O->Start            = 0;
     O->Flags            = 0;
-    O->HLLSymBaseId     = 0;
-    O->SymBaseId        = 0;
-    O->ScopeBaseId      = 0;
-    O->SpanBaseId       = 0;
     O->Files            = EmptyCollection;
     O->Sections         = EmptyCollection;
     O->Exports          = EmptyCollection;
@@ -95,6 +91,7 @@ ObjData* NewObjData (void)
     O->Assertions       = EmptyCollection;
     O->Scopes           = EmptyCollection;
     O->Spans            = EmptyCollection;
+    O->RelaxFrags       = EmptyCollection;
 
     /* Return the new entry */
     return O;
@@ -137,6 +134,7 @@ void FreeObjData (ObjData* O)
         FreeSpan (CollAtUnchecked (&O->Spans, I));
     }
     DoneCollection (&O->Spans);
+    DoneCollection (&O->RelaxFrags);
 
     xfree (O);
 }
@@ -73,11 +73,6 @@ struct ObjData {
     unsigned long       Start;          /* Start offset of data in library */
     unsigned            Flags;
 
-    unsigned            HLLSymBaseId;   /* Debug info base id for hll symbols */
-    unsigned            SymBaseId;      /* Debug info base id for symbols */
-    unsigned            ScopeBaseId;    /* Debug info base id for scopes */
-    unsigned            SpanBaseId;     /* Debug info base id for spans */
-
     Collection          Files;          /* List of input files */
     Collection          Sections;       /* List of all sections */
     Collection          Exports;        /* List of all exports */
@@ -90,6 +85,7 @@ struct ObjData {
     Collection          Assertions;     /* List of module assertions */
     Collection          Scopes;         /* List of scopes */
     Collection          Spans;          /* List of spans */
+    Collection          RelaxFrags;     /* Instructions relaxed by the linker */
 };
 
 
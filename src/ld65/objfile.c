@@ -34,8 +34,13 @@
 
 
 #include <string.h>
+#if !defined(_WIN32) && !defined(_AMIGA)
+#  include <pthread.h>
+#endif
 
 /* common */
+#include "attrib.h"
+#include "coll.h"
 #include "fname.h"
 #include "xmalloc.h"
 
@@ -46,6 +51,7 @@
 #include "exports.h"
 #include "fileinfo.h"
 #include "fileio.h"
+#include "global.h"
 #include "lineinfo.h"
 #include "objdata.h"
 #include "objfile.h"
@@ -55,6 +61,29 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An object file that was added but is not yet decoded */
+typedef struct PendingObj PendingObj;
+struct PendingObj {
+    ObjData*    Obj;            /* Data of the object file */
+    InFile*     F;              /* File the data is read from */
+};
+
+/* Object files waiting to be decoded, and the index of the next one */
+static Collection       Pending = STATIC_COLLECTION_INITIALIZER;
+static unsigned         NextPending;
+
+#if !defined(_WIN32) && !defined(_AMIGA)
+static pthread_mutex_t  PendingLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -74,7 +103,7 @@ static unsigned GetModule (const char* Name)
 
 
 
-static void ObjReadHeader (FILE* Obj, ObjHeader* H, const char* Name)
+static void ObjReadHeader (InFile* Obj, ObjHeader* H, const char* Name)
 /* Read the header of the object file checking the signature */
 {
     H->Version    = Read16 (Obj);
@@ -109,7 +138,7 @@ static void ObjReadHeader (FILE* Obj, ObjHeader* H, const char* Name)
 
 
 
-void ObjReadFiles (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadFiles (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the files list from a file at the given position */
 {
     unsigned I;
@@ -128,8 +157,10 @@ void ObjReadFiles (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadSections (FILE* F, unsigned long Pos, ObjData* O)
-/* Read the section data from a file at the given position */
+static void ReadSections (InFile* F, unsigned long Pos, ObjData* O)
+/* Read the section data from a file at the given position, but don't add
+** the sections to their segments.
+*/
 {
     unsigned I;
     unsigned SectionCount;
@@ -147,7 +178,27 @@ void ObjReadSections (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadImports (FILE* F, unsigned long Pos, ObjData* O)
+static void AddSections (ObjData* O)
+/* Add the sections of an object file to their segments */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->Sections); ++I) {
+        AddSection (CollAtUnchecked (&O->Sections, I));
+    }
+}
+
+
+
+void ObjReadSections (InFile* F, unsigned long Pos, ObjData* O)
+/* Read the section data from a file at the given position */
+{
+    ReadSections (F, Pos, O);
+    AddSections (O);
+}
+
+
+
+void ObjReadImports (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the imports from a file at the given position */
 {
     unsigned I;
@@ -166,7 +217,7 @@ void ObjReadImports (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadExports (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadExports (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the exports from a file at the given position */
 {
     unsigned I;
@@ -185,12 +236,17 @@ void ObjReadExports (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadDbgSyms (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadDbgSyms (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the debug symbols from a file at the given position */
 {
     unsigned I;
     unsigned DbgSymCount;
 
+    /* Debug symbols are only used for the debug info and label files */
+    if (DbgFileName == 0 && LabelFileName == 0) {
+        return;
+    }
+
     /* Seek to the correct position */
     FileSetPos (F, Pos);
 
@@ -211,7 +267,7 @@ void ObjReadDbgSyms (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadLineInfos (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadLineInfos (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the line infos from a file at the given position */
 {
     unsigned I;
@@ -230,7 +286,7 @@ void ObjReadLineInfos (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadStrPool (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadStrPool (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the string pool from a file at the given position */
 {
     unsigned I;
@@ -248,7 +304,7 @@ void ObjReadStrPool (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadAssertions (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadAssertions (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the assertions from a file at the given offset */
 {
     unsigned I;
@@ -267,12 +323,17 @@ void ObjReadAssertions (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadScopes (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadScopes (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the scope table from a file at the given offset */
 {
     unsigned I;
     unsigned ScopeCount;
 
+    /* Scopes are only used for the debug info file */
+    if (DbgFileName == 0) {
+        return;
+    }
+
     /* Seek to the correct position */
     FileSetPos (F, Pos);
 
@@ -286,12 +347,17 @@ void ObjReadScopes (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjReadSpans (FILE* F, unsigned long Pos, ObjData* O)
+void ObjReadSpans (InFile* F, unsigned long Pos, ObjData* O)
 /* Read the span table from a file at the given offset */
 {
     unsigned I;
     unsigned SpanCount;
 
+    /* Spans are only used for the debug info file */
+    if (DbgFileName == 0) {
+        return;
+    }
+
     /* Seek to the correct position */
     FileSetPos (F, Pos);
 
@@ -305,62 +371,55 @@ void ObjReadSpans (FILE* F, unsigned long Pos, ObjData* O)
 
 
 
-void ObjAdd (FILE* Obj, const char* Name)
-/* Add an object file to the module list */
+static void ObjDecode (ObjData* O, InFile* F)
+/* Read the data of an object file that doesn't change global data, so this
+** may be done for several object files at the same time. String pool and
+** files list must already be read.
+*/
 {
-    /* Create a new structure for the object file data */
-    ObjData* O = NewObjData ();
-
-    /* The magic was already read and checked, so set it in the header */
-    O->Header.Magic = OBJ_MAGIC;
-
-    /* Read and check the header */
-    ObjReadHeader (Obj, &O->Header, Name);
-
-    /* Initialize the object module data structure */
-    O->Name  = GetModule (Name);
-
-    /* Read the string pool from the object file */
-    ObjReadStrPool (Obj, O->Header.StrPoolOffs, O);
-
-    /* Read the files list from the object file */
-    ObjReadFiles (Obj, O->Header.FileOffs, O);
-
     /* Read the line infos from the object file */
-    ObjReadLineInfos (Obj, O->Header.LineInfoOffs, O);
+    ObjReadLineInfos (F, O->Header.LineInfoOffs, O);
 
     /* Read the imports list from the object file */
-    ObjReadImports (Obj, O->Header.ImportOffs, O);
+    ObjReadImports (F, O->Header.ImportOffs, O);
 
-    /* Read the object file exports and insert them into the exports list */
-    ObjReadExports (Obj, O->Header.ExportOffs, O);
+    /* Read the object file exports */
+    ObjReadExports (F, O->Header.ExportOffs, O);
 
     /* Read the object debug symbols from the object file */
-    ObjReadDbgSyms (Obj, O->Header.DbgSymOffs, O);
-
-    /* Read the assertions from the object file */
-    ObjReadAssertions (Obj, O->Header.AssertOffs, O);
+    ObjReadDbgSyms (F, O->Header.DbgSymOffs, O);
 
     /* Read the segment list from the object file. This must be late, since
     ** the expressions stored in the code may reference segments or imported
     ** symbols.
     */
-    ObjReadSections (Obj, O->Header.SegOffs, O);
+    ReadSections (F, O->Header.SegOffs, O);
 
     /* Read the scope table from the object file. Scopes reference segments, so
     ** we must read them after the sections.
     */
-    ObjReadScopes (Obj, O->Header.ScopeOffs, O);
+    ObjReadScopes (F, O->Header.ScopeOffs, O);
 
     /* Read the spans from the object file */
-    ObjReadSpans (Obj, O->Header.SpanOffs, O);
+    ObjReadSpans (F, O->Header.SpanOffs, O);
+}
+
+
+
+void ObjInsert (ObjData* O, InFile* F)
+/* Add an object file decoded by ObjRead or ObjLoadPending to the module list */
+{
+    /* Read the assertions from the object file. They are kept in a global
+    ** list, so this is done here.
+    */
+    ObjReadAssertions (F, O->Header.AssertOffs, O);
+
+    /* Add the sections to their segments */
+    AddSections (O);
 
     /* Mark this object file as needed */
     O->Flags |= OBJ_REF;
 
-    /* Done, close the file (we read it only, so no error check) */
-    fclose (Obj);
-
     /* Insert the imports and exports to the global lists */
     InsertObjGlobals (O);
 
@@ -372,3 +431,174 @@ void ObjAdd (FILE* Obj, const char* Name)
     */
     FreeObjStrings (O);
 }
+
+
+
+static PendingObj* NextPendingObj (void)
+/* Return the next object file to decode, or NULL if there are no more */
+{
+    PendingObj* P = 0;
+
+#if !defined(_WIN32) && !defined(_AMIGA)
+    pthread_mutex_lock (&PendingLock);
+#endif
+    if (NextPending < CollCount (&Pending)) {
+        P = CollAtUnchecked (&Pending, NextPending++);
+    }
+#if !defined(_WIN32) && !defined(_AMIGA)
+    pthread_mutex_unlock (&PendingLock);
+#endif
+
+    return P;
+}
+
+
+
+static void* DecodePending (void* Arg attribute ((unused)))
+/* Decode pending object files until there are no more */
+{
+    PendingObj* P;
+    while ((P = NextPendingObj ()) != 0) {
+        ObjDecode (P->Obj, P->F);
+    }
+    return 0;
+}
+
+
+
+#if defined(_WIN32) || defined(_AMIGA)
+
+
+
+static void RunDecoders (unsigned Count attribute ((unused)))
+/* Decode the pending object files. There are no threads on this platform,
+** so this is done one by one.
+*/
+{
+    DecodePending (0);
+}
+
+
+
+#else
+
+
+
+static void RunDecoders (unsigned Count)
+/* Decode the pending object files using Count threads */
+{
+    unsigned   I;
+    pthread_t* Threads = xmalloc (Count * sizeof (pthread_t));
+
+    /* Start the threads. The current one is one of them. If a thread cannot
+    ** be created, just go on with the ones we have.
+    */
+    for (I = 1; I < Count; ++I) {
+        if (pthread_create (&Threads[I], 0, DecodePending, 0) != 0) {
+            break;
+        }
+    }
+    Count = I;
+    DecodePending (0);
+
+    /* Wait for the others */
+    for (I = 1; I < Count; ++I) {
+        pthread_join (Threads[I], 0);
+    }
+    xfree (Threads);
+}
+
+
+
+#endif
+
+
+
+static ObjData* ObjReadStart (InFile* Obj, const char* Name)
+/* Read the parts of an object file that are needed before it can be decoded */
+{
+    /* Create a new structure for the object file data */
+    ObjData* O = NewObjData ();
+
+    /* The magic was already read and checked, so set it in the header */
+    O->Header.Magic = OBJ_MAGIC;
+
+    /* Read and check the header */
+    ObjReadHeader (Obj, &O->Header, Name);
+
+    /* Initialize the object module data structure */
+    O->Name  = GetModule (Name);
+
+    /* Read the string pool from the object file. This is done here, so the
+    ** strings get the same ids as if the object files were read one by one.
+    */
+    ObjReadStrPool (Obj, O->Header.StrPoolOffs, O);
+
+    /* Read the files list from the object file */
+    ObjReadFiles (Obj, O->Header.FileOffs, O);
+
+    /* Return the data read so far */
+    return O;
+}
+
+
+
+ObjData* ObjRead (InFile* Obj, const char* Name)
+/* Read an object file without adding it to the module list. Apart from the
+** string pool and the list of source files, no global data is changed, so
+** the object file may be dropped if it isn't needed. Use ObjInsert to add it
+** to the module list.
+*/
+{
+    ObjData* O = ObjReadStart (Obj, Name);
+    ObjDecode (O, Obj);
+    return O;
+}
+
+
+
+void ObjAdd (InFile* Obj, const char* Name)
+/* Add an object file to the module list. The object file is read when
+** ObjLoadPending is called.
+*/
+{
+    PendingObj* P;
+
+    /* Read the header, string pool and files list */
+    ObjData* O = ObjReadStart (Obj, Name);
+
+    /* The rest of the object file is read later. The file is never closed,
+    ** since the literal data of the sections is used in place.
+    */
+    P = xmalloc (sizeof (PendingObj));
+    P->Obj = O;
+    P->F   = Obj;
+    CollAppend (&Pending, P);
+}
+
+
+
+void ObjLoadPending (void)
+/* Read the object files added by ObjAdd, using up to MaxJobs threads, then
+** add them to the module list in the order they were added.
+*/
+{
+    unsigned I;
+    unsigned Count = CollCount (&Pending);
+
+    /* Decode the object files */
+    NextPending = 0;
+    if (Count > 1 && MaxJobs > 1) {
+        RunDecoders (Count < MaxJobs? Count : MaxJobs);
+    } else {
+        DecodePending (0);
+    }
+
+    /* Add them in order */
+    for (I = 0; I < Count; ++I) {
+        PendingObj* P = CollAtUnchecked (&Pending, I);
+        ObjInsert (P->Obj, P->F);
+        xfree (P);
+    }
+    CollDeleteAll (&Pending);
+}
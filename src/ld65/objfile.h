@@ -44,6 +44,7 @@
 #include "objdefs.h"
 
 /* ld65 */
+#include "fileio.h"
 #include "objdata.h"
 
 
@@ -54,38 +55,55 @@
 
 
 
-void ObjReadFiles (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadFiles (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the files list from a file at the given position */
 
-void ObjReadSections (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadSections (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the section data from a file at the given position */
 
-void ObjReadImports (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadImports (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the imports from a file at the given position */
 
-void ObjReadExports (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadExports (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the exports from a file at the given position */
 
-void ObjReadDbgSyms (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadDbgSyms (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the debug symbols from a file at the given position */
 
-void ObjReadLineInfos (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadLineInfos (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the line infos from a file at the given position */
 
-void ObjReadStrPool (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadStrPool (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the string pool from a file at the given position */
 
-void ObjReadAssertions (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadAssertions (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the assertions from a file at the given offset */
 
-void ObjReadScopes (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadScopes (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the scope table from a file at the given offset */
 
-void ObjReadSpans (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadSpans (InFile* F, unsigned long Pos, ObjData* O);
 /* Read the span table from a file at the given offset */
 
-void ObjAdd (FILE* F, const char* Name);
-/* Add an object file to the module list */
+ObjData* ObjRead (InFile* F, const char* Name);
+/* Read an object file without adding it to the module list. Apart from the
+** string pool and the list of source files, no global data is changed, so
+** the object file may be dropped if it isn't needed. Use ObjInsert to add it
+** to the module list.
+*/
+
+void ObjInsert (ObjData* O, InFile* F);
+/* Add an object file decoded by ObjRead or ObjLoadPending to the module list */
+
+void ObjAdd (InFile* F, const char* Name);
+/* Add an object file to the module list. The object file is read when
+** ObjLoadPending is called.
+*/
+
+void ObjLoadPending (void);
+/* Read the object files added by ObjAdd, using up to MaxJobs threads, then
+** add them to the module list in the order they were added.
+*/
 
 
 
@@ -0,0 +1,280 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.c                                  */
+/*                                                                           */
+/*               Relaxation of instructions for the ld65 linker              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* The assembler leaves the choice between the short and the long form of some
+** instructions to the linker: Absolute or zero page addressing of imports,
+** and JMP or BRA for jumps to imports and other segments. The object file
+** contains the long form.
+**
+** The linker starts with the short form of all of these instructions, places
+** the segments, and uses the long form for each instruction whose operand
+** doesn't fit into the short form. This is repeated until no instruction
+** changes its size. Since instructions are only made larger, this terminates.
+**
+** Labels behind relaxed instructions reference the last one of them in their
+** section with an EXPR_RELAX node. Its value is the size change of the section
+** up to and including this instruction.
+*/
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "check.h"
+#include "coll.h"
+#include "fragdefs.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "exports.h"
+#include "expr.h"
+#include "fragment.h"
+#include "memarea.h"
+#include "objdata.h"
+#include "relax.h"
+#include "segments.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Sizes of the two forms of a relaxed instruction */
+#define SHORT_SIZE      2U
+#define LONG_SIZE       3U
+
+/* An instruction relaxed by the linker */
+typedef struct RelaxFrag RelaxFrag;
+struct RelaxFrag {
+    Fragment*           Frag;           /* Fragment, its size is the chosen form */
+    unsigned            SecNum;         /* Number of the section in the object file */
+    unsigned long       Offs;           /* Offset in the section as assembled */
+    long                Delta;          /* Size change of the section up to here */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void NewRelaxFrag (ObjData* O, Fragment* Frag, unsigned SecNum)
+/* Remember a fragment with an instruction that is relaxed by the linker. Frag
+** is the last fragment of the section with the given number, which is read
+** from the object file.
+*/
+{
+    /* Allocate memory */
+    RelaxFrag* R = xmalloc (sizeof (RelaxFrag));
+
+    /* Initialize the fields */
+    R->Frag     = Frag;
+    R->SecNum   = SecNum;
+    R->Offs     = Frag->Sec->Size - Frag->Size;
+    R->Delta    = 0;
+
+    /* The index in the list is the one used by EXPR_RELAX nodes */
+    CollAppend (&O->RelaxFrags, R);
+}
+
+
+
+long GetRelaxExprVal (ExprNode* Expr)
+/* Return the size change of the section up to the relaxed instruction that
+** is referenced by an EXPR_RELAX node.
+*/
+{
+    const RelaxFrag* R;
+
+    /* Check that this is really a relax node from an object file */
+    PRECONDITION (Expr->Op == EXPR_RELAX && Expr->Obj != 0);
+
+    R = CollAt (&Expr->Obj->RelaxFrags, Expr->V.IVal);
+    return R->Delta;
+}
+
+
+
+unsigned long GetRelaxedOffs (const ObjData* O, unsigned SecNum, unsigned long Offs)
+/* Translate an offset in a section of an object file as it was assembled into
+** the offset after relaxation.
+*/
+{
+    /* The fragments are sorted by section and offset. Search for the last one
+    ** that ends at or before the given offset.
+    */
+    const RelaxFrag* Found = 0;
+    int Lo = 0;
+    int Hi = (int) CollCount (&O->RelaxFrags) - 1;
+    while (Lo <= Hi) {
+        int Cur = (Lo + Hi) / 2;
+        const RelaxFrag* R = CollConstAt (&O->RelaxFrags, Cur);
+        if (R->SecNum < SecNum ||
+            (R->SecNum == SecNum && R->Offs + LONG_SIZE <= Offs)) {
+            Found = R;
+            Lo = Cur + 1;
+        } else {
+            Hi = Cur - 1;
+        }
+    }
+    return (Found && Found->SecNum == SecNum)? Offs + Found->Delta : Offs;
+}
+
+
+
+static void SetSize (RelaxFrag* R, unsigned Size)
+/* Choose the form of a relaxed instruction */
+{
+    Section* S = R->Frag->Sec;
+    S->Size = S->Size - R->Frag->Size + Size;
+    R->Frag->Size = Size;
+}
+
+
+
+static void CalcDeltas (void)
+/* Calculate the size changes of the sections up to all relaxed instructions
+** and place the sections again.
+*/
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O      = CollAtUnchecked (&ObjDataList, I);
+        unsigned SecNum = 0;
+        long     Delta  = 0;
+        for (J = 0; J < CollCount (&O->RelaxFrags); ++J) {
+            RelaxFrag* R = CollAtUnchecked (&O->RelaxFrags, J);
+            if (R->SecNum != SecNum) {
+                SecNum = R->SecNum;
+                Delta  = 0;
+            }
+            Delta += (long) R->Frag->Size - (long) LONG_SIZE;
+            R->Delta = Delta;
+        }
+    }
+
+    SegRelayout ();
+}
+
+
+
+static int ShortFormOk (const RelaxFrag* R)
+/* Return true if the short form of a relaxed instruction may be used with
+** the current placement of the segments.
+*/
+{
+    const Fragment*   F = R->Frag;
+    const Section*    S = F->Sec;
+    const MemoryArea* M = S->Seg->MemArea;
+    long              Val;
+
+    if (!IsConstExpr (F->Expr)) {
+        return 0;
+    }
+    Val = GetExprVal (F->Expr);
+
+    if (F->Type == FRAG_RELAX_ZP) {
+        return Val >= 0 && Val <= 0xFF;
+    }
+
+    /* A branch needs its own address, which is relative to the end of the
+    ** instruction.
+    */
+    if (M == 0 || M->Relocatable) {
+        return 0;
+    }
+    Val -= (long) (S->Seg->PC + S->Offs + R->Offs + LONG_SIZE) + R->Delta;
+    return Val >= -128 && Val <= 127;
+}
+
+
+
+void RelaxStart (void)
+/* Use the short form for all relaxed instructions. The segments must be
+** placed after this.
+*/
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->RelaxFrags); ++J) {
+            RelaxFrag* R = CollAtUnchecked (&O->RelaxFrags, J);
+            if (R->Frag->Sec->Used) {
+                SetSize (R, SHORT_SIZE);
+            }
+        }
+    }
+    CalcDeltas ();
+}
+
+
+
+int RelaxSections (void)
+/* Check the relaxed instructions after the segments were placed. Instructions
+** whose short form cannot be used get their long form. Return true if any
+** instruction has changed its size, in which case the segments must be placed
+** again.
+*/
+{
+    unsigned I, J;
+    int      Changed = 0;
+
+    /* The offsets and values used by ShortFormOk don't change before the
+    ** sections are placed again, so all instructions are checked against the
+    ** same placement, and the values of exports may be cached meanwhile.
+    */
+    EnableExportValCache ();
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->RelaxFrags); ++J) {
+            RelaxFrag* R = CollAtUnchecked (&O->RelaxFrags, J);
+            if (R->Frag->Size == SHORT_SIZE && !ShortFormOk (R)) {
+                SetSize (R, LONG_SIZE);
+                Changed = 1;
+            }
+        }
+    }
+    DisableExportValCache ();
+
+    if (Changed) {
+        CalcDeltas ();
+    }
+    return Changed;
+}
@@ -0,0 +1,85 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.h                                  */
+/*                                                                           */
+/*               Relaxation of instructions for the ld65 linker              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* Copyright 2026 The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef RELAX_H
+#define RELAX_H
+
+
+
+/* common */
+#include "exprdefs.h"
+
+/* ld65 */
+#include "fragment.h"
+#include "objdata.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void NewRelaxFrag (ObjData* O, Fragment* Frag, unsigned SecNum);
+/* Remember a fragment with an instruction that is relaxed by the linker. Frag
+** is the last fragment of the section with the given number, which is read
+** from the object file.
+*/
+
+long GetRelaxExprVal (ExprNode* Expr);
+/* Return the size change of the section up to the relaxed instruction that
+** is referenced by an EXPR_RELAX node.
+*/
+
+unsigned long GetRelaxedOffs (const ObjData* O, unsigned SecNum, unsigned long Offs);
+/* Translate an offset in a section of an object file as it was assembled into
+** the offset after relaxation.
+*/
+
+void RelaxStart (void);
+/* Use the short form for all relaxed instructions. The segments must be
+** placed after this.
+*/
+
+int RelaxSections (void);
+/* Check the relaxed instructions after the segments were placed. Instructions
+** whose short form cannot be used get their long form. Return true if any
+** instruction has changed its size, in which case the segments must be placed
+** again.
+*/
+
+
+
+/* End of relax.h */
+
+#endif
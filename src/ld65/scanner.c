@@ -535,6 +535,14 @@ void CfgSetName (const char* Name)
 
 
 
+const char* CfgGetName (void)
+/* Get the name of the config file, NULL if there is none */
+{
+    return CfgName;
+}
+
+
+
 int CfgAvail (void)
 /* Return true if we have a configuration available */
 {
@@ -225,6 +225,9 @@ void CfgBoolToken (void);
 void CfgSetName (const char* Name);
 /* Set a name for a config file */
 
+const char* CfgGetName (void);
+/* Get the name of the config file, NULL if there is none */
+
 int CfgAvail (void);
 /* Return true if we have a configuration available */
 
@@ -37,6 +37,8 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
+#include "dbgsyms.h"
 #include "error.h"
 #include "fileio.h"
 #include "scopes.h"
@@ -63,6 +65,7 @@ static Scope* NewScope (ObjData* Obj, unsigned Id)
     S->Size     = 0;
     S->LabelId  = ~0U;
     S->Spans    = 0;
+    S->DbgId    = INVALID_DBG_ID;
 
     /* Return the new entry */
     return S;
@@ -70,7 +73,7 @@ static Scope* NewScope (ObjData* Obj, unsigned Id)
 
 
 
-Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id)
+Scope* ReadScope (InFile* F, ObjData* Obj, unsigned Id)
 /* Read a scope from a file and return it */
 {
     /* Create a new scope */
@@ -97,24 +100,82 @@ Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id)
 
 
 unsigned ScopeCount (void)
-/* Return the total number of scopes */
+/* Return the total number of scopes written to the debug info file */
 {
 
     /* Count scopes from all modules we have linked into the output file */
-    unsigned I;
+    unsigned I, J;
     unsigned Count = 0;
     for (I = 0; I < CollCount (&ObjDataList); ++I) {
         /* Get the object file */
         const ObjData* O = CollAtUnchecked (&ObjDataList, I);
 
         /* Account for the scopes in this file */
-        Count += CollCount (&O->Scopes);
+        for (J = 0; J < CollCount (&O->Scopes); ++J) {
+            const Scope* S = CollConstAt (&O->Scopes, J);
+            if (S->DbgId != INVALID_DBG_ID) {
+                ++Count;
+            }
+        }
     }
     return Count;
 }
 
 
 
+static int ScopeIsRemoved (const ObjData* O, const Scope* S)
+/* Return true if the scope isn't written to the debug info file */
+{
+    /* The scope of the module itself is always kept */
+    if (S->Id == S->ParentId) {
+        return 0;
+    }
+
+    /* Scopes whose spans were all removed are removed, and so are scopes
+    ** within a removed scope.
+    */
+    return SpanListIsRemoved (O, S->Spans) ||
+           ScopeIsRemoved (O, CollConstAt (&O->Scopes, S->ParentId));
+}
+
+
+
+unsigned AssignScopeDbgIds (ObjData* O, unsigned Id)
+/* Assign the debug info ids to the scopes of the given module, starting with
+** Id, and return the next free id. Scopes whose code is removed completely by
+** --gc-sections, and the scopes nested in them, don't get an id. The ids of
+** the spans must have been assigned before.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->Scopes); ++I) {
+        Scope* S = CollAtUnchecked (&O->Scopes, I);
+        if (ScopeIsRemoved (O, S)) {
+            S->DbgId = INVALID_DBG_ID;
+        } else {
+            S->DbgId = Id++;
+        }
+    }
+    return Id;
+}
+
+
+
+unsigned GetScopeDbgId (const ObjData* O, unsigned Id)
+/* Return the debug info id of the scope with the given id in the module, or
+** INVALID_DBG_ID if it is not written to the debug info file.
+*/
+{
+    const Scope* S;
+    if (Id >= CollCount (&O->Scopes)) {
+        Error ("Invalid scope index (%u) in module `%s'", Id, GetObjFileName (O));
+    }
+    S = CollConstAt (&O->Scopes, Id);
+    return S->DbgId;
+}
+
+
+
 void PrintDbgScopes (FILE* F)
 /* Output the scopes to a debug info file */
 {
@@ -130,10 +191,15 @@ void PrintDbgScopes (FILE* F)
         for (J = 0; J < CollCount (&O->Scopes); ++J) {
             const Scope* S = CollConstAt (&O->Scopes, J);
 
+            /* Skip scopes of removed code */
+            if (S->DbgId == INVALID_DBG_ID) {
+                continue;
+            }
+
             /* Output the first chunk of data */
             fprintf (F,
                      "scope\tid=%u,name=\"%s\",mod=%u",
-                     O->ScopeBaseId + S->Id,
+                     S->DbgId,
                      GetString (S->Name),
                      I);
 
@@ -157,11 +223,14 @@ void PrintDbgScopes (FILE* F)
             }
             /* Print parent if available */
             if (S->Id != S->ParentId) {
-                fprintf (F, ",parent=%u", O->ScopeBaseId + S->ParentId);
+                fprintf (F, ",parent=%u", GetScopeDbgId (O, S->ParentId));
             }
-            /* Print the label id if the scope is labeled */
-            if (SCOPE_HAS_LABEL (S->Flags)) {
-                fprintf (F, ",sym=%u", O->SymBaseId + S->LabelId);
+            /* Print the label id if the scope is labeled, and the label was
+            ** not removed.
+            */
+            if (SCOPE_HAS_LABEL (S->Flags) &&
+                GetDbgSymDbgId (O, S->LabelId) != INVALID_DBG_ID) {
+                fprintf (F, ",sym=%u", GetDbgSymDbgId (O, S->LabelId));
             }
             /* Print the list of spans for this scope */
             PrintDbgSpanList (F, O, S->Spans);
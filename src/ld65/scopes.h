@@ -45,6 +45,7 @@
 #include "scopedefs.h"
 
 /* ld65 */
+#include "fileio.h"
 #include "objdata.h"
 
 
@@ -68,6 +69,7 @@ struct Scope {
     unsigned            Name;           /* Name of scope */
     unsigned long       Size;           /* Size of scope */
     unsigned*           Spans;          /* Spans for this scope */
+    unsigned            DbgId;          /* Id in the debug info file */
 };
 
 
@@ -78,11 +80,23 @@ struct Scope {
 
 
 
-Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id);
+Scope* ReadScope (InFile* F, ObjData* Obj, unsigned Id);
 /* Read a scope from a file, insert and return it */
 
 unsigned ScopeCount (void);
-/* Return the total number of scopes */
+/* Return the total number of scopes written to the debug info file */
+
+unsigned AssignScopeDbgIds (ObjData* O, unsigned Id);
+/* Assign the debug info ids to the scopes of the given module, starting with
+** Id, and return the next free id. Scopes whose code is removed completely by
+** --gc-sections, and the scopes nested in them, don't get an id. The ids of
+** the spans must have been assigned before.
+*/
+
+unsigned GetScopeDbgId (const ObjData* O, unsigned Id);
+/* Return the debug info id of the scope with the given id in the module, or
+** INVALID_DBG_ID if it is not written to the debug info file.
+*/
 
 void PrintDbgScopes (FILE* F);
 /* Output the scopes to a debug info file */
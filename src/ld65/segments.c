@@ -56,6 +56,7 @@
 #include "fragment.h"
 #include "global.h"
 #include "lineinfo.h"
+#include "relax.h"
 #include "segments.h"
 #include "spool.h"
 
@@ -155,22 +156,36 @@ Segment* GetSegment (unsigned Name, unsigned char AddrSize, const char* ObjName)
 
 
 
-Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSize)
-/* Create a new section for the given segment */
+static Section* AllocSection (unsigned long Alignment, unsigned char AddrSize)
+/* Create a new section that is not yet part of a segment */
 {
     /* Allocate memory */
     Section* S = xmalloc (sizeof (Section));
 
     /* Initialize the data */
     S->Next     = 0;
-    S->Seg      = Seg;
+    S->Seg      = 0;
     S->Obj      = 0;
     S->FragRoot = 0;
     S->FragLast = 0;
+    S->Offs     = 0;
     S->Size     = 0;
+    S->Fill     = 0;
     S->Alignment= Alignment;
+    S->Name     = INVALID_STRING_ID;
+    S->Flags    = SEG_FLAG_NONE;
     S->AddrSize = AddrSize;
+    S->Used     = 1;
+
+    /* Return the struct */
+    return S;
+}
 
+
+
+static void SetSectionOffs (Segment* Seg, Section* S)
+/* Place a section behind the data of a segment */
+{
     /* Calculate the alignment bytes needed for the section */
     S->Fill = AlignCount (Seg->Size, S->Alignment);
 
@@ -178,69 +193,55 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
     Seg->Size  += S->Fill;
     S->Offs     = Seg->Size;    /* Current size is offset */
 
+    /* Add the data that was already read */
+    Seg->Size  += S->Size;
+}
+
+
+
+static void PlaceSection (Segment* Seg, Section* S)
+/* Append a section to a segment */
+{
+    S->Seg = Seg;
+
+    /* Calculate the offset of the section */
+    SetSectionOffs (Seg, S);
+
     /* Insert the section into the segment */
     CollAppend (&Seg->Sections, S);
+}
 
-    /* Return the struct */
+
+
+Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSize)
+/* Create a new section for the given segment */
+{
+    Section* S = AllocSection (Alignment, AddrSize);
+    PlaceSection (Seg, S);
     return S;
 }
 
 
 
-Section* ReadSection (FILE* F, ObjData* O)
-/* Read a section from a file */
+Section* ReadSection (InFile* F, ObjData* O)
+/* Read a section from a file. The section is not yet part of a segment, this
+** is done by AddSection. Since no global data is changed, sections of
+** different object files may be read at the same time.
+*/
 {
-    unsigned      Name;
-    unsigned      Size;
-    unsigned long Alignment;
-    unsigned char Type;
     unsigned      FragCount;
-    Segment*      S;
     Section*      Sec;
 
     /* Read the segment data */
     (void) Read32 (F);          /* File size of data */
-    Name      = MakeGlobalStringId (O, ReadVar (F));    /* Segment name */
-                ReadVar (F);    /* Segment flags (currently unused) */
-    Size      = ReadVar (F);    /* Size of data */
-    Alignment = ReadVar (F);    /* Alignment */
-    Type      = Read8 (F);      /* Segment type */
-    FragCount = ReadVar (F);    /* Number of fragments */
-
-
-    /* Print some data */
-    Print (stdout, 2,
-           "Module '%s': Found segment '%s', size = %u, alignment = %lu, type = %u\n",
-           GetObjFileName (O), GetString (Name), Size, Alignment, Type);
-
-    /* Get the segment for this section */
-    S = GetSegment (Name, Type, GetObjFileName (O));
-
-    /* Allocate the section we will return later */
-    Sec = NewSection (S, Alignment, Type);
-
-    /* Remember the object file this section was from */
-    Sec->Obj = O;
-
-    /* Set up the combined segment alignment */
-    if (Sec->Alignment > 1) {
-        Alignment = LeastCommonMultiple (S->Alignment, Sec->Alignment);
-        if (Alignment > MAX_ALIGNMENT) {
-            Error ("Combined alignment for segment `%s' is %lu which exceeds "
-                   "%lu. Last module requiring alignment was `%s'.",
-                   GetString (Name), Alignment, MAX_ALIGNMENT,
-                   GetObjFileName (O));
-        } else if (Alignment >= LARGE_ALIGNMENT && Alignment > S->Alignment && Alignment > Sec->Alignment && !LargeAlignment) {
-            Warning ("Combined alignment for segment `%s' is suspiciously "
-                     "large (%lu). Last module requiring alignment was `%s'.",
-                     GetString (Name), Alignment, GetObjFileName (O));
-        }
-        S->Alignment = Alignment;
-        if (WarnAlignWaste && Sec->Fill != 0) {
-            Warning("%s: Wasting %lu bytes for `%s' alignment",
-                    GetObjFileName (O), Sec->Fill, GetString (Name));
-        }
-    }
+    Sec = AllocSection (0, ADDR_SIZE_DEFAULT);
+    Sec->Obj       = O;
+    Sec->Name      = MakeGlobalStringId (O, ReadVar (F));   /* Segment name */
+    Sec->Flags     = ReadVar (F);       /* Segment flags */
+                     ReadVar (F);       /* Size of data, sum of the fragments */
+    Sec->Alignment = ReadVar (F);       /* Alignment */
+    Sec->AddrSize  = Read8 (F);         /* Segment type */
+    FragCount      = ReadVar (F);       /* Number of fragments */
 
     /* Start reading fragments from the file and insert them into the section . */
     while (FragCount--) {
@@ -259,7 +260,7 @@ Section* ReadSection (FILE* F, ObjData* O)
 
             case FRAG_LITERAL:
                 Frag = NewFragment (Type, ReadVar (F), Sec);
-                ReadData (F, Frag->LitBuf, Frag->Size);
+                Frag->LitBuf = ReadMem (F, Frag->Size);
                 break;
 
             case FRAG_EXPR:
@@ -273,9 +274,26 @@ Section* ReadSection (FILE* F, ObjData* O)
                 Frag = NewFragment (Type, ReadVar (F), Sec);
                 break;
 
+            case FRAG_RELAX:
+                /* The opcodes of the short and the long form, followed by
+                ** the operand of the long form. The fragment type includes
+                ** the kind of instruction.
+                */
+                Type |= Bytes;
+                if (Type != FRAG_RELAX_ZP && Type != FRAG_RELAX_BRA) {
+                    Error ("Unknown fragment type in module `%s', segment `%s': %02X",
+                           GetObjFileName (O), GetString (Sec->Name), Type);
+                }
+                Frag = NewFragment (Type, 3, Sec);
+                Frag->LitBuf = ReadMem (F, 2);
+                Frag->Expr = ReadExpr (F, O);
+                /* The section is appended to the list when it is complete */
+                NewRelaxFrag (O, Frag, CollCount (&O->Sections));
+                break;
+
             default:
                 Error ("Unknown fragment type in module `%s', segment `%s': %02X",
-                       GetObjFileName (O), GetString (S->Name), Type);
+                       GetObjFileName (O), GetString (Sec->Name), Type);
                 /* NOTREACHED */
                 return 0;
         }
@@ -293,6 +311,112 @@ Section* ReadSection (FILE* F, ObjData* O)
 
 
 
+void AddSection (Section* Sec)
+/* Add a section read by ReadSection to its segment */
+{
+    unsigned long Alignment;
+    Segment*      S;
+    ObjData*      O = Sec->Obj;
+
+    /* Print some data */
+    Print (stdout, 2,
+           "Module '%s': Found segment '%s', size = %lu, alignment = %lu, type = %u\n",
+           GetObjFileName (O), GetString (Sec->Name), Sec->Size,
+           Sec->Alignment, Sec->AddrSize);
+
+    /* Get the segment for this section */
+    S = GetSegment (Sec->Name, Sec->AddrSize, GetObjFileName (O));
+
+    /* Append the section to the segment */
+    PlaceSection (S, Sec);
+
+    /* Set up the combined segment alignment */
+    if (Sec->Alignment > 1) {
+        Alignment = LeastCommonMultiple (S->Alignment, Sec->Alignment);
+        if (Alignment > MAX_ALIGNMENT) {
+            Error ("Combined alignment for segment `%s' is %lu which exceeds "
+                   "%lu. Last module requiring alignment was `%s'.",
+                   GetString (Sec->Name), Alignment, MAX_ALIGNMENT,
+                   GetObjFileName (O));
+        } else if (Alignment >= LARGE_ALIGNMENT && Alignment > S->Alignment && Alignment > Sec->Alignment && !LargeAlignment) {
+            Warning ("Combined alignment for segment `%s' is suspiciously "
+                     "large (%lu). Last module requiring alignment was `%s'.",
+                     GetString (Sec->Name), Alignment, GetObjFileName (O));
+        }
+        S->Alignment = Alignment;
+        if (WarnAlignWaste && Sec->Fill != 0) {
+            Warning("%s: Wasting %lu bytes for `%s' alignment",
+                    GetObjFileName (O), Sec->Fill, GetString (Sec->Name));
+        }
+    }
+}
+
+
+
+unsigned long SegRemoveUnused (void)
+/* Remove the sections that are not marked as used from their segments, and
+** place the remaining sections again. Return the number of bytes removed.
+*/
+{
+    unsigned      I;
+    unsigned long Removed = 0;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+
+        unsigned J, K;
+
+        /* Get the segment and remember its size */
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        unsigned long OldSize = Seg->Size;
+
+        /* Walk over the sections. Used ones are placed again, since their
+        ** offsets and alignment may change.
+        */
+        Seg->Size = 0;
+        for (J = 0, K = 0; J < CollCount (&Seg->Sections); ++J) {
+            Section* S = CollAtUnchecked (&Seg->Sections, J);
+            if (S->Used) {
+                SetSectionOffs (Seg, S);
+                CollReplace (&Seg->Sections, S, K++);
+            } else {
+                Print (stdout, 2,
+                       "Module '%s': Removing section of segment '%s', size = %lu\n",
+                       GetObjFileName (S->Obj), GetString (Seg->Name), S->Size);
+                S->Offs = 0;
+                S->Fill = 0;
+            }
+        }
+
+        /* Drop the rest of the list */
+        while (CollCount (&Seg->Sections) > K) {
+            CollPop (&Seg->Sections);
+        }
+
+        /* Account for the removed data */
+        Removed += OldSize - Seg->Size;
+    }
+
+    return Removed;
+}
+
+
+
+void SegRelayout (void)
+/* Place the sections of all segments again after their sizes have changed */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        Seg->Size = 0;
+        for (J = 0; J < CollCount (&Seg->Sections); ++J) {
+            SetSectionOffs (Seg, CollAtUnchecked (&Seg->Sections, J));
+        }
+    }
+}
+
+
+
 Segment* SegFind (unsigned Name)
 /* Return the given segment or NULL if not found. */
 {
@@ -328,7 +452,7 @@ Section* GetNonBSSSection (Segment* S)
         Fragment* F = Sec->FragRoot;
         while (F) {
             if (F->Type == FRAG_LITERAL) {
-                unsigned char* Data = F->LitBuf;
+                const unsigned char* Data = F->LitBuf;
                 unsigned long Count = F->Size;
                 while (Count--) {
                     if (*Data++ != 0) {
@@ -339,6 +463,9 @@ Section* GetNonBSSSection (Segment* S)
                 if (GetExprVal (F->Expr) != 0) {
                     return Sec;
                 }
+            } else if ((F->Type & FRAG_TYPEMASK) == FRAG_RELAX) {
+                /* An instruction is never zero */
+                return Sec;
             }
             F = F->Next;
         }
@@ -355,7 +482,7 @@ void SegDump (void)
 {
     unsigned I, J;
     unsigned long Count;
-    unsigned char* Data;
+    const unsigned char* Data;
 
     for (I = 0; I < CollCount (&SegmentList); ++I) {
         Segment* Seg = CollAtUnchecked (&SegmentList, I);
@@ -400,6 +527,14 @@ void SegDump (void)
                         printf ("    Empty space (%u bytes)\n", F->Size);
                         break;
 
+                    case FRAG_RELAX_ZP:
+                    case FRAG_RELAX_BRA:
+                        printf ("    Relaxed instruction (%u bytes): %02X\n",
+                                F->Size, F->LitBuf[F->Size == 2? 0 : 1]);
+                        printf ("      ");
+                        DumpExpr (F->Expr, 0);
+                        break;
+
                     default:
                         Internal ("Invalid fragment type: %02X", F->Type);
                 }
@@ -411,7 +546,7 @@ void SegDump (void)
 
 
 
-unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
+unsigned SegWriteConstExpr (OutFile* F, ExprNode* E, int Signed, unsigned Size)
 /* Write a supposedly constant expression to the target file. Do a range
 ** check and return one of the SEG_EXPR_xxx codes.
 */
@@ -455,25 +590,141 @@ unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
 
 
 
-void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void* Data)
+static void SegWriteExpr (const Fragment* Frag, ExprNode* E, int Signed,
+                          unsigned Size, unsigned long Offs,
+                          SegWriteFunc F, void* Data)
+/* Write an expression of a fragment by calling F, and report errors */
+{
+    switch (F (E, Signed, Size, Offs, Data)) {
+
+        case SEG_EXPR_OK:
+            break;
+
+        case SEG_EXPR_RANGE_ERROR:
+            Error ("Range error in module `%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        case SEG_EXPR_TOO_COMPLEX:
+            Error ("Expression too complex in module `%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        case SEG_EXPR_INVALID:
+            Error ("Invalid expression in module `%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        default:
+            Internal ("Invalid return code from SegWriteFunc");
+    }
+}
+
+
+
+static void SegWriteRelaxed (OutFile* Tgt, Segment* S, const Fragment* Frag,
+                             unsigned long Offs, SegWriteFunc F, void* Data)
+/* Write an instruction relaxed by the linker in the form that was chosen */
+{
+    ExprNode* E;
+
+    if (Frag->Size == 3) {
+        /* Long form as assembled */
+        Write8 (Tgt, Frag->LitBuf[1]);
+        SegWriteExpr (Frag, Frag->Expr, 0, 2, Offs + 1, F, Data);
+    } else if (Frag->Type == FRAG_RELAX_ZP) {
+        /* Zero page address */
+        Write8 (Tgt, Frag->LitBuf[0]);
+        SegWriteExpr (Frag, Frag->Expr, 0, 1, Offs + 1, F, Data);
+    } else {
+        /* Branch, the distance is relative to the end of the instruction */
+        Write8 (Tgt, Frag->LitBuf[0]);
+        E = NewExprNode (0, EXPR_MINUS);
+        E->Left  = Frag->Expr;
+        E->Right = SegmentExpr (S, Offs + 2, 0);
+        SegWriteExpr (Frag, E, 1, 1, Offs + 1, F, Data);
+        E->Left  = 0;
+        FreeExpr (E);
+    }
+}
+
+
+
+static unsigned long SecWrite (OutFile* Tgt, Section* Sec, unsigned long Offs,
+                               SegWriteFunc F, void* Data)
+/* Write the fragments of a section to a file. Offs is the offset of the
+** section data within its segment. The function returns the offset behind
+** the data.
+*/
+{
+    Segment*  S    = Sec->Seg;
+    Fragment* Frag = Sec->FragRoot;
+
+    /* Loop over all fragments in this section */
+    while (Frag) {
+
+        /* Output fragment data */
+        switch (Frag->Type) {
+
+            case FRAG_LITERAL:
+                WriteData (Tgt, Frag->LitBuf, Frag->Size);
+                break;
+
+            case FRAG_EXPR:
+            case FRAG_SEXPR:
+                /* Call the users function and evaluate the result */
+                SegWriteExpr (Frag, Frag->Expr, Frag->Type == FRAG_SEXPR,
+                              Frag->Size, Offs, F, Data);
+                break;
+
+            case FRAG_FILL:
+                WriteMult (Tgt, S->FillVal, Frag->Size);
+                break;
+
+            case FRAG_RELAX_ZP:
+            case FRAG_RELAX_BRA:
+                SegWriteRelaxed (Tgt, S, Frag, Offs, F, Data);
+                break;
+
+            default:
+                Internal ("Invalid fragment type: %02X", Frag->Type);
+        }
+
+        /* Update the offset */
+        Print (stdout, 2, "        Fragment with 0x%x bytes\n",
+               Frag->Size);
+        Offs += Frag->Size;
+
+        /* Next fragment */
+        Frag = Frag->Next;
+    }
+
+    /* Return the offset behind the section */
+    return Offs;
+}
+
+
+
+void SegWrite (const char* TgtName, OutFile* Tgt, Segment* S, SegWriteFunc F, void* Data)
 /* Write the data from the given segment to a file. For expressions, F is
 ** called (see description of SegWriteFunc above).
 */
 {
     unsigned      I;
-    int           Sign;
     unsigned long Offs = 0;
 
 
     /* Remember the output file and offset for the segment */
     S->OutputName = TgtName;
-    S->OutputOffs = (unsigned long) ftell (Tgt);
+    S->OutputOffs = OutFileGetPos (Tgt);
 
     /* Loop over all sections in this segment */
     for (I = 0; I < CollCount (&S->Sections); ++I) {
 
         Section*        Sec = CollAtUnchecked (&S->Sections, I);
-        Fragment*       Frag;
         unsigned char   FillVal;
 
         /* Output were this section is from */
@@ -489,66 +740,30 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
         WriteMult (Tgt, FillVal, Sec->Fill);
         Offs += Sec->Fill;
 
-        /* Loop over all fragments in this section */
-        Frag = Sec->FragRoot;
-        while (Frag) {
-
-            /* Output fragment data */
-            switch (Frag->Type) {
-
-                case FRAG_LITERAL:
-                    WriteData (Tgt, Frag->LitBuf, Frag->Size);
-                    break;
-
-                case FRAG_EXPR:
-                case FRAG_SEXPR:
-                    Sign = (Frag->Type == FRAG_SEXPR);
-                    /* Call the users function and evaluate the result */
-                    switch (F (Frag->Expr, Sign, Frag->Size, Offs, Data)) {
-
-                        case SEG_EXPR_OK:
-                            break;
-
-                        case SEG_EXPR_RANGE_ERROR:
-                            Error ("Range error in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_TOO_COMPLEX:
-                            Error ("Expression too complex in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_INVALID:
-                            Error ("Invalid expression in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        default:
-                            Internal ("Invalid return code from SegWriteFunc");
-                    }
-                    break;
+        /* Write the section data */
+        Offs = SecWrite (Tgt, Sec, Offs, F, Data);
+    }
+}
 
-                case FRAG_FILL:
-                    WriteMult (Tgt, S->FillVal, Frag->Size);
-                    break;
 
-                default:
-                    Internal ("Invalid fragment type: %02X", Frag->Type);
-            }
 
-            /* Update the offset */
-            Print (stdout, 2, "        Fragment with 0x%x bytes\n",
-                   Frag->Size);
-            Offs += Frag->Size;
+void SegWriteSection (OutFile* Tgt, Section* Sec, SegWriteFunc F, void* Data)
+/* Write the data of a section again to the place in the file where SegWrite
+** has put it. The output offset of the segment and the offset of the section
+** must not have changed since then.
+*/
+{
+    Segment* S = Sec->Seg;
+    OutFileSetPos (Tgt, S->OutputOffs + Sec->Offs);
+    (void) SecWrite (Tgt, Sec, Sec->Offs, F, Data);
+}
 
-            /* Next fragment */
-            Frag = Frag->Next;
-        }
-    }
+
+
+Segment* SegById (unsigned Id)
+/* Return the segment with the given id */
+{
+    return CollAt (&SegmentList, Id);
 }
 
 
@@ -44,6 +44,9 @@
 #include "coll.h"
 #include "exprdefs.h"
 
+/* ld65 */
+#include "fileio.h"
+
 
 
 /*****************************************************************************/
@@ -89,7 +92,10 @@ struct Section {
     unsigned long       Size;           /* Size of the section */
     unsigned long       Fill;           /* Fill bytes for alignment */
     unsigned long       Alignment;      /* Alignment */
+    unsigned            Name;           /* Name of segment */
+    unsigned            Flags;          /* Section flags from the object file */
     unsigned char       AddrSize;       /* Address size of segment */
+    unsigned char       Used;           /* Section is part of the output */
 };
 
 
@@ -125,8 +131,22 @@ Segment* GetSegment (unsigned Name, unsigned char AddrSize, const char* ObjName)
 Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSize);
 /* Create a new section for the given segment */
 
-Section* ReadSection (FILE* F, struct ObjData* O);
-/* Read a section from a file */
+Section* ReadSection (InFile* F, struct ObjData* O);
+/* Read a section from a file. The section is not yet part of a segment, this
+** is done by AddSection. Since no global data is changed, sections of
+** different object files may be read at the same time.
+*/
+
+void AddSection (Section* Sec);
+/* Add a section read by ReadSection to its segment */
+
+unsigned long SegRemoveUnused (void);
+/* Remove the sections that are not marked as used from their segments, and
+** place the remaining sections again. Return the number of bytes removed.
+*/
+
+void SegRelayout (void);
+/* Place the sections of all segments again after their sizes have changed */
 
 Segment* SegFind (unsigned Name);
 /* Return the given segment or NULL if not found. */
@@ -141,16 +161,25 @@ Section* GetNonBSSSection (Segment* S);
 void SegDump (void);
 /* Dump the segments and it's contents */
 
-unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size);
+unsigned SegWriteConstExpr (OutFile* F, ExprNode* E, int Signed, unsigned Size);
 /* Write a supposedly constant expression to the target file. Do a range
 ** check and return one of the SEG_EXPR_xxx codes.
 */
 
-void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void* Data);
+void SegWrite (const char* TgtName, OutFile* Tgt, Segment* S, SegWriteFunc F, void* Data);
 /* Write the data from the given segment to a file. For expressions, F is
 ** called (see description of SegWriteFunc above).
 */
 
+void SegWriteSection (OutFile* Tgt, Section* Sec, SegWriteFunc F, void* Data);
+/* Write the data of a section again to the place in the file where SegWrite
+** has put it. The output offset of the segment and the offset of the section
+** must not have changed since then.
+*/
+
+Segment* SegById (unsigned Id);
+/* Return the segment with the given id */
+
 unsigned SegmentCount (void);
 /* Return the total number of segments */
 
@@ -38,10 +38,14 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
+#include "error.h"
 #include "fileio.h"
 #include "objdata.h"
+#include "relax.h"
 #include "segments.h"
 #include "span.h"
+#include "spool.h"
 #include "tpool.h"
 
 
@@ -58,7 +62,9 @@ struct Span {
     unsigned            Sec;            /* Section id of this span */
     unsigned long       Offs;           /* Offset of span within segment */
     unsigned long       Size;           /* Size of span */
-    unsigned            Type;           /* Generic type of the data */
+    unsigned            TypeName;       /* Generic type of the data */
+    unsigned            Type;           /* Type id, see AssignSpanTypeIds */
+    unsigned            DbgId;          /* Id in the debug info file */
 };
 
 
@@ -77,6 +83,7 @@ static Span* NewSpan (unsigned Id)
 
     /* Initialize the fields as necessary */
     S->Id       = Id;
+    S->DbgId    = INVALID_DBG_ID;
 
     /* Return the result */
     return S;
@@ -84,7 +91,7 @@ static Span* NewSpan (unsigned Id)
 
 
 
-Span* ReadSpan (FILE* F, ObjData* O, unsigned Id)
+Span* ReadSpan (InFile* F, ObjData* O, unsigned Id)
 /* Read a Span from a file and return it */
 {
     unsigned Type;
@@ -95,13 +102,17 @@ Span* ReadSpan (FILE* F, ObjData* O, unsigned Id)
     S->Offs = ReadVar (F);
     S->Size = ReadVar (F);
 
-    /* Read the type. An id of zero means an empty string (no need to check) */
+    /* Read the type. An id of zero means an empty string (no need to check).
+    ** Type ids depend on the order in which they are requested, so they are
+    ** assigned later.
+    */
     Type    = ReadVar (F);
     if (Type == 0) {
-        S->Type = INVALID_TYPE_ID;
+        S->TypeName = INVALID_STRING_ID;
     } else {
-        S->Type = GetTypeId (GetObjString (O, Type));
+        S->TypeName = MakeGlobalStringId (O, Type);
     }
+    S->Type = INVALID_TYPE_ID;
 
     /* Return the new span */
     return S;
@@ -109,7 +120,7 @@ Span* ReadSpan (FILE* F, ObjData* O, unsigned Id)
 
 
 
-unsigned* ReadSpanList (FILE* F)
+unsigned* ReadSpanList (InFile* F)
 /* Read a list of span ids from a file. The list is returned as an array of
 ** unsigneds, the first being the number of spans (never zero) followed by
 ** the span ids. If the number of spans is zero, NULL is returned.
@@ -139,6 +150,17 @@ unsigned* ReadSpanList (FILE* F)
 
 
 
+void SkipSpanList (InFile* F)
+/* Skip a list of span ids in a file */
+{
+    unsigned Count = ReadVar (F);
+    while (Count--) {
+        (void) ReadVar (F);
+    }
+}
+
+
+
 unsigned* DupSpanList (const unsigned* S)
 /* Duplicate a span list */
 {
@@ -166,10 +188,10 @@ void FreeSpan (Span* S)
 
 
 unsigned SpanCount (void)
-/* Return the total number of spans */
+/* Return the total number of spans written to the debug info file */
 {
     /* Walk over all object files */
-    unsigned I;
+    unsigned I, J;
     unsigned Count = 0;
     for (I = 0; I < CollCount (&ObjDataList); ++I) {
 
@@ -177,7 +199,12 @@ unsigned SpanCount (void)
         const ObjData* O = CollAtUnchecked (&ObjDataList, I);
 
         /* Count spans */
-        Count += CollCount (&O->Spans);
+        for (J = 0; J < CollCount (&O->Spans); ++J) {
+            const Span* S = CollConstAt (&O->Spans, J);
+            if (S->DbgId != INVALID_DBG_ID) {
+                ++Count;
+            }
+        }
     }
 
     return Count;
@@ -185,18 +212,93 @@ unsigned SpanCount (void)
 
 
 
+unsigned AssignSpanDbgIds (ObjData* O, unsigned Id)
+/* Assign the debug info ids to the spans of the given module, starting with
+** Id, and return the next free id. Spans in sections removed by --gc-sections
+** don't get an id.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->Spans); ++I) {
+        Span* S = CollAtUnchecked (&O->Spans, I);
+        if (GetObjSection (O, S->Sec)->Used) {
+            S->DbgId = Id++;
+        } else {
+            S->DbgId = INVALID_DBG_ID;
+        }
+    }
+    return Id;
+}
+
+
+
+unsigned GetSpanDbgId (const ObjData* O, unsigned Id)
+/* Return the debug info id of the span with the given id in the module, or
+** INVALID_DBG_ID if it is not written to the debug info file.
+*/
+{
+    const Span* S;
+    if (Id >= CollCount (&O->Spans)) {
+        Error ("Invalid span index (%u) in module `%s'", Id, GetObjFileName (O));
+    }
+    S = CollConstAt (&O->Spans, Id);
+    return S->DbgId;
+}
+
+
+
+int SpanListIsRemoved (const ObjData* O, const unsigned* List)
+/* Return true if the list of spans is not empty, and all of its spans are in
+** sections removed by --gc-sections.
+*/
+{
+    unsigned I;
+    if (List == 0 || *List == 0) {
+        return 0;
+    }
+    for (I = 0; I < *List; ++I) {
+        if (GetSpanDbgId (O, List[I+1]) != INVALID_DBG_ID) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+void AssignSpanTypeIds (ObjData* O)
+/* Assign the type ids of all spans in the given module. Must be called for
+** the modules in the order they were added, so the ids don't depend on the
+** order they were read in.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&O->Spans); ++I) {
+        Span* S = CollAtUnchecked (&O->Spans, I);
+        if (S->TypeName != INVALID_STRING_ID) {
+            S->Type = GetTypeId (GetStrBuf (S->TypeName));
+        }
+    }
+}
+
+
+
 void PrintDbgSpanList (FILE* F, const ObjData* O, const unsigned* List)
 /* Output a string ",span=x[+y...]" for the given list. If the list is empty
 ** or NULL, output nothing. This is a helper function for other modules to
-** print a list of spans read by ReadSpanList to the debug info file.
+** print a list of spans read by ReadSpanList to the debug info file. Spans
+** that are not written to the debug info file are left out.
 */
 {
     if (List && *List) {
         unsigned I;
         const char* Format = ",span=%u";
         for (I = 0; I < *List; ++I) {
-            fprintf (F, Format, O->SpanBaseId + List[I+1]);
-            Format = "+%u";
+            unsigned Id = GetSpanDbgId (O, List[I+1]);
+            if (Id != INVALID_DBG_ID) {
+                fprintf (F, Format, Id);
+                Format = "+%u";
+            }
         }
     }
 }
@@ -225,12 +327,23 @@ void PrintDbgSpans (FILE* F)
             /* Get the section for this span */
             const Section* Sec = GetObjSection (O, S->Sec);
 
+            unsigned long Start, End;
+
+            /* Skip spans in removed sections */
+            if (S->DbgId == INVALID_DBG_ID) {
+                continue;
+            }
+
+            /* Get the offsets after relaxation */
+            Start = GetRelaxedOffs (O, S->Sec, S->Offs);
+            End   = GetRelaxedOffs (O, S->Sec, S->Offs + S->Size);
+
             /* Output the data */
             fprintf (F, "span\tid=%u,seg=%u,start=%lu,size=%lu",
-                     O->SpanBaseId + S->Id,
+                     S->DbgId,
                      Sec->Seg->Id,
-                     Sec->Offs + S->Offs,
-                     S->Size);
+                     Sec->Offs + Start,
+                     End - Start);
 
             /* If we have a type, add it */
             if (S->Type != INVALID_TYPE_ID) {
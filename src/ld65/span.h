@@ -43,6 +43,9 @@
 /* common */
 #include "coll.h"
 
+/* ld65 */
+#include "fileio.h"
+
 
 
 /*****************************************************************************/
@@ -73,15 +76,18 @@ typedef struct Span Span;
 
 
 
-Span* ReadSpan (FILE* F, struct ObjData* O, unsigned Id);
+Span* ReadSpan (InFile* F, struct ObjData* O, unsigned Id);
 /* Read a Span from a file and return it */
 
-unsigned* ReadSpanList (FILE* F);
+unsigned* ReadSpanList (InFile* F);
 /* Read a list of span ids from a file. The list is returned as an array of
 ** unsigneds, the first being the number of spans (never zero) followed by
 ** the span ids. If the number of spans is zero, NULL is returned.
 */
 
+void SkipSpanList (InFile* F);
+/* Skip a list of span ids in a file */
+
 unsigned* DupSpanList (const unsigned* S);
 /* Duplicate a span list */
 
@@ -89,12 +95,35 @@ void FreeSpan (Span* S);
 /* Free a span structure */
 
 unsigned SpanCount (void);
-/* Return the total number of spans */
+/* Return the total number of spans written to the debug info file */
+
+unsigned AssignSpanDbgIds (struct ObjData* O, unsigned Id);
+/* Assign the debug info ids to the spans of the given module, starting with
+** Id, and return the next free id. Spans in sections removed by --gc-sections
+** don't get an id.
+*/
+
+unsigned GetSpanDbgId (const struct ObjData* O, unsigned Id);
+/* Return the debug info id of the span with the given id in the module, or
+** INVALID_DBG_ID if it is not written to the debug info file.
+*/
+
+int SpanListIsRemoved (const struct ObjData* O, const unsigned* List);
+/* Return true if the list of spans is not empty, and all of its spans are in
+** sections removed by --gc-sections.
+*/
+
+void AssignSpanTypeIds (struct ObjData* O);
+/* Assign the type ids of all spans in the given module. Must be called for
+** the modules in the order they were added, so the ids don't depend on the
+** order they were read in.
+*/
 
 void PrintDbgSpanList (FILE* F, const struct ObjData* O, const unsigned* List);
 /* Output a string ",span=x[+y...]" for the given list. If the list is empty
 ** or NULL, output nothing. This is a helper function for other modules to
-** print a list of spans read by ReadSpanList to the debug info file.
+** print a list of spans read by ReadSpanList to the debug info file. Spans
+** that are not written to the debug info file are left out.
 */
 
 void PrintDbgSpans (FILE* F);
@@ -32,7 +32,6 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <errno.h>
 
 /* common */
 #include "alignment.h"
@@ -68,7 +67,7 @@ typedef struct XexInitAd {
 
 struct XexDesc {
     unsigned    Undef;          /* Count of undefined externals */
-    FILE*       F;              /* Output file */
+    OutFile*    F;              /* Output file */
     const char* Filename;       /* Name of output file */
     Import*     RunAd;          /* Run Address */
     XexInitAd*  InitAds;        /* List of Init Addresses */
@@ -182,7 +181,7 @@ static void XexStartSegment (XexDesc *D, unsigned long Addr, unsigned long Size)
         return;
 
     /* Store current position */
-    unsigned long Pos = ftell (D->F);
+    unsigned long Pos = OutFileGetPos (D->F);
     unsigned long End = Addr + Size - 1;
 
     /* See if last header can be expanded into this one */
@@ -190,17 +189,17 @@ static void XexStartSegment (XexDesc *D, unsigned long Addr, unsigned long Size)
         /* Expand current header */
         D->HeadEnd = End;
         D->HeadSize += Size;
-        fseek (D->F, D->HeadPos + 2, SEEK_SET);
+        OutFileSetPos (D->F, D->HeadPos + 2);
         Write16 (D->F, End);
         /* Seek to old position */
-        fseek (D->F, Pos, SEEK_SET);
+        OutFileSetPos (D->F, Pos);
     }
     else
     {
         if (D->HeadSize == 0) {
             /* Last header had no data, replace */
             Pos = D->HeadPos;
-            fseek (D->F, Pos, SEEK_SET);
+            OutFileSetPos (D->F, Pos);
         }
 
         /* If we are at start of file, write XEX heder */
@@ -208,7 +207,7 @@ static void XexStartSegment (XexDesc *D, unsigned long Addr, unsigned long Size)
             Write16 (D->F, 0xFFFF);
 
         /* Writes a new segment header */
-        D->HeadPos = ftell (D->F);
+        D->HeadPos = OutFileGetPos (D->F);
         D->HeadEnd = End;
         D->HeadSize = Size;
         Write16 (D->F, Addr);
@@ -225,11 +224,11 @@ static void XexFakeSegment (XexDesc *D, unsigned long Addr)
         return;
 
     /* If we are at start of file, write XEX heder */
-    if (ftell (D->F) == 0)
+    if (OutFileGetPos (D->F) == 0)
         Write16 (D->F, 0xFFFF);
 
     /* Writes a new (invalid) segment header */
-    D->HeadPos = ftell (D->F);
+    D->HeadPos = OutFileGetPos (D->F);
     D->HeadEnd = Addr - 1;
     D->HeadSize = 0;
     Write16 (D->F, Addr);
@@ -244,7 +243,7 @@ static unsigned long XexWriteMem (XexDesc* D, MemoryArea* M)
     unsigned I;
 
     /* Store initial position to get total file size */
-    unsigned long StartPos = ftell (D->F);
+    unsigned long StartPos = OutFileGetPos (D->F);
 
     /* Get the start address and size of this memory area */
     unsigned long Addr = M->Start;
@@ -325,9 +324,9 @@ static unsigned long XexWriteMem (XexDesc* D, MemoryArea* M)
         if (DoWrite) {
             /* Start a segment with only one byte, will fix later */
             XexFakeSegment (D, Addr);
-            unsigned long P = ftell (D->F);
+            unsigned long P = OutFileGetPos (D->F);
             SegWrite (D->Filename, D->F, S->Seg, XexWriteExpr, D);
-            unsigned long Size = ftell (D->F) - P;
+            unsigned long Size = OutFileGetPos (D->F) - P;
             /* Fix segment size */
             XexStartSegment (D, Addr, Size);
             PrintNumVal ("Wrote", Size);
@@ -358,10 +357,10 @@ static unsigned long XexWriteMem (XexDesc* D, MemoryArea* M)
 
     /* If the last segment is empty, remove */
     if (D->HeadSize == 0 && D->HeadPos) {
-        fseek (D->F, D->HeadPos, SEEK_SET);
+        OutFileSetPos (D->F, D->HeadPos);
     }
 
-    return ftell (D->F) - StartPos;
+    return OutFileGetPos (D->F) - StartPos;
 }
 
 
@@ -398,10 +397,7 @@ void XexWriteTarget (XexDesc* D, struct File* F)
     }
 
     /* Open the file */
-    D->F = fopen (D->Filename, "wb");
-    if (D->F == 0) {
-        Error ("Cannot open `%s': %s", D->Filename, strerror (errno));
-    }
+    D->F = OpenOutFile (D->Filename);
     D->HeadPos = 0;
 
     /* Keep the user happy */
@@ -431,9 +427,7 @@ void XexWriteTarget (XexDesc* D, struct File* F)
     }
 
     /* Close the file */
-    if (fclose (D->F) != 0) {
-        Error ("Cannot write to `%s': %s", D->Filename, strerror (errno));
-    }
+    CloseOutFile (D->F);
 
     /* Reset the file and filename */
     D->F        = 0;
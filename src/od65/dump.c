@@ -177,6 +177,11 @@ static void SkipExpr (FILE* F)
                 (void) ReadVar (F);
                 break;
 
+            case EXPR_RELAX:
+                /* Read the index of the relaxed instruction */
+                (void) ReadVar (F);
+                break;
+
             default:
                 Error ("Invalid expression op: %02X", Op);
 
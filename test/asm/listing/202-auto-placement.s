@@ -0,0 +1,20 @@
+; verification of the automatic placement of segments into memory areas
+; Segments are placed by decreasing size into the first area with room:
+; S2 -> B, S1 -> A (behind F), S4 -> C, S3 -> B (behind S2)
+
+.import __S3_LOAD__
+
+.segment "F"
+.byte $f0,$f1,$f2
+
+.segment "S1"
+.byte $10,$11,$12,$13,$14
+
+.segment "S2"
+.byte $20,$21,$22,$23,$24,$25
+
+.segment "S3"
+.byte $30,$31
+
+.segment "S4"
+.byte $40,$41,$42,<__S3_LOAD__
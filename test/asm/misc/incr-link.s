@@ -0,0 +1,48 @@
+; Verifies that ld65 --incremental writes a changed module over the old one.
+; The module with the value is assembled from this file with VALUE defined,
+; once with a wrong and then with the right value, and linked both times.
+; ca65 -D EXPECT=42 -o incr-link.o incr-link.s
+; ca65 -D VALUE=1 -o incr-link-val.o incr-link.s
+; ld65 --incremental incr-link.state incr-link.o incr-link-val.o sim6502.lib
+; ca65 -D VALUE=42 -o incr-link-val.o incr-link.s
+; ld65 --incremental incr-link.state incr-link.o incr-link-val.o sim6502.lib
+
+.ifdef VALUE
+
+.export getval, table
+
+.code
+
+getval:
+    lda #VALUE
+    rts
+
+.rodata
+
+table:
+    .byte VALUE, VALUE + 1
+
+.else
+
+.import getval, table
+.export _main
+
+.code
+
+_main:
+    jsr getval
+    cmp #EXPECT
+    bne fail
+    lda table + 1
+    cmp #EXPECT + 1
+    bne fail
+    ; Returning 0 reports success
+    ldx #0
+    txa
+    rts
+fail:
+    ldx #0
+    lda #1
+    rts
+
+.endif
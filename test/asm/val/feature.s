@@ -121,6 +121,12 @@ labelwithoutcolon
 .feature pc_assignment -
 
 
+.feature relax_code
+    beq :+
+:
+.feature relax_code -
+
+
 .feature string_escapes
 .asciiz "quote:\""
 .feature string_escapes -
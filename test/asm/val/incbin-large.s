@@ -0,0 +1,11 @@
+; Test .incbin of a file that is a few bytes larger than a fragment can hold.
+; With GENERATE defined, the file is created with .byte, otherwise it is read
+; back with .incbin. Both must link to the same output.
+
+.ifdef GENERATE
+        .repeat 65540, I
+        .byte   I .mod 251
+        .endrepeat
+.else
+        .incbin "incbin-large-gen.bin"
+.endif
@@ -0,0 +1,49 @@
+; Test .include and .incbin of the same file, which is read only once
+
+        .import _exit
+        .export _main
+
+_main:
+        ldx #0
+        .include "incbin.inc"
+        .include "incbin.inc"
+        cpx #2
+        bne fail
+
+        ; The data read with .incbin must match the file contents
+        ldx #0
+@head:  lda full,x
+        cmp head,x
+        bne fail
+        inx
+        cpx #headend - head
+        bne @head
+
+        ; A part of the file must match the same part of the complete file
+        ldx #0
+@part:  lda full+2,x
+        cmp part,x
+        bne fail
+        inx
+        cpx #partend - part
+        bne @part
+
+        lda #0
+        jmp _exit
+
+fail:   lda #1
+        jmp _exit
+
+head:   .byte   "; Included twice"
+headend:
+
+full:   .incbin "incbin.inc"
+fullend:
+part:   .incbin "incbin.inc", 2, 20
+partend:
+small:  .incbin "incbin.inc", 2, 3
+smallend:
+
+        .assert partend - part = 20, error
+        .assert smallend - small = 3, error
+        .assert fullend - full > 40, error
@@ -0,0 +1,60 @@
+; Test linking a module with a large number of exports, so the export table of
+; the linker has to grow several times. The file is assembled twice: Once for
+; the exports, and once with IMPORTS defined for a module that imports a part
+; of them, spread over the whole table, and checks their values.
+
+.ifndef IMPORTS
+
+        .repeat 20000, I
+        .ident (.sprintf ("exp%d", I)) = I * 3
+        .export .ident (.sprintf ("exp%d", I))
+        .endrepeat
+
+.else
+
+        .import _exit
+        .export _main
+
+        COUNT = 200
+
+        .repeat COUNT, J
+        .import .ident (.sprintf ("exp%d", J * 100 + J .mod 100))
+        .endrepeat
+
+.segment "CODE"
+
+_main:  ldx     #0
+@L1:    lda     values,x
+        cmp     expected,x
+        bne     fail
+        lda     values+COUNT,x
+        cmp     expected+COUNT,x
+        bne     fail
+        inx
+        cpx     #COUNT
+        bne     @L1
+        lda     #0
+        jmp     _exit
+
+fail:   lda     #1
+        jmp     _exit
+
+.segment "RODATA"
+
+; The imported values and the values they must have, low bytes first
+values:
+        .repeat COUNT, J
+        .byte   <.ident (.sprintf ("exp%d", J * 100 + J .mod 100))
+        .endrepeat
+        .repeat COUNT, J
+        .byte   >.ident (.sprintf ("exp%d", J * 100 + J .mod 100))
+        .endrepeat
+expected:
+        .repeat COUNT, J
+        .byte   <((J * 100 + J .mod 100) * 3)
+        .endrepeat
+        .repeat COUNT, J
+        .byte   >((J * 100 + J .mod 100) * 3)
+        .endrepeat
+
+.endif
@@ -0,0 +1,73 @@
+; test of .feature relax_code
+
+.export _main
+
+.feature relax_code
+
+.segment "ZEROPAGE"
+zplabel:
+        .res    1
+
+.segment "CODE"
+
+; exit with 0
+
+_main:
+        lda     #0
+        ; branch out of reach is replaced by an inverted branch around a jmp
+b1:     beq     far
+        jmp     fail
+        .res    200, $00
+far:    .assert far - b1 = 5 + 3 + 200, error, "long branch failure"
+
+        ; branch in reach keeps its short form
+b2:     beq     near
+        jmp     fail
+near:   .assert near - b2 = 2 + 3, error, "short branch failure"
+
+        ; backward branch out of reach
+        lda     #1
+        bne     skip
+back:   lda     #0
+        beq     done
+        .res    200, $00
+skip:
+b3:     bne     back
+        jmp     fail
+done:   .assert done - b3 = 5 + 3, error, "backward branch failure"
+
+        ; forward reference to a zero page symbol uses zero page addressing
+        lda     #42
+a1:     sta     fwdzp
+a2:     .assert a2 - a1 = 2, error, "zero page address failure"
+        lda     zplabel
+        cmp     #42
+        bne     fail
+
+        ; sizes of scopes account for the final instruction sizes
+        jsr     sized
+
+.if .cap(CPU_HAS_BRA8)
+        ; jmp in reach is replaced by bra
+j1:     jmp     j2
+j2:     .assert j2 - j1 = 2, error, "jmp to bra failure"
+j3:     bra     j4
+        .res    200, $00
+j4:     .assert j4 - j3 = 3 + 200, error, "bra to jmp failure"
+.endif
+
+        lda     #0
+        tax
+        rts
+
+fail:   lda     #1
+        ldx     #0
+        rts
+
+.proc sized
+        beq     ret
+ret:    rts
+.endproc
+.assert .sizeof(sized) = 2 + 1, error, ".sizeof failure"
+
+fwdzp   := zplabel
@@ -0,0 +1,47 @@
+; Test linker expressions with symbols defined relative to each other
+
+        .import _exit
+        .import __MAIN_START__
+        .export _main
+
+        .macro  check   addr, value
+        lda     addr
+        cmp     #<(value)
+        bne     fail
+        lda     addr+1
+        cmp     #>(value)
+        bne     fail
+        .endmacro
+
+.segment "DATA"
+
+d0:     .byte   1, 2, 3, 4
+s1      = d0 + 2
+s2      = s1 + 1
+s3      = s2 - 3
+
+.segment "RODATA"
+
+t1:     .word   s2
+t2:     .word   s3
+t3:     .word   s2 - c0
+t4:     .word   2 * s1 - d0
+t5:     .word   __MAIN_START__ + s2 - d0
+t6:     .word   3 * s2 - 2 * c0
+t7:     .word   s3 - c0 + s1 - s2
+
+.segment "CODE"
+
+c0:
+_main:  check   t1, d0 + 3
+        check   t2, d0
+        check   t3, d0 + 3 - c0
+        check   t4, d0 + 4
+        check   t5, __MAIN_START__ + 3
+        check   t6, 3 * d0 + 9 - 2 * c0
+        check   t7, d0 - c0 - 1
+        lda     #0
+        jmp     _exit
+
+fail:   lda     #1
+        jmp     _exit
@@ -0,0 +1,57 @@
+; Test symbol lookup in scopes whose hash tables have to grow
+
+        .import _exit
+        .export _main
+
+        .macro  check   value, expected
+        .assert (value) = (expected), error, "symbol lookup failed"
+        lda     #<(value)
+        cmp     #<(expected)
+        bne     fail
+        .endmacro
+
+; Fill the global scope and a nested scope with many symbols
+
+        .repeat 1000, I
+        .ident(.sprintf("g%d", I)) = I * 3
+        .endrepeat
+
+        .scope  inner
+        .repeat 300, I
+        .ident(.sprintf("g%d", I)) = I * 5
+        .ident(.sprintf("l%d", I)) = I * 7
+        .endrepeat
+        .endscope
+
+; Symbols defined before use and after the tables have grown
+
+.segment "CODE"
+
+_main:  check   g0, 0
+        check   g17, 51
+        check   g999, 2997
+        check   inner::g17, 85
+        check   inner::l299, 2093
+        check   ::g17, 51
+        check   late, 42
+
+        .scope  outer
+        check   g17, 51
+        check   inner::l3, 21
+        check   g500, 1500
+        check   ::inner::g299, 1495
+        .endscope
+
+        .proc   local
+@a:     check   g42, 126
+        check   fwd, 43
+        .endproc
+
+        lda     #0
+        jmp     _exit
+
+fail:   lda     #1
+        jmp     _exit
+
+late    = 42
+fwd     = late + 1
@@ -0,0 +1,39 @@
+; test the zpargs option of .proc: the argument block is declared with the
+; address size the target places it at, and is linked in from the library
+
+.export _main
+
+.proc   add: near, zpargs
+        clc
+        adc     zpargs          ; Left parameter in the block
+        pha
+        txa
+        adc     zpargs+1
+        tax
+        pla
+        rts
+.endproc
+
+.assert .addrsize(zpargs) = 1, error, ".addrsize 1 expected for zpargs"
+
+; exit with 0 if add (1000, 234) returns 1234
+
+_main:
+        lda     #<1000
+        sta     zpargs
+        lda     #>1000
+        sta     zpargs+1
+        lda     #<234
+        ldx     #>234
+        jsr     add
+        cmp     #<1234
+        bne     fail
+        cpx     #>1234
+        bne     fail
+        lda     #0
+        tax
+        rts
+
+fail:   lda     #1
+        ldx     #0
+        rts
@@ -0,0 +1,20 @@
+/* The address of a parameter passed in the zero page argument block cannot
+** be taken, since the block is restored after calls, so writes through the
+** pointer would get lost.
+*/
+
+void set5 (int* p)
+{
+    *p = 5;
+}
+
+int f (int a, int b) __attribute__ ((zpargs))
+{
+    set5 (&a);          /* Error */
+    return a + b;
+}
+
+int main (void)
+{
+    return f (1, 2);
+}
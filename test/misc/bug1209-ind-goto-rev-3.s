@@ -0,0 +1,93 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$00
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$C6,$C1,$C9,$CC,$0D,$00
+S0001:
+	.byte	$D0,$C1,$D3,$D3,$0D,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	lda     _y
+	beq     L0003
+	ldx     #$00
+	txa
+	rts
+L0003:	lda     #$01
+	sta     _y
+	ldy     #$00
+	lda     M0001,y
+	ldx     M0001+1,y
+	jmp     callax
+
+.segment	"RODATA"
+
+M0001:
+	.addr	L0002
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	beq     L0002
+L0007:	inc     _failures
+L0002:	lda     _failures
+	bne     L0004
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jmp     L0009
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+L0009:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
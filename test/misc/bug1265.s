@@ -0,0 +1,248 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_puts
+	.import		_sprintf
+	.import		_strcmp
+	.export		_failures
+	.export		_str1
+	.export		_str2
+	.export		_f2
+	.export		_main
+	.export		_f1
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$66,$31,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0008:
+	.byte	$66,$32,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0007:
+	.byte	$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$00
+S0003	:=	S0007+0
+S0006:
+	.byte	$25,$70,$0A,$00
+S0002	:=	S0006+0
+S0005	:=	S0006+0
+S0001	:=	S0006+0
+
+.segment	"BSS"
+
+_str1:
+	.res	10,$00
+_str2:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$09
+	bne     L0002
+	cmp     #$29
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$17
+	jmp     L0004
+L0003:	ldx     #$FF
+	lda     #$FF
+L0004:	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$04
+	lda     #$D2
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f1
+	ldy     #$00
+	jsr     staxysp
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0003
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _puts
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$2A
+L0005:	jsr     boolne
+	jeq     L0006
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _puts
+	inc     _failures
+	bne     L0006
+	inc     _failures+1
+L0006:	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$09
+	lda     #$29
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f2
+	ldy     #$00
+	jsr     staxysp
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _puts
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000A
+	cmp     #$17
+L000A:	jsr     boolne
+	jeq     L000B
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _puts
+	inc     _failures
+	bne     L000B
+	inc     _failures+1
+L000B:	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+L0001:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$04
+	bne     L0002
+	cmp     #$D2
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$2A
+	jmp     L0004
+L0003:	ldx     #$FF
+	lda     #$FF
+L0004:	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
@@ -0,0 +1,51 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.export		_f1
+	.export		_f2
+
+; ---------------------------------------------------------------
+; void __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jmp     L0003
+	jsr     _f1
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jmp     L0002
+	jsr     _f2
+	jmp     L0003
+L0002:	jsr     _f2
+L0003:	rts
+
+.endproc
+
@@ -0,0 +1,56 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$65,$72,$72,$6F,$72,$3A,$20,$73,$68,$6F,$75,$6C,$64,$20,$6E,$6F
+	.byte	$74,$20,$63,$6F,$6D,$65,$20,$68,$65,$72,$65,$0A,$00
+S0001:
+	.byte	$65,$6E,$74,$65,$72,$69,$6E,$67,$20,$65,$6E,$64,$6C,$65,$73,$73
+	.byte	$20,$6C,$6F,$6F,$70,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0002:	jmp     L0005
+L0004:	jmp     L0002
+L0005:	jmp     L0004
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,254 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$02
+L0005:	jsr     booleq
+	jne     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0004:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$02
+L0006:	jsr     booleq
+	jeq     L0005
+	jmp     L0004
+L0005:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0004:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f6: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$02
+L0006:	jsr     booleq
+	jeq     L0005
+	jmp     L0004
+L0005:	jmp     L0004
+L0004:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f7: near
+
+.segment	"CODE"
+
+L0002:	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$02
+L0006:	jsr     booleq
+	jeq     L0005
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	jmp     L0007
+L0005:	jmp     L0007
+L0007:	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f5
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f6
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f7
+	jsr     tosaddax
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
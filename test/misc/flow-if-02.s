@@ -0,0 +1,148 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_b
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+_b:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jmp     L0002
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+L0003:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jmp     L0002
+	ldx     #$00
+	lda     #$01
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+L0003:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	jmp     L0002
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+	ldx     #$00
+	lda     #$01
+	sta     _a
+	stx     _a+1
+L0003:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,525 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0002
+L0002:	cpx     #$00
+	jne     L0006
+	cmp     #$01
+	jeq     L0004
+	cmp     #$02
+	jeq     L0005
+	jmp     L0006
+	jmp     L0006
+	ldx     #$00
+	lda     #$03
+	sta     _a
+	stx     _a+1
+L0004:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0005:	ldx     #$00
+	lda     #$01
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0006:	ldx     #$00
+	lda     #$00
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0003:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0002
+L0002:	cpx     #$00
+	jne     L0007
+	cmp     #$01
+	jeq     L0005
+	cmp     #$02
+	jeq     L0006
+	jmp     L0007
+	jmp     L0007
+L0004:	ldx     #$00
+	lda     #$03
+	sta     _a
+	stx     _a+1
+L0005:	jmp     L0004
+L0006:	ldx     #$00
+	lda     #$01
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0007:	ldx     #$00
+	lda     #$00
+	sta     _a
+	stx     _a+1
+	jmp     L0003
+L0003:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0002
+L0002:	cpx     #$00
+	jne     L0006
+	cmp     #$01
+	jeq     L0004
+	cmp     #$02
+	jeq     L0005
+	jmp     L0006
+	jmp     L0006
+L0004:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0005:	lda     _a
+	ldx     _a+1
+	jsr     incax1
+	jmp     L0001
+L0006:	lda     _a
+	ldx     _a+1
+	jsr     incax2
+	jmp     L0001
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0005
+L0005:	cpx     #$00
+	jne     L000A
+	cmp     #$01
+	jeq     L0004
+	cmp     #$02
+	jeq     L0009
+	jmp     L000A
+	jmp     L000A
+L0004:	inc     _a
+	bne     L0008
+	inc     _a+1
+L0008:	lda     _a
+	ldx     _a+1
+	jmp     L0006
+L0009:	lda     _a
+	ldx     _a+1
+	jsr     incax1
+	jmp     L0001
+L000A:	lda     _a
+	ldx     _a+1
+	jsr     incax2
+	jmp     L0001
+L0006:	jmp     L0004
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0005
+L0005:	cpx     #$00
+	jne     L000A
+	cmp     #$01
+	jeq     L0007
+	cmp     #$02
+	jeq     L0008
+	jmp     L000A
+	jmp     L000A
+L0007:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0008:	inc     _a
+	bne     L0009
+	inc     _a+1
+L0009:	lda     _a
+	ldx     _a+1
+	jmp     L0006
+L000A:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0006:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f6: near
+
+.segment	"CODE"
+
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0006
+L0006:	cpx     #$00
+	jne     L000B
+	cmp     #$01
+	jeq     L0008
+	cmp     #$02
+	jeq     L0009
+	jmp     L000B
+	jmp     L000B
+L0008:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0009:	inc     _a
+	bne     L000A
+	inc     _a+1
+L000A:	lda     _a
+	ldx     _a+1
+	jmp     L0002
+L000B:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f7: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	jmp     L0005
+L0005:	cpx     #$00
+	jne     L000A
+	cmp     #$01
+	jeq     L0007
+	cmp     #$02
+	jeq     L0008
+	jmp     L000A
+	jmp     L000A
+	ldx     #$00
+	lda     #$03
+	sta     _a
+	stx     _a+1
+L0007:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0008:	inc     _a
+	bne     L0009
+	inc     _a+1
+L0009:	lda     _a
+	ldx     _a+1
+	jmp     L0006
+L000A:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0006:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ duff (char *to, char *from, unsigned int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_duff: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax7
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$07
+	jmp     L0002
+L0002:	cpx     #$00
+	jne     L0003
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L000E
+	cmp     #$02
+	jeq     L000D
+	cmp     #$03
+	jeq     L000C
+	cmp     #$04
+	jeq     L000B
+	cmp     #$05
+	jeq     L000A
+	cmp     #$06
+	jeq     L0009
+	cmp     #$07
+	jeq     L0008
+	jmp     L0003
+	jmp     L0003
+L0004:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0008:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0009:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000C:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000D:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000E:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	cpx     #$00
+	bne     L000F
+	cmp     #$00
+L000F:	jsr     boolne
+	jne     L0004
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$16
+	jsr     subysp
+	lda     #$0B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     _duff
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f5
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f6
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f7
+	jsr     tosaddax
+	jmp     L0001
+L0001:	ldy     #$16
+	jsr     addysp
+	rts
+
+.endproc
+
@@ -0,0 +1,282 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_b
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	1,$00
+_b:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	cmp     #$FF
+	jeq     L0005
+	jmp     L0006
+L0004:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0005:	jmp     L0003
+L0006:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	jmp     L0005
+L0004:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	jmp     L0003
+L0005:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	jmp     L0007
+L0004:	ldx     #$00
+	lda     _b
+	cmp     #$81
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	jmp     L0003
+	jmp     L0006
+L0005:	ldx     #$00
+	lda     #$01
+	sta     _a
+L0006:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0007:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	jmp     L0007
+L0004:	ldx     #$00
+	lda     _b
+	jmp     L0005
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	jmp     L0003
+	jmp     L0006
+L0005:	ldx     #$00
+	lda     #$01
+	sta     _a
+L0006:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0007:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	jmp     L0007
+L0004:	ldx     #$00
+	lda     _b
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	jmp     L0006
+	ldx     #$00
+	lda     #$01
+	sta     _a
+	jmp     L0003
+L0006:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0007:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f6: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _a
+	jmp     L0002
+L0002:	cmp     #$01
+	jeq     L0004
+	jmp     L0009
+L0004:	jmp     L0008
+	ldx     #$00
+	lda     _b
+	cmp     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	jmp     L0008
+L0008:	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0009:	ldx     #$00
+	lda     #$02
+	jmp     L0001
+	ldx     #$00
+	lda     _a
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f5
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f6
+	jsr     tosaddax
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
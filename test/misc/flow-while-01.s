@@ -0,0 +1,278 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0002:	inc     _a
+	bne     L0005
+	inc     _a+1
+L0005:	lda     _a
+	ldx     _a+1
+L0004:	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jmp     L0006
+L0002:	inc     _a
+	bne     L0005
+	inc     _a+1
+L0005:	lda     _a
+	ldx     _a+1
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$05
+L0007:	jsr     booleq
+	jeq     L0006
+	jmp     L0003
+L0006:	jmp     L0002
+L0003:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0002:	inc     _a
+	bne     L0005
+	inc     _a+1
+L0005:	lda     _a
+	ldx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0004:	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jmp     L0004
+	inc     _a
+	bne     L0005
+	inc     _a+1
+L0005:	lda     _a
+	ldx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0004:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0002:	inc     _a
+	bne     L0005
+	inc     _a+1
+L0005:	lda     _a
+	ldx     _a+1
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$04
+L0007:	jsr     booleq
+	jeq     L0006
+	pha
+	lda     M0001
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0001+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0003
+L0006:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0004:	jmp     L0002
+L0003:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+L0001:	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f6: near
+
+.segment	"CODE"
+
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f7: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0004:	lda     _a
+	ora     _a+1
+	jne     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f5
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f6
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f7
+	jsr     tosaddax
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,190 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jmp     L0007
+L0002:	jmp     L0007
+	inc     _a
+	bne     L0008
+	inc     _a+1
+L0008:	lda     _a
+	ldx     _a+1
+L0007:	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jmp     L0004
+L0002:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	jmp     L0003
+L0004:	jmp     L0002
+L0003:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+L0002:	jmp     L0007
+L0005:	jmp     L0006
+L0007:	jmp     L0005
+L0006:	jmp     L0002
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jmp     L0007
+L0005:	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0007:	jmp     L0005
+	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$02
+L0009:	jsr     booleq
+	jeq     L0008
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+	jmp     L000A
+L0008:	jmp     L000A
+L000A:	ldx     #$00
+	lda     #$02
+	sta     _a
+	stx     _a+1
+	lda     _a
+	ldx     _a+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	jsr     pushax
+	jsr     _f2
+	jsr     tosdivax
+	jsr     pushax
+	jsr     _f3
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f4
+	jsr     tosaddax
+	jsr     pushax
+	jsr     _f5
+	jsr     tosaddax
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
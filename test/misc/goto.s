@@ -0,0 +1,393 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+	.export		_f2
+
+; ---------------------------------------------------------------
+; void __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.segment	"BSS"
+
+M0002:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$02
+	sta     M0001
+	stx     M0001+1
+L0002:	jmp     L0002
+
+.segment	"RODATA"
+
+M0004:
+	.word	$0000
+M0005:
+	.word	$0000
+M0019:
+	.word	$0000
+M0006:
+	.word	$0000
+M001A:
+	.word	$0000
+M002E:
+	.word	$0000
+M0007:
+	.word	$0000
+M001B:
+	.word	$0000
+M002F:
+	.word	$0000
+M0043:
+	.word	$0000
+M0008:
+	.word	$0000
+M001C:
+	.word	$0000
+M0030:
+	.word	$0000
+M0044:
+	.word	$0000
+M0057:
+	.word	$0000
+M0009:
+	.word	$0000
+M001D:
+	.word	$0000
+M0031:
+	.word	$0000
+M0045:
+	.word	$0000
+M0058:
+	.word	$0000
+M006B:
+	.word	$0000
+M000A:
+	.word	$0000
+M001E:
+	.word	$0000
+M0032:
+	.word	$0000
+M0046:
+	.word	$0000
+M0059:
+	.word	$0000
+M006C:
+	.word	$0000
+M007F:
+	.word	$0000
+M000B:
+	.word	$0000
+M001F:
+	.word	$0000
+M0033:
+	.word	$0000
+M0047:
+	.word	$0000
+M005A:
+	.word	$0000
+M006D:
+	.word	$0000
+M0080:
+	.word	$0000
+M0094:
+	.word	$0000
+M000C:
+	.word	$0000
+M0020:
+	.word	$0000
+M0034:
+	.word	$0000
+M0048:
+	.word	$0000
+M005B:
+	.word	$0000
+M006E:
+	.word	$0000
+M0081:
+	.word	$0000
+M0095:
+	.word	$0000
+M00A9:
+	.word	$0000
+M000D:
+	.word	$0000
+M0021:
+	.word	$0000
+M0035:
+	.word	$0000
+M0049:
+	.word	$0000
+M005C:
+	.word	$0000
+M006F:
+	.word	$0000
+M0082:
+	.word	$0000
+M0096:
+	.word	$0000
+M00AA:
+	.word	$0000
+M00BE:
+	.word	$0000
+M000E:
+	.word	$0000
+M0022:
+	.word	$0000
+M0036:
+	.word	$0000
+M004A:
+	.word	$0000
+M005D:
+	.word	$0000
+M0070:
+	.word	$0000
+M0083:
+	.word	$0000
+M0097:
+	.word	$0000
+M00AB:
+	.word	$0000
+M00BF:
+	.word	$0000
+M00D2:
+	.word	$0000
+M000F:
+	.word	$0000
+M0023:
+	.word	$0000
+M0037:
+	.word	$0000
+M004B:
+	.word	$0000
+M005E:
+	.word	$0000
+M0071:
+	.word	$0000
+M0084:
+	.word	$0000
+M0098:
+	.word	$0000
+M00AC:
+	.word	$0000
+M00C0:
+	.word	$0000
+M00D3:
+	.word	$0000
+M00E6:
+	.word	$0000
+M0010:
+	.word	$0000
+M0024:
+	.word	$0000
+M0038:
+	.word	$0000
+M004C:
+	.word	$0000
+M005F:
+	.word	$0000
+M0072:
+	.word	$0000
+M0085:
+	.word	$0000
+M0099:
+	.word	$0000
+M00AD:
+	.word	$0000
+M00C1:
+	.word	$0000
+M00D4:
+	.word	$0000
+M00E7:
+	.word	$0000
+M00FB:
+	.word	$0000
+M0011:
+	.word	$0000
+M0025:
+	.word	$0000
+M0039:
+	.word	$0000
+M004D:
+	.word	$0000
+M0060:
+	.word	$0000
+M0073:
+	.word	$0000
+M0086:
+	.word	$0000
+M009A:
+	.word	$0000
+M00AE:
+	.word	$0000
+M00C2:
+	.word	$0000
+M00D5:
+	.word	$0000
+M00E8:
+	.word	$0000
+M00FC:
+	.word	$0000
+M0110:
+	.word	$0000
+M0012:
+	.word	$0000
+M0026:
+	.word	$0000
+M003A:
+	.word	$0000
+M004E:
+	.word	$0000
+M0061:
+	.word	$0000
+M0074:
+	.word	$0000
+M0087:
+	.word	$0000
+M009B:
+	.word	$0000
+M00AF:
+	.word	$0000
+M00C3:
+	.word	$0000
+M00D6:
+	.word	$0000
+M00E9:
+	.word	$0000
+M00FD:
+	.word	$0000
+M0111:
+	.word	$0000
+M0125:
+	.word	$0000
+M0013:
+	.word	$0000
+M0027:
+	.word	$0000
+M003B:
+	.word	$0000
+M004F:
+	.word	$0000
+M0062:
+	.word	$0000
+M0075:
+	.word	$0000
+M0088:
+	.word	$0000
+M009C:
+	.word	$0000
+M00B0:
+	.word	$0000
+M00C4:
+	.word	$0000
+M00D7:
+	.word	$0000
+M00EA:
+	.word	$0000
+M00FE:
+	.word	$0000
+M0112:
+	.word	$0000
+M0126:
+	.word	$0000
+M0139:
+	.word	$0000
+M0014:
+	.word	$0000
+M0028:
+	.word	$0000
+M003C:
+	.word	$0000
+M0050:
+	.word	$0000
+M0063:
+	.word	$0000
+M0076:
+	.word	$0000
+M0089:
+	.word	$0000
+M009D:
+	.word	$0000
+M00B1:
+	.word	$0000
+M00C5:
+	.word	$0000
+M00D8:
+	.word	$0000
+M00EB:
+	.word	$0000
+M00FF:
+	.word	$0000
+M0113:
+	.word	$0000
+M0127:
+	.word	$0000
+M013A:
+	.word	$0000
+M014D:
+	.word	$0000
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0015:
+	.res	2,$00
+M0029:
+	.res	2,$00
+M003D:
+	.res	2,$00
+M008A:
+	.res	2,$00
+M009E:
+	.res	2,$00
+M00B2:
+	.res	2,$00
+M00EC:
+	.res	2,$00
+M0100:
+	.res	2,$00
+M0114:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,10 @@
+/* Included by pch.h and again by pch.c. It has no include guard, so it must
+** be read again although it was read when the precompiled header was created.
+*/
+
+#undef INC_VALUE
+#if INC_ARG == 1
+#define INC_VALUE       1
+#else
+#define INC_VALUE       2
+#endif
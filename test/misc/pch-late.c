@@ -0,0 +1,13 @@
+/* A precompiled header is only used if its header is the first include, and
+** nothing is defined before. pch.h is precompiled first, and this file must
+** be compiled with a warning that the precompiled header is not used.
+*/
+
+#define LATE    1
+
+#include "pch.h"
+
+int main (void)
+{
+    return SQUARE (LATE) - 1;
+}
@@ -0,0 +1,12 @@
+/* A precompiled header must not be used if a file it was created from has
+** changed, even if its size and modification time are still the same. The
+** Makefile creates the precompiled header with STALE_VALUE defined as 1 and
+** then changes the header to define it as 2.
+*/
+
+#include "pch-stale.h"
+
+int main (void)
+{
+    return STALE_VALUE - 2;
+}
@@ -0,0 +1,90 @@
+/* Test of precompiled headers. pch.h is precompiled first, and this file is
+** compiled using the precompiled header with -Werror, so it fails if the
+** precompiled header cannot be used. The header must be the first include.
+*/
+
+#include "pch.h"
+#include <stdarg.h>
+
+/* pch-inc.h has no include guard, and must be read again although pch.h
+** included it.
+*/
+#undef INC_ARG
+#define INC_ARG         2
+#include "pch-inc.h"
+
+typedef struct {
+    long            z;
+} other_t;
+
+int counter = 3;
+const char names[3][4] = { "one", "two", "six" };
+
+static unsigned char failures = 0;
+
+int __fastcall__ add (int a, int b)
+{
+    return a + b;
+}
+
+int __cdecl__ sum (int n, ...)
+{
+    va_list ap;
+    int s = 0;
+    va_start (ap, n);
+    while (n--) {
+        s += va_arg (ap, int);
+    }
+    va_end (ap);
+    return s;
+}
+
+static int getx (const struct point* p)
+{
+    return p->x + p->i;
+}
+
+static void check (const char* what, long got, long expected)
+{
+    if (got != expected) {
+        printf ("%s: got %ld, expected %ld\n", what, got, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    anon_t          a;
+    other_t         o;
+    struct point    p;
+    getter_t        g = getx;
+    enum color      c = BLUE;
+
+    a.a = 1;
+    a.b = 5;
+    a.c = 17;
+    o.z = 70000L;
+    p.x = 2;
+    p.y = 0;
+    p.i = 3;
+    p.inner.tag = 'x';
+
+    check ("a.a", a.a, 1);
+    check ("a.b", a.b, 5);
+    check ("a.c", a.c, 17);
+    check ("o.z", o.z, 70000L);
+    check ("getter", g (&p), 5);
+    check ("enum", c, 6);
+    check ("sizeof", sizeof (struct point), 7);
+    check ("SQUARE", SQUARE (3), 9);
+    check ("FIRST", FIRST (4, 5, 6), 4);
+    check ("EOF", EOF, -2);
+    check ("add", add (1, 2), 3);
+    check ("sum", sum (3, 1, 2, 3), 6);
+    check ("counter", counter, 3);
+    check ("strlen", strlen (names[1]), 3);
+    check ("INC_VALUE", INC_VALUE, 2);
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
@@ -0,0 +1,46 @@
+/* Header for the precompiled header test, see pch.c */
+
+#ifndef PCH_H
+#define PCH_H
+
+#include <stdio.h>
+#include <string.h>
+
+#define INC_ARG         1
+#include "pch-inc.h"
+
+#define SQUARE(x)       ((x) * (x))
+#define FIRST(a, ...)   (a)
+
+#undef EOF
+#define EOF             (-2)
+
+typedef struct {
+    int             a;
+    unsigned        b : 3;
+    unsigned        c : 5;
+} anon_t;
+
+struct point {
+    int             x;
+    int             y;
+    struct {
+        char        tag;
+    } inner;
+    union {
+        int         i;
+        char        c[2];
+    };
+};
+
+enum color { RED, GREEN = 5, BLUE };
+
+typedef int (*getter_t) (const struct point* p);
+
+extern int counter;
+extern const char names[3][4];
+
+int __fastcall__ add (int a, int b);
+int __cdecl__ sum (int n, ...);
+
+#endif
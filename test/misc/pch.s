@@ -0,0 +1,496 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_names
+	.export		_add
+	.export		_sum
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0003
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_names:
+	.byte	$4F,$4E,$45,$00
+	.byte	$54,$57,$4F,$00
+	.byte	$53,$49,$58,$00
+S0004:
+	.byte	$25,$53,$3A,$20,$47,$4F,$54,$20,$25,$4C,$44,$2C,$20,$45,$58,$50
+	.byte	$45,$43,$54,$45,$44,$20,$25,$4C,$44,$0D,$00
+S0014:
+	.byte	$25,$55,$20,$46,$41,$49,$4C,$55,$52,$45,$53,$0D,$00
+S0013:
+	.byte	$C9,$CE,$C3,$A4,$D6,$C1,$CC,$D5,$C5,$00
+S0011:
+	.byte	$43,$4F,$55,$4E,$54,$45,$52,$00
+S000C:
+	.byte	$D3,$D1,$D5,$C1,$D2,$C5,$00
+S000B:
+	.byte	$53,$49,$5A,$45,$4F,$46,$00
+S0009:
+	.byte	$47,$45,$54,$54,$45,$52,$00
+S0012:
+	.byte	$53,$54,$52,$4C,$45,$4E,$00
+S000D:
+	.byte	$C6,$C9,$D2,$D3,$D4,$00
+S000A:
+	.byte	$45,$4E,$55,$4D,$00
+S0006:
+	.byte	$41,$2E,$42,$00
+S0007:
+	.byte	$41,$2E,$43,$00
+S000E:
+	.byte	$C5,$CF,$C6,$00
+S000F:
+	.byte	$41,$44,$44,$00
+S0010:
+	.byte	$53,$55,$4D,$00
+S0005:
+	.byte	$41,$2E,$41,$00
+S0008:
+	.byte	$4F,$2E,$5A,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ sum (int n, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	jsr     enter
+	lda     #$00
+	sta     M0002
+	sta     M0002+1
+	tay
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     decax1
+	sta     M0001
+	stx     M0001+1
+	jmp     L0006
+L0002:	lda     M0001
+	sec
+	sbc     #$02
+	sta     M0001
+	bcs     L0005
+	dec     M0001+1
+L0005:	ldx     M0001+1
+	jsr     ldaxi
+	clc
+	adc     M0002
+	sta     M0002
+	txa
+	adc     M0002+1
+	sta     M0002+1
+	ldy     #$00
+L0006:	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     decax1
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	jsr     decax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     regsave
+	ora     regsave+1
+	bne     L0002
+	lda     M0002
+	ldx     M0002+1
+	jmp     leave
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getx (const struct point *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getx: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	jsr     ldax0sp
+	ldy     #$06
+	jsr     ldaxidx
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *what, long got, long expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+	inc     _failures
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #>(_getx)
+	sta     M0004+1
+	lda     #<(_getx)
+	sta     M0004
+	lda     #$06
+	sta     M0005
+	ldx     #$00
+	lda     #$01
+	sta     M0001
+	stx     M0001+1
+	lda     M0001+2
+	and     #$F8
+	ora     #$05
+	sta     M0001+2
+	and     #$07
+	ora     #$88
+	sta     M0001+2
+	stx     M0002+3
+	lda     #$01
+	sta     M0002+2
+	lda     #$11
+	sta     M0002+1
+	lda     #$70
+	sta     M0002
+	lda     #$02
+	sta     M0003
+	stx     M0003+1
+	txa
+	sta     M0003+2
+	sta     M0003+2+1
+	lda     #$03
+	sta     M0003+5
+	stx     M0003+5+1
+	lda     #$58
+	sta     M0003+4
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     M0001+2
+	ldx     #$00
+	and     #$07
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$05
+	jsr     _check
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     M0001+2
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$11
+	jsr     _check
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     M0002+3
+	sta     sreg+1
+	lda     M0002+2
+	sta     sreg
+	ldx     M0002+1
+	lda     M0002
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	jsr     _check
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     M0004
+	ldx     M0004+1
+	jsr     pushax
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     _check
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     M0005
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$06
+	jsr     _check
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$07
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$09
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$04
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	lda     #$FE
+	ldx     #$FF
+	jsr     pusheax
+	jsr     _check
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     _add
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     pusha0
+	lda     #$03
+	jsr     pusha0
+	ldy     #$08
+	jsr     _sum
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$06
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _counter
+	ldx     _counter+1
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_names+4)
+	ldx     #>(_names+4)
+	jsr     _strlen
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$02
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	3,$00
+M0002:
+	.res	4,$00
+M0003:
+	.res	7,$00
+M0004:
+	.res	2,$00
+M0005:
+	.res	1,$00
+
+.endproc
+
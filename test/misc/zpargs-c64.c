@@ -0,0 +1,27 @@
+/* The c64 has no zero page space left for the zero page argument block, so
+** it is placed into the BSS there. The program must link for the c64, and
+** pointer parameters in the block must not be used for indirect addressing.
+*/
+
+unsigned char buf[4];
+
+unsigned char get (const unsigned char* p, unsigned char i) __attribute__ ((zpargs))
+{
+    return p[i];
+}
+
+void put (unsigned char* p, unsigned char i, unsigned char v) __attribute__ ((zpargs))
+{
+    p[i] = v;
+}
+
+int add (int a, int b) __attribute__ ((zpargs))
+{
+    return a + b;
+}
+
+int main (void)
+{
+    put (buf, 2, 7);
+    return add (get (buf, 2), 3) != 10;
+}
@@ -0,0 +1,465 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_up
+	.export		_down
+	.export		_rows
+	.export		_x
+	.export		_queens
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$63,$00
+S0003:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_up:
+	.res	30,$00
+_down:
+	.res	30,$00
+_rows:
+	.res	16,$00
+_x:
+	.res	16,$00
+
+; ---------------------------------------------------------------
+; void __near__ queens (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_queens: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jne     L0009
+L0008:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0004
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$07
+L000C:	jsr     booleq
+	jeq     L000B
+	jsr     _print
+	jmp     L000D
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     _queens
+L000D:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$31
+	jsr     incaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0008
+	eor     #$80
+L0008:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$0F
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0008
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+L0008:	ldx     #$00
+	lda     #$00
+	jsr     _queens
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
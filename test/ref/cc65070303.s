@@ -0,0 +1,73 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_Bs
+	.export		_APtr
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$48,$61,$6C,$6C,$6F,$20,$57,$65,$6C,$74,$21,$20,$25,$69,$20,$3D
+	.byte	$20,$25,$69,$20,$0A,$00
+
+.segment	"BSS"
+
+_Bs:
+	.res	120,$00
+_APtr:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$0B
+	sta     _Bs+94
+	stx     _Bs+94+1
+	lda     #<(_Bs+90)
+	ldx     #>(_Bs+90)
+	sta     _APtr
+	stx     _APtr+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _Bs+94
+	ldx     _Bs+94+1
+	jsr     pushax
+	lda     _APtr
+	ldx     _APtr+1
+	jsr     incax4
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp4
+	rts
+
+.endproc
+
@@ -0,0 +1,87 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$00
+	sta     M0001
+L0002:	ldx     #$00
+	lda     M0001
+	cmp     #$10
+	jsr     boolult
+	jne     L0005
+	jmp     L0003
+L0005:	ldx     #$00
+	lda     M0002
+	jsr     incax1
+	ldx     #$00
+	sta     M0002
+	ldx     #$00
+	inc     M0001
+	lda     M0001
+	jmp     L0002
+L0003:	jmp     L0009
+L0008:	jmp     L0003
+L0009:	jmp     L0008
+	rts
+
+.segment	"DATA"
+
+M0001:
+	.byte	$00
+M0002:
+	.byte	$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,182 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_fs
+	.export		_fd
+	.export		_a
+	.export		__func1
+	.export		_test1
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+.segment	"BSS"
+
+_fs:
+	.res	4,$00
+_fd:
+	.res	4,$00
+_a:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; unsigned long __near__ _func1 (unsigned long x, unsigned long y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__func1: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jmp     L0001
+L0001:	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	lda     _fd+3
+	sta     sreg+1
+	lda     _fd+2
+	sta     sreg
+	ldx     _fd+1
+	lda     _fd
+	jsr     pusheax
+	lda     _a+3
+	sta     sreg+1
+	lda     _a+2
+	sta     sreg
+	ldx     _a+1
+	lda     _a
+	jsr     tosudiveax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$82
+	sta     sreg
+	lda     #$0F
+	ldx     #$C9
+	jsr     __func1
+	jsr     __func1
+	sta     _fs
+	stx     _fs+1
+	ldy     sreg
+	sty     _fs+2
+	ldy     sreg+1
+	sty     _fs+3
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	lda     _fd+3
+	sta     sreg+1
+	lda     _fd+2
+	sta     sreg
+	ldx     _fd+1
+	lda     _fd
+	jsr     pusheax
+	lda     _a+3
+	sta     sreg+1
+	lda     _a+2
+	sta     sreg
+	ldx     _a+1
+	lda     _a
+	jsr     tosudiveax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$82
+	sta     sreg
+	lda     #$0F
+	ldx     #$C9
+	jsr     __func1
+	jsr     __func1
+	sta     _fs
+	stx     _fs+1
+	ldy     sreg
+	sty     _fs+2
+	ldy     sreg+1
+	sty     _fs+3
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,164 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$55,$0D,$00
+S0001:
+	.byte	$5A,$45,$52,$4F,$45,$53,$3A,$20,$25,$55,$0D,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #$FF
+	sta     M0002
+	sta     M0002+1
+	lda     #$00
+	sta     M0001
+	sta     M0001+1
+L0002:	ldx     M0001+1
+	cpx     #$01
+	bcs     L0003
+	jsr     ldax0sp
+	clc
+	adc     M0001
+	sta     ptr1
+	txa
+	adc     M0001+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	eor     M0002+1
+	sta     M0002+1
+	sty     M0003
+L000E:	lda     M0003
+	cmp     #$08
+	bcs     L0004
+	lda     M0002+1
+	and     #$80
+	beq     L000B
+	lda     M0002
+	ldx     M0002+1
+	jsr     shlax1
+	eor     #$21
+	sta     M0002
+	txa
+	eor     #$10
+	tax
+	jmp     L000D
+L000B:	lda     M0002
+	ldx     M0002+1
+	jsr     shlax1
+	sta     M0002
+L000D:	stx     M0002+1
+	inc     M0003
+	jmp     L000E
+L0004:	inc     M0001
+	bne     L0002
+	inc     M0001+1
+	jmp     L0002
+L0003:	lda     M0002
+	ldx     M0002+1
+	jsr     complax
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0002:
+	.res	2,$00
+M0003:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$00
+	sta     M0001
+	sta     M0001+1
+L0002:	ldx     M0001+1
+	cpx     #$01
+	bcs     L0003
+	lda     M0001
+	clc
+	adc     #<(_block)
+	sta     ptr1
+	lda     M0001+1
+	adc     #>(_block)
+	sta     ptr1+1
+	lda     M0001
+	ldy     #$00
+	sta     (ptr1),y
+	inc     M0001
+	bne     L0002
+	inc     M0001+1
+	jmp     L0002
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,68 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_a
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$20,$2F,$20,$62,$20,$3D,$20,$25,$64,$00
+
+.segment	"BSS"
+
+_a:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	ldx     #$00
+	lda     #$64
+	sta     _a
+	ldx     #$00
+	lda     _a
+	jsr     pushax
+	ldx     #$27
+	lda     #$10
+	jsr     tosdivax
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp1
+	rts
+
+.endproc
+
@@ -0,0 +1,929 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_atoi
+	.import		_isprint
+	.export		_in
+	.export		_f
+	.export		_main
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$69,$73,$70,$72,$69,$6E,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65
+	.byte	$71,$0A,$0A,$00
+S0012:
+	.byte	$72,$65,$73,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A
+	.byte	$00
+S000C:
+	.byte	$30,$2D,$39,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0006:
+	.byte	$61,$2D,$7A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0009:
+	.byte	$41,$2D,$5A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0005:
+	.byte	$0A,$0A,$63,$6F,$75,$6E,$74,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$69,$6E,$70,$75,$74,$3A,$0A,$0A,$00
+S0013:
+	.byte	$6E,$65,$77,$6C,$69,$6E,$65,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S000B:
+	.byte	$3A,$25,$64,$0A,$00
+S0008	:=	S000B+0
+S0014:
+	.byte	$25,$30,$33,$6F,$00
+S000E	:=	S000B+0
+S0011	:=	S000B+0
+S0015	:=	S000B+0
+S0007:
+	.byte	$25,$63,$00
+S0004	:=	S0007+0
+S0002:
+	.byte	$72,$62,$00
+S000D	:=	S0007+0
+S0010	:=	S0007+0
+S000A	:=	S0007+0
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_f:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0006
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosdivax
+	ldy     #$00
+	jsr     staxysp
+L0006:	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0007:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0008
+L0009:	jmp     L0007
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0009
+L0008:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000E
+L000C:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000E:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+L000F:	jsr     boolne
+	jne     L000C
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0010:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0014
+	eor     #$80
+L0014:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0013
+	jmp     L0011
+L0013:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0016
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0017
+L0016:	ldx     #$00
+	lda     #$00
+	jeq     L0018
+L0017:	ldx     #$00
+	lda     #$01
+L0018:	jeq     L0012
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$61
+	txa
+	sbc     #$00
+	bvs     L001A
+	eor     #$80
+L001A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001B
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$7B
+	txa
+	sbc     #$00
+	bvc     L001C
+	eor     #$80
+L001C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001D
+L001B:	ldx     #$00
+	lda     #$00
+	jeq     L001E
+L001D:	ldx     #$00
+	lda     #$01
+L001E:	jeq     L0012
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+L0012:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0010
+L0011:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L001F:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0023
+	eor     #$80
+L0023:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0022
+	jmp     L0020
+L0022:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0025
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0026
+L0025:	ldx     #$00
+	lda     #$00
+	jeq     L0027
+L0026:	ldx     #$00
+	lda     #$01
+L0027:	jeq     L0021
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$41
+	txa
+	sbc     #$00
+	bvs     L0029
+	eor     #$80
+L0029:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L002A
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$5B
+	txa
+	sbc     #$00
+	bvc     L002B
+	eor     #$80
+L002B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L002C
+L002A:	ldx     #$00
+	lda     #$00
+	jeq     L002D
+L002C:	ldx     #$00
+	lda     #$01
+L002D:	jeq     L0021
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+L0021:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L001F
+L0020:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0032
+	eor     #$80
+L0032:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0031
+	jmp     L002F
+L0031:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0034
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0035
+L0034:	ldx     #$00
+	lda     #$00
+	jeq     L0036
+L0035:	ldx     #$00
+	lda     #$01
+L0036:	jeq     L0030
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$30
+	txa
+	sbc     #$00
+	bvs     L0038
+	eor     #$80
+L0038:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0039
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$3A
+	txa
+	sbc     #$00
+	bvc     L003A
+	eor     #$80
+L003A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L003B
+L0039:	ldx     #$00
+	lda     #$00
+	jeq     L003C
+L003B:	ldx     #$00
+	lda     #$01
+L003C:	jeq     L0030
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+L0030:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L002E
+L002F:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L003D:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0041
+	eor     #$80
+L0041:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0040
+	jmp     L003E
+L0040:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0043
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0044
+L0043:	ldx     #$00
+	lda     #$00
+	jeq     L0045
+L0044:	ldx     #$00
+	lda     #$01
+L0045:	jeq     L003F
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	jeq     L003F
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+L003F:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L003D
+L003E:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0047:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L004B
+	eor     #$80
+L004B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L004A
+	jmp     L0048
+L004A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L004D
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L004E
+L004D:	ldx     #$00
+	lda     #$00
+	jeq     L004F
+L004E:	ldx     #$00
+	lda     #$01
+L004F:	jeq     L0049
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0051
+	cmp     #$0A
+L0051:	jsr     booleq
+	jeq     L0050
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0052
+L0050:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0052:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0049:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0047
+L0048:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	ldy     #$0C
+	jsr     addysp
+	rts
+
+.endproc
+
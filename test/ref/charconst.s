@@ -0,0 +1,163 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_isprint
+	.export		_backslash
+	.export		_testbackslash
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0001:
+	.byte	$25,$63,$20,$3A,$20,$00
+S0002:
+	.byte	$6F,$6B,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ backslash (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jmp     L0002
+L0002:	cmp     #$62
+	jeq     L0004
+	cmp     #$66
+	jeq     L0005
+	cmp     #$6E
+	jeq     L0006
+	cmp     #$72
+	jeq     L0007
+	cmp     #$74
+	jeq     L0008
+	cmp     #$76
+	jeq     L0009
+	jmp     L0003
+L0004:	ldx     #$00
+	lda     #$08
+	ldy     #$00
+	sta     (c_sp),y
+L0005:	ldx     #$00
+	lda     #$0C
+	ldy     #$00
+	sta     (c_sp),y
+L0006:	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	sta     (c_sp),y
+L0007:	ldx     #$00
+	lda     #$0D
+	ldy     #$00
+	sta     (c_sp),y
+L0008:	ldx     #$00
+	lda     #$09
+	ldy     #$00
+	sta     (c_sp),y
+L0009:	ldx     #$00
+	lda     #$0B
+	ldy     #$00
+	sta     (c_sp),y
+	jmp     L0003
+L0003:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isprint
+	jsr     bnegax
+	jeq     L000A
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000B
+L000A:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000B:	jsr     incsp1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$62
+	jsr     _backslash
+	ldx     #$00
+	lda     #$66
+	jsr     _backslash
+	ldx     #$00
+	lda     #$6E
+	jsr     _backslash
+	ldx     #$00
+	lda     #$72
+	jsr     _backslash
+	ldx     #$00
+	lda     #$74
+	jsr     _backslash
+	ldx     #$00
+	lda     #$76
+	jsr     _backslash
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,956 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_Dijkstra_Init
+	.export		_Dijkstra_Search
+	.export		_Dijkstra_Path
+	.export		_Dijkstra_Table
+	.export		_Dijkstra_Distance
+	.export		_Dijkstra_Relax
+	.export		_Dijkstra_NextCheapest
+	.export		_Dijkstra_CountUnvisited
+	.export		_mynodes
+	.export		_myedges_A
+	.export		_myedges_B
+	.export		_myedges_C
+	.export		_myedges_D
+	.export		_myedges_E
+	.export		_myedges_F
+	.export		_myedges_G
+	.export		_myedges_H
+	.export		_myedges_I
+	.export		_myedges_J
+	.export		_myedges_K
+	.export		_myedges_L
+	.export		_mypoints
+	.export		_main
+
+.segment	"RODATA"
+
+_myedges_A:
+	.addr	_mynodes+8
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_B:
+	.addr	_mynodes
+	.word	$0001
+	.addr	_mynodes+16
+	.word	$0002
+	.addr	_mynodes+24
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_C:
+	.addr	_mynodes+8
+	.word	$0002
+	.addr	_mynodes+40
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_D:
+	.addr	_mynodes+8
+	.word	$0001
+	.addr	_mynodes+32
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_E:
+	.addr	_mynodes+48
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_F:
+	.addr	_mynodes+56
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_G:
+	.addr	_mynodes+64
+	.word	$0001
+	.addr	_mynodes+56
+	.word	$0004
+	.word	$0000
+	.res	2,$00
+_myedges_H:
+	.addr	_mynodes+72
+	.word	$0001
+	.addr	_mynodes+48
+	.word	$0004
+	.word	$0000
+	.res	2,$00
+_myedges_I:
+	.addr	_mynodes+80
+	.word	$0005
+	.word	$0000
+	.res	2,$00
+_myedges_J:
+	.addr	_mynodes+80
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_K:
+	.addr	_mynodes+88
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_L:
+	.addr	_mynodes+80
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_mypoints:
+	.addr	_myedges_A
+	.byte	$41
+	.res	5,$00
+	.addr	_myedges_B
+	.byte	$42
+	.res	5,$00
+	.addr	_myedges_C
+	.byte	$43
+	.res	5,$00
+	.addr	_myedges_D
+	.byte	$44
+	.res	5,$00
+	.addr	_myedges_E
+	.byte	$45
+	.res	5,$00
+	.addr	_myedges_F
+	.byte	$46
+	.res	5,$00
+	.addr	_myedges_G
+	.byte	$47
+	.res	5,$00
+	.addr	_myedges_H
+	.byte	$48
+	.res	5,$00
+	.addr	_myedges_I
+	.byte	$49
+	.res	5,$00
+	.addr	_myedges_J
+	.byte	$4A
+	.res	5,$00
+	.addr	_myedges_K
+	.byte	$4B
+	.res	5,$00
+	.addr	_myedges_L
+	.byte	$4C
+	.res	5,$00
+	.word	$0000
+	.res	6,$00
+S0002:
+	.byte	$6E,$65,$78,$74,$20,$63,$68,$65,$61,$70,$65,$73,$74,$20,$4E,$6F
+	.byte	$64,$65,$3A,$20,$3E,$25,$63,$3C,$0A,$00
+S0003:
+	.byte	$50,$61,$74,$68,$20,$66,$72,$6F,$6D,$20,$3E,$25,$63,$3C,$20,$74
+	.byte	$6F,$20,$3E,$25,$63,$3C,$20,$3A,$20,$00
+S0006:
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$0A,$00
+S0016	:=	S0006+0
+S0001:
+	.byte	$72,$65,$6C,$61,$78,$20,$3E,$25,$63,$3C,$20,$74,$6F,$20,$3E,$25
+	.byte	$63,$3C,$0A,$00
+S0012:
+	.byte	$50,$72,$65,$76,$69,$6F,$75,$73,$7C,$00
+S000A:
+	.byte	$4D,$69,$6E,$44,$69,$73,$74,$20,$7C,$00
+S0007:
+	.byte	$4E,$6F,$64,$65,$20,$20,$20,$20,$7C,$00
+S000D:
+	.byte	$46,$6C,$61,$67,$20,$20,$20,$20,$7C,$00
+S0008:
+	.byte	$2D,$2D,$3E,$25,$63,$3C,$2D,$7C,$00
+S0014:
+	.byte	$20,$20,$28,$25,$63,$29,$20,$7C,$00
+S000F:
+	.byte	$6F,$70,$65,$6E,$65,$64,$7C,$00
+S0010:
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$7C,$00
+S0013	:=	S0010+0
+S000E:
+	.byte	$63,$6C,$6F,$73,$65,$64,$7C,$00
+S000B:
+	.byte	$20,$25,$35,$75,$7C,$00
+S0004:
+	.byte	$3E,$25,$63,$3C,$20,$00
+S0005	:=	S0002+20
+S0011	:=	S0002+24
+S000C	:=	S0002+24
+S0009	:=	S0002+24
+S0015	:=	S0002+24
+
+.segment	"BSS"
+
+_mynodes:
+	.res	128,$00
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Init (const struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *start, struct _DIJKSTRA_NODE *nodes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Init: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jmp     L0004
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	ldy     #$02
+	jsr     staspidx
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$03
+	jsr     staspidx
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	ldy     #$04
+	jsr     staxspidx
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxspidx
+	ldy     #$04
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxspidx
+	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Search (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Search: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0004
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0008
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L000A
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _Dijkstra_Relax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_Table
+L000A:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jne     L0006
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_NextCheapest
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$03
+	jsr     staspidx
+L0004:	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_CountUnvisited
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Path (struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *end)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Path: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0004
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Table (struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *current)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Table: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0004
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0008
+L0006:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jne     L0006
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L000C
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	jmp     L000E
+L000E:	cmp     #$02
+	jeq     L0010
+	jmp     L0011
+L0010:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000F
+L0011:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	cpx     #$FF
+	bne     L0013
+	cmp     #$FF
+L0013:	jsr     boolne
+	jeq     L0012
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0014
+L0012:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0014:	jmp     L000F
+L000F:	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L000C:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+L000D:	jsr     boolne
+	jne     L000A
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0017
+L0015:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001A
+	cmp     #$00
+L001A:	jsr     booleq
+	jeq     L0019
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L001B
+L0019:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L001B:	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0017:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+L0018:	jsr     boolne
+	jne     L0015
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned short __near__ Dijkstra_Distance (struct _DIJKSTRA_NODE *currnode, struct _DIJKSTRA_NODE *nextnode)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Distance: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0004
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L0006
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jmp     L0001
+L0006:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+L0001:	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Relax (struct _DIJKSTRA_NODE *currnode, struct _DIJKSTRA_NODE *nextnode)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Relax: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_Distance
+	jsr     tosaddax
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosugtax
+	jeq     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxspidx
+L0002:	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; struct _DIJKSTRA_NODE *__near__ Dijkstra_NextCheapest (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_NextCheapest: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	ldx     #$FF
+	lda     #$FF
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0004
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0007
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosultax
+	jsr     bnegax
+	jeq     L0007
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+L0007:	ldy     #$04
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+L0001:	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned short __near__ Dijkstra_CountUnvisited (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_CountUnvisited: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0004
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0006
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0006:	ldy     #$02
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+L0001:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(_mypoints)
+	ldx     #>(_mypoints)
+	jsr     pushax
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     _Dijkstra_Init
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     _Dijkstra_Search
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes+88)
+	ldx     #>(_mynodes+88)
+	jsr     _Dijkstra_Table
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes+88)
+	ldx     #>(_mynodes+88)
+	jsr     _Dijkstra_Path
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,259 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+	.export		_memchar
+	.export		_memint
+	.export		_regchar
+	.export		_regint
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$64,$69,$73,$61,$73,$73,$65,$6D,$62,$6C,$65,$20,$74,$68,$69,$73
+	.byte	$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$74,$6F,$20,$63,$68,$65,$63
+	.byte	$6B,$20,$74,$68,$65,$20,$67,$65,$6E,$65,$72,$61,$74,$65,$64,$20
+	.byte	$63,$6F,$64,$65,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memchar: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	jsr     incsp3
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memint: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regchar: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	jsr     incsp3
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regint: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	jsr     incsp4
+	rts
+
+.endproc
+
@@ -0,0 +1,342 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_abs
+	.export		_dither
+	.export		_mandelbrot
+	.export		_main
+
+.segment	"DATA"
+
+_dither:
+	.byte	$20,$2E,$2A,$6F,$2B,$30,$25,$23
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$63,$00
+S0004:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_SCREEN_X:
+	.res	2,$00
+_SCREEN_Y:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ mandelbrot (short x1, short y1, short x2, short y2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mandelbrot: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$12
+	jsr     subysp
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosudivax
+	ldy     #$09
+	jsr     staxysp
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     _SCREEN_Y
+	jsr     tosdivax
+	ldy     #$07
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     staxysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (c_sp),y
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldx     #$00
+	lda     _SCREEN_Y
+	jsr     tosultax
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     addeqysp
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     staxysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	jsr     staxysp
+L0006:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosultax
+	jne     L0009
+	jmp     L0007
+L0009:	ldy     #$0A
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     addeqysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$0B
+	sta     (c_sp),y
+L000A:	ldy     #$0B
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$10
+	jsr     boolult
+	jeq     L000E
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0011
+L000E:	ldx     #$00
+	lda     #$00
+	jeq     L0012
+L0011:	ldx     #$00
+	lda     #$01
+L0012:	jne     L000D
+	jmp     L000B
+L000D:	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0013
+	dey
+L0013:	sty     sreg+1
+	jsr     asreax4
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0014
+	dey
+L0014:	sty     sreg+1
+	jsr     asreax4
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0015
+	dey
+L0015:	sty     sreg+1
+	jsr     asreax3
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0B
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L000A
+L000B:	ldy     #$0B
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$10
+	jsr     booleq
+	jeq     L0016
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0D
+	ldx     #$00
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$07
+	clc
+	adc     #<(_dither)
+	tay
+	txa
+	adc     #>(_dither)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0008:	ldy     #$01
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0006
+L0007:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L0002
+L0003:	ldy     #$1A
+	jsr     addysp
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$50
+	sta     _SCREEN_X
+	stx     _SCREEN_X+1
+	ldx     #$00
+	lda     #$28
+	sta     _SCREEN_Y
+	ldx     #$E0
+	lda     #$00
+	jsr     pushax
+	ldx     #$E0
+	lda     #$00
+	jsr     pushax
+	ldx     #$20
+	lda     #$00
+	jsr     pushax
+	ldx     #$20
+	lda     #$00
+	jsr     _mandelbrot
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
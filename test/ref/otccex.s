@@ -0,0 +1,553 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fprintf
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		_atoi
+	.export		_help
+	.export		_fib
+	.export		_fact
+	.export		_print_num
+	.export		_mymain
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$43,$6F,$6D,$70,$75,$74,$65,$20,$66,$69,$62,$28,$6E,$29,$20,$61
+	.byte	$6E,$64,$20,$66,$61,$63,$74,$28,$6E,$29,$20,$61,$6E,$64,$20,$6F
+	.byte	$75,$74,$70,$75,$74,$20,$74,$68,$65,$20,$72,$65,$73,$75,$6C,$74
+	.byte	$20,$69,$6E,$20,$62,$61,$73,$65,$20,$27,$62,$61,$73,$65,$27,$0A
+	.byte	$00
+S0009:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$6E,$20,$5B,$62,$61,$73
+	.byte	$65,$5D,$0A,$00
+S0003:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$62,$61,$73,$65,$0A,$00
+S0006:
+	.byte	$66,$61,$63,$74,$28,$25,$64,$29,$20,$3D,$20,$00
+S0004:
+	.byte	$66,$69,$62,$28,$25,$64,$29,$20,$3D,$0A,$00
+S0001:
+	.byte	$5B,$66,$69,$62,$28,$25,$64,$29,$5D,$00
+S0007:
+	.byte	$4F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S000B:
+	.byte	$6F,$74,$63,$63,$65,$78,$00
+S0002:
+	.byte	$25,$63,$00
+S000C:
+	.byte	$31,$30,$00
+S0008	:=	S000A+63
+S000D:
+	.byte	$38,$00
+S0005	:=	S000A+63
+
+; ---------------------------------------------------------------
+; void __near__ help (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_help: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ fib (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fib: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0004
+	jmp     L0004
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fib
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax2
+	jsr     _fib
+	jsr     tosaddax
+	jmp     L0004
+L0004:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ fact (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	ldy     #$00
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosleax
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$00
+	jsr     steaxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0001
+L0001:	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print_num (n, b) long n; int b;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print_num: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp5
+	ldx     #$01
+	lda     #$00
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     staxysp
+	jmp     L0007
+L0002:	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$0A
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$61
+	jsr     incaxy
+	ldy     #$0A
+	jsr     decaxy
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	jmp     L0006
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$30
+	jsr     incaxy
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+L0006:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$01
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$07
+	jsr     steaxysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     toseqeax
+	jeq     L0007
+	jmp     L0003
+L0007:	jmp     L0002
+L0003:	jmp     L000A
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$01
+	jsr     subeqysp
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L0008
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$0B
+	jsr     addysp
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ mymain (argc, argv) int argc; char **argv;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mymain: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$02
+L0003:	jsr     boolne
+	jeq     L0004
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$03
+L0005:	jsr     boolne
+	jne     L0006
+L0004:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0002
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _help
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000C
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$25
+	txa
+	sbc     #$00
+	bvs     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000C
+	ldx     #$00
+	lda     #$00
+	jeq     L000E
+L000C:	ldx     #$00
+	lda     #$01
+L000E:	jeq     L000A
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _fib
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$0D
+	txa
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L000F:	lda     #<(_fact)
+	ldx     #>(_fact)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+L0011:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	ldy     #$0C
+	jsr     addysp
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	ldy     #$00
+	jsr     staxysp
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _mymain
+	jmp     L0001
+L0001:	jsr     incsp6
+	rts
+
+.endproc
+
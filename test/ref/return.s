@@ -0,0 +1,704 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_val_char
+	.export		_val_int
+	.export		_val_long
+	.export		_test1_int_char
+	.export		_test1_int_int
+	.export		_test2_int_char
+	.export		_test2_int_int
+	.export		_test1_long_char
+	.export		_test1_long_int
+	.export		_test1_long_long
+	.export		_test2_long_char
+	.export		_test2_long_int
+	.export		_test2_long_long
+	.export		_main
+
+.segment	"DATA"
+
+_val_char:
+	.byte	$76
+_val_int:
+	.word	$5678
+_val_long:
+	.dword	$12345678
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$0A,$77,$69,$74,$68,$6F,$75,$74,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0003:
+	.byte	$25,$30,$34,$6C,$78,$20,$25,$30,$34,$6C,$78,$2C,$00
+S0022	:=	S0003+0
+S001F	:=	S0003+0
+S0006	:=	S0003+0
+S001C	:=	S0003+0
+S001B:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$6C,$6F,$6E,$67,$0A,$00
+S0009	:=	S001B+0
+S000A	:=	S0003+0
+S0018	:=	S0003+0
+S0015	:=	S0003+0
+S000D	:=	S0003+0
+S0013:
+	.byte	$0A,$77,$69,$74,$68,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0010	:=	S0003+0
+S0014:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$69,$6E,$74,$0A,$00
+S0002	:=	S0014+0
+S0023:
+	.byte	$66,$61,$69,$6C,$65,$64,$0A,$00
+S0004	:=	S0023+0
+S000E	:=	S0023+0
+S0020	:=	S0023+0
+S0016	:=	S0023+0
+S001D	:=	S0023+0
+S000B	:=	S0023+0
+S0019	:=	S0023+0
+S0007	:=	S0023+0
+S0011	:=	S0023+0
+S001A:
+	.byte	$6F,$6B,$0A,$00
+S0017	:=	S001A+0
+S001E	:=	S001A+0
+S0005	:=	S001A+0
+S000C	:=	S001A+0
+S0021	:=	S001A+0
+S000F	:=	S001A+0
+S0012	:=	S001A+0
+S0024	:=	S001A+0
+S0008	:=	S001A+0
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	jsr     axulong
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	jsr     axulong
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_long: near
+
+.segment	"CODE"
+
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	jsr     axulong
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	jsr     axulong
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_long: near
+
+.segment	"CODE"
+
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$76
+L0003:	jsr     boolne
+	jeq     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0004:	jsr     _test1_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$56
+	bne     L0006
+	cmp     #$78
+L0006:	jsr     boolne
+	jeq     L0005
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0007
+L0005:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0007:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_long_char
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0008
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0009
+L0008:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0009:	jsr     _test1_long_int
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	jeq     L000A
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000B
+L000A:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000B:	jsr     _test1_long_long
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	jeq     L000C
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000D
+L000C:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000D:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000F
+	cmp     #$76
+L000F:	jsr     boolne
+	jeq     L000E
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0010
+L000E:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0010:	jsr     _test2_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$56
+	bne     L0012
+	cmp     #$78
+L0012:	jsr     boolne
+	jeq     L0011
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0013
+L0011:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0013:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_long_char
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0014
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0015
+L0014:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0015:	jsr     _test2_long_int
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	jeq     L0016
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+L0016:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0017:	jsr     _test2_long_long
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	jeq     L0018
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0019
+L0018:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0019:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp6
+	rts
+
+.endproc
+
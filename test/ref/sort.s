@@ -0,0 +1,448 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_putchar
+	.export		_in
+	.export		_xx
+	.export		_exchange
+	.export		_partition
+	.export		_quick
+	.export		_sort
+	.export		_putd
+	.export		_main
+
+.segment	"DATA"
+
+_in:
+	.word	$000A
+	.word	$0020
+	.word	$FFFF
+	.word	$0237
+	.word	$0003
+	.word	$0012
+	.word	$0001
+	.word	$FFCD
+	.word	$0315
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$65,$78,$63,$68,$61,$6E,$67,$65,$28,$25,$64,$2C,$25,$64,$29,$0A
+	.byte	$00
+
+.segment	"BSS"
+
+_xx:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ exchange (int *x, int *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_exchange: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _xx
+	ldx     _xx+1
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _xx
+	ldx     _xx+1
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ partition (int *a, int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_partition: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000B
+L0002:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+L0005:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0007:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0005
+	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	jmp     L000A
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+L000A:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosgtax
+	jne     L0008
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosltax
+	jeq     L000B
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     _exchange
+L000B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0002
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     _exchange
+	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+L0001:	ldy     #$0A
+	jsr     addysp
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ quick (int *a, int lb, int ub)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_quick: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosgeax
+	jeq     L0002
+	jmp     L0001
+L0002:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _partition
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _quick
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _quick
+L0001:	jsr     incsp8
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sort (int *a, int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _xx
+	stx     _xx+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	jsr     _quick
+	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ putd (int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_putd: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$2D
+	jsr     _putchar
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     negax
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosdivax
+	stx     tmp1
+	ora     tmp1
+	jeq     L0003
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosdivax
+	jsr     _putd
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosmodax
+	ldy     #$30
+	jsr     incaxy
+	jsr     _putchar
+	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(_in)
+	ldx     #>(_in)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _sort
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolult
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_in)
+	tay
+	txa
+	adc     #>(_in)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _putd
+	ldx     #$00
+	lda     #$0A
+	jsr     _putchar
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
@@ -0,0 +1,369 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memcpy
+	.export		_b1
+	.export		_b2
+	.export		_Xreaddir
+	.export		_main
+
+.segment	"DATA"
+
+_b2:
+	.byte	$20,$20,$22,$74,$65,$73,$74,$22,$20,$20,$00
+	.res	5,$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$58,$72,$65,$61,$64,$64,$69,$72,$3A,$20,$27,$25,$73,$27,$0A,$00
+S0003	:=	S0002+0
+S0005:
+	.byte	$73,$74,$61,$72,$74,$0A,$00
+S0008:
+	.byte	$64,$6F,$6E,$65,$0A,$00
+S0006:
+	.byte	$4E,$55,$4C,$4C,$0A,$00
+S0007:
+	.byte	$3D,$25,$73,$0A,$00
+
+.segment	"BSS"
+
+_b1:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; struct Xdirent *__near__ Xreaddir (struct $anon-struct-0007 *dir)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Xreaddir: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$44
+	jsr     subysp
+	ldy     #$45
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	sta     M0001+17
+	stx     M0001+17+1
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     _memcpy
+	ldy     #$45
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$47
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	jsr     incax4
+	ldy     #$01
+	jsr     staxspidx
+	ldy     #$06
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	tax
+	lda     #$00
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$FE
+	jsr     tosmulax
+	sta     M0001+19
+	stx     M0001+19+1
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     _memcpy
+	ldy     #$45
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$47
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     tosaddax
+	ldy     #$01
+	jsr     staxspidx
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (c_sp),y
+	jmp     L000A
+L0002:	lda     #$04
+	jsr     leaa0sp
+	ldy     #$01
+	clc
+	adc     (c_sp),y
+	bcc     L0005
+	inx
+L0005:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$03
+	sta     (c_sp),y
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$01
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$11
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	jmp     L000A
+L0006:	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$22
+	jsr     booleq
+	jeq     L0008
+	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L000A
+L0008:	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$62
+	jsr     booleq
+	jeq     L000A
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L000A:	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$00
+	jsr     booleq
+	jne     L0002
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	lda     #$04
+	jsr     leaa0sp
+	ldy     #$01
+	clc
+	adc     (c_sp),y
+	bcc     L000B
+	inx
+L000B:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$03
+	sta     (c_sp),y
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L000E
+L000C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$02
+	clc
+	adc     (c_sp),y
+	bcc     L000F
+	inx
+L000F:	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	lda     #$04
+	jsr     leaa0sp
+	ldy     #$01
+	clc
+	adc     (c_sp),y
+	bcc     L0010
+	inx
+L0010:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$03
+	sta     (c_sp),y
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+L000E:	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$22
+	jsr     boolne
+	jne     L000C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$02
+	clc
+	adc     (c_sp),y
+	bcc     L0011
+	inx
+L0011:	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	sta     M0001+22
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jmp     L0001
+L0001:	ldy     #$46
+	jsr     addysp
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	23,$00
+M0002:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$11
+	jsr     subysp
+	ldy     #$10
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+	ldy     #$16
+	jsr     subysp
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _Xreaddir
+	ldy     #$00
+	jsr     staxysp
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0003
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0005
+L0003:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0005:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	ldy     #$27
+	jsr     addysp
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$2E,$00
+	.res	15,$00
+
+.endproc
+
@@ -0,0 +1,1026 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_testbig
+	.export		_testbackslash
+	.export		_backslash
+	.export		_f
+	.export		_g
+	.export		_h
+	.export		_limit
+	.export		_big
+	.export		_main
+
+.segment	"RODATA"
+
+S001D:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$20,$28,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$29,$0A,$00
+S0019:
+	.byte	$25,$64,$20,$64,$65,$66,$61,$75,$6C,$74,$73,$0A,$00
+S001A:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$0A,$00
+S001C	:=	S001A+0
+S001B	:=	S001A+0
+S0002:
+	.byte	$25,$63,$20,$3D,$20,$25,$63,$0A,$00
+S0004:
+	.byte	$78,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$69,$20,$3D,$20,$25,$64,$0A,$00
+S0017	:=	S0018+0
+S0016	:=	S0018+0
+S0015	:=	S0018+0
+S000D	:=	S0018+0
+S000E	:=	S0018+0
+S000F	:=	S0018+0
+S0010	:=	S0018+0
+S0011	:=	S0018+0
+S0012	:=	S0018+0
+S0013	:=	S0018+0
+S0014	:=	S0018+0
+S0001:
+	.byte	$62,$66,$6E,$72,$74,$76,$78,$00
+S000B:
+	.byte	$36,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$35,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$64,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$33,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$31,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$32,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$66,$3A,$0A,$00
+S0005:
+	.byte	$67,$3A,$0A,$00
+S000C:
+	.byte	$68,$3A,$0A,$00
+S0023:
+	.byte	$35,$0A,$00
+S0024:
+	.byte	$30,$0A,$00
+S0025:
+	.byte	$31,$0A,$00
+S0026:
+	.byte	$32,$0A,$00
+S0027:
+	.byte	$33,$0A,$00
+S0028:
+	.byte	$34,$0A,$00
+S0029	:=	S0023+0
+S0021	:=	S0027+0
+S0020	:=	S0026+0
+S001F	:=	S0025+0
+S001E	:=	S0024+0
+S0022	:=	S0028+0
+
+; ---------------------------------------------------------------
+; int __near__ testbig (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbig: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	ldy     #$00
+	jsr     steaxysp
+L0002:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$07
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosandeax
+	jsr     tsteax
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     _big
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	ldy     #$00
+	jsr     laddeqysp
+	jmp     L0002
+L0003:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0005
+	jmp     L0003
+L0005:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     _backslash
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ backslash (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0002
+L0002:	cpx     #$00
+	jne     L0003
+	cmp     #$62
+	jeq     L0004
+	cmp     #$66
+	jeq     L0005
+	cmp     #$6E
+	jeq     L0006
+	cmp     #$72
+	jeq     L0007
+	cmp     #$74
+	jeq     L0008
+	cmp     #$76
+	jeq     L0009
+	jmp     L0003
+	jmp     L0003
+L0004:	ldx     #$00
+	lda     #$62
+	jmp     L0001
+L0005:	ldx     #$00
+	lda     #$66
+	jmp     L0001
+L0006:	ldx     #$00
+	lda     #$6E
+	jmp     L0001
+L0007:	ldx     #$00
+	lda     #$72
+	jmp     L0001
+L0008:	ldx     #$00
+	lda     #$74
+	jmp     L0001
+L0009:	ldx     #$00
+	lda     #$76
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$78
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0007
+L0007:	cpx     #$00
+	jne     L0008
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L000A
+	cmp     #$07
+	jeq     L000B
+	cmp     #$08
+	jeq     L000C
+	cmp     #$09
+	jeq     L000D
+	cmp     #$10
+	jeq     L000E
+	cmp     #$11
+	jeq     L000F
+	cmp     #$12
+	jeq     L0010
+	cmp     #$13
+	jeq     L0011
+	cmp     #$14
+	jeq     L0012
+	jmp     L0008
+	jmp     L0008
+L0009:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000B:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000C:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000D:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000E:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L000F:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L0010:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L0011:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L0012:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     incsp6
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$0B
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0007
+L0007:	cpx     #$00
+	jne     L001A
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L0009
+	cmp     #$03
+	jeq     L000B
+	cmp     #$04
+	jeq     L000B
+	cmp     #$05
+	jeq     L000B
+	cmp     #$06
+	jeq     L000E
+	cmp     #$07
+	jeq     L000E
+	cmp     #$08
+	jeq     L000E
+	jmp     L0011
+L001A:	cpx     #$03
+	jne     L001B
+	cmp     #$E9
+	jeq     L0012
+	cmp     #$EA
+	jeq     L0012
+	cmp     #$EB
+	jeq     L0012
+	cmp     #$EC
+	jeq     L0012
+	jmp     L0011
+L001B:	cpx     #$0B
+	jne     L0011
+	cmp     #$B9
+	jeq     L0016
+	cmp     #$BA
+	jeq     L0016
+	cmp     #$BB
+	jeq     L0016
+	cmp     #$BC
+	jeq     L0016
+	jmp     L0011
+	jmp     L0011
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000B:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000E:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0011:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0012:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0016:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ h (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_h: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$F5
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0007
+L0007:	cpx     #$00
+	jne     L0016
+	cmp     #$08
+	jeq     L000C
+	cmp     #$10
+	jeq     L000B
+	cmp     #$78
+	jeq     L000D
+	cmp     #$80
+	jeq     L000A
+	cmp     #$F8
+	jeq     L0010
+	jmp     L0009
+L0016:	cpx     #$01
+	jne     L0009
+	cmp     #$08
+	jeq     L000F
+	cmp     #$10
+	jeq     L0011
+	cmp     #$18
+	jeq     L000E
+	cmp     #$20
+	jeq     L0014
+	cmp     #$28
+	jeq     L0013
+	cmp     #$30
+	jeq     L0012
+	cmp     #$38
+	jeq     L0015
+	jmp     L0009
+	jmp     L0009
+L0009:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0004
+L000A:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000B:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000C:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000D:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000E:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L000F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0010:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0012:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0013:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0014:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0015:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0004
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ limit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_limit: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$80
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$06
+	txa
+	sbc     #$80
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0007
+L0007:	cpx     #$80
+	jne     L000E
+	cmp     #$00
+	jeq     L0009
+	cmp     #$01
+	jeq     L000A
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000C
+	cmp     #$04
+	jeq     L000D
+	jmp     L000E
+	jmp     L000E
+L0009:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L000A:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L000B:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L000C:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L000D:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L000E:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	ldx     #$7F
+	lda     #$FF
+	ldy     #$00
+	jsr     staxysp
+L000F:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$FA
+	txa
+	sbc     #$7F
+	bvs     L0013
+	eor     #$80
+L0013:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0012
+	jmp     L0010
+L0012:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0014
+L0014:	cpx     #$7F
+	jne     L001B
+	cmp     #$FB
+	jeq     L001A
+	cmp     #$FC
+	jeq     L0019
+	cmp     #$FD
+	jeq     L0018
+	cmp     #$FE
+	jeq     L0017
+	cmp     #$FF
+	jeq     L0016
+	jmp     L001B
+	jmp     L001B
+L0016:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L0017:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L0018:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L0019:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L001A:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L001B:	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L0011:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	jmp     L000F
+L0010:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ big (unsigned long x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_big: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$06
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosandeax
+	jmp     L0002
+L0002:	ldy     sreg+1
+	cpy     #$00
+	jne     L000A
+	ldy     sreg
+	cpy     #$00
+	jne     L0009
+	cpx     #$00
+	jne     L0009
+	cmp     #$00
+	jeq     L0004
+	jmp     L0009
+	jmp     L0009
+	jmp     L0009
+L000A:	cpy     #$02
+	jne     L000B
+	ldy     sreg
+	cpy     #$00
+	jne     L0009
+	cpx     #$00
+	jne     L0009
+	cmp     #$00
+	jeq     L0007
+	jmp     L0009
+	jmp     L0009
+	jmp     L0009
+L000B:	cpy     #$04
+	jne     L000C
+	ldy     sreg
+	cpy     #$00
+	jne     L0009
+	cpx     #$00
+	jne     L0009
+	cmp     #$00
+	jeq     L0008
+	jmp     L0009
+	jmp     L0009
+	jmp     L0009
+L000C:	cpy     #$FF
+	jne     L0009
+	ldy     sreg
+	cpy     #$FF
+	jne     L0009
+	cpx     #$FF
+	jne     L0009
+	cmp     #$FE
+	jeq     L0004
+	cmp     #$FF
+	jeq     L0004
+	jmp     L0009
+	jmp     L0009
+	jmp     L0009
+	jmp     L0009
+L0004:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+L0007:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+L0008:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+L0009:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+L0003:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	jsr     _f
+	jsr     _g
+	jsr     _h
+	jsr     _testbig
+	jsr     _limit
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
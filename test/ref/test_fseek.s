@@ -0,0 +1,304 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdout
+	.import		_fclose
+	.import		_fopen
+	.import		_fread
+	.import		_fwrite
+	.import		_fseek
+	.import		_printf
+	.import		_memcmp
+	.export		_in
+	.export		_bufA
+	.export		_bufB
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$2D,$72,$65,$61,$64,$20,$61,$66,$74,$65,$72,$20,$53
+	.byte	$45,$45,$4B,$5F,$53,$45,$54,$2E,$0A,$00
+S0006:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$2D,$72,$65,$61,$64,$20,$61,$66,$74,$65,$72,$20,$53
+	.byte	$45,$45,$4B,$5F,$43,$55,$52,$2E,$0A,$00
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$61,$64,$2E,$0A,$00
+S0005:
+	.byte	$72,$65,$61,$64,$73,$20,$64,$69,$66,$66,$65,$72,$2E,$0A,$00
+S0007	:=	S0005+0
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0002:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_bufA:
+	.res	32,$00
+_bufB:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	lda     #<(_bufA)
+	ldx     #>(_bufA)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	lda     M0001
+	ldx     M0001+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     booleq
+	jeq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0004:	lda     #<(_bufA)
+	ldx     #>(_bufA)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	lda     _in
+	ldx     _in+1
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldx     #$00
+	lda     #$02
+	jsr     _fseek
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	lda     M0001
+	ldx     M0001+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     booleq
+	jeq     L0006
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0006:	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	lda     #<(_bufA)
+	ldx     #>(_bufA)
+	jsr     pushax
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     _memcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0008
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0008:	lda     _in
+	ldx     _in+1
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldx     #$00
+	lda     #$02
+	jsr     _fseek
+	lda     _in
+	ldx     _in+1
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     pusheax
+	ldx     #$00
+	lda     #$00
+	jsr     _fseek
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	lda     M0001
+	ldx     M0001+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0009:	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	lda     #<(_bufA+1)
+	ldx     #>(_bufA+1)
+	jsr     pushax
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$1F
+	jsr     _memcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L000B
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L000B:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp4
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,3354 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0000
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0001:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0009:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0003:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S0011:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0006:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S000A:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S0010:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S000F:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S000E:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S000D:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S000B	:=	S000C+6
+S0007:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S0012	:=	S0007+0
+S0005:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     _yymorfg
+	ldx     _yymorfg+1
+	jsr     bnegax
+	jeq     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _yymorfg
+	stx     _yymorfg+1
+	lda     _yyleng
+	ldx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	tay
+	txa
+	adc     #>(_yytext)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxysp
+L0003:	jmp     L0007
+L0006:	jmp     L0003
+L0007:	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	ldy     #$0A
+	jsr     staxysp
+	lda     _yybgin
+	ldx     _yybgin+1
+	ldy     #$0C
+	jsr     staxysp
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$0A
+L0009:	jsr     booleq
+	jeq     L0008
+	ldy     #$0C
+	ldx     #$00
+	lda     #$06
+	jsr     addeqysp
+L0008:	ldx     #$00
+	lda     #$00
+	sta     _testbreak
+L000A:	jmp     L000D
+L000C:	jmp     L000A
+L000D:	ldx     #$00
+	lda     _testbreak
+	cmp     #$05
+	jsr     booleq
+	jeq     L000E
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	ldx     #$00
+	lda     _testbreak
+	inc     _testbreak
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     toseqax
+	jeq     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+L0011:	jsr     booleq
+	jeq     L0010
+	jmp     L000B
+L0010:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     toseqax
+	jeq     L0012
+	jmp     L000B
+L0012:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jeq     L0013
+	ldx     _yysptr
+	bne     L0014
+	dec     _yysptr+1
+L0014:	dex
+	stx     _yysptr
+	txa
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0015
+L0013:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0015:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0016
+	cmp     #$0A
+L0016:	jsr     booleq
+	jeq     L0017
+	inc     _yylineno
+	bne     L0018
+	inc     _yylineno+1
+L0018:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0019
+L0017:	lda     _yytchar
+	ldx     _yytchar+1
+L0019:	cpx     #$FF
+	bne     L001A
+	cmp     #$FF
+L001A:	jsr     booleq
+	jeq     L001B
+	ldx     #$00
+	lda     #$00
+	jmp     L001C
+L001B:	lda     _yytchar
+	ldx     _yytchar+1
+L001C:	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+L001D:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosugtax
+	jeq     L001E
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L0020
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L0021
+L0020:	ldx     #$00
+	lda     #$00
+	jeq     L0022
+L0021:	ldx     #$00
+	lda     #$01
+L0022:	jeq     L001F
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L0023
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0025
+	cmp     #$0A
+L0025:	jsr     booleq
+	jeq     L0024
+	lda     _yylineno
+	bne     L0026
+	dec     _yylineno+1
+L0026:	dec     _yylineno
+L0024:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0027
+	inc     _yysptr+1
+L0027:	jmp     L000B
+L0023:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	pha
+	lda     M0002
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0002+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+L001F:	jmp     L0034
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosultax
+	jeq     L0034
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     aslax1
+	clc
+	adc     #<(_yycrank)
+	tay
+	txa
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L002C
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L002D
+L002C:	ldx     #$00
+	lda     #$00
+	jeq     L002E
+L002D:	ldx     #$00
+	lda     #$01
+L002E:	jeq     L002B
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L002F
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0031
+	cmp     #$0A
+L0031:	jsr     booleq
+	jeq     L0030
+	lda     _yylineno
+	bne     L0032
+	dec     _yylineno+1
+L0032:	dec     _yylineno
+L0030:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0033
+	inc     _yysptr+1
+L0033:	jmp     L000B
+L002F:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	pha
+	lda     M0003
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0003+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+L002B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	adc     #<(_yymatch)
+	tay
+	txa
+	adc     #>(_yymatch)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L0035
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L0036
+L0035:	ldx     #$00
+	lda     #$00
+	jeq     L0037
+L0036:	ldx     #$00
+	lda     #$01
+L0037:	jeq     L0034
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L0038
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L003A
+	cmp     #$0A
+L003A:	jsr     booleq
+	jeq     L0039
+	lda     _yylineno
+	bne     L003B
+	dec     _yylineno+1
+L003B:	dec     _yylineno
+L0039:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L003C
+	inc     _yysptr+1
+L003C:	jmp     L000B
+L0038:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	pha
+	lda     M0004
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0004+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+L0034:	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$0C
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	jeq     L003E
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosneax
+	jne     L003F
+L003E:	ldx     #$00
+	lda     #$00
+	jeq     L0040
+L003F:	ldx     #$00
+	lda     #$01
+L0040:	jeq     L003D
+	jmp     L001D
+	jmp     L0041
+L003D:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0043
+	cmp     #$0A
+L0043:	jsr     booleq
+	jeq     L0042
+	lda     _yylineno
+	bne     L0044
+	dec     _yylineno+1
+L0044:	dec     _yylineno
+L0042:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0045
+	inc     _yysptr+1
+L0045:	jmp     L000B
+L0041:	jmp     L000C
+L000B:	jmp     L005F
+L0046:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L004A
+	cmp     #$00
+L004A:	jsr     boolne
+	jeq     L004B
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$05
+	jsr     ldaxidx
+	sta     _yyfnd
+	stx     _yyfnd+1
+	stx     tmp1
+	ora     tmp1
+	jeq     L004B
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L004C
+	eor     #$80
+L004C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L004D
+L004B:	ldx     #$00
+	lda     #$00
+	jeq     L004E
+L004D:	ldx     #$00
+	lda     #$01
+L004E:	jeq     L0049
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yyolsp
+	stx     _yyolsp+1
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	clc
+	adc     #<(_yyextra)
+	tay
+	txa
+	adc     #>(_yyextra)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jeq     L0051
+	jmp     L005A
+L0050:	ldx     #$00
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0058
+	cmp     #$0A
+L0058:	jsr     booleq
+	jeq     L0057
+	lda     _yylineno
+	bne     L0059
+	dec     _yylineno+1
+L0059:	dec     _yylineno
+L0057:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L005A
+	inc     _yysptr+1
+L005A:	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L0053
+	cmp     #$01
+L0053:	jsr     boolne
+	jeq     L0054
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	jsr     tosugtax
+	jne     L0055
+L0054:	ldx     #$00
+	lda     #$00
+	jeq     L0056
+L0055:	ldx     #$00
+	lda     #$01
+L0056:	jne     L0050
+L0051:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yyprevious
+	stx     _yyprevious+1
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yylsp
+	stx     _yylsp+1
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     tossubax
+	jsr     incax1
+	sta     _yyleng
+	stx     _yyleng+1
+	lda     _yyleng
+	ldx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	tay
+	txa
+	adc     #>(_yytext)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L005B
+	inc     _yyfnd+1
+L005B:	lda     regsave
+	ldx     regsave+1
+	jmp     L0005
+L0049:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L005D
+	cmp     #$0A
+L005D:	jsr     booleq
+	jeq     L005C
+	lda     _yylineno
+	bne     L005E
+	dec     _yylineno+1
+L005E:	dec     _yylineno
+L005C:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L005F
+	inc     _yysptr+1
+L005F:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	jsr     tosugtax
+	php
+	ldx     #$00
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	plp
+	jne     L0046
+	ldx     #$00
+	lda     _yytext
+	cmp     #$00
+	jsr     booleq
+	jeq     L0060
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	sta     _yysptr
+	stx     _yysptr+1
+	ldx     #$00
+	lda     #$00
+	jmp     L0005
+L0060:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	jeq     L0061
+	ldx     _yysptr
+	bne     L0062
+	dec     _yysptr+1
+L0062:	dex
+	stx     _yysptr
+	txa
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0063
+L0061:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0063:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0064
+	cmp     #$0A
+L0064:	jsr     booleq
+	jeq     L0065
+	inc     _yylineno
+	bne     L0066
+	inc     _yylineno+1
+L0066:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0067
+L0065:	lda     _yytchar
+	ldx     _yytchar+1
+L0067:	cpx     #$FF
+	bne     L0068
+	cmp     #$FF
+L0068:	jsr     booleq
+	jeq     L0069
+	ldx     #$00
+	lda     #$00
+	jmp     L006A
+L0069:	lda     _yytchar
+	ldx     _yytchar+1
+L006A:	ldx     #$00
+	sta     _yytext
+	sta     _yyprevious
+	stx     _yyprevious+1
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L006C
+	eor     #$80
+L006C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L006B
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L006B:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0006
+L0005:	ldy     #$0E
+	jsr     addysp
+	rts
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$74
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	ldx     #$00
+	lda     #$00
+	sta     _yynerrs
+	stx     _yynerrs+1
+	ldx     #$00
+	lda     #$00
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	lda     #$0E
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$06
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tosugtax
+	jeq     L0003
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _yyerror
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0003:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yyval
+	ldx     _yyval+1
+	ldy     #$00
+	jsr     staxspidx
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	pha
+	lda     M0003
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0003+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000E
+L0005:	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	ldx     #$00
+	lda     #$00
+	sta     _yychar
+	stx     _yychar+1
+L0009:	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000B
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000B
+	ldx     #$00
+	lda     #$00
+	jeq     L000D
+L000B:	ldx     #$00
+	lda     #$01
+L000D:	jeq     L000A
+	pha
+	lda     M0004
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0004+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000E
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     toseqax
+	jeq     L000E
+	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	lda     _yylval
+	ldx     _yylval+1
+	sta     _yyval
+	stx     _yyval+1
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	jsr     staxysp
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	ldx     _yyerrflag
+	bne     L0011
+	dec     _yyerrflag+1
+L0011:	dex
+	stx     _yyerrflag
+	txa
+	ldx     _yyerrflag+1
+L000F:	jmp     L0002
+L000E:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yydef)
+	tay
+	txa
+	adc     #>(_yydef)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L0013
+	cmp     #$FE
+L0013:	jsr     booleq
+	jeq     L0021
+	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0015
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0015
+	ldx     #$00
+	lda     #$00
+	sta     _yychar
+	stx     _yychar+1
+L0015:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	ldy     #$00
+	jsr     staxysp
+L0016:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$FF
+	bne     L001A
+	cmp     #$FF
+L001A:	jsr     boolne
+	jne     L001B
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L001B
+	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001B:	ldx     #$00
+	lda     #$01
+L001C:	jne     L0018
+	jmp     L0017
+L0018:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	jmp     L0016
+L0017:	jmp     L0020
+L001D:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     toseqax
+	jeq     L0020
+	jmp     L001E
+L0020:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	txa
+	jsr     boolge
+	jne     L001D
+L001E:	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0021
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0021:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0023
+	cmp     #$00
+L0023:	jsr     booleq
+	jeq     L0025
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	jmp     L0024
+L0024:	cpx     #$00
+	jne     L0025
+	cmp     #$00
+	jeq     L0026
+	cmp     #$01
+	jeq     L0029
+	cmp     #$02
+	jeq     L0029
+	cmp     #$03
+	jeq     L0035
+	jmp     L0025
+	jmp     L0025
+L0026:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L0028
+	inc     _yynerrs+1
+L0028:	lda     _yynerrs
+	ldx     _yynerrs+1
+L0029:	ldx     #$00
+	lda     #$03
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	jmp     L002D
+L002B:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	txa
+	jsr     boolge
+	jeq     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0030
+	eor     #$80
+L0030:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$01
+	bne     L0031
+	cmp     #$00
+L0031:	jsr     booleq
+	jne     L0032
+L002F:	ldx     #$00
+	lda     #$00
+	jeq     L0033
+L0032:	ldx     #$00
+	lda     #$01
+L0033:	jeq     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	jmp     L0002
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+L002D:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     tosugeax
+	jne     L002B
+L002C:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0035:	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$00
+	bne     L0037
+	cmp     #$00
+L0037:	jsr     booleq
+	jeq     L0036
+	jmp     L002C
+L0036:	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	jmp     L0004
+L0025:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	sta     _yyval
+	stx     _yyval+1
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr1)
+	tay
+	txa
+	adc     #>(_yyr1)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	jsr     incax1
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L0039
+	eor     #$80
+L0039:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L003A
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosneax
+	jne     L003A
+	ldx     #$00
+	lda     #$00
+	jeq     L003B
+L003A:	ldx     #$00
+	lda     #$01
+L003B:	jeq     L0038
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+L0038:	ldy     #$0D
+	jsr     ldaxysp
+	jmp     L003C
+L003C:	cpx     #$00
+	jne     L003D
+	cmp     #$04
+	jeq     L003E
+	cmp     #$05
+	jeq     L003F
+	cmp     #$06
+	jeq     L0040
+	cmp     #$07
+	jeq     L0041
+	cmp     #$08
+	jeq     L0042
+	cmp     #$09
+	jeq     L0043
+	cmp     #$0A
+	jeq     L0044
+	cmp     #$0C
+	jeq     L0045
+	cmp     #$0D
+	jeq     L0046
+	cmp     #$0E
+	jeq     L0047
+	jmp     L003D
+	jmp     L003D
+L003E:	ldx     #$00
+	lda     #$00
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	jmp     L003D
+L003F:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0040:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0041:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0042:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0043:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0044:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0045:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L003D
+L0046:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L003D
+L0047:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L003D
+L003D:	jmp     L0002
+L0001:	ldy     #$74
+	jsr     addysp
+	rts
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$0A
+L0003:	jsr     booleq
+	jeq     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	jeq     L0002
+	ldx     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dex
+	stx     _yysptr
+	txa
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$0A
+L0005:	jsr     booleq
+	jeq     L0006
+	inc     _yylineno
+	bne     L0007
+	inc     _yylineno+1
+L0007:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0008
+L0006:	lda     _yytchar
+	ldx     _yytchar+1
+L0008:	cpx     #$FF
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     booleq
+	jeq     L000A
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+L000B:	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0002:	jmp     L0007
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     toseqax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	plp
+	jeq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0007:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jne     L0004
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp4
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jmp     L0007
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0006
+L0006:	cpx     #$00
+	jne     L0010
+	cmp     #$00
+	jeq     L0008
+	cmp     #$01
+	jeq     L000A
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000C
+	cmp     #$04
+	jeq     L000D
+	jmp     L000F
+L0010:	cpx     #$FF
+	jne     L000F
+	cmp     #$FF
+	jeq     L000E
+	jmp     L000F
+	jmp     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	jeq     L0009
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0009:	jmp     L0007
+L000A:	ldx     #$01
+	lda     #$01
+	jmp     L0001
+	jmp     L0007
+L000B:	ldx     #$01
+	lda     #$02
+	jmp     L0001
+	jmp     L0007
+L000C:	jmp     L0007
+L000D:	ldx     #$00
+	lda     _yytext
+	jmp     L0001
+	jmp     L0007
+L000E:	jmp     L0007
+L000F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L0007
+L0007:	jsr     _yylook
+	ldy     #$00
+	jsr     staxysp
+	txa
+	jsr     boolge
+	jne     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	lda     _infile
+	ldx     _infile+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,710 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_yycrank
+	.export		_yytop
+	.export		_yyvstop
+	.export		_yysvec
+	.export		_subtest2
+	.export		_subtest3
+	.export		_yyr2
+	.export		_subtest4
+	.export		_yylookret
+	.export		_yylook
+	.export		_subtest5
+	.export		_main
+
+.segment	"DATA"
+
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yytop:
+	.addr	_yycrank+510
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_bog:
+	.word	$04D2
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yylookret:
+	.word	$000A
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$49,$46,$20,$4E,$4F,$54,$20,$4F,$4B,$20,$25,$44,$20,$25,$44,$0D
+	.byte	$00
+S0002:
+	.byte	$49,$46,$20,$4F,$4B,$20,$25,$44,$20,$25,$44,$0D,$00
+S0004:
+	.byte	$59,$59,$50,$53,$3A,$20,$25,$30,$34,$58,$0D,$00
+S0005:
+	.byte	$4E,$53,$54,$52,$3A,$20,$25,$30,$34,$58,$0D,$00
+S0001:
+	.byte	$59,$59,$54,$3A,$20,$25,$44,$20,$25,$44,$0D,$00
+
+; ---------------------------------------------------------------
+; void __near__ subtest2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest2: near
+
+.segment	"CODE"
+
+	lda     #>(_yycrank)
+	sta     M0001+1
+	lda     #<(_yycrank)
+	sta     M0001
+	ldx     #$00
+	lda     #$0A
+	sta     M0002
+	stx     M0002+1
+	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	lda     M0002
+	ldx     M0002+1
+	jsr     aslax1
+	clc
+	adc     M0001
+	sta     M0001
+	txa
+	adc     M0001+1
+	sta     M0001+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     M0001+1
+	sta     ptr1+1
+	lda     M0001
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	lda     M0001+1
+	sta     ptr1+1
+	lda     M0001
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jmp     _printf
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest3: near
+
+.segment	"CODE"
+
+	lda     #>(_yycrank)
+	sta     M0001+1
+	lda     #<(_yycrank)
+	sta     M0001
+	lda     #>(_yysvec)
+	sta     M0002+1
+	lda     #<(_yysvec)
+	sta     M0002
+	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	lda     M0001
+	sec
+	sbc     _yytop
+	sta     tmp1
+	lda     M0001+1
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0009
+	bcs     L0002
+L0009:	lda     M0001+1
+	sta     ptr1+1
+	lda     M0001
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     M0002+1
+	bne     L0002
+	cmp     M0002
+	bne     L0002
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     L001B
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+L001B:	jsr     pushax
+	lda     M0001+1
+	sta     ptr1+1
+	lda     M0001
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	lda     M0001+1
+	sta     ptr1+1
+	lda     M0001
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jmp     _printf
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest4: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$04
+	sta     M0001
+	stx     M0001+1
+	lda     #$00
+	sta     M0002
+	sta     M0002+1
+	jmp     L0006
+L0002:	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	lda     M0002
+	ldx     M0002+1
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	eor     #$FF
+	sec
+	adc     M0001
+	sta     M0001
+	txa
+	eor     #$FF
+	adc     M0001+1
+	sta     M0001+1
+	inc     M0002
+	bne     L0006
+	inc     M0002+1
+L0006:	lda     M0002
+	cmp     #$0E
+	lda     M0002+1
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	bmi     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	ldy     #$04
+	jmp     _printf
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	lda     _yylookret
+	bne     L0002
+	dec     _yylookret+1
+L0002:	dec     _yylookret
+	lda     _yylookret
+	ldx     _yylookret+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest5: near
+
+.segment	"CODE"
+
+	jmp     L000C
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L000C:	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	jsr     _yylook
+	sta     M0001
+	stx     M0001+1
+	txa
+	bpl     L0002
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _subtest2
+	jsr     _subtest3
+	jsr     _subtest4
+	jsr     _subtest5
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
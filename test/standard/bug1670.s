@@ -0,0 +1,121 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_localtime
+	.import		_strftime
+	.export		_clock_gettime
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$54,$68,$65,$20,$74,$69,$6D,$65,$20,$69,$73,$20,$25,$73,$0A,$00
+S0001:
+	.byte	$25,$32,$64,$3A,$25,$32,$64,$3A,$25,$32,$64,$0A,$00
+S0002:
+	.byte	$3C,$25,$48,$3A,$25,$4D,$3A,$25,$53,$3E,$00
+
+; ---------------------------------------------------------------
+; const char *__near__ clock_gettime (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_gettime: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	lda     c_sp
+	ldx     c_sp+1
+	jsr     _localtime
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _strftime
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jmp     L0001
+L0001:	jsr     incsp6
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	32,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	jsr     _clock_gettime
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
@@ -0,0 +1,1351 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S006D:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$61,$78,$69,$6D,$75,$6D,$20,$28,$25,$6C,$75,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$75,$29,$0A,$00
+S006A	:=	S006D+0
+S0004:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$61,$78,$69,$6D,$75,$6D,$20,$28,$25,$6C,$64,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$64,$29,$0A,$00
+S0067	:=	S0004+0
+S0064:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$69,$6E,$69,$6D,$75,$6D,$20,$28,$25,$6C,$64,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$64,$29,$0A,$00
+S0007	:=	S0064+0
+S0061	:=	S006D+0
+S005E	:=	S0004+0
+S000A	:=	S0004+0
+S005B	:=	S0064+0
+S0058	:=	S006D+0
+S000D	:=	S0064+0
+S0055	:=	S0004+0
+S0052	:=	S0064+0
+S0010	:=	S0004+0
+S004F	:=	S006D+0
+S004C	:=	S006D+0
+S0013	:=	S006D+0
+S0049	:=	S006D+0
+S0046	:=	S0004+0
+S0016	:=	S006D+0
+S0043	:=	S0064+0
+S0040	:=	S0004+0
+S0019	:=	S006D+0
+S003D	:=	S0064+0
+S003A	:=	S0004+0
+S001C	:=	S0064+0
+S0037	:=	S0064+0
+S0034	:=	S006D+0
+S001F	:=	S0004+0
+S0031	:=	S006D+0
+S002E	:=	S006D+0
+S0022	:=	S0064+0
+S002B	:=	S0004+0
+S0028	:=	S0064+0
+S0025	:=	S0004+0
+S0001	:=	S0064+0
+S0036:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$33,$32,$5F,$4D,$41,$58
+	.byte	$00
+S0033:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$31,$36,$5F,$4D,$41,$58
+	.byte	$00
+S0051:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$33,$32,$5F,$4D,$41,$58,$00
+S002A:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S0027	:=	S0033+1
+S0024:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S002D	:=	S0036+1
+S0030:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$38,$5F,$4D,$41,$58,$00
+S004E:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$31,$36,$5F,$4D,$41,$58,$00
+S0021	:=	S0030+1
+S006C:
+	.byte	$53,$49,$47,$5F,$41,$54,$4F,$4D,$49,$43,$5F,$4D,$41,$58,$00
+S0032:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$31,$36,$5F,$74,$00
+S0048	:=	S0051+1
+S001E:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$38,$5F,$4D,$49,$4E,$00
+S0035:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$33,$32,$5F,$74,$00
+S003F:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S0045:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S004B:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$38,$5F,$4D,$41,$58,$00
+S0042	:=	S004E+1
+S0050:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$33,$32,$5F,$74,$00
+S004D:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$31,$36,$5F,$74,$00
+S003C	:=	S004B+1
+S002F:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$38,$5F,$74,$00
+S002C	:=	S0035+1
+S0023	:=	S0032+1
+S0029	:=	S0035+1
+S0039:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$38,$5F,$4D,$49,$4E,$00
+S0026	:=	S0032+1
+S0020	:=	S002F+1
+S0044	:=	S0050+1
+S006B:
+	.byte	$73,$69,$67,$5F,$61,$74,$6F,$6D,$69,$63,$5F,$74,$00
+S001D	:=	S002F+1
+S0047	:=	S0050+1
+S003E	:=	S004D+1
+S004A:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$38,$5F,$74,$00
+S0041	:=	S004D+1
+S0063:
+	.byte	$55,$49,$4E,$54,$4D,$41,$58,$5F,$4D,$41,$58,$00
+S0069:
+	.byte	$50,$54,$52,$44,$49,$46,$46,$5F,$4D,$41,$58,$00
+S003B	:=	S004A+1
+S005A:
+	.byte	$55,$49,$4E,$54,$50,$54,$52,$5F,$4D,$41,$58,$00
+S0038	:=	S004A+1
+S0066:
+	.byte	$50,$54,$52,$44,$49,$46,$46,$5F,$4D,$49,$4E,$00
+S0060	:=	S0063+1
+S005D:
+	.byte	$49,$4E,$54,$4D,$41,$58,$5F,$4D,$49,$4E,$00
+S001B:
+	.byte	$55,$49,$4E,$54,$33,$32,$5F,$4D,$41,$58,$00
+S0054:
+	.byte	$49,$4E,$54,$50,$54,$52,$5F,$4D,$49,$4E,$00
+S0057	:=	S005A+1
+S0018:
+	.byte	$55,$49,$4E,$54,$31,$36,$5F,$4D,$41,$58,$00
+S0062:
+	.byte	$75,$69,$6E,$74,$6D,$61,$78,$5F,$74,$00
+S000C	:=	S0018+1
+S0059:
+	.byte	$75,$69,$6E,$74,$70,$74,$72,$5F,$74,$00
+S0068:
+	.byte	$70,$74,$72,$64,$69,$66,$66,$5F,$74,$00
+S0012	:=	S001B+1
+S0015:
+	.byte	$55,$49,$4E,$54,$38,$5F,$4D,$41,$58,$00
+S000F:
+	.byte	$49,$4E,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S0009:
+	.byte	$49,$4E,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S0065	:=	S0068+0
+S005C	:=	S0062+1
+S0053	:=	S0059+1
+S0003:
+	.byte	$49,$4E,$54,$38,$5F,$4D,$49,$4E,$00
+S001A:
+	.byte	$75,$69,$6E,$74,$33,$32,$5F,$74,$00
+S0006	:=	S0015+1
+S005F	:=	S0062+1
+S0056	:=	S0059+1
+S006F:
+	.byte	$53,$49,$5A,$45,$5F,$4D,$41,$58,$00
+S0017:
+	.byte	$75,$69,$6E,$74,$31,$36,$5F,$74,$00
+S000B	:=	S0017+1
+S000E	:=	S001A+1
+S0011	:=	S001A+1
+S0008	:=	S0017+1
+S0014:
+	.byte	$75,$69,$6E,$74,$38,$5F,$74,$00
+S006E:
+	.byte	$73,$69,$7A,$65,$5F,$74,$00
+S0005	:=	S0014+1
+S0002	:=	S0014+1
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jmp     L0002
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0002:	jmp     L0004
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+L0005:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0004:	jmp     L0006
+	inc     _failures
+	bne     L0007
+	inc     _failures+1
+L0007:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0006:	jmp     L0008
+	inc     _failures
+	bne     L0009
+	inc     _failures+1
+L0009:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0008:	jmp     L000A
+	inc     _failures
+	bne     L000B
+	inc     _failures+1
+L000B:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L000A:	jmp     L000C
+	inc     _failures
+	bne     L000D
+	inc     _failures+1
+L000D:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L000C:	jmp     L000E
+	inc     _failures
+	bne     L000F
+	inc     _failures+1
+L000F:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L000E:	jmp     L0010
+	inc     _failures
+	bne     L0011
+	inc     _failures+1
+L0011:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0010:	jmp     L0012
+	inc     _failures
+	bne     L0013
+	inc     _failures+1
+L0013:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0012:	jmp     L0014
+	inc     _failures
+	bne     L0015
+	inc     _failures+1
+L0015:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0014:	jmp     L0016
+	inc     _failures
+	bne     L0017
+	inc     _failures+1
+L0017:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0016:	jmp     L0018
+	inc     _failures
+	bne     L0019
+	inc     _failures+1
+L0019:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0018:	jmp     L001A
+	inc     _failures
+	bne     L001B
+	inc     _failures+1
+L001B:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L001A:	jmp     L001C
+	inc     _failures
+	bne     L001D
+	inc     _failures+1
+L001D:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L001C:	jmp     L001E
+	inc     _failures
+	bne     L001F
+	inc     _failures+1
+L001F:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L001E:	jmp     L0020
+	inc     _failures
+	bne     L0021
+	inc     _failures+1
+L0021:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0020:	jmp     L0022
+	inc     _failures
+	bne     L0023
+	inc     _failures+1
+L0023:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0022:	jmp     L0024
+	inc     _failures
+	bne     L0025
+	inc     _failures+1
+L0025:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0024:	jmp     L0026
+	inc     _failures
+	bne     L0027
+	inc     _failures+1
+L0027:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$80
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0026:	jmp     L0028
+	inc     _failures
+	bne     L0029
+	inc     _failures+1
+L0029:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0028:	jmp     L002A
+	inc     _failures
+	bne     L002B
+	inc     _failures+1
+L002B:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L002A:	jmp     L002C
+	inc     _failures
+	bne     L002D
+	inc     _failures+1
+L002D:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L002C:	jmp     L002E
+	inc     _failures
+	bne     L002F
+	inc     _failures+1
+L002F:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L002E:	jmp     L0030
+	inc     _failures
+	bne     L0031
+	inc     _failures+1
+L0031:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0030:	jmp     L0032
+	inc     _failures
+	bne     L0033
+	inc     _failures+1
+L0033:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0032:	jmp     L0034
+	inc     _failures
+	bne     L0035
+	inc     _failures+1
+L0035:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0034:	jmp     L0036
+	inc     _failures
+	bne     L0037
+	inc     _failures+1
+L0037:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0036:	jmp     L0038
+	inc     _failures
+	bne     L0039
+	inc     _failures+1
+L0039:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0038:	jmp     L003A
+	inc     _failures
+	bne     L003B
+	inc     _failures+1
+L003B:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L003A:	jmp     L003C
+	inc     _failures
+	bne     L003D
+	inc     _failures+1
+L003D:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L003C:	jmp     L003E
+	inc     _failures
+	bne     L003F
+	inc     _failures+1
+L003F:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L003E:	jmp     L0040
+	inc     _failures
+	bne     L0041
+	inc     _failures+1
+L0041:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0040:	jmp     L0042
+	inc     _failures
+	bne     L0043
+	inc     _failures+1
+L0043:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0042:	jmp     L0044
+	inc     _failures
+	bne     L0045
+	inc     _failures+1
+L0045:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	lda     #<(S0065)
+	ldx     #>(S0065)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	lda     #<(S0066)
+	ldx     #>(S0066)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	ldx     #$80
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0044:	jmp     L0046
+	inc     _failures
+	bne     L0047
+	inc     _failures+1
+L0047:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S0067)
+	ldx     #>(S0067)
+	jsr     pushax
+	lda     #<(S0068)
+	ldx     #>(S0068)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	lda     #<(S0069)
+	ldx     #>(S0069)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$7F
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0046:	jmp     L0048
+	inc     _failures
+	bne     L0049
+	inc     _failures+1
+L0049:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S006A)
+	ldx     #>(S006A)
+	jsr     pushax
+	lda     #<(S006B)
+	ldx     #>(S006B)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	lda     #<(S006C)
+	ldx     #>(S006C)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L0048:	jmp     L004A
+	inc     _failures
+	bne     L004B
+	inc     _failures+1
+L004B:	lda     _failures
+	ldx     _failures+1
+	lda     #<(S006D)
+	ldx     #>(S006D)
+	jsr     pushax
+	lda     #<(S006E)
+	ldx     #>(S006E)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	lda     #<(S006F)
+	ldx     #>(S006F)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     pusheax
+	ldy     #$0E
+	jsr     _printf
+L004A:	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+L0001:	rts
+
+.endproc
+
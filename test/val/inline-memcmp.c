@@ -0,0 +1,75 @@
+/* Test of the inline expansion of memcmp() */
+
+#include <stdio.h>
+#include <string.h>
+
+#pragma inline-stdfuncs (on)
+
+static unsigned char failures = 0;
+
+static unsigned char a[256];
+static unsigned char b[256];
+
+static int sign (int v)
+{
+    return v < 0 ? -1 : (v > 0 ? 1 : 0);
+}
+
+static void check (const char* Name, int Got, int Expected)
+{
+    if (sign (Got) != Expected) {
+        printf ("%s: got %d, expected sign %d\n", Name, Got, Expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    register unsigned char* p = a;
+    register unsigned char* q = b;
+    unsigned i;
+
+    for (i = 0; i < 256; ++i) {
+        a[i] = b[i] = (unsigned char) i;
+    }
+
+    /* Constant addresses */
+    check ("equal 1", memcmp (a, b, 1), 0);
+    check ("equal 10", memcmp (a, b, 10), 0);
+    check ("equal 200", memcmp (a, b, 200), 0);
+    check ("equal 256", memcmp (a, b, 256), 0);
+    check ("offset", memcmp (a + 5, b + 5, 20), 0);
+    check ("offset less", memcmp (a + 4, b + 5, 20), -1);
+    check ("offset greater", memcmp (a + 5, b + 4, 20), 1);
+
+    /* Differences at the end of the range and outside of it */
+    a[9] = 200;
+    check ("greater", memcmp (a, b, 10), 1);
+    check ("less", memcmp (b, a, 10), -1);
+    check ("outside", memcmp (a, b, 9), 0);
+    a[9] = 9;
+
+    /* Unsigned comparison */
+    a[255] = 0x80;
+    b[255] = 0x7F;
+    check ("unsigned 256", memcmp (a, b, 256), 1);
+    check ("unsigned rev 256", memcmp (b, a, 256), -1);
+    a[255] = b[255] = 255;
+
+    /* Zero page pointers */
+    check ("reg equal", memcmp (p, q, 100), 0);
+    b[50] = 0;
+    check ("reg greater", memcmp (p, q, 100), 1);
+    check ("reg less", memcmp (q, p, 100), -1);
+    check ("reg mixed", memcmp (q, a, 100), -1);
+    b[50] = 50;
+
+    /* The result is used in expressions */
+    if (memcmp (a, b, 16) != 0) {
+        printf ("condition failed\n");
+        ++failures;
+    }
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
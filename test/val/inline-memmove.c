@@ -0,0 +1,99 @@
+/* Test of the inline expansion of memmove() */
+
+#include <stdio.h>
+#include <string.h>
+
+#pragma inline-stdfuncs (on)
+
+static unsigned char failures = 0;
+
+static unsigned char buf[300];
+static unsigned char other[300];
+
+static void fill (void)
+{
+    unsigned i;
+
+    for (i = 0; i < sizeof (buf); ++i) {
+        buf[i] = (unsigned char) i;
+        other[i] = 0;
+    }
+}
+
+static void check (const char* Name, const unsigned char* p, unsigned Start, unsigned Len, unsigned First)
+/* Check that p[Start..Start+Len) contains the ascending sequence First.. */
+{
+    unsigned i;
+
+    for (i = 0; i < Len; ++i) {
+        if (p[Start + i] != (unsigned char) (First + i)) {
+            printf ("%s: byte %u is %u, expected %u\n", Name, Start + i,
+                    p[Start + i], (unsigned char) (First + i));
+            ++failures;
+            return;
+        }
+    }
+}
+
+int main (void)
+{
+    unsigned char* r;
+
+    /* Overlapping, destination above the source */
+    fill ();
+    memmove (buf + 1, buf, 3);
+    check ("up 3", buf, 1, 3, 0);
+    check ("up 3 rest", buf, 4, 10, 4);
+
+    fill ();
+    memmove (buf + 10, buf, 100);
+    check ("up 100", buf, 10, 100, 0);
+
+    fill ();
+    memmove (buf + 20, buf, 200);
+    check ("up 200", buf, 20, 200, 0);
+    check ("up 200 head", buf, 0, 20, 0);
+
+    fill ();
+    memmove (buf + 40, buf, 256);
+    check ("up 256", buf, 40, 256, 0);
+
+    /* Overlapping, destination below the source */
+    fill ();
+    memmove (buf, buf + 1, 3);
+    check ("down 3", buf, 0, 3, 1);
+    check ("down 3 rest", buf, 3, 10, 3);
+
+    fill ();
+    memmove (buf, buf + 10, 100);
+    check ("down 100", buf, 0, 100, 10);
+
+    fill ();
+    memmove (buf + 5, buf + 30, 256);
+    check ("down 256", buf, 5, 256, 30);
+
+    /* Same address */
+    fill ();
+    memmove (buf + 7, buf + 7, 50);
+    check ("same", buf, 0, 100, 0);
+
+    /* Different objects */
+    fill ();
+    r = memmove (other + 2, buf + 3, 150);
+    check ("other", other, 2, 150, 3);
+    if (r != other + 2) {
+        printf ("wrong result\n");
+        ++failures;
+    }
+
+    fill ();
+    memmove (other, buf, 1);
+    check ("other 1", other, 0, 1, 0);
+    if (other[1] != 0) {
+        printf ("other 1 overwritten\n");
+        ++failures;
+    }
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
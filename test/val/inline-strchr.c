@@ -0,0 +1,58 @@
+/* Test of the inline expansion of strchr() */
+
+#include <stdio.h>
+#include <string.h>
+
+#pragma inline-stdfuncs (on)
+
+static unsigned char failures = 0;
+
+static char s[20] = "hello, world";
+static const char empty[4] = "";
+
+static void check (const char* Name, const char* Got, const char* Expected)
+{
+    if (Got != Expected) {
+        printf ("%s: got %p, expected %p\n", Name, Got, Expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    register char* p = s;
+    char* r;
+
+    check ("first", strchr (s, 'h'), s);
+    check ("middle", strchr (s, 'o'), s + 4);
+    check ("last", strchr (s, 'd'), s + 11);
+    check ("missing", strchr (s, 'x'), 0);
+    check ("terminator", strchr (s, '\0'), s + 12);
+    check ("empty", strchr (empty, 'a'), 0);
+    check ("empty terminator", strchr (empty, 0), empty);
+    check ("offset", strchr (s + 5, 'o'), s + 8);
+    check ("converted", strchr (s, 'l' + 256), s + 2);
+
+    /* Characters with the high bit set */
+    s[3] = (char) 0xE9;
+    check ("high bit", strchr (s, 0xE9), s + 3);
+    s[3] = 'l';
+
+    /* Pointers in the zero page */
+    check ("reg", strchr (p, 'w'), s + 7);
+    check ("reg missing", strchr (p, '!'), 0);
+
+    /* Use of the result */
+    r = strchr (s, ',');
+    if (r == 0 || *r != ',') {
+        printf ("result not usable\n");
+        ++failures;
+    }
+    if (strchr (s, 'z')) {
+        printf ("condition failed\n");
+        ++failures;
+    }
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
@@ -0,0 +1,108 @@
+/* Test of the inline expansion of strncpy() */
+
+#include <stdio.h>
+#include <string.h>
+
+#pragma inline-stdfuncs (on)
+
+static unsigned char failures = 0;
+
+static char dst[300];
+static const char src[] = "abcdef";
+static char longsrc[300];
+
+static void fill (void)
+{
+    memset (dst, 'x', sizeof (dst));
+}
+
+static void check (const char* Name, unsigned Start, unsigned Len, const char* Expected)
+/* Check Len bytes of dst at Start against Expected */
+{
+    if (memcmp (dst + Start, Expected, Len) != 0) {
+        printf ("%s: mismatch\n", Name);
+        ++failures;
+    }
+}
+
+static void checkfill (const char* Name, unsigned Start, unsigned Len, char C)
+{
+    unsigned i;
+
+    for (i = Start; i < Start + Len; ++i) {
+        if (dst[i] != C) {
+            printf ("%s: byte %u is %u\n", Name, i, (unsigned char) dst[i]);
+            ++failures;
+            return;
+        }
+    }
+}
+
+int main (void)
+{
+    register char* p = dst;
+    register const char* q = src;
+    char* r;
+    unsigned i;
+
+    /* Source shorter than the count: pad with zeroes */
+    fill ();
+    r = strncpy (dst, src, 10);
+    check ("pad", 0, 6, src);
+    checkfill ("pad zeroes", 6, 4, '\0');
+    checkfill ("pad rest", 10, 5, 'x');
+    if (r != dst) {
+        printf ("wrong result\n");
+        ++failures;
+    }
+
+    /* Source longer than the count: no terminator */
+    fill ();
+    strncpy (dst, src, 3);
+    check ("truncate", 0, 3, "abc");
+    checkfill ("truncate rest", 3, 5, 'x');
+
+    /* Exactly the length of the string */
+    fill ();
+    strncpy (dst + 1, src, 6);
+    check ("exact", 1, 6, src);
+    checkfill ("exact rest", 7, 2, 'x');
+    checkfill ("exact head", 0, 1, 'x');
+
+    /* Terminator included */
+    fill ();
+    strncpy (dst, src, 7);
+    check ("term", 0, 7, src);
+    checkfill ("term rest", 7, 2, 'x');
+
+    /* Empty source */
+    fill ();
+    strncpy (dst, "", 200);
+    checkfill ("empty", 0, 200, '\0');
+    checkfill ("empty rest", 200, 10, 'x');
+
+    /* Full range */
+    for (i = 0; i < sizeof (longsrc) - 1; ++i) {
+        longsrc[i] = 'a' + (i % 26);
+    }
+    fill ();
+    strncpy (dst, longsrc, 256);
+    check ("256", 0, 256, longsrc);
+    checkfill ("256 rest", 256, 10, 'x');
+
+    fill ();
+    strncpy (dst, src, 256);
+    check ("256 pad", 0, 6, src);
+    checkfill ("256 pad zeroes", 6, 250, '\0');
+    checkfill ("256 pad rest", 256, 10, 'x');
+
+    /* Pointers in the zero page */
+    fill ();
+    strncpy (p, q, 8);
+    check ("reg", 0, 6, src);
+    checkfill ("reg zeroes", 6, 2, '\0');
+    checkfill ("reg rest", 8, 2, 'x');
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
@@ -0,0 +1,87 @@
+/* Test of inline struct copies */
+
+#include <stdio.h>
+
+#pragma inline-stdfuncs (on)
+
+static unsigned char failures = 0;
+
+struct S3   { unsigned char a, b, c; };
+struct S7   { int a; long b; unsigned char c; };
+struct S200 { unsigned char d[200]; };
+struct S256 { unsigned char d[256]; };
+struct S300 { unsigned char d[300]; };
+
+static struct S3   a3, b3;
+static struct S7   a7, b7;
+static struct S200 a200, b200;
+static struct S256 a256, b256;
+static struct S300 a300, b300;
+static struct S7   arr[3];
+
+static void check (const char* Name, const void* A, const void* B, unsigned Size)
+{
+    const unsigned char* p = A;
+    const unsigned char* q = B;
+
+    while (Size--) {
+        if (*p++ != *q++) {
+            printf ("%s: mismatch\n", Name);
+            ++failures;
+            return;
+        }
+    }
+}
+
+int main (void)
+{
+    unsigned i;
+    struct S7 l7;
+    struct S7* p7 = &a7;
+
+    b3.a = 1;
+    b3.b = 2;
+    b3.c = 3;
+    b7.a = 1234;
+    b7.b = 567890L;
+    b7.c = 9;
+    for (i = 0; i < 300; ++i) {
+        if (i < 200) {
+            b200.d[i] = (unsigned char) (i + 1);
+        }
+        if (i < 256) {
+            b256.d[i] = (unsigned char) (i + 2);
+        }
+        b300.d[i] = (unsigned char) (i + 3);
+    }
+
+    a3 = b3;
+    check ("3", &a3, &b3, sizeof (a3));
+    a7 = b7;
+    check ("7", &a7, &b7, sizeof (a7));
+    a200 = b200;
+    check ("200", &a200, &b200, sizeof (a200));
+    a256 = b256;
+    check ("256", &a256, &b256, sizeof (a256));
+    a300 = b300;
+    check ("300", &a300, &b300, sizeof (a300));
+
+    /* Array elements and chained assignments */
+    arr[2] = arr[0] = b7;
+    check ("arr 0", &arr[0], &b7, sizeof (b7));
+    check ("arr 2", &arr[2], &b7, sizeof (b7));
+    if (arr[1].a != 0) {
+        printf ("arr 1 overwritten\n");
+        ++failures;
+    }
+
+    /* Not at constant addresses */
+    l7 = b7;
+    check ("local", &l7, &b7, sizeof (b7));
+    a7.a = 0;
+    *p7 = b7;
+    check ("pointer", &a7, &b7, sizeof (b7));
+
+    printf ("%u failures\n", failures);
+    return failures;
+}
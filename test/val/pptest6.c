@@ -0,0 +1,77 @@
+/* preprocessor test #6 - expansion of nested macros */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define STR(x)          #x
+#define XSTR(x)         STR(x)
+#define CAT(a, b)       a ## b
+#define XCAT(a, b)      CAT(a, b)
+#define ID(x)           x
+#define ADD(a, b)       ((a) + (b))
+#define TWICE(x)        ADD(x, x)
+
+int foo = 10;
+int bar = 20;
+
+/* Self-referential macros must not be expanded again */
+#define foo             (4 + foo)
+#define bar             baz
+#define baz             bar
+
+/* Nested register access style macros */
+#define BASE(n)         (0x10 * (n))
+#define REG(n, r)       (BASE(n) + (r))
+#define FIELD(n, r, b)  ((REG(n, r) >> (b)) & 1)
+
+/* Many expansions within one logical line */
+int vals[] = { TWICE(1), TWICE(TWICE(2)), ID(ID(ID(3))), XCAT(0x, 1F), \
+               REG(1, 2), REG(REG(1, 1), 2), FIELD(1, 1, 4), CAT(4, 2), \
+               TWICE(TWICE(TWICE(1))), ADD(ID(1), TWICE(ID(2))) };
+
+int expect[] = { 2, 8, 3, 31, 0x12, 0x112, 1, 42, 8, 5 };
+
+const char* strs[] = { XSTR(TWICE(a)), STR(TWICE(a)), XSTR(CAT(a, b) c), \
+                       XSTR(foo), XSTR(bar), XSTR(ID(L"x")) };
+
+const char* sexpect[] = { "((a) + (a))", "TWICE(a)", "ab c", "(4 + foo)",
+                          "bar", "L\"x\"" };
+
+unsigned char i;
+
+int main(void)
+{
+    unsigned failures = 0;
+    unsigned line1 = ID(__LINE__);
+    unsigned line2 = ID(__LINE__);
+
+    for (i = 0; i < sizeof (vals) / sizeof (vals[0]); ++i) {
+        if (vals[i] != expect[i]) {
+            printf("vals[%d]: %d expect: %d\n", i, vals[i], expect[i]);
+            ++failures;
+        }
+    }
+    for (i = 0; i < sizeof (strs) / sizeof (strs[0]); ++i) {
+        if (strcmp (strs[i], sexpect[i]) != 0) {
+            printf("strs[%d]: %s expect: %s\n", i, strs[i], sexpect[i]);
+            ++failures;
+        }
+    }
+
+    if (foo != 14 || bar != 20) {
+        printf("foo: %d expect: 14, bar: %d expect: 20\n", foo, bar);
+        ++failures;
+    }
+
+    /* The replacement of __LINE__ changes from line to line */
+    if (line1 + 1 != line2) {
+        printf("__LINE__ is stale\n");
+        ++failures;
+    }
+
+    if (failures == 0) {
+        printf("all fine\n");
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+/* Test for functions passing their parameters in the zero page block */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static void check (const char* Name, long Got, long Expected)
+{
+    if (Got != Expected) {
+        printf ("%s: got %ld, expected %ld\n", Name, Got, Expected);
+        ++failures;
+    }
+}
+
+/* Leaf function using all parameter sizes */
+long sum4 (unsigned char a, int b, long c, int d) __attribute__ ((zpargs));
+long sum4 (unsigned char a, int b, long c, int d) __attribute__ ((zpargs))
+{
+    return a + b + c + d;
+}
+
+/* Parameter order must be kept */
+int sub3 (int a, int b, int c) __attribute__ ((zpargs))
+{
+    return a - b - c;
+}
+
+/* Single parameter, nothing in the block */
+int twice (int a) __attribute__ ((zpargs))
+{
+    return a + a;
+}
+
+/* Plain function that calls a zpargs function */
+int plain (int a, int b)
+{
+    return sub3 (a, b, 1);
+}
+
+/* Non-leaf function: its own parameters must survive the calls */
+int nonleaf (int a, int b, int c) __attribute__ ((zpargs))
+{
+    int r = sub3 (b, a, c);     /* Arguments read from our own block */
+    r += plain (a, c);
+    return r + a - b + c;
+}
+
+/* Recursion */
+unsigned rec (unsigned char n, unsigned acc) __attribute__ ((zpargs))
+{
+    if (n == 0) {
+        return acc;
+    }
+    return rec (n - 1, acc + n) + n - n;
+}
+
+/* Parameters written to */
+int modify (int a, int b) __attribute__ ((zpargs))
+{
+    a += 10;
+    a += b;
+    return a;
+}
+
+/* The address of a parameter in the block cannot be taken, so a copy is
+** passed to a function writing through the pointer.
+*/
+void set5 (int* p)
+{
+    *p = 5;
+}
+
+int viaptr (int a, int b) __attribute__ ((zpargs))
+{
+    int x = a;
+    set5 (&x);
+    return x + b;
+}
+
+/* Register parameters are demoted */
+int regpar (register int a, register int b, int c) __attribute__ ((zpargs))
+{
+    return a * b + c;
+}
+
+typedef int (*subfunc) (int, int, int) __attribute__ ((zpargs));
+
+int main (void)
+{
+    subfunc f = sub3;
+
+    check ("sum4", sum4 (1, 200, 70000L, -1), 70200L);
+    check ("sub3", sub3 (100, 20, 3), 77);
+    check ("twice", twice (21), 42);
+
+    /* Nested calls in the argument list */
+    check ("nested1", sub3 (sub3 (10, 1, 2), sub3 (5, 1, 1), 1), 3);
+    check ("nested2", sub3 (100, plain (10, 2), twice (3)), 87);
+    check ("nested3", sum4 (3, sub3 (9, 4, 1), sum4 (1, 1, 1, 1), plain (7, 1)), 16);
+
+    check ("nonleaf", nonleaf (10, 3, 2), 7);
+    check ("rec", rec (10, 5), 60);
+    check ("modify", modify (1, 5), 16);
+    check ("viaptr", viaptr (1, 2), 7);
+    check ("regpar", regpar (6, 7, 8), 50);
+
+    /* Calls through a pointer */
+    check ("ptr", f (9, 3, 2), 4);
+    check ("ptr nested", f (f (9, 3, 2), 1, f (5, 4, 1)), 3);
+
+    printf ("%u failures\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
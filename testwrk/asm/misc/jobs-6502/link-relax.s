@@ -0,0 +1,54 @@
+; Verifies that ld65 --relax shortens the instructions that ca65 leaves to the
+; linker with the relax_code feature, and moves the labels behind them.
+; ca65 link-relax.s
+; ld65 --relax --define zpvar=128 link-relax.o sim6502.lib
+
+.feature relax_code
+
+.import zpvar
+.export _main
+
+.segment "LOWCODE"
+
+; Reached with a jump from another segment
+away:
+    inc zpvar
+    jmp back
+
+.code
+
+_main:
+    lda #41
+first:
+    ; Uses zero page addressing, since zpvar fits
+    sta zpvar
+second:
+    ; Becomes a BRA on the 65C02
+    jmp away
+back:
+    lda zpvar
+    cmp #42
+    bne fail
+    ; Check the instructions chosen by the linker
+    lda first
+    cmp #$85
+    bne fail
+    lda #<(second - first)
+    cmp #2
+    bne fail
+.ifpc02
+    lda second
+    cmp #$80
+    bne fail
+    lda #<(back - second)
+    cmp #2
+    bne fail
+.endif
+    ; Returning 0 reports success
+    ldx #0
+    txa
+    rts
+fail:
+    ldx #0
+    lda #1
+    rts
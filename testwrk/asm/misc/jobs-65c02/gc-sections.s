@@ -0,0 +1,70 @@
+; Verifies that ld65 --gc-sections removes the unreferenced procedures of a
+; module assembled with ca65 --proc-sections, and keeps the referenced ones.
+; ca65 --proc-sections gc-sections.s
+; ld65 --gc-sections gc-sections.o sim6502.lib
+
+.export _main
+.constructor init
+
+.bss
+initdone:
+    .res 1
+
+.code
+
+; Called from _main
+.proc first
+    lda #1
+    rts
+.endproc
+
+; Not referenced, must be removed
+.proc unused
+    lda #2
+    rts
+.endproc
+
+; Not part of a .proc, so it must be kept although nothing references it
+    .byte $55
+
+; Called from _main
+.proc last
+    jmp helper
+.endproc
+
+; Only referenced by last
+.proc helper
+    lda #42
+    rts
+.endproc
+
+; Only referenced by the constructor table
+.proc init
+    inc initdone
+    rts
+.endproc
+
+_main:
+    ldx #0
+    ; Only the byte following unused may be left between first and last
+    lda #<(last - first)
+    cmp #.sizeof(first) + 1
+    bne fail
+    lda last - 1
+    cmp #$55
+    bne fail
+    jsr first
+    cmp #1
+    bne fail
+    jsr last
+    cmp #42
+    bne fail
+    lda initdone
+    cmp #1
+    bne fail
+    ; Returning 0 reports success
+    txa
+    rts
+fail:
+    lda #1
+    rts
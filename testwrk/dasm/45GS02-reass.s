@@ -0,0 +1,363 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/45GS02-disass.bin
+; Page:       1
+
+
+        .setcpu "45GS02"
+
+L1234           := $1234
+L2345           := $2345
+L2456           := $2456
+LA157           := $A157
+LA19E           := $A19E
+LA1DF           := $A1DF
+LA1FF           := $A1FF
+LA221           := $A221
+LA246           := $A246
+LA26A           := $A26A
+LA2B2           := $A2B2
+LA2FA           := $A2FA
+LA343           := $A343
+        brk
+        ora     ($05,x)
+        cle
+        see
+        tsb     $02
+        ora     $02
+        asl     $02
+        rmb0    $02
+        php
+        ora     #$01
+        asl     a
+        tsy
+        tsb     L1234
+        ora     L1234
+        asl     L1234
+        bbr0    $02,L701E
+L701E:  bpl     L701E
+        ora     ($06),y
+        ora     ($07),z
+        lbpl    LA157
+        trb     $02
+        ora     $03,x
+        asl     $03,x
+        rmb1    $02
+        clc
+        ora     $1456,y
+        inc     a
+        inz
+        trb     L1234
+        ora     $1345,x
+        asl     $1345,x
+        bbr1    $02,L7041
+L7041:  jsr     L1234
+        and     ($05,x)
+        jsr     (L2345)
+
+        jsr     (L2456,x)
+
+        bit     $02
+        and     $02
+        rol     $02
+        rmb2    $02
+        plp
+        and     #$01
+        rol     a
+        tys
+        bit     L1234
+        and     L1234
+        rol     L1234
+        bbr2    $02,L7065
+L7065:  bmi     L7065
+        and     ($06),y
+        and     ($07),z
+        lbmi    LA19E
+        bit     $03,x
+        and     $03,x
+        rol     $03,x
+        rmb3    $02
+        sec
+        and     $1456,y
+        dec     a
+        dez
+        bit     $1345,x
+        and     $1345,x
+        rol     $1345,x
+        bbr3    $02,L7088
+L7088:  rti
+
+        eor     ($05,x)
+        neg
+        asr     a
+        asr     $02
+        eor     $02
+        lsr     $02
+        rmb4    $02
+        pha
+        eor     #$01
+        lsr     a
+        taz
+        jmp     L1234
+
+        eor     L1234
+        lsr     L1234
+        bbr4    $02,L70A6
+L70A6:  bvc     L70A6
+        eor     ($06),y
+        eor     ($07),z
+        lbvc    LA1DF
+        asr     $03,x
+        eor     $03,x
+        lsr     $03,x
+        rmb5    $02
+        cli
+        eor     $1456,y
+        phy
+        tab
+        map
+        eor     $1345,x
+        lsr     $1345,x
+        bbr5    $02,L70C7
+L70C7:  rts
+
+        adc     ($05,x)
+        rtn     #$09
+        bsr     LA1FF
+        stz     $02
+        adc     $02
+        ror     $02
+        rmb6    $02
+        pla
+        adc     #$01
+        ror     a
+        tza
+        jmp     (L2345)
+
+        adc     L1234
+        ror     L1234
+        bbr6    $02,L70E8
+L70E8:  bvs     L70E8
+        adc     ($06),y
+        adc     ($07),z
+        lbvs    LA221
+        stz     $03,x
+        adc     $03,x
+        ror     $03,x
+        rmb7    $02
+        sei
+        adc     $1456,y
+        ply
+        tba
+        jmp     (L2456,x)
+        adc     $1345,x
+        ror     $1345,x
+        bbr7    $02,L710B
+L710B:  bra     L710B
+        sta     ($05,x)
+        sta     ($0F,sp),y
+        sta     ($0F,sp),y
+        lbra    LA246
+        sty     $02
+        sta     $02
+        stx     $02
+        smb0    $02
+        dey
+        bit     #$01
+        txa
+        sty     $1345,x
+        sty     L1234
+        sta     L1234
+        stx     L1234
+        bbs0    $02,L7131
+L7131:  bcc     L7131
+        sta     ($06),y
+        sta     ($07),z
+        lbcc    LA26A
+        sty     $03,x
+        sta     $03,x
+        stx     $04,y
+        smb1    $02
+        tya
+        sta     $1456,y
+        txs
+        stx     $1456,y
+        stz     L1234
+        sta     $1345,x
+        stz     $1345,x
+        bbs1    $02,L7156
+L7156:  ldy     #$01
+        lda     ($05,x)
+        ldx     #$01
+        ldz     #$01
+        ldy     $02
+        lda     $02
+        ldx     $02
+        smb2    $02
+        tay
+        lda     #$01
+        tax
+        ldz     L1234
+        ldy     L1234
+        lda     L1234
+        ldx     L1234
+        bbs2    $02,L7179
+L7179:  bcs     L7179
+        lda     ($06),y
+        lda     ($07),z
+        lbcs    LA2B2
+        ldy     $03,x
+        lda     $03,x
+        ldx     $04,y
+        smb3    $02
+        clv
+        lda     $1456,y
+        tsx
+        ldz     $1345,x
+        ldy     $1345,x
+        lda     $1345,x
+        ldx     $1456,y
+        bbs3    $02,L719E
+L719E:  cpy     #$01
+        cmp     ($05,x)
+        cpz     #$01
+        dew     $02
+        cpy     $02
+        cmp     $02
+        dec     $02
+        smb4    $02
+        iny
+        cmp     #$01
+        dex
+        asw     L1234
+        cpy     L1234
+        cmp     L1234
+        dec     L1234
+        bbs4    $02,L71C1
+L71C1:  bne     L71C1
+        cmp     ($06),y
+        cmp     ($07),z
+        lbne    LA2FA
+        cpz     $02
+        cmp     $03,x
+        dec     $03,x
+        smb5    $02
+        cld
+        cmp     $1456,y
+        phx
+        phz
+        cpz     L1234
+        cmp     $1345,x
+        dec     $1345,x
+        bbs5    $02,L71E4
+L71E4:  cpx     #$01
+        sbc     ($05,x)
+        lda     ($0F,sp),y
+        lda     ($0F,sp),y
+        inw     $02
+        cpx     $02
+        sbc     $02
+        inc     $02
+        smb6    $02
+        inx
+        sbc     #$01
+        eom
+        eom
+        row     L1234
+        cpx     L1234
+        sbc     L1234
+        inc     L1234
+        bbs6    $02,L720A
+L720A:  beq     L720A
+        sbc     ($06),y
+        sbc     ($07),z
+        lbeq    LA343
+        phw     #$089A
+        phw     #$089A
+        sbc     $03,x
+        inc     $03,x
+        smb7    $02
+        sed
+        sbc     $1456,y
+        plx
+        plz
+        phw     L1234
+        phw     L1234
+        sbc     $1345,x
+        inc     $1345,x
+        bbs7    $02,L7234
+L7234:  adc     [$12],z
+        adcq    $12
+        adcq    $3456
+        adcq    ($78),z
+        adcq    [$9A]
+        and     [$12],z
+        andq    $12
+        andq    $3456
+        andq    ($78),z
+        andq    [$9A]
+        aslq    $12
+        aslq    a
+        aslq    $3456
+        aslq    $78,x
+        aslq    $9ABC,x
+        asrq    a
+        asrq    $12
+        asrq    $34,x
+        bitq    $12
+        bitq    $3456
+        cmp     [$12],z
+        cmpq    $12
+        cmpq    $3456
+        cmpq    ($78),z
+        cmpq    [$9A]
+        deq     a
+        deq     $12
+        deq     $3456
+        deq     $78,x
+        deq     $9ABC,x
+        eor     [$12],z
+        eorq    $12
+        eorq    $3456
+        eorq    ($78),z
+        eorq    [$9A]
+        inq     a
+        inq     $12
+        inq     $3456
+        inq     $78,x
+        inq     $9ABC,x
+        lda     [$12],z
+        ldq     $12
+        ldq     $3456
+        ldq     ($78),z
+        ldq     [$9A]
+        lsrq    $12
+        lsrq    a
+        lsrq    $3456
+        lsrq    $78,x
+        lsrq    $9ABC,x
+        ora     [$12],z
+        orq     $12
+        orq     $3456
+        orq     ($78),z
+        orq     [$9A]
+        rolq    $12
+        rolq    a
+        rolq    $3456
+        rolq    $78,x
+        rolq    $9ABC,x
+        rorq    $12
+        rorq    a
+        rorq    $3456
+        rorq    $78,x
+        rorq    $9ABC,x
+        sbc     [$12],z
+        sbcq    $12
+        sbcq    $3456
+        sbcq    ($78),z
+        sbcq    [$9A]
+        sta     [$12],z
+        stq     $12
+        stq     $3456
+        stq     ($78),z
+        stq     [$9A]
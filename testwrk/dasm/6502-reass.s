@@ -0,0 +1,867 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/6502-disass.bin
+; Page:       1
+
+
+        .setcpu "6502"
+
+LEA02           := $EA02
+        brk
+        .byte   $02
+        nop
+        brk
+        ora     ($02,x)
+        nop
+        brk
+        .byte   $02
+        .byte   $02
+        nop
+        brk
+        .byte   $03
+        .byte   $02
+        nop
+        brk
+        .byte   $04
+        .byte   $02
+        nop
+        brk
+        ora     $02
+        nop
+        brk
+        asl     $02
+        nop
+        brk
+        .byte   $07
+        .byte   $02
+        nop
+        brk
+        php
+        .byte   $02
+        nop
+        brk
+        ora     #$02
+        nop
+        brk
+        asl     a
+        .byte   $02
+        nop
+        brk
+        .byte   $0B
+        .byte   $02
+        nop
+        brk
+        .byte   $0C
+        .byte   $02
+        nop
+        brk
+        ora     LEA02
+        brk
+        asl     LEA02
+        brk
+        .byte   $0F
+        .byte   $02
+        nop
+        brk
+        bpl     L7044
+        nop
+        brk
+L7044:  ora     ($02),y
+        nop
+        brk
+        .byte   $12
+        .byte   $02
+        nop
+        brk
+        .byte   $13
+        .byte   $02
+        nop
+        brk
+        .byte   $14
+        .byte   $02
+        nop
+        brk
+        ora     $02,x
+        nop
+        brk
+        asl     $02,x
+        nop
+        brk
+        .byte   $17
+        .byte   $02
+        nop
+        brk
+        clc
+        .byte   $02
+        nop
+        brk
+        ora     LEA02,y
+        brk
+        .byte   $1A
+        .byte   $02
+        nop
+        brk
+        .byte   $1B
+        .byte   $02
+        nop
+        brk
+        .byte   $1C
+        .byte   $02
+        nop
+        brk
+        ora     LEA02,x
+        brk
+        asl     LEA02,x
+        brk
+        .byte   $1F
+        .byte   $02
+        nop
+        brk
+        jsr     LEA02
+        brk
+        and     ($02,x)
+        nop
+        brk
+        .byte   $22
+        .byte   $02
+        nop
+        brk
+        .byte   $23
+        .byte   $02
+        nop
+        brk
+        bit     $02
+        nop
+        brk
+        and     $02
+        nop
+        brk
+        rol     $02
+        nop
+        brk
+        .byte   $27
+        .byte   $02
+        nop
+        brk
+        plp
+        .byte   $02
+        nop
+        brk
+        and     #$02
+        nop
+        brk
+        rol     a
+        .byte   $02
+        nop
+        brk
+        .byte   $2B
+        .byte   $02
+        nop
+        brk
+        bit     LEA02
+        brk
+        and     LEA02
+        brk
+        rol     LEA02
+        brk
+        .byte   $2F
+        .byte   $02
+        nop
+        brk
+        bmi     L70C4
+        nop
+        brk
+L70C4:  and     ($02),y
+        nop
+        brk
+        .byte   $32
+        .byte   $02
+        nop
+        brk
+        .byte   $33
+        .byte   $02
+        nop
+        brk
+        .byte   $34
+        .byte   $02
+        nop
+        brk
+        and     $02,x
+        nop
+        brk
+        rol     $02,x
+        nop
+        brk
+        .byte   $37
+        .byte   $02
+        nop
+        brk
+        sec
+        .byte   $02
+        nop
+        brk
+        and     LEA02,y
+        brk
+        .byte   $3A
+        .byte   $02
+        nop
+        brk
+        .byte   $3B
+        .byte   $02
+        nop
+        brk
+        .byte   $3C
+        .byte   $02
+        nop
+        brk
+        and     LEA02,x
+        brk
+        rol     LEA02,x
+        brk
+        .byte   $3F
+        .byte   $02
+        nop
+        brk
+        rti
+
+        .byte   $02
+        nop
+        brk
+        eor     ($02,x)
+        nop
+        brk
+        .byte   $42
+        .byte   $02
+        nop
+        brk
+        .byte   $43
+        .byte   $02
+        nop
+        brk
+        .byte   $44
+        .byte   $02
+        nop
+        brk
+        eor     $02
+        nop
+        brk
+        lsr     $02
+        nop
+        brk
+        .byte   $47
+        .byte   $02
+        nop
+        brk
+        pha
+        .byte   $02
+        nop
+        brk
+        eor     #$02
+        nop
+        brk
+        lsr     a
+        .byte   $02
+        nop
+        brk
+        .byte   $4B
+        .byte   $02
+        nop
+        brk
+        jmp     LEA02
+
+        brk
+        eor     LEA02
+        brk
+        lsr     LEA02
+        brk
+        .byte   $4F
+        .byte   $02
+        nop
+        brk
+        bvc     L7144
+        nop
+        brk
+L7144:  eor     ($02),y
+        nop
+        brk
+        .byte   $52
+        .byte   $02
+        nop
+        brk
+        .byte   $53
+        .byte   $02
+        nop
+        brk
+        .byte   $54
+        .byte   $02
+        nop
+        brk
+        eor     $02,x
+        nop
+        brk
+        lsr     $02,x
+        nop
+        brk
+        .byte   $57
+        .byte   $02
+        nop
+        brk
+        cli
+        .byte   $02
+        nop
+        brk
+        eor     LEA02,y
+        brk
+        .byte   $5A
+        .byte   $02
+        nop
+        brk
+        .byte   $5B
+        .byte   $02
+        nop
+        brk
+        .byte   $5C
+        .byte   $02
+        nop
+        brk
+        eor     LEA02,x
+        brk
+        lsr     LEA02,x
+        brk
+        .byte   $5F
+        .byte   $02
+        nop
+        brk
+        rts
+
+        .byte   $02
+        nop
+        brk
+        adc     ($02,x)
+        nop
+        brk
+        .byte   $62
+        .byte   $02
+        nop
+        brk
+        .byte   $63
+        .byte   $02
+        nop
+        brk
+        .byte   $64
+        .byte   $02
+        nop
+        brk
+        adc     $02
+        nop
+        brk
+        ror     $02
+        nop
+        brk
+        .byte   $67
+        .byte   $02
+        nop
+        brk
+        pla
+        .byte   $02
+        nop
+        brk
+        adc     #$02
+        nop
+        brk
+        ror     a
+        .byte   $02
+        nop
+        brk
+        .byte   $6B
+        .byte   $02
+        nop
+        brk
+        jmp     (LEA02)
+
+        brk
+        adc     LEA02
+        brk
+        ror     LEA02
+        brk
+        .byte   $6F
+        .byte   $02
+        nop
+        brk
+        bvs     L71C4
+        nop
+        brk
+L71C4:  adc     ($02),y
+        nop
+        brk
+        .byte   $72
+        .byte   $02
+        nop
+        brk
+        .byte   $73
+        .byte   $02
+        nop
+        brk
+        .byte   $74
+        .byte   $02
+        nop
+        brk
+        adc     $02,x
+        nop
+        brk
+        ror     $02,x
+        nop
+        brk
+        .byte   $77
+        .byte   $02
+        nop
+        brk
+        sei
+        .byte   $02
+        nop
+        brk
+        adc     LEA02,y
+        brk
+        .byte   $7A
+        .byte   $02
+        nop
+        brk
+        .byte   $7B
+        .byte   $02
+        nop
+        brk
+        .byte   $7C
+        .byte   $02
+        nop
+        brk
+        adc     LEA02,x
+        brk
+        ror     LEA02,x
+        brk
+        .byte   $7F
+        .byte   $02
+        nop
+        brk
+        .byte   $80
+        .byte   $02
+        nop
+        brk
+        sta     ($02,x)
+        nop
+        brk
+        .byte   $82
+        .byte   $02
+        nop
+        brk
+        .byte   $83
+        .byte   $02
+        nop
+        brk
+        sty     $02
+        nop
+        brk
+        sta     $02
+        nop
+        brk
+        stx     $02
+        nop
+        brk
+        .byte   $87
+        .byte   $02
+        nop
+        brk
+        dey
+        .byte   $02
+        nop
+        brk
+        .byte   $89
+        .byte   $02
+        nop
+        brk
+        txa
+        .byte   $02
+        nop
+        brk
+        .byte   $8B
+        .byte   $02
+        nop
+        brk
+        sty     LEA02
+        brk
+        sta     LEA02
+        brk
+        stx     LEA02
+        brk
+        .byte   $8F
+        .byte   $02
+        nop
+        brk
+        bcc     L7244
+        nop
+        brk
+L7244:  sta     ($02),y
+        nop
+        brk
+        .byte   $92
+        .byte   $02
+        nop
+        brk
+        .byte   $93
+        .byte   $02
+        nop
+        brk
+        sty     $02,x
+        nop
+        brk
+        sta     $02,x
+        nop
+        brk
+        stx     $02,y
+        nop
+        brk
+        .byte   $97
+        .byte   $02
+        nop
+        brk
+        tya
+        .byte   $02
+        nop
+        brk
+        sta     LEA02,y
+        brk
+        txs
+        .byte   $02
+        nop
+        brk
+        .byte   $9B
+        .byte   $02
+        nop
+        brk
+        .byte   $9C
+        .byte   $02
+        nop
+        brk
+        sta     LEA02,x
+        brk
+        .byte   $9E
+        .byte   $02
+        nop
+        brk
+        .byte   $9F
+        .byte   $02
+        nop
+        brk
+        ldy     #$02
+        nop
+        brk
+        lda     ($02,x)
+        nop
+        brk
+        ldx     #$02
+        nop
+        brk
+        .byte   $A3
+        .byte   $02
+        nop
+        brk
+        ldy     $02
+        nop
+        brk
+        lda     $02
+        nop
+        brk
+        ldx     $02
+        nop
+        brk
+        .byte   $A7
+        .byte   $02
+        nop
+        brk
+        tay
+        .byte   $02
+        nop
+        brk
+        lda     #$02
+        nop
+        brk
+        tax
+        .byte   $02
+        nop
+        brk
+        .byte   $AB
+        .byte   $02
+        nop
+        brk
+        ldy     LEA02
+        brk
+        lda     LEA02
+        brk
+        ldx     LEA02
+        brk
+        .byte   $AF
+        .byte   $02
+        nop
+        brk
+        bcs     L72C4
+        nop
+        brk
+L72C4:  lda     ($02),y
+        nop
+        brk
+        .byte   $B2
+        .byte   $02
+        nop
+        brk
+        .byte   $B3
+        .byte   $02
+        nop
+        brk
+        ldy     $02,x
+        nop
+        brk
+        lda     $02,x
+        nop
+        brk
+        ldx     $02,y
+        nop
+        brk
+        .byte   $B7
+        .byte   $02
+        nop
+        brk
+        clv
+        .byte   $02
+        nop
+        brk
+        lda     LEA02,y
+        brk
+        tsx
+        .byte   $02
+        nop
+        brk
+        .byte   $BB
+        .byte   $02
+        nop
+        brk
+        ldy     LEA02,x
+        brk
+        lda     LEA02,x
+        brk
+        ldx     LEA02,y
+        brk
+        .byte   $BF
+        .byte   $02
+        nop
+        brk
+        cpy     #$02
+        nop
+        brk
+        cmp     ($02,x)
+        nop
+        brk
+        .byte   $C2
+        .byte   $02
+        nop
+        brk
+        .byte   $C3
+        .byte   $02
+        nop
+        brk
+        cpy     $02
+        nop
+        brk
+        cmp     $02
+        nop
+        brk
+        dec     $02
+        nop
+        brk
+        .byte   $C7
+        .byte   $02
+        nop
+        brk
+        iny
+        .byte   $02
+        nop
+        brk
+        cmp     #$02
+        nop
+        brk
+        dex
+        .byte   $02
+        nop
+        brk
+        .byte   $CB
+        .byte   $02
+        nop
+        brk
+        cpy     LEA02
+        brk
+        cmp     LEA02
+        brk
+        dec     LEA02
+        brk
+        .byte   $CF
+        .byte   $02
+        nop
+        brk
+        bne     L7344
+        nop
+        brk
+L7344:  cmp     ($02),y
+        nop
+        brk
+        .byte   $D2
+        .byte   $02
+        nop
+        brk
+        .byte   $D3
+        .byte   $02
+        nop
+        brk
+        .byte   $D4
+        .byte   $02
+        nop
+        brk
+        cmp     $02,x
+        nop
+        brk
+        dec     $02,x
+        nop
+        brk
+        .byte   $D7
+        .byte   $02
+        nop
+        brk
+        cld
+        .byte   $02
+        nop
+        brk
+        cmp     LEA02,y
+        brk
+        .byte   $DA
+        .byte   $02
+        nop
+        brk
+        .byte   $DB
+        .byte   $02
+        nop
+        brk
+        .byte   $DC
+        .byte   $02
+        nop
+        brk
+        cmp     LEA02,x
+        brk
+        dec     LEA02,x
+        brk
+        .byte   $DF
+        .byte   $02
+        nop
+        brk
+        cpx     #$02
+        nop
+        brk
+        sbc     ($02,x)
+        nop
+        brk
+        .byte   $E2
+        .byte   $02
+        nop
+        brk
+        .byte   $E3
+        .byte   $02
+        nop
+        brk
+        cpx     $02
+        nop
+        brk
+        sbc     $02
+        nop
+        brk
+        inc     $02
+        nop
+        brk
+        .byte   $E7
+        .byte   $02
+        nop
+        brk
+        inx
+        .byte   $02
+        nop
+        brk
+        sbc     #$02
+        nop
+        brk
+        nop
+        .byte   $02
+        nop
+        brk
+        .byte   $EB
+        .byte   $02
+        nop
+        brk
+        cpx     LEA02
+        brk
+        sbc     LEA02
+        brk
+        inc     LEA02
+        brk
+        .byte   $EF
+        .byte   $02
+        nop
+        brk
+        beq     L73C4
+        nop
+        brk
+L73C4:  sbc     ($02),y
+        nop
+        brk
+        .byte   $F2
+        .byte   $02
+        nop
+        brk
+        .byte   $F3
+        .byte   $02
+        nop
+        brk
+        .byte   $F4
+        .byte   $02
+        nop
+        brk
+        sbc     $02,x
+        nop
+        brk
+        inc     $02,x
+        nop
+        brk
+        .byte   $F7
+        .byte   $02
+        nop
+        brk
+        sed
+        .byte   $02
+        nop
+        brk
+        sbc     LEA02,y
+        brk
+        .byte   $FA
+        .byte   $02
+        nop
+        brk
+        .byte   $FB
+        .byte   $02
+        nop
+        brk
+        .byte   $FC
+        .byte   $02
+        nop
+        brk
+        sbc     LEA02,x
+        brk
+        inc     LEA02,x
+        brk
+        .byte   $FF
+        .byte   $02
+        nop
+        brk
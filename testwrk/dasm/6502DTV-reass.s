@@ -0,0 +1,199 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/6502DTV-disass.bin
+; Page:       1
+
+
+        .setcpu "6502DTV"
+
+L3456           := $3456
+        brk
+        ora     ($12,x)
+        nop     $12
+        ora     $12
+        asl     $12
+        php
+        ora     #$12
+        asl     a
+        anc     #$12
+        nop     L3456
+        ora     L3456
+        asl     L3456
+        bpl     L701A
+L701A:  ora     ($12),y
+        bra     L701E
+L701E:  nop     $12,x
+        ora     $12,x
+        asl     $12,x
+        clc
+        ora     L3456,y
+        nop     L3456,x
+        ora     L3456,x
+        asl     L3456,x
+        jsr     L3456
+        and     ($12,x)
+        rla     ($12,x)
+        bit     $12
+        and     $12
+        rol     $12
+        rla     $12
+        plp
+        and     #$12
+        rol     a
+        bit     L3456
+        and     L3456
+        rol     L3456
+        rla     L3456
+        bmi     L7052
+L7052:  and     ($12),y
+        sac     #$12
+        rla     ($12),y
+        and     $12,x
+        rol     $12,x
+        rla     $12,x
+        sec
+        and     L3456,y
+        rla     L3456,y
+        and     L3456,x
+        rol     L3456,x
+        rla     L3456,x
+        rti
+
+        eor     ($12,x)
+        sir     #$12
+        eor     $12
+        lsr     $12
+        pha
+        eor     #$12
+        lsr     a
+        alr     #$12
+        jmp     L3456
+
+        eor     L3456
+        lsr     L3456
+        bvc     L7088
+L7088:  eor     ($12),y
+        eor     $12,x
+        lsr     $12,x
+        cli
+        eor     L3456,x
+        lsr     L3456,x
+        rts
+
+        adc     ($12,x)
+        rra     ($12,x)
+        adc     $12
+        ror     $12
+        rra     $12
+        pla
+        adc     #$12
+        ror     a
+        arr     #$12
+        jmp     (L3456)
+
+        adc     L3456
+        ror     L3456
+        rra     L3456
+        bvs     L70B4
+L70B4:  adc     ($12),y
+        rra     ($12),y
+        adc     $12,x
+        ror     $12,x
+        rra     $12,x
+        sei
+        adc     L3456,y
+        rra     L3456,y
+        adc     L3456,x
+        ror     L3456,x
+        rra     L3456,x
+        nop     #$12
+        sta     ($12,x)
+        sty     $12
+        sta     $12
+        stx     $12
+        dey
+        txa
+        sty     L3456
+        sta     L3456
+        stx     L3456
+        bcc     L70E5
+L70E5:  sta     ($12),y
+        sty     $12,x
+        sta     $12,x
+        stx     $12,y
+        tya
+        sta     L3456,y
+        txs
+        shy     L3456,x
+        sta     L3456,x
+        shx     L3456,y
+        ldy     #$12
+        lda     ($12,x)
+        ldx     #$12
+        lax     ($12,x)
+        ldy     $12
+        lda     $12
+        ldx     $12
+        lax     $12
+        tay
+        lda     #$12
+        tax
+        lax     #$12
+        ldy     L3456
+        lda     L3456
+        ldx     L3456
+        lax     L3456
+        bcs     L711F
+L711F:  lda     ($12),y
+        lax     ($12),y
+        ldy     $12,x
+        lda     $12,x
+        ldx     $12,y
+        lax     $12,y
+        clv
+        lda     L3456,y
+        tsx
+        las     L3456,y
+        ldy     L3456,x
+        lda     L3456,x
+        ldx     L3456,y
+        lax     L3456,y
+        cpy     #$12
+        cmp     ($12,x)
+        cpy     $12
+        cmp     $12
+        dec     $12
+        iny
+        cmp     #$12
+        dex
+        axs     #$12
+        cpy     L3456
+        cmp     L3456
+        dec     L3456
+        bne     L715A
+L715A:  cmp     ($12),y
+        cmp     $12,x
+        dec     $12,x
+        cld
+        cmp     L3456,y
+        cmp     L3456,x
+        dec     L3456,x
+        cpx     #$12
+        sbc     ($12,x)
+        cpx     $12
+        sbc     $12
+        inc     $12
+        inx
+        sbc     #$12
+        nop
+        cpx     L3456
+        sbc     L3456
+        inc     L3456
+        beq     L7183
+L7183:  sbc     ($12),y
+        sbc     $12,x
+        inc     $12,x
+        sed
+        sbc     L3456,y
+        sbc     L3456,x
+        inc     L3456,x
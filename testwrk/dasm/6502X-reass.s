@@ -0,0 +1,751 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/6502X-disass.bin
+; Page:       1
+
+
+        .setcpu "6502X"
+
+LEA02           := $EA02
+        brk
+        jam
+        nop
+        brk
+        ora     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        slo     ($02,x)
+        nop
+        brk
+        nop     $02
+        nop
+        brk
+        ora     $02
+        nop
+        brk
+        asl     $02
+        nop
+        brk
+        slo     $02
+        nop
+        brk
+        php
+        jam
+        nop
+        brk
+        ora     #$02
+        nop
+        brk
+        asl     a
+        jam
+        nop
+        brk
+        anc     #$02
+        nop
+        brk
+        nop     LEA02
+        brk
+        ora     LEA02
+        brk
+        asl     LEA02
+        brk
+        slo     LEA02
+        brk
+        bpl     L7044
+        nop
+        brk
+L7044:  ora     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        slo     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        ora     $02,x
+        nop
+        brk
+        asl     $02,x
+        nop
+        brk
+        slo     $02,x
+        nop
+        brk
+        clc
+        jam
+        nop
+        brk
+        ora     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        slo     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        ora     LEA02,x
+        brk
+        asl     LEA02,x
+        brk
+        slo     LEA02,x
+        brk
+        jsr     LEA02
+        brk
+        and     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        rla     ($02,x)
+        nop
+        brk
+        bit     $02
+        nop
+        brk
+        and     $02
+        nop
+        brk
+        rol     $02
+        nop
+        brk
+        rla     $02
+        nop
+        brk
+        plp
+        jam
+        nop
+        brk
+        and     #$02
+        nop
+        brk
+        rol     a
+        jam
+        nop
+        brk
+        anc     #$02
+        nop
+        brk
+        bit     LEA02
+        brk
+        and     LEA02
+        brk
+        rol     LEA02
+        brk
+        rla     LEA02
+        brk
+        bmi     L70C4
+        nop
+        brk
+L70C4:  and     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        rla     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        and     $02,x
+        nop
+        brk
+        rol     $02,x
+        nop
+        brk
+        rla     $02,x
+        nop
+        brk
+        sec
+        jam
+        nop
+        brk
+        and     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        rla     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        and     LEA02,x
+        brk
+        rol     LEA02,x
+        brk
+        rla     LEA02,x
+        brk
+        rti
+
+        jam
+        nop
+        brk
+        eor     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        sre     ($02,x)
+        nop
+        brk
+        nop     $02
+        nop
+        brk
+        eor     $02
+        nop
+        brk
+        lsr     $02
+        nop
+        brk
+        sre     $02
+        nop
+        brk
+        pha
+        jam
+        nop
+        brk
+        eor     #$02
+        nop
+        brk
+        lsr     a
+        jam
+        nop
+        brk
+        alr     #$02
+        nop
+        brk
+        jmp     LEA02
+
+        brk
+        eor     LEA02
+        brk
+        lsr     LEA02
+        brk
+        sre     LEA02
+        brk
+        bvc     L7144
+        nop
+        brk
+L7144:  eor     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        sre     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        eor     $02,x
+        nop
+        brk
+        lsr     $02,x
+        nop
+        brk
+        sre     $02,x
+        nop
+        brk
+        cli
+        jam
+        nop
+        brk
+        eor     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        sre     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        eor     LEA02,x
+        brk
+        lsr     LEA02,x
+        brk
+        sre     LEA02,x
+        brk
+        rts
+
+        jam
+        nop
+        brk
+        adc     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        rra     ($02,x)
+        nop
+        brk
+        nop     $02
+        nop
+        brk
+        adc     $02
+        nop
+        brk
+        ror     $02
+        nop
+        brk
+        rra     $02
+        nop
+        brk
+        pla
+        jam
+        nop
+        brk
+        adc     #$02
+        nop
+        brk
+        ror     a
+        jam
+        nop
+        brk
+        arr     #$02
+        nop
+        brk
+        jmp     (LEA02)
+
+        brk
+        adc     LEA02
+        brk
+        ror     LEA02
+        brk
+        rra     LEA02
+        brk
+        bvs     L71C4
+        nop
+        brk
+L71C4:  adc     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        rra     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        adc     $02,x
+        nop
+        brk
+        ror     $02,x
+        nop
+        brk
+        rra     $02,x
+        nop
+        brk
+        sei
+        jam
+        nop
+        brk
+        adc     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        rra     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        adc     LEA02,x
+        brk
+        ror     LEA02,x
+        brk
+        rra     LEA02,x
+        brk
+        nop     #$02
+        nop
+        brk
+        sta     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        sax     ($02,x)
+        nop
+        brk
+        sty     $02
+        nop
+        brk
+        sta     $02
+        nop
+        brk
+        stx     $02
+        nop
+        brk
+        sax     $02
+        nop
+        brk
+        dey
+        jam
+        nop
+        brk
+        nop     #$02
+        nop
+        brk
+        txa
+        jam
+        nop
+        brk
+        ane     #$02
+        nop
+        brk
+        sty     LEA02
+        brk
+        sta     LEA02
+        brk
+        stx     LEA02
+        brk
+        sax     LEA02
+        brk
+        bcc     L7244
+        nop
+        brk
+L7244:  sta     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        sha     ($02),y
+        nop
+        brk
+        sty     $02,x
+        nop
+        brk
+        sta     $02,x
+        nop
+        brk
+        stx     $02,y
+        nop
+        brk
+        sax     $02,y
+        nop
+        brk
+        tya
+        jam
+        nop
+        brk
+        sta     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        tas     LEA02,y
+        brk
+        shy     LEA02,x
+        brk
+        sta     LEA02,x
+        brk
+        shx     LEA02,y
+        brk
+        sha     LEA02,y
+        brk
+        ldy     #$02
+        nop
+        brk
+        lda     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        lax     ($02,x)
+        nop
+        brk
+        ldy     $02
+        nop
+        brk
+        lda     $02
+        nop
+        brk
+        ldx     $02
+        nop
+        brk
+        lax     $02
+        nop
+        brk
+        tay
+        jam
+        nop
+        brk
+        lda     #$02
+        nop
+        brk
+        tax
+        jam
+        nop
+        brk
+        lax     #$02
+        nop
+        brk
+        ldy     LEA02
+        brk
+        lda     LEA02
+        brk
+        ldx     LEA02
+        brk
+        lax     LEA02
+        brk
+        bcs     L72C4
+        nop
+        brk
+L72C4:  lda     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        lax     ($02),y
+        nop
+        brk
+        ldy     $02,x
+        nop
+        brk
+        lda     $02,x
+        nop
+        brk
+        ldx     $02,y
+        nop
+        brk
+        lax     $02,y
+        nop
+        brk
+        clv
+        jam
+        nop
+        brk
+        lda     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        las     LEA02,y
+        brk
+        ldy     LEA02,x
+        brk
+        lda     LEA02,x
+        brk
+        ldx     LEA02,y
+        brk
+        lax     LEA02,y
+        brk
+        cpy     #$02
+        nop
+        brk
+        cmp     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        dcp     ($02,x)
+        nop
+        brk
+        cpy     $02
+        nop
+        brk
+        cmp     $02
+        nop
+        brk
+        dec     $02
+        nop
+        brk
+        dcp     $02
+        nop
+        brk
+        iny
+        jam
+        nop
+        brk
+        cmp     #$02
+        nop
+        brk
+        dex
+        jam
+        nop
+        brk
+        axs     #$02
+        nop
+        brk
+        cpy     LEA02
+        brk
+        cmp     LEA02
+        brk
+        dec     LEA02
+        brk
+        dcp     LEA02
+        brk
+        bne     L7344
+        nop
+        brk
+L7344:  cmp     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        dcp     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        cmp     $02,x
+        nop
+        brk
+        dec     $02,x
+        nop
+        brk
+        dcp     $02,x
+        nop
+        brk
+        cld
+        jam
+        nop
+        brk
+        cmp     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        dcp     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        cmp     LEA02,x
+        brk
+        dec     LEA02,x
+        brk
+        dcp     LEA02,x
+        brk
+        cpx     #$02
+        nop
+        brk
+        sbc     ($02,x)
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        isc     ($02,x)
+        nop
+        brk
+        cpx     $02
+        nop
+        brk
+        sbc     $02
+        nop
+        brk
+        inc     $02
+        nop
+        brk
+        isc     $02
+        nop
+        brk
+        inx
+        jam
+        nop
+        brk
+        sbc     #$02
+        nop
+        brk
+        nop
+        jam
+        nop
+        brk
+        sbc     #$02
+        nop
+        brk
+        cpx     LEA02
+        brk
+        sbc     LEA02
+        brk
+        inc     LEA02
+        brk
+        isc     LEA02
+        brk
+        beq     L73C4
+        nop
+        brk
+L73C4:  sbc     ($02),y
+        nop
+        brk
+        jam
+        jam
+        nop
+        brk
+        isc     ($02),y
+        nop
+        brk
+        nop     $02,x
+        nop
+        brk
+        sbc     $02,x
+        nop
+        brk
+        inc     $02,x
+        nop
+        brk
+        isc     $02,x
+        nop
+        brk
+        sed
+        jam
+        nop
+        brk
+        sbc     LEA02,y
+        brk
+        nop
+        jam
+        nop
+        brk
+        isc     LEA02,y
+        brk
+        nop     LEA02,x
+        brk
+        sbc     LEA02,x
+        brk
+        inc     LEA02,x
+        brk
+        isc     LEA02,x
+        brk
@@ -0,0 +1,234 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/65C02-disass.bin
+; Page:       1
+
+
+        .setcpu "65C02"
+
+L3456           := $3456
+        brk
+        ora     ($12,x)
+        tsb     $12
+        ora     $12
+        asl     $12
+        rmb0    $12
+        php
+        ora     #$12
+        asl     a
+        tsb     L3456
+        ora     L3456
+        asl     L3456
+        bbr0    $12,L701C
+        .byte   $10
+L701C:  brk
+        ora     ($12),y
+        ora     ($12)
+        trb     $12
+        ora     $12,x
+        asl     $12,x
+        rmb1    $12
+        clc
+        ora     L3456,y
+        inc     a
+        trb     L3456
+        ora     L3456,x
+        asl     L3456,x
+        bbr1    $12,L703B
+        .byte   $20
+L703B:  lsr     $34,x
+        and     ($12,x)
+        bit     $12
+        and     $12
+        rol     $12
+        rmb2    $12
+        plp
+        and     #$12
+        rol     a
+        bit     L3456
+        and     L3456
+        rol     L3456
+        bbr2    $12,L7058
+        .byte   $30
+L7058:  brk
+        and     ($12),y
+        and     ($12)
+        bit     $12,x
+        and     $12,x
+        rol     $12,x
+        rmb3    $12
+        sec
+        and     L3456,y
+        dec     a
+        bit     L3456,x
+        and     L3456,x
+        rol     L3456,x
+        bbr3    $12,L7077
+        rti
+
+L7077:  eor     ($12,x)
+        eor     $12
+        lsr     $12
+        rmb4    $12
+        pha
+        eor     #$12
+        lsr     a
+        jmp     L3456
+
+        eor     L3456
+        lsr     L3456
+        bbr4    $12,L7090
+        .byte   $50
+L7090:  brk
+        eor     ($12),y
+        eor     ($12)
+        eor     $12,x
+        lsr     $12,x
+        rmb5    $12
+        cli
+        eor     L3456,y
+        phy
+        eor     L3456,x
+        lsr     L3456,x
+        bbr5    $12,L70AA
+        rts
+
+L70AA:  adc     ($12,x)
+        stz     $12
+        adc     $12
+        ror     $12
+        rmb6    $12
+        pla
+        adc     #$12
+        ror     a
+        jmp     (L3456)
+
+        adc     L3456
+        ror     L3456
+        bbr6    $12,L70C5
+        .byte   $70
+L70C5:  brk
+        adc     ($12),y
+        adc     ($12)
+        stz     $12,x
+        adc     $12,x
+        ror     $12,x
+        rmb7    $12
+        sei
+        adc     L3456,y
+        ply
+        jmp     (L3456,x)
+        adc     L3456,x
+        ror     L3456,x
+        bbr7    $12,L70E4
+        .byte   $80
+L70E4:  brk
+        sta     ($12,x)
+        sty     $12
+        sta     $12
+        stx     $12
+        smb0    $12
+        dey
+        bit     #$12
+        txa
+        sty     L3456
+        sta     L3456
+        stx     L3456
+        bbs0    $12,L7100
+        .byte   $90
+L7100:  brk
+        sta     ($12),y
+        sta     ($12)
+        sty     $12,x
+        sta     $12,x
+        stx     $12,y
+        smb1    $12
+        tya
+        sta     L3456,y
+        txs
+        stz     L3456
+        sta     L3456,x
+        stz     L3456,x
+        bbs1    $12,L711F
+        .byte   $A0
+L711F:  ora     ($A1)
+        ora     ($A2)
+        ora     ($A4)
+        ora     ($A5)
+        ora     ($A6)
+        ora     ($A7)
+        ora     ($A8)
+        lda     #$12
+        tax
+        ldy     L3456
+        lda     L3456
+        ldx     L3456
+        bbs2    $12,L713D
+        .byte   $B0
+L713D:  brk
+        lda     ($12),y
+        lda     ($12)
+        ldy     $12,x
+        lda     $12,x
+        ldx     $12,y
+        smb3    $12
+        clv
+        lda     L3456,y
+        tsx
+        ldy     L3456,x
+        lda     L3456,x
+        ldx     L3456,y
+        bbs3    $12,L715C
+        .byte   $C0
+L715C:  ora     ($C1)
+        ora     ($C4)
+        ora     ($C5)
+        ora     ($C6)
+        ora     ($C7)
+        ora     ($C8)
+        cmp     #$12
+        dex
+        cpy     L3456
+        cmp     L3456
+        dec     L3456
+        bbs4    $12,L7178
+        .byte   $D0
+L7178:  brk
+        cmp     ($12),y
+        cmp     ($12)
+        cmp     $12,x
+        dec     $12,x
+        smb5    $12
+        cld
+        cmp     L3456,y
+        phx
+        cmp     L3456,x
+        dec     L3456,x
+        bbs5    $12,L7192
+        .byte   $E0
+L7192:  ora     ($E1)
+        ora     ($E4)
+        ora     ($E5)
+        ora     ($E6)
+        ora     ($E7)
+        ora     ($E8)
+        sbc     #$12
+        nop
+        cpx     L3456
+        sbc     L3456
+        inc     L3456
+        bbs6    $12,L71AE
+        .byte   $F0
+L71AE:  brk
+        sbc     ($12),y
+        sbc     ($12)
+        sbc     $12,x
+        inc     $12,x
+        smb7    $12
+        sed
+        sbc     L3456,y
+        plx
+        sbc     L3456,x
+        inc     L3456,x
+L71C4:  bbs7    $12,L71C4
+        nop
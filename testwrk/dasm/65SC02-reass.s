@@ -0,0 +1,191 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/65SC02-disass.bin
+; Page:       1
+
+
+        .setcpu "65SC02"
+
+L3456           := $3456
+        brk
+        ora     ($12,x)
+        tsb     $12
+        ora     $12
+        asl     $12
+        php
+        ora     #$12
+        asl     a
+        tsb     L3456
+        ora     L3456
+        asl     L3456
+        bpl     L7018
+L7018:  ora     ($12),y
+        ora     ($12)
+        trb     $12
+        ora     $12,x
+        asl     $12,x
+        clc
+        ora     L3456,y
+        inc     a
+        trb     L3456
+        ora     L3456,x
+        asl     L3456,x
+        jsr     L3456
+        and     ($12,x)
+        bit     $12
+        and     $12
+        rol     $12
+        plp
+        and     #$12
+        rol     a
+        bit     L3456
+        and     L3456
+        rol     L3456
+        bmi     L704A
+L704A:  and     ($12),y
+        and     ($12)
+        bit     $12,x
+        and     $12,x
+        rol     $12,x
+        sec
+        and     L3456,y
+        dec     a
+        bit     L3456,x
+        and     L3456,x
+        rol     L3456,x
+        rti
+
+        eor     ($12,x)
+        eor     $12
+        lsr     $12
+        pha
+        eor     #$12
+        lsr     a
+        jmp     L3456
+
+        eor     L3456
+        lsr     L3456
+        bvc     L7078
+L7078:  eor     ($12),y
+        eor     ($12)
+        eor     $12,x
+        lsr     $12,x
+        cli
+        eor     L3456,y
+        phy
+        eor     L3456,x
+        lsr     L3456,x
+        rts
+
+        adc     ($12,x)
+        stz     $12
+        adc     $12
+        ror     $12
+        pla
+        adc     #$12
+        ror     a
+        jmp     (L3456)
+
+        adc     L3456
+        ror     L3456
+        bvs     L70A3
+L70A3:  adc     ($12),y
+        adc     ($12)
+        stz     $12,x
+        adc     $12,x
+        ror     $12,x
+        sei
+        adc     L3456,y
+        ply
+        jmp     (L3456,x)
+        adc     L3456,x
+        ror     L3456,x
+        bra     L70BD
+L70BD:  sta     ($12,x)
+        sty     $12
+        sta     $12
+        stx     $12
+        dey
+        bit     #$12
+        txa
+        sty     L3456
+        sta     L3456
+        stx     L3456
+        bcc     L70D4
+L70D4:  sta     ($12),y
+        sta     ($12)
+        sty     $12,x
+        sta     $12,x
+        stx     $12,y
+        tya
+        sta     L3456,y
+        txs
+        stz     L3456
+        sta     L3456,x
+        stz     L3456,x
+        ldy     #$12
+        lda     ($12,x)
+        ldx     #$12
+        ldy     $12
+        lda     $12
+        ldx     $12
+        tay
+        lda     #$12
+        tax
+        ldy     L3456
+        lda     L3456
+        ldx     L3456
+        bcs     L7107
+L7107:  lda     ($12),y
+        lda     ($12)
+        ldy     $12,x
+        lda     $12,x
+        ldx     $12,y
+        clv
+        lda     L3456,y
+        tsx
+        ldy     L3456,x
+        lda     L3456,x
+        ldx     L3456,y
+        cpy     #$12
+        cmp     ($12,x)
+        cpy     $12
+        cmp     $12
+        dec     $12
+        iny
+        cmp     #$12
+        dex
+        cpy     L3456
+        cmp     L3456
+        dec     L3456
+        bne     L7138
+L7138:  cmp     ($12),y
+        cmp     ($12)
+        cmp     $12,x
+        dec     $12,x
+        cld
+        cmp     L3456,y
+        phx
+        cmp     L3456,x
+        dec     L3456,x
+        cpx     #$12
+        sbc     ($12,x)
+        cpx     $12
+        sbc     $12
+        inc     $12
+        inx
+        sbc     #$12
+        nop
+        cpx     L3456
+        sbc     L3456
+        inc     L3456
+        beq     L7164
+L7164:  sbc     ($12),y
+        sbc     ($12)
+        sbc     $12,x
+        inc     $12,x
+        sed
+        sbc     L3456,y
+        plx
+        sbc     L3456,x
+        inc     L3456,x
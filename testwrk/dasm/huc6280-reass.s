@@ -0,0 +1,246 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/huc6280-disass.bin
+; Page:       1
+
+
+        .setcpu "huc6280"
+
+L3456           := $3456
+        brk
+        ora     ($12,x)
+        sxy
+        st0     #$12
+        tsb     $12
+        ora     $12
+        asl     $12
+        rmb0    $12
+        php
+        ora     #$12
+        asl     a
+        tsb     L3456
+        ora     L3456
+        asl     L3456
+        bbr0    $12,L701E
+L701E:  bpl     L7020
+L7020:  ora     ($12),y
+        ora     ($12)
+        st1     #$12
+        trb     $12
+        ora     $12,x
+        asl     $12,x
+        rmb1    $12
+        clc
+        ora     L3456,y
+        inc     a
+        trb     L3456
+        ora     L3456,x
+        asl     L3456,x
+        bbr1    $12,L703F
+L703F:  jsr     L3456
+        and     ($12,x)
+        sax
+        st2     #$12
+        bit     $12
+        and     $12
+        rol     $12
+        rmb2    $12
+        plp
+        and     #$12
+        rol     a
+        bit     L3456
+        and     L3456
+        rol     L3456
+        bbr2    $12,L705F
+L705F:  bmi     L7061
+L7061:  and     ($12),y
+        and     ($12)
+        bit     $12,x
+        and     $12,x
+        rol     $12,x
+        rmb3    $12
+        sec
+        and     L3456,y
+        dec     a
+        bit     L3456,x
+        and     L3456,x
+        rol     L3456,x
+        bbr3    $12,L707E
+L707E:  rti
+
+        eor     ($12,x)
+        say
+        tma     #$02
+        bsr     L7086
+L7086:  eor     $12
+        lsr     $12
+        rmb4    $12
+        pha
+        eor     #$12
+        lsr     a
+        jmp     L3456
+
+        eor     L3456
+        lsr     L3456
+        bbr4    $12,L709C
+L709C:  bvc     L709E
+L709E:  eor     ($12),y
+        eor     ($12)
+        tam     #$12
+        csl
+        eor     $12,x
+        lsr     $12,x
+        rmb5    $12
+        cli
+        eor     L3456,y
+        phy
+        eor     L3456,x
+        lsr     L3456,x
+        bbr5    $12,L70B9
+L70B9:  rts
+
+        adc     ($12,x)
+        cla
+        stz     $12
+        adc     $12
+        ror     $12
+        rmb6    $12
+        pla
+        adc     #$12
+        ror     a
+        jmp     (L3456)
+
+        adc     L3456
+        ror     L3456
+        bbr6    $12,L70D5
+L70D5:  bvs     L70D7
+L70D7:  adc     ($12),y
+        adc     ($12)
+        tii     $3333,$7373,$1111
+        stz     $12,x
+        adc     $12,x
+        ror     $12,x
+        rmb7    $12
+        sei
+        adc     L3456,y
+        ply
+        jmp     (L3456,x)
+
+        adc     L3456,x
+        ror     L3456,x
+        bbr7    $12,L70FB
+L70FB:  bra     L70FD
+L70FD:  sta     ($12,x)
+        clx
+        tst     #$12,$EA
+        sty     $12
+        sta     $12
+        stx     $12
+        smb0    $12
+        dey
+        bit     #$12
+        txa
+        sty     L3456
+        sta     L3456
+        stx     L3456
+        bbs0    $12,L711B
+L711B:  bcc     L711D
+L711D:  sta     ($12),y
+        sta     ($12)
+        tst     #$12,$EAEA
+        sty     $12,x
+        sta     $12,x
+        stx     $12,y
+        smb1    $12
+        tya
+        sta     L3456,y
+        txs
+        stz     L3456
+        sta     L3456,x
+        stz     L3456,x
+        bbs1    $12,L713E
+L713E:  ldy     #$12
+        lda     ($12,x)
+        ldx     #$12
+        tst     #$12,$EA,x
+        ldy     $12
+        lda     $12
+        ldx     $12
+        smb2    $12
+        tay
+        lda     #$12
+        tax
+        ldy     L3456
+        lda     L3456
+        ldx     L3456
+        bbs2    $12,L715F
+L715F:  bcs     L7161
+L7161:  lda     ($12),y
+        lda     ($12)
+        tst     #$12,$EAEA,x
+        ldy     $12,x
+        lda     $12,x
+        ldx     $12,y
+        smb3    $12
+        clv
+        lda     L3456,y
+        tsx
+        ldy     L3456,x
+        lda     L3456,x
+        ldx     L3456,y
+        bbs3    $12,L7182
+L7182:  cpy     #$12
+        cmp     ($12,x)
+        cly
+        tdd     $3333,$C3C3,$1111
+        cpy     $12
+        cmp     $12
+        dec     $12
+        smb4    $12
+        iny
+        cmp     #$12
+        dex
+        cpy     L3456
+        cmp     L3456
+        dec     L3456
+        bbs4    $12,L71A6
+L71A6:  bne     L71A8
+L71A8:  cmp     ($12),y
+        cmp     ($12)
+        tin     $3333,$D3D3,$1111
+        cmp     $12,x
+        dec     $12,x
+        smb5    $12
+        cld
+        cmp     L3456,y
+        phx
+        cmp     L3456,x
+        dec     L3456,x
+        bbs5    $12,L71C7
+L71C7:  cpx     #$12
+        sbc     ($12,x)
+        tia     $3333,$E3E3,$1111
+        cpx     $12
+        sbc     $12
+        inc     $12
+        smb6    $12
+        inx
+        sbc     #$12
+        nop
+        cpx     L3456
+        sbc     L3456
+        inc     L3456
+        bbs6    $12,L71EA
+L71EA:  beq     L71EC
+L71EC:  sbc     ($12),y
+        sbc     ($12)
+        tai     $3333,$F3F3,$1111
+        sbc     $12,x
+        inc     $12,x
+        smb7    $12
+        sed
+        sbc     L3456,y
+        plx
+        sbc     L3456,x
+        inc     L3456,x
+L7208:  bbs7    $12,L7208
@@ -0,0 +1,799 @@
+; da65 V2.19 - Git 690def709
+; Created:    2026-10-19 10:21:01
+; Input file: ../../testwrk/dasm/m740-disass.bin
+; Page:       1
+
+
+        .setcpu "m740"
+
+L0012           := $0012
+L00EA           := $00EA
+L0212           := $0212
+LFF12           := $FF12
+        brk
+        clt
+        jsr     (L00EA)
+
+        ora     (L0012,x)
+        jsr     (L00EA)
+
+        jsr     (L0012)
+
+        jsr     (L00EA)
+
+        bbs0    a, L7021
+        jsr     (L00EA)
+
+        .byte   $04
+        clt
+        jsr     (L00EA)
+
+        ora     L0012
+        jsr     (L00EA)
+
+        asl     L0012
+        jsr     (L00EA)
+
+        bbs0    L0012, L7021
+        nop
+        php
+L7021:  clt
+        jsr     (L00EA)
+
+        ora     #$12
+        jsr     (L00EA)
+
+        asl     a
+        clt
+        jsr     (L00EA)
+
+        seb0    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $0C
+        clt
+        jsr     (L00EA)
+
+        ora     L0212
+        nop
+        asl     L0212
+        nop
+        seb0    L0012
+        jsr     (L00EA)
+
+        bpl     L7054
+        jsr     (L00EA)
+
+        ora     (L0012),y
+        jsr     (L00EA)
+
+        clt
+        clt
+        jsr     (L00EA)
+
+        bbc0    a, L7061
+        jsr     (L00EA)
+
+        .byte   $14
+        clt
+        jsr     (L00EA)
+
+L7054:  ora     L0012,x
+        jsr     (L00EA)
+
+        asl     L0012,x
+        jsr     (L00EA)
+
+        bbc0    L0012, L7061
+        nop
+        clc
+L7061:  clt
+        jsr     (L00EA)
+
+        ora     L0212,y
+        nop
+        inc     a
+        clt
+        jsr     (L00EA)
+
+        clb0    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $1C
+        clt
+        jsr     (L00EA)
+
+        ora     L0212,x
+        nop
+        asl     L0212,x
+        nop
+        clb0    L0012
+        jsr     (L00EA)
+
+        jsr     L0212
+        nop
+        and     (L0012,x)
+        jsr     (L00EA)
+
+        jsr     LFF12
+        jsr     (L00EA)
+
+        bbs1    a, L70A1
+        jsr     (L00EA)
+
+        bit     L0012
+        jsr     (L00EA)
+
+        and     L0012
+        jsr     (L00EA)
+
+        rol     L0012
+        jsr     (L00EA)
+
+        bbs1    L0012, L70A1
+        nop
+        plp
+L70A1:  clt
+        jsr     (L00EA)
+
+        and     #$12
+        jsr     (L00EA)
+
+        rol     a
+        clt
+        jsr     (L00EA)
+
+        seb1    a
+        clt
+        jsr     (L00EA)
+
+        bit     L0212
+        nop
+        and     L0212
+        nop
+        rol     L0212
+        nop
+        seb1    L0012
+        jsr     (L00EA)
+
+        bmi     L70D4
+        jsr     (L00EA)
+
+        and     (L0012),y
+        jsr     (L00EA)
+
+        set
+        clt
+        jsr     (L00EA)
+
+        bbc1    a, L70E1
+        jsr     (L00EA)
+
+        .byte   $34
+        clt
+        jsr     (L00EA)
+
+L70D4:  and     L0012,x
+        jsr     (L00EA)
+
+        rol     L0012,x
+        jsr     (L00EA)
+
+        bbc1    L0012, L70E1
+        nop
+        sec
+L70E1:  clt
+        jsr     (L00EA)
+
+        and     L0212,y
+        nop
+        dec     a
+        clt
+        jsr     (L00EA)
+
+        clb1    a
+        clt
+        jsr     (L00EA)
+
+        ldm     L0012, #$02
+        nop
+        and     L0212,x
+        nop
+        rol     L0212,x
+        nop
+        clb1    L0012
+        jsr     (L00EA)
+
+        rti
+
+        clt
+        jsr     (L00EA)
+
+        eor     (L0012,x)
+        jsr     (L00EA)
+
+        stp
+        clt
+        jsr     (L00EA)
+
+        bbs2    a, L7121
+        jsr     (L00EA)
+
+        com     L0012
+        jsr     (L00EA)
+
+        eor     L0012
+        jsr     (L00EA)
+
+        lsr     L0012
+        jsr     (L00EA)
+
+        bbs2    L0012, L7121
+        nop
+        pha
+L7121:  clt
+        jsr     (L00EA)
+
+        eor     #$12
+        jsr     (L00EA)
+
+        lsr     a
+        clt
+        jsr     (L00EA)
+
+        seb2    a
+        clt
+        jsr     (L00EA)
+
+        jmp     L0212
+
+        nop
+        eor     L0212
+        nop
+        lsr     L0212
+        nop
+        seb2    L0012
+        jsr     (L00EA)
+
+        bvc     L7154
+        jsr     (L00EA)
+
+        eor     (L0012),y
+        jsr     (L00EA)
+
+        .byte   $52
+        clt
+        jsr     (L00EA)
+
+        bbc2    a, L7161
+        jsr     (L00EA)
+
+        .byte   $54
+        clt
+        jsr     (L00EA)
+
+L7154:  eor     L0012,x
+        jsr     (L00EA)
+
+        lsr     L0012,x
+        jsr     (L00EA)
+
+        bbc2    L0012, L7161
+        nop
+        cli
+L7161:  clt
+        jsr     (L00EA)
+
+        eor     L0212,y
+        nop
+        .byte   $5A
+        clt
+        jsr     (L00EA)
+
+        clb2    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $5C
+        clt
+        jsr     (L00EA)
+
+        eor     L0212,x
+        nop
+        lsr     L0212,x
+        nop
+        clb2    L0012
+        jsr     (L00EA)
+
+        rts
+
+        clt
+        jsr     (L00EA)
+
+        adc     (L0012,x)
+        jsr     (L00EA)
+
+        .byte   $62
+        clt
+        jsr     (L00EA)
+
+        bbs3    a, L71A1
+        jsr     (L00EA)
+
+        tst     L0012
+        jsr     (L00EA)
+
+        adc     L0012
+        jsr     (L00EA)
+
+        ror     L0012
+        jsr     (L00EA)
+
+        bbs3    L0012, L71A1
+        nop
+        pla
+L71A1:  clt
+        jsr     (L00EA)
+
+        adc     #$12
+        jsr     (L00EA)
+
+        ror     a
+        clt
+        jsr     (L00EA)
+
+        seb3    a
+        clt
+        jsr     (L00EA)
+
+        jmp     (L0212)
+
+        nop
+        adc     L0212
+        nop
+        ror     L0212
+        nop
+        seb3    L0012
+        jsr     (L00EA)
+
+        bvs     L71D4
+        jsr     (L00EA)
+
+        adc     (L0012),y
+        jsr     (L00EA)
+
+        .byte   $72
+        clt
+        jsr     (L00EA)
+
+        bbc3    a, L71E1
+        jsr     (L00EA)
+
+        .byte   $74
+        clt
+        jsr     (L00EA)
+
+L71D4:  adc     L0012,x
+        jsr     (L00EA)
+
+        ror     L0012,x
+        jsr     (L00EA)
+
+        bbc3    L0012, L71E1
+        nop
+        sei
+L71E1:  clt
+        jsr     (L00EA)
+
+        adc     L0212,y
+        nop
+        .byte   $7A
+        clt
+        jsr     (L00EA)
+
+        clb3    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $7C
+        clt
+        jsr     (L00EA)
+
+        adc     L0212,x
+        nop
+        ror     L0212,x
+        nop
+        clb3    L0012
+        jsr     (L00EA)
+
+        bra     L7214
+        jsr     (L00EA)
+
+        sta     (L0012,x)
+        jsr     (L00EA)
+
+        rrf     L0012
+        jsr     (L00EA)
+
+        bbs4    a, L7221
+        jsr     (L00EA)
+
+        sty     L0012
+        jsr     (L00EA)
+
+L7214:  sta     L0012
+        jsr     (L00EA)
+
+        stx     L0012
+        jsr     (L00EA)
+
+        bbs4    L0012, L7221
+        nop
+        dey
+L7221:  clt
+        jsr     (L00EA)
+
+        .byte   $89
+        clt
+        jsr     (L00EA)
+
+        txa
+        clt
+        jsr     (L00EA)
+
+        seb4    a
+        clt
+        jsr     (L00EA)
+
+        sty     L0212
+        nop
+        sta     L0212
+        nop
+        stx     L0212
+        nop
+        seb4    L0012
+        jsr     (L00EA)
+
+        bcc     L7254
+        jsr     (L00EA)
+
+        sta     (L0012),y
+        jsr     (L00EA)
+
+        .byte   $92
+        clt
+        jsr     (L00EA)
+
+        bbc4    a, L7261
+        jsr     (L00EA)
+
+        sty     L0012,x
+        jsr     (L00EA)
+
+L7254:  sta     L0012,x
+        jsr     (L00EA)
+
+        stx     L0012,y
+        jsr     (L00EA)
+
+        bbc4    L0012, L7261
+        nop
+        tya
+L7261:  clt
+        jsr     (L00EA)
+
+        sta     L0212,y
+        nop
+        txs
+        clt
+        jsr     (L00EA)
+
+        clb4    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $9C
+        clt
+        jsr     (L00EA)
+
+        sta     L0212,x
+        nop
+        .byte   $9E
+        clt
+        jsr     (L00EA)
+
+        clb4    L0012
+        jsr     (L00EA)
+
+        ldy     #$12
+        jsr     (L00EA)
+
+        lda     (L0012,x)
+        jsr     (L00EA)
+
+        ldx     #$12
+        jsr     (L00EA)
+
+        bbs5    a, L72A1
+        jsr     (L00EA)
+
+        ldy     L0012
+        jsr     (L00EA)
+
+        lda     L0012
+        jsr     (L00EA)
+
+        ldx     L0012
+        jsr     (L00EA)
+
+        bbs5    L0012, L72A1
+        nop
+        tay
+L72A1:  clt
+        jsr     (L00EA)
+
+        lda     #$12
+        jsr     (L00EA)
+
+        tax
+        clt
+        jsr     (L00EA)
+
+        seb5    a
+        clt
+        jsr     (L00EA)
+
+        ldy     L0212
+        nop
+        lda     L0212
+        nop
+        ldx     L0212
+        nop
+        seb5    L0012
+        jsr     (L00EA)
+
+        bcs     L72D4
+        jsr     (L00EA)
+
+        lda     (L0012),y
+        jsr     (L00EA)
+
+        jmp     (L0012)
+
+        jsr     (L00EA)
+
+        bbc5    a, L72E1
+        jsr     (L00EA)
+
+        ldy     L0012,x
+        jsr     (L00EA)
+
+L72D4:  lda     L0012,x
+        jsr     (L00EA)
+
+        ldx     L0012,y
+        jsr     (L00EA)
+
+        bbc5    L0012, L72E1
+        nop
+        clv
+L72E1:  clt
+        jsr     (L00EA)
+
+        lda     L0212,y
+        nop
+        tsx
+        clt
+        jsr     (L00EA)
+
+        clb5    a
+        clt
+        jsr     (L00EA)
+
+        ldy     L0212,x
+        nop
+        lda     L0212,x
+        nop
+        ldx     L0212,y
+        nop
+        clb5    L0012
+        jsr     (L00EA)
+
+        cpy     #$12
+        jsr     (L00EA)
+
+        cmp     (L0012,x)
+        jsr     (L00EA)
+
+        slw
+        clt
+        jsr     (L00EA)
+
+        bbs6    a, L7321
+        jsr     (L00EA)
+
+        cpy     L0012
+        jsr     (L00EA)
+
+        cmp     L0012
+        jsr     (L00EA)
+
+        dec     L0012
+        jsr     (L00EA)
+
+        bbs6    L0012, L7321
+        nop
+        iny
+L7321:  clt
+        jsr     (L00EA)
+
+        cmp     #$12
+        jsr     (L00EA)
+
+        dex
+        clt
+        jsr     (L00EA)
+
+        seb6    a
+        clt
+        jsr     (L00EA)
+
+        cpy     L0212
+        nop
+        cmp     L0212
+        nop
+        dec     L0212
+        nop
+        seb6    L0012
+        jsr     (L00EA)
+
+        bne     L7354
+        jsr     (L00EA)
+
+        cmp     (L0012),y
+        jsr     (L00EA)
+
+        .byte   $D2
+        clt
+        jsr     (L00EA)
+
+        bbc6    a, L7361
+        jsr     (L00EA)
+
+        .byte   $D4
+        clt
+        jsr     (L00EA)
+
+L7354:  cmp     L0012,x
+        jsr     (L00EA)
+
+        dec     L0012,x
+        jsr     (L00EA)
+
+        bbc6    L0012, L7361
+        nop
+        cld
+L7361:  clt
+        jsr     (L00EA)
+
+        cmp     L0212,y
+        nop
+        .byte   $DA
+        clt
+        jsr     (L00EA)
+
+        clb6    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $DC
+        clt
+        jsr     (L00EA)
+
+        cmp     L0212,x
+        nop
+        dec     L0212,x
+        nop
+        clb6    L0012
+        jsr     (L00EA)
+
+        cpx     #$12
+        jsr     (L00EA)
+
+        sbc     (L0012,x)
+        jsr     (L00EA)
+
+        fst
+        clt
+        jsr     (L00EA)
+
+        bbs7    a, L73A1
+        jsr     (L00EA)
+
+        cpx     L0012
+        jsr     (L00EA)
+
+        sbc     L0012
+        jsr     (L00EA)
+
+        inc     L0012
+        jsr     (L00EA)
+
+        bbs7    L0012, L73A1
+        nop
+        inx
+L73A1:  clt
+        jsr     (L00EA)
+
+        sbc     #$12
+        jsr     (L00EA)
+
+        nop
+        clt
+        jsr     (L00EA)
+
+        seb7    a
+        clt
+        jsr     (L00EA)
+
+        cpx     L0212
+        nop
+        sbc     L0212
+        nop
+        inc     L0212
+        nop
+        seb7    L0012
+        jsr     (L00EA)
+
+        beq     L73D4
+        jsr     (L00EA)
+
+        sbc     (L0012),y
+        jsr     (L00EA)
+
+        .byte   $F2
+        clt
+        jsr     (L00EA)
+
+        bbc7    a, L73E1
+        jsr     (L00EA)
+
+        .byte   $F4
+        clt
+        jsr     (L00EA)
+
+L73D4:  sbc     L0012,x
+        jsr     (L00EA)
+
+        inc     L0012,x
+        jsr     (L00EA)
+
+        bbc7    L0012, L73E1
+        nop
+        sed
+L73E1:  clt
+        jsr     (L00EA)
+
+        sbc     L0212,y
+        nop
+        .byte   $FA
+        clt
+        jsr     (L00EA)
+
+        clb7    a
+        clt
+        jsr     (L00EA)
+
+        .byte   $FC
+        clt
+        jsr     (L00EA)
+
+        sbc     L0212,x
+        nop
+        inc     L0212,x
+        nop
+        clb7    L0012
+        jsr     (L00EA)
+
@@ -0,0 +1,125 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug1209-ind-goto-rev-2.c", 1557, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$00
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$46,$41,$49,$4C,$0A,$00
+S0001:
+	.byte	$50,$41,$53,$53,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", static, "_f"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 33
+	lda     _y
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 36
+L0003:	ldx     #$00
+	lda     #$01
+	sta     _y
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 37
+	ldy     #$00
+	lda     M0002,y
+	ldx     M0002+1,y
+	jmp     callax
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 39
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0002:
+	.addr	L0002
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 45
+	jsr     _f
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 47
+L0002:	ldx     #$00
+	lda     _failures
+	cmp     #$00
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 48
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 49
+	jmp     L0005
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 50
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 53
+L0005:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1209-ind-goto-rev-2.c", 54
+L0001:	rts
+
+	.dbg	line
+.endproc
+
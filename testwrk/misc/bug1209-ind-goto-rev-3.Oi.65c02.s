@@ -0,0 +1,91 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$00
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$46,$41,$49,$4C,$0A,$00
+S0001:
+	.byte	$50,$41,$53,$53,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	lda     _y
+	beq     L0003
+	ldx     #$00
+	txa
+	rts
+L0003:	ina
+	sta     _y
+	ldx     #$00
+	jmp     (.loword(M0001),x)
+
+.segment	"RODATA"
+
+M0001:
+	.addr	L0002
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	beq     L0002
+L0007:	inc     _failures
+L0002:	lda     _failures
+	bne     L0004
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	bra     L0009
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+L0009:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,273 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_puts
+	.import		_sprintf
+	.import		_strcmp
+	.export		_failures
+	.export		_str1
+	.export		_str2
+	.export		_f2
+	.export		_main
+	.export		_f1
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$66,$31,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0008:
+	.byte	$66,$32,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0007:
+	.byte	$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$00
+S0003	:=	S0007+0
+S0006:
+	.byte	$25,$70,$0A,$00
+S0002	:=	S0006+0
+S0005	:=	S0006+0
+S0001	:=	S0006+0
+
+.segment	"BSS"
+
+_str1:
+	.res	10,$00
+_str2:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$09
+	bne     L0003
+	lda     (c_sp)
+	cmp     #$29
+	bne     L0003
+	ldx     #$00
+	lda     #$17
+	jmp     incsp2
+L0003:	ldx     #$FF
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	lda     #<(_str1)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_str1)
+	sta     (c_sp),y
+	lda     #<(S0001)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0001)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0002
+	inx
+L0002:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$04
+	lda     #$D2
+	ldy     #$02
+	jsr     staxysp
+	jsr     _f1
+	jsr     stax0sp
+	jsr     decsp4
+	lda     #<(_str2)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_str2)
+	sta     (c_sp),y
+	lda     #<(S0002)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0002)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0003
+	inx
+L0003:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _puts
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	bne     L0010
+	lda     (c_sp)
+	cmp     #$2A
+	beq     L0008
+L0010:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _puts
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	jsr     decsp4
+	lda     #<(_str1)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_str1)
+	sta     (c_sp),y
+	lda     #<(S0005)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0005)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0009
+	inx
+L0009:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$09
+	lda     #$29
+	ldy     #$02
+	jsr     staxysp
+	jsr     _f2
+	jsr     stax0sp
+	jsr     decsp4
+	lda     #<(_str2)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_str2)
+	sta     (c_sp),y
+	lda     #<(S0006)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0006)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L000A
+	inx
+L000A:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _puts
+	inc     _failures
+	bne     L000C
+	inc     _failures+1
+L000C:	ldy     #$01
+	lda     (c_sp),y
+	bne     L0011
+	lda     (c_sp)
+	cmp     #$17
+	beq     L000F
+L0011:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _puts
+	inc     _failures
+	bne     L000F
+	inc     _failures+1
+L000F:	lda     _failures
+	ldx     _failures+1
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$04
+	bne     L0003
+	lda     (c_sp)
+	cmp     #$D2
+	bne     L0003
+	ldx     #$00
+	lda     #$2A
+	jmp     incsp2
+L0003:	ldx     #$FF
+	txa
+	jmp     incsp2
+
+.endproc
+
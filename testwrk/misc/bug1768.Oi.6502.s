@@ -0,0 +1,611 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test_1
+	.export		_test_2
+	.export		_test_3
+	.export		_test_4
+	.export		_test_5
+	.export		_test_6
+	.export		_test_7
+	.export		_test_8
+	.export		_main
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$6B,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65
+	.byte	$64,$3A,$20,$25,$6C,$64,$0A,$00
+S000B	:=	S0008+0
+S000D:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0005:
+	.byte	$61,$63,$63,$20,$3D,$20,$25,$64,$0A,$00
+S0006	:=	S0005+0
+S0004	:=	S0005+0
+S0002	:=	S0005+0
+S0009	:=	S0005+0
+S000C	:=	S0005+0
+S0003	:=	S0005+0
+S0001	:=	S0005+0
+S0007:
+	.byte	$25,$75,$0A,$00
+S000A	:=	S0007+0
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_1: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_2: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0002
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_3: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0002
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_4: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_5: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0007
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0007
+	inc     _failures+1
+L0007:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_6: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0007
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0007
+	inc     _failures+1
+L0007:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_7: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	ora     #$01
+	ldy     #$04
+	jsr     steaxysp
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	ora     #$02
+	ldy     #$04
+	jsr     steaxysp
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	tax
+	jsr     tosandeax
+	stx     sreg+1
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     steax0sp
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+L0002:	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0003
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_8: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	ora     #$03
+	ldy     #$04
+	jsr     steaxysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	ora     #$04
+	ldy     #$04
+	jsr     steaxysp
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	tax
+	jsr     tosandeax
+	stx     sreg+1
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     pusheax
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	dex
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	jsr     tosoreax
+	ldy     #$04
+	jsr     steaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	tax
+	jsr     tosandeax
+	jsr     steax0sp
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$04
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$04
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+L0002:	jsr     push0
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldx     #$00
+	txa
+	jsr     addeq0sp
+	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L0003
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_1
+	jsr     _test_2
+	jsr     _test_3
+	jsr     _test_4
+	jsr     _test_5
+	jsr     _test_6
+	jsr     _test_7
+	jsr     _test_8
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	rts
+
+.endproc
+
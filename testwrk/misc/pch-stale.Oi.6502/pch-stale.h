@@ -0,0 +1 @@
+#define STALE_VALUE 2
@@ -0,0 +1,40 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "pch-stale.c", 349, 1792402247
+	.dbg		file, "../../testwrk/misc/pch-stale.g.6502/pch-stale.h", 22, 1792402247
+	.forceimport	__STARTUP__
+	.export		_main
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "pch-stale.c", 11
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "pch-stale.c", 12
+L0001:	rts
+
+	.dbg	line
+.endproc
+
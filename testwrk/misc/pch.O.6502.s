@@ -0,0 +1,469 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_names
+	.export		_add
+	.export		_sum
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0003
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_names:
+	.byte	$6F,$6E,$65,$00
+	.byte	$74,$77,$6F,$00
+	.byte	$73,$69,$78,$00
+S0004:
+	.byte	$25,$73,$3A,$20,$67,$6F,$74,$20,$25,$6C,$64,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$25,$6C,$64,$0A,$00
+S0014:
+	.byte	$25,$75,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$0A,$00
+S0013:
+	.byte	$49,$4E,$43,$5F,$56,$41,$4C,$55,$45,$00
+S0011:
+	.byte	$63,$6F,$75,$6E,$74,$65,$72,$00
+S000C:
+	.byte	$53,$51,$55,$41,$52,$45,$00
+S000B:
+	.byte	$73,$69,$7A,$65,$6F,$66,$00
+S0009:
+	.byte	$67,$65,$74,$74,$65,$72,$00
+S0012:
+	.byte	$73,$74,$72,$6C,$65,$6E,$00
+S000D:
+	.byte	$46,$49,$52,$53,$54,$00
+S000A:
+	.byte	$65,$6E,$75,$6D,$00
+S0006:
+	.byte	$61,$2E,$62,$00
+S0007:
+	.byte	$61,$2E,$63,$00
+S000E:
+	.byte	$45,$4F,$46,$00
+S000F:
+	.byte	$61,$64,$64,$00
+S0010:
+	.byte	$73,$75,$6D,$00
+S0005:
+	.byte	$61,$2E,$61,$00
+S0008:
+	.byte	$6F,$2E,$7A,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ sum (int n, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	jsr     push0
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0004
+L0002:	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jsr     addeq0sp
+L0004:	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	jsr     decax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     regsave
+	ora     regsave+1
+	bne     L0002
+	jsr     ldax0sp
+	ldy     #$04
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getx (const struct point *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getx: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	jsr     ldax0sp
+	ldy     #$06
+	jsr     ldaxidx
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *what, long got, long expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+	inc     _failures
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(_getx)
+	ldx     #>(_getx)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$10
+	lda     (c_sp),y
+	and     #$F8
+	ora     #$05
+	sta     (c_sp),y
+	and     #$07
+	ora     #$88
+	sta     (c_sp),y
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	ldy     #$0A
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$03
+	jsr     staxysp
+	txa
+	ldy     #$05
+	jsr     staxysp
+	lda     #$03
+	ldy     #$08
+	jsr     staxysp
+	lda     #$78
+	ldy     #$07
+	sta     (c_sp),y
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$12
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$07
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$05
+	jsr     _check
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$12
+	lda     (c_sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$11
+	jsr     _check
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	jsr     _check
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$06
+	jsr     pushwysp
+	lda     #$07
+	jsr     leaa0sp
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     _check
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     axulong
+	jsr     pusheax
+	txa
+	sta     sreg+1
+	sta     sreg
+	lda     #$06
+	jsr     _check
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$07
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$09
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$04
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	lda     #$FE
+	ldx     #$FF
+	jsr     pusheax
+	jsr     _check
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     _add
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     pusha0
+	lda     #$03
+	jsr     pusha0
+	ldy     #$08
+	jsr     _sum
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$06
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _counter
+	ldx     _counter+1
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_names+4)
+	ldx     #>(_names+4)
+	jsr     _strlen
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$02
+	ldx     #$00
+	jsr     push0ax
+	jsr     _check
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
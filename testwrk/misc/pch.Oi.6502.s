@@ -0,0 +1,636 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_names
+	.export		_add
+	.export		_sum
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0003
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_names:
+	.byte	$6F,$6E,$65,$00
+	.byte	$74,$77,$6F,$00
+	.byte	$73,$69,$78,$00
+S0004:
+	.byte	$25,$73,$3A,$20,$67,$6F,$74,$20,$25,$6C,$64,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$25,$6C,$64,$0A,$00
+S0014:
+	.byte	$25,$75,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$0A,$00
+S0013:
+	.byte	$49,$4E,$43,$5F,$56,$41,$4C,$55,$45,$00
+S0011:
+	.byte	$63,$6F,$75,$6E,$74,$65,$72,$00
+S000C:
+	.byte	$53,$51,$55,$41,$52,$45,$00
+S000B:
+	.byte	$73,$69,$7A,$65,$6F,$66,$00
+S0009:
+	.byte	$67,$65,$74,$74,$65,$72,$00
+S0012:
+	.byte	$73,$74,$72,$6C,$65,$6E,$00
+S000D:
+	.byte	$46,$49,$52,$53,$54,$00
+S000A:
+	.byte	$65,$6E,$75,$6D,$00
+S0006:
+	.byte	$61,$2E,$62,$00
+S0007:
+	.byte	$61,$2E,$63,$00
+S000E:
+	.byte	$45,$4F,$46,$00
+S000F:
+	.byte	$61,$64,$64,$00
+S0010:
+	.byte	$73,$75,$6D,$00
+S0005:
+	.byte	$61,$2E,$61,$00
+S0008:
+	.byte	$6F,$2E,$7A,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	ldy     #$00
+	clc
+	adc     (c_sp),y
+	pha
+	ldy     #$03
+	lda     (c_sp),y
+	ldy     #$01
+	adc     (c_sp),y
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ sum (int n, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	jsr     push0
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$03
+	bcc     L0002
+	inx
+L0002:	ldy     #$02
+	jsr     staxysp
+	jmp     L0005
+L0003:	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     addeq0sp
+L0005:	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$03
+	bcc     L0006
+	inx
+L0006:	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regsave
+	stx     regsave+1
+	sec
+	sbc     #$01
+	bcs     L0008
+	dex
+L0008:	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     regsave
+	ora     regsave+1
+	bne     L0003
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$04
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getx (const struct point *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getx: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	iny
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$06
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *what, long got, long expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+	inc     _failures
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(_getx)
+	ldx     #>(_getx)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha
+	ldy     #$0E
+	lda     #$01
+	sta     (c_sp),y
+	lda     #$00
+	iny
+	sta     (c_sp),y
+	iny
+	lda     (c_sp),y
+	and     #$F8
+	ora     #$05
+	sta     (c_sp),y
+	and     #$07
+	ora     #$88
+	sta     (c_sp),y
+	ldy     #$0A
+	lda     #$70
+	sta     (c_sp),y
+	lda     #$11
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	iny
+	sta     (c_sp),y
+	lda     #$00
+	iny
+	sta     (c_sp),y
+	ldy     #$03
+	lda     #$02
+	sta     (c_sp),y
+	lda     #$00
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$08
+	lda     #$03
+	sta     (c_sp),y
+	lda     #$00
+	iny
+	sta     (c_sp),y
+	lda     #$78
+	ldy     #$07
+	sta     (c_sp),y
+	jsr     decsp6
+	lda     #<(S0005)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0005)
+	sta     (c_sp),y
+	ldy     #$15
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0006)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0006)
+	sta     (c_sp),y
+	ldy     #$16
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$07
+	stx     sreg
+	stx     sreg+1
+	jsr     steax0sp
+	lda     #$05
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0007)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0007)
+	sta     (c_sp),y
+	ldy     #$16
+	lda     (c_sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	jsr     steax0sp
+	lda     #$11
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0008)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0008)
+	sta     (c_sp),y
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0009)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0009)
+	sta     (c_sp),y
+	ldy     #$0A
+	jsr     pushwysp
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$0B
+	bcc     L0002
+	inx
+L0002:	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     axlong
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000A)
+	sta     (c_sp),y
+	iny
+	ldx     #$00
+	lda     (c_sp),y
+	stx     sreg
+	stx     sreg+1
+	jsr     steax0sp
+	lda     #$06
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000B)
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$07
+	sta     (c_sp),y
+	tya
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     sreg+1
+	sta     sreg
+	lda     #$07
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000C)
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$09
+	sta     (c_sp),y
+	tya
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     sreg+1
+	sta     sreg
+	lda     #$09
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000D)
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$04
+	sta     (c_sp),y
+	tya
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000E)
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$FE
+	sta     (c_sp),y
+	lda     #$FF
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     sreg+1
+	sta     sreg
+	lda     #$FE
+	ldx     #$FF
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S000F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000F)
+	sta     (c_sp),y
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     _add
+	jsr     axlong
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0010)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0010)
+	sta     (c_sp),y
+	lda     #$03
+	jsr     pusha0
+	lda     #$01
+	jsr     pusha0
+	lda     #$02
+	jsr     pusha0
+	lda     #$03
+	jsr     pusha0
+	ldy     #$08
+	jsr     _sum
+	jsr     axlong
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$06
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0011)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0011)
+	sta     (c_sp),y
+	lda     _counter
+	ldx     _counter+1
+	jsr     axlong
+	jsr     steax0sp
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0012)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0012)
+	sta     (c_sp),y
+	lda     #<(_names+4)
+	ldx     #>(_names+4)
+	jsr     _strlen
+	ldy     #$00
+	sty     sreg
+	sty     sreg+1
+	jsr     steax0sp
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	jsr     decsp6
+	lda     #<(S0013)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0013)
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$02
+	sta     (c_sp),y
+	tya
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     sreg+1
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     _check
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,633 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "pch.c", 1924, 1792400286
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.dbg		file, "pch-inc.h", 259, 1792400286
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_names
+	.export		_add
+	.export		_sum
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0003
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_names:
+	.byte	$6F,$6E,$65,$00
+	.byte	$74,$77,$6F,$00
+	.byte	$73,$69,$78,$00
+S0004:
+	.byte	$25,$73,$3A,$20,$67,$6F,$74,$20,$25,$6C,$64,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$25,$6C,$64,$0A,$00
+S0014:
+	.byte	$25,$75,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$0A,$00
+S0013:
+	.byte	$49,$4E,$43,$5F,$56,$41,$4C,$55,$45,$00
+S0011:
+	.byte	$63,$6F,$75,$6E,$74,$65,$72,$00
+S000C:
+	.byte	$53,$51,$55,$41,$52,$45,$00
+S000B:
+	.byte	$73,$69,$7A,$65,$6F,$66,$00
+S0009:
+	.byte	$67,$65,$74,$74,$65,$72,$00
+S0012:
+	.byte	$73,$74,$72,$6C,$65,$6E,$00
+S000D:
+	.byte	$46,$49,$52,$53,$54,$00
+S000A:
+	.byte	$65,$6E,$75,$6D,$00
+S0006:
+	.byte	$61,$2E,$62,$00
+S0007:
+	.byte	$61,$2E,$63,$00
+S000E:
+	.byte	$45,$4F,$46,$00
+S000F:
+	.byte	$61,$64,$64,$00
+S0010:
+	.byte	$73,$75,$6D,$00
+S0005:
+	.byte	$61,$2E,$61,$00
+S0008:
+	.byte	$6F,$2E,$7A,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+	.dbg	func, "add", "00", static, "_add"
+	.dbg	sym, "a", "00", auto, 2
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 26
+	jsr     pushax
+	.dbg	line, "pch.c", 27
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "pch.c", 28
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ sum (int n, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+	.dbg	func, "sum", "00", static, "_sum"
+	.dbg	sym, "n", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "ap", "00", auto, -2
+	.dbg	sym, "s", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 31
+	jsr     enter
+	.dbg	line, "pch.c", 33
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "pch.c", 34
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "pch.c", 35
+	jmp     L0004
+	.dbg	line, "pch.c", 36
+L0002:	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     addeqysp
+	.dbg	line, "pch.c", 35
+L0004:	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	jsr     decax1
+	ldy     #$00
+	jsr     staxspidx
+	lda     regsave
+	ldx     regsave+1
+	stx     tmp1
+	ora     tmp1
+	jne     L0002
+	.dbg	line, "pch.c", 39
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "pch.c", 40
+L0001:	ldy     #$04
+	jsr     leavey
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getx (const struct point *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getx: near
+
+	.dbg	func, "getx", "00", static, "_getx"
+	.dbg	sym, "p", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 43
+	jsr     pushax
+	.dbg	line, "pch.c", 44
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     ldaxidx
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "pch.c", 45
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *what, long got, long expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+	.dbg	func, "check", "00", static, "_check"
+	.dbg	sym, "what", "00", auto, 8
+	.dbg	sym, "got", "00", auto, 4
+	.dbg	sym, "expected", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 48
+	jsr     pusheax
+	.dbg	line, "pch.c", 49
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "pch.c", 50
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "pch.c", 51
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "pch.c", 53
+L0002:	ldy     #$0A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "a", "00", auto, -3
+	.dbg	sym, "o", "00", auto, -7
+	.dbg	sym, "p", "00", auto, -14
+	.dbg	sym, "g", "00", auto, -16
+	.dbg	sym, "c", "00", auto, -17
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 60
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(_getx)
+	ldx     #>(_getx)
+	jsr     pushax
+	.dbg	line, "pch.c", 61
+	lda     #$06
+	jsr     pusha
+	.dbg	line, "pch.c", 63
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "pch.c", 64
+	ldy     #$10
+	lda     (c_sp),y
+	and     #$F8
+	ora     #$05
+	ldy     #$10
+	sta     (c_sp),y
+	.dbg	line, "pch.c", 65
+	ldy     #$10
+	lda     (c_sp),y
+	and     #$07
+	ora     #$88
+	ldy     #$10
+	sta     (c_sp),y
+	.dbg	line, "pch.c", 66
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	ldy     #$0A
+	jsr     steaxysp
+	.dbg	line, "pch.c", 67
+	ldx     #$00
+	lda     #$02
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "pch.c", 68
+	ldx     #$00
+	lda     #$00
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "pch.c", 69
+	ldx     #$00
+	lda     #$03
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "pch.c", 70
+	ldx     #$00
+	lda     #$78
+	ldy     #$07
+	sta     (c_sp),y
+	.dbg	line, "pch.c", 72
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 73
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$12
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$07
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 74
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$12
+	lda     (c_sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$11
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 75
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$70
+	ldx     #$11
+	jsr     _check
+	.dbg	line, "pch.c", 76
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$07
+	jsr     leaa0sp
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 77
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$06
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 78
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$07
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$07
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 79
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$09
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$09
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 80
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 81
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FE
+	ldx     #$FF
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FE
+	ldx     #$FF
+	jsr     _check
+	.dbg	line, "pch.c", 82
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     _add
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 83
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$08
+	jsr     _sum
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$06
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 84
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _counter
+	ldx     _counter+1
+	jsr     axlong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 85
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_names+4)
+	ldx     #>(_names+4)
+	jsr     _strlen
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 86
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     _check
+	.dbg	line, "pch.c", 88
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "pch.c", 89
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "pch.c", 90
+L0001:	rts
+
+	.dbg	line
+.endproc
+
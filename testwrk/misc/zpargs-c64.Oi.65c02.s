@@ -0,0 +1,135 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_buf
+	.export		_get
+	.export		_put
+	.export		_add
+	.export		_main
+
+.segment	"BSS"
+
+_buf:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __attribute__ ((zpargs)) get (const unsigned char *p, unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     zpargs+0+1
+	sta     ptr1+1
+	lda     zpargs+0
+	sta     ptr1
+	ldy     #$00
+	lda     (c_sp),y
+	tay
+	ldx     #$00
+	lda     (ptr1),y
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __attribute__ ((zpargs)) put (unsigned char *p, unsigned char i, unsigned char v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     zpargs+1+1
+	sta     ptr1+1
+	lda     zpargs+1
+	sta     ptr1
+	ldy     #$00
+	lda     (c_sp),y
+	ldy     zpargs+0
+	sta     (ptr1),y
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __attribute__ ((zpargs)) add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     zpargs+0
+	pha
+	txa
+	adc     zpargs+0+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #>(_buf)
+	sta     zpargs+1+1
+	lda     #<(_buf)
+	sta     zpargs+1
+	lda     #$02
+	sta     zpargs+0
+	lda     #$07
+	jsr     _put
+	lda     #>(_buf)
+	sta     zpargs+0+1
+	lda     #<(_buf)
+	sta     zpargs+0
+	lda     #$02
+	jsr     _get
+	sta     zpargs+0
+	stx     zpargs+0+1
+	ldx     #$00
+	lda     #$03
+	jsr     _add
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+L0002:	jmp     boolne
+
+.endproc
+
@@ -0,0 +1,175 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.import		zpargs
+	.macpack	longbranch
+	.dbg		file, "zpargs-c64.c", 620, 1792400054
+	.forceimport	__STARTUP__
+	.export		_buf
+	.export		_get
+	.export		_put
+	.export		_add
+	.export		_main
+
+.segment	"BSS"
+
+_buf:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __attribute__ ((zpargs)) get (const unsigned char *p, unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+	.dbg	func, "get", "00", static, "_get"
+	.dbg	sym, "p", "00", register, "zpargs", 0
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpargs-c64.c", 9
+	jsr     pusha
+	.dbg	line, "zpargs-c64.c", 10
+	lda     zpargs+0
+	ldx     zpargs+0+1
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0001
+	.dbg	line, "zpargs-c64.c", 11
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __attribute__ ((zpargs)) put (unsigned char *p, unsigned char i, unsigned char v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+	.dbg	func, "put", "00", static, "_put"
+	.dbg	sym, "p", "00", register, "zpargs", 1
+	.dbg	sym, "i", "00", register, "zpargs", 0
+	.dbg	sym, "v", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpargs-c64.c", 14
+	jsr     pusha
+	.dbg	line, "zpargs-c64.c", 15
+	lda     zpargs+1
+	ldx     zpargs+1+1
+	jsr     pushax
+	ldx     #$00
+	lda     zpargs+0
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "zpargs-c64.c", 16
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __attribute__ ((zpargs)) add (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+	.dbg	func, "add", "00", static, "_add"
+	.dbg	sym, "a", "00", register, "zpargs", 0
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpargs-c64.c", 19
+	jsr     pushax
+	.dbg	line, "zpargs-c64.c", 20
+	lda     zpargs+0
+	ldx     zpargs+0+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "zpargs-c64.c", 21
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "zpargs-c64.c", 25
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	sta     zpargs+1
+	stx     zpargs+1+1
+	ldx     #$00
+	lda     #$02
+	sta     zpargs+0
+	ldx     #$00
+	lda     #$07
+	jsr     _put
+	.dbg	line, "zpargs-c64.c", 26
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	sta     zpargs+0
+	stx     zpargs+0+1
+	ldx     #$00
+	lda     #$02
+	jsr     _get
+	sta     zpargs+0
+	stx     zpargs+0+1
+	ldx     #$00
+	lda     #$03
+	jsr     _add
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+L0002:	jsr     boolne
+	jmp     L0001
+	.dbg	line, "zpargs-c64.c", 27
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,427 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_up
+	.export		_down
+	.export		_rows
+	.export		_x
+	.export		_queens
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$63,$00
+S0003:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_up:
+	.res	30,$00
+_down:
+	.res	30,$00
+_rows:
+	.res	16,$00
+_x:
+	.res	16,$00
+
+; ---------------------------------------------------------------
+; void __near__ queens (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_queens: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	sta     ptr1
+	txa
+	adc     #>(_rows)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0004
+	jsr     ldax0sp
+	sec
+	ldy     #$02
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	sta     ptr1
+	txa
+	adc     #>(_up)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0004
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	ldy     #$00
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	sta     ptr1
+	txa
+	adc     #>(_down)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0004
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	txa
+	tay
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	lda     (c_sp),y
+	bne     L000E
+	dey
+	lda     (c_sp),y
+	cmp     #$07
+	bne     L000B
+	jsr     _print
+	jmp     L000D
+L000B:	iny
+L000E:	jsr     ldaxysp
+	jsr     incax1
+	jsr     _queens
+L000D:	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     staxspidx
+L0004:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$31
+	jsr     incaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     ldax0sp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0008
+	eor     #$80
+L0008:	bpl     L0004
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0004:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$0F
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	bcc     L000D
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     addeq0sp
+	jmp     L0002
+L000D:	jsr     stax0sp
+L0007:	jsr     ldax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	tax
+	bcc     L000F
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	sta     ptr1
+	txa
+	adc     #>(_rows)
+	sta     ptr1+1
+	lda     #$01
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     #$00
+	sta     (ptr1),y
+	tax
+	tya
+	jsr     addeq0sp
+	jmp     L0007
+L000F:	jsr     _queens
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,511 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_up
+	.export		_down
+	.export		_rows
+	.export		_x
+	.export		_queens
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$63,$00
+S0003:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_up:
+	.res	30,$00
+_down:
+	.res	30,$00
+_rows:
+	.res	16,$00
+_x:
+	.res	16,$00
+
+; ---------------------------------------------------------------
+; void __near__ queens (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_queens: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_rows)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_rows)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	jeq     L0004
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sec
+	iny
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	clc
+	adc     #$07
+	bcc     L0009
+	inx
+L0009:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_up)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_up)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	jeq     L0004
+	lda     (c_sp)
+	iny
+	clc
+	adc     (c_sp),y
+	pha
+	dey
+	lda     (c_sp),y
+	ldy     #$03
+	adc     (c_sp),y
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_down)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_down)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	jeq     L0004
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_rows)
+	tay
+	lda     tmp1
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	clc
+	adc     #$07
+	bcc     L000C
+	inx
+L000C:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_up)
+	tay
+	lda     tmp1
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldy     #$06
+	clc
+	adc     (c_sp),y
+	pha
+	dey
+	lda     (c_sp),y
+	ldy     #$07
+	adc     (c_sp),y
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_down)
+	tay
+	lda     tmp1
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	txa
+	tay
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     staxspidx
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_x)
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	lda     (c_sp),y
+	bne     L0012
+	dey
+	lda     (c_sp),y
+	cmp     #$07
+	bne     L000D
+	jsr     _print
+	bra     L000F
+L000D:	iny
+L0012:	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ina
+	bne     L0010
+	inx
+L0010:	jsr     _queens
+L000F:	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_rows)
+	tay
+	lda     tmp1
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	clc
+	adc     #$07
+	bcc     L0011
+	inx
+L0011:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_up)
+	tay
+	lda     tmp1
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldy     #$06
+	clc
+	adc     (c_sp),y
+	pha
+	dey
+	lda     (c_sp),y
+	ldy     #$07
+	adc     (c_sp),y
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_down)
+	tay
+	lda     tmp1
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     staxspidx
+L0004:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_x)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	clc
+	adc     #$31
+	bcc     L0007
+	inx
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0004
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0004:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$0F
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L000D
+	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_up)
+	tay
+	lda     tmp1
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_down)
+	tay
+	lda     tmp1
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	jsr     staxspidx
+	jsr     addeq0sp
+	bra     L0002
+L000D:	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0007:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	tax
+	bcc     L000F
+	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_rows)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_rows)
+	sta     ptr1+1
+	tya
+	sta     (ptr1)
+	tay
+	dea
+	sta     (ptr1),y
+	tax
+	tya
+	jsr     addeq0sp
+	bra     L0007
+L000F:	jsr     _queens
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
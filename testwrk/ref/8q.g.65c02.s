@@ -0,0 +1,508 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "8q.c", 1111, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_up
+	.export		_down
+	.export		_rows
+	.export		_x
+	.export		_queens
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$63,$00
+S0003:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_up:
+	.res	30,$00
+_down:
+	.res	30,$00
+_rows:
+	.res	16,$00
+_x:
+	.res	16,$00
+
+; ---------------------------------------------------------------
+; void __near__ queens (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_queens: near
+
+	.dbg	func, "queens", "00", static, "_queens"
+	.dbg	sym, "c", "00", auto, 0
+	.dbg	sym, "r", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "8q.c", 25
+	jsr     pushax
+	.dbg	line, "8q.c", 28
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "8q.c", 29
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jne     L0009
+L0008:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0004
+	.dbg	line, "8q.c", 30
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "8q.c", 31
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "8q.c", 32
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$07
+L000C:	jsr     booleq
+	jeq     L000B
+	.dbg	line, "8q.c", 33
+	jsr     _print
+	.dbg	line, "8q.c", 34
+	jmp     L000D
+	.dbg	line, "8q.c", 35
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	ina
+	bne     L000E
+	inx
+L000E:	jsr     _queens
+	.dbg	line, "8q.c", 36
+L000D:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     incax7
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "8q.c", 28
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "8q.c", 38
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+	.dbg	func, "print", "00", static, "_print"
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "8q.c", 44
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "8q.c", 45
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$31
+	jsr     incaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "8q.c", 46
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0008
+	eor     #$80
+L0008:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "8q.c", 44
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "8q.c", 48
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "8q.c", 49
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "8q.c", 16
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$0F
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "8q.c", 17
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_up)
+	tay
+	txa
+	adc     #>(_up)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_down)
+	tay
+	txa
+	adc     #>(_down)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "8q.c", 16
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "8q.c", 18
+L0003:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0008
+	.dbg	line, "8q.c", 19
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_rows)
+	tay
+	txa
+	adc     #>(_rows)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "8q.c", 18
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+	.dbg	line, "8q.c", 20
+L0008:	ldx     #$00
+	lda     #$00
+	jsr     _queens
+	.dbg	line, "8q.c", 21
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "8q.c", 22
+L0001:	rts
+
+	.dbg	line
+.endproc
+
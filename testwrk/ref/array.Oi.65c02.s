@@ -0,0 +1,680 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_g
+	.export		_x
+	.export		_y
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$20,$25,$64,$00
+S0003	:=	S0007+0
+S0005	:=	S0007+0
+S0001	:=	S0007+0
+S0006:
+	.byte	$0A,$00
+S0002	:=	S0006+0
+S0008	:=	S0006+0
+S0004	:=	S0006+0
+
+.segment	"BSS"
+
+_x:
+	.res	24,$00
+_y:
+	.res	6,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0002:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	lda     #$00
+	sta     (c_sp)
+	dey
+	sta     (c_sp),y
+L0007:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0004
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0007
+L0004:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L000C:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	bpl     L000D
+	lda     #$00
+	sta     (c_sp)
+	dey
+	sta     (c_sp),y
+L0011:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L000E
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_y)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_y)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0011
+L000E:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+L000D:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (x, y) int (*x)[4]; int **y;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0002:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	lda     #$00
+	sta     (c_sp)
+	dey
+	sta     (c_sp),y
+L0007:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0004
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0007
+L0004:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L000C:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	jpl     L000D
+	lda     #$00
+	sta     (c_sp)
+	dey
+	sta     (c_sp),y
+L0011:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L000E
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0011
+L000E:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+L000D:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$1E
+	jsr     subysp
+	ldy     #$04
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0002:	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0007:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0008
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	pha
+	lda     tmp1
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$03
+	lda     #$E8
+	jsr     tosmulax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0007
+L0008:	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_y)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_y)
+	sta     ptr1+1
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     _f
+	ldy     #$04
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L000C:	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	jpl     L000D
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_y)
+	tay
+	lda     tmp1
+	adc     #>(_y)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	adc     #$08
+	bcc     L0011
+	inx
+	clc
+L0011:	adc     c_sp
+	tay
+	txa
+	adc     c_sp+1
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0012:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0016
+	eor     #$80
+L0016:	bpl     L000E
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     (c_sp)
+	sta     sreg
+	lda     tmp1
+	dey
+	adc     (c_sp),y
+	sta     sreg+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0012
+L000E:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+L000D:	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0017
+	inx
+L0017:	jsr     pushax
+	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _g
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,536 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_g
+	.export		_x
+	.export		_y
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$20,$25,$64,$00
+S0003	:=	S0007+0
+S0005	:=	S0007+0
+S0001	:=	S0007+0
+S0006:
+	.byte	$0A,$00
+S0002	:=	S0006+0
+S0008	:=	S0006+0
+S0004	:=	S0006+0
+
+.segment	"BSS"
+
+_x:
+	.res	24,$00
+_y:
+	.res	6,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0007:	jsr     ldax0sp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0004
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0007
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	bpl     L000D
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0011:	jsr     ldax0sp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L000E
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0011
+L000E:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L000C
+L000D:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (x, y) int (*x)[4]; int **y;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0007:	jsr     ldax0sp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0004
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0007
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	bpl     L000D
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0011:	jsr     ldax0sp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L000E
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$06
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0011
+L000E:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L000C
+L000D:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$1E
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0007:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0008
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$03
+	lda     #$E8
+	jsr     tosmulax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0007
+L0008:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	sta     ptr1
+	txa
+	adc     #>(_y)
+	sta     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     _f
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+L000C:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	jpl     L000D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax3
+	jsr     incax8
+	jsr     leaaxsp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0011:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L000E
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     (c_sp)
+	sta     sreg
+	txa
+	ldy     #$01
+	adc     (c_sp),y
+	sta     sreg+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	sta     ptr1
+	txa
+	adc     #>(_x)
+	sta     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0011
+L000E:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+L000D:	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _g
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,636 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "array.c", 1367, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_g
+	.export		_x
+	.export		_y
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$20,$25,$64,$00
+S0003	:=	S0007+0
+S0005	:=	S0007+0
+S0001	:=	S0007+0
+S0006:
+	.byte	$0A,$00
+S0002	:=	S0006+0
+S0008	:=	S0006+0
+S0004	:=	S0006+0
+
+.segment	"BSS"
+
+_x:
+	.res	24,$00
+_y:
+	.res	6,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", static, "_f"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "j", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "array.c", 39
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "array.c", 40
+L0005:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0004
+	.dbg	line, "array.c", 41
+L000A:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "array.c", 40
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+	.dbg	line, "array.c", 39
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "array.c", 42
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "array.c", 43
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000F
+	jmp     L000D
+	.dbg	line, "array.c", 44
+L000F:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0011:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	jmp     L000E
+	.dbg	line, "array.c", 45
+L0014:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "array.c", 44
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+	.dbg	line, "array.c", 43
+L000E:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+	.dbg	line, "array.c", 46
+L000D:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "array.c", 47
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (x, y) int (*x)[4]; int **y;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+	.dbg	func, "g", "00", static, "_g"
+	.dbg	sym, "x", "00", auto, 2
+	.dbg	sym, "y", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "j", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "array.c", 51
+	jsr     pushax
+	.dbg	line, "array.c", 54
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "array.c", 55
+L0005:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0004
+	.dbg	line, "array.c", 56
+L000A:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax3
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "array.c", 55
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+	.dbg	line, "array.c", 54
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "array.c", 57
+L0003:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "array.c", 58
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000F
+	jmp     L000D
+	.dbg	line, "array.c", 59
+L000F:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0011:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	jmp     L000E
+	.dbg	line, "array.c", 60
+L0014:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "array.c", 59
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+	.dbg	line, "array.c", 58
+L000E:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+	.dbg	line, "array.c", 61
+L000D:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "array.c", 62
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "z", "00", auto, -24
+	.dbg	sym, "i", "00", auto, -26
+	.dbg	sym, "j", "00", auto, -28
+	.dbg	sym, "p", "00", auto, -30
+
+.segment	"CODE"
+
+	.dbg	line, "array.c", 20
+	ldy     #$1E
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "array.c", 21
+L0005:	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L0007:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0008
+	.dbg	line, "array.c", 22
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$03
+	lda     #$E8
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "array.c", 21
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+	.dbg	line, "array.c", 23
+L0008:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "array.c", 20
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "array.c", 25
+L0003:	jsr     _f
+	.dbg	line, "array.c", 26
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+L000C:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000F
+	jmp     L000D
+	.dbg	line, "array.c", 27
+L000F:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax3
+	jsr     incax8
+	jsr     leaaxsp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "array.c", 28
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L0011:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	jmp     L000E
+	.dbg	line, "array.c", 29
+L0014:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax3
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "array.c", 28
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+	.dbg	line, "array.c", 26
+L000E:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+	.dbg	line, "array.c", 31
+L000D:	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _g
+	.dbg	line, "array.c", 33
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "array.c", 34
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,47 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug2134.c", 57, 1779181050
+	.forceimport	__STARTUP__
+	.export		_i
+	.export		_p
+	.export		_main
+
+.segment	"DATA"
+
+_i:
+	.word	$0000
+_p:
+	.word	$0000
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug2134.c", 3
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,77 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_Bs
+	.export		_APtr
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$48,$61,$6C,$6C,$6F,$20,$57,$65,$6C,$74,$21,$20,$25,$69,$20,$3D
+	.byte	$20,$25,$69,$20,$0A,$00
+
+.segment	"BSS"
+
+_Bs:
+	.res	120,$00
+_APtr:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$0B
+	sta     _Bs+94
+	stz     _Bs+94+1
+	lda     #>(_Bs+90)
+	sta     _APtr+1
+	lda     #<(_Bs+90)
+	sta     _APtr
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _Bs+94
+	ldx     _Bs+94+1
+	jsr     pushax
+	lda     _APtr
+	ldx     _APtr+1
+	clc
+	adc     #$04
+	bcc     L0002
+	inx
+L0002:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
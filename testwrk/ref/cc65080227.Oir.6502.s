@@ -0,0 +1,77 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_a
+	.export		_b
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$62,$20,$28,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$78,$30
+	.byte	$30,$31,$31,$32,$32,$30,$30,$29,$3A,$20,$25,$30,$38,$6C,$78,$0A
+	.byte	$00
+
+.segment	"BSS"
+
+_a:
+	.res	4,$00
+_b:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _a+3
+	lda     #$11
+	sta     _a+2
+	lda     #$22
+	sta     _a+1
+	lda     #$00
+	sta     _a
+	lda     _a+3
+	sta     _b+3
+	lda     _a+2
+	sta     _b+2
+	ldx     _a+1
+	lda     _a
+	sta     _b
+	stx     _b+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _b+3
+	sta     sreg+1
+	lda     _b+2
+	sta     sreg
+	ldx     _b+1
+	lda     _b
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
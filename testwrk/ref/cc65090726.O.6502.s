@@ -0,0 +1,97 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_Proc3
+	.export		_Proc1
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ Proc3 (struct Record **PtrParOut)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Proc1 (struct Record *PtrParIn)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     ldaxi
+	jsr     _Proc3
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _Proc3
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _Proc3
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     ldaxi
+	jsr     _Proc3
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     ldaxi
+	jsr     _Proc3
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     ldaxi
+	jsr     _Proc3
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
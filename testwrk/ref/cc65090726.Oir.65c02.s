@@ -0,0 +1,159 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_Proc3
+	.export		_Proc1
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ Proc3 (struct Record **PtrParOut)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Proc1 (struct Record *PtrParIn)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _Proc3
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,71 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_htons
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$78,$20,$2D,$3E,$20,$25,$78,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ htons (unsigned int val)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_htons: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	txa
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	jsr     _htons
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,94 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cc65090910.c", 601, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_htons
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$78,$20,$2D,$3E,$20,$25,$78,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ htons (unsigned int val)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_htons: near
+
+	.dbg	func, "htons", "00", static, "_htons"
+	.dbg	sym, "val", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090910.c", 19
+	jsr     pushax
+	.dbg	line, "cc65090910.c", 20
+	ldy     #$01
+	jsr     ldaxysp
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	txa
+	ldx     #$00
+	jsr     tosorax
+	jmp     L0001
+	.dbg	line, "cc65090910.c", 21
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090910.c", 25
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     _htons
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cc65090910.c", 27
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65090910.c", 28
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,70 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_foo
+	.export		_bar
+	.export		_main
+
+.segment	"DATA"
+
+_foo:
+	.word	$0000
+_bar:
+	.word	$0002
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$6F,$6F,$3A,$20,$25,$64,$20,$62,$61,$72,$3A,$20,$25,$64,$0A
+	.byte	$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	bra     L0004
+L0002:	inc     _foo
+	bne     L0004
+	inc     _foo+1
+L0004:	lda     _foo
+	cmp     _bar
+	lda     _foo+1
+	sbc     _bar+1
+	bvc     L0007
+	eor     #$80
+L0007:	bmi     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _foo
+	ldx     _foo+1
+	jsr     pushax
+	lda     _bar
+	ldx     _bar+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
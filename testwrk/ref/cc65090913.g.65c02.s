@@ -0,0 +1,84 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cc65090913.c", 687, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_foo
+	.export		_bar
+	.export		_main
+
+.segment	"DATA"
+
+_foo:
+	.word	$0000
+_bar:
+	.word	$0002
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$6F,$6F,$3A,$20,$25,$64,$20,$62,$61,$72,$3A,$20,$25,$64,$0A
+	.byte	$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090913.c", 27
+	jmp     L0004
+	.dbg	line, "cc65090913.c", 28
+L0002:	inc     _foo
+	bne     L0006
+	inc     _foo+1
+L0006:	lda     _foo
+	ldx     _foo+1
+	.dbg	line, "cc65090913.c", 27
+L0004:	lda     _foo
+	ldx     _foo+1
+	jsr     pushax
+	lda     _bar
+	ldx     _bar+1
+	jsr     tosltax
+	jne     L0002
+	.dbg	line, "cc65090913.c", 30
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _foo
+	ldx     _foo+1
+	jsr     pushax
+	lda     _bar
+	ldx     _bar+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cc65090913.c", 32
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65090913.c", 33
+L0001:	rts
+
+	.dbg	line
+.endproc
+
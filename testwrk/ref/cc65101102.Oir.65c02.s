@@ -0,0 +1,194 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$7A,$65,$72,$6F,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$FF
+	txa
+	jsr     pushax
+	jsr     decsp1
+	ldy     #$03
+	ina
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0002:	ldy     #$04
+	lda     (c_sp),y
+	tax
+	dey
+	cpx     #$01
+	bcs     L0003
+	ldy     #$05
+	lda     (c_sp),y
+	clc
+	ldy     #$03
+	adc     (c_sp),y
+	sta     ptr1
+	ldy     #$06
+	lda     (c_sp),y
+	ldy     #$04
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	tax
+	ldy     #$01
+	lda     (c_sp),y
+	pha
+	txa
+	iny
+	eor     (c_sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	lda     #$00
+L000D:	sta     (c_sp)
+	cmp     #$08
+	bcs     L0004
+	ldy     #$02
+	lda     (c_sp),y
+	tax
+	dey
+	txa
+	and     #$80
+	beq     L000A
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	eor     #$21
+	pha
+	lda     tmp1
+	eor     #$10
+	tax
+	pla
+	bra     L000E
+L000A:	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+L000E:	jsr     staxysp
+	clc
+	lda     #$01
+	adc     (c_sp)
+	bra     L000D
+L0004:	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	dey
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     complax
+	jmp     incsp7
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	cpx     #$01
+	bcs     L0003
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	clc
+	adc     #<(_block)
+	sta     ptr1
+	txa
+	adc     #>(_block)
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     (ptr1)
+	ldx     #$00
+	tya
+	jsr     addeq0sp
+	bra     L0002
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,171 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$7A,$65,$72,$6F,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$FF
+	txa
+	jsr     pushax
+	jsr     decsp1
+	inx
+	txa
+	ldy     #$03
+	jsr     staxysp
+L0002:	ldy     #$04
+	jsr     ldaxysp
+	cpx     #$01
+	bcs     L0003
+	ldy     #$04
+	jsr     ldaxysp
+	clc
+	ldy     #$05
+	adc     (c_sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (c_sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	tax
+	ldy     #$01
+	lda     (c_sp),y
+	pha
+	txa
+	iny
+	eor     (c_sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	lda     #$00
+L000D:	sta     (c_sp)
+	cmp     #$08
+	bcs     L0004
+	ldy     #$02
+	jsr     ldaxysp
+	txa
+	and     #$80
+	beq     L000A
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+	eor     #$21
+	pha
+	txa
+	eor     #$10
+	tax
+	pla
+	bra     L000E
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+L000E:	ldy     #$01
+	jsr     staxysp
+	clc
+	lda     #$01
+	adc     (c_sp)
+	bra     L000D
+L0004:	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	ldy     #$02
+	jsr     ldaxysp
+	jsr     complax
+	jmp     incsp7
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cpx     #$01
+	bcs     L0003
+	jsr     ldax0sp
+	clc
+	adc     #<(_block)
+	sta     ptr1
+	txa
+	adc     #>(_block)
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     (ptr1)
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
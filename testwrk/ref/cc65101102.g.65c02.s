@@ -0,0 +1,229 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cc65101102.c", 1286, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdint.h", 5720, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$7A,$65,$72,$6F,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+	.dbg	func, "calculate_checksum", "00", static, "_calculate_checksum"
+	.dbg	sym, "block", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "result", "00", auto, -4
+	.dbg	sym, "j", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "cc65101102.c", 29
+	jsr     pushax
+	.dbg	line, "cc65101102.c", 30
+	jsr     decsp2
+	ldx     #$FF
+	lda     #$FF
+	jsr     pushax
+	.dbg	line, "cc65101102.c", 33
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$03
+	jsr     staxysp
+L0002:	ldy     #$04
+	jsr     ldaxysp
+	cpx     #$01
+	jsr     boolult
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "cc65101102.c", 34
+L0005:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	tax
+	lda     #$00
+	jsr     tosxorax
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "cc65101102.c", 35
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (c_sp),y
+L0006:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$08
+	jsr     boolult
+	jne     L0009
+	jmp     L0004
+	.dbg	line, "cc65101102.c", 36
+L0009:	ldy     #$02
+	jsr     ldaxysp
+	txa
+	and     #$80
+	tax
+	lda     #$00
+	stx     tmp1
+	ora     tmp1
+	jeq     L000A
+	.dbg	line, "cc65101102.c", 37
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+	eor     #$21
+	pha
+	txa
+	eor     #$10
+	tax
+	pla
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "cc65101102.c", 38
+	jmp     L0008
+	.dbg	line, "cc65101102.c", 39
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "cc65101102.c", 35
+L0008:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L0006
+	.dbg	line, "cc65101102.c", 33
+L0004:	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "cc65101102.c", 43
+L0003:	ldy     #$02
+	jsr     ldaxysp
+	jsr     complax
+	jmp     L0001
+	.dbg	line, "cc65101102.c", 44
+L0001:	jsr     incsp7
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cc65101102.c", 50
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65101102.c", 51
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$01
+	jsr     boolult
+	jne     L0005
+	jmp     L0003
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	clc
+	adc     #<(_block)
+	tay
+	txa
+	adc     #>(_block)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "cc65101102.c", 52
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65101102.c", 54
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65101102.c", 55
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,77 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$64,$20,$6D,$6F,$64,$20,$31,$30,$30,$30,$20,$69,$73,$20,$25
+	.byte	$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$3A
+	txa
+	sbc     #$30
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	bcc     L0009
+	jsr     pushw0sp
+	ldy     #$00
+	ldx     #$03
+	lda     #$E8
+	jsr     tosmodax
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$00
+	ldx     #$03
+	lda     #$E8
+	jsr     tosmodax
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0004:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+L0009:	rts
+
+.endproc
+
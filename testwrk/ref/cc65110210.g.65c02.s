@@ -0,0 +1,92 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cc65110210.c", 750, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_p1func
+	.export		_func
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+.segment	"BSS"
+
+_p1func:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ func (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+	.dbg	func, "func", "00", static, "_func"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110210.c", 30
+	lda     _p1func
+	ldx     _p1func+1
+	jsr     pushax
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	.dbg	line, "cc65110210.c", 31
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110210.c", 35
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65110210.c", 37
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65110210.c", 38
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,197 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_test1
+	.export		_test2
+	.export		_test3
+	.export		_main
+
+.segment	"DATA"
+
+_upper:
+	.byte	$41,$42,$43,$44,$45,$46,$47,$48,$49,$4A,$4B,$4C,$4D,$4E,$4F,$50
+	.byte	$51,$52,$53,$54,$55,$56,$57,$58,$59,$5A,$00
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+S0004:
+	.byte	$74,$65,$73,$74,$33,$3A,$6F,$6B,$0A,$00
+S0003:
+	.byte	$74,$65,$73,$74,$32,$3A,$6F,$6B,$0A,$00
+S0002:
+	.byte	$74,$65,$73,$74,$31,$3A,$6F,$6B,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	jsr     stax0sp
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	jmp     L0004
+L0008:	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0004:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (ptr1),y
+	bne     L0008
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	jsr     stax0sp
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	jmp     L0005
+L0006:	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (ptr1),y
+	bne     L0006
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	jsr     stax0sp
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	jmp     L0005
+L0007:	lda     #$01
+	jsr     addeqysp
+L0005:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1),y
+	bne     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test1
+	jsr     _test2
+	jsr     _test3
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,774 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_atoi
+	.import		_isprint
+	.export		_in
+	.export		_f
+	.export		_main
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$69,$73,$70,$72,$69,$6E,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65
+	.byte	$71,$0A,$0A,$00
+S0012:
+	.byte	$72,$65,$73,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A
+	.byte	$00
+S000C:
+	.byte	$30,$2D,$39,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0006:
+	.byte	$61,$2D,$7A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0009:
+	.byte	$41,$2D,$5A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0005:
+	.byte	$0A,$0A,$63,$6F,$75,$6E,$74,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$69,$6E,$70,$75,$74,$3A,$0A,$0A,$00
+S0013:
+	.byte	$6E,$65,$77,$6C,$69,$6E,$65,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S000B:
+	.byte	$3A,$25,$64,$0A,$00
+S0008	:=	S000B+0
+S0014:
+	.byte	$25,$30,$33,$6F,$00
+S000E	:=	S000B+0
+S0011	:=	S000B+0
+S0015	:=	S000B+0
+S0007:
+	.byte	$25,$63,$00
+S0004	:=	S0007+0
+S0002:
+	.byte	$72,$62,$00
+S000D	:=	S0007+0
+S0010	:=	S0007+0
+S000A	:=	S0007+0
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_f:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	bpl     L0004
+	ldx     #$00
+	txa
+	jmp     L0068
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _atoi
+	jsr     pushax
+	lda     #$64
+	jsr     tosdiva0
+L0068:	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L0007:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L0008
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	ldy     #$06
+	tax
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+L0008:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000E
+L000C:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000E:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L000C
+	cmp     #$FF
+	bne     L000C
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L0010:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0014
+	eor     #$80
+L0014:	jpl     L0011
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0012
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0053
+	eor     #$80
+L0053:	jpl     L0012
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$61
+	txa
+	sbc     #$00
+	bvs     L001A
+	eor     #$80
+L001A:	bpl     L0012
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$7B
+	txa
+	sbc     #$00
+	bvc     L001C
+	eor     #$80
+L001C:	bpl     L0012
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0012:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0010
+L0011:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L001F:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0023
+	eor     #$80
+L0023:	jpl     L0020
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0021
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0054
+	eor     #$80
+L0054:	jpl     L0021
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$41
+	txa
+	sbc     #$00
+	bvs     L0029
+	eor     #$80
+L0029:	bpl     L0021
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$5B
+	txa
+	sbc     #$00
+	bvc     L002B
+	eor     #$80
+L002B:	bpl     L0021
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0021:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L001F
+L0020:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0032
+	eor     #$80
+L0032:	jpl     L002F
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0030
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0055
+	eor     #$80
+L0055:	jpl     L0030
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$30
+	txa
+	sbc     #$00
+	bvs     L0038
+	eor     #$80
+L0038:	bpl     L0030
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$3A
+	txa
+	sbc     #$00
+	bvc     L003A
+	eor     #$80
+L003A:	bpl     L0030
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0030:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L002E
+L002F:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L003D:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0041
+	eor     #$80
+L0041:	jpl     L003E
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L003F
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0056
+	eor     #$80
+L0056:	bpl     L003F
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	beq     L003F
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L003F:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L003D
+L003E:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+L0047:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L004B
+	eor     #$80
+L004B:	jpl     L0048
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	txa
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0049
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0057
+	eor     #$80
+L0057:	bpl     L0049
+	ldy     #$07
+	lda     (c_sp),y
+	bne     L0050
+	dey
+	lda     (c_sp),y
+	cmp     #$0A
+	bne     L0050
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jmp     L0059
+L0050:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+L0059:	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushw
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0049:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0047
+L0048:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
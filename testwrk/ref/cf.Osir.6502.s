@@ -0,0 +1,1000 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_atoi
+	.import		_isprint
+	.export		_in
+	.export		_f
+	.export		_main
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$69,$73,$70,$72,$69,$6E,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65
+	.byte	$71,$0A,$0A,$00
+S0012:
+	.byte	$72,$65,$73,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A
+	.byte	$00
+S000C:
+	.byte	$30,$2D,$39,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0006:
+	.byte	$61,$2D,$7A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0009:
+	.byte	$41,$2D,$5A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0005:
+	.byte	$0A,$0A,$63,$6F,$75,$6E,$74,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$69,$6E,$70,$75,$74,$3A,$0A,$0A,$00
+S0013:
+	.byte	$6E,$65,$77,$6C,$69,$6E,$65,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S000B:
+	.byte	$3A,$25,$64,$0A,$00
+S0008	:=	S000B+0
+S0014:
+	.byte	$25,$30,$33,$6F,$00
+S000E	:=	S000B+0
+S0011	:=	S000B+0
+S0015	:=	S000B+0
+S0007:
+	.byte	$25,$63,$00
+S0004	:=	S0007+0
+S0002:
+	.byte	$72,$62,$00
+S000D	:=	S0007+0
+S0010	:=	S0007+0
+S000A	:=	S0007+0
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_f:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	ldy     #$0B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	bpl     L0004
+	ldy     #$00
+	tya
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	jmp     L005C
+L0004:	dey
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L0007
+	inx
+L0007:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _atoi
+	jsr     pushax
+	lda     #$64
+	jsr     tosdiva0
+	jsr     stax0sp
+L005C:	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0008:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L000C
+	eor     #$80
+L000C:	bpl     L0009
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	ldy     #$06
+	tax
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0008
+L0009:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$02
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	jmp     L000F
+L000D:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	tay
+	lda     tmp1
+	adc     #>(_f)
+	tax
+	tya
+	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	bcc     L005D
+	inx
+L005D:	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000F:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L000D
+	cmp     #$FF
+	bne     L000D
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0012:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0016
+	eor     #$80
+L0016:	jpl     L0013
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0014
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0055
+	eor     #$80
+L0055:	jpl     L0014
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$61
+	txa
+	sbc     #$00
+	bvs     L001C
+	eor     #$80
+L001C:	jpl     L0014
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$7B
+	txa
+	sbc     #$00
+	bvc     L001E
+	eor     #$80
+L001E:	bpl     L0014
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0014:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0012
+L0013:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0021:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0025
+	eor     #$80
+L0025:	jpl     L0022
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0023
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0056
+	eor     #$80
+L0056:	jpl     L0023
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$41
+	txa
+	sbc     #$00
+	bvs     L002B
+	eor     #$80
+L002B:	jpl     L0023
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$5B
+	txa
+	sbc     #$00
+	bvc     L002D
+	eor     #$80
+L002D:	bpl     L0023
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0023:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0021
+L0022:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0030:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0034
+	eor     #$80
+L0034:	jpl     L0031
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0032
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0057
+	eor     #$80
+L0057:	jpl     L0032
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$30
+	txa
+	sbc     #$00
+	bvs     L003A
+	eor     #$80
+L003A:	jpl     L0032
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$3A
+	txa
+	sbc     #$00
+	bvc     L003C
+	eor     #$80
+L003C:	bpl     L0032
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0032:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0030
+L0031:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L003F:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0043
+	eor     #$80
+L0043:	jpl     L0040
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0041
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0058
+	eor     #$80
+L0058:	jpl     L0041
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	beq     L0041
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L0041:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L003F
+L0040:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$06
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0049:	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L004D
+	eor     #$80
+L004D:	jpl     L004A
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L004B
+	ldy     #$07
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	ldy     #$00
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0059
+	eor     #$80
+L0059:	bpl     L004B
+	ldy     #$07
+	lda     (c_sp),y
+	bne     L0052
+	dey
+	lda     (c_sp),y
+	cmp     #$0A
+	bne     L0052
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jmp     L005A
+L0052:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+L005A:	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_f)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_f)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L004B:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0049
+L004A:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,1005 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cf.c", 4014, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_atoi
+	.import		_isprint
+	.export		_in
+	.export		_f
+	.export		_main
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$69,$73,$70,$72,$69,$6E,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65
+	.byte	$71,$0A,$0A,$00
+S0012:
+	.byte	$72,$65,$73,$74,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A
+	.byte	$00
+S000C:
+	.byte	$30,$2D,$39,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0006:
+	.byte	$61,$2D,$7A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0009:
+	.byte	$41,$2D,$5A,$20,$63,$68,$61,$72,$3A,$66,$72,$65,$71,$0A,$0A,$00
+S0005:
+	.byte	$0A,$0A,$63,$6F,$75,$6E,$74,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$69,$6E,$70,$75,$74,$3A,$0A,$0A,$00
+S0013:
+	.byte	$6E,$65,$77,$6C,$69,$6E,$65,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S000B:
+	.byte	$3A,$25,$64,$0A,$00
+S0008	:=	S000B+0
+S0014:
+	.byte	$25,$30,$33,$6F,$00
+S000E	:=	S000B+0
+S0011	:=	S000B+0
+S0015	:=	S000B+0
+S0007:
+	.byte	$25,$63,$00
+S0004	:=	S0007+0
+S0002:
+	.byte	$72,$62,$00
+S000D	:=	S0007+0
+S0010	:=	S0007+0
+S000A	:=	S0007+0
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_f:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "c", "00", auto, -4
+	.dbg	sym, "nc", "00", auto, -6
+	.dbg	sym, "cutoff", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "cf.c", 43
+	jsr     decsp8
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	.dbg	line, "cf.c", 44
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "cf.c", 45
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "cf.c", 48
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "cf.c", 52
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cf.c", 54
+	jmp     L0006
+	.dbg	line, "cf.c", 58
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosdivax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cf.c", 60
+L0006:	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0007:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000A
+	jmp     L0008
+L0009:	jmp     L0007
+	.dbg	line, "cf.c", 65
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "cf.c", 67
+	jmp     L0009
+	.dbg	line, "cf.c", 69
+L0008:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 71
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cf.c", 72
+	jmp     L000E
+	.dbg	line, "cf.c", 75
+L000C:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 76
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	ina
+	bne     L0010
+	inx
+L0010:	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cf.c", 77
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "cf.c", 72
+L000E:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+L000F:	jsr     boolne
+	jne     L000C
+	.dbg	line, "cf.c", 79
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 87
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 90
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0011:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	jmp     L0012
+	.dbg	line, "cf.c", 92
+L0014:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0017
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0018
+L0017:	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0018:	ldx     #$00
+	lda     #$01
+L0019:	jeq     L0013
+	.dbg	line, "cf.c", 94
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$61
+	txa
+	sbc     #$00
+	bvs     L001B
+	eor     #$80
+L001B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001C
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$7B
+	txa
+	sbc     #$00
+	bvc     L001D
+	eor     #$80
+L001D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001E
+L001C:	ldx     #$00
+	lda     #$00
+	jeq     L001F
+L001E:	ldx     #$00
+	lda     #$01
+L001F:	jeq     L0013
+	.dbg	line, "cf.c", 96
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 100
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 102
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cf.c", 90
+L0013:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+	.dbg	line, "cf.c", 107
+L0012:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 110
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0020:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0024
+	eor     #$80
+L0024:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0023
+	jmp     L0021
+	.dbg	line, "cf.c", 112
+L0023:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0026
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0027
+L0026:	ldx     #$00
+	lda     #$00
+	jeq     L0028
+L0027:	ldx     #$00
+	lda     #$01
+L0028:	jeq     L0022
+	.dbg	line, "cf.c", 114
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$41
+	txa
+	sbc     #$00
+	bvs     L002A
+	eor     #$80
+L002A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L002B
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$5B
+	txa
+	sbc     #$00
+	bvc     L002C
+	eor     #$80
+L002C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L002D
+L002B:	ldx     #$00
+	lda     #$00
+	jeq     L002E
+L002D:	ldx     #$00
+	lda     #$01
+L002E:	jeq     L0022
+	.dbg	line, "cf.c", 116
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 120
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 122
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cf.c", 110
+L0022:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0020
+	.dbg	line, "cf.c", 127
+L0021:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 130
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L002F:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0033
+	eor     #$80
+L0033:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0032
+	jmp     L0030
+	.dbg	line, "cf.c", 132
+L0032:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0035
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0036
+L0035:	ldx     #$00
+	lda     #$00
+	jeq     L0037
+L0036:	ldx     #$00
+	lda     #$01
+L0037:	jeq     L0031
+	.dbg	line, "cf.c", 134
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$30
+	txa
+	sbc     #$00
+	bvs     L0039
+	eor     #$80
+L0039:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L003A
+	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$3A
+	txa
+	sbc     #$00
+	bvc     L003B
+	eor     #$80
+L003B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L003C
+L003A:	ldx     #$00
+	lda     #$00
+	jeq     L003D
+L003C:	ldx     #$00
+	lda     #$01
+L003D:	jeq     L0031
+	.dbg	line, "cf.c", 136
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 140
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 142
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cf.c", 130
+L0031:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L002F
+	.dbg	line, "cf.c", 147
+L0030:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 150
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L003E:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0042
+	eor     #$80
+L0042:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0041
+	jmp     L003F
+	.dbg	line, "cf.c", 152
+L0041:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0044
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L0045
+L0044:	ldx     #$00
+	lda     #$00
+	jeq     L0046
+L0045:	ldx     #$00
+	lda     #$01
+L0046:	jeq     L0040
+	.dbg	line, "cf.c", 154
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	jeq     L0040
+	.dbg	line, "cf.c", 156
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 160
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 162
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cf.c", 150
+L0040:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L003E
+	.dbg	line, "cf.c", 167
+L003F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 170
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+L0048:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L004C
+	eor     #$80
+L004C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L004B
+	jmp     L0049
+	.dbg	line, "cf.c", 172
+L004B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L004E
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosgeax
+	jne     L004F
+L004E:	ldx     #$00
+	lda     #$00
+	jeq     L0050
+L004F:	ldx     #$00
+	lda     #$01
+L0050:	jeq     L004A
+	.dbg	line, "cf.c", 174
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0052
+	cmp     #$0A
+L0052:	jsr     booleq
+	jeq     L0051
+	.dbg	line, "cf.c", 176
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cf.c", 178
+	jmp     L0053
+	.dbg	line, "cf.c", 180
+L0051:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 185
+L0053:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_f)
+	tay
+	txa
+	adc     #>(_f)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cf.c", 170
+L004A:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0048
+	.dbg	line, "cf.c", 189
+L0049:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	.dbg	line, "cf.c", 190
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cf.c", 191
+L0001:	rts
+
+	.dbg	line
+.endproc
+
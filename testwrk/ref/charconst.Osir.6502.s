@@ -0,0 +1,135 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_isprint
+	.export		_backslash
+	.export		_testbackslash
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0001:
+	.byte	$25,$63,$20,$3A,$20,$00
+S0002:
+	.byte	$6F,$6B,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ backslash (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$62
+	beq     L000D
+	cmp     #$66
+	beq     L000E
+	cmp     #$6E
+	beq     L000F
+	cmp     #$72
+	beq     L0010
+	cmp     #$74
+	beq     L0011
+	cmp     #$76
+	beq     L0012
+	jmp     L0014
+L000D:	lda     #$08
+	sta     (c_sp),y
+L000E:	lda     #$0C
+	sta     (c_sp),y
+L000F:	lda     #$0A
+	sta     (c_sp),y
+L0010:	lda     #$0D
+	sta     (c_sp),y
+L0011:	lda     #$09
+	sta     (c_sp),y
+L0012:	lda     #$0B
+	sta     (c_sp),y
+L0014:	lda     (c_sp),y
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	bne     L000A
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     L0016
+L000A:	lda     #<(S0003)
+	ldx     #>(S0003)
+L0016:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	lda     #$62
+	jsr     _backslash
+	lda     #$66
+	jsr     _backslash
+	lda     #$6E
+	jsr     _backslash
+	lda     #$72
+	jsr     _backslash
+	lda     #$74
+	jsr     _backslash
+	lda     #$76
+	jmp     _backslash
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,206 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "charconst.c", 964, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_isprint
+	.export		_backslash
+	.export		_testbackslash
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0001:
+	.byte	$25,$63,$20,$3A,$20,$00
+S0002:
+	.byte	$6F,$6B,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ backslash (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+	.dbg	func, "backslash", "00", static, "_backslash"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 12
+	jsr     pusha
+	.dbg	line, "charconst.c", 13
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "charconst.c", 15
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	.dbg	line, "charconst.c", 16
+	jmp     L0002
+	.dbg	line, "charconst.c", 33
+L0002:	cmp     #$62
+	jeq     L0004
+	cmp     #$66
+	jeq     L0005
+	cmp     #$6E
+	jeq     L0006
+	cmp     #$72
+	jeq     L0007
+	cmp     #$74
+	jeq     L0008
+	cmp     #$76
+	jeq     L0009
+	jmp     L0003
+	.dbg	line, "charconst.c", 18
+L0004:	ldx     #$00
+	lda     #$08
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 20
+L0005:	ldx     #$00
+	lda     #$0C
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 22
+L0006:	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 24
+L0007:	ldx     #$00
+	lda     #$0D
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 26
+L0008:	ldx     #$00
+	lda     #$09
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 29
+L0009:	ldx     #$00
+	lda     #$0B
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "charconst.c", 33
+	jmp     L0003
+	.dbg	line, "charconst.c", 35
+L0003:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isprint
+	jsr     bnegax
+	jeq     L000A
+	.dbg	line, "charconst.c", 37
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "charconst.c", 39
+	jmp     L000B
+	.dbg	line, "charconst.c", 41
+L000A:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "charconst.c", 43
+L000B:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+	.dbg	func, "testbackslash", "00", static, "_testbackslash"
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 47
+	ldx     #$00
+	lda     #$62
+	jsr     _backslash
+	.dbg	line, "charconst.c", 48
+	ldx     #$00
+	lda     #$66
+	jsr     _backslash
+	.dbg	line, "charconst.c", 49
+	ldx     #$00
+	lda     #$6E
+	jsr     _backslash
+	.dbg	line, "charconst.c", 50
+	ldx     #$00
+	lda     #$72
+	jsr     _backslash
+	.dbg	line, "charconst.c", 51
+	ldx     #$00
+	lda     #$74
+	jsr     _backslash
+	.dbg	line, "charconst.c", 52
+	ldx     #$00
+	lda     #$76
+	jsr     _backslash
+	.dbg	line, "charconst.c", 53
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 57
+	jsr     _testbackslash
+	.dbg	line, "charconst.c", 59
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "charconst.c", 60
+L0001:	rts
+
+	.dbg	line
+.endproc
+
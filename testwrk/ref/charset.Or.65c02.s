@@ -0,0 +1,388 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_characters
+	.export		_printchars
+	.export		_main
+
+.segment	"RODATA"
+
+_characters:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$20
+	.byte	$21
+	.byte	$22
+	.byte	$23
+	.byte	$24
+	.byte	$25
+	.byte	$26
+	.byte	$27
+	.byte	$28
+	.byte	$29
+	.byte	$2A
+	.byte	$2B
+	.byte	$2C
+	.byte	$2D
+	.byte	$2E
+	.byte	$2F
+	.byte	$30
+	.byte	$31
+	.byte	$32
+	.byte	$33
+	.byte	$34
+	.byte	$35
+	.byte	$36
+	.byte	$37
+	.byte	$38
+	.byte	$39
+	.byte	$3A
+	.byte	$3B
+	.byte	$3C
+	.byte	$3D
+	.byte	$3E
+	.byte	$3F
+	.byte	$40
+	.byte	$41
+	.byte	$42
+	.byte	$43
+	.byte	$44
+	.byte	$45
+	.byte	$46
+	.byte	$47
+	.byte	$48
+	.byte	$49
+	.byte	$4A
+	.byte	$4B
+	.byte	$4C
+	.byte	$4D
+	.byte	$4E
+	.byte	$4F
+	.byte	$50
+	.byte	$51
+	.byte	$52
+	.byte	$53
+	.byte	$54
+	.byte	$55
+	.byte	$56
+	.byte	$57
+	.byte	$58
+	.byte	$59
+	.byte	$5A
+	.byte	$5B
+	.byte	$5C
+	.byte	$5D
+	.byte	$5E
+	.byte	$5F
+	.byte	$60
+	.byte	$61
+	.byte	$62
+	.byte	$63
+	.byte	$64
+	.byte	$65
+	.byte	$66
+	.byte	$67
+	.byte	$68
+	.byte	$69
+	.byte	$6A
+	.byte	$6B
+	.byte	$6C
+	.byte	$6D
+	.byte	$6E
+	.byte	$6F
+	.byte	$70
+	.byte	$71
+	.byte	$72
+	.byte	$73
+	.byte	$74
+	.byte	$75
+	.byte	$76
+	.byte	$77
+	.byte	$78
+	.byte	$79
+	.byte	$7A
+	.byte	$7B
+	.byte	$7C
+	.byte	$7D
+	.byte	$7E
+	.byte	$20
+S0013:
+	.byte	$61,$74,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0011:
+	.byte	$73,$69,$6E,$67,$6C,$65,$20,$71,$75,$6F,$74,$65,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0010:
+	.byte	$61,$70,$6F,$73,$74,$72,$6F,$70,$68,$3A,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S000F:
+	.byte	$70,$69,$70,$65,$3A,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S000E:
+	.byte	$74,$69,$6C,$64,$65,$3A,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0007:
+	.byte	$73,$6C,$61,$73,$68,$3A,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0008:
+	.byte	$62,$61,$63,$6B,$73,$6C,$61,$73,$68,$3A,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0009:
+	.byte	$63,$75,$72,$6C,$79,$20,$62,$72,$61,$63,$65,$73,$20,$6F,$70,$65
+	.byte	$6E,$3A,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S000A:
+	.byte	$63,$75,$72,$6C,$79,$20,$62,$72,$61,$63,$65,$73,$20,$63,$6C,$6F
+	.byte	$73,$65,$3A,$20,$20,$27,$25,$63,$27,$0A,$00
+S000B:
+	.byte	$73,$71,$75,$61,$72,$65,$20,$62,$72,$61,$63,$65,$73,$20,$6F,$70
+	.byte	$65,$6E,$3A,$20,$20,$27,$25,$63,$27,$0A,$00
+S000C:
+	.byte	$73,$71,$75,$61,$72,$65,$20,$62,$72,$61,$63,$65,$73,$20,$63,$6C
+	.byte	$6F,$73,$65,$3A,$20,$27,$25,$63,$27,$0A,$00
+S000D:
+	.byte	$75,$6E,$64,$65,$72,$73,$63,$6F,$72,$65,$3A,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0012:
+	.byte	$78,$6F,$72,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20
+	.byte	$20,$20,$20,$20,$20,$27,$25,$63,$27,$0A,$00
+S0003:
+	.byte	$63,$68,$61,$72,$61,$63,$74,$65,$72,$73,$3A,$0A,$0A,$00
+S0004:
+	.byte	$6E,$75,$6D,$62,$65,$72,$73,$3A,$0A,$0A,$00
+S0005:
+	.byte	$6F,$74,$68,$65,$72,$3A,$0A,$0A,$00
+S0006	:=	S0003+11
+S0001:
+	.byte	$25,$63,$00
+S0002	:=	S0013+25
+
+; ---------------------------------------------------------------
+; void __near__ printchars (unsigned char a, unsigned char b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printchars: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+L000A:	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$01
+	lda     (c_sp),y
+	cmp     (c_sp)
+	beq     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tay
+	lda     _characters,y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	bra     L000A
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$61
+	jsr     pusha
+	lda     #$7A
+	jsr     _printchars
+	lda     #$41
+	jsr     pusha
+	lda     #$5A
+	jsr     _printchars
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$30
+	jsr     pusha
+	lda     #$39
+	jsr     _printchars
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$20
+	jsr     pusha
+	lda     #$2F
+	jsr     _printchars
+	lda     #$3A
+	jsr     pusha
+	lda     #$3F
+	jsr     _printchars
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$2F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$5C
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$7B
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$7D
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$5B
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$5D
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$5F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$7E
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$7C
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$27
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$60
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$5E
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$40
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,853 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_c
+	.export		_s
+	.export		_i
+	.export		_l
+	.export		_C
+	.export		_S
+	.export		_I
+	.export		_L
+	.export		_f
+	.export		_d
+	.export		_D
+	.export		_p
+	.export		_P
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$20,$25,$6C,$64,$20,$25,$75,$20
+	.byte	$25,$75,$20,$25,$75,$20,$25,$6C,$75,$20,$25,$6C,$64,$2E,$30,$30
+	.byte	$30,$30,$30,$30,$20,$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$20
+	.byte	$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$0A,$00
+
+.segment	"BSS"
+
+_c:
+	.res	1,$00
+_s:
+	.res	2,$00
+_i:
+	.res	2,$00
+_l:
+	.res	4,$00
+_C:
+	.res	1,$00
+_S:
+	.res	2,$00
+_I:
+	.res	2,$00
+_L:
+	.res	4,$00
+_f:
+	.res	4,$00
+_d:
+	.res	4,$00
+_D:
+	.res	4,$00
+_p:
+	.res	2,$00
+_P:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _c
+	bpl     L0002
+	dex
+L0002:	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _i
+	ldx     _i+1
+	jsr     pushax
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	jsr     pusheax
+	lda     _C
+	jsr     pusha0
+	lda     _S
+	ldx     _S+1
+	jsr     pushax
+	lda     _I
+	ldx     _I+1
+	jsr     pushax
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	jsr     pusheax
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	jsr     pusheax
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	jsr     pusheax
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	jsr     pusheax
+	ldy     #$22
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$01
+	sta     _c
+	ldx     #$00
+	lda     _c
+	bpl     L0002
+	dex
+L0002:	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     _c
+	bpl     L0003
+	dex
+L0003:	sta     _i
+	stx     _i+1
+	ldx     #$00
+	lda     _c
+	bpl     L0004
+	dex
+L0004:	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _c
+	sta     _C
+	ldx     #$00
+	lda     _c
+	bpl     L0005
+	dex
+L0005:	sta     _S
+	stx     _S+1
+	ldx     #$00
+	lda     _c
+	bpl     L0006
+	dex
+L0006:	sta     _I
+	stx     _I+1
+	ldx     #$00
+	lda     _c
+	bpl     L0007
+	dex
+L0007:	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	ldx     #$00
+	lda     _c
+	bpl     L0008
+	dex
+L0008:	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	ldx     #$00
+	lda     _c
+	bpl     L0009
+	dex
+L0009:	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	ldx     #$00
+	lda     _c
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	lda     #$02
+	sta     _s
+	stz     _s+1
+	lda     _s
+	sta     _c
+	lda     _s+1
+	sta     _i+1
+	lda     _s
+	sta     _i
+	ldx     _s+1
+	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _s
+	sta     _C
+	lda     _s+1
+	sta     _S+1
+	lda     _s
+	sta     _S
+	lda     _s+1
+	sta     _I+1
+	lda     _s
+	sta     _I
+	ldx     _s+1
+	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	lda     #$03
+	sta     _i
+	stz     _i+1
+	lda     _i
+	sta     _c
+	lda     _i+1
+	sta     _s+1
+	lda     _i
+	sta     _s
+	ldx     _i+1
+	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _i
+	sta     _C
+	lda     _i+1
+	sta     _S+1
+	lda     _i
+	sta     _S
+	lda     _i+1
+	sta     _I+1
+	lda     _i
+	sta     _I
+	ldx     _i+1
+	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	stz     _l+3
+	stz     _l+2
+	stz     _l+1
+	lda     #$04
+	sta     _l
+	sta     _c
+	lda     _l+1
+	sta     _s+1
+	lda     _l
+	sta     _s
+	lda     _l+1
+	sta     _i+1
+	lda     _l
+	sta     _i
+	sta     _C
+	lda     _l+1
+	sta     _S+1
+	lda     _l
+	sta     _S
+	lda     _l+1
+	sta     _I+1
+	lda     _l
+	sta     _I
+	lda     _l+3
+	sta     _L+3
+	lda     _l+2
+	sta     _L+2
+	ldx     _l+1
+	lda     _l
+	sta     _L
+	stx     _L+1
+	lda     _l+3
+	sta     _f+3
+	lda     _l+2
+	sta     _f+2
+	ldx     _l+1
+	lda     _l
+	sta     _f
+	stx     _f+1
+	lda     _l+3
+	sta     _d+3
+	lda     _l+2
+	sta     _d+2
+	ldx     _l+1
+	lda     _l
+	sta     _d
+	stx     _d+1
+	lda     _l+3
+	sta     _D+3
+	lda     _l+2
+	sta     _D+2
+	ldx     _l+1
+	lda     _l
+	sta     _D
+	stx     _D+1
+	jsr     _print
+	lda     #$05
+	sta     _C
+	sta     _c
+	lda     _C
+	sta     _s
+	stz     _s+1
+	lda     _C
+	sta     _i
+	stz     _i+1
+	lda     _C
+	jsr     axulong
+	sta     _l
+	stz     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _C
+	sta     _S
+	stz     _S+1
+	lda     _C
+	sta     _I
+	stz     _I+1
+	lda     _C
+	jsr     axulong
+	sta     _L
+	stz     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _C
+	jsr     axulong
+	sta     _f
+	stz     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _C
+	jsr     axulong
+	sta     _d
+	stz     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _C
+	jsr     axulong
+	sta     _D
+	stz     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	lda     #$06
+	sta     _S
+	stz     _S+1
+	lda     _S
+	sta     _c
+	lda     _S+1
+	sta     _s+1
+	lda     _S
+	sta     _s
+	lda     _S+1
+	sta     _i+1
+	lda     _S
+	sta     _i
+	ldx     _S+1
+	jsr     axulong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _S
+	sta     _C
+	lda     _S+1
+	sta     _I+1
+	lda     _S
+	sta     _I
+	ldx     _S+1
+	jsr     axulong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	lda     #$07
+	sta     _I
+	stz     _I+1
+	lda     _I
+	sta     _c
+	lda     _I+1
+	sta     _s+1
+	lda     _I
+	sta     _s
+	lda     _I+1
+	sta     _i+1
+	lda     _I
+	sta     _i
+	ldx     _I+1
+	jsr     axulong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	lda     _I
+	sta     _C
+	lda     _I+1
+	sta     _S+1
+	lda     _I
+	sta     _S
+	ldx     _I+1
+	jsr     axulong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	stz     _L+3
+	stz     _L+2
+	stz     _L+1
+	lda     #$08
+	sta     _L
+	sta     _c
+	lda     _L+1
+	sta     _s+1
+	lda     _L
+	sta     _s
+	lda     _L+1
+	sta     _i+1
+	lda     _L
+	sta     _i
+	lda     _L+3
+	sta     _l+3
+	lda     _L+2
+	sta     _l+2
+	ldx     _L+1
+	lda     _L
+	sta     _l
+	stx     _l+1
+	lda     _L
+	sta     _C
+	ldx     _L+1
+	sta     _S
+	stx     _S+1
+	sta     _I
+	stx     _I+1
+	lda     _L+3
+	sta     _f+3
+	lda     _L+2
+	sta     _f+2
+	ldx     _L+1
+	lda     _L
+	sta     _f
+	stx     _f+1
+	lda     _L+3
+	sta     _d+3
+	lda     _L+2
+	sta     _d+2
+	ldx     _L+1
+	lda     _L
+	sta     _d
+	stx     _d+1
+	lda     _L+3
+	sta     _D+3
+	lda     _L+2
+	sta     _D+2
+	ldx     _L+1
+	lda     _L
+	sta     _D
+	stx     _D+1
+	jsr     _print
+	stz     _f+3
+	stz     _f+2
+	stz     _f+1
+	lda     #$09
+	sta     _f
+	sta     _c
+	lda     _f+1
+	sta     _s+1
+	lda     _f
+	sta     _s
+	lda     _f+1
+	sta     _i+1
+	lda     _f
+	sta     _i
+	lda     _f+3
+	sta     _l+3
+	lda     _f+2
+	sta     _l+2
+	ldx     _f+1
+	lda     _f
+	sta     _l
+	stx     _l+1
+	lda     _f
+	sta     _C
+	lda     _f+1
+	sta     _S+1
+	lda     _f
+	sta     _S
+	lda     _f+1
+	sta     _I+1
+	lda     _f
+	sta     _I
+	lda     _f+3
+	sta     _L+3
+	lda     _f+2
+	sta     _L+2
+	ldx     _f+1
+	lda     _f
+	sta     _L
+	stx     _L+1
+	lda     _f+3
+	sta     _d+3
+	lda     _f+2
+	sta     _d+2
+	ldx     _f+1
+	lda     _f
+	sta     _d
+	stx     _d+1
+	lda     _f+3
+	sta     _D+3
+	lda     _f+2
+	sta     _D+2
+	ldx     _f+1
+	lda     _f
+	sta     _D
+	stx     _D+1
+	jsr     _print
+	stz     _d+3
+	stz     _d+2
+	stz     _d+1
+	lda     #$0A
+	sta     _d
+	sta     _c
+	lda     _d+1
+	sta     _s+1
+	lda     _d
+	sta     _s
+	lda     _d+1
+	sta     _i+1
+	lda     _d
+	sta     _i
+	lda     _d+3
+	sta     _l+3
+	lda     _d+2
+	sta     _l+2
+	ldx     _d+1
+	lda     _d
+	sta     _l
+	stx     _l+1
+	lda     _d
+	sta     _C
+	lda     _d+1
+	sta     _S+1
+	lda     _d
+	sta     _S
+	lda     _d+1
+	sta     _I+1
+	lda     _d
+	sta     _I
+	lda     _d+3
+	sta     _L+3
+	lda     _d+2
+	sta     _L+2
+	ldx     _d+1
+	lda     _d
+	sta     _L
+	stx     _L+1
+	lda     _d+3
+	sta     _f+3
+	lda     _d+2
+	sta     _f+2
+	ldx     _d+1
+	lda     _d
+	sta     _f
+	stx     _f+1
+	lda     _d+3
+	sta     _D+3
+	lda     _d+2
+	sta     _D+2
+	ldx     _d+1
+	lda     _d
+	sta     _D
+	stx     _D+1
+	jsr     _print
+	stz     _D+3
+	stz     _D+2
+	stz     _D+1
+	lda     #$0B
+	sta     _D
+	sta     _c
+	lda     _D+1
+	sta     _s+1
+	lda     _D
+	sta     _s
+	lda     _D+1
+	sta     _i+1
+	lda     _D
+	sta     _i
+	lda     _D+3
+	sta     _l+3
+	lda     _D+2
+	sta     _l+2
+	ldx     _D+1
+	lda     _D
+	sta     _l
+	stx     _l+1
+	lda     _D
+	sta     _C
+	lda     _D+1
+	sta     _S+1
+	lda     _D
+	sta     _S
+	lda     _D+1
+	sta     _I+1
+	lda     _D
+	sta     _I
+	lda     _D+3
+	sta     _L+3
+	lda     _D+2
+	sta     _L+2
+	ldx     _D+1
+	lda     _D
+	sta     _L
+	stx     _L+1
+	lda     _D+3
+	sta     _f+3
+	lda     _D+2
+	sta     _f+2
+	ldx     _D+1
+	lda     _D
+	sta     _f
+	stx     _f+1
+	lda     _D+3
+	sta     _d+3
+	lda     _D+2
+	sta     _d+2
+	ldx     _D+1
+	lda     _D
+	sta     _d
+	stx     _d+1
+	jsr     _print
+	ldx     #$00
+	stz     _p
+	stz     _p+1
+	stz     _p
+	stz     _p+1
+	stz     _p
+	stz     _p+1
+	stz     _p
+	stz     _p+1
+	lda     _P+1
+	sta     _p+1
+	lda     _P
+	sta     _p
+	stz     _P
+	stz     _P+1
+	stz     _P
+	stz     _P+1
+	stz     _P
+	stz     _P+1
+	stz     _P
+	stz     _P+1
+	lda     _p+1
+	sta     _P+1
+	lda     _p
+	sta     _P
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,1087 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "cvt.c", 1601, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_c
+	.export		_s
+	.export		_i
+	.export		_l
+	.export		_C
+	.export		_S
+	.export		_I
+	.export		_L
+	.export		_f
+	.export		_d
+	.export		_D
+	.export		_p
+	.export		_P
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$20,$25,$6C,$64,$20,$25,$75,$20
+	.byte	$25,$75,$20,$25,$75,$20,$25,$6C,$75,$20,$25,$6C,$64,$2E,$30,$30
+	.byte	$30,$30,$30,$30,$20,$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$20
+	.byte	$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$0A,$00
+
+.segment	"BSS"
+
+_c:
+	.res	1,$00
+_s:
+	.res	2,$00
+_i:
+	.res	2,$00
+_l:
+	.res	4,$00
+_C:
+	.res	1,$00
+_S:
+	.res	2,$00
+_I:
+	.res	2,$00
+_L:
+	.res	4,$00
+_f:
+	.res	4,$00
+_d:
+	.res	4,$00
+_D:
+	.res	4,$00
+_p:
+	.res	2,$00
+_P:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+	.dbg	func, "print", "00", static, "_print"
+
+.segment	"CODE"
+
+	.dbg	line, "cvt.c", 34
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _c
+	bpl     L0002
+	dex
+L0002:	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _i
+	ldx     _i+1
+	jsr     pushax
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	jsr     pusheax
+	ldx     #$00
+	lda     _C
+	jsr     pushax
+	lda     _S
+	ldx     _S+1
+	jsr     pushax
+	lda     _I
+	ldx     _I+1
+	jsr     pushax
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	jsr     pusheax
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	jsr     pusheax
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	jsr     pusheax
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	jsr     pusheax
+	ldy     #$22
+	jsr     _printf
+	.dbg	line, "cvt.c", 38
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cvt.c", 41
+	ldx     #$00
+	lda     #$01
+	sta     _c
+	ldx     #$00
+	lda     _c
+	bpl     L0002
+	dex
+L0002:	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     _c
+	bpl     L0003
+	dex
+L0003:	sta     _i
+	stx     _i+1
+	ldx     #$00
+	lda     _c
+	bpl     L0004
+	dex
+L0004:	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _c
+	sta     _C
+	ldx     #$00
+	lda     _c
+	bpl     L0005
+	dex
+L0005:	sta     _S
+	stx     _S+1
+	ldx     #$00
+	lda     _c
+	bpl     L0006
+	dex
+L0006:	sta     _I
+	stx     _I+1
+	ldx     #$00
+	lda     _c
+	bpl     L0007
+	dex
+L0007:	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	ldx     #$00
+	lda     _c
+	bpl     L0008
+	dex
+L0008:	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	ldx     #$00
+	lda     _c
+	bpl     L0009
+	dex
+L0009:	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	ldx     #$00
+	lda     _c
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 42
+	ldx     #$00
+	lda     #$02
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     _s
+	bpl     L000B
+	dex
+L000B:	sta     _c
+	lda     _s
+	ldx     _s+1
+	sta     _i
+	stx     _i+1
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _s
+	sta     _C
+	lda     _s
+	ldx     _s+1
+	sta     _S
+	stx     _S+1
+	lda     _s
+	ldx     _s+1
+	sta     _I
+	stx     _I+1
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _s
+	ldx     _s+1
+	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 43
+	ldx     #$00
+	lda     #$03
+	sta     _i
+	stx     _i+1
+	ldx     #$00
+	lda     _i
+	bpl     L000C
+	dex
+L000C:	sta     _c
+	lda     _i
+	ldx     _i+1
+	sta     _s
+	stx     _s+1
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _i
+	sta     _C
+	lda     _i
+	ldx     _i+1
+	sta     _S
+	stx     _S+1
+	lda     _i
+	ldx     _i+1
+	sta     _I
+	stx     _I+1
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _i
+	ldx     _i+1
+	jsr     axlong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 44
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _l
+	bpl     L000D
+	dex
+L000D:	sta     _c
+	lda     _l
+	ldx     _l+1
+	sta     _s
+	stx     _s+1
+	lda     _l
+	ldx     _l+1
+	sta     _i
+	stx     _i+1
+	ldx     #$00
+	lda     _l
+	sta     _C
+	lda     _l
+	ldx     _l+1
+	sta     _S
+	stx     _S+1
+	lda     _l
+	ldx     _l+1
+	sta     _I
+	stx     _I+1
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _l+3
+	sta     sreg+1
+	lda     _l+2
+	sta     sreg
+	ldx     _l+1
+	lda     _l
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 45
+	ldx     #$00
+	lda     #$05
+	sta     _C
+	ldx     #$00
+	lda     _C
+	bpl     L000E
+	dex
+L000E:	sta     _c
+	ldx     #$00
+	lda     _C
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     _C
+	sta     _i
+	stx     _i+1
+	ldx     #$00
+	lda     _C
+	jsr     axulong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _C
+	sta     _S
+	stx     _S+1
+	ldx     #$00
+	lda     _C
+	sta     _I
+	stx     _I+1
+	ldx     #$00
+	lda     _C
+	jsr     axulong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	ldx     #$00
+	lda     _C
+	jsr     axulong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	ldx     #$00
+	lda     _C
+	jsr     axulong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	ldx     #$00
+	lda     _C
+	jsr     axulong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 46
+	ldx     #$00
+	lda     #$06
+	sta     _S
+	stx     _S+1
+	ldx     #$00
+	lda     _S
+	bpl     L000F
+	dex
+L000F:	sta     _c
+	lda     _S
+	ldx     _S+1
+	sta     _s
+	stx     _s+1
+	lda     _S
+	ldx     _S+1
+	sta     _i
+	stx     _i+1
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _S
+	sta     _C
+	lda     _S
+	ldx     _S+1
+	sta     _I
+	stx     _I+1
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _S
+	ldx     _S+1
+	jsr     axulong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 47
+	ldx     #$00
+	lda     #$07
+	sta     _I
+	stx     _I+1
+	ldx     #$00
+	lda     _I
+	bpl     L0010
+	dex
+L0010:	sta     _c
+	lda     _I
+	ldx     _I+1
+	sta     _s
+	stx     _s+1
+	lda     _I
+	ldx     _I+1
+	sta     _i
+	stx     _i+1
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _I
+	sta     _C
+	lda     _I
+	ldx     _I+1
+	sta     _S
+	stx     _S+1
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _I
+	ldx     _I+1
+	jsr     axulong
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 48
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$08
+	ldx     #$00
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	ldx     #$00
+	lda     _L
+	bpl     L0011
+	dex
+L0011:	sta     _c
+	lda     _L
+	ldx     _L+1
+	sta     _s
+	stx     _s+1
+	lda     _L
+	ldx     _L+1
+	sta     _i
+	stx     _i+1
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _L
+	sta     _C
+	lda     _L
+	ldx     _L+1
+	sta     _S
+	stx     _S+1
+	lda     _S
+	ldx     _S+1
+	sta     _I
+	stx     _I+1
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _L+3
+	sta     sreg+1
+	lda     _L+2
+	sta     sreg
+	ldx     _L+1
+	lda     _L
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 49
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$09
+	ldx     #$00
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	ldx     #$00
+	lda     _f
+	bpl     L0012
+	dex
+L0012:	sta     _c
+	lda     _f
+	ldx     _f+1
+	sta     _s
+	stx     _s+1
+	lda     _f
+	ldx     _f+1
+	sta     _i
+	stx     _i+1
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _f
+	sta     _C
+	lda     _f
+	ldx     _f+1
+	sta     _S
+	stx     _S+1
+	lda     _f
+	ldx     _f+1
+	sta     _I
+	stx     _I+1
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	lda     _f+3
+	sta     sreg+1
+	lda     _f+2
+	sta     sreg
+	ldx     _f+1
+	lda     _f
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 50
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$0A
+	ldx     #$00
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	ldx     #$00
+	lda     _d
+	bpl     L0013
+	dex
+L0013:	sta     _c
+	lda     _d
+	ldx     _d+1
+	sta     _s
+	stx     _s+1
+	lda     _d
+	ldx     _d+1
+	sta     _i
+	stx     _i+1
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _d
+	sta     _C
+	lda     _d
+	ldx     _d+1
+	sta     _S
+	stx     _S+1
+	lda     _d
+	ldx     _d+1
+	sta     _I
+	stx     _I+1
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _d+3
+	sta     sreg+1
+	lda     _d+2
+	sta     sreg
+	ldx     _d+1
+	lda     _d
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	jsr     _print
+	.dbg	line, "cvt.c", 51
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$0B
+	ldx     #$00
+	sta     _D
+	stx     _D+1
+	ldy     sreg
+	sty     _D+2
+	ldy     sreg+1
+	sty     _D+3
+	ldx     #$00
+	lda     _D
+	bpl     L0014
+	dex
+L0014:	sta     _c
+	lda     _D
+	ldx     _D+1
+	sta     _s
+	stx     _s+1
+	lda     _D
+	ldx     _D+1
+	sta     _i
+	stx     _i+1
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	sta     _l
+	stx     _l+1
+	ldy     sreg
+	sty     _l+2
+	ldy     sreg+1
+	sty     _l+3
+	ldx     #$00
+	lda     _D
+	sta     _C
+	lda     _D
+	ldx     _D+1
+	sta     _S
+	stx     _S+1
+	lda     _D
+	ldx     _D+1
+	sta     _I
+	stx     _I+1
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	sta     _L
+	stx     _L+1
+	ldy     sreg
+	sty     _L+2
+	ldy     sreg+1
+	sty     _L+3
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	sta     _f
+	stx     _f+1
+	ldy     sreg
+	sty     _f+2
+	ldy     sreg+1
+	sty     _f+3
+	lda     _D+3
+	sta     sreg+1
+	lda     _D+2
+	sta     sreg
+	ldx     _D+1
+	lda     _D
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	jsr     _print
+	.dbg	line, "cvt.c", 53
+	ldx     #$00
+	lda     #$00
+	sta     _p
+	stx     _p+1
+	ldx     #$00
+	lda     #$00
+	sta     _p
+	stx     _p+1
+	ldx     #$00
+	lda     #$00
+	sta     _p
+	stx     _p+1
+	ldx     #$00
+	lda     #$00
+	sta     _p
+	stx     _p+1
+	lda     _P
+	ldx     _P+1
+	sta     _p
+	stx     _p+1
+	.dbg	line, "cvt.c", 54
+	ldx     #$00
+	lda     #$00
+	sta     _P
+	stx     _P+1
+	ldx     #$00
+	lda     #$00
+	sta     _P
+	stx     _P+1
+	ldx     #$00
+	lda     #$00
+	sta     _P
+	stx     _P+1
+	ldx     #$00
+	lda     #$00
+	sta     _P
+	stx     _P+1
+	lda     _p
+	ldx     _p+1
+	sta     _P
+	stx     _P+1
+	.dbg	line, "cvt.c", 55
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cvt.c", 56
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,332 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_printc
+	.export		_prints
+	.export		_printl
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$33,$6C,$64,$2C,$25,$33,$6C,$64,$20,$69,$73,$20,$25,$33,$6C
+	.byte	$64,$2C,$25,$33,$6C,$64,$2C,$25,$33,$6C,$64,$0A,$00
+S0002:
+	.byte	$25,$33,$64,$2C,$25,$33,$64,$20,$69,$73,$20,$25,$33,$64,$2C,$25
+	.byte	$33,$64,$2C,$25,$33,$64,$0A,$00
+S0001	:=	S0002+0
+S0005:
+	.byte	$2D,$0A,$00
+S0004	:=	S0005+0
+
+; ---------------------------------------------------------------
+; void __near__ printc (signed char a, signed char b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printc: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0002
+	dex
+L0002:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     tosdivax
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     tosmodax
+	jsr     pusha
+	ldy     #$03
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosmulax
+	jsr     pusha
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L000F
+	dex
+L000F:	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ prints (short a, short b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_prints: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosmodax
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosmulax
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0C
+	jsr     _printf
+	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ printl (long a, long b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printl: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosmodeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	jsr     pusheax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$16
+	jsr     _printf
+	ldy     #$14
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	dea
+	dex
+	jsr     _printl
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	lda     #$FD
+	ldx     #$FF
+	jsr     pusheax
+	ina
+	jsr     _printl
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	lda     #$FD
+	ldx     #$FF
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$02
+	inx
+	jsr     _printl
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+	dea
+	jsr     _printl
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$03
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$FE
+	jsr     _prints
+	ldx     #$FF
+	lda     #$FD
+	jsr     pushax
+	ina
+	jsr     _prints
+	ldx     #$FF
+	lda     #$FD
+	jsr     pushax
+	inx
+	lda     #$02
+	jsr     _prints
+	lda     #$03
+	jsr     pusha0
+	dea
+	jsr     _prints
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$03
+	jsr     pusha
+	lda     #$FE
+	jsr     _printc
+	lda     #$FD
+	jsr     pusha
+	ina
+	jsr     _printc
+	lda     #$FD
+	jsr     pusha
+	lda     #$02
+	jsr     _printc
+	lda     #$03
+	jsr     pusha
+	dea
+	jsr     _printc
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,175 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$0A,$25,$73,$0A,$00
+S0003:
+	.byte	$25,$63,$25,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$C8
+	jsr     subysp
+	ldy     #$00
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	iny
+	cpy     #$C8
+	bne     L0002
+	jsr     push0
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	clc
+	adc     #$02
+	bcc     L0004
+	inx
+	clc
+L0004:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	lda     (c_sp)
+	clc
+	adc     #$41
+	sta     (ptr1)
+	ldy     #$64
+	jsr     subysp
+	bra     L0012
+L0007:	lda     M0004,y
+	sta     (c_sp),y
+	dey
+	bpl     L0007
+L0008:	ldy     #$40
+	lda     (c_sp),y
+	clc
+	adc     #$61
+	sta     (c_sp)
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$44
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldy     #$41
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	rol     a
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L000B
+	ldy     #$40
+	jsr     addysp
+	bra     L000D
+L000B:	ldy     #$24
+	jsr     subysp
+	bra     L0012
+L000F:	lda     M000A,y
+	sta     (c_sp),y
+	dey
+	bpl     L000F
+L0012:	lda     #$31
+	sta     (c_sp)
+	ina
+	ldy     #$63
+	sta     (c_sp),y
+	ldy     #$24
+	jsr     addysp
+	bra     L0008
+L000D:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	clc
+	adc     #$02
+	bcc     L0010
+	inx
+	clc
+L0010:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	lda     #$0A
+	sta     (ptr1)
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$04
+	bcc     L0011
+	inx
+L0011:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$78,$79,$7A,$00
+	.res	196,$00
+M0004:
+	.byte	$78,$78,$78,$00
+	.res	60,$00
+M0006:
+	.word	$0000
+M000A:
+	.byte	$61,$61,$61,$00
+	.res	96,$00
+M0003:
+	.word	$FF9C
+M0009:
+	.word	$FFDC
+M0008:
+	.word	$0040
+
+.endproc
+
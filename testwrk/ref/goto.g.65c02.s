@@ -0,0 +1,237 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "goto.c", 557, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$0A,$25,$73,$0A,$00
+S0003:
+	.byte	$25,$63,$25,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "a", "00", auto, -200
+	.dbg	sym, "ctr", "00", auto, -202
+
+.segment	"CODE"
+
+	.dbg	line, "goto.c", 4
+	ldy     #$C8
+	jsr     subysp
+	ldy     #$00
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	iny
+	cpy     #$C8
+	bne     L0002
+	.dbg	line, "goto.c", 5
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "goto.c", 7
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     leaaxsp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$41
+	jsr     incaxy
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "goto.c", 8
+	pha
+	lda     M0003
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0003+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0004
+	.dbg	line, "goto.c", 11
+	ldy     #$40
+	jsr     subysp
+	ldy     #$3F
+L0005:	lda     M0004,y
+	sta     (c_sp),y
+	dey
+	bpl     L0005
+	.dbg	line, "goto.c", 13
+L0006:	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$61
+	jsr     incaxy
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "goto.c", 14
+	pha
+	lda     M0006
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0006+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0007
+	.dbg	line, "goto.c", 15
+	ldx     #$00
+	lda     #$5A
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "goto.c", 17
+L0007:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$44
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "goto.c", 18
+	ldy     #$41
+	jsr     ldaxysp
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	php
+	ldy     #$40
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jeq     L0008
+	.dbg	line, "goto.c", 19
+	pha
+	lda     M0008
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0008+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000A
+	.dbg	line, "goto.c", 20
+	jmp     L000B
+	.dbg	line, "goto.c", 21
+L0008:	pha
+	lda     M0009
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0009+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0004
+	.dbg	line, "goto.c", 24
+L000B:	ldy     #$64
+	jsr     subysp
+	ldy     #$63
+L000C:	lda     M000A,y
+	sta     (c_sp),y
+	dey
+	bpl     L000C
+	.dbg	line, "goto.c", 26
+L0004:	ldx     #$00
+	lda     #$31
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "goto.c", 27
+	ldx     #$00
+	lda     #$32
+	ldy     #$63
+	sta     (c_sp),y
+	.dbg	line, "goto.c", 28
+	ldy     #$24
+	jsr     addysp
+	jmp     L0006
+	.dbg	line, "goto.c", 31
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     leaaxsp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "goto.c", 32
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "goto.c", 34
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "goto.c", 35
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.byte	$78,$79,$7A,$00
+	.res	196,$00
+M0004:
+	.byte	$78,$78,$78,$00
+	.res	60,$00
+M0006:
+	.word	$0000
+M000A:
+	.byte	$61,$61,$61,$00
+	.res	96,$00
+M0003:
+	.word	$FF9C
+M0009:
+	.word	$FFDC
+M0008:
+	.word	$0040
+
+.endproc
+
@@ -0,0 +1,220 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_iter
+	.export		_num
+	.export		_cnt
+	.export		_disk
+	.export		_duration
+	.export		_mov
+	.export		_main
+
+.segment	"DATA"
+
+_iter:
+	.word	$0000
+_disk:
+	.word	$0005
+_duration:
+	.word	$000A
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$6F,$77,$65,$72,$73,$20,$6F,$66,$20,$68,$61,$6E,$6F,$69,$0A
+	.byte	$64,$69,$73,$6B,$73,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$25,$32,$64,$3A,$20,$25,$32,$64,$20,$25,$32,$64,$20,$25,$32,$64
+	.byte	$20,$25,$32,$64,$0A,$00
+S0001	:=	S0003+0
+
+.segment	"BSS"
+
+_num:
+	.res	4,$00
+_cnt:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; void __near__ mov (unsigned char n, unsigned char f, unsigned char t)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mov: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$01
+	bne     L0007
+	lda     #<(_num)
+	ldx     #>(_num)
+	dey
+	clc
+	adc     (c_sp),y
+	bcc     L0003
+	inx
+L0003:	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sec
+	sbc     #$01
+	sta     (sreg),y
+	lda     #<(_num)
+	ldx     #>(_num)
+	iny
+	clc
+	adc     (c_sp),y
+	bcc     L0004
+	inx
+L0004:	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	sta     (sreg),y
+	jmp     L0005
+L0007:	lda     #$06
+	jsr     pusha0
+	ldy     #$03
+	lda     (c_sp),y
+	clc
+	iny
+	adc     (c_sp),y
+	bcc     L0006
+	inx
+L0006:	jsr     tossubax
+	ldy     #$00
+	sta     (c_sp),y
+	ldy     #$03
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     _mov
+	lda     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     _mov
+	ldy     #$03
+	lda     (c_sp),y
+	sec
+	sbc     #$01
+	jsr     pusha
+	ldy     #$01
+	lda     (c_sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     _mov
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _iter
+	ldx     _iter+1
+	jsr     pushax
+	lda     _num
+	jsr     pusha0
+	lda     _num+1
+	jsr     pusha0
+	lda     _num+2
+	jsr     pusha0
+	lda     _num+3
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _disk
+	ldx     _disk+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _disk
+	sta     _num+1
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _iter
+	ldx     _iter+1
+	jsr     pushax
+	lda     _num
+	jsr     pusha0
+	lda     _num+1
+	jsr     pusha0
+	lda     _num+2
+	jsr     pusha0
+	lda     _num+3
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _printf
+	jmp     L0004
+L0007:	lda     _disk
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	lda     #$03
+	jsr     _mov
+	inc     _iter
+	bne     L0004
+	inc     _iter+1
+L0004:	ldx     #$00
+	lda     _num+3
+	cmp     _disk
+	txa
+	sbc     _disk+1
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0007
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,110 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_t1a
+	.export		_t1b
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$65,$72,$72,$6F,$72,$0A,$00
+S0004	:=	S0002+0
+S0003:
+	.byte	$6F,$6B,$0A,$00
+S0001	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ t1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_t1a: near
+
+.segment	"CODE"
+
+	ldx     #$B0
+	lda     #$00
+	jsr     pushax
+	jsr     ldax0sp
+	cmp     #$00
+	txa
+	sbc     #$50
+	bvc     L0002
+	eor     #$80
+L0002:	bpl     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jmp     L0004
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+L0004:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ t1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_t1b: near
+
+.segment	"CODE"
+
+	ldx     #$B0
+	lda     #$00
+	jsr     pushax
+	jsr     ldax0sp
+	cmp     #$00
+	txa
+	sbc     #$50
+	bvc     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jmp     L0007
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+L0007:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _t1a
+	jsr     _t1b
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,152 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "ifexpr.c", 442, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_t1a
+	.export		_t1b
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$65,$72,$72,$6F,$72,$0A,$00
+S0004	:=	S0002+0
+S0003:
+	.byte	$6F,$6B,$0A,$00
+S0001	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ t1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_t1a: near
+
+	.dbg	func, "t1a", "00", static, "_t1a"
+	.dbg	sym, "a", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "ifexpr.c", 12
+	ldx     #$B0
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "ifexpr.c", 14
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$50
+	bvc     L0002
+	eor     #$80
+L0002:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jmp     L0004
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+L0004:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "ifexpr.c", 15
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ t1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_t1b: near
+
+	.dbg	func, "t1b", "00", static, "_t1b"
+	.dbg	sym, "a", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "ifexpr.c", 19
+	ldx     #$B0
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "ifexpr.c", 21
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$50
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "ifexpr.c", 23
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "ifexpr.c", 25
+	jmp     L0004
+	.dbg	line, "ifexpr.c", 27
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "ifexpr.c", 29
+L0004:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "ifexpr.c", 33
+	jsr     _t1a
+	jsr     _t1b
+	.dbg	line, "ifexpr.c", 35
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "ifexpr.c", 36
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,268 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+	.export		_memchar
+	.export		_memint
+	.export		_regchar
+	.export		_regint
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$64,$69,$73,$61,$73,$73,$65,$6D,$62,$6C,$65,$20,$74,$68,$69,$73
+	.byte	$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$74,$6F,$20,$63,$68,$65,$63
+	.byte	$6B,$20,$74,$68,$65,$20,$67,$65,$6E,$65,$72,$61,$74,$65,$64,$20
+	.byte	$63,$6F,$64,$65,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memchar: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	jsr     ldptr10sp
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (c_sp),y
+	jsr     ldptr10sp
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	ldy     #$02
+	sta     (c_sp),y
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memint: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	jsr     ldax0sp
+	jsr     ldaxi
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	jsr     addeq0sp
+	ldx     #$00
+	lda     #$02
+	jsr     addeq0sp
+	jsr     ldaxi
+	ldy     #$02
+	jsr     staxysp
+	jsr     ldax0sp
+	jsr     ldaxi
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	jsr     subeq0sp
+	ldx     #$00
+	lda     #$02
+	jsr     subeq0sp
+	jsr     ldaxi
+	ldy     #$02
+	jsr     staxysp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regchar: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+3
+	ldx     regbank+4
+	jsr     pushax
+	ldy     #$00
+	lda     (regbank+3),y
+	sta     regbank+5
+	inc     regbank+3
+	bne     L0002
+	inc     regbank+3+1
+L0002:	inc     regbank+3
+	bne     L0008
+	inc     regbank+3+1
+L0008:	lda     (regbank+3),y
+	sta     regbank+5
+	lda     (regbank+3),y
+	sta     regbank+5
+	lda     regbank+3
+	bne     L0004
+	dec     regbank+3+1
+L0004:	dec     regbank+3
+	ldx     regbank+3
+	bne     L0005
+	dec     regbank+3+1
+L0005:	dex
+	stx     regbank+3
+	stx     ptr1
+	ldx     regbank+3+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1),y
+	sta     regbank+5
+	pha
+L0006:	lda     (c_sp),y
+	sta     regbank+3,y
+	iny
+	cpy     #$03
+	bne     L0006
+	pla
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regint: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	bcc     L0002
+	inc     regbank+2+1
+L0002:	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	bcc     L0003
+	inc     regbank+2+1
+L0003:	ldx     regbank+2+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L0004
+	dec     regbank+2+1
+L0004:	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L0005
+	dec     regbank+2+1
+L0005:	ldx     regbank+2+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	pha
+	ldy     #$00
+L0006:	lda     (c_sp),y
+	sta     regbank+2,y
+	iny
+	cpy     #$04
+	bne     L0006
+	pla
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,309 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "incr.c", 762, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+	.export		_memchar
+	.export		_memint
+	.export		_regchar
+	.export		_regint
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$64,$69,$73,$61,$73,$73,$65,$6D,$62,$6C,$65,$20,$74,$68,$69,$73
+	.byte	$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$74,$6F,$20,$63,$68,$65,$63
+	.byte	$6B,$20,$74,$68,$65,$20,$67,$65,$6E,$65,$72,$61,$74,$65,$64,$20
+	.byte	$63,$6F,$64,$65,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "incr.c", 11
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "incr.c", 12
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "incr.c", 13
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memchar: near
+
+	.dbg	func, "memchar", "00", static, "_memchar"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "p", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "incr.c", 18
+	jsr     decsp3
+	.dbg	line, "incr.c", 19
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "incr.c", 20
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "incr.c", 21
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "incr.c", 22
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "incr.c", 23
+	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ memint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_memint: near
+
+	.dbg	func, "memint", "00", static, "_memint"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "incr.c", 28
+	jsr     decsp4
+	.dbg	line, "incr.c", 29
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "incr.c", 30
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "incr.c", 31
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "incr.c", 32
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "incr.c", 33
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regchar: near
+
+	.dbg	func, "regchar", "00", static, "_regchar"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "p", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "incr.c", 38
+	jsr     decsp3
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "incr.c", 39
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "incr.c", 40
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "incr.c", 41
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$02
+	sta     (c_sp),y
+	.dbg	line, "incr.c", 42
+	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regint: near
+
+	.dbg	func, "regint", "00", static, "_regint"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "incr.c", 47
+	jsr     decsp4
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "incr.c", 48
+	ldy     #$00
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "incr.c", 49
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "incr.c", 50
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "incr.c", 51
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,416 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f
+	.export		_g
+	.export		_h
+	.export		_words
+	.export		_wordlist
+	.export		_x
+	.export		_y
+	.export		_main
+
+.segment	"DATA"
+
+_words:
+	.word	$0001
+	.word	$0002
+	.word	$0003
+	.byte	$69,$66,$00
+	.res	3,$00
+	.word	$0004
+	.word	$0005
+	.res	2,$00
+	.byte	$66
+	.byte	$6F
+	.byte	$72
+	.res	3,$00
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.byte	$65,$6C,$73,$65,$00
+	.res	1,$00
+	.word	$0009
+	.word	$000A
+	.word	$000B
+	.byte	$77
+	.byte	$68
+	.byte	$69
+	.byte	$6C
+	.byte	$65
+	.res	1,$00
+	.word	$0000
+	.res	4,$00
+	.res	6,$00
+_wordlist:
+	.addr	_words
+_x:
+	.word	$0001
+	.word	$0002
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0006
+	.res	6,$00
+	.word	$0007
+	.res	8,$00
+_y:
+	.addr	_x
+	.addr	_x+10
+	.addr	_x+20
+	.word	$0000
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$20,$25,$73,$0A,$00
+S0008:
+	.byte	$77,$68,$69,$6C,$65,$00
+S0007:
+	.byte	$65,$6C,$73,$65,$00
+S0006:
+	.byte	$66,$6F,$72,$00
+S0009	:=	S000C+9
+S000A:
+	.byte	$25,$64,$20,$00
+S000B	:=	S000C+9
+S0003:
+	.byte	$20,$25,$64,$00
+S0005:
+	.byte	$69,$66,$00
+S0004	:=	S000C+11
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0003
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$02
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.segment	"DATA"
+
+M0001:
+	.addr	S0005
+	.addr	S0006
+	.addr	S0007
+	.addr	S0008
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ g (struct $anon-struct-0007 *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0003
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0006:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$00
+	bne     L000A
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+L000A:	bcs     L0007
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0006
+L0007:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax6
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$02
+	ldx     #$00
+	lda     #$0C
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     _h
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ h (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_h: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$00
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$05
+L0006:	bcs     L0003
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosmula0
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosmula0
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     incax2
+	jsr     pushw
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosmula0
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     incax4
+	jsr     pushw
+	ldy     #$0B
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosmula0
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     incax6
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	sta     ptr1
+	txa
+	adc     #>(_y)
+	tax
+	ldy     #$00
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0003
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0006:	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_y)
+	tay
+	txa
+	adc     #>(_y)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0006
+L0007:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     _f
+	lda     _wordlist
+	ldx     _wordlist+1
+	jsr     _g
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
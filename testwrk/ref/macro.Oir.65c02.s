@@ -0,0 +1,168 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_fs
+	.export		_fd
+	.export		_a
+	.export		__func
+	.export		_main
+
+.segment	"DATA"
+
+_fs:
+	.dword	$00000007
+_fd:
+	.dword	$00000005
+_a:
+	.dword	$00000003
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$78,$3A,$25,$6C,$64,$20,$79,$3A,$25,$6C,$64,$0A,$00
+S0003:
+	.byte	$66,$73,$3A,$25,$6C,$64,$0A,$00
+S0002	:=	S0003+0
+
+; ---------------------------------------------------------------
+; unsigned long __near__ _func (unsigned long x, unsigned long y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__func: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	stz     sreg+1
+	stz     sreg
+	tax
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _fd+3
+	sta     sreg+1
+	lda     _fd+2
+	sta     sreg
+	ldx     _fd+1
+	lda     _fd
+	jsr     pusheax
+	lda     _a+3
+	sta     sreg+1
+	lda     _a+2
+	sta     sreg
+	ldx     _a+1
+	lda     _a
+	jsr     tosudiveax
+	jsr     pusheax
+	lda     #$02
+	ldx     #$00
+	jsr     push0ax
+	lda     #$82
+	sta     sreg
+	lda     #$0F
+	ldx     #$C9
+	jsr     __func
+	jsr     __func
+	sta     _fs
+	stx     _fs+1
+	ldy     sreg
+	sty     _fs+2
+	ldy     sreg+1
+	sty     _fs+3
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fs+3
+	sta     sreg+1
+	lda     _fs+2
+	sta     sreg
+	ldx     _fs+1
+	lda     _fs
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	lda     _fd+3
+	sta     sreg+1
+	lda     _fd+2
+	sta     sreg
+	ldx     _fd+1
+	lda     _fd
+	jsr     pusheax
+	lda     _a+3
+	sta     sreg+1
+	lda     _a+2
+	sta     sreg
+	ldx     _a+1
+	lda     _a
+	jsr     tosudiveax
+	jsr     pusheax
+	lda     #$02
+	ldx     #$00
+	jsr     push0ax
+	lda     #$82
+	sta     sreg
+	lda     #$0F
+	ldx     #$C9
+	jsr     __func
+	jsr     __func
+	sta     _fs
+	stx     _fs+1
+	ldy     sreg
+	sty     _fs+2
+	ldy     sreg+1
+	sty     _fs+3
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fs+3
+	sta     sreg+1
+	lda     _fs+2
+	sta     sreg
+	ldx     _fs+1
+	lda     _fs
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
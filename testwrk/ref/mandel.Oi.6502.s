@@ -0,0 +1,379 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_abs
+	.export		_dither
+	.export		_mandelbrot
+	.export		_main
+
+.segment	"DATA"
+
+_dither:
+	.byte	$20,$2E,$2A,$6F,$2B,$30,$25,$23
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$63,$00
+S0004:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_SCREEN_X:
+	.res	2,$00
+_SCREEN_Y:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ mandelbrot (short x1, short y1, short x2, short y2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mandelbrot: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$12
+	jsr     subysp
+	ldy     #$15
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	ldy     #$18
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosudivax
+	ldy     #$09
+	jsr     staxysp
+	ldy     #$13
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	ldy     #$16
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_Y
+	jsr     tosdiva0
+	ldy     #$07
+	jsr     staxysp
+	ldy     #$17
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$03
+	jsr     staxysp
+	lda     #$00
+	tay
+L001B:	sta     (c_sp),y
+	cmp     _SCREEN_Y
+	jcs     L0003
+	ldy     #$07
+	lda     (c_sp),y
+	ldy     #$03
+	clc
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$08
+	lda     (c_sp),y
+	ldy     #$04
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$19
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$01
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0006:	ldy     #$02
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     _SCREEN_X
+	txa
+	sbc     _SCREEN_X+1
+	jcs     L0007
+	ldy     #$09
+	lda     (c_sp),y
+	ldy     #$05
+	clc
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$0A
+	lda     (c_sp),y
+	ldy     #$06
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$10
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$0C
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$0B
+L0019:	sta     (c_sp),y
+	cmp     #$10
+	jcs     L001F
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L000F
+	eor     #$80
+L000F:	jpl     L000B
+	ldy     #$0D
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L0010
+	eor     #$80
+L0010:	jpl     L000B
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0013
+	dey
+L0013:	sty     sreg+1
+	jsr     asreax4
+	jsr     pusheax
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0014
+	dey
+L0014:	sty     sreg+1
+	jsr     asreax4
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$0A
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0015
+	dey
+L0015:	sty     sreg+1
+	jsr     asreax3
+	jsr     pusheax
+	ldy     #$08
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0F
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0B
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0019
+L000B:	ldy     #$0B
+L001F:	lda     (c_sp),y
+	cmp     #$10
+	bne     L0016
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jmp     L001A
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0D
+	lda     (c_sp),y
+	and     #$07
+	sta     ptr1
+	clc
+	lda     #>(_dither)
+	sta     ptr1+1
+	ldy     #<(_dither)
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$04
+L001A:	jsr     _printf
+	ldy     #$01
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	jmp     L0006
+L0007:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L001B
+L0003:	ldy     #$1A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$50
+	sta     _SCREEN_X
+	stx     _SCREEN_X+1
+	lda     #$28
+	sta     _SCREEN_Y
+	jsr     decsp6
+	txa
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$E0
+	sta     (c_sp),y
+	txa
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$E0
+	sta     (c_sp),y
+	txa
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$20
+	sta     (c_sp),y
+	tax
+	lda     #$00
+	jsr     _mandelbrot
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,295 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_abs
+	.export		_dither
+	.export		_mandelbrot
+	.export		_main
+
+.segment	"DATA"
+
+_dither:
+	.byte	$20,$2E,$2A,$6F,$2B,$30,$25,$23
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$63,$00
+S0004:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_SCREEN_X:
+	.res	2,$00
+_SCREEN_Y:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ mandelbrot (short x1, short y1, short x2, short y2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mandelbrot: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$12
+	jsr     subysp
+	ldy     #$15
+	jsr     ldaxysp
+	sec
+	ldy     #$18
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosudivax
+	ldy     #$09
+	jsr     staxysp
+	ldy     #$13
+	jsr     ldaxysp
+	sec
+	ldy     #$16
+	sbc     (c_sp),y
+	pha
+	txa
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_Y
+	jsr     tosdiva0
+	ldy     #$07
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     staxysp
+	lda     #$00
+L001B:	sta     (c_sp)
+	cmp     _SCREEN_Y
+	jcs     L0003
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     addeqysp
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$01
+	jsr     staxysp
+L0006:	ldy     #$02
+	jsr     ldaxysp
+	cmp     _SCREEN_X
+	txa
+	sbc     _SCREEN_X+1
+	jcs     L0007
+	ldy     #$0A
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     addeqysp
+	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0B
+L0019:	sta     (c_sp),y
+	cmp     #$10
+	jcs     L001F
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L000F
+	eor     #$80
+L000F:	jpl     L000B
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L0010
+	eor     #$80
+L0010:	jpl     L000B
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0013
+	dey
+L0013:	sty     sreg+1
+	jsr     asreax4
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0014
+	dey
+L0014:	sty     sreg+1
+	jsr     asreax4
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0015
+	dey
+L0015:	sty     sreg+1
+	jsr     asreax3
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0B
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	jmp     L0019
+L000B:	ldy     #$0B
+L001F:	lda     (c_sp),y
+	cmp     #$10
+	bne     L0016
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	bra     L001A
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0D
+	lda     (c_sp),y
+	and     #$07
+	sta     ptr1
+	clc
+	lda     #>(_dither)
+	sta     ptr1+1
+	ldy     #<(_dither)
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$04
+L001A:	jsr     _printf
+	ldy     #$01
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	jmp     L0006
+L0007:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	clc
+	lda     #$01
+	adc     (c_sp)
+	jmp     L001B
+L0003:	ldy     #$1A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$50
+	sta     _SCREEN_X
+	stz     _SCREEN_X+1
+	lda     #$28
+	sta     _SCREEN_Y
+	ldx     #$E0
+	lda     #$00
+	jsr     pushax
+	jsr     pushax
+	ldx     #$20
+	jsr     pushax
+	jsr     _mandelbrot
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,459 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fprintf
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		_atoi
+	.export		_help
+	.export		_fib
+	.export		_fact
+	.export		_print_num
+	.export		_mymain
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$43,$6F,$6D,$70,$75,$74,$65,$20,$66,$69,$62,$28,$6E,$29,$20,$61
+	.byte	$6E,$64,$20,$66,$61,$63,$74,$28,$6E,$29,$20,$61,$6E,$64,$20,$6F
+	.byte	$75,$74,$70,$75,$74,$20,$74,$68,$65,$20,$72,$65,$73,$75,$6C,$74
+	.byte	$20,$69,$6E,$20,$62,$61,$73,$65,$20,$27,$62,$61,$73,$65,$27,$0A
+	.byte	$00
+S0009:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$6E,$20,$5B,$62,$61,$73
+	.byte	$65,$5D,$0A,$00
+S0003:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$62,$61,$73,$65,$0A,$00
+S0006:
+	.byte	$66,$61,$63,$74,$28,$25,$64,$29,$20,$3D,$20,$00
+S0004:
+	.byte	$66,$69,$62,$28,$25,$64,$29,$20,$3D,$0A,$00
+S0001:
+	.byte	$5B,$66,$69,$62,$28,$25,$64,$29,$5D,$00
+S0007:
+	.byte	$4F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S000B:
+	.byte	$6F,$74,$63,$63,$65,$78,$00
+S0002:
+	.byte	$25,$63,$00
+S000C:
+	.byte	$31,$30,$00
+S0008	:=	S000A+63
+S000D:
+	.byte	$38,$00
+S0005	:=	S000A+63
+
+; ---------------------------------------------------------------
+; void __near__ help (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_help: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ fib (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fib: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jsr     ldax0sp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     incsp2
+L0002:	jsr     ldax0sp
+	jsr     decax1
+	jsr     _fib
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax2
+	jsr     _fib
+	jsr     tosaddax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ fact (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     steax0sp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0006
+	bpl     L0003
+L0006:	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	jsr     steax0sp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jsr     ldeax0sp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print_num (n, b) long n; int b;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print_num: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp5
+	ldx     #$01
+	lda     #$00
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	ldy     #$01
+	jsr     staxysp
+L0002:	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$00
+	sta     (c_sp),y
+	cmp     #$0A
+	ldx     #$00
+	bcc     L000E
+	lda     (c_sp),y
+	ldy     #$61
+	jsr     incaxy
+	ldy     #$0A
+	jsr     decaxy
+	jmp     L000F
+L000E:	lda     (c_sp),y
+	ldy     #$30
+	jsr     incaxy
+L000F:	ldy     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	jsr     ldptr1ysp
+	ldy     #$00
+	lda     (c_sp),y
+	sta     (ptr1),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$07
+	jsr     steaxysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     toseqeax
+	beq     L0002
+	jmp     L000A
+L0008:	ldx     #$00
+	lda     #$01
+	tay
+	jsr     subeqysp
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	ldy     #$03
+	cmp     (c_sp),y
+	bne     L0008
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L0008
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$0B
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ mymain (argc, argv) int argc; char **argv;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mymain: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$0B
+	lda     (c_sp),y
+	bne     L0014
+	dey
+	lda     (c_sp),y
+	cmp     #$02
+	beq     L0002
+	iny
+L0014:	lda     (c_sp),y
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	beq     L0002
+L0006:	ldy     #$09
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$06
+	jsr     staxysp
+	jsr     _help
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	dey
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _atoi
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	jsr     stax0sp
+	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	bpl     L000A
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     _atoi
+	jsr     stax0sp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	bmi     L0012
+	jsr     ldax0sp
+	cmp     #$25
+	txa
+	sbc     #$00
+	bvs     L000D
+	eor     #$80
+L000D:	bpl     L000A
+L0012:	lda     _stdout
+	ldx     _stdout+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _fib
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$0D
+	txa
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	bpl     L000F
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L000F:	lda     #<(_fact)
+	ldx     #>(_fact)
+	ldy     #$04
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+L0011:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+L0001:	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     stax0sp
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	ldy     #$04
+	jsr     staxysp
+	lda     #$03
+	jsr     pusha0
+	lda     #$02
+	jsr     leaa0sp
+	jmp     _mymain
+
+.endproc
+
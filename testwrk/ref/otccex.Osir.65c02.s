@@ -0,0 +1,562 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fprintf
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		_atoi
+	.export		_help
+	.export		_fib
+	.export		_fact
+	.export		_print_num
+	.export		_mymain
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$43,$6F,$6D,$70,$75,$74,$65,$20,$66,$69,$62,$28,$6E,$29,$20,$61
+	.byte	$6E,$64,$20,$66,$61,$63,$74,$28,$6E,$29,$20,$61,$6E,$64,$20,$6F
+	.byte	$75,$74,$70,$75,$74,$20,$74,$68,$65,$20,$72,$65,$73,$75,$6C,$74
+	.byte	$20,$69,$6E,$20,$62,$61,$73,$65,$20,$27,$62,$61,$73,$65,$27,$0A
+	.byte	$00
+S0009:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$6E,$20,$5B,$62,$61,$73
+	.byte	$65,$5D,$0A,$00
+S0003:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$62,$61,$73,$65,$0A,$00
+S0006:
+	.byte	$66,$61,$63,$74,$28,$25,$64,$29,$20,$3D,$20,$00
+S0004:
+	.byte	$66,$69,$62,$28,$25,$64,$29,$20,$3D,$0A,$00
+S0001:
+	.byte	$5B,$66,$69,$62,$28,$25,$64,$29,$5D,$00
+S0007:
+	.byte	$4F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S000B:
+	.byte	$6F,$74,$63,$63,$65,$78,$00
+S0002:
+	.byte	$25,$63,$00
+S000C:
+	.byte	$31,$30,$00
+S0008	:=	S000A+63
+S000D:
+	.byte	$38,$00
+S0005	:=	S000A+63
+
+; ---------------------------------------------------------------
+; void __near__ help (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_help: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ fib (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fib: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	ldx     #$00
+	tya
+	jmp     incsp2
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sec
+	sbc     #$01
+	bcs     L0005
+	dex
+L0005:	jsr     _fib
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     #$02
+	bcs     L0006
+	dex
+L0006:	jsr     _fib
+	jsr     tosaddax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ fact (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #$01
+	sta     (c_sp)
+	dea
+	ldy     #$01
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #$00
+	iny
+	sta     (c_sp),y
+L0002:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     tosicmp
+	beq     L0006
+	bpl     L0003
+L0006:	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	jsr     steax0sp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0003:	jsr     ldeax0sp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print_num (n, b) long n; int b;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print_num: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp5
+	ldx     #$01
+	lda     #$00
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	ldy     #$01
+	jsr     staxysp
+L0002:	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosmodeax
+	sta     (c_sp)
+	cmp     #$0A
+	bcc     L0011
+	lda     (c_sp)
+	clc
+	adc     #$61
+	sec
+	sbc     #$0A
+	bra     L000F
+L0011:	lda     (c_sp)
+	clc
+	adc     #$30
+L000F:	sta     (c_sp)
+	ldy     #$02
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (c_sp)
+	sta     (ptr1)
+	ldy     #$01
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$07
+	jsr     steaxysp
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	stz     sreg+1
+	stz     sreg
+	tax
+	jsr     toseqeax
+	beq     L0002
+	bra     L000D
+L000B:	ldx     #$00
+	lda     #$01
+	tay
+	jsr     subeqysp
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000D:	ldy     #$02
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$03
+	cmp     (c_sp),y
+	bne     L000B
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L000B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _free
+	ldy     #$0B
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ mymain (argc, argv) int argc; char **argv;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mymain: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$0B
+	lda     (c_sp),y
+	bne     L0016
+	dey
+	lda     (c_sp),y
+	cmp     #$02
+	beq     L0002
+	iny
+L0016:	lda     (c_sp),y
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	beq     L0002
+L0006:	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$06
+	jsr     staxysp
+	jsr     _help
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	dey
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L0008
+	inx
+L0008:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _atoi
+	ldy     #$02
+	jsr     staxysp
+	lda     #$0A
+	sta     (c_sp)
+	lda     #$00
+	ldy     #$01
+	sta     (c_sp),y
+	ldy     #$0B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvs     L000A
+	eor     #$80
+L000A:	bpl     L000C
+	dey
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$04
+	bcc     L000B
+	inx
+L000B:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     _atoi
+	jsr     stax0sp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L000D
+	eor     #$80
+L000D:	bmi     L0014
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$25
+	txa
+	sbc     #$00
+	bvs     L000F
+	eor     #$80
+L000F:	bpl     L000C
+L0014:	jsr     decsp4
+	lda     _stdout
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _stdout+1
+	sta     (c_sp),y
+	lda     #<(S0003)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0003)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L000C:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _fib
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _print_num
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$0D
+	txa
+	sbc     #$00
+	bvs     L0012
+	eor     #$80
+L0012:	bpl     L0011
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	bra     L0013
+L0011:	lda     #<(_fact)
+	ldx     #>(_fact)
+	ldy     #$04
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	pha
+	lda     (c_sp)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     pusheax
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _print_num
+L0013:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+L0001:	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     stax0sp
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	ldy     #$04
+	jsr     staxysp
+	lda     #$03
+	jsr     pusha0
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$02
+	bcc     L0002
+	inx
+L0002:	jmp     _mymain
+
+.endproc
+
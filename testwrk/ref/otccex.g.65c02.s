@@ -0,0 +1,660 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "otccex.c", 3918, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.import		_fprintf
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		_atoi
+	.export		_help
+	.export		_fib
+	.export		_fact
+	.export		_print_num
+	.export		_mymain
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$43,$6F,$6D,$70,$75,$74,$65,$20,$66,$69,$62,$28,$6E,$29,$20,$61
+	.byte	$6E,$64,$20,$66,$61,$63,$74,$28,$6E,$29,$20,$61,$6E,$64,$20,$6F
+	.byte	$75,$74,$70,$75,$74,$20,$74,$68,$65,$20,$72,$65,$73,$75,$6C,$74
+	.byte	$20,$69,$6E,$20,$62,$61,$73,$65,$20,$27,$62,$61,$73,$65,$27,$0A
+	.byte	$00
+S0009:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$6E,$20,$5B,$62,$61,$73
+	.byte	$65,$5D,$0A,$00
+S0003:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$62,$61,$73,$65,$0A,$00
+S0006:
+	.byte	$66,$61,$63,$74,$28,$25,$64,$29,$20,$3D,$20,$00
+S0004:
+	.byte	$66,$69,$62,$28,$25,$64,$29,$20,$3D,$0A,$00
+S0001:
+	.byte	$5B,$66,$69,$62,$28,$25,$64,$29,$5D,$00
+S0007:
+	.byte	$4F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S000B:
+	.byte	$6F,$74,$63,$63,$65,$78,$00
+S0002:
+	.byte	$25,$63,$00
+S000C:
+	.byte	$31,$30,$00
+S0008	:=	S000A+63
+S000D:
+	.byte	$38,$00
+S0005	:=	S000A+63
+
+; ---------------------------------------------------------------
+; void __near__ help (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_help: near
+
+	.dbg	func, "help", "00", static, "_help"
+	.dbg	sym, "name", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 142
+	jsr     pushax
+	.dbg	line, "otccex.c", 143
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "otccex.c", 144
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "otccex.c", 145
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ fib (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fib: near
+
+	.dbg	func, "fib", "00", static, "_fib"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 36
+	jsr     pushax
+	.dbg	line, "otccex.c", 37
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "otccex.c", 38
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "otccex.c", 39
+	ldx     #$00
+	lda     #$01
+	jmp     L0004
+	.dbg	line, "otccex.c", 40
+	jmp     L0004
+	.dbg	line, "otccex.c", 41
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fib
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax2
+	jsr     _fib
+	jsr     tosaddax
+	jmp     L0004
+	.dbg	line, "otccex.c", 42
+L0004:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ fact (n) int n;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+	.dbg	func, "fact", "00", static, "_fact"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "r", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 48
+	jsr     pushax
+	.dbg	line, "otccex.c", 53
+	jsr     decsp6
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	ldy     #$00
+	jsr     steaxysp
+	.dbg	line, "otccex.c", 55
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosleax
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "otccex.c", 56
+L0005:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$00
+	jsr     steaxysp
+	.dbg	line, "otccex.c", 55
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "otccex.c", 57
+L0003:	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0001
+	.dbg	line, "otccex.c", 58
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ print_num (n, b) long n; int b;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print_num: near
+
+	.dbg	func, "print_num", "00", static, "_print_num"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "b", "00", auto, 0
+	.dbg	sym, "tab", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "c", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 63
+	jsr     pushax
+	.dbg	line, "otccex.c", 69
+	jsr     decsp5
+	ldx     #$01
+	lda     #$00
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "otccex.c", 70
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "otccex.c", 71
+	jmp     L0007
+	.dbg	line, "otccex.c", 72
+L0002:	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "otccex.c", 74
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$0A
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "otccex.c", 75
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$61
+	jsr     incaxy
+	ldy     #$0A
+	jsr     decaxy
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "otccex.c", 76
+	jmp     L0006
+	.dbg	line, "otccex.c", 77
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$30
+	jsr     incaxy
+	ldx     #$00
+	ldy     #$00
+	sta     (c_sp),y
+	.dbg	line, "otccex.c", 78
+L0006:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "otccex.c", 79
+	ldy     #$01
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "otccex.c", 80
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$07
+	jsr     steaxysp
+	.dbg	line, "otccex.c", 82
+	ldy     #$0A
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     toseqeax
+	jeq     L0007
+	.dbg	line, "otccex.c", 83
+	jmp     L0003
+	.dbg	line, "otccex.c", 71
+L0007:	jmp     L0002
+	.dbg	line, "otccex.c", 85
+L0003:	jmp     L000A
+	.dbg	line, "otccex.c", 86
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$01
+	jsr     subeqysp
+	.dbg	line, "otccex.c", 87
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "otccex.c", 85
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L0008
+	.dbg	line, "otccex.c", 89
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _free
+	.dbg	line, "otccex.c", 90
+	ldy     #$0B
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ mymain (argc, argv) int argc; char **argv;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mymain: near
+
+	.dbg	func, "mymain", "00", static, "_mymain"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+	.dbg	sym, "s", "00", auto, -2
+	.dbg	sym, "f", "00", auto, -4
+	.dbg	sym, "n", "00", auto, -6
+	.dbg	sym, "base", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 95
+	jsr     pushax
+	.dbg	line, "otccex.c", 105
+	jsr     decsp8
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$02
+L0003:	jsr     boolne
+	jeq     L0004
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$03
+L0005:	jsr     boolne
+	jne     L0006
+L0004:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0002
+	.dbg	line, "otccex.c", 109
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "otccex.c", 110
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _help
+	.dbg	line, "otccex.c", 111
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "otccex.c", 114
+L0002:	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "otccex.c", 115
+	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "otccex.c", 116
+	ldy     #$0B
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "otccex.c", 117
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _atoi
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "otccex.c", 118
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000C
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$25
+	txa
+	sbc     #$00
+	bvs     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000C
+	ldx     #$00
+	lda     #$00
+	jeq     L000E
+L000C:	ldx     #$00
+	lda     #$01
+L000E:	jeq     L000A
+	.dbg	line, "otccex.c", 120
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "otccex.c", 121
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "otccex.c", 124
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "otccex.c", 125
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _fib
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+	.dbg	line, "otccex.c", 126
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "otccex.c", 128
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "otccex.c", 129
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$0D
+	txa
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	.dbg	line, "otccex.c", 130
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "otccex.c", 131
+	jmp     L0011
+	.dbg	line, "otccex.c", 133
+L000F:	lda     #<(_fact)
+	ldx     #>(_fact)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "otccex.c", 134
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	pha
+	ldy     #$00
+	lda     (c_sp),y
+	sta     jmpvec+1
+	iny
+	lda     (c_sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _print_num
+	.dbg	line, "otccex.c", 136
+L0011:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "otccex.c", 137
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "otccex.c", 138
+L0001:	ldy     #$0C
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argv", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "otccex.c", 151
+	jsr     decsp6
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "otccex.c", 152
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "otccex.c", 153
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "otccex.c", 154
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _mymain
+	jmp     L0001
+	.dbg	line, "otccex.c", 155
+L0001:	rts
+
+	.dbg	line
+.endproc
+
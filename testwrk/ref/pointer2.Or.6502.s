@@ -0,0 +1,316 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_i1
+	.export		_test1
+	.export		_t1
+	.export		_t2
+	.export		_t3
+	.export		_t4
+	.export		_test2
+	.export		_a3
+	.export		_test3a
+	.export		_main
+
+.segment	"DATA"
+
+_t1:
+	.byte	$61,$62,$63,$64,$65,$00
+_t2:
+	.byte	$61,$62,$63,$64,$65,$00
+_t3:
+	.addr	S0006
+_t4:
+	.addr	S0007
+_a3:
+	.addr	S000B
+	.word	$0000
+	.addr	S000C
+	.word	$0000
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$73,$69,$7A,$65,$6F,$66,$28,$69,$31,$5B,$30,$5D,$29,$20,$67,$69
+	.byte	$76,$65,$73,$20,$73,$69,$7A,$65,$20,$6F,$66,$20,$70,$6F,$69,$6E
+	.byte	$74,$65,$72,$20,$74,$6F,$20,$65,$6C,$65,$6D,$65,$6E,$74,$0A,$00
+S0002:
+	.byte	$73,$69,$7A,$65,$6F,$66,$28,$69,$31,$5B,$30,$5D,$29,$20,$67,$69
+	.byte	$76,$65,$73,$20,$73,$69,$7A,$65,$20,$6F,$66,$20,$65,$6C,$65,$6D
+	.byte	$65,$6E,$74,$0A,$00
+S0009:
+	.byte	$74,$65,$73,$74,$32,$20,$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$25,$63,$20,$25,$63,$20,$25,$63,$20,$25,$63,$0A,$00
+S000A:
+	.byte	$74,$65,$73,$74,$32,$20,$6F,$6B,$2E,$0A,$00
+S0001:
+	.byte	$25,$30,$34,$78,$20,$2D,$20,$00
+S000D:
+	.byte	$25,$73,$20,$25,$64,$0A,$00
+S000B:
+	.byte	$74,$65,$73,$74,$33,$00
+S0007:
+	.byte	$61,$62,$63,$64,$65,$00
+S0006	:=	S0007+0
+S000C	:=	S000B+0
+
+.segment	"BSS"
+
+_i1:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	jsr     stax0sp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	jsr     push0
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$05
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_t1)
+	sta     ptr1+1
+	ldy     #<(_t1)
+	lda     (ptr1),y
+	ldy     #$07
+	sta     (c_sp),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_t2)
+	sta     ptr1+1
+	ldy     #<(_t2)
+	lda     (ptr1),y
+	ldy     #$06
+	sta     (c_sp),y
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     _t3
+	sta     ptr1
+	txa
+	adc     _t3+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$05
+	sta     (c_sp),y
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     _t4
+	sta     ptr1
+	txa
+	adc     _t4+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$04
+	sta     (c_sp),y
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0A
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0C
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$07
+	lda     (c_sp),y
+	dey
+	cmp     (c_sp),y
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$09
+	lda     (c_sp),y
+	ldy     #$07
+	cmp     (c_sp),y
+	jsr     booleq
+	jsr     tosanda0
+	jsr     pusha0
+	ldy     #$09
+	lda     (c_sp),y
+	ldy     #$06
+	cmp     (c_sp),y
+	jsr     booleq
+	jsr     tosanda0
+	cmp     #$00
+	bne     L0004
+	lda     #$01
+	jsr     stax0sp
+L0004:	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0008
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jmp     L000C
+L0008:	lda     #<(S000A)
+	ldx     #>(S000A)
+L000C:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test3a (struct $anon-struct-0007 *list, int number)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test31 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test31: near
+
+.segment	"CODE"
+
+	lda     #<(_a3)
+	ldx     #>(_a3)
+	jsr     pushax
+	ldx     #$FF
+	txa
+	jmp     _test3a
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test30 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test30: near
+
+.segment	"CODE"
+
+	lda     #<(_a3)
+	ldx     #>(_a3)
+	jsr     pushax
+	ldx     #$FF
+	txa
+	jmp     _test3a
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test1
+	jsr     _test2
+	jsr     _test30
+	jsr     _test31
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
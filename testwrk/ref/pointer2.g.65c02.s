@@ -0,0 +1,420 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "pointer2.c", 2151, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_i1
+	.export		_test1
+	.export		_t1
+	.export		_t2
+	.export		_t3
+	.export		_t4
+	.export		_test2
+	.export		_a3
+	.export		_test3a
+	.export		_main
+
+.segment	"DATA"
+
+_t1:
+	.byte	$61,$62,$63,$64,$65,$00
+_t2:
+	.byte	$61,$62,$63,$64,$65,$00
+_t3:
+	.addr	S0006
+_t4:
+	.addr	S0007
+_a3:
+	.addr	S000B
+	.word	$0000
+	.addr	S000C
+	.word	$0000
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$73,$69,$7A,$65,$6F,$66,$28,$69,$31,$5B,$30,$5D,$29,$20,$67,$69
+	.byte	$76,$65,$73,$20,$73,$69,$7A,$65,$20,$6F,$66,$20,$70,$6F,$69,$6E
+	.byte	$74,$65,$72,$20,$74,$6F,$20,$65,$6C,$65,$6D,$65,$6E,$74,$0A,$00
+S0002:
+	.byte	$73,$69,$7A,$65,$6F,$66,$28,$69,$31,$5B,$30,$5D,$29,$20,$67,$69
+	.byte	$76,$65,$73,$20,$73,$69,$7A,$65,$20,$6F,$66,$20,$65,$6C,$65,$6D
+	.byte	$65,$6E,$74,$0A,$00
+S0009:
+	.byte	$74,$65,$73,$74,$32,$20,$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$25,$63,$20,$25,$63,$20,$25,$63,$20,$25,$63,$0A,$00
+S000A:
+	.byte	$74,$65,$73,$74,$32,$20,$6F,$6B,$2E,$0A,$00
+S0001:
+	.byte	$25,$30,$34,$78,$20,$2D,$20,$00
+S000D:
+	.byte	$25,$73,$20,$25,$64,$0A,$00
+S000B:
+	.byte	$74,$65,$73,$74,$33,$00
+S0007:
+	.byte	$61,$62,$63,$64,$65,$00
+S0006	:=	S0007+0
+S000C	:=	S000B+0
+
+.segment	"BSS"
+
+_i1:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+	.dbg	func, "test1", "00", static, "_test1"
+	.dbg	sym, "a", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 19
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "pointer2.c", 20
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "pointer2.c", 23
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pointer2.c", 25
+	jmp     L0003
+	.dbg	line, "pointer2.c", 26
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pointer2.c", 28
+L0003:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", static, "_test2"
+	.dbg	sym, "c1", "00", auto, -1
+	.dbg	sym, "c2", "00", auto, -2
+	.dbg	sym, "c3", "00", auto, -3
+	.dbg	sym, "c4", "00", auto, -4
+	.dbg	sym, "i", "00", auto, -6
+	.dbg	sym, "e", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 42
+	jsr     decsp6
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "pointer2.c", 43
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$05
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "pointer2.c", 44
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     #<(_t1)
+	tay
+	txa
+	adc     #>(_t1)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$07
+	sta     (c_sp),y
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     #<(_t2)
+	tay
+	txa
+	adc     #>(_t2)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$06
+	sta     (c_sp),y
+	lda     _t3
+	ldx     _t3+1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$05
+	sta     (c_sp),y
+	lda     _t4
+	ldx     _t4+1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$04
+	sta     (c_sp),y
+	.dbg	line, "pointer2.c", 46
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$0B
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$0C
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pointer2.c", 47
+	ldy     #$07
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     toseqax
+	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     toseqax
+	jsr     tosandax
+	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     toseqax
+	jsr     tosandax
+	jsr     bnegax
+	jeq     L0004
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "pointer2.c", 43
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "pointer2.c", 49
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	jeq     L0008
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pointer2.c", 50
+	jmp     L0009
+L0008:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pointer2.c", 51
+L0009:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test3a (struct $anon-struct-0007 *list, int number)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+	.dbg	func, "test3a", "00", static, "_test3a"
+	.dbg	sym, "list", "00", auto, 2
+	.dbg	sym, "number", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 76
+	jsr     pushax
+	.dbg	line, "pointer2.c", 77
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "pointer2.c", 78
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test31 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test31: near
+
+	.dbg	func, "test31", "00", static, "_test31"
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 83
+	lda     #<(_a3)
+	ldx     #>(_a3)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     _test3a
+	.dbg	line, "pointer2.c", 84
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test30 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test30: near
+
+	.dbg	func, "test30", "00", static, "_test30"
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 97
+	lda     #<(_a3)
+	ldx     #>(_a3)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     _test3a
+	.dbg	line, "pointer2.c", 98
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "pointer2.c", 106
+	jsr     _test1
+	.dbg	line, "pointer2.c", 107
+	jsr     _test2
+	.dbg	line, "pointer2.c", 108
+	jsr     _test30
+	.dbg	line, "pointer2.c", 109
+	jsr     _test31
+	.dbg	line, "pointer2.c", 111
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "pointer2.c", 112
+L0001:	rts
+
+	.dbg	line
+.endproc
+
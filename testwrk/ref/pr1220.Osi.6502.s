@@ -0,0 +1,7169 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_s
+	.export		_t
+	.export		_flags
+	.export		_f
+	.export		_f0
+	.export		_f1
+	.export		_f2
+	.export		_f3
+	.export		_f4
+	.export		_f5
+	.export		_f0_B
+	.export		_f1_B
+	.export		_f2_B
+	.export		_f3_B
+	.export		_f4_B
+	.export		_f5_B
+	.export		_main
+
+.segment	"RODATA"
+
+S0089:
+	.byte	$66,$34,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S007C:
+	.byte	$66,$33,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0096:
+	.byte	$66,$35,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0038:
+	.byte	$66,$34,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0045:
+	.byte	$66,$35,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S002B:
+	.byte	$66,$33,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0064:
+	.byte	$66,$31,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0070:
+	.byte	$66,$32,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0013:
+	.byte	$66,$31,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S001F:
+	.byte	$66,$32,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S000C:
+	.byte	$25,$33,$64,$20,$25,$32,$58,$3A,$20,$25,$64,$0A,$00
+S000D	:=	S000C+0
+S000E	:=	S000C+0
+S000F	:=	S000C+0
+S0010	:=	S000C+0
+S0011	:=	S000C+0
+S00A1	:=	S000C+0
+S000A	:=	S000C+0
+S0014	:=	S000C+0
+S0015	:=	S000C+0
+S0016	:=	S000C+0
+S0017	:=	S000C+0
+S0018	:=	S000C+0
+S0019	:=	S000C+0
+S001A	:=	S000C+0
+S001B	:=	S000C+0
+S001C	:=	S000C+0
+S001D	:=	S000C+0
+S00A0	:=	S000C+0
+S000B	:=	S000C+0
+S0020	:=	S000C+0
+S0021	:=	S000C+0
+S0022	:=	S000C+0
+S0023	:=	S000C+0
+S0024	:=	S000C+0
+S0025	:=	S000C+0
+S0026	:=	S000C+0
+S0027	:=	S000C+0
+S0028	:=	S000C+0
+S0029	:=	S000C+0
+S009F	:=	S000C+0
+S0008	:=	S000C+0
+S002C	:=	S000C+0
+S002D	:=	S000C+0
+S002E	:=	S000C+0
+S002F	:=	S000C+0
+S0030	:=	S000C+0
+S0031	:=	S000C+0
+S0032	:=	S000C+0
+S0033	:=	S000C+0
+S0034	:=	S000C+0
+S0035	:=	S000C+0
+S0036	:=	S000C+0
+S009E	:=	S000C+0
+S0007	:=	S000C+0
+S0039	:=	S000C+0
+S003A	:=	S000C+0
+S003B	:=	S000C+0
+S003C	:=	S000C+0
+S003D	:=	S000C+0
+S003E	:=	S000C+0
+S003F	:=	S000C+0
+S0040	:=	S000C+0
+S0041	:=	S000C+0
+S0042	:=	S000C+0
+S0043	:=	S000C+0
+S009D	:=	S000C+0
+S0006	:=	S000C+0
+S0046	:=	S000C+0
+S0047	:=	S000C+0
+S0048	:=	S000C+0
+S0049	:=	S000C+0
+S004A	:=	S000C+0
+S004B	:=	S000C+0
+S004C	:=	S000C+0
+S004D	:=	S000C+0
+S004E	:=	S000C+0
+S004F	:=	S000C+0
+S0050	:=	S000C+0
+S009C	:=	S000C+0
+S0097	:=	S000C+0
+S0053	:=	S000C+0
+S0054	:=	S000C+0
+S0055	:=	S000C+0
+S0056	:=	S000C+0
+S0057	:=	S000C+0
+S0058	:=	S000C+0
+S0059	:=	S000C+0
+S005A	:=	S000C+0
+S005B	:=	S000C+0
+S005C	:=	S000C+0
+S005D	:=	S000C+0
+S005E	:=	S000C+0
+S005F	:=	S000C+0
+S0060	:=	S000C+0
+S0061	:=	S000C+0
+S0062	:=	S000C+0
+S009B	:=	S000C+0
+S0005	:=	S000C+0
+S0065	:=	S000C+0
+S0066	:=	S000C+0
+S0067	:=	S000C+0
+S0068	:=	S000C+0
+S0069	:=	S000C+0
+S006A	:=	S000C+0
+S006B	:=	S000C+0
+S006C	:=	S000C+0
+S006D	:=	S000C+0
+S006E	:=	S000C+0
+S009A	:=	S000C+0
+S0009	:=	S000C+0
+S0071	:=	S000C+0
+S0072	:=	S000C+0
+S0073	:=	S000C+0
+S0074	:=	S000C+0
+S0075	:=	S000C+0
+S0076	:=	S000C+0
+S0077	:=	S000C+0
+S0078	:=	S000C+0
+S0079	:=	S000C+0
+S007A	:=	S000C+0
+S0099	:=	S000C+0
+S0003	:=	S000C+0
+S007D	:=	S000C+0
+S007E	:=	S000C+0
+S007F	:=	S000C+0
+S0080	:=	S000C+0
+S0081	:=	S000C+0
+S0082	:=	S000C+0
+S0083	:=	S000C+0
+S0084	:=	S000C+0
+S0085	:=	S000C+0
+S0086	:=	S000C+0
+S0087	:=	S000C+0
+S0098	:=	S000C+0
+S0002	:=	S000C+0
+S008A	:=	S000C+0
+S008B	:=	S000C+0
+S008C	:=	S000C+0
+S008D	:=	S000C+0
+S008E	:=	S000C+0
+S008F	:=	S000C+0
+S0090	:=	S000C+0
+S0091	:=	S000C+0
+S0092	:=	S000C+0
+S0093	:=	S000C+0
+S0094	:=	S000C+0
+S0004	:=	S000C+0
+S0052:
+	.byte	$66,$30,$5F,$42,$28,$29,$0A,$00
+S0001:
+	.byte	$66,$30,$28,$29,$0A,$00
+S0088	:=	S0089+20
+S007B	:=	S0089+20
+S006F	:=	S0089+20
+S0063	:=	S0089+20
+S0051	:=	S0089+20
+S0044	:=	S0089+20
+S0037	:=	S0089+20
+S002A	:=	S0089+20
+S001E	:=	S0089+20
+S0012	:=	S0089+20
+S00A2	:=	S0089+20
+S0095	:=	S0089+20
+
+.segment	"BSS"
+
+_s:
+	.res	2,$00
+_t:
+	.res	2,$00
+_flags:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     boolne
+	sta     ptr1
+	ldy     _s
+	lda     ptr1
+	jsr     aslaxy
+	ora     _flags
+	sta     _flags
+	txa
+	ora     _flags+1
+	sta     _flags+1
+	inc     _s
+	bne     L0003
+	inc     _s+1
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	tax
+	jmp     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	sta     _t
+	stx     _t+1
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000B
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000C
+L000B:	tax
+	jmp     L000D
+L000C:	ldx     #$00
+	lda     #$01
+L000D:	sta     _t
+	stx     _t+1
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0011
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+L0011:	tax
+	jmp     L0013
+L0012:	ldx     #$00
+	lda     #$01
+L0013:	sta     _t
+	stx     _t+1
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0017
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0017
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L0018
+L0017:	tax
+	jmp     L0019
+L0018:	ldx     #$00
+	lda     #$01
+L0019:	sta     _t
+	stx     _t+1
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0036
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+L0036:	sta     _t
+	sta     _t+1
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0037
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0037
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+L0037:	sta     _t
+	sta     _t+1
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0028
+	tax
+	jmp     L0029
+L0028:	ldx     #$00
+	lda     #$01
+L0029:	sta     _t
+	stx     _t+1
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002D
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L002E
+L002D:	tax
+	jmp     L002F
+L002E:	ldx     #$00
+	lda     #$01
+L002F:	sta     _t
+	stx     _t+1
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0033
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L0034
+L0033:	tax
+	jmp     L0035
+L0034:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	tax
+	jmp     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	sta     _t
+	stx     _t+1
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000D
+	tax
+	jsr     _f
+L000D:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0011
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0011
+	tax
+	jsr     _f
+L0011:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+	tax
+	jmp     L0016
+L0015:	ldx     #$00
+	lda     #$01
+L0016:	sta     _t
+	stx     _t+1
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001A
+	ldx     #$01
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001A
+	tax
+	jmp     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	sta     _t
+	stx     _t+1
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L0020
+L001F:	ldx     #$00
+	lda     #$01
+L0020:	sta     _t
+	stx     _t+1
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0024
+	tax
+	jmp     L0025
+L0024:	ldx     #$00
+	lda     #$01
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L002A
+L0029:	ldx     #$00
+	lda     #$01
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002E
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L002F
+L002E:	ldx     #$00
+	lda     #$01
+L002F:	sta     _t
+	stx     _t+1
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0007:	tax
+	jmp     L0008
+L0006:	ldx     #$00
+	lda     #$01
+L0008:	sta     _t
+	stx     _t+1
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000F
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0010
+L000F:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0010:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0014
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0015
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0014
+L0015:	tax
+	jmp     L0016
+L0014:	ldx     #$00
+	lda     #$01
+L0016:	sta     _t
+	stx     _t+1
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001A
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L001B
+L001A:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001C
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001B
+L001C:	tax
+	jmp     L001D
+L001B:	ldx     #$00
+	lda     #$01
+L001D:	sta     _t
+	stx     _t+1
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0021
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0022
+L0021:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0022
+	tax
+	jmp     L0023
+L0022:	ldx     #$00
+	lda     #$01
+L0023:	sta     _t
+	stx     _t+1
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0027
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0028
+L0027:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0029
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L0028
+L0029:	tax
+	jmp     L002A
+L0028:	ldx     #$00
+	lda     #$01
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002E
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002F
+L002E:	tax
+	jmp     L0030
+L002F:	ldx     #$00
+	lda     #$01
+L0030:	sta     _t
+	stx     _t+1
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0034
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0034:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0035
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0036
+L0035:	tax
+	jmp     L0037
+L0036:	ldx     #$00
+	lda     #$01
+L0037:	sta     _t
+	stx     _t+1
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003B
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003C
+L003B:	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L003D
+L003C:	ldx     #$00
+	lda     #$01
+L003D:	sta     _t
+	stx     _t+1
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0041
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0042
+L0041:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0043
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0043:	ldx     #$00
+	txa
+	jmp     L0044
+L0042:	ldx     #$00
+	lda     #$01
+L0044:	sta     _t
+	stx     _t+1
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0063
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000A
+L0063:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000A
+L0009:	tax
+	jmp     L000C
+L000A:	ldx     #$00
+	lda     #$01
+L000C:	sta     _t
+	stx     _t+1
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0013
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0091
+L0013:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0091:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001E
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001D
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001E
+L001D:	tax
+	jmp     L0020
+L001E:	ldx     #$00
+	lda     #$01
+L0020:	sta     _t
+	stx     _t+1
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0068
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L0029
+L0068:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0028
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+L0028:	tax
+	jmp     L002B
+L0029:	ldx     #$00
+	lda     #$01
+L002B:	sta     _t
+	stx     _t+1
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002F
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0033
+L002F:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0033
+	tax
+	jmp     L0035
+L0033:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L006C
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003E
+L006C:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003D
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L003E
+L003D:	tax
+	jmp     L0040
+L003E:	ldx     #$00
+	lda     #$01
+L0040:	sta     _t
+	stx     _t+1
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0044
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0045
+L0044:	tax
+	jmp     L0048
+L0045:	ldx     #$00
+	lda     #$01
+L0048:	sta     _t
+	stx     _t+1
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004C
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L004C:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004D
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004E
+L004D:	tax
+	jmp     L0051
+L004E:	ldx     #$00
+	lda     #$01
+L0051:	sta     _t
+	stx     _t+1
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0070
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0070
+	ldx     #$00
+	lda     #$01
+	jmp     L0059
+L0070:	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+L0059:	sta     _t
+	stx     _t+1
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0071
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0071
+	ldx     #$00
+	lda     #$01
+	jmp     L0062
+L0071:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0061
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0061:	ldx     #$00
+	txa
+L0062:	sta     _t
+	stx     _t+1
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	tax
+	jmp     L000B
+L0005:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	tax
+	jmp     L000B
+L0008:	ldx     #$00
+	lda     #$01
+L000B:	sta     _t
+	stx     _t+1
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	sta     _t
+	sta     _t+1
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0063
+L0012:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+L0063:	sta     _t
+	sta     _t+1
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0018
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0018
+	tax
+	jmp     L001B
+L0018:	ldx     #$00
+	lda     #$01
+L001B:	sta     _t
+	stx     _t+1
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+	tax
+	jsr     _f
+L001F:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0021
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0021
+	tax
+	jmp     L0024
+L0021:	ldx     #$00
+	lda     #$01
+L0024:	sta     _t
+	stx     _t+1
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0028
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0028
+	tax
+	jmp     L002C
+L0028:	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+L002C:	sta     _t
+	stx     _t+1
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0030
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0030
+	tax
+	jmp     L0035
+L0030:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0033
+	tax
+	jsr     _f
+L0033:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0039
+	tax
+	jmp     L003F
+L0039:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003C
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003C
+	tax
+	jmp     L003F
+L003C:	ldx     #$00
+	lda     #$01
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0043
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L0049
+L0043:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0046
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0046
+	tax
+	jmp     L0049
+L0046:	ldx     #$00
+	lda     #$01
+L0049:	sta     _t
+	stx     _t+1
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004D
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004D
+	tax
+	jmp     L0053
+L004D:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0050
+	tax
+	jmp     L0053
+L0050:	ldx     #$00
+	lda     #$01
+L0053:	sta     _t
+	stx     _t+1
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0057
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0057
+	tax
+	jmp     L005D
+L0057:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L005A
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jmp     L005D
+L005A:	ldx     #$00
+	lda     #$01
+L005D:	sta     _t
+	stx     _t+1
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0_B (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0_B: near
+
+.segment	"CODE"
+
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldx     #$00
+	lda     #$2A
+	jmp     L0009
+L0008:	ldx     #$FF
+	lda     #$D6
+L0009:	sta     _t
+	stx     _t+1
+	lda     #<(S0065)
+	ldx     #>(S0065)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0010
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0010
+	ldx     #$00
+	lda     #$2A
+	jmp     L0011
+L0010:	ldx     #$FF
+	lda     #$D6
+L0011:	sta     _t
+	stx     _t+1
+	lda     #<(S0066)
+	ldx     #>(S0066)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0018
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0018
+	ldx     #$00
+	lda     #$2A
+	jmp     L0019
+L0018:	ldx     #$FF
+	lda     #$D6
+L0019:	sta     _t
+	stx     _t+1
+	lda     #<(S0067)
+	ldx     #>(S0067)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	jmp     L0021
+L0020:	ldx     #$FF
+	lda     #$D6
+L0021:	sta     _t
+	stx     _t+1
+	lda     #<(S0068)
+	ldx     #>(S0068)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0069)
+	ldx     #>(S0069)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0028
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0028:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006A)
+	ldx     #>(S006A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002C
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002C
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L002C:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006B)
+	ldx     #>(S006B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S006C)
+	ldx     #>(S006C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003A
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	jmp     L003B
+L003A:	ldx     #$FF
+	lda     #$D6
+L003B:	sta     _t
+	stx     _t+1
+	lda     #<(S006D)
+	ldx     #>(S006D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0042
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	jmp     L0043
+L0042:	ldx     #$FF
+	lda     #$D6
+L0043:	sta     _t
+	stx     _t+1
+	lda     #<(S006E)
+	ldx     #>(S006E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S006F)
+	ldx     #>(S006F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0070)
+	ldx     #>(S0070)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+L0005:	ldx     #$00
+	lda     #$2A
+	jmp     L0008
+L0007:	ldx     #$FF
+	lda     #$D6
+L0008:	sta     _t
+	stx     _t+1
+	lda     #<(S0071)
+	ldx     #>(S0071)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0072)
+	ldx     #>(S0072)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	tax
+	jsr     _f
+L000F:	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0073)
+	ldx     #>(S0073)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+	tax
+	jsr     _f
+L0015:	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0074)
+	ldx     #>(S0074)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001B
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001D
+L001B:	ldx     #$00
+	lda     #$2A
+	jmp     L001E
+L001D:	ldx     #$FF
+	lda     #$D6
+L001E:	sta     _t
+	stx     _t+1
+	lda     #<(S0075)
+	ldx     #>(S0075)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0022
+	ldx     #$01
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0024
+L0022:	ldx     #$00
+	lda     #$2A
+	jmp     L0025
+L0024:	ldx     #$FF
+	lda     #$D6
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0076)
+	ldx     #>(S0076)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+	ldx     #$01
+	jsr     _f
+	jmp     L002B
+L0029:	ldx     #$00
+	lda     #$2A
+	jmp     L002C
+L002B:	ldx     #$FF
+	lda     #$D6
+L002C:	sta     _t
+	stx     _t+1
+	lda     #<(S0077)
+	ldx     #>(S0077)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S0078)
+	ldx     #>(S0078)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0037
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	jmp     L0039
+L0037:	ldx     #$00
+	lda     #$2A
+	jmp     L003A
+L0039:	ldx     #$FF
+	lda     #$D6
+L003A:	sta     _t
+	stx     _t+1
+	lda     #<(S0079)
+	ldx     #>(S0079)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003E
+	ldx     #$01
+	jsr     _f
+	jmp     L0040
+L003E:	ldx     #$00
+	lda     #$2A
+	jmp     L0041
+L0040:	ldx     #$FF
+	lda     #$D6
+L0041:	sta     _t
+	stx     _t+1
+	lda     #<(S007A)
+	ldx     #>(S007A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S007B)
+	ldx     #>(S007B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S007C)
+	ldx     #>(S007C)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+L0006:	ldx     #$00
+	lda     #$2A
+	jmp     L000A
+L0009:	ldx     #$FF
+	lda     #$D6
+L000A:	sta     _t
+	stx     _t+1
+	lda     #<(S007D)
+	ldx     #>(S007D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S007E)
+	ldx     #>(S007E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0011
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+L0011:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0012:	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S007F)
+	ldx     #>(S007F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0018
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001B
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001B
+L0018:	ldx     #$00
+	lda     #$2A
+	jmp     L001C
+L001B:	ldx     #$FF
+	lda     #$D6
+L001C:	sta     _t
+	stx     _t+1
+	lda     #<(S0080)
+	ldx     #>(S0080)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L0021
+L0020:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0024
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0024
+L0021:	ldx     #$00
+	lda     #$2A
+	jmp     L0025
+L0024:	ldx     #$FF
+	lda     #$D6
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0081)
+	ldx     #>(S0081)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0029
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002A
+L0029:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002C
+L002A:	ldx     #$00
+	lda     #$2A
+	jmp     L002D
+L002C:	ldx     #$FF
+	lda     #$D6
+L002D:	sta     _t
+	stx     _t+1
+	lda     #<(S0082)
+	ldx     #>(S0082)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0031
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0032
+L0031:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0035
+	ldx     #$00
+	txa
+	jsr     _f
+L0032:	ldx     #$00
+	lda     #$2A
+	jmp     L0036
+L0035:	ldx     #$FF
+	lda     #$D6
+L0036:	sta     _t
+	stx     _t+1
+	lda     #<(S0083)
+	ldx     #>(S0083)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003D
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003D
+	ldx     #$00
+	lda     #$2A
+	jmp     L003E
+L003D:	ldx     #$FF
+	lda     #$D6
+L003E:	sta     _t
+	stx     _t+1
+	lda     #<(S0084)
+	ldx     #>(S0084)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0042
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0042:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0046
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0046
+	ldx     #$00
+	lda     #$2A
+	jmp     L0047
+L0046:	ldx     #$FF
+	lda     #$D6
+L0047:	sta     _t
+	stx     _t+1
+	lda     #<(S0085)
+	ldx     #>(S0085)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004B
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004C
+L004B:	ldx     #$01
+	jsr     _f
+	jmp     L004E
+L004C:	ldx     #$00
+	lda     #$2A
+	jmp     L004F
+L004E:	ldx     #$FF
+	lda     #$D6
+L004F:	sta     _t
+	stx     _t+1
+	lda     #<(S0086)
+	ldx     #>(S0086)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0053
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0054
+L0053:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0057
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	jmp     L0057
+L0054:	ldx     #$00
+	lda     #$2A
+	jmp     L0058
+L0057:	ldx     #$FF
+	lda     #$D6
+L0058:	sta     _t
+	stx     _t+1
+	lda     #<(S0087)
+	ldx     #>(S0087)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0088)
+	ldx     #>(S0088)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0089)
+	ldx     #>(S0089)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0077
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BA
+L0077:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+L00BA:	ldx     #$00
+	lda     #$2A
+	jmp     L000E
+L000D:	ldx     #$FF
+	lda     #$D6
+L000E:	sta     _t
+	stx     _t+1
+	lda     #<(S008A)
+	ldx     #>(S008A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S008B)
+	ldx     #>(S008B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0015
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00B6
+L0015:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L00B6:	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S008C)
+	ldx     #>(S008C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BB
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0025
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0025
+L00BB:	ldx     #$00
+	lda     #$2A
+	jmp     L0026
+L0025:	ldx     #$FF
+	lda     #$D6
+L0026:	sta     _t
+	stx     _t+1
+	lda     #<(S008D)
+	ldx     #>(S008D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L007C
+	ldx     #$00
+	txa
+	jsr     _f
+	jmp     L00BC
+L007C:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+L00BC:	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S008E)
+	ldx     #>(S008E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0037
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00B8
+L0037:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+L00B8:	ldx     #$00
+	lda     #$2A
+	jmp     L003F
+L003E:	ldx     #$FF
+	lda     #$D6
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S008F)
+	ldx     #>(S008F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0080
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BD
+L0080:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004B
+	ldx     #$00
+	txa
+	jsr     _f
+L00BD:	ldx     #$00
+	lda     #$2A
+	jmp     L004C
+L004B:	ldx     #$FF
+	lda     #$D6
+L004C:	sta     _t
+	stx     _t+1
+	lda     #<(S0090)
+	ldx     #>(S0090)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0055
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0055
+	ldx     #$00
+	lda     #$2A
+	jmp     L0056
+L0055:	ldx     #$FF
+	lda     #$D6
+L0056:	sta     _t
+	stx     _t+1
+	lda     #<(S0091)
+	ldx     #>(S0091)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L005A
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L005A:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0060
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0060
+	ldx     #$00
+	lda     #$2A
+	jmp     L0061
+L0060:	ldx     #$FF
+	lda     #$D6
+L0061:	sta     _t
+	stx     _t+1
+	lda     #<(S0092)
+	ldx     #>(S0092)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0084
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0084
+	ldx     #$00
+	jmp     L00B2
+L0084:	ldx     #$01
+	jsr     _f
+	jmp     L006A
+L00B2:	lda     #$2A
+	jmp     L006B
+L006A:	ldx     #$FF
+	lda     #$D6
+L006B:	sta     _t
+	stx     _t+1
+	lda     #<(S0093)
+	ldx     #>(S0093)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0085
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0085
+	ldx     #$00
+	jmp     L00B5
+L0085:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0075
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	jmp     L0075
+L00B5:	lda     #$2A
+	jmp     L0076
+L0075:	ldx     #$FF
+	lda     #$D6
+L0076:	sta     _t
+	stx     _t+1
+	lda     #<(S0094)
+	ldx     #>(S0094)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0095)
+	ldx     #>(S0095)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0096)
+	ldx     #>(S0096)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+L0005:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+L0008:	ldx     #$00
+	lda     #$2A
+	jmp     L000D
+L000C:	ldx     #$FF
+	lda     #$D6
+L000D:	sta     _t
+	stx     _t+1
+	lda     #<(S0097)
+	ldx     #>(S0097)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0098)
+	ldx     #>(S0098)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0014
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0016
+L0014:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0016:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0099)
+	ldx     #>(S0099)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001A
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001E
+L001A:	ldx     #$00
+	lda     #$2A
+	jmp     L001F
+L001E:	ldx     #$FF
+	lda     #$D6
+L001F:	sta     _t
+	stx     _t+1
+	lda     #<(S009A)
+	ldx     #>(S009A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0023
+	tax
+	jsr     _f
+L0023:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0025
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0029
+L0025:	ldx     #$00
+	lda     #$2A
+	jmp     L002A
+L0029:	ldx     #$FF
+	lda     #$D6
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S009B)
+	ldx     #>(S009B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002E
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0033
+L002E:	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	jmp     L0034
+L0033:	ldx     #$FF
+	lda     #$D6
+L0034:	sta     _t
+	stx     _t+1
+	lda     #<(S009C)
+	ldx     #>(S009C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0038
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+L0038:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003B
+	tax
+	jsr     _f
+L003B:	ldx     #$00
+	lda     #$2A
+	jmp     L003F
+L003E:	ldx     #$FF
+	lda     #$D6
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S009D)
+	ldx     #>(S009D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004A
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0046
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004A
+L0046:	ldx     #$00
+	lda     #$2A
+	jmp     L004B
+L004A:	ldx     #$FF
+	lda     #$D6
+L004B:	sta     _t
+	stx     _t+1
+	lda     #<(S009E)
+	ldx     #>(S009E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004F
+	ldx     #$01
+	jsr     _f
+	jmp     L0056
+L004F:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0052
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0056
+L0052:	ldx     #$00
+	lda     #$2A
+	jmp     L0057
+L0056:	ldx     #$FF
+	lda     #$D6
+L0057:	sta     _t
+	stx     _t+1
+	lda     #<(S009F)
+	ldx     #>(S009F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L005B
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0062
+L005B:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0062
+	ldx     #$00
+	lda     #$2A
+	jmp     L0063
+L0062:	ldx     #$FF
+	lda     #$D6
+L0063:	sta     _t
+	stx     _t+1
+	lda     #<(S00A0)
+	ldx     #>(S00A0)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	sta     _s
+	sta     _s+1
+	sta     _flags
+	sta     _flags+1
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0067
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L006E
+L0067:	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L006A
+	ldx     #$01
+	jsr     _f
+	jmp     L006E
+L006A:	ldx     #$00
+	lda     #$2A
+	jmp     L006F
+L006E:	ldx     #$FF
+	lda     #$D6
+L006F:	sta     _t
+	stx     _t+1
+	lda     #<(S00A1)
+	ldx     #>(S00A1)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S00A2)
+	ldx     #>(S00A2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f0
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f1
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f2
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f3
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f4
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f5
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f1
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f2
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f3
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f4
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f5
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f3
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f4
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f5
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f3
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f4
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f5
+	jsr     _f0_B
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f1_B
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f2_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _f5_B
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f1_B
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f2_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f5_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	jsr     _f5_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	tya
+	jsr     _f5_B
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
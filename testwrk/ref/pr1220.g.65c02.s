@@ -0,0 +1,7817 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "pr1220.c", 8159, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_s
+	.export		_t
+	.export		_flags
+	.export		_f
+	.export		_f0
+	.export		_f1
+	.export		_f2
+	.export		_f3
+	.export		_f4
+	.export		_f5
+	.export		_f0_B
+	.export		_f1_B
+	.export		_f2_B
+	.export		_f3_B
+	.export		_f4_B
+	.export		_f5_B
+	.export		_main
+
+.segment	"RODATA"
+
+S0089:
+	.byte	$66,$34,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S007C:
+	.byte	$66,$33,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0096:
+	.byte	$66,$35,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0038:
+	.byte	$66,$34,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0045:
+	.byte	$66,$35,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S002B:
+	.byte	$66,$33,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0064:
+	.byte	$66,$31,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0070:
+	.byte	$66,$32,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0013:
+	.byte	$66,$31,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S001F:
+	.byte	$66,$32,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S000C:
+	.byte	$25,$33,$64,$20,$25,$32,$58,$3A,$20,$25,$64,$0A,$00
+S000D	:=	S000C+0
+S000E	:=	S000C+0
+S000F	:=	S000C+0
+S0010	:=	S000C+0
+S0011	:=	S000C+0
+S00A1	:=	S000C+0
+S000A	:=	S000C+0
+S0014	:=	S000C+0
+S0015	:=	S000C+0
+S0016	:=	S000C+0
+S0017	:=	S000C+0
+S0018	:=	S000C+0
+S0019	:=	S000C+0
+S001A	:=	S000C+0
+S001B	:=	S000C+0
+S001C	:=	S000C+0
+S001D	:=	S000C+0
+S00A0	:=	S000C+0
+S000B	:=	S000C+0
+S0020	:=	S000C+0
+S0021	:=	S000C+0
+S0022	:=	S000C+0
+S0023	:=	S000C+0
+S0024	:=	S000C+0
+S0025	:=	S000C+0
+S0026	:=	S000C+0
+S0027	:=	S000C+0
+S0028	:=	S000C+0
+S0029	:=	S000C+0
+S009F	:=	S000C+0
+S0008	:=	S000C+0
+S002C	:=	S000C+0
+S002D	:=	S000C+0
+S002E	:=	S000C+0
+S002F	:=	S000C+0
+S0030	:=	S000C+0
+S0031	:=	S000C+0
+S0032	:=	S000C+0
+S0033	:=	S000C+0
+S0034	:=	S000C+0
+S0035	:=	S000C+0
+S0036	:=	S000C+0
+S009E	:=	S000C+0
+S0007	:=	S000C+0
+S0039	:=	S000C+0
+S003A	:=	S000C+0
+S003B	:=	S000C+0
+S003C	:=	S000C+0
+S003D	:=	S000C+0
+S003E	:=	S000C+0
+S003F	:=	S000C+0
+S0040	:=	S000C+0
+S0041	:=	S000C+0
+S0042	:=	S000C+0
+S0043	:=	S000C+0
+S009D	:=	S000C+0
+S0006	:=	S000C+0
+S0046	:=	S000C+0
+S0047	:=	S000C+0
+S0048	:=	S000C+0
+S0049	:=	S000C+0
+S004A	:=	S000C+0
+S004B	:=	S000C+0
+S004C	:=	S000C+0
+S004D	:=	S000C+0
+S004E	:=	S000C+0
+S004F	:=	S000C+0
+S0050	:=	S000C+0
+S009C	:=	S000C+0
+S0097	:=	S000C+0
+S0053	:=	S000C+0
+S0054	:=	S000C+0
+S0055	:=	S000C+0
+S0056	:=	S000C+0
+S0057	:=	S000C+0
+S0058	:=	S000C+0
+S0059	:=	S000C+0
+S005A	:=	S000C+0
+S005B	:=	S000C+0
+S005C	:=	S000C+0
+S005D	:=	S000C+0
+S005E	:=	S000C+0
+S005F	:=	S000C+0
+S0060	:=	S000C+0
+S0061	:=	S000C+0
+S0062	:=	S000C+0
+S009B	:=	S000C+0
+S0005	:=	S000C+0
+S0065	:=	S000C+0
+S0066	:=	S000C+0
+S0067	:=	S000C+0
+S0068	:=	S000C+0
+S0069	:=	S000C+0
+S006A	:=	S000C+0
+S006B	:=	S000C+0
+S006C	:=	S000C+0
+S006D	:=	S000C+0
+S006E	:=	S000C+0
+S009A	:=	S000C+0
+S0009	:=	S000C+0
+S0071	:=	S000C+0
+S0072	:=	S000C+0
+S0073	:=	S000C+0
+S0074	:=	S000C+0
+S0075	:=	S000C+0
+S0076	:=	S000C+0
+S0077	:=	S000C+0
+S0078	:=	S000C+0
+S0079	:=	S000C+0
+S007A	:=	S000C+0
+S0099	:=	S000C+0
+S0003	:=	S000C+0
+S007D	:=	S000C+0
+S007E	:=	S000C+0
+S007F	:=	S000C+0
+S0080	:=	S000C+0
+S0081	:=	S000C+0
+S0082	:=	S000C+0
+S0083	:=	S000C+0
+S0084	:=	S000C+0
+S0085	:=	S000C+0
+S0086	:=	S000C+0
+S0087	:=	S000C+0
+S0098	:=	S000C+0
+S0002	:=	S000C+0
+S008A	:=	S000C+0
+S008B	:=	S000C+0
+S008C	:=	S000C+0
+S008D	:=	S000C+0
+S008E	:=	S000C+0
+S008F	:=	S000C+0
+S0090	:=	S000C+0
+S0091	:=	S000C+0
+S0092	:=	S000C+0
+S0093	:=	S000C+0
+S0094	:=	S000C+0
+S0004	:=	S000C+0
+S0052:
+	.byte	$66,$30,$5F,$42,$28,$29,$0A,$00
+S0001:
+	.byte	$66,$30,$28,$29,$0A,$00
+S0088	:=	S0089+20
+S007B	:=	S0089+20
+S006F	:=	S0089+20
+S0063	:=	S0089+20
+S0051	:=	S0089+20
+S0044	:=	S0089+20
+S0037	:=	S0089+20
+S002A	:=	S0089+20
+S001E	:=	S0089+20
+S0012	:=	S0089+20
+S00A2	:=	S0089+20
+S0095	:=	S0089+20
+
+.segment	"BSS"
+
+_s:
+	.res	2,$00
+_t:
+	.res	2,$00
+_flags:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", static, "_f"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 24
+	jsr     pushax
+	.dbg	line, "pr1220.c", 25
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     boolne
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     tosaslax
+	jsr     tosorax
+	sta     _flags
+	stx     _flags+1
+	.dbg	line, "pr1220.c", 26
+	inc     _s
+	bne     L0003
+	inc     _s+1
+L0003:	lda     _s
+	ldx     _s+1
+	.dbg	line, "pr1220.c", 27
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "pr1220.c", 28
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0: near
+
+	.dbg	func, "f0", "00", static, "_f0"
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 40
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 42
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 43
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 45
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 46
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 48
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 49
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 50
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 51
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 53
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 54
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 55
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 56
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 58
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 59
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 60
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 61
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 63
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 64
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", static, "_f1"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 2
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 68
+	jsr     pushax
+	.dbg	line, "pr1220.c", 69
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 71
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	sta     _t
+	stx     _t+1
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 73
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L000B
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000C
+L000B:	ldx     #$00
+	lda     #$00
+	jeq     L000D
+L000C:	ldx     #$00
+	lda     #$01
+L000D:	sta     _t
+	stx     _t+1
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 74
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0011
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0012
+L0011:	ldx     #$00
+	lda     #$00
+	jeq     L0013
+L0012:	ldx     #$00
+	lda     #$01
+L0013:	sta     _t
+	stx     _t+1
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 75
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0017
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0017
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0018
+L0017:	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0018:	ldx     #$00
+	lda     #$01
+L0019:	sta     _t
+	stx     _t+1
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 77
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 78
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0020
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0020:	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 79
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0024
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0024
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0024:	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 81
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0028
+	ldx     #$00
+	lda     #$00
+	jeq     L0029
+L0028:	ldx     #$00
+	lda     #$01
+L0029:	sta     _t
+	stx     _t+1
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 82
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002D
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L002E
+L002D:	ldx     #$00
+	lda     #$00
+	jeq     L002F
+L002E:	ldx     #$00
+	lda     #$01
+L002F:	sta     _t
+	stx     _t+1
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 83
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0033
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0034
+L0033:	ldx     #$00
+	lda     #$00
+	jeq     L0035
+L0034:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 85
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 86
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", static, "_f2"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 2
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 90
+	jsr     pushax
+	.dbg	line, "pr1220.c", 91
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 93
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldx     #$00
+	lda     #$00
+	jeq     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	sta     _t
+	stx     _t+1
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 95
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 96
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000D
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L000D:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 97
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0011
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0011
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0011:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 99
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0015
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0015
+	ldx     #$00
+	lda     #$00
+	jeq     L0016
+L0015:	ldx     #$00
+	lda     #$01
+L0016:	sta     _t
+	stx     _t+1
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 100
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001A
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001A
+	ldx     #$00
+	lda     #$00
+	jeq     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	sta     _t
+	stx     _t+1
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 101
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001F
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001F
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0020
+L001F:	ldx     #$00
+	lda     #$01
+L0020:	sta     _t
+	stx     _t+1
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 103
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0024
+	ldx     #$00
+	lda     #$00
+	jeq     L0025
+L0024:	ldx     #$00
+	lda     #$01
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 104
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0029
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L002A
+L0029:	ldx     #$00
+	lda     #$01
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 105
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002E
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L002F
+L002E:	ldx     #$00
+	lda     #$01
+L002F:	sta     _t
+	stx     _t+1
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 107
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 108
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+	.dbg	func, "f3", "00", static, "_f3"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 112
+	jsr     pushax
+	.dbg	line, "pr1220.c", 113
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 115
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0007
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0007:	ldx     #$00
+	lda     #$00
+	jeq     L0008
+L0006:	ldx     #$00
+	lda     #$01
+L0008:	sta     _t
+	stx     _t+1
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 116
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 117
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L000F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0010
+L000F:	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0010:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 119
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0014
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0015
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0014
+L0015:	ldx     #$00
+	lda     #$00
+	jeq     L0016
+L0014:	ldx     #$00
+	lda     #$01
+L0016:	sta     _t
+	stx     _t+1
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 120
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L001A
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L001B
+L001A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L001C
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001B
+L001C:	ldx     #$00
+	lda     #$00
+	jeq     L001D
+L001B:	ldx     #$00
+	lda     #$01
+L001D:	sta     _t
+	stx     _t+1
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 121
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0021
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0022
+L0021:	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0022
+	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0022:	ldx     #$00
+	lda     #$01
+L0023:	sta     _t
+	stx     _t+1
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 122
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0027
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0028
+L0027:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0029
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0028
+L0029:	ldx     #$00
+	lda     #$00
+	jeq     L002A
+L0028:	ldx     #$00
+	lda     #$01
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 124
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002E
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002F
+L002E:	ldx     #$00
+	lda     #$00
+	jeq     L0030
+L002F:	ldx     #$00
+	lda     #$01
+L0030:	sta     _t
+	stx     _t+1
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 125
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0034
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0034:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0035
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0036
+L0035:	ldx     #$00
+	lda     #$00
+	jeq     L0037
+L0036:	ldx     #$00
+	lda     #$01
+L0037:	sta     _t
+	stx     _t+1
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 126
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L003B
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003C
+L003B:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L003D
+L003C:	ldx     #$00
+	lda     #$01
+L003D:	sta     _t
+	stx     _t+1
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 127
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0041
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0042
+L0041:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0043
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0043:	ldx     #$00
+	lda     #$00
+	jeq     L0044
+L0042:	ldx     #$00
+	lda     #$01
+L0044:	sta     _t
+	stx     _t+1
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 129
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 130
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+	.dbg	func, "f4", "00", static, "_f4"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 134
+	jsr     pushax
+	.dbg	line, "pr1220.c", 135
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 137
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jne     L0008
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0009
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000A
+L0009:	ldx     #$00
+	lda     #$00
+	jeq     L000B
+L000A:	ldx     #$00
+	lda     #$01
+L000B:	jne     L0008
+	ldx     #$00
+	lda     #$00
+	jeq     L000C
+L0008:	ldx     #$00
+	lda     #$01
+L000C:	sta     _t
+	stx     _t+1
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 138
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 139
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0013
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0014
+L0013:	ldx     #$00
+	lda     #$00
+	jeq     L0015
+L0014:	ldx     #$00
+	lda     #$01
+L0015:	jne     L0016
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0016:	ldx     #$00
+	lda     #$01
+	sta     _t
+	stx     _t+1
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 141
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001A
+	ldx     #$00
+	lda     #$00
+	jeq     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	jne     L001C
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L001D
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001E
+L001D:	ldx     #$00
+	lda     #$00
+	jeq     L001F
+L001E:	ldx     #$00
+	lda     #$01
+L001F:	jne     L001C
+	ldx     #$00
+	lda     #$00
+	jeq     L0020
+L001C:	ldx     #$00
+	lda     #$01
+L0020:	sta     _t
+	stx     _t+1
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 142
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0024
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0025
+L0024:	ldx     #$00
+	lda     #$00
+	jeq     L0026
+L0025:	ldx     #$00
+	lda     #$01
+L0026:	jne     L0027
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0028
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0029
+L0028:	ldx     #$00
+	lda     #$00
+	jeq     L002A
+L0029:	ldx     #$00
+	lda     #$01
+L002A:	jne     L0027
+	ldx     #$00
+	lda     #$00
+	jeq     L002B
+L0027:	ldx     #$00
+	lda     #$01
+L002B:	sta     _t
+	stx     _t+1
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 143
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0030
+L002F:	ldx     #$00
+	lda     #$00
+	jeq     L0031
+L0030:	ldx     #$00
+	lda     #$01
+L0031:	jne     L0032
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0033
+	ldx     #$00
+	lda     #$00
+	jeq     L0034
+L0033:	ldx     #$00
+	lda     #$01
+L0034:	jne     L0032
+	ldx     #$00
+	lda     #$00
+	jeq     L0035
+L0032:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 144
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0039
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003A
+L0039:	ldx     #$00
+	lda     #$00
+	jeq     L003B
+L003A:	ldx     #$00
+	lda     #$01
+L003B:	jne     L003C
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L003D
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L003E
+L003D:	ldx     #$00
+	lda     #$00
+	jeq     L003F
+L003E:	ldx     #$00
+	lda     #$01
+L003F:	jne     L003C
+	ldx     #$00
+	lda     #$00
+	jeq     L0040
+L003C:	ldx     #$00
+	lda     #$01
+L0040:	sta     _t
+	stx     _t+1
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 146
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0044
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0045
+L0044:	ldx     #$00
+	lda     #$00
+	jeq     L0046
+L0045:	ldx     #$00
+	lda     #$01
+L0046:	jne     L0047
+	ldx     #$00
+	lda     #$00
+	jeq     L0048
+L0047:	ldx     #$00
+	lda     #$01
+L0048:	sta     _t
+	stx     _t+1
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 147
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L004C
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L004C:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L004D
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L004E
+L004D:	ldx     #$00
+	lda     #$00
+	jeq     L004F
+L004E:	ldx     #$00
+	lda     #$01
+L004F:	jne     L0050
+	ldx     #$00
+	lda     #$00
+	jeq     L0051
+L0050:	ldx     #$00
+	lda     #$01
+L0051:	sta     _t
+	stx     _t+1
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 148
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0055
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0056
+L0055:	ldx     #$00
+	lda     #$00
+	jeq     L0057
+L0056:	ldx     #$00
+	lda     #$01
+L0057:	jne     L0058
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0059
+L0058:	ldx     #$00
+	lda     #$01
+L0059:	sta     _t
+	stx     _t+1
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 149
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L005D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005E
+L005D:	ldx     #$00
+	lda     #$00
+	jeq     L005F
+L005E:	ldx     #$00
+	lda     #$01
+L005F:	jne     L0060
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0061
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0061:	ldx     #$00
+	lda     #$00
+	jeq     L0062
+L0060:	ldx     #$00
+	lda     #$01
+L0062:	sta     _t
+	stx     _t+1
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 151
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 152
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+	.dbg	func, "f5", "00", static, "_f5"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 156
+	jsr     pushax
+	.dbg	line, "pr1220.c", 157
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 159
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldx     #$00
+	lda     #$00
+	jeq     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	jeq     L0007
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0008
+	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0008:	ldx     #$00
+	lda     #$01
+L0009:	jne     L000A
+L0007:	ldx     #$00
+	lda     #$00
+	jeq     L000B
+L000A:	ldx     #$00
+	lda     #$01
+L000B:	sta     _t
+	stx     _t+1
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 160
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 161
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0012
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0012
+	ldx     #$00
+	lda     #$00
+	jeq     L0013
+L0012:	ldx     #$00
+	lda     #$01
+L0013:	jeq     L0014
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0014:	ldx     #$00
+	lda     #$00
+	sta     _t
+	stx     _t+1
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 163
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0018
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0018
+	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0018:	ldx     #$00
+	lda     #$01
+L0019:	jne     L001A
+	ldx     #$00
+	lda     #$00
+	jeq     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	sta     _t
+	stx     _t+1
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 164
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001F
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L001F:	ldx     #$00
+	lda     #$01
+	jeq     L0020
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0021
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0021
+	ldx     #$00
+	lda     #$00
+	jeq     L0022
+L0021:	ldx     #$00
+	lda     #$01
+L0022:	jne     L0023
+L0020:	ldx     #$00
+	lda     #$00
+	jeq     L0024
+L0023:	ldx     #$00
+	lda     #$01
+L0024:	sta     _t
+	stx     _t+1
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 165
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0028
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0028
+	ldx     #$00
+	lda     #$00
+	jeq     L0029
+L0028:	ldx     #$00
+	lda     #$01
+L0029:	jeq     L002A
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L002B
+L002A:	ldx     #$00
+	lda     #$00
+	jeq     L002C
+L002B:	ldx     #$00
+	lda     #$01
+L002C:	sta     _t
+	stx     _t+1
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 166
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0030
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0030
+	ldx     #$00
+	lda     #$00
+	jeq     L0031
+L0030:	ldx     #$00
+	lda     #$01
+L0031:	jeq     L0032
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0033
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0033:	ldx     #$00
+	lda     #$01
+	jne     L0034
+L0032:	ldx     #$00
+	lda     #$00
+	jeq     L0035
+L0034:	ldx     #$00
+	lda     #$01
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 168
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0039
+	ldx     #$00
+	lda     #$00
+	jeq     L003A
+L0039:	ldx     #$00
+	lda     #$01
+L003A:	jeq     L003B
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003C
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003C
+	ldx     #$00
+	lda     #$00
+	jeq     L003D
+L003C:	ldx     #$00
+	lda     #$01
+L003D:	jne     L003E
+L003B:	ldx     #$00
+	lda     #$00
+	jeq     L003F
+L003E:	ldx     #$00
+	lda     #$01
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 169
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0043
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0044
+L0043:	ldx     #$00
+	lda     #$01
+L0044:	jeq     L0045
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0046
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0046
+	ldx     #$00
+	lda     #$00
+	jeq     L0047
+L0046:	ldx     #$00
+	lda     #$01
+L0047:	jne     L0048
+L0045:	ldx     #$00
+	lda     #$00
+	jeq     L0049
+L0048:	ldx     #$00
+	lda     #$01
+L0049:	sta     _t
+	stx     _t+1
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 170
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L004D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L004D
+	ldx     #$00
+	lda     #$00
+	jeq     L004E
+L004D:	ldx     #$00
+	lda     #$01
+L004E:	jeq     L004F
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0050
+	ldx     #$00
+	lda     #$00
+	jeq     L0051
+L0050:	ldx     #$00
+	lda     #$01
+L0051:	jne     L0052
+L004F:	ldx     #$00
+	lda     #$00
+	jeq     L0053
+L0052:	ldx     #$00
+	lda     #$01
+L0053:	sta     _t
+	stx     _t+1
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 171
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0057
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0057
+	ldx     #$00
+	lda     #$00
+	jeq     L0058
+L0057:	ldx     #$00
+	lda     #$01
+L0058:	jeq     L0059
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005A
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L005B
+L005A:	ldx     #$00
+	lda     #$01
+L005B:	jne     L005C
+L0059:	ldx     #$00
+	lda     #$00
+	jeq     L005D
+L005C:	ldx     #$00
+	lda     #$01
+L005D:	sta     _t
+	stx     _t+1
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 173
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 174
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0_B (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0_B: near
+
+	.dbg	func, "f0_B", "00", static, "_f0_B"
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 179
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 181
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 182
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 184
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 185
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 187
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 188
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 189
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 190
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 192
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 193
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 194
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 195
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 197
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 198
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 199
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 200
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 202
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 203
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1_B: near
+
+	.dbg	func, "f1_B", "00", static, "_f1_B"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 2
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 207
+	jsr     pushax
+	.dbg	line, "pr1220.c", 208
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 210
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0008
+	ldx     #$00
+	lda     #$2A
+	jmp     L0009
+L0008:	ldx     #$FF
+	lda     #$D6
+L0009:	sta     _t
+	stx     _t+1
+	lda     #<(S0065)
+	ldx     #>(S0065)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 212
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L000D
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000E
+L000D:	ldx     #$00
+	lda     #$00
+	jeq     L000F
+L000E:	ldx     #$00
+	lda     #$01
+L000F:	jeq     L0010
+	ldx     #$00
+	lda     #$2A
+	jmp     L0011
+L0010:	ldx     #$FF
+	lda     #$D6
+L0011:	sta     _t
+	stx     _t+1
+	lda     #<(S0066)
+	ldx     #>(S0066)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 213
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0015
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0016
+L0015:	ldx     #$00
+	lda     #$00
+	jeq     L0017
+L0016:	ldx     #$00
+	lda     #$01
+L0017:	jeq     L0018
+	ldx     #$00
+	lda     #$2A
+	jmp     L0019
+L0018:	ldx     #$FF
+	lda     #$D6
+L0019:	sta     _t
+	stx     _t+1
+	lda     #<(S0067)
+	ldx     #>(S0067)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 214
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L001D
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L001D
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L001E
+L001D:	ldx     #$00
+	lda     #$00
+	jeq     L001F
+L001E:	ldx     #$00
+	lda     #$01
+L001F:	jeq     L0020
+	ldx     #$00
+	lda     #$2A
+	jmp     L0021
+L0020:	ldx     #$FF
+	lda     #$D6
+L0021:	sta     _t
+	stx     _t+1
+	lda     #<(S0068)
+	ldx     #>(S0068)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 216
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0069)
+	ldx     #>(S0069)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 217
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0028
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0028:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006A)
+	ldx     #>(S006A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 218
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002C
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002C
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L002C:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006B)
+	ldx     #>(S006B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 220
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0030
+	ldx     #$00
+	lda     #$00
+	jeq     L0031
+L0030:	ldx     #$00
+	lda     #$01
+L0031:	jeq     L0032
+	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S006C)
+	ldx     #>(S006C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 221
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0037
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0038
+L0037:	ldx     #$00
+	lda     #$00
+	jeq     L0039
+L0038:	ldx     #$00
+	lda     #$01
+L0039:	jeq     L003A
+	ldx     #$00
+	lda     #$2A
+	jmp     L003B
+L003A:	ldx     #$FF
+	lda     #$D6
+L003B:	sta     _t
+	stx     _t+1
+	lda     #<(S006D)
+	ldx     #>(S006D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 222
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L003F
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0040
+L003F:	ldx     #$00
+	lda     #$00
+	jeq     L0041
+L0040:	ldx     #$00
+	lda     #$01
+L0041:	jeq     L0042
+	ldx     #$00
+	lda     #$2A
+	jmp     L0043
+L0042:	ldx     #$FF
+	lda     #$D6
+L0043:	sta     _t
+	stx     _t+1
+	lda     #<(S006E)
+	ldx     #>(S006E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 224
+	lda     #<(S006F)
+	ldx     #>(S006F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 225
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2_B: near
+
+	.dbg	func, "f2_B", "00", static, "_f2_B"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 2
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 229
+	jsr     pushax
+	.dbg	line, "pr1220.c", 230
+	lda     #<(S0070)
+	ldx     #>(S0070)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 232
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldx     #$00
+	lda     #$00
+	jeq     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	jeq     L0007
+	ldx     #$00
+	lda     #$2A
+	jmp     L0008
+L0007:	ldx     #$FF
+	lda     #$D6
+L0008:	sta     _t
+	stx     _t+1
+	lda     #<(S0071)
+	ldx     #>(S0071)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 234
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S0072)
+	ldx     #>(S0072)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 235
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000F
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L000F:	ldx     #$00
+	lda     #$01
+	jeq     L0010
+	ldx     #$00
+	lda     #$2A
+	jmp     L0011
+L0010:	ldx     #$FF
+	lda     #$D6
+L0011:	sta     _t
+	stx     _t+1
+	lda     #<(S0073)
+	ldx     #>(S0073)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 236
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0015
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0015
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0015:	ldx     #$00
+	lda     #$01
+	jeq     L0016
+	ldx     #$00
+	lda     #$2A
+	jmp     L0017
+L0016:	ldx     #$FF
+	lda     #$D6
+L0017:	sta     _t
+	stx     _t+1
+	lda     #<(S0074)
+	ldx     #>(S0074)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 238
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001B
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001B
+	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001B:	ldx     #$00
+	lda     #$01
+L001C:	jeq     L001D
+	ldx     #$00
+	lda     #$2A
+	jmp     L001E
+L001D:	ldx     #$FF
+	lda     #$D6
+L001E:	sta     _t
+	stx     _t+1
+	lda     #<(S0075)
+	ldx     #>(S0075)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 239
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0022
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0022
+	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0022:	ldx     #$00
+	lda     #$01
+L0023:	jeq     L0024
+	ldx     #$00
+	lda     #$2A
+	jmp     L0025
+L0024:	ldx     #$FF
+	lda     #$D6
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0076)
+	ldx     #>(S0076)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 240
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0029
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0029
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L002A
+L0029:	ldx     #$00
+	lda     #$01
+L002A:	jeq     L002B
+	ldx     #$00
+	lda     #$2A
+	jmp     L002C
+L002B:	ldx     #$FF
+	lda     #$D6
+L002C:	sta     _t
+	stx     _t+1
+	lda     #<(S0077)
+	ldx     #>(S0077)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 242
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0030
+	ldx     #$00
+	lda     #$00
+	jeq     L0031
+L0030:	ldx     #$00
+	lda     #$01
+L0031:	jeq     L0032
+	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S0078)
+	ldx     #>(S0078)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 243
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0037
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0038
+L0037:	ldx     #$00
+	lda     #$01
+L0038:	jeq     L0039
+	ldx     #$00
+	lda     #$2A
+	jmp     L003A
+L0039:	ldx     #$FF
+	lda     #$D6
+L003A:	sta     _t
+	stx     _t+1
+	lda     #<(S0079)
+	ldx     #>(S0079)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 244
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003E
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L003F
+L003E:	ldx     #$00
+	lda     #$01
+L003F:	jeq     L0040
+	ldx     #$00
+	lda     #$2A
+	jmp     L0041
+L0040:	ldx     #$FF
+	lda     #$D6
+L0041:	sta     _t
+	stx     _t+1
+	lda     #<(S007A)
+	ldx     #>(S007A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 246
+	lda     #<(S007B)
+	ldx     #>(S007B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 247
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3_B: near
+
+	.dbg	func, "f3_B", "00", static, "_f3_B"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 251
+	jsr     pushax
+	.dbg	line, "pr1220.c", 252
+	lda     #<(S007C)
+	ldx     #>(S007C)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 254
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0007
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0007:	ldx     #$00
+	lda     #$00
+	jeq     L0008
+L0006:	ldx     #$00
+	lda     #$01
+L0008:	jeq     L0009
+	ldx     #$00
+	lda     #$2A
+	jmp     L000A
+L0009:	ldx     #$FF
+	lda     #$D6
+L000A:	sta     _t
+	stx     _t+1
+	lda     #<(S007D)
+	ldx     #>(S007D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 255
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S007E)
+	ldx     #>(S007E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 256
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0011
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0012
+L0011:	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0012:	ldx     #$00
+	lda     #$01
+	jeq     L0013
+	ldx     #$00
+	lda     #$2A
+	jmp     L0014
+L0013:	ldx     #$FF
+	lda     #$D6
+L0014:	sta     _t
+	stx     _t+1
+	lda     #<(S007F)
+	ldx     #>(S007F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 258
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0018
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0019
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0018
+L0019:	ldx     #$00
+	lda     #$00
+	jeq     L001A
+L0018:	ldx     #$00
+	lda     #$01
+L001A:	jeq     L001B
+	ldx     #$00
+	lda     #$2A
+	jmp     L001C
+L001B:	ldx     #$FF
+	lda     #$D6
+L001C:	sta     _t
+	stx     _t+1
+	lda     #<(S0080)
+	ldx     #>(S0080)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 259
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0020
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0021
+L0020:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0022
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0021
+L0022:	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0021:	ldx     #$00
+	lda     #$01
+L0023:	jeq     L0024
+	ldx     #$00
+	lda     #$2A
+	jmp     L0025
+L0024:	ldx     #$FF
+	lda     #$D6
+L0025:	sta     _t
+	stx     _t+1
+	lda     #<(S0081)
+	ldx     #>(S0081)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 260
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0029
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002A
+L0029:	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002A
+	ldx     #$00
+	lda     #$00
+	jeq     L002B
+L002A:	ldx     #$00
+	lda     #$01
+L002B:	jeq     L002C
+	ldx     #$00
+	lda     #$2A
+	jmp     L002D
+L002C:	ldx     #$FF
+	lda     #$D6
+L002D:	sta     _t
+	stx     _t+1
+	lda     #<(S0082)
+	ldx     #>(S0082)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 261
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0031
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0032
+L0031:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0033
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0032
+L0033:	ldx     #$00
+	lda     #$00
+	jeq     L0034
+L0032:	ldx     #$00
+	lda     #$01
+L0034:	jeq     L0035
+	ldx     #$00
+	lda     #$2A
+	jmp     L0036
+L0035:	ldx     #$FF
+	lda     #$D6
+L0036:	sta     _t
+	stx     _t+1
+	lda     #<(S0083)
+	ldx     #>(S0083)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 263
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L003A
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003B
+L003A:	ldx     #$00
+	lda     #$00
+	jeq     L003C
+L003B:	ldx     #$00
+	lda     #$01
+L003C:	jeq     L003D
+	ldx     #$00
+	lda     #$2A
+	jmp     L003E
+L003D:	ldx     #$FF
+	lda     #$D6
+L003E:	sta     _t
+	stx     _t+1
+	lda     #<(S0084)
+	ldx     #>(S0084)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 264
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0042
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0042:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0043
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0044
+L0043:	ldx     #$00
+	lda     #$00
+	jeq     L0045
+L0044:	ldx     #$00
+	lda     #$01
+L0045:	jeq     L0046
+	ldx     #$00
+	lda     #$2A
+	jmp     L0047
+L0046:	ldx     #$FF
+	lda     #$D6
+L0047:	sta     _t
+	stx     _t+1
+	lda     #<(S0085)
+	ldx     #>(S0085)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 265
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L004B
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L004C
+L004B:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L004D
+L004C:	ldx     #$00
+	lda     #$01
+L004D:	jeq     L004E
+	ldx     #$00
+	lda     #$2A
+	jmp     L004F
+L004E:	ldx     #$FF
+	lda     #$D6
+L004F:	sta     _t
+	stx     _t+1
+	lda     #<(S0086)
+	ldx     #>(S0086)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 266
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0053
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0054
+L0053:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0055
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0055:	ldx     #$00
+	lda     #$00
+	jeq     L0056
+L0054:	ldx     #$00
+	lda     #$01
+L0056:	jeq     L0057
+	ldx     #$00
+	lda     #$2A
+	jmp     L0058
+L0057:	ldx     #$FF
+	lda     #$D6
+L0058:	sta     _t
+	stx     _t+1
+	lda     #<(S0087)
+	ldx     #>(S0087)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 268
+	lda     #<(S0088)
+	ldx     #>(S0088)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 269
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4_B: near
+
+	.dbg	func, "f4_B", "00", static, "_f4_B"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 273
+	jsr     pushax
+	.dbg	line, "pr1220.c", 274
+	lda     #<(S0089)
+	ldx     #>(S0089)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 276
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0006
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jne     L0008
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0009
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L000A
+L0009:	ldx     #$00
+	lda     #$00
+	jeq     L000B
+L000A:	ldx     #$00
+	lda     #$01
+L000B:	jne     L0008
+	ldx     #$00
+	lda     #$00
+	jeq     L000C
+L0008:	ldx     #$00
+	lda     #$01
+L000C:	jeq     L000D
+	ldx     #$00
+	lda     #$2A
+	jmp     L000E
+L000D:	ldx     #$FF
+	lda     #$D6
+L000E:	sta     _t
+	stx     _t+1
+	lda     #<(S008A)
+	ldx     #>(S008A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 277
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	sta     _t
+	stx     _t+1
+	lda     #<(S008B)
+	ldx     #>(S008B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 278
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0015
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0016
+L0015:	ldx     #$00
+	lda     #$00
+	jeq     L0017
+L0016:	ldx     #$00
+	lda     #$01
+L0017:	jne     L0018
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0018:	ldx     #$00
+	lda     #$01
+	jeq     L0019
+	ldx     #$00
+	lda     #$2A
+	jmp     L001A
+L0019:	ldx     #$FF
+	lda     #$D6
+L001A:	sta     _t
+	stx     _t+1
+	lda     #<(S008C)
+	ldx     #>(S008C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 280
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001E
+	ldx     #$00
+	lda     #$00
+	jeq     L001F
+L001E:	ldx     #$00
+	lda     #$01
+L001F:	jne     L0020
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0021
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0022
+L0021:	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0022:	ldx     #$00
+	lda     #$01
+L0023:	jne     L0020
+	ldx     #$00
+	lda     #$00
+	jeq     L0024
+L0020:	ldx     #$00
+	lda     #$01
+L0024:	jeq     L0025
+	ldx     #$00
+	lda     #$2A
+	jmp     L0026
+L0025:	ldx     #$FF
+	lda     #$D6
+L0026:	sta     _t
+	stx     _t+1
+	lda     #<(S008D)
+	ldx     #>(S008D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 281
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002A
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L002B
+L002A:	ldx     #$00
+	lda     #$00
+	jeq     L002C
+L002B:	ldx     #$00
+	lda     #$01
+L002C:	jne     L002D
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L002E
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002F
+L002E:	ldx     #$00
+	lda     #$00
+	jeq     L0030
+L002F:	ldx     #$00
+	lda     #$01
+L0030:	jne     L002D
+	ldx     #$00
+	lda     #$00
+	jeq     L0031
+L002D:	ldx     #$00
+	lda     #$01
+L0031:	jeq     L0032
+	ldx     #$00
+	lda     #$2A
+	jmp     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S008E)
+	ldx     #>(S008E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 282
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0037
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0038
+L0037:	ldx     #$00
+	lda     #$00
+	jeq     L0039
+L0038:	ldx     #$00
+	lda     #$01
+L0039:	jne     L003A
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003B
+	ldx     #$00
+	lda     #$00
+	jeq     L003C
+L003B:	ldx     #$00
+	lda     #$01
+L003C:	jne     L003A
+	ldx     #$00
+	lda     #$00
+	jeq     L003D
+L003A:	ldx     #$00
+	lda     #$01
+L003D:	jeq     L003E
+	ldx     #$00
+	lda     #$2A
+	jmp     L003F
+L003E:	ldx     #$FF
+	lda     #$D6
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S008F)
+	ldx     #>(S008F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 283
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0043
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0044
+L0043:	ldx     #$00
+	lda     #$00
+	jeq     L0045
+L0044:	ldx     #$00
+	lda     #$01
+L0045:	jne     L0046
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0047
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0048
+L0047:	ldx     #$00
+	lda     #$00
+	jeq     L0049
+L0048:	ldx     #$00
+	lda     #$01
+L0049:	jne     L0046
+	ldx     #$00
+	lda     #$00
+	jeq     L004A
+L0046:	ldx     #$00
+	lda     #$01
+L004A:	jeq     L004B
+	ldx     #$00
+	lda     #$2A
+	jmp     L004C
+L004B:	ldx     #$FF
+	lda     #$D6
+L004C:	sta     _t
+	stx     _t+1
+	lda     #<(S0090)
+	ldx     #>(S0090)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 285
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0050
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0051
+L0050:	ldx     #$00
+	lda     #$00
+	jeq     L0052
+L0051:	ldx     #$00
+	lda     #$01
+L0052:	jne     L0053
+	ldx     #$00
+	lda     #$00
+	jeq     L0054
+L0053:	ldx     #$00
+	lda     #$01
+L0054:	jeq     L0055
+	ldx     #$00
+	lda     #$2A
+	jmp     L0056
+L0055:	ldx     #$FF
+	lda     #$D6
+L0056:	sta     _t
+	stx     _t+1
+	lda     #<(S0091)
+	ldx     #>(S0091)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 286
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L005A
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L005A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L005B
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005C
+L005B:	ldx     #$00
+	lda     #$00
+	jeq     L005D
+L005C:	ldx     #$00
+	lda     #$01
+L005D:	jne     L005E
+	ldx     #$00
+	lda     #$00
+	jeq     L005F
+L005E:	ldx     #$00
+	lda     #$01
+L005F:	jeq     L0060
+	ldx     #$00
+	lda     #$2A
+	jmp     L0061
+L0060:	ldx     #$FF
+	lda     #$D6
+L0061:	sta     _t
+	stx     _t+1
+	lda     #<(S0092)
+	ldx     #>(S0092)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 287
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0065
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0066
+L0065:	ldx     #$00
+	lda     #$00
+	jeq     L0067
+L0066:	ldx     #$00
+	lda     #$01
+L0067:	jne     L0068
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0069
+L0068:	ldx     #$00
+	lda     #$01
+L0069:	jeq     L006A
+	ldx     #$00
+	lda     #$2A
+	jmp     L006B
+L006A:	ldx     #$FF
+	lda     #$D6
+L006B:	sta     _t
+	stx     _t+1
+	lda     #<(S0093)
+	ldx     #>(S0093)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 288
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L006F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0070
+L006F:	ldx     #$00
+	lda     #$00
+	jeq     L0071
+L0070:	ldx     #$00
+	lda     #$01
+L0071:	jne     L0072
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jeq     L0073
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0073:	ldx     #$00
+	lda     #$00
+	jeq     L0074
+L0072:	ldx     #$00
+	lda     #$01
+L0074:	jeq     L0075
+	ldx     #$00
+	lda     #$2A
+	jmp     L0076
+L0075:	ldx     #$FF
+	lda     #$D6
+L0076:	sta     _t
+	stx     _t+1
+	lda     #<(S0094)
+	ldx     #>(S0094)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 290
+	lda     #<(S0095)
+	ldx     #>(S0095)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 291
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5_B: near
+
+	.dbg	func, "f5_B", "00", static, "_f5_B"
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "c", "00", auto, 2
+	.dbg	sym, "d", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 295
+	jsr     pushax
+	.dbg	line, "pr1220.c", 296
+	lda     #<(S0096)
+	ldx     #>(S0096)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "pr1220.c", 298
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0005
+	ldx     #$00
+	lda     #$00
+	jeq     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	jeq     L0007
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0008
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0008
+	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0008:	ldx     #$00
+	lda     #$01
+L0009:	jne     L000A
+L0007:	ldx     #$00
+	lda     #$00
+	jeq     L000B
+L000A:	ldx     #$00
+	lda     #$01
+L000B:	jeq     L000C
+	ldx     #$00
+	lda     #$2A
+	jmp     L000D
+L000C:	ldx     #$FF
+	lda     #$D6
+L000D:	sta     _t
+	stx     _t+1
+	lda     #<(S0097)
+	ldx     #>(S0097)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 299
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0098)
+	ldx     #>(S0098)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 300
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0014
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0014
+	ldx     #$00
+	lda     #$00
+	jeq     L0015
+L0014:	ldx     #$00
+	lda     #$01
+L0015:	jeq     L0016
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0016:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0099)
+	ldx     #>(S0099)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 302
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001A
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L001A
+	ldx     #$00
+	lda     #$00
+	jeq     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	jne     L001C
+	ldx     #$00
+	lda     #$00
+	jeq     L001D
+L001C:	ldx     #$00
+	lda     #$01
+L001D:	jeq     L001E
+	ldx     #$00
+	lda     #$2A
+	jmp     L001F
+L001E:	ldx     #$FF
+	lda     #$D6
+L001F:	sta     _t
+	stx     _t+1
+	lda     #<(S009A)
+	ldx     #>(S009A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 303
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0023
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L0023:	ldx     #$00
+	lda     #$01
+	jeq     L0024
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0025
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0025
+	ldx     #$00
+	lda     #$00
+	jeq     L0026
+L0025:	ldx     #$00
+	lda     #$01
+L0026:	jne     L0027
+L0024:	ldx     #$00
+	lda     #$00
+	jeq     L0028
+L0027:	ldx     #$00
+	lda     #$01
+L0028:	jeq     L0029
+	ldx     #$00
+	lda     #$2A
+	jmp     L002A
+L0029:	ldx     #$FF
+	lda     #$D6
+L002A:	sta     _t
+	stx     _t+1
+	lda     #<(S009B)
+	ldx     #>(S009B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 304
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L002E
+	ldx     #$00
+	lda     #$00
+	jeq     L002F
+L002E:	ldx     #$00
+	lda     #$01
+L002F:	jeq     L0030
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	jmp     L0031
+L0030:	ldx     #$00
+	lda     #$00
+	jeq     L0032
+L0031:	ldx     #$00
+	lda     #$01
+L0032:	jeq     L0033
+	ldx     #$00
+	lda     #$2A
+	jmp     L0034
+L0033:	ldx     #$FF
+	lda     #$D6
+L0034:	sta     _t
+	stx     _t+1
+	lda     #<(S009C)
+	ldx     #>(S009C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 305
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0038
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0038
+	ldx     #$00
+	lda     #$00
+	jeq     L0039
+L0038:	ldx     #$00
+	lda     #$01
+L0039:	jeq     L003A
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L003B
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+L003B:	ldx     #$00
+	lda     #$01
+	jne     L003C
+L003A:	ldx     #$00
+	lda     #$00
+	jeq     L003D
+L003C:	ldx     #$00
+	lda     #$01
+L003D:	jeq     L003E
+	ldx     #$00
+	lda     #$2A
+	jmp     L003F
+L003E:	ldx     #$FF
+	lda     #$D6
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S009D)
+	ldx     #>(S009D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 307
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0043
+	ldx     #$00
+	lda     #$00
+	jeq     L0044
+L0043:	ldx     #$00
+	lda     #$01
+L0044:	jeq     L0045
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0046
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0046
+	ldx     #$00
+	lda     #$00
+	jeq     L0047
+L0046:	ldx     #$00
+	lda     #$01
+L0047:	jne     L0048
+L0045:	ldx     #$00
+	lda     #$00
+	jeq     L0049
+L0048:	ldx     #$00
+	lda     #$01
+L0049:	jeq     L004A
+	ldx     #$00
+	lda     #$2A
+	jmp     L004B
+L004A:	ldx     #$FF
+	lda     #$D6
+L004B:	sta     _t
+	stx     _t+1
+	lda     #<(S009E)
+	ldx     #>(S009E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 308
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L004F
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L0050
+L004F:	ldx     #$00
+	lda     #$01
+L0050:	jeq     L0051
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0052
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0052
+	ldx     #$00
+	lda     #$00
+	jeq     L0053
+L0052:	ldx     #$00
+	lda     #$01
+L0053:	jne     L0054
+L0051:	ldx     #$00
+	lda     #$00
+	jeq     L0055
+L0054:	ldx     #$00
+	lda     #$01
+L0055:	jeq     L0056
+	ldx     #$00
+	lda     #$2A
+	jmp     L0057
+L0056:	ldx     #$FF
+	lda     #$D6
+L0057:	sta     _t
+	stx     _t+1
+	lda     #<(S009F)
+	ldx     #>(S009F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 309
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005B
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005B
+	ldx     #$00
+	lda     #$00
+	jeq     L005C
+L005B:	ldx     #$00
+	lda     #$01
+L005C:	jeq     L005D
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L005E
+	ldx     #$00
+	lda     #$00
+	jeq     L005F
+L005E:	ldx     #$00
+	lda     #$01
+L005F:	jne     L0060
+L005D:	ldx     #$00
+	lda     #$00
+	jeq     L0061
+L0060:	ldx     #$00
+	lda     #$01
+L0061:	jeq     L0062
+	ldx     #$00
+	lda     #$2A
+	jmp     L0063
+L0062:	ldx     #$FF
+	lda     #$D6
+L0063:	sta     _t
+	stx     _t+1
+	lda     #<(S00A0)
+	ldx     #>(S00A0)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 310
+	ldx     #$00
+	lda     #$00
+	sta     _s
+	stx     _s+1
+	ldx     #$00
+	lda     #$00
+	sta     _flags
+	stx     _flags+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0067
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L0067
+	ldx     #$00
+	lda     #$00
+	jeq     L0068
+L0067:	ldx     #$00
+	lda     #$01
+L0068:	jeq     L0069
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	jne     L006A
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	lda     #$00
+	jeq     L006B
+L006A:	ldx     #$00
+	lda     #$01
+L006B:	jne     L006C
+L0069:	ldx     #$00
+	lda     #$00
+	jeq     L006D
+L006C:	ldx     #$00
+	lda     #$01
+L006D:	jeq     L006E
+	ldx     #$00
+	lda     #$2A
+	jmp     L006F
+L006E:	ldx     #$FF
+	lda     #$D6
+L006F:	sta     _t
+	stx     _t+1
+	lda     #<(S00A1)
+	ldx     #>(S00A1)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "pr1220.c", 312
+	lda     #<(S00A2)
+	ldx     #>(S00A2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "pr1220.c", 313
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "pr1220.c", 317
+	jsr     _f0
+	.dbg	line, "pr1220.c", 319
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f1
+	.dbg	line, "pr1220.c", 320
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f2
+	.dbg	line, "pr1220.c", 321
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f3
+	.dbg	line, "pr1220.c", 322
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f4
+	.dbg	line, "pr1220.c", 323
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f5
+	.dbg	line, "pr1220.c", 325
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f1
+	.dbg	line, "pr1220.c", 326
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f2
+	.dbg	line, "pr1220.c", 327
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f3
+	.dbg	line, "pr1220.c", 328
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f4
+	.dbg	line, "pr1220.c", 329
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f5
+	.dbg	line, "pr1220.c", 331
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f3
+	.dbg	line, "pr1220.c", 332
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f4
+	.dbg	line, "pr1220.c", 333
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f5
+	.dbg	line, "pr1220.c", 334
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f3
+	.dbg	line, "pr1220.c", 335
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f4
+	.dbg	line, "pr1220.c", 336
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f5
+	.dbg	line, "pr1220.c", 338
+	jsr     _f0_B
+	.dbg	line, "pr1220.c", 340
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f1_B
+	.dbg	line, "pr1220.c", 341
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f2_B
+	.dbg	line, "pr1220.c", 342
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f3_B
+	.dbg	line, "pr1220.c", 343
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f4_B
+	.dbg	line, "pr1220.c", 344
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f5_B
+	.dbg	line, "pr1220.c", 346
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f1_B
+	.dbg	line, "pr1220.c", 347
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f2_B
+	.dbg	line, "pr1220.c", 348
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f3_B
+	.dbg	line, "pr1220.c", 349
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f4_B
+	.dbg	line, "pr1220.c", 350
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f5_B
+	.dbg	line, "pr1220.c", 352
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f3_B
+	.dbg	line, "pr1220.c", 353
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f4_B
+	.dbg	line, "pr1220.c", 354
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _f5_B
+	.dbg	line, "pr1220.c", 355
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f3_B
+	.dbg	line, "pr1220.c", 356
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f4_B
+	.dbg	line, "pr1220.c", 357
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _f5_B
+	.dbg	line, "pr1220.c", 359
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "pr1220.c", 360
+L0001:	rts
+
+	.dbg	line
+.endproc
+
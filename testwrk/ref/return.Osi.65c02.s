@@ -0,0 +1,628 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_val_char
+	.export		_val_int
+	.export		_val_long
+	.export		_test1_int_char
+	.export		_test1_int_int
+	.export		_test2_int_char
+	.export		_test2_int_int
+	.export		_test1_long_char
+	.export		_test1_long_int
+	.export		_test1_long_long
+	.export		_test2_long_char
+	.export		_test2_long_int
+	.export		_test2_long_long
+	.export		_main
+
+.segment	"DATA"
+
+_val_char:
+	.byte	$76
+_val_int:
+	.word	$5678
+_val_long:
+	.dword	$12345678
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$0A,$77,$69,$74,$68,$6F,$75,$74,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0003:
+	.byte	$25,$30,$34,$6C,$78,$20,$25,$30,$34,$6C,$78,$2C,$00
+S0022	:=	S0003+0
+S001F	:=	S0003+0
+S0006	:=	S0003+0
+S001C	:=	S0003+0
+S001B:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$6C,$6F,$6E,$67,$0A,$00
+S0009	:=	S001B+0
+S000A	:=	S0003+0
+S0018	:=	S0003+0
+S0015	:=	S0003+0
+S000D	:=	S0003+0
+S0013:
+	.byte	$0A,$77,$69,$74,$68,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0010	:=	S0003+0
+S0014:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$69,$6E,$74,$0A,$00
+S0002	:=	S0014+0
+S0023:
+	.byte	$66,$61,$69,$6C,$65,$64,$0A,$00
+S0004	:=	S0023+0
+S000E	:=	S0023+0
+S0020	:=	S0023+0
+S0016	:=	S0023+0
+S001D	:=	S0023+0
+S000B	:=	S0023+0
+S0019	:=	S0023+0
+S0007	:=	S0023+0
+S0011	:=	S0023+0
+S001A:
+	.byte	$6F,$6B,$0A,$00
+S0017	:=	S001A+0
+S001E	:=	S001A+0
+S0005	:=	S001A+0
+S000C	:=	S001A+0
+S0021	:=	S001A+0
+S000F	:=	S001A+0
+S0012	:=	S001A+0
+S0024	:=	S001A+0
+S0008	:=	S001A+0
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	stz     sreg
+	stz     sreg+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	stz     sreg
+	stz     sreg+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_long: near
+
+.segment	"CODE"
+
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_char: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _val_char
+	stz     sreg
+	stz     sreg+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_int: near
+
+.segment	"CODE"
+
+	lda     _val_int
+	ldx     _val_int+1
+	stz     sreg
+	stz     sreg+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_long: near
+
+.segment	"CODE"
+
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	lda     #$76
+	ldx     #$00
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	bne     L0024
+	dey
+	lda     (c_sp),y
+	cmp     #$76
+	beq     L0002
+L0024:	lda     #<(S0004)
+	ldx     #>(S0004)
+	bra     L0032
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+L0032:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	lda     #$78
+	ldx     #$56
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	cmp     #$56
+	bne     L0025
+	dey
+	lda     (c_sp),y
+	cmp     #$78
+	beq     L0005
+L0025:	lda     #<(S0007)
+	ldx     #>(S0007)
+	bra     L0033
+L0005:	lda     #<(S0008)
+	ldx     #>(S0008)
+L0033:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_long_char
+	jsr     steax0sp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$76
+	ldx     #$00
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0008
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	bra     L0034
+L0008:	lda     #<(S000C)
+	ldx     #>(S000C)
+L0034:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_long_int
+	jsr     steax0sp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$78
+	ldx     #$56
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	beq     L000A
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	bra     L0035
+L000A:	lda     #<(S000F)
+	ldx     #>(S000F)
+L0035:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1_long_long
+	jsr     steax0sp
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	beq     L000C
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	bra     L0036
+L000C:	lda     #<(S0012)
+	ldx     #>(S0012)
+L0036:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	lda     #$76
+	ldx     #$00
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	bne     L0026
+	dey
+	lda     (c_sp),y
+	cmp     #$76
+	beq     L000E
+L0026:	lda     #<(S0016)
+	ldx     #>(S0016)
+	bra     L0037
+L000E:	lda     #<(S0017)
+	ldx     #>(S0017)
+L0037:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     axlong
+	jsr     pusheax
+	lda     #$78
+	ldx     #$56
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	cmp     #$56
+	bne     L0027
+	dey
+	lda     (c_sp),y
+	cmp     #$78
+	beq     L0011
+L0027:	lda     #<(S0019)
+	ldx     #>(S0019)
+	bra     L0038
+L0011:	lda     #<(S001A)
+	ldx     #>(S001A)
+L0038:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_long_char
+	jsr     steax0sp
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$76
+	ldx     #$00
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$76
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0014
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	bra     L0039
+L0014:	lda     #<(S001E)
+	ldx     #>(S001E)
+L0039:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_long_int
+	jsr     steax0sp
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$78
+	ldx     #$56
+	jsr     push0ax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	beq     L0016
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	bra     L003A
+L0016:	lda     #<(S0021)
+	ldx     #>(S0021)
+L003A:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test2_long_long
+	jsr     steax0sp
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     tosneeax
+	beq     L0018
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	bra     L003B
+L0018:	lda     #<(S0024)
+	ldx     #>(S0024)
+L003B:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,447 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_putchar
+	.export		_in
+	.export		_xx
+	.export		_exchange
+	.export		_partition
+	.export		_quick
+	.export		_sort
+	.export		_putd
+	.export		_main
+
+.segment	"DATA"
+
+_in:
+	.word	$000A
+	.word	$0020
+	.word	$FFFF
+	.word	$0237
+	.word	$0003
+	.word	$0012
+	.word	$0001
+	.word	$FFCD
+	.word	$0315
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$65,$78,$63,$68,$61,$6E,$67,$65,$28,$25,$64,$2C,$25,$64,$29,$0A
+	.byte	$00
+
+.segment	"BSS"
+
+_xx:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ exchange (int *x, int *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_exchange: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sec
+	sbc     _xx
+	pha
+	txa
+	sbc     _xx+1
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sec
+	sbc     _xx
+	pha
+	txa
+	sbc     _xx+1
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     stax0sp
+	ldy     #$05
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ partition (int *a, int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_partition: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     stax0sp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     ldaxi
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000B
+L0005:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     ldaxi
+	ldy     #$02
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvc     L000C
+	eor     #$80
+L000C:	bmi     L0005
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0011
+	bpl     L0008
+L0011:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvc     L000D
+	eor     #$80
+L000D:	bpl     L000B
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$0A
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     _exchange
+L000B:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvc     L000E
+	eor     #$80
+L000E:	jmi     L0005
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$0A
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     _exchange
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ quick (int *a, int lb, int ub)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_quick: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	cmp     (c_sp),y
+	txa
+	iny
+	sbc     (c_sp),y
+	bvs     L0004
+	eor     #$80
+L0004:	bmi     L0001
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _partition
+	jsr     stax0sp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _quick
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	ina
+	bne     L0003
+	inx
+L0003:	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _quick
+L0001:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sort (int *a, int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _xx
+	stx     _xx+1
+	jsr     pushax
+	jsr     push0
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	jsr     _quick
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ putd (int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_putd: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	cpx     #$80
+	bcc     L0002
+	ldx     #$00
+	lda     #$2D
+	jsr     _putchar
+	jsr     ldax0sp
+	jsr     negax
+	jsr     stax0sp
+L0002:	jsr     pushw0sp
+	lda     #$0A
+	jsr     tosdiva0
+	stx     tmp1
+	ora     tmp1
+	beq     L0003
+	jsr     pushw0sp
+	lda     #$0A
+	jsr     tosdiva0
+	jsr     _putd
+L0003:	jsr     pushw0sp
+	ldy     #$00
+	ldx     #$00
+	lda     #$0A
+	jsr     tosmoda0
+	ldy     #$30
+	jsr     incaxy
+	jsr     _putchar
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(_in)
+	ldx     #>(_in)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _sort
+	ldx     #$00
+	txa
+	jsr     stax0sp
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$00
+	bne     L0006
+	lda     (c_sp)
+	cmp     #$0A
+L0006:	bcs     L0003
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_in)
+	tay
+	txa
+	adc     #>(_in)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _putd
+	ldx     #$00
+	lda     #$0A
+	jsr     _putchar
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+L0003:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,525 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "sort.c", 1575, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_putchar
+	.export		_in
+	.export		_xx
+	.export		_exchange
+	.export		_partition
+	.export		_quick
+	.export		_sort
+	.export		_putd
+	.export		_main
+
+.segment	"DATA"
+
+_in:
+	.word	$000A
+	.word	$0020
+	.word	$FFFF
+	.word	$0237
+	.word	$0003
+	.word	$0012
+	.word	$0001
+	.word	$FFCD
+	.word	$0315
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$65,$78,$63,$68,$61,$6E,$67,$65,$28,$25,$64,$2C,$25,$64,$29,$0A
+	.byte	$00
+
+.segment	"BSS"
+
+_xx:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ exchange (int *x, int *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_exchange: near
+
+	.dbg	func, "exchange", "00", static, "_exchange"
+	.dbg	sym, "x", "00", auto, 2
+	.dbg	sym, "y", "00", auto, 0
+	.dbg	sym, "t", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 14
+	jsr     pushax
+	.dbg	line, "sort.c", 17
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _xx
+	ldx     _xx+1
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _xx
+	ldx     _xx+1
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "sort.c", 18
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "sort.c", 19
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ partition (int *a, int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_partition: near
+
+	.dbg	func, "partition", "00", static, "_partition"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "j", "00", auto, 0
+	.dbg	sym, "v", "00", auto, -2
+	.dbg	sym, "k", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 22
+	jsr     pushax
+	.dbg	line, "sort.c", 25
+	jsr     decsp4
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "sort.c", 26
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "sort.c", 27
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "sort.c", 28
+	jmp     L000B
+	.dbg	line, "sort.c", 29
+L0002:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+L0005:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0007:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0005
+	.dbg	line, "sort.c", 30
+	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	jmp     L000A
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+L000A:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosgtax
+	jne     L0008
+	.dbg	line, "sort.c", 31
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosltax
+	jeq     L000B
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     _exchange
+	.dbg	line, "sort.c", 28
+L000B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0002
+	.dbg	line, "sort.c", 33
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     _exchange
+	.dbg	line, "sort.c", 34
+	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "sort.c", 35
+L0001:	ldy     #$0A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ quick (int *a, int lb, int ub)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_quick: near
+
+	.dbg	func, "quick", "00", static, "_quick"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "lb", "00", auto, 2
+	.dbg	sym, "ub", "00", auto, 0
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 38
+	jsr     pushax
+	.dbg	line, "sort.c", 41
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosgeax
+	jeq     L0002
+	.dbg	line, "sort.c", 42
+	jmp     L0001
+	.dbg	line, "sort.c", 43
+L0002:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _partition
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "sort.c", 44
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _quick
+	.dbg	line, "sort.c", 45
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _quick
+	.dbg	line, "sort.c", 46
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sort (int *a, int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sort: near
+
+	.dbg	func, "sort", "00", static, "_sort"
+	.dbg	sym, "a", "00", auto, 2
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 49
+	jsr     pushax
+	.dbg	line, "sort.c", 50
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _xx
+	stx     _xx+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$04
+	jsr     subeqysp
+	jsr     _quick
+	.dbg	line, "sort.c", 51
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ putd (int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_putd: near
+
+	.dbg	func, "putd", "00", static, "_putd"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 54
+	jsr     pushax
+	.dbg	line, "sort.c", 55
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "sort.c", 56
+	ldx     #$00
+	lda     #$2D
+	jsr     _putchar
+	.dbg	line, "sort.c", 57
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     negax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "sort.c", 59
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosdivax
+	stx     tmp1
+	ora     tmp1
+	jeq     L0003
+	.dbg	line, "sort.c", 60
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosdivax
+	jsr     _putd
+	.dbg	line, "sort.c", 61
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosmodax
+	ldy     #$30
+	jsr     incaxy
+	jsr     _putchar
+	.dbg	line, "sort.c", 62
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "sort.c", 67
+	jsr     decsp2
+	lda     #<(_in)
+	ldx     #>(_in)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _sort
+	.dbg	line, "sort.c", 68
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolult
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "sort.c", 69
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_in)
+	tay
+	txa
+	adc     #>(_in)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _putd
+	.dbg	line, "sort.c", 70
+	ldx     #$00
+	lda     #$0A
+	jsr     _putchar
+	.dbg	line, "sort.c", 68
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "sort.c", 73
+L0003:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "sort.c", 74
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,396 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+	.export		_f
+	.export		_f2
+	.export		_f3
+	.export		_a
+	.export		_b
+	.export		_i
+	.export		_f4
+	.export		_j
+	.export		_k
+	.export		_m
+	.export		_n
+	.export		_A
+	.export		_B
+	.export		_x
+	.export		_f5
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$64,$69,$73,$61,$73,$73,$65,$6D,$62,$6C,$65,$20,$74,$68,$69,$73
+	.byte	$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$74,$6F,$20,$63,$68,$65,$63
+	.byte	$6B,$20,$74,$68,$65,$20,$67,$65,$6E,$65,$72,$61,$74,$65,$64,$20
+	.byte	$63,$6F,$64,$65,$2E,$0A,$00
+
+.segment	"BSS"
+
+_a:
+	.res	20,$00
+_b:
+	.res	20,$00
+_i:
+	.res	2,$00
+_j:
+	.res	2,$00
+_k:
+	.res	2,$00
+_m:
+	.res	2,$00
+_n:
+	.res	2,$00
+_A:
+	.res	2,$00
+_B:
+	.res	2,$00
+_x:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f (i) int i;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	clc
+	adc     (c_sp)
+	pha
+	txa
+	ldy     #$01
+	adc     (c_sp),y
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (i) int i;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     _f
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+	iny
+	jsr     ldaxysp
+	jsr     _f
+	bra     L0003
+L0002:	tax
+	ina
+L0003:	jsr     tosaddax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (int i, int *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	ldy     #$17
+	jsr     pushwysp
+	ldy     #$19
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	php
+	ldy     #$16
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	plp
+	beq     L0002
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     _f
+	bra     L0003
+L0002:	ldx     #$00
+	txa
+L0003:	ldy     #$00
+	jsr     staxspidx
+	ldy     #$18
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	jsr     push0
+	lda     _i
+	ldx     _i+1
+	jsr     aslax1
+	clc
+	adc     #<(_a)
+	tay
+	txa
+	adc     #>(_a)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	lda     _i
+	ldx     _i+1
+	jsr     aslax1
+	clc
+	adc     #<(_b)
+	tay
+	txa
+	adc     #>(_b)
+	tax
+	tya
+	jsr     ldaxi
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	sta     tmp1
+	pla
+	ora     tmp1
+	beq     L0002
+	lda     _i
+	ora     _i+1
+	beq     L0002
+	lda     _i
+	ldx     _i+1
+	jsr     aslax1
+	clc
+	adc     #<(_a)
+	tay
+	txa
+	adc     #>(_a)
+	tax
+	tya
+	jsr     pushw
+	lda     _i
+	ldx     _i+1
+	jsr     aslax1
+	clc
+	adc     #<(_b)
+	tay
+	txa
+	adc     #>(_b)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     tossubax
+	stx     tmp1
+	ora     tmp1
+	bne     L0003
+L0002:	tax
+	bra     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	sta     _i
+	stz     _i+1
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	lda     _A
+	ldx     _A+1
+	jsr     pushax
+	lda     _k
+	ldx     _k+1
+	jsr     pushax
+	lda     _m
+	ldx     _m+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushw
+	lda     _A
+	ldx     _A+1
+	jsr     pushax
+	lda     _j
+	ldx     _j+1
+	jsr     pushax
+	lda     _m
+	ldx     _m+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     ldaxi
+	jsr     tosmulax
+	jsr     pushax
+	lda     _B
+	ldx     _B+1
+	jsr     pushax
+	lda     _k
+	ldx     _k+1
+	jsr     pushax
+	lda     _n
+	ldx     _n+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushw
+	lda     _B
+	ldx     _B+1
+	jsr     pushax
+	lda     _j
+	ldx     _j+1
+	jsr     pushax
+	lda     _n
+	ldx     _n+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     ldaxi
+	jsr     tosmulax
+	jsr     tosaddax
+	sta     _x
+	stx     _x+1
+	lda     _A
+	ldx     _A+1
+	jsr     pushax
+	lda     _k
+	ldx     _k+1
+	jsr     pushax
+	lda     _m
+	ldx     _m+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushw
+	lda     _B
+	ldx     _B+1
+	jsr     pushax
+	lda     _j
+	ldx     _j+1
+	jsr     pushax
+	lda     _n
+	ldx     _n+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     ldaxi
+	jsr     tosmulax
+	jsr     pushax
+	lda     _B
+	ldx     _B+1
+	jsr     pushax
+	lda     _k
+	ldx     _k+1
+	jsr     pushax
+	lda     _n
+	ldx     _n+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushw
+	lda     _A
+	ldx     _A+1
+	jsr     pushax
+	lda     _j
+	ldx     _j+1
+	jsr     pushax
+	lda     _m
+	ldx     _m+1
+	jsr     tosmulax
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     ldaxi
+	jsr     tosmulax
+	jsr     tossubax
+	sta     _x
+	stx     _x+1
+	rts
+
+.endproc
+
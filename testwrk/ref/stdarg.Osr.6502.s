@@ -0,0 +1,273 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$00
+S0005:
+	.byte	$25,$73,$25,$73,$20,$25,$77,$25,$63,$00
+S0004:
+	.byte	$74,$65,$73,$74,$20,$25,$64,$25,$63,$00
+S0008:
+	.byte	$25,$73,$25,$73,$20,$25,$66,$25,$63,$00
+S000B:
+	.byte	$28,$31,$20,$32,$20,$33,$20,$34,$29,$00
+S0002:
+	.byte	$74,$65,$73,$74,$20,$25,$73,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$20,$31,$0A,$00
+S0012	:=	S0005+7
+S0011	:=	S0005+7
+S000A:
+	.byte	$73,$74,$00
+S000E:
+	.byte	$25,$78,$00
+S000D:
+	.byte	$25,$64,$00
+S0006:
+	.byte	$74,$65,$00
+S0007	:=	S000A+0
+S000C	:=	S0005+7
+S0009	:=	S0006+0
+S000F:
+	.byte	$25,$73,$00
+S0003:
+	.byte	$32,$00
+
+; ---------------------------------------------------------------
+; int __near__ print (char *fmt, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax1
+	jsr     stax0sp
+L0002:	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$02
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jeq     L0003
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$02
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$25
+	jne     L0006
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax1
+	jsr     pushax
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	cmp     #$62
+	beq     L0009
+	cmp     #$63
+	beq     L000A
+	cmp     #$64
+	beq     L000B
+	cmp     #$66
+	beq     L000E
+	cmp     #$73
+	beq     L000D
+	cmp     #$77
+	beq     L000C
+	jmp     L000F
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jmp     L0011
+L000A:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jmp     L0013
+L000B:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jmp     L0013
+L000C:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jmp     L0013
+L000D:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	jsr     ldaxi
+	jmp     L0013
+L000E:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	ldy     #$02
+	jsr     subeqysp
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$06
+	jmp     L0011
+L000F:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jmp     L0020
+L0006:	lda     #<(S0012)
+	ldx     #>(S0012)
+L0020:	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$04
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+L0013:	jsr     pushax
+	ldy     #$04
+L0011:	jsr     _printf
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax1
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	jmp     L0002
+L0003:	ldy     #$02
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _print
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _print
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$06
+	jsr     _print
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #$0A
+	jsr     pusha0
+	tay
+	jsr     _print
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$05
+	ldx     #$00
+	jsr     push0ax
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _print
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
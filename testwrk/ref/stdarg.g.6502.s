@@ -0,0 +1,370 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "stdarg.c", 3011, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$00
+S0005:
+	.byte	$25,$73,$25,$73,$20,$25,$77,$25,$63,$00
+S0004:
+	.byte	$74,$65,$73,$74,$20,$25,$64,$25,$63,$00
+S0008:
+	.byte	$25,$73,$25,$73,$20,$25,$66,$25,$63,$00
+S000B:
+	.byte	$28,$31,$20,$32,$20,$33,$20,$34,$29,$00
+S0002:
+	.byte	$74,$65,$73,$74,$20,$25,$73,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$20,$31,$0A,$00
+S0012	:=	S0005+7
+S0011	:=	S0005+7
+S000A:
+	.byte	$73,$74,$00
+S000E:
+	.byte	$25,$78,$00
+S000D:
+	.byte	$25,$64,$00
+S0006:
+	.byte	$74,$65,$00
+S0007	:=	S000A+0
+S000C	:=	S0005+7
+S0009	:=	S0006+0
+S000F:
+	.byte	$25,$73,$00
+S0003:
+	.byte	$32,$00
+
+; ---------------------------------------------------------------
+; int __near__ print (char *fmt, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+	.dbg	func, "print", "00", static, "_print"
+	.dbg	sym, "fmt", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "ap", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "stdarg.c", 45
+	jsr     enter
+	.dbg	line, "stdarg.c", 47
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "stdarg.c", 48
+L0002:	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "stdarg.c", 50
+L0005:	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$25
+	jsr     booleq
+	jeq     L0006
+	.dbg	line, "stdarg.c", 51
+	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0007
+	.dbg	line, "stdarg.c", 89
+L0007:	cmp     #$62
+	jeq     L0009
+	cmp     #$63
+	jeq     L000A
+	cmp     #$64
+	jeq     L000B
+	cmp     #$66
+	jeq     L000E
+	cmp     #$73
+	jeq     L000D
+	cmp     #$77
+	jeq     L000C
+	jmp     L000F
+	.dbg	line, "stdarg.c", 54
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "stdarg.c", 63
+	jmp     L0008
+	.dbg	line, "stdarg.c", 67
+L000A:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 68
+	jmp     L0008
+	.dbg	line, "stdarg.c", 70
+L000B:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 71
+	jmp     L0008
+	.dbg	line, "stdarg.c", 74
+L000C:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 75
+	jmp     L0008
+	.dbg	line, "stdarg.c", 77
+L000D:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 78
+	jmp     L0008
+	.dbg	line, "stdarg.c", 81
+L000E:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "stdarg.c", 85
+	jmp     L0008
+	.dbg	line, "stdarg.c", 87
+L000F:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 88
+	jmp     L0008
+	.dbg	line, "stdarg.c", 90
+L0008:	jmp     L0004
+	.dbg	line, "stdarg.c", 91
+L0006:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdarg.c", 48
+L0004:	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	lda     regsave
+	ldx     regsave+1
+	jmp     L0002
+	.dbg	line, "stdarg.c", 94
+L0003:	ldy     #$02
+	jsr     leavey
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "stdarg.c", 30
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _print
+	.dbg	line, "stdarg.c", 31
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _print
+	.dbg	line, "stdarg.c", 32
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldy     #$06
+	jsr     _print
+	.dbg	line, "stdarg.c", 33
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldy     #$0A
+	jsr     _print
+	.dbg	line, "stdarg.c", 35
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$05
+	ldx     #$00
+	jsr     pusheax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldy     #$0C
+	jsr     _print
+	.dbg	line, "stdarg.c", 42
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "stdarg.c", 43
+L0001:	rts
+
+	.dbg	line
+.endproc
+
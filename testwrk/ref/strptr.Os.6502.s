@@ -0,0 +1,313 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memcpy
+	.export		_b1
+	.export		_b2
+	.export		_Xreaddir
+	.export		_main
+
+.segment	"DATA"
+
+_b2:
+	.byte	$20,$20,$22,$74,$65,$73,$74,$22,$20,$20,$00
+	.res	5,$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$58,$72,$65,$61,$64,$64,$69,$72,$3A,$20,$27,$25,$73,$27,$0A,$00
+S0003	:=	S0002+0
+S0005:
+	.byte	$73,$74,$61,$72,$74,$0A,$00
+S0008:
+	.byte	$64,$6F,$6E,$65,$0A,$00
+S0006:
+	.byte	$4E,$55,$4C,$4C,$0A,$00
+S0007:
+	.byte	$3D,$25,$73,$0A,$00
+
+.segment	"BSS"
+
+_b1:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; struct Xdirent *__near__ Xreaddir (struct $anon-struct-0007 *dir)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Xreaddir: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$44
+	jsr     subysp
+	ldy     #$45
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	sta     M0001+17
+	stx     M0001+17+1
+	ldy     #$04
+L0002:	lda     _b1-4,y
+	sta     (c_sp),y
+	iny
+	cpy     #$08
+	bne     L0002
+	lda     #$04
+	jsr     leaa0sp
+	ldy     #$45
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$45
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	jsr     incax4
+	ldy     #$01
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	clc
+	dey
+	lda     (c_sp),y
+	bcc     L0014
+	inx
+L0014:	jsr     pushax
+	lda     #$FE
+	jsr     tosmula0
+	sta     M0001+19
+	stx     M0001+19+1
+	ldy     #$04
+L0003:	lda     _b2-4,y
+	sta     (c_sp),y
+	iny
+	cpy     #$14
+	bne     L0003
+	lda     #$04
+	jsr     leaa0sp
+	ldy     #$45
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$45
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (c_sp),y
+	clc
+	adc     ptr1
+	ldx     ptr1+1
+	bcc     L0015
+	inx
+L0015:	dey
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	dey
+	sta     (c_sp),y
+	jmp     L000C
+L0004:	lda     #$04
+	jsr     leaa0sp
+	dey
+	clc
+	adc     (c_sp),y
+	bcc     L0007
+	inx
+L0007:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	ldy     #$03
+	sta     (c_sp),y
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	cmp     #$11
+	bcc     L0008
+	ldx     #$00
+	txa
+	jmp     L0001
+L0008:	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$22
+	bne     L0018
+	dey
+	clc
+	lda     #$01
+	adc     (c_sp),y
+	sta     (c_sp),y
+	jmp     L001A
+L0018:	lda     (c_sp),y
+	cmp     #$62
+	bne     L000C
+	ldx     #$00
+	txa
+	jmp     L0001
+L000C:	ldy     #$02
+L001A:	lda     (c_sp),y
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$00
+	ldy     #$02
+	jmp     L002B
+L000E:	dey
+	lda     (c_sp),y
+	tax
+	iny
+	lda     (c_sp),y
+	sta     M0001,x
+	dey
+	clc
+	lda     #$01
+	adc     (c_sp),y
+L002B:	sta     (c_sp),y
+	lda     #$04
+	jsr     leaa0sp
+	dey
+	clc
+	adc     (c_sp),y
+	bcc     L0012
+	inx
+L0012:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	ldy     #$03
+	sta     (c_sp),y
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$22
+	bne     L000E
+	dey
+	lda     (c_sp),y
+	tay
+	lda     #$00
+	sta     M0001,y
+	ldy     #$02
+	lda     (c_sp),y
+	sta     M0001+22
+	lda     #<(M0001)
+	ldx     #>(M0001)
+L0001:	ldy     #$46
+	jmp     addysp
+
+.segment	"BSS"
+
+M0001:
+	.res	23,$00
+M0002:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$11
+	jsr     subysp
+	ldy     #$10
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+	ldy     #$16
+	jsr     subysp
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _Xreaddir
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	bne     L0003
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jmp     L0006
+L0003:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+L0006:	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$2E,$00
+	.res	15,$00
+
+.endproc
+
@@ -0,0 +1,946 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_canonrect
+	.export		_addpoint
+	.export		_makepoint
+	.export		_makerect
+	.export		_y
+	.export		_odd
+	.export		_ptinrect
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$61
+	.byte	$62
+	.byte	$00
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$77,$69,$74,$68,$69,$6E,$20,$28,$25,$64,$2C,$25,$64,$3B,$20,$25
+	.byte	$64,$2C,$25,$64,$29,$0A,$0D,$00
+S0002:
+	.byte	$28,$25,$64,$2C,$25,$64,$29,$20,$69,$73,$20,$00
+S0003:
+	.byte	$6E,$6F,$74,$20,$00
+S0001:
+	.byte	$25,$73,$0A,$0D,$00
+
+; ---------------------------------------------------------------
+; void __near__ canonrect (struct rect *d, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_canonrect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bpl     L0002
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	jmp     L0016
+L0002:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$05
+L0016:	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bpl     L0004
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	jmp     L0017
+L0004:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+L0017:	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$02
+	jsr     staxspidx
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L0006
+	beq     L0006
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	jmp     L0018
+L0006:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$05
+L0018:	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxspidx
+	iny
+	jsr     pushwysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L0008
+	beq     L0008
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	jmp     L0019
+L0008:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+L0019:	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$06
+	jsr     staxspidx
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addpoint (struct point *p, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addpoint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr2+1
+	dey
+	lda     (c_sp),y
+	sta     ptr2
+	dey
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	iny
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	sta     (ptr2),y
+	iny
+	txa
+	sta     (ptr2),y
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr2+1
+	dey
+	lda     (c_sp),y
+	sta     ptr2
+	dey
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	sta     (ptr2),y
+	iny
+	txa
+	sta     (ptr2),y
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makepoint (struct point *p, int x, int y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makepoint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$02
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makerect (struct rect *d, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makerect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     stax0sp
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     staxysp
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$02
+	bcc     L0002
+	inx
+L0002:	jsr     _canonrect
+	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ odd (struct odd *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_odd: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ ptinrect (struct point *p, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ptinrect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	jmi     L0002
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bpl     L0002
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L0002
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L0003
+L0002:	ldx     #$00
+	txa
+	jmp     incsp4
+L0003:	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$12
+	jsr     subysp
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+	jsr     decsp4
+	ldy     #$03
+L0003:	lda     M0002,y
+	sta     (c_sp),y
+	dey
+	bpl     L0003
+	ldy     #$10
+	jsr     subysp
+	ldy     #$0F
+L0004:	lda     M0003,y
+	sta     (c_sp),y
+	dey
+	bpl     L0004
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$24
+	bcc     L0005
+	inx
+L0005:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$F6
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$FF
+	sta     (c_sp),y
+	tax
+	lda     #$F6
+	jsr     _makepoint
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$14
+	bcc     L0006
+	inx
+L0006:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$14
+	bcc     L0007
+	inx
+L0007:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$24
+	bcc     L0008
+	inx
+L0008:	jsr     _addpoint
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$24
+	bcc     L0009
+	inx
+L0009:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$0A
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	tax
+	lda     #$0A
+	jsr     _makepoint
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$18
+	bcc     L000A
+	inx
+L000A:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$18
+	bcc     L000B
+	inx
+L000B:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$24
+	bcc     L000C
+	inx
+L000C:	jsr     _addpoint
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$1C
+	bcc     L000D
+	inx
+L000D:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$14
+	bcc     L000E
+	inx
+L000E:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$18
+	bcc     L000F
+	inx
+L000F:	jsr     _makerect
+	ldy     #$24
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+L0010:	ldy     #$25
+	lda     (c_sp),y
+	cmp     #$00
+	bne     L0014
+	dey
+	lda     (c_sp),y
+	cmp     #$04
+L0014:	jcs     L0011
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$24
+	bcc     L0015
+	inx
+L0015:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	ldy     #$29
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax2
+	clc
+	adc     #$04
+	bcc     L0016
+	inx
+	clc
+L0016:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	ldy     #$29
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax2
+	clc
+	adc     #$04
+	bcc     L0017
+	inx
+	clc
+L0017:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _makepoint
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$27
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     aslax2
+	clc
+	adc     #$02
+	bcc     L0018
+	inx
+	clc
+L0018:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$20
+	bcc     L001A
+	inx
+L001A:	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$1A
+	bcc     L001B
+	inx
+L001B:	jsr     _ptinrect
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+	bne     L0019
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0019:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$25
+	jsr     pushwysp
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$24
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0010
+L0011:	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _odd
+	ldx     #$00
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+	.word	$0000
+M0002:
+	.word	$0140
+	.word	$0140
+M0003:
+	.word	$FFFF
+	.word	$FFFF
+	.word	$0001
+	.word	$0001
+	.word	$0014
+	.word	$012C
+	.word	$01F4
+	.word	$0190
+
+.endproc
+
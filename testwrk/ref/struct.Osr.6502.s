@@ -0,0 +1,536 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_canonrect
+	.export		_addpoint
+	.export		_makepoint
+	.export		_makerect
+	.export		_y
+	.export		_odd
+	.export		_ptinrect
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$61
+	.byte	$62
+	.byte	$00
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$77,$69,$74,$68,$69,$6E,$20,$28,$25,$64,$2C,$25,$64,$3B,$20,$25
+	.byte	$64,$2C,$25,$64,$29,$0A,$0D,$00
+S0002:
+	.byte	$28,$25,$64,$2C,$25,$64,$29,$20,$69,$73,$20,$00
+S0003:
+	.byte	$6E,$6F,$74,$20,$00
+S0001:
+	.byte	$25,$73,$0A,$0D,$00
+
+; ---------------------------------------------------------------
+; void __near__ canonrect (struct rect *d, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_canonrect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosicmp
+	bpl     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jmp     L000A
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+L000A:	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosicmp
+	bpl     L0004
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jmp     L000B
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+L000B:	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxspidx
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosicmp
+	bmi     L0006
+	beq     L0006
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jmp     L000C
+L0006:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+L000C:	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxspidx
+	iny
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosicmp
+	bmi     L0008
+	beq     L0008
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jmp     L000D
+L0008:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+L000D:	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxspidx
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addpoint (struct point *p, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addpoint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr2
+	stx     ptr2+1
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	jsr     ldax0sp
+	jsr     ldaxi
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	ldy     #$00
+	sta     (ptr2),y
+	iny
+	txa
+	sta     (ptr2),y
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr2
+	stx     ptr2+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	sta     sreg
+	stx     sreg+1
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	ldy     #$02
+	sta     (ptr2),y
+	iny
+	txa
+	sta     (ptr2),y
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makepoint (struct point *p, int x, int y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makepoint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     ldptr1ysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$05
+	jsr     ldptr1ysp
+	jsr     ldax0sp
+	ldy     #$02
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makerect (struct rect *d, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makerect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     stax0sp
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _canonrect
+	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ odd (struct odd *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_odd: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ ptinrect (struct point *p, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ptinrect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     tosicmp
+	bmi     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosicmp
+	bpl     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     tosicmp
+	bmi     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosicmp
+	bmi     L0003
+L0002:	ldx     #$00
+	txa
+	jmp     incsp4
+L0003:	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$12
+	jsr     subysp
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+	jsr     decsp4
+	ldy     #$03
+L0003:	lda     M0002,y
+	sta     (c_sp),y
+	dey
+	bpl     L0003
+	ldy     #$10
+	jsr     subysp
+	ldy     #$0F
+L0004:	lda     M0003,y
+	sta     (c_sp),y
+	dey
+	bpl     L0004
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$FF
+	lda     #$F6
+	jsr     pushax
+	jsr     _makepoint
+	lda     #$10
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$24
+	jsr     leaa0sp
+	jsr     _addpoint
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	jsr     _makepoint
+	lda     #$14
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$16
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$24
+	jsr     leaa0sp
+	jsr     _addpoint
+	lda     #$18
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$18
+	jsr     leaa0sp
+	jsr     _makerect
+	ldx     #$00
+	txa
+	ldy     #$24
+	jsr     staxysp
+L0005:	ldy     #$25
+	lda     (c_sp),y
+	cmp     #$00
+	bne     L0009
+	dey
+	lda     (c_sp),y
+	cmp     #$04
+L0009:	jcs     L0006
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax2
+	jsr     leaaxsp
+	jsr     pushw
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax4
+	jsr     leaaxsp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _makepoint
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax2
+	jsr     leaaxsp
+	jsr     pushw
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$1A
+	jsr     leaa0sp
+	jsr     _ptinrect
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+	bne     L000A
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$25
+	jsr     pushwysp
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$24
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0005
+L0006:	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _odd
+	ldx     #$00
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+	.word	$0000
+M0002:
+	.word	$0140
+	.word	$0140
+M0003:
+	.word	$FFFF
+	.word	$FFFF
+	.word	$0001
+	.word	$0001
+	.word	$0014
+	.word	$012C
+	.word	$01F4
+	.word	$0190
+
+.endproc
+
@@ -0,0 +1,659 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "struct.c", 6138, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_canonrect
+	.export		_addpoint
+	.export		_makepoint
+	.export		_makerect
+	.export		_y
+	.export		_odd
+	.export		_ptinrect
+	.export		_main
+
+.segment	"DATA"
+
+_y:
+	.byte	$61
+	.byte	$62
+	.byte	$00
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$77,$69,$74,$68,$69,$6E,$20,$28,$25,$64,$2C,$25,$64,$3B,$20,$25
+	.byte	$64,$2C,$25,$64,$29,$0A,$0D,$00
+S0002:
+	.byte	$28,$25,$64,$2C,$25,$64,$29,$20,$69,$73,$20,$00
+S0003:
+	.byte	$6E,$6F,$74,$20,$00
+S0001:
+	.byte	$25,$73,$0A,$0D,$00
+
+; ---------------------------------------------------------------
+; void __near__ canonrect (struct rect *d, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_canonrect: near
+
+	.dbg	func, "canonrect", "00", static, "_canonrect"
+	.dbg	sym, "d", "00", auto, 2
+	.dbg	sym, "r", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 18
+	jsr     pushax
+	.dbg	line, "struct.c", 19
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosltax
+	jeq     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jmp     L0003
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+L0003:	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "struct.c", 20
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosltax
+	jeq     L0004
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jmp     L0005
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+L0005:	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "struct.c", 21
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosgtax
+	jeq     L0006
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jmp     L0007
+L0006:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+L0007:	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "struct.c", 22
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosgtax
+	jeq     L0008
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jmp     L0009
+L0008:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+L0009:	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "struct.c", 23
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addpoint (struct point *p, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addpoint: near
+
+	.dbg	func, "addpoint", "00", static, "_addpoint"
+	.dbg	sym, "p", "00", auto, 4
+	.dbg	sym, "p1", "00", auto, 2
+	.dbg	sym, "p2", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 25
+	jsr     pushax
+	.dbg	line, "struct.c", 26
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "struct.c", 27
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     tosaddax
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "struct.c", 28
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makepoint (struct point *p, int x, int y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makepoint: near
+
+	.dbg	func, "makepoint", "00", static, "_makepoint"
+	.dbg	sym, "p", "00", auto, 4
+	.dbg	sym, "x", "00", auto, 2
+	.dbg	sym, "y", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 30
+	jsr     pushax
+	.dbg	line, "struct.c", 31
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "struct.c", 32
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "struct.c", 33
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ makerect (struct rect *d, struct point *p1, struct point *p2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_makerect: near
+
+	.dbg	func, "makerect", "00", static, "_makerect"
+	.dbg	sym, "d", "00", auto, 4
+	.dbg	sym, "p1", "00", auto, 2
+	.dbg	sym, "p2", "00", auto, 0
+	.dbg	sym, "r", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 35
+	jsr     pushax
+	.dbg	line, "struct.c", 37
+	jsr     decsp8
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "struct.c", 38
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "struct.c", 39
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "struct.c", 40
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "struct.c", 42
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     _canonrect
+	.dbg	line, "struct.c", 43
+	ldy     #$0E
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ odd (struct odd *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_odd: near
+
+	.dbg	func, "odd", "00", static, "_odd"
+	.dbg	sym, "y", "00", auto, 0
+	.dbg	sym, "x", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 51
+	jsr     pushax
+	.dbg	line, "struct.c", 52
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	.dbg	line, "struct.c", 53
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "struct.c", 54
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ ptinrect (struct point *p, struct rect *r)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ptinrect: near
+
+	.dbg	func, "ptinrect", "00", static, "_ptinrect"
+	.dbg	sym, "p", "00", auto, 2
+	.dbg	sym, "r", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 154
+	jsr     pushax
+	.dbg	line, "struct.c", 155
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosgeax
+	jeq     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	.dbg	line, "struct.c", 156
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosltax
+	jeq     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     tosgeax
+	jeq     L0002
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     tosltax
+	jne     L0003
+L0002:	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "struct.c", 157
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -6
+	.dbg	sym, "screen", "00", auto, -14
+	.dbg	sym, "origin", "00", auto, -18
+	.dbg	sym, "maxpt", "00", auto, -22
+	.dbg	sym, "pts", "00", auto, -38
+
+.segment	"CODE"
+
+	.dbg	line, "struct.c", 182
+	ldy     #$12
+	jsr     subysp
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+	.dbg	line, "struct.c", 183
+	jsr     decsp4
+	ldy     #$03
+L0003:	lda     M0002,y
+	sta     (c_sp),y
+	dey
+	bpl     L0003
+	.dbg	line, "struct.c", 185
+	ldy     #$10
+	jsr     subysp
+	ldy     #$0F
+L0004:	lda     M0003,y
+	sta     (c_sp),y
+	dey
+	bpl     L0004
+	.dbg	line, "struct.c", 191
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$FF
+	lda     #$F6
+	jsr     pushax
+	ldx     #$FF
+	lda     #$F6
+	jsr     _makepoint
+	.dbg	line, "struct.c", 193
+	lda     #$10
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$24
+	jsr     leaa0sp
+	jsr     _addpoint
+	.dbg	line, "struct.c", 197
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _makepoint
+	.dbg	line, "struct.c", 200
+	lda     #$14
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$16
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$24
+	jsr     leaa0sp
+	jsr     _addpoint
+	.dbg	line, "struct.c", 201
+	lda     #$18
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$18
+	jsr     leaa0sp
+	jsr     _makerect
+	.dbg	line, "struct.c", 207
+	ldx     #$00
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+L0005:	ldy     #$25
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0009
+	cmp     #$04
+L0009:	jsr     boolult
+	jne     L0008
+	jmp     L0006
+	.dbg	line, "struct.c", 208
+L0008:	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax2
+	jsr     leaaxsp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax4
+	jsr     leaaxsp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _makepoint
+	.dbg	line, "struct.c", 209
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     incax2
+	jsr     leaaxsp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "struct.c", 211
+	lda     #$20
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$1A
+	jsr     leaa0sp
+	jsr     _ptinrect
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+L000B:	jsr     booleq
+	jeq     L000A
+	.dbg	line, "struct.c", 216
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "struct.c", 218
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	.dbg	line, "struct.c", 219
+	ldy     #$23
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "struct.c", 207
+	ldy     #$24
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0005
+	.dbg	line, "struct.c", 222
+L0006:	lda     #<(_y)
+	ldx     #>(_y)
+	jsr     _odd
+	.dbg	line, "struct.c", 227
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "struct.c", 228
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+	.word	$0000
+M0002:
+	.word	$0140
+	.word	$0140
+M0003:
+	.word	$FFFF
+	.word	$FFFF
+	.word	$0001
+	.word	$0001
+	.word	$0014
+	.word	$012C
+	.word	$01F4
+	.word	$0190
+
+.endproc
+
@@ -0,0 +1,732 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_testbig
+	.export		_testbackslash
+	.export		_backslash
+	.export		_f
+	.export		_g
+	.export		_h
+	.export		_limit
+	.export		_big
+	.export		_main
+
+.segment	"RODATA"
+
+S001D:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$20,$28,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$29,$0A,$00
+S0019:
+	.byte	$25,$64,$20,$64,$65,$66,$61,$75,$6C,$74,$73,$0A,$00
+S001A:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$0A,$00
+S001C	:=	S001A+0
+S001B	:=	S001A+0
+S0002:
+	.byte	$25,$63,$20,$3D,$20,$25,$63,$0A,$00
+S0004:
+	.byte	$78,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$69,$20,$3D,$20,$25,$64,$0A,$00
+S0017	:=	S0018+0
+S0016	:=	S0018+0
+S0015	:=	S0018+0
+S000D	:=	S0018+0
+S000E	:=	S0018+0
+S000F	:=	S0018+0
+S0010	:=	S0018+0
+S0011	:=	S0018+0
+S0012	:=	S0018+0
+S0013	:=	S0018+0
+S0014	:=	S0018+0
+S0001:
+	.byte	$62,$66,$6E,$72,$74,$76,$78,$00
+S000B:
+	.byte	$36,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$35,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$64,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$33,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$31,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$32,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$66,$3A,$0A,$00
+S0005:
+	.byte	$67,$3A,$0A,$00
+S000C:
+	.byte	$68,$3A,$0A,$00
+S0023:
+	.byte	$35,$0A,$00
+S0024:
+	.byte	$30,$0A,$00
+S0025:
+	.byte	$31,$0A,$00
+S0026:
+	.byte	$32,$0A,$00
+S0027:
+	.byte	$33,$0A,$00
+S0028:
+	.byte	$34,$0A,$00
+S0029	:=	S0023+0
+S0021	:=	S0027+0
+S0020	:=	S0026+0
+S001F	:=	S0025+0
+S001E	:=	S0024+0
+S0022	:=	S0028+0
+
+; ---------------------------------------------------------------
+; int __near__ testbig (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbig: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     steax0sp
+L0002:	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$07
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	jsr     tsteax
+	beq     L0003
+	jsr     ldeax0sp
+	jsr     _big
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     laddeq0sp
+	jmp     L0002
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     stax0sp
+L0002:	jsr     ldptr10sp
+	ldx     #$00
+	lda     (ptr1,x)
+	beq     L0003
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _backslash
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ backslash (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	cpx     #$00
+	bne     L0003
+	cmp     #$62
+	beq     L0001
+	cmp     #$66
+	beq     L0001
+	cmp     #$6E
+	beq     L0001
+	cmp     #$72
+	beq     L0001
+	cmp     #$74
+	beq     L0001
+	cmp     #$76
+	beq     L0001
+	jmp     L0016
+L0003:	ldx     #$00
+L0016:	lda     #$78
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	jsr     decsp2
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	rol     a
+	beq     L0003
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     stax0sp
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0008
+	cmp     #$01
+	beq     L0012
+	cmp     #$02
+	beq     L0012
+	cmp     #$07
+	beq     L0012
+	cmp     #$08
+	beq     L0012
+	cmp     #$09
+	beq     L0012
+	cmp     #$10
+	beq     L0012
+	cmp     #$11
+	beq     L0012
+	cmp     #$12
+	beq     L0012
+	cmp     #$13
+	beq     L0012
+	cmp     #$14
+	bne     L0008
+L0012:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$0B
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	rol     a
+	jeq     L0003
+	jsr     ldax0sp
+	cpx     #$00
+	bne     L001A
+	cmp     #$01
+	beq     L0009
+	cmp     #$02
+	beq     L0009
+	cmp     #$03
+	beq     L000B
+	cmp     #$04
+	beq     L000B
+	cmp     #$05
+	beq     L000B
+	cmp     #$06
+	beq     L000E
+	cmp     #$07
+	beq     L000E
+	cmp     #$08
+	beq     L000E
+	jmp     L0011
+L001A:	cpx     #$03
+	bne     L001B
+	cmp     #$E9
+	beq     L0012
+	cmp     #$EA
+	beq     L0012
+	cmp     #$EB
+	beq     L0012
+	cmp     #$EC
+	beq     L0012
+	jmp     L0011
+L001B:	cpx     #$0B
+	bne     L0011
+	cmp     #$B9
+	beq     L0016
+	cmp     #$BA
+	beq     L0016
+	cmp     #$BB
+	beq     L0016
+	cmp     #$BC
+	beq     L0016
+	jmp     L0011
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jmp     L0021
+L000B:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jmp     L0021
+L000E:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0011:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jmp     L0021
+L0012:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jmp     L0021
+L0016:	lda     #<(S000B)
+	ldx     #>(S000B)
+L0021:	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ h (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_h: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$F5
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	jpl     L0003
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0016
+	cmp     #$08
+	beq     L000C
+	cmp     #$10
+	beq     L000B
+	cmp     #$78
+	beq     L000D
+	cmp     #$80
+	beq     L000A
+	cmp     #$F8
+	beq     L0010
+	jmp     L0009
+L0016:	cpx     #$01
+	bne     L0009
+	cmp     #$08
+	beq     L000F
+	cmp     #$10
+	beq     L0011
+	cmp     #$18
+	beq     L000E
+	cmp     #$20
+	beq     L0014
+	cmp     #$28
+	beq     L0013
+	cmp     #$30
+	beq     L0012
+	cmp     #$38
+	beq     L0015
+L0009:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0004
+L000A:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jmp     L001C
+L000B:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jmp     L001C
+L000C:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jmp     L001C
+L000D:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jmp     L001C
+L000E:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jmp     L001C
+L000F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jmp     L001C
+L0010:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jmp     L001C
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jmp     L001C
+L0012:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jmp     L001C
+L0013:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jmp     L001C
+L0014:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jmp     L001C
+L0015:	lda     #<(S0018)
+	ldx     #>(S0018)
+L001C:	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0003:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ limit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_limit: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$80
+	lda     #$00
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	cmp     #$06
+	txa
+	sbc     #$80
+	bvc     L0006
+	eor     #$80
+L0006:	bpl     L0003
+	jsr     ldax0sp
+	cpx     #$80
+	bne     L000E
+	cmp     #$00
+	beq     L0009
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L000C
+	cmp     #$04
+	beq     L000D
+	jmp     L000E
+L0009:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jmp     L0020
+L000A:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jmp     L0020
+L000B:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jmp     L0020
+L000C:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jmp     L0020
+L000D:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jmp     L0020
+L000E:	lda     #<(S0023)
+	ldx     #>(S0023)
+L0020:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0002
+L0003:	ldx     #$7F
+	lda     #$FF
+	jsr     stax0sp
+L000F:	jsr     ldax0sp
+	cmp     #$FA
+	txa
+	sbc     #$7F
+	bvs     L0013
+	eor     #$80
+L0013:	asl     a
+	lda     #$00
+	tax
+	rol     a
+	beq     L0010
+	jsr     ldax0sp
+	cpx     #$7F
+	bne     L001B
+	cmp     #$FB
+	beq     L001A
+	cmp     #$FC
+	beq     L0019
+	cmp     #$FD
+	beq     L0018
+	cmp     #$FE
+	beq     L0017
+	cmp     #$FF
+	bne     L001B
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jmp     L0021
+L0017:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jmp     L0021
+L0018:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jmp     L0021
+L0019:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jmp     L0021
+L001A:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jmp     L0021
+L001B:	lda     #<(S0029)
+	ldx     #>(S0029)
+L0021:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	jmp     L000F
+L0010:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ big (unsigned long x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_big: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #$06
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosandeax
+	ldy     sreg+1
+	cpy     #$00
+	bne     L000A
+	ldy     sreg
+	cpy     #$00
+	bne     L0009
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+	beq     L0004
+	jmp     L0009
+L000A:	cpy     #$02
+	bne     L000B
+	ldy     sreg
+	cpy     #$00
+	bne     L0009
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+	beq     L0007
+	jmp     L0009
+L000B:	cpy     #$04
+	bne     L000C
+	ldy     sreg
+	cpy     #$00
+	bne     L0009
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+	beq     L0008
+	jmp     L0009
+L000C:	cpy     #$FF
+	bne     L0009
+	ldy     sreg
+	cpy     #$FF
+	bne     L0009
+	cpx     #$FF
+	bne     L0009
+	cmp     #$FE
+	beq     L0004
+	cmp     #$FF
+	bne     L0009
+L0004:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jmp     L0012
+L0007:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jmp     L0012
+L0008:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jmp     L0012
+L0009:	lda     #<(S001D)
+	ldx     #>(S001D)
+L0012:	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	jsr     _f
+	jsr     _g
+	jsr     _h
+	jsr     _testbig
+	jsr     _limit
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,354 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_testlimits
+	.export		_testdefault1
+	.export		_testdefault2
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$3E,$3E,$3E,$64,$65,$66,$61,$75,$6C,$74,$0A,$00
+S0009	:=	S0007+0
+S0004:
+	.byte	$6D,$69,$6E,$0A,$00
+S0003:
+	.byte	$6D,$61,$78,$0A,$00
+S0006:
+	.byte	$3E,$25,$64,$0A,$00
+S0008	:=	S0006+0
+S0002:
+	.byte	$2D,$31,$0A,$00
+S0001:
+	.byte	$25,$64,$3A,$00
+S0005	:=	S0007+10
+
+; ---------------------------------------------------------------
+; void __near__ testlimits (int i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testlimits: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jsr     ldax0sp
+	cpx     #$7F
+	bne     L0007
+	cmp     #$FF
+	beq     L0005
+	bra     L0003
+L0007:	cpx     #$80
+	bne     L0008
+	cmp     #$00
+	beq     L0006
+	bra     L0003
+L0008:	cpx     #$FF
+	bne     L0003
+	cmp     #$FF
+	bne     L0003
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	bra     L000B
+L0005:	lda     #<(S0003)
+	ldx     #>(S0003)
+	bra     L000B
+L0006:	lda     #<(S0004)
+	ldx     #>(S0004)
+L000B:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0003:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault1 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault1: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$FE
+	jcs     L0003
+	sta     (c_sp)
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	lda     (c_sp)
+	cmp     #$01
+	beq     L0002
+	cmp     #$02
+	beq     L0002
+	cmp     #$03
+	beq     L0002
+	cmp     #$04
+	beq     L0002
+	cmp     #$05
+	beq     L0002
+	cmp     #$06
+	beq     L0002
+	cmp     #$07
+	beq     L0002
+	cmp     #$08
+	beq     L0002
+	cmp     #$09
+	beq     L0002
+	cmp     #$0A
+	beq     L0002
+	cmp     #$0B
+	beq     L0002
+	cmp     #$0C
+	beq     L0002
+	cmp     #$0D
+	beq     L0002
+	cmp     #$0E
+	beq     L0002
+	cmp     #$0F
+	beq     L0002
+	cmp     #$11
+	beq     L0002
+	cmp     #$12
+	beq     L0002
+	cmp     #$13
+	beq     L0002
+	cmp     #$14
+	beq     L0002
+	cmp     #$15
+	beq     L0002
+	cmp     #$16
+	beq     L0002
+	cmp     #$17
+	jeq     L0002
+	cmp     #$18
+	beq     L0031
+	cmp     #$64
+	jeq     L0002
+	bra     L002E
+L0031:	lda     (c_sp)
+	cmp     #$01
+	jeq     L0002
+	cmp     #$02
+	jeq     L0002
+	cmp     #$03
+	jeq     L0002
+	cmp     #$04
+	jeq     L0002
+	cmp     #$05
+	jeq     L0002
+	cmp     #$06
+	jeq     L0002
+	cmp     #$07
+	jeq     L0002
+	cmp     #$08
+	jeq     L0002
+	cmp     #$09
+	jne     L0002
+	jmp     L0002
+L002E:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault2 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault2: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$FE
+	jcs     L0003
+	sta     (c_sp)
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (c_sp),y
+	sta     (c_sp),y
+	lda     (c_sp)
+	cmp     #$01
+	beq     L0002
+	cmp     #$02
+	beq     L0002
+	cmp     #$03
+	beq     L0002
+	cmp     #$04
+	beq     L0002
+	cmp     #$05
+	beq     L0002
+	cmp     #$06
+	beq     L0002
+	cmp     #$07
+	beq     L0002
+	cmp     #$08
+	beq     L0002
+	cmp     #$09
+	beq     L0002
+	cmp     #$0A
+	beq     L0002
+	cmp     #$0B
+	beq     L0002
+	cmp     #$0C
+	beq     L0002
+	cmp     #$0D
+	beq     L0002
+	cmp     #$0E
+	beq     L0002
+	cmp     #$0F
+	beq     L0002
+	cmp     #$11
+	beq     L0002
+	cmp     #$12
+	beq     L0002
+	cmp     #$13
+	beq     L0002
+	cmp     #$14
+	beq     L0002
+	cmp     #$15
+	beq     L0002
+	cmp     #$16
+	beq     L0002
+	cmp     #$17
+	jeq     L0002
+	cmp     #$18
+	beq     L0030
+	cmp     #$64
+	jeq     L0002
+	cmp     #$AA
+	jeq     L0002
+	bra     L002C
+L0030:	lda     (c_sp)
+	cmp     #$01
+	jeq     L0002
+	cmp     #$02
+	jeq     L0002
+	cmp     #$03
+	jeq     L0002
+	cmp     #$04
+	jeq     L0002
+	cmp     #$05
+	jeq     L0002
+	cmp     #$06
+	jeq     L0002
+	cmp     #$07
+	jeq     L0002
+	cmp     #$08
+	jeq     L0002
+	cmp     #$09
+	jne     L0002
+	jmp     L0002
+L002C:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0003:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     _testlimits
+	ldx     #$80
+	lda     #$00
+	jsr     _testlimits
+	ldx     #$FF
+	txa
+	jsr     _testlimits
+	lda     #$01
+	jsr     _testdefault1
+	lda     #$02
+	jsr     _testdefault1
+	lda     #$03
+	jsr     _testdefault1
+	lda     #$04
+	jsr     _testdefault1
+	lda     #$01
+	jsr     _testdefault2
+	lda     #$02
+	jsr     _testdefault2
+	lda     #$03
+	jsr     _testdefault2
+	lda     #$04
+	jsr     _testdefault2
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
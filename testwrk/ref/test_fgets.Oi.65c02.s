@@ -0,0 +1,260 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_printf
+	.import		_sprintf
+	.import		_ungetc
+	.import		_unlink
+	.export		_in
+	.export		_out
+	.export		_buf
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$66,$69,$6C,$65,$20,$70,$6F,$69,$6E
+	.byte	$74,$65,$72,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$69,$6E
+	.byte	$20,$65,$72,$72,$6F,$72,$20,$73,$74,$61,$74,$65,$0A,$00
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$2C,$20,$63,$6F,$75,$6C,$64,$20,$66,$67,$65
+	.byte	$74,$73,$20,$77,$69,$74,$68,$20,$77,$72,$69,$74,$65,$2D,$6F,$6E
+	.byte	$6C,$79,$20,$66,$69,$6C,$65,$0A,$00
+S0007:
+	.byte	$45,$72,$72,$6F,$72,$2C,$20,$63,$6F,$75,$6C,$64,$20,$66,$67,$65
+	.byte	$74,$73,$20,$77,$69,$74,$68,$20,$7A,$65,$72,$6F,$20,$73,$69,$7A
+	.byte	$65,$0A,$00
+S0009:
+	.byte	$57,$65,$20,$73,$68,$6F,$75,$6C,$64,$20,$68,$61,$76,$65,$20,$45
+	.byte	$4F,$46,$21,$0A,$00
+S0001:
+	.byte	$25,$73,$2E,$74,$65,$73,$74,$2E,$6F,$75,$74,$00
+S0005:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0008:
+	.byte	$25,$73,$00
+S0002:
+	.byte	$77,$62,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_out:
+	.res	2,$00
+_buf:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(M0001)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(M0001)
+	sta     (c_sp),y
+	lda     #<(S0001)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0001)
+	sta     (c_sp),y
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _out
+	stx     _out+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ina
+	rts
+L0002:	jsr     decsp4
+	lda     #<(_buf)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_buf)
+	sta     (c_sp),y
+	lda     #$20
+	sta     (c_sp)
+	ldy     #$01
+	lda     #$00
+	sta     (c_sp),y
+	lda     _out
+	ldx     _out+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0004
+L0010:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0004:	lda     _out
+	ldx     _out+1
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0006:	lda     _out
+	ldx     _out+1
+	jsr     _fclose
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     _unlink
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	bne     L0007
+	ina
+	rts
+L0007:	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+	beq     L0009
+L0011:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0009:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	sta     _buf
+	lda     _buf
+	jsr     pusha0
+	lda     _in
+	ldx     _in+1
+	jsr     _ungetc
+	bra     L000D
+L000B:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L000D:	jsr     decsp4
+	lda     #<(_buf)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_buf)
+	sta     (c_sp),y
+	lda     #$20
+	sta     (c_sp)
+	ldy     #$01
+	lda     #$00
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+	bne     L000B
+	lda     _in
+	ldx     _in+1
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000F:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	1026,$00
+
+.endproc
+
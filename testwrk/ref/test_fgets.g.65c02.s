@@ -0,0 +1,285 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "test_fgets.c", 1242, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_printf
+	.import		_sprintf
+	.import		_ungetc
+	.import		_unlink
+	.export		_in
+	.export		_out
+	.export		_buf
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$66,$69,$6C,$65,$20,$70,$6F,$69,$6E
+	.byte	$74,$65,$72,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$69,$6E
+	.byte	$20,$65,$72,$72,$6F,$72,$20,$73,$74,$61,$74,$65,$0A,$00
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$2C,$20,$63,$6F,$75,$6C,$64,$20,$66,$67,$65
+	.byte	$74,$73,$20,$77,$69,$74,$68,$20,$77,$72,$69,$74,$65,$2D,$6F,$6E
+	.byte	$6C,$79,$20,$66,$69,$6C,$65,$0A,$00
+S0007:
+	.byte	$45,$72,$72,$6F,$72,$2C,$20,$63,$6F,$75,$6C,$64,$20,$66,$67,$65
+	.byte	$74,$73,$20,$77,$69,$74,$68,$20,$7A,$65,$72,$6F,$20,$73,$69,$7A
+	.byte	$65,$0A,$00
+S0009:
+	.byte	$57,$65,$20,$73,$68,$6F,$75,$6C,$64,$20,$68,$61,$76,$65,$20,$45
+	.byte	$4F,$46,$21,$0A,$00
+S0001:
+	.byte	$25,$73,$2E,$74,$65,$73,$74,$2E,$6F,$75,$74,$00
+S0005:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0008:
+	.byte	$25,$73,$00
+S0002:
+	.byte	$77,$62,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_out:
+	.res	2,$00
+_buf:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "test_fgets.c", 24
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "test_fgets.c", 26
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _out
+	stx     _out+1
+	.dbg	line, "test_fgets.c", 27
+	lda     _out
+	ldx     _out+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "test_fgets.c", 28
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fgets.c", 30
+L0002:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _out
+	ldx     _out+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "test_fgets.c", 31
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fgets.c", 32
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fgets.c", 34
+L0004:	lda     _out
+	ldx     _out+1
+	jsr     _ferror
+	jsr     bnegax
+	jeq     L0006
+	.dbg	line, "test_fgets.c", 35
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fgets.c", 37
+L0006:	lda     _out
+	ldx     _out+1
+	jsr     _fclose
+	.dbg	line, "test_fgets.c", 38
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     _unlink
+	.dbg	line, "test_fgets.c", 40
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	.dbg	line, "test_fgets.c", 41
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "test_fgets.c", 42
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fgets.c", 45
+L0007:	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "test_fgets.c", 46
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fgets.c", 47
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fgets.c", 51
+L0009:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldx     #$00
+	sta     _buf
+	.dbg	line, "test_fgets.c", 52
+	ldx     #$00
+	lda     _buf
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _ungetc
+	.dbg	line, "test_fgets.c", 55
+	jmp     L000D
+	.dbg	line, "test_fgets.c", 57
+L000B:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "test_fgets.c", 55
+L000D:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jne     L000B
+	.dbg	line, "test_fgets.c", 60
+	lda     _in
+	ldx     _in+1
+	jsr     _feof
+	jsr     bnegax
+	jeq     L000F
+	.dbg	line, "test_fgets.c", 62
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fgets.c", 65
+L000F:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	.dbg	line, "test_fgets.c", 66
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "test_fgets.c", 67
+L0001:	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1026,$00
+
+.endproc
+
@@ -0,0 +1,154 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "test_fputc.c", 631, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.import		_clearerr
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fputc
+	.import		_printf
+	.export		_in
+	.export		_out
+	.export		_c
+	.export		_err
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$61,$6E,$20,$66,$70,$75,$74,$63
+	.byte	$20,$74,$6F,$20,$61,$20,$66,$69,$6C,$65,$20,$6F,$70,$65,$6E,$65
+	.byte	$64,$20,$66,$6F,$72,$20,$72,$65,$61,$64,$69,$6E,$67,$0A,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0002:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_out:
+	.res	2,$00
+_c:
+	.res	2,$00
+_err:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "test_fputc.c", 22
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	.dbg	line, "test_fputc.c", 23
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "test_fputc.c", 24
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fputc.c", 27
+L0002:	lda     _c
+	ldx     _c+1
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fputc
+	cpx     #$FF
+	bne     L0005
+	cmp     #$FF
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "test_fputc.c", 28
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fputc.c", 29
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fputc.c", 31
+L0004:	lda     _in
+	ldx     _in+1
+	jsr     _clearerr
+	.dbg	line, "test_fputc.c", 33
+	jmp     L0008
+	.dbg	line, "test_fputc.c", 34
+L0006:	lda     _c
+	ldx     _c+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fputc
+	.dbg	line, "test_fputc.c", 33
+L0008:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	sta     _c
+	stx     _c+1
+	cpx     #$FF
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     boolne
+	jne     L0006
+	.dbg	line, "test_fputc.c", 37
+	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	.dbg	line, "test_fputc.c", 38
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "test_fputc.c", 39
+L0001:	rts
+
+	.dbg	line
+.endproc
+
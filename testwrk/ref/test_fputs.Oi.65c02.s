@@ -0,0 +1,139 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdout
+	.import		_clearerr
+	.import		_fclose
+	.import		_fgets
+	.import		_fopen
+	.import		_fputs
+	.import		_printf
+	.import		_strcpy
+	.export		_in
+	.export		_out
+	.export		_buf
+	.export		_err
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$61,$6E,$20,$66,$70,$75,$74,$73
+	.byte	$20,$74,$6F,$20,$61,$20,$66,$69,$6C,$65,$20,$6F,$70,$65,$6E,$65
+	.byte	$64,$20,$66,$6F,$72,$20,$72,$65,$61,$64,$69,$6E,$67,$0A,$00
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0003:
+	.byte	$74,$65,$73,$74,$00
+S0002:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_out:
+	.res	2,$00
+_buf:
+	.res	512,$00
+_err:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ina
+	rts
+L0002:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _strcpy
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _fputs
+	cpx     #$FF
+	bne     L000A
+	cmp     #$FF
+	beq     L0004
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0004:	lda     _in
+	ldx     _in+1
+	jsr     _clearerr
+	bra     L0008
+L0006:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fputs
+L0008:	jsr     decsp4
+	lda     #<(_buf)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_buf)
+	sta     (c_sp),y
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	lda     #$02
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fgets
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+	bne     L0006
+	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
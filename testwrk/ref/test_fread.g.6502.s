@@ -0,0 +1,325 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "test_fread.c", 1407, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.dbg		file, "/root/repo/include/errno.h", 5854, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/unistd.h", 4340, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fgetc
+	.import		_fopen
+	.import		_fread
+	.import		_fwrite
+	.import		_printf
+	.import		_sprintf
+	.import		_ungetc
+	.import		_unlink
+	.export		_in
+	.export		_out
+	.export		_buf
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$66,$69,$6C,$65,$20,$70,$6F,$69,$6E
+	.byte	$74,$65,$72,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$69,$6E
+	.byte	$20,$65,$72,$72,$6F,$72,$20,$73,$74,$61,$74,$65,$0A,$00
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$2C,$20,$63,$6F,$75,$6C,$64,$20,$66,$72,$65
+	.byte	$61,$64,$20,$77,$69,$74,$68,$20,$77,$72,$69,$74,$65,$2D,$6F,$6E
+	.byte	$6C,$79,$20,$66,$69,$6C,$65,$0A,$00
+S0007:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$73,$74,$61,$72,$74,$20,$72,$65,$61,$64,$69,$6E,$67,$2E,$0A
+	.byte	$00
+S0008:
+	.byte	$57,$65,$20,$73,$68,$6F,$75,$6C,$64,$20,$68,$61,$76,$65,$20,$45
+	.byte	$4F,$46,$21,$0A,$00
+S0001:
+	.byte	$25,$73,$2E,$74,$65,$73,$74,$2E,$6F,$75,$74,$00
+S0005:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0002:
+	.byte	$77,$62,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_out:
+	.res	2,$00
+_buf:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "test_fread.c", 25
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "test_fread.c", 27
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _out
+	stx     _out+1
+	.dbg	line, "test_fread.c", 28
+	lda     _out
+	ldx     _out+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "test_fread.c", 29
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fread.c", 31
+L0002:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _out
+	ldx     _out+1
+	jsr     _fread
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "test_fread.c", 32
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fread.c", 33
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fread.c", 35
+L0004:	lda     _out
+	ldx     _out+1
+	jsr     _ferror
+	jsr     bnegax
+	jeq     L0006
+	.dbg	line, "test_fread.c", 36
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fread.c", 38
+L0006:	lda     _out
+	ldx     _out+1
+	jsr     _fclose
+	.dbg	line, "test_fread.c", 39
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     _unlink
+	.dbg	line, "test_fread.c", 41
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	.dbg	line, "test_fread.c", 42
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "test_fread.c", 43
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fread.c", 47
+L0007:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldx     #$00
+	sta     _buf
+	.dbg	line, "test_fread.c", 48
+	ldx     #$00
+	lda     _buf
+	jsr     pushax
+	lda     _in
+	ldx     _in+1
+	jsr     _ungetc
+	.dbg	line, "test_fread.c", 50
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _out
+	ldx     _out+1
+	jsr     _fread
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "test_fread.c", 52
+	lda     M0002
+	ldx     M0002+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	.dbg	line, "test_fread.c", 53
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fread.c", 54
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fread.c", 56
+L0009:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	.dbg	line, "test_fread.c", 59
+	jmp     L000D
+	.dbg	line, "test_fread.c", 61
+L000B:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	.dbg	line, "test_fread.c", 59
+L000D:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	lda     _out
+	ldx     _out+1
+	jsr     _fread
+	sta     M0002
+	stx     M0002+1
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jne     L000B
+	.dbg	line, "test_fread.c", 64
+	lda     _in
+	ldx     _in+1
+	jsr     _feof
+	jsr     bnegax
+	jeq     L000F
+	.dbg	line, "test_fread.c", 66
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "test_fread.c", 67
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "test_fread.c", 70
+L000F:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	.dbg	line, "test_fread.c", 71
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "test_fread.c", 72
+L0001:	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1026,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,367 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdout
+	.import		_fclose
+	.import		_fopen
+	.import		_fread
+	.import		_fwrite
+	.import		_fseek
+	.import		_printf
+	.import		_memcmp
+	.export		_in
+	.export		_bufA
+	.export		_bufB
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$2D,$72,$65,$61,$64,$20,$61,$66,$74,$65,$72,$20,$53
+	.byte	$45,$45,$4B,$5F,$53,$45,$54,$2E,$0A,$00
+S0006:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$2D,$72,$65,$61,$64,$20,$61,$66,$74,$65,$72,$20,$53
+	.byte	$45,$45,$4B,$5F,$43,$55,$52,$2E,$0A,$00
+S0003:
+	.byte	$45,$72,$72,$6F,$72,$3A,$20,$63,$6F,$75,$6C,$64,$20,$6E,$6F,$74
+	.byte	$20,$72,$65,$61,$64,$2E,$0A,$00
+S0005:
+	.byte	$72,$65,$61,$64,$73,$20,$64,$69,$66,$66,$65,$72,$2E,$0A,$00
+S0007	:=	S0005+0
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0002:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_bufA:
+	.res	32,$00
+_bufB:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	jsr     decsp6
+	lda     #<(_bufA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufA)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$20
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+	bne     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0004:	jsr     decsp6
+	lda     #<(_bufA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufA)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     M0001
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     M0001+1
+	sta     (c_sp),y
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	jsr     decsp6
+	lda     _in
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     _in+1
+	sta     (c_sp),y
+	lda     #$00
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	lda     #$02
+	jsr     _fseek
+	jsr     decsp6
+	lda     #<(_bufB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufB)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$20
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+	bne     L0006
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0006:	jsr     decsp6
+	lda     #<(_bufB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufB)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     M0001
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     M0001+1
+	sta     (c_sp),y
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	lda     #<(_bufA)
+	ldx     #>(_bufA)
+	jsr     pushax
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     _memcmp
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0008:	jsr     decsp6
+	lda     _in
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     _in+1
+	sta     (c_sp),y
+	lda     #$00
+	tay
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	lda     #$02
+	jsr     _fseek
+	jsr     decsp6
+	lda     _in
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     _in+1
+	sta     (c_sp),y
+	ldy     #$00
+	lda     #$01
+	sta     (c_sp),y
+	tya
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	tax
+	jsr     _fseek
+	jsr     decsp6
+	lda     #<(_bufB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufB)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #$20
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     _in
+	ldx     _in+1
+	jsr     _fread
+	sta     M0001
+	stx     M0001+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+	bne     L0009
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0009:	jsr     decsp6
+	lda     #<(_bufB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(_bufB)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     M0001
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     M0001+1
+	sta     (c_sp),y
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fwrite
+	lda     #<(_bufA+1)
+	ldx     #>(_bufA+1)
+	jsr     pushax
+	lda     #<(_bufB)
+	ldx     #>(_bufB)
+	jsr     pushax
+	ldx     #$00
+	lda     #$1F
+	jsr     _memcmp
+	stx     tmp1
+	ora     tmp1
+	beq     L000B
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L000B:	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
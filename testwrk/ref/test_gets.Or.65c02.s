@@ -0,0 +1,86 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdin
+	.import		_fclose
+	.import		_freopen
+	.import		_gets
+	.import		_printf
+	.export		_buf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$63,$66,$2E,$69,$6E,$00
+S0003:
+	.byte	$25,$73,$00
+S0002:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_buf:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _stdin
+	ldx     _stdin+1
+	jsr     _freopen
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+	bne     L0006
+	ina
+	rts
+L0004:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0006:	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _gets
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+	bne     L0004
+	lda     _stdin
+	ldx     _stdin+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
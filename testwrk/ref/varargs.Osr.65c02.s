@@ -0,0 +1,303 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.import		_vsprintf
+	.export		_chk0
+	.export		_chk1
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$66,$64,$3A,$25,$64,$2C,$66,$6F,$72,$6D,$61,$74,$3A,$25,$73,$2C
+	.byte	$73,$74,$72,$69,$6E,$67,$3A,$25,$73,$0A,$00
+S0001	:=	S0002+6
+S0018:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$20,$25,$73,$20,$25,$73,$00
+S000C:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$20,$25,$73,$20,$25,$73,$00
+S0003:
+	.byte	$76,$61,$72,$61,$72,$67,$73,$20,$74,$65,$73,$74,$0A,$00
+S0008:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$20,$25,$73,$00
+S0014:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$20,$25,$73,$00
+S0017:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$32,$3A,$0A,$00
+S0007:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$31,$3A,$0A,$00
+S000B:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$32,$3A,$0A,$00
+S0013:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$31,$3A,$0A,$00
+S0010:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$30,$3A,$0A,$00
+S0004:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$30,$3A,$0A,$00
+S0011:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$00
+S0005:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$00
+S000F:
+	.byte	$61,$72,$67,$32,$00
+S0012:
+	.byte	$61,$72,$67,$30,$00
+S000D	:=	S0012+0
+S000A:
+	.byte	$61,$72,$67,$31,$00
+S0015	:=	S0012+0
+S0016	:=	S000A+0
+S0009	:=	S0012+0
+S000E	:=	S000A+0
+S0019	:=	S0012+0
+S001A	:=	S000A+0
+S001B	:=	S000F+0
+S0006	:=	S0012+0
+
+; ---------------------------------------------------------------
+; void __near__ chk0 (char *format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_chk0: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0002
+	inx
+L0002:	jsr     stax0sp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	jsr     pushw
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$02
+	jmp     leavey
+
+.segment	"BSS"
+
+M0001:
+	.res	256,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ chk1 (int fd, char *format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_chk1: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     decax1
+	jsr     stax0sp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0002
+	inx
+L0002:	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	jsr     pushw
+	ldy     #$06
+	lda     (c_sp),y
+	jsr     leaa0sp
+	jsr     incax3
+	jsr     pushw
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldy     #$02
+	jmp     leavey
+
+.segment	"BSS"
+
+M0001:
+	.res	256,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$04
+	jsr     _chk0
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+	jsr     _chk0
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$08
+	jsr     _chk0
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$FD
+	jsr     pusha0
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$06
+	jsr     _chk1
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$FD
+	jsr     pusha0
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$08
+	jsr     _chk1
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$FD
+	jsr     pusha0
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _chk1
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,365 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "varargs.c", 2275, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1779181050
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.import		_vsprintf
+	.export		_chk0
+	.export		_chk1
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$66,$64,$3A,$25,$64,$2C,$66,$6F,$72,$6D,$61,$74,$3A,$25,$73,$2C
+	.byte	$73,$74,$72,$69,$6E,$67,$3A,$25,$73,$0A,$00
+S0001	:=	S0002+6
+S0018:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$20,$25,$73,$20,$25,$73,$00
+S000C:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$20,$25,$73,$20,$25,$73,$00
+S0003:
+	.byte	$76,$61,$72,$61,$72,$67,$73,$20,$74,$65,$73,$74,$0A,$00
+S0008:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$20,$25,$73,$00
+S0014:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$20,$25,$73,$00
+S0017:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$32,$3A,$0A,$00
+S0007:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$31,$3A,$0A,$00
+S000B:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$32,$3A,$0A,$00
+S0013:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$31,$3A,$0A,$00
+S0010:
+	.byte	$0A,$63,$68,$6B,$31,$2F,$30,$3A,$0A,$00
+S0004:
+	.byte	$0A,$63,$68,$6B,$30,$2F,$30,$3A,$0A,$00
+S0011:
+	.byte	$63,$68,$6B,$31,$20,$25,$73,$00
+S0005:
+	.byte	$63,$68,$6B,$30,$20,$25,$73,$00
+S000F:
+	.byte	$61,$72,$67,$32,$00
+S0012:
+	.byte	$61,$72,$67,$30,$00
+S000D	:=	S0012+0
+S000A:
+	.byte	$61,$72,$67,$31,$00
+S0015	:=	S0012+0
+S0016	:=	S000A+0
+S0009	:=	S0012+0
+S000E	:=	S000A+0
+S0019	:=	S0012+0
+S001A	:=	S000A+0
+S001B	:=	S000F+0
+S0006	:=	S0012+0
+
+; ---------------------------------------------------------------
+; void __near__ chk0 (char *format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_chk0: near
+
+	.dbg	func, "chk0", "00", static, "_chk0"
+	.dbg	sym, "format", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "ap", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "varargs.c", 73
+	jsr     enter
+	.dbg	line, "varargs.c", 76
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "varargs.c", 77
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	.dbg	line, "varargs.c", 78
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "varargs.c", 80
+	ldy     #$02
+	jsr     leavey
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	256,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ chk1 (int fd, char *format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_chk1: near
+
+	.dbg	func, "chk1", "00", static, "_chk1"
+	.dbg	sym, "fd", "00", auto, 3
+	.dbg	sym, "format", "00", auto, 1
+	.dbg	sym, "__argsize__", "00", auto, 0
+	.dbg	sym, "ap", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "varargs.c", 82
+	jsr     enter
+	.dbg	line, "varargs.c", 86
+	jsr     decsp2
+	ldy     #$02
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     decax1
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "varargs.c", 88
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax1
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	.dbg	line, "varargs.c", 89
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	lda     (c_sp),y
+	ldx     #$00
+	jsr     leaaxsp
+	jsr     incax3
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "varargs.c", 91
+	ldy     #$02
+	jsr     leavey
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	256,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "varargs.c", 94
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "varargs.c", 96
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$04
+	jsr     _chk0
+	.dbg	line, "varargs.c", 97
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+	jsr     _chk0
+	.dbg	line, "varargs.c", 98
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$08
+	jsr     _chk0
+	.dbg	line, "varargs.c", 100
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$FD
+	jsr     pushax
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$06
+	jsr     _chk1
+	.dbg	line, "varargs.c", 101
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$FD
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$08
+	jsr     _chk1
+	.dbg	line, "varargs.c", 102
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$FD
+	jsr     pushax
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _chk1
+	.dbg	line, "varargs.c", 104
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "varargs.c", 105
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,599 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_malloc
+	.import		_exit
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_strcmp
+	.import		_strcpy
+	.import		_strlen
+	.export		_in
+	.export		_words
+	.export		_next
+	.export		_err
+	.export		_getword
+	.export		_tprint
+	.export		_lookup
+	.export		_isletter
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$6E,$6F,$64,$65,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0003:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$77,$6F,$72,$64,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0004:
+	.byte	$25,$64,$3A,$25,$73,$0A,$00
+S0005:
+	.byte	$77,$66,$31,$2E,$69,$6E,$00
+S0001:
+	.byte	$3F,$20,$25,$73,$0A,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_words:
+	.res	2000,$00
+_next:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ err (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_err: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getword (buf) char *buf;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getword: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+L0002:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L0011
+	cmp     #$FF
+	beq     L000F
+L0011:	lda     (c_sp)
+	jsr     _isletter
+	cpx     #$00
+	bne     L000F
+	cmp     #$00
+	beq     L0002
+L000F:	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$02
+L0010:	jsr     staxysp
+	lda     (c_sp)
+	jsr     _isletter
+	jsr     stax0sp
+	stx     tmp1
+	ora     tmp1
+	beq     L000B
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (c_sp)
+	sta     (ptr1)
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$00
+	bra     L0010
+L000B:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     #$00
+	sta     (ptr1)
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (c_sp),y
+	ora     tmp1
+	bcc     L000E
+	beq     L000E
+	ldx     #$00
+	lda     #$01
+	jmp     incsp6
+L000E:	ldx     #$00
+	txa
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ tprint (tree) struct node *tree;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tprint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	ora     (c_sp)
+	beq     L0002
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _tprint
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _tprint
+L0002:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; struct node *__near__ lookup (word, p) char *word; struct node **p;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lookup: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	dey
+	ora     (ptr1),y
+	jeq     L0009
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _strcmp
+	jsr     stax0sp
+	cpx     #$80
+	bcc     L0003
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	clc
+	adc     #$02
+	bcc     L0004
+	inx
+L0004:	jsr     _lookup
+	jmp     incsp6
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0007
+	eor     #$80
+L0007:	bpl     L0006
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	clc
+	adc     #$04
+	bcc     L0008
+	inx
+L0008:	jsr     _lookup
+	jmp     incsp6
+L0006:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jmp     incsp6
+L0009:	lda     _next
+	cmp     #$FA
+	lda     _next+1
+	sbc     #$00
+	bvs     L000B
+	eor     #$80
+L000B:	bpl     L000A
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _err
+L000A:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	sta     ptr1
+	txa
+	adc     #>(_words)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	ldy     #$01
+	sta     (ptr1),y
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxspidx
+	ldy     #$02
+	jsr     staxspidx
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _strlen
+	ina
+	bne     L000C
+	inx
+L000C:	jsr     _malloc
+	ldy     #$06
+	jsr     staxspidx
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	sta     ptr1
+	txa
+	adc     #>(_words)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+	bne     L000D
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _err
+L000D:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	sta     ptr1
+	txa
+	adc     #>(_words)
+	sta     ptr1+1
+	ldy     #$07
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _strcpy
+	ldy     #$05
+	jsr     pushwysp
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	sta     regsave
+	stx     regsave+1
+	inc     _next
+	bne     L000F
+	inc     _next+1
+L000F:	lda     regsave
+	ldx     regsave+1
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ isletter (char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_isletter: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     (c_sp)
+	cmp     #$41
+	bcc     L000E
+	cmp     #$5B
+	bcs     L000E
+	lda     #$20
+	adc     (c_sp)
+	sta     (c_sp)
+L000E:	lda     (c_sp)
+	cmp     #$61
+	lda     #$00
+	tax
+	bcc     L0001
+	lda     (c_sp)
+	cmp     #$7B
+	bcc     L0011
+	txa
+	jmp     incsp1
+L0011:	lda     (c_sp)
+L0001:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$16
+	jsr     subysp
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ina
+	rts
+L0002:	ldy     #$14
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	stz     _next
+	stz     _next+1
+	bra     L0006
+L0004:	lda     c_sp
+	ldx     c_sp+1
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$16
+	bcc     L0007
+	inx
+L0007:	jsr     _lookup
+	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ina
+	bne     L0009
+	inx
+L0009:	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+L0006:	lda     c_sp
+	ldx     c_sp+1
+	jsr     _getword
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	ldy     #$15
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _tprint
+	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
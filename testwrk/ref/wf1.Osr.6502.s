@@ -0,0 +1,491 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_malloc
+	.import		_exit
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_strcmp
+	.import		_strcpy
+	.import		_strlen
+	.export		_in
+	.export		_words
+	.export		_next
+	.export		_err
+	.export		_getword
+	.export		_tprint
+	.export		_lookup
+	.export		_isletter
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$6E,$6F,$64,$65,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0003:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$77,$6F,$72,$64,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0004:
+	.byte	$25,$64,$3A,$25,$73,$0A,$00
+S0005:
+	.byte	$77,$66,$31,$2E,$69,$6E,$00
+S0001:
+	.byte	$3F,$20,$25,$73,$0A,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_words:
+	.res	2000,$00
+_next:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ err (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_err: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getword (buf) char *buf;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getword: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+L0002:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L0011
+	cmp     #$FF
+	beq     L000F
+L0011:	ldy     #$00
+	lda     (c_sp),y
+	jsr     _isletter
+	cpx     #$00
+	bne     L000F
+	cmp     #$00
+	beq     L0002
+L000F:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+L0010:	jsr     staxysp
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _isletter
+	jsr     stax0sp
+	stx     tmp1
+	ora     tmp1
+	beq     L000B
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldy     #$00
+	lda     (c_sp),y
+	sta     (ptr1),y
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$00
+	jmp     L0010
+L000B:	ldy     #$03
+	jsr     ldptr1ysp
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sec
+	ldy     #$04
+	sbc     (c_sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (c_sp),y
+	ora     tmp1
+	bcc     L000E
+	beq     L000E
+	ldx     #$00
+	lda     #$01
+	jmp     incsp6
+L000E:	ldx     #$00
+	txa
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ tprint (tree) struct node *tree;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tprint: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _tprint
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$06
+	jsr     _printf
+	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     _tprint
+L0002:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; struct node *__near__ lookup (word, p) char *word; struct node **p;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lookup: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0007
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     _strcmp
+	jsr     stax0sp
+	cpx     #$80
+	bcc     L0003
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     incax2
+	jsr     _lookup
+	jmp     incsp6
+L0003:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0006
+	eor     #$80
+L0006:	bpl     L0005
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     incax4
+	jsr     _lookup
+	jmp     incsp6
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jmp     incsp6
+L0007:	lda     _next
+	cmp     #$FA
+	lda     _next+1
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	bpl     L0008
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _err
+L0008:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	sta     ptr1
+	txa
+	adc     #>(_words)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxspidx
+	ldy     #$02
+	jsr     staxspidx
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     incax1
+	jsr     _malloc
+	ldy     #$06
+	jsr     staxspidx
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+	bne     L000A
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _err
+L000A:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strcpy
+	ldy     #$05
+	jsr     pushwysp
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	sta     regsave
+	stx     regsave+1
+	inc     _next
+	bne     L000C
+	inc     _next+1
+L000C:	lda     regsave
+	ldx     regsave+1
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ isletter (char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_isletter: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (c_sp),y
+	cmp     #$41
+	bcc     L000E
+	cmp     #$5B
+	bcs     L000E
+	lda     #$20
+	adc     (c_sp),y
+	sta     (c_sp),y
+L000E:	lda     (c_sp),y
+	cmp     #$61
+	tya
+	tax
+	bcc     L0001
+	lda     (c_sp),y
+	cmp     #$7B
+	bcc     L0011
+	txa
+	jmp     incsp1
+L0011:	lda     (c_sp),y
+L0001:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$16
+	jsr     subysp
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0007
+	lda     #$01
+	rts
+L0002:	ldx     #$00
+L0007:	txa
+	ldy     #$14
+	jsr     staxysp
+	sta     _next
+	sta     _next+1
+	jmp     L0006
+L0004:	lda     c_sp
+	ldx     c_sp+1
+	jsr     pushax
+	lda     #$16
+	jsr     leaa0sp
+	jsr     _lookup
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0006:	lda     c_sp
+	ldx     c_sp+1
+	jsr     _getword
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     _tprint
+	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
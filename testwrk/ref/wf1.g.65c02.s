@@ -0,0 +1,683 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "wf1.c", 2937, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.forceimport	__STARTUP__
+	.import		_malloc
+	.import		_exit
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_printf
+	.import		_strcmp
+	.import		_strcpy
+	.import		_strlen
+	.export		_in
+	.export		_words
+	.export		_next
+	.export		_err
+	.export		_getword
+	.export		_tprint
+	.export		_lookup
+	.export		_isletter
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$6E,$6F,$64,$65,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0003:
+	.byte	$6F,$75,$74,$20,$6F,$66,$20,$77,$6F,$72,$64,$20,$73,$74,$6F,$72
+	.byte	$61,$67,$65,$00
+S0004:
+	.byte	$25,$64,$3A,$25,$73,$0A,$00
+S0005:
+	.byte	$77,$66,$31,$2E,$69,$6E,$00
+S0001:
+	.byte	$3F,$20,$25,$73,$0A,$00
+S0006:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_in:
+	.res	2,$00
+_words:
+	.res	2000,$00
+_next:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ err (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_err: near
+
+	.dbg	func, "err", "00", static, "_err"
+	.dbg	sym, "s", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 36
+	jsr     pushax
+	.dbg	line, "wf1.c", 37
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "wf1.c", 38
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "wf1.c", 39
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getword (buf) char *buf;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getword: near
+
+	.dbg	func, "getword", "00", static, "_getword"
+	.dbg	sym, "buf", "00", auto, 0
+	.dbg	sym, "s", "00", auto, -2
+	.dbg	sym, "c", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 43
+	jsr     pushax
+	.dbg	line, "wf1.c", 47
+	jsr     decsp4
+	jmp     L0002
+L0002:	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	cpx     #$FF
+	bne     L0005
+	cmp     #$FF
+L0005:	jsr     boolne
+	jeq     L0006
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isletter
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     booleq
+	jne     L0008
+L0006:	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0008:	ldx     #$00
+	lda     #$01
+L0009:	jne     L0002
+	.dbg	line, "wf1.c", 49
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+L000A:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     _isletter
+	ldy     #$00
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	jne     L000D
+	jmp     L000B
+	.dbg	line, "wf1.c", 50
+L000D:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "wf1.c", 49
+	lda     _in
+	ldx     _in+1
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	jmp     L000A
+	.dbg	line, "wf1.c", 51
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "wf1.c", 52
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosugtax
+	jeq     L000E
+	.dbg	line, "wf1.c", 53
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "wf1.c", 54
+L000E:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "wf1.c", 55
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ tprint (tree) struct node *tree;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tprint: near
+
+	.dbg	func, "tprint", "00", static, "_tprint"
+	.dbg	sym, "tree", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 93
+	jsr     pushax
+	.dbg	line, "wf1.c", 94
+	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	jeq     L0002
+	.dbg	line, "wf1.c", 95
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _tprint
+	.dbg	line, "wf1.c", 96
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "wf1.c", 97
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     _tprint
+	.dbg	line, "wf1.c", 99
+L0002:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; struct node *__near__ lookup (word, p) char *word; struct node **p;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lookup: near
+
+	.dbg	func, "lookup", "00", static, "_lookup"
+	.dbg	sym, "word", "00", auto, 2
+	.dbg	sym, "p", "00", auto, 0
+	.dbg	sym, "cond", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 68
+	jsr     pushax
+	.dbg	line, "wf1.c", 72
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0007
+	.dbg	line, "wf1.c", 73
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     _strcmp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "wf1.c", 74
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "wf1.c", 75
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax2
+	jsr     _lookup
+	jmp     L0001
+	.dbg	line, "wf1.c", 76
+	jmp     L0007
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "wf1.c", 77
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax4
+	jsr     _lookup
+	jmp     L0001
+	.dbg	line, "wf1.c", 78
+	jmp     L0007
+	.dbg	line, "wf1.c", 79
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jmp     L0001
+	.dbg	line, "wf1.c", 81
+L0007:	lda     _next
+	ldx     _next+1
+	cmp     #$FA
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "wf1.c", 82
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _err
+	.dbg	line, "wf1.c", 83
+L0008:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "wf1.c", 84
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxspidx
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "wf1.c", 85
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strlen
+	ina
+	bne     L000A
+	inx
+L000A:	jsr     _malloc
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "wf1.c", 86
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     booleq
+	jeq     L000B
+	.dbg	line, "wf1.c", 87
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _err
+	.dbg	line, "wf1.c", 88
+L000B:	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$07
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strcpy
+	.dbg	line, "wf1.c", 89
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _next
+	ldx     _next+1
+	jsr     aslax3
+	clc
+	adc     #<(_words)
+	tay
+	txa
+	adc     #>(_words)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	sta     regsave
+	stx     regsave+1
+	inc     _next
+	bne     L000D
+	inc     _next+1
+L000D:	lda     regsave
+	ldx     regsave+1
+	jmp     L0001
+	.dbg	line, "wf1.c", 90
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ isletter (char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_isletter: near
+
+	.dbg	func, "isletter", "00", static, "_isletter"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 59
+	jsr     pusha
+	.dbg	line, "wf1.c", 60
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$41
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$5B
+	jsr     boolult
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$20
+	adc     (c_sp),y
+	sta     (c_sp),y
+	.dbg	line, "wf1.c", 61
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$61
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	cmp     #$7B
+	jsr     boolult
+	jne     L0008
+L0007:	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0008:	ldx     #$00
+	lda     #$01
+L0009:	jeq     L0006
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jmp     L0001
+	.dbg	line, "wf1.c", 62
+L0006:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "wf1.c", 63
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "root", "00", auto, -2
+	.dbg	sym, "word", "00", auto, -22
+
+.segment	"CODE"
+
+	.dbg	line, "wf1.c", 106
+	ldy     #$16
+	jsr     subysp
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _fopen
+	sta     _in
+	stx     _in+1
+	.dbg	line, "wf1.c", 107
+	lda     _in
+	ldx     _in+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "wf1.c", 108
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "wf1.c", 111
+L0002:	ldx     #$00
+	lda     #$00
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "wf1.c", 112
+	ldx     #$00
+	lda     #$00
+	sta     _next
+	stx     _next+1
+	.dbg	line, "wf1.c", 113
+	jmp     L0006
+	.dbg	line, "wf1.c", 114
+L0004:	lda     c_sp
+	ldx     c_sp+1
+	jsr     pushax
+	lda     #$16
+	jsr     leaa0sp
+	jsr     _lookup
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L0007
+	inx
+L0007:	ldy     #$00
+	jsr     staxspidx
+	lda     regsave
+	ldx     regsave+1
+	.dbg	line, "wf1.c", 113
+L0006:	lda     c_sp
+	ldx     c_sp+1
+	jsr     _getword
+	stx     tmp1
+	ora     tmp1
+	jne     L0004
+	.dbg	line, "wf1.c", 115
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     _tprint
+	.dbg	line, "wf1.c", 117
+	lda     _in
+	ldx     _in+1
+	jsr     _fclose
+	.dbg	line, "wf1.c", 118
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "wf1.c", 119
+L0001:	rts
+
+	.dbg	line
+.endproc
+
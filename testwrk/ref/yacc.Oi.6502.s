@@ -0,0 +1,3472 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0000
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0001:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0009:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0003:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S0011:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0006:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S000A:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S0010:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S000F:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S000E:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S000D:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S000B	:=	S000C+6
+S0007:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S0012	:=	S0007+0
+S0005:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     _yymorfg
+	ora     _yymorfg+1
+	bne     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L0090
+L0002:	lda     #$00
+	sta     _yymorfg
+	sta     _yymorfg+1
+	lda     _yyleng
+	clc
+	adc     #<(_yytext)
+	tay
+	lda     _yyleng+1
+	adc     #>(_yytext)
+	tax
+	tya
+L0090:	jsr     stax0sp
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	ldy     #$0A
+	jsr     staxysp
+	lda     _yybgin
+	ldx     _yybgin+1
+	ldy     #$0C
+	jsr     staxysp
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious+1
+	bne     L0008
+	lda     _yyprevious
+	cmp     #$0A
+	bne     L0008
+	ldy     #$0C
+	ldx     #$00
+	lda     #$06
+	jsr     addeqysp
+L0008:	lda     #$00
+	sta     _testbreak
+L0082:	lda     _testbreak
+	cmp     #$05
+	bne     L0083
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0002)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0002)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0083:	inc     _testbreak
+	ldy     #$0D
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	bne     L0012
+	ldy     #$0D
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0088
+	cmp     #$00
+	jeq     L0063
+L0088:	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	jeq     L0063
+L0012:	jsr     pushw0sp
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	jsr     boolugt
+	php
+	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0013
+	ldx     _yysptr
+	bne     L0014
+	dec     _yysptr+1
+L0014:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0015
+L0013:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0015:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0017
+	cmp     #$0A
+	bne     L0017
+	inc     _yylineno
+	bne     L0017
+	inc     _yylineno+1
+L0017:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L001B
+	lda     _yytchar
+	cmp     #$FF
+	bne     L001B
+	ldx     #$00
+	txa
+	jmp     L001C
+L001B:	lda     _yytchar
+	ldx     _yytchar+1
+L001C:	ldy     #$06
+	jsr     staxysp
+	ldy     #$00
+	jsr     staspidx
+L001D:	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     #<(_yycrank)
+	sta     tmp1
+	txa
+	sbc     #>(_yycrank)
+	ora     tmp1
+	jcc     L001E
+	jeq     L001E
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	lda     tmp1
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L007F
+	jcs     L0037
+L007F:	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	jne     L0037
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L0092
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0023
+	cmp     #<(_yysvec)
+	bne     L0023
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A3
+L0023:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L0082
+L001E:	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #<(_yycrank)
+	txa
+	sbc     #>(_yycrank)
+	jcs     L0037
+	lda     #<(_yycrank)
+	sec
+	sbc     (c_sp),y
+	pha
+	lda     #>(_yycrank)
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	cpx     #$00
+	bpl     L002B
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L002D
+	cmp     #$FF
+L002D:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L002B
+	ldx     #$00
+	txa
+	jmp     L002C
+L002B:	jsr     asrax1
+L002C:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yycrank)
+	tay
+	lda     tmp1
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	pha
+	lda     tmp1
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0080
+	jcs     L002E
+L0080:	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	bne     L002E
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L002E
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0032
+	cmp     #<(_yysvec)
+	bne     L0032
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A3
+L0032:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L0082
+L002E:	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yymatch)
+	sta     ptr1+1
+	ldy     #<(_yymatch)
+	ldx     #$00
+	lda     (ptr1),y
+	asl     a
+	bcc     L007E
+	inx
+	clc
+L007E:	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0081
+	jcs     L0037
+L0081:	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	bne     L0037
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L0092
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L003B
+	cmp     #<(_yysvec)
+	bne     L003B
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A3
+L003B:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L0082
+L0037:	ldy     #$0D
+L0092:	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$0C
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	beq     L0041
+	ldy     #$0D
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	jne     L001D
+	cmp     #<(_yycrank)
+	jne     L001D
+L0041:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0045
+	lda     _yylineno
+	bne     L0047
+	dec     _yylineno+1
+L0047:	dec     _yylineno
+L0045:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	jeq     L007C
+	jmp     L0063
+L0049:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	tya
+	sta     (ptr1),y
+	tax
+	lda     #$01
+	jsr     subeq0sp
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L008C
+	cmp     #$00
+	jeq     L004C
+L008C:	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (ptr1),y
+	sta     _yyfnd+1
+	dey
+	lda     (ptr1),y
+	sta     _yyfnd
+	ora     _yyfnd+1
+	jeq     L004C
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L004F
+	eor     #$80
+L004F:	jpl     L004C
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     _yyolsp+1
+	dey
+	lda     (c_sp),y
+	sta     _yyolsp
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yyextra)
+	sta     ptr1+1
+	ldy     #<(_yyextra)
+	lda     (ptr1),y
+	jeq     L0054
+	jmp     L005D
+L0086:	lda     #$02
+	jsr     subeqysp
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     #$01
+	jsr     subeq0sp
+	lda     _yytchar+1
+	bne     L005A
+	lda     _yytchar
+	cmp     #$0A
+	bne     L005A
+	lda     _yylineno
+	bne     L005C
+	dec     _yylineno+1
+L005C:	dec     _yylineno
+L005A:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	ldy     #$00
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L005D
+	inc     _yysptr+1
+L005D:	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L008D
+	cmp     #$01
+	beq     L0054
+L008D:	ldy     #$0B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	beq     L0054
+	bcc     L0054
+	ldx     #$00
+	jmp     L0086
+L0054:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yyprevious
+	stx     _yyprevious+1
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     _yylsp+1
+	dey
+	lda     (c_sp),y
+	sta     _yylsp
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     #<(_yytext)
+	pha
+	txa
+	sbc     #>(_yytext)
+	tax
+	pla
+	clc
+	adc     #$01
+	bcc     L005E
+	inx
+L005E:	sta     _yyleng
+	stx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	sta     ptr1
+	txa
+	adc     #>(_yytext)
+	sta     ptr1+1
+	tya
+	sta     (ptr1),y
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L005F
+	inc     _yyfnd+1
+L005F:	lda     regsave
+	ldx     regsave+1
+	jmp     L0005
+L004C:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+L00A3:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0060
+	lda     _yylineno
+	bne     L0062
+	dec     _yylineno+1
+L0062:	dec     _yylineno
+L0060:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L0063
+L007C:	inc     _yysptr+1
+L0063:	ldy     #$0B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	jsr     boolugt
+	php
+	lda     #$02
+	jsr     subeqysp
+	plp
+	jne     L0049
+	lda     _yytext
+	bne     L0064
+	lda     #>(_yysbuf)
+	sta     _yysptr+1
+	lda     #<(_yysbuf)
+	sta     _yysptr
+	ldx     #$00
+	txa
+	jmp     L0005
+L0064:	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0065
+	beq     L0065
+	ldx     _yysptr
+	bne     L0066
+	dec     _yysptr+1
+L0066:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0067
+L0065:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0067:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0069
+	cmp     #$0A
+	bne     L0069
+	inc     _yylineno
+	bne     L0069
+	inc     _yylineno+1
+L0069:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L006D
+	lda     _yytchar
+	cmp     #$FF
+	bne     L006D
+	ldx     #$00
+	txa
+	jmp     L0087
+L006D:	lda     _yytchar
+	ldx     #$00
+L0087:	sta     _yytext
+	sta     _yyprevious
+	stx     _yyprevious+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0070
+	eor     #$80
+L0070:	bpl     L006F
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L006F:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L0090
+L0005:	ldy     #$0E
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$74
+	jsr     subysp
+	ldy     #$08
+	lda     #$00
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     #$00
+	sta     _yynerrs
+	sta     _yynerrs+1
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$0E
+	bcc     L0002
+	inx
+L0002:	ldy     #$06
+	jsr     staxysp
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+L0053:	jsr     staxysp
+L0003:	ldy     #$06
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$76
+	bcc     L0005
+	inx
+L0005:	jsr     tosicmp
+	bcc     L0004
+	beq     L0004
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _yyerror
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0004:	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     _yyval
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     _yyval+1
+	sta     (ptr1),y
+L0006:	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0008
+	eor     #$80
+L0008:	jmi     L0010
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L000B
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L000B
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L000B:	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	jcs     L0010
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000E
+	eor     #$80
+L000E:	jmi     L0010
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     _yychar+1
+	bne     L0010
+	cmp     _yychar
+	bne     L0010
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     _yylval+1
+	sta     _yyval+1
+	lda     _yylval
+	sta     _yyval
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$08
+	jsr     staxysp
+	lda     _yyerrflag
+	cmp     #$01
+	lda     _yyerrflag+1
+	sbc     #$00
+	bvs     L0012
+	eor     #$80
+L0012:	jpl     L0003
+	ldx     _yyerrflag
+	bne     L0013
+	dec     _yyerrflag+1
+L0013:	dex
+	stx     _yyerrflag
+	jmp     L0003
+L0010:	ldy     #$09
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yydef)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yydef)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	jne     L0024
+	cmp     #$FE
+	jne     L0024
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0017
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0017
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L0017:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	jsr     stax0sp
+L0018:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$FF
+	bne     L005D
+	cmp     #$FF
+	bne     L005D
+	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L001E
+	inx
+L001E:	sta     ptr1
+	stx     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	cmp     (c_sp),y
+	bne     L005D
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L005E
+L005D:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jmp     L0018
+L0020:	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     _yychar+1
+	bne     L005E
+	cmp     _yychar
+	beq     L0021
+L005E:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	bpl     L0020
+L0021:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L0025
+	inx
+L0025:	sta     ptr1
+	stx     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	bcc     L0024
+	ldx     #$00
+	txa
+	jmp     L0001
+L0024:	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	jne     L0059
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cpx     #$00
+	jne     L0059
+	cmp     #$00
+	beq     L002A
+	cmp     #$01
+	beq     L0055
+	cmp     #$02
+	beq     L0055
+	cmp     #$03
+	jeq     L003A
+	jmp     L0059
+L002A:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L002C
+	inc     _yynerrs+1
+L002C:	ldx     #$00
+L0055:	lda     #$03
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	jmp     L0031
+L002F:	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	inx
+	ldy     #$04
+	jsr     staxysp
+	txa
+	bmi     L0033
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0035
+	eor     #$80
+L0035:	bpl     L0033
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$01
+	bne     L0033
+	cmp     #$00
+	bne     L0033
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	jmp     L0053
+L0033:	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+L0031:	ldy     #$09
+	jsr     pushwysp
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$12
+	bcc     L0032
+	inx
+L0032:	jsr     tosicmp
+	jcs     L002F
+	ldx     #$00
+L0058:	lda     #$01
+	jmp     L0001
+L003A:	lda     _yychar
+	ora     _yychar+1
+	beq     L0058
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	jmp     L0006
+L0059:	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr2)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr2)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr2)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr2)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L003D
+	inx
+L003D:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	sta     _yyval+1
+	dey
+	lda     (ptr1),y
+	sta     _yyval
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr1)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr1)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$04
+	jsr     staxysp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypgo)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypgo)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	clc
+	adc     #$01
+	bcc     L003E
+	inx
+L003E:	ldy     #$0E
+	jsr     staxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L0040
+	eor     #$80
+L0040:	bmi     L005A
+	ldy     #$0F
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	jsr     staxysp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     negax
+	jsr     tosicmp
+	beq     L003F
+L005A:	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypgo)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypgo)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$08
+	jsr     staxysp
+L003F:	ldy     #$0D
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cpx     #$00
+	jne     L0003
+	cmp     #$04
+	beq     L005B
+	cmp     #$05
+	beq     L0046
+	cmp     #$06
+	beq     L0047
+	cmp     #$07
+	beq     L0048
+	cmp     #$08
+	beq     L0049
+	cmp     #$09
+	beq     L004A
+	cmp     #$0A
+	beq     L004B
+	cmp     #$0C
+	beq     L004C
+	cmp     #$0D
+	beq     L004D
+	cmp     #$0E
+	jeq     L004E
+	jmp     L0003
+L005B:	txa
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	jmp     L0003
+L0046:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0047:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0048:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0049:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004A:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004B:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004C:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004D:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0003
+L004E:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0003
+L0001:	ldy     #$74
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+	bne     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	ldx     #$00
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	ldx     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+	bne     L0006
+	inc     _yylineno
+	bne     L0006
+	inc     _yylineno+1
+L0006:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L000A
+	lda     _yytchar
+	cmp     #$FF
+	bne     L000A
+	ldx     #$00
+	txa
+	jmp     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+L000B:	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L000A
+	jmp     L000B
+L0004:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cmp     (c_sp),y
+	bne     L0008
+	txa
+	iny
+	cmp     (c_sp),y
+L0008:	jsr     booleq
+	php
+	ldy     #$02
+	tya
+	jsr     addeqysp
+	plp
+	beq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0007:	ldy     #$03
+L000A:	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	bne     L0004
+L000B:	tax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jmp     L0007
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0008
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L0007
+	cmp     #$04
+	beq     L0012
+	jmp     L000F
+L0010:	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+	beq     L0007
+	jmp     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	jmp     L0013
+L000A:	inx
+	jmp     incsp2
+L000B:	inx
+	jmp     incsp2
+L0012:	lda     _yytext
+	jmp     incsp2
+L000F:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0001)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0001)
+	sta     (c_sp),y
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+L0007:	jsr     _yylook
+	jsr     stax0sp
+	txa
+	bpl     L0002
+L0013:	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,2999 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0000
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0001:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0009:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0003:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S0011:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0006:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S000A:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S0010:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S000F:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S000E:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S000D:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S000B	:=	S000C+6
+S0007:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S0012	:=	S0007+0
+S0005:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jsr     decsp8
+	lda     _yymorfg
+	ora     _yymorfg+1
+	bne     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	bra     L0094
+L0002:	stz     _yymorfg
+	stz     _yymorfg+1
+	lda     _yyleng
+	clc
+	adc     #<(_yytext)
+	tay
+	lda     _yyleng+1
+	adc     #>(_yytext)
+	tax
+	tya
+L0094:	jsr     stax0sp
+	lda     #>(_yylstate)
+	sta     regbank+2+1
+	lda     #<(_yylstate)
+	sta     regbank+2
+	lda     _yybgin
+	ldx     _yybgin+1
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious+1
+	bne     L000A
+	lda     _yyprevious
+	cmp     #$0A
+	bne     L000A
+	lda     #$06
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L000A
+	inc     regbank+4+1
+L000A:	stz     _testbreak
+L0086:	lda     _testbreak
+	cmp     #$05
+	bne     L0087
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0087:	inc     _testbreak
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	lda     (regbank+4)
+	sta     regbank+0
+	stx     regbank+0+1
+	cpx     #>(_yycrank)
+	bne     L0013
+	cmp     #<(_yycrank)
+	bne     L0013
+	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L008B
+	cmp     #$00
+	jeq     L0066
+L008B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #>(_yycrank)
+	bne     L0013
+	cmp     #<(_yycrank)
+	jeq     L0066
+L0013:	jsr     pushw0sp
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	jsr     boolugt
+	php
+	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0014
+	lda     _yysptr
+	bne     L0015
+	dec     _yysptr+1
+L0015:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L0016
+L0014:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0016:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0018
+	cmp     #$0A
+	bne     L0018
+	inc     _yylineno
+	bne     L0018
+	inc     _yylineno+1
+L0018:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L001C
+	lda     _yytchar
+	cmp     #$FF
+	bne     L001C
+	ldx     #$00
+	txa
+	bra     L001D
+L001C:	lda     _yytchar
+	ldx     _yytchar+1
+L001D:	ldy     #$06
+	jsr     staxysp
+	ldy     #$00
+	jsr     staspidx
+L001E:	lda     regbank+0
+	ldx     regbank+0+1
+	ldy     #$02
+	jsr     staxysp
+	lda     regbank+0
+	sec
+	sbc     #<(_yycrank)
+	sta     tmp1
+	lda     regbank+0+1
+	sbc     #>(_yycrank)
+	ora     tmp1
+	jcc     L001F
+	jeq     L001F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     regbank+0
+	stx     regbank+0+1
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0083
+	jcs     L0093
+L0083:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	jne     L0037
+	cmp     regbank+4
+	jne     L0037
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0024
+	cmp     #<(_yysvec)
+	bne     L0024
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A6
+L0024:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	jcc     L0086
+	inc     regbank+2+1
+	jmp     L0086
+L001F:	lda     regbank+0
+	cmp     #<(_yycrank)
+	lda     regbank+0+1
+	sbc     #>(_yycrank)
+	jcs     L0037
+	lda     #<(_yycrank)
+	sec
+	sbc     regbank+0
+	pha
+	lda     #>(_yycrank)
+	sbc     regbank+0+1
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     aslax1
+	clc
+	adc     #<(_yycrank)
+	tay
+	txa
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	sta     regbank+0
+	stx     regbank+0+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+0
+	stx     regbank+0+1
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0084
+	bcs     L002D
+L0084:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	bne     L002D
+	cmp     regbank+4
+	bne     L002D
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0031
+	cmp     #<(_yysvec)
+	bne     L0031
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A6
+L0031:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	jcc     L0086
+	inc     regbank+2+1
+	jmp     L0086
+L002D:	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yymatch)
+	sta     ptr1+1
+	ldy     #<(_yymatch)
+	ldx     #$00
+	lda     (ptr1),y
+	asl     a
+	bcc     L0082
+	inx
+	clc
+L0082:	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     regbank+0
+	stx     regbank+0+1
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0085
+	jcs     L0093
+L0085:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	bne     L0037
+	cmp     regbank+4
+	bne     L0037
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L003B
+	cmp     #<(_yysvec)
+	bne     L003B
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L00A6
+L003B:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	jcc     L0086
+	inc     regbank+2+1
+	jmp     L0086
+L0037:	ldy     #$03
+L0093:	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regbank+4
+	stx     regbank+4+1
+	ora     regbank+4+1
+	beq     L0042
+	dey
+	lda     (regbank+4),y
+	tax
+	lda     (regbank+4)
+	sta     regbank+0
+	stx     regbank+0+1
+	cpx     #>(_yycrank)
+	jne     L001E
+	cmp     #<(_yycrank)
+	jne     L001E
+L0042:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	jmp     L00A6
+L004A:	jsr     ldptr10sp
+	lda     #$00
+	sta     (ptr1)
+	tax
+	ina
+	jsr     subeq0sp
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	cpx     #$00
+	bne     L008F
+	cmp     #$00
+	jeq     L004E
+L008F:	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	ldy     #$05
+	jsr     ldaxidx
+	sta     _yyfnd
+	stx     _yyfnd+1
+	ora     _yyfnd+1
+	jeq     L004E
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0051
+	eor     #$80
+L0051:	jpl     L004E
+	lda     regbank+2+1
+	sta     _yyolsp+1
+	lda     regbank+2
+	sta     _yyolsp
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yyextra)
+	sta     ptr1+1
+	ldy     #<(_yyextra)
+	lda     (ptr1),y
+	jeq     L0056
+	bra     L0060
+L0055:	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L005C
+	dec     regbank+2+1
+L005C:	jsr     ldptr10sp
+	ldx     #$00
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	lda     #$01
+	jsr     subeq0sp
+	lda     _yytchar+1
+	bne     L005D
+	lda     _yytchar
+	cmp     #$0A
+	bne     L005D
+	lda     _yylineno
+	bne     L005F
+	dec     _yylineno+1
+L005F:	dec     _yylineno
+L005D:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L0060
+	inc     _yysptr+1
+L0060:	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	ldy     #$05
+	jsr     pushwidx
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L0090
+	cmp     #$01
+	beq     L0056
+L0090:	lda     regbank+2
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	lda     regbank+2+1
+	sbc     #>(_yylstate)
+	ora     tmp1
+	beq     L0056
+	bcs     L0055
+L0056:	jsr     ldptr10sp
+	lda     (ptr1)
+	sta     _yyprevious
+	stz     _yyprevious+1
+	lda     regbank+2+1
+	sta     _yylsp+1
+	lda     regbank+2
+	sta     _yylsp
+	jsr     ldax0sp
+	sec
+	sbc     #<(_yytext)
+	pha
+	txa
+	sbc     #>(_yytext)
+	tax
+	pla
+	ina
+	bne     L0061
+	inx
+L0061:	sta     _yyleng
+	stx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	sta     ptr1
+	txa
+	adc     #>(_yytext)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L0062
+	inc     _yyfnd+1
+L0062:	lda     regsave
+	ldx     regsave+1
+	jmp     L0005
+L004E:	jsr     ldax0sp
+L00A6:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L0063
+	lda     _yylineno
+	bne     L0065
+	dec     _yylineno+1
+L0065:	dec     _yylineno
+L0063:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L0066
+	inc     _yysptr+1
+L0066:	lda     regbank+2
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	lda     regbank+2+1
+	sbc     #>(_yylstate)
+	ora     tmp1
+	jsr     boolugt
+	php
+	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L004D
+	dec     regbank+2+1
+L004D:	plp
+	jne     L004A
+	lda     _yytext
+	bne     L0067
+	lda     #>(_yysbuf)
+	sta     _yysptr+1
+	lda     #<(_yysbuf)
+	sta     _yysptr
+	txa
+	jmp     L0005
+L0067:	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0068
+	beq     L0068
+	lda     _yysptr
+	bne     L0069
+	dec     _yysptr+1
+L0069:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L006A
+L0068:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L006A:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L006C
+	cmp     #$0A
+	bne     L006C
+	inc     _yylineno
+	bne     L006C
+	inc     _yylineno+1
+L006C:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L0070
+	lda     _yytchar
+	cmp     #$FF
+	bne     L0070
+	ina
+	bra     L008A
+L0070:	lda     _yytchar
+L008A:	sta     _yytext
+	sta     _yyprevious
+	stz     _yyprevious+1
+	cmp     #$01
+	lda     #$00
+	sbc     #$00
+	bvs     L0073
+	eor     #$80
+L0073:	bpl     L0072
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L0072:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L0094
+L0005:	pha
+	stx     tmp1
+	ldy     #$0D
+	ldx     #$05
+L0074:	lda     (c_sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0074
+	ldx     tmp1
+	pla
+	ldy     #$0E
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$68
+	jsr     subysp
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jsr     decsp6
+	stz     regbank+2
+	stz     regbank+2+1
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	stz     _yynerrs
+	stz     _yynerrs+1
+	stz     _yyerrflag
+	stz     _yyerrflag+1
+	lda     #$0E
+	jsr     leaa0sp
+	sta     regbank+0
+	stx     regbank+0+1
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+	jsr     staxysp
+L0002:	lda     #$02
+	clc
+	adc     regbank+0
+	sta     regbank+0
+	bcc     L0004
+	inc     regbank+0+1
+L0004:	ldx     regbank+0+1
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tosicmp
+	bcc     L0003
+	beq     L0003
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _yyerror
+	lda     #$01
+	jmp     L0001
+L0003:	lda     regbank+2
+	sta     (regbank+0)
+	ldy     #$01
+	lda     regbank+2+1
+	sta     (regbank+0),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     _yyval
+	sta     (ptr1)
+	ldy     #$01
+	lda     _yyval+1
+	sta     (ptr1),y
+L0005:	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0007
+	eor     #$80
+L0007:	jmi     L000F
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L000A
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L000A
+	stz     _yychar
+	stz     _yychar+1
+L000A:	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	jcs     L000F
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000D
+	eor     #$80
+L000D:	bmi     L000F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L000F
+	cmp     _yychar
+	bne     L000F
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     _yylval+1
+	sta     _yyval+1
+	lda     _yylval
+	sta     _yyval
+	ldy     #$05
+	jsr     ldaxysp
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     _yyerrflag
+	cmp     #$01
+	lda     _yyerrflag+1
+	sbc     #$00
+	bvs     L0011
+	eor     #$80
+L0011:	jpl     L0002
+	lda     _yyerrflag
+	bne     L0012
+	dec     _yyerrflag+1
+L0012:	dea
+	sta     _yyerrflag
+	jmp     L0002
+L000F:	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     aslax1
+	clc
+	adc     #<(_yydef)
+	tay
+	txa
+	adc     #>(_yydef)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	jne     L0022
+	cmp     #$FE
+	bne     L0022
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0016
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0016
+	stz     _yychar
+	stz     _yychar+1
+L0016:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	jsr     stax0sp
+L0017:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     #$FF
+	bne     L0019
+	cmp     #$FF
+	bne     L0019
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	cpx     regbank+2+1
+	bne     L0019
+	cmp     regbank+2
+	beq     L0021
+L0019:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	bra     L0017
+L001E:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L0021
+	cmp     _yychar
+	beq     L001F
+L0021:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jsr     ldaxi
+	txa
+	bpl     L001E
+L001F:	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	bcc     L0022
+	lda     #$00
+	jmp     L0001
+L0022:	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	jne     L0055
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cpx     #$00
+	jne     L0055
+	cmp     #$00
+	beq     L0027
+	cmp     #$01
+	beq     L0051
+	cmp     #$02
+	beq     L0051
+	cmp     #$03
+	jeq     L0037
+	jmp     L0055
+L0027:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L0051
+	inc     _yynerrs+1
+L0051:	lda     #$03
+	sta     _yyerrflag
+	stz     _yyerrflag+1
+	jmp     L002E
+L002C:	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	lda     (regbank+0)
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	clc
+	lda     ptr1
+	pha
+	lda     #$01
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxysp
+	txa
+	bmi     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0031
+	eor     #$80
+L0031:	bpl     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$01
+	bne     L002F
+	cmp     #$00
+	bne     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+2
+	stx     regbank+2+1
+	jmp     L0002
+L002F:	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	lda     (regbank+0)
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	lda     regbank+0
+	sec
+	sbc     #$02
+	sta     regbank+0
+	bcs     L0035
+	dec     regbank+0+1
+L0035:	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+L002E:	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     tosicmp
+	jcs     L002C
+L0054:	lda     #$01
+	jmp     L0001
+L0037:	lda     _yychar
+	ora     _yychar+1
+	beq     L0054
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	jmp     L0005
+L0055:	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	eor     #$FF
+	sec
+	adc     regbank+0
+	sta     regbank+0
+	txa
+	eor     #$FF
+	adc     regbank+0+1
+	sta     regbank+0+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	sta     _yyval
+	stx     _yyval+1
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr1)
+	tay
+	txa
+	adc     #>(_yyr1)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	lda     (regbank+0)
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ina
+	bne     L003A
+	inx
+L003A:	ldy     #$0E
+	jsr     staxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L003C
+	eor     #$80
+L003C:	bmi     L0056
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+2
+	stx     regbank+2+1
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosicmp
+	beq     L003B
+L0056:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+2
+	stx     regbank+2+1
+L003B:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0002
+	cmp     #$04
+	beq     L0057
+	cmp     #$05
+	beq     L0042
+	cmp     #$06
+	beq     L0043
+	cmp     #$07
+	beq     L0044
+	cmp     #$08
+	beq     L0045
+	cmp     #$09
+	beq     L0046
+	cmp     #$0A
+	beq     L0047
+	cmp     #$0C
+	beq     L0048
+	cmp     #$0D
+	beq     L0049
+	cmp     #$0E
+	jeq     L004A
+	jmp     L0002
+L0057:	stz     _yyerrflag
+	stz     _yyerrflag+1
+	jmp     L0002
+L0042:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0043:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0044:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0045:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0046:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0047:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0048:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0049:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L004A:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L0001:	pha
+	stz     tmp1
+	ldy     #$0B
+	ldx     #$05
+L004B:	lda     (c_sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L004B
+	ldx     tmp1
+	pla
+	ldy     #$74
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+	bne     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	ldx     #$00
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	lda     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+	bne     L0006
+	inc     _yylineno
+	bne     L0006
+	inc     _yylineno+1
+L0006:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L000A
+	lda     _yytchar
+	cmp     #$FF
+	bne     L000A
+	ldx     #$00
+	txa
+	bra     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+	rts
+L000B:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L000A
+	bra     L000B
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	cmp     (c_sp)
+	bne     L0008
+	txa
+	ldy     #$01
+	cmp     (c_sp),y
+L0008:	jsr     booleq
+	php
+	ldy     #$02
+	tya
+	jsr     addeqysp
+	plp
+	beq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0007:	ldy     #$03
+L000A:	jsr     ldptr1ysp
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	bne     L0004
+L000B:	tax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	bra     L0007
+L0002:	jsr     ldax0sp
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0008
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L0007
+	cmp     #$04
+	beq     L0012
+	bra     L000F
+L0010:	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+	beq     L0007
+	bra     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	bra     L0013
+L000A:	inx
+	jmp     incsp2
+L000B:	inx
+	jmp     incsp2
+L0012:	lda     _yytext
+	jmp     incsp2
+L000F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+L0007:	jsr     _yylook
+	jsr     stax0sp
+	txa
+	bpl     L0002
+L0013:	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ina
+	rts
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,3013 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0000
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0001:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0009:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0003:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S0011:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0006:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S000A:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S0010:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S000F:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S000E:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S000D:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S000B	:=	S000C+6
+S0007:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S0012	:=	S0007+0
+S0005:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     _yymorfg
+	ora     _yymorfg+1
+	bne     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L008C
+L0002:	lda     #$00
+	sta     _yymorfg
+	sta     _yymorfg+1
+	lda     _yyleng
+	clc
+	adc     #<(_yytext)
+	tay
+	lda     _yyleng+1
+	adc     #>(_yytext)
+	tax
+	tya
+L008C:	jsr     stax0sp
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	ldy     #$0A
+	jsr     staxysp
+	lda     _yybgin
+	ldx     _yybgin+1
+	ldy     #$0C
+	jsr     staxysp
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious+1
+	bne     L0008
+	lda     _yyprevious
+	cmp     #$0A
+	bne     L0008
+	ldy     #$0C
+	ldx     #$00
+	lda     #$06
+	jsr     addeqysp
+L0008:	lda     #$00
+	sta     _testbreak
+L007E:	lda     _testbreak
+	cmp     #$05
+	bne     L007F
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L007F:	inc     _testbreak
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	bne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0084
+	cmp     #$00
+	jeq     L005F
+L0084:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	jeq     L005F
+L0012:	jsr     pushw0sp
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	jsr     boolugt
+	php
+	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0013
+	ldx     _yysptr
+	bne     L0014
+	dec     _yysptr+1
+L0014:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0015
+L0013:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0015:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0017
+	cmp     #$0A
+	bne     L0017
+	inc     _yylineno
+	bne     L0017
+	inc     _yylineno+1
+L0017:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L001B
+	lda     _yytchar
+	cmp     #$FF
+	bne     L001B
+	ldx     #$00
+	txa
+	jmp     L001C
+L001B:	lda     _yytchar
+	ldx     _yytchar+1
+L001C:	ldy     #$06
+	jsr     staxysp
+	ldy     #$00
+	jsr     staspidx
+L001D:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yycrank)
+	sta     tmp1
+	txa
+	sbc     #>(_yycrank)
+	ora     tmp1
+	jcc     L001E
+	jeq     L001E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L007B
+	jcs     L0034
+L007B:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	jne     L0034
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L008E
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0023
+	cmp     #<(_yysvec)
+	bne     L0023
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L009F
+L0023:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L007E
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	cmp     #<(_yycrank)
+	txa
+	sbc     #>(_yycrank)
+	jcs     L0034
+	lda     #<(_yycrank)
+	sec
+	ldy     #$08
+	sbc     (c_sp),y
+	pha
+	lda     #>(_yycrank)
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     aslax1
+	clc
+	adc     #<(_yycrank)
+	tay
+	txa
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L007C
+	jcs     L002B
+L007C:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	bne     L002B
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L002B
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L002F
+	cmp     #<(_yysvec)
+	bne     L002F
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L009F
+L002F:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L007E
+L002B:	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yymatch)
+	sta     ptr1+1
+	ldy     #<(_yymatch)
+	ldx     #$00
+	lda     (ptr1),y
+	asl     a
+	bcc     L007A
+	inx
+	clc
+L007A:	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L007D
+	jcs     L0034
+L007D:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	bne     L0034
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L008E
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0038
+	cmp     #<(_yysvec)
+	bne     L0038
+	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jmp     L009F
+L0038:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jmp     L007E
+L0034:	ldy     #$0D
+L008E:	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$0C
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	jne     L001D
+	cmp     #<(_yycrank)
+	jne     L001D
+L003E:	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0042
+	lda     _yylineno
+	bne     L0044
+	dec     _yylineno+1
+L0044:	dec     _yylineno
+L0042:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	jeq     L0078
+	jmp     L005F
+L0046:	jsr     ldptr10sp
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	tax
+	lda     #$01
+	jsr     subeq0sp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0088
+	cmp     #$00
+	jeq     L0049
+L0088:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$05
+	jsr     ldaxidx
+	sta     _yyfnd
+	stx     _yyfnd+1
+	ora     _yyfnd+1
+	jeq     L0049
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L004C
+	eor     #$80
+L004C:	jpl     L0049
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yyolsp
+	stx     _yyolsp+1
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yyextra)
+	sta     ptr1+1
+	ldy     #<(_yyextra)
+	lda     (ptr1),y
+	jeq     L0051
+	jmp     L005A
+L0082:	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	jsr     ldptr10sp
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     #$01
+	jsr     subeq0sp
+	lda     _yytchar+1
+	bne     L0057
+	lda     _yytchar
+	cmp     #$0A
+	bne     L0057
+	lda     _yylineno
+	bne     L0059
+	dec     _yylineno+1
+L0059:	dec     _yylineno
+L0057:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	ldy     #$00
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L005A
+	inc     _yysptr+1
+L005A:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$05
+	jsr     pushwidx
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L0089
+	cmp     #$01
+	beq     L0051
+L0089:	ldy     #$0B
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	beq     L0051
+	bcc     L0051
+	ldx     #$00
+	jmp     L0082
+L0051:	jsr     ldptr10sp
+	ldx     #$00
+	lda     (ptr1,x)
+	sta     _yyprevious
+	stx     _yyprevious+1
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yylsp
+	stx     _yylsp+1
+	jsr     ldax0sp
+	sec
+	sbc     #<(_yytext)
+	pha
+	txa
+	sbc     #>(_yytext)
+	tax
+	pla
+	jsr     incax1
+	sta     _yyleng
+	stx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	sta     ptr1
+	txa
+	adc     #>(_yytext)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L005B
+	inc     _yyfnd+1
+L005B:	lda     regsave
+	ldx     regsave+1
+	jmp     L0005
+L0049:	jsr     ldax0sp
+L009F:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L005C
+	lda     _yylineno
+	bne     L005E
+	dec     _yylineno+1
+L005E:	dec     _yylineno
+L005C:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L005F
+L0078:	inc     _yysptr+1
+L005F:	ldy     #$0B
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	jsr     boolugt
+	php
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	plp
+	jne     L0046
+	lda     _yytext
+	bne     L0060
+	lda     #>(_yysbuf)
+	sta     _yysptr+1
+	lda     #<(_yysbuf)
+	sta     _yysptr
+	ldx     #$00
+	txa
+	jmp     L0005
+L0060:	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0061
+	beq     L0061
+	ldx     _yysptr
+	bne     L0062
+	dec     _yysptr+1
+L0062:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0063
+L0061:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0063:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0065
+	cmp     #$0A
+	bne     L0065
+	inc     _yylineno
+	bne     L0065
+	inc     _yylineno+1
+L0065:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L0069
+	lda     _yytchar
+	cmp     #$FF
+	bne     L0069
+	ldx     #$00
+	txa
+	jmp     L0083
+L0069:	lda     _yytchar
+	ldx     #$00
+L0083:	sta     _yytext
+	sta     _yyprevious
+	stx     _yyprevious+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L006C
+	eor     #$80
+L006C:	bpl     L006B
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L006B:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L008C
+L0005:	ldy     #$0E
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$74
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$08
+	jsr     staxysp
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	txa
+	sta     _yynerrs
+	sta     _yynerrs+1
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	lda     #$0E
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+L004C:	jsr     staxysp
+L0002:	ldy     #$06
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tosicmp
+	bcc     L0003
+	beq     L0003
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _yyerror
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0003:	ldy     #$07
+	jsr     ldptr1ysp
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     _yyval
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     _yyval+1
+	sta     (ptr1),y
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L000E
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0009
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0009
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L0009:	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	jcs     L000E
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	bmi     L000E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L000E
+	cmp     _yychar
+	bne     L000E
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     _yylval+1
+	sta     _yyval+1
+	lda     _yylval
+	sta     _yyval
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	jsr     staxysp
+	lda     _yyerrflag
+	cmp     #$01
+	lda     _yyerrflag+1
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	jpl     L0002
+	ldx     _yyerrflag
+	bne     L0011
+	dec     _yyerrflag+1
+L0011:	dex
+	stx     _yyerrflag
+	jmp     L0002
+L000E:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yydef)
+	tay
+	txa
+	adc     #>(_yydef)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	jne     L0021
+	cmp     #$FE
+	jne     L0021
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0015
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0015
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L0015:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	jsr     stax0sp
+L0016:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     #$FF
+	bne     L0018
+	cmp     #$FF
+	bne     L0018
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$08
+	cmp     (c_sp),y
+	bne     L0018
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L0020
+L0018:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jmp     L0016
+L001D:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L0020
+	cmp     _yychar
+	beq     L001E
+L0020:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jsr     ldaxi
+	txa
+	bpl     L001D
+L001E:	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	bcc     L0021
+	ldx     #$00
+	txa
+	jmp     L0001
+L0021:	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	jne     L0052
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cpx     #$00
+	jne     L0052
+	cmp     #$00
+	beq     L0026
+	cmp     #$01
+	beq     L004E
+	cmp     #$02
+	beq     L004E
+	cmp     #$03
+	jeq     L0035
+	jmp     L0052
+L0026:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L0028
+	inc     _yynerrs+1
+L0028:	ldx     #$00
+L004E:	lda     #$03
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	jmp     L002D
+L002B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	clc
+	lda     ptr1
+	pha
+	lda     #$01
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxysp
+	txa
+	bmi     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0030
+	eor     #$80
+L0030:	bpl     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$01
+	bne     L002E
+	cmp     #$00
+	bne     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jmp     L004C
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+L002D:	ldy     #$09
+	jsr     pushwysp
+	lda     #$12
+	jsr     leaa0sp
+	jsr     tosicmp
+	jcs     L002B
+	ldx     #$00
+L0051:	lda     #$01
+	jmp     L0001
+L0035:	lda     _yychar
+	ora     _yychar+1
+	beq     L0051
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	jmp     L0004
+L0052:	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	sta     _yyval
+	stx     _yyval+1
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr1)
+	tay
+	txa
+	adc     #>(_yyr1)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	jsr     incax1
+	ldy     #$0E
+	jsr     staxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L0039
+	eor     #$80
+L0039:	bmi     L0053
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosicmp
+	beq     L0038
+L0053:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+L0038:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0002
+	cmp     #$04
+	beq     L0054
+	cmp     #$05
+	beq     L003F
+	cmp     #$06
+	beq     L0040
+	cmp     #$07
+	beq     L0041
+	cmp     #$08
+	beq     L0042
+	cmp     #$09
+	beq     L0043
+	cmp     #$0A
+	beq     L0044
+	cmp     #$0C
+	beq     L0045
+	cmp     #$0D
+	beq     L0046
+	cmp     #$0E
+	jeq     L0047
+	jmp     L0002
+L0054:	txa
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	jmp     L0002
+L003F:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0040:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0041:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0042:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0043:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0044:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0045:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0046:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L0047:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L0001:	ldy     #$74
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+	bne     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	ldx     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+	bne     L0006
+	inc     _yylineno
+	bne     L0006
+	inc     _yylineno+1
+L0006:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L000A
+	lda     _yytchar
+	cmp     #$FF
+	bne     L000A
+	ldx     #$00
+	txa
+	jmp     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+	rts
+L000B:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L000A
+	jmp     L000B
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$00
+	cmp     (c_sp),y
+	bne     L0008
+	txa
+	iny
+	cmp     (c_sp),y
+L0008:	jsr     booleq
+	php
+	ldy     #$02
+	tya
+	jsr     addeqysp
+	plp
+	beq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0007:	ldy     #$03
+L000A:	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	bne     L0004
+L000B:	tax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jmp     L0007
+L0002:	jsr     ldax0sp
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0008
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L0007
+	cmp     #$04
+	beq     L0012
+	jmp     L000F
+L0010:	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+	beq     L0007
+	jmp     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	jmp     L0013
+L000A:	inx
+	jmp     incsp2
+L000B:	inx
+	jmp     incsp2
+L0012:	lda     _yytext
+	jmp     incsp2
+L000F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+L0007:	jsr     _yylook
+	jsr     stax0sp
+	txa
+	bpl     L0002
+L0013:	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
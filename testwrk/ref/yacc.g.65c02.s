@@ -0,0 +1,3622 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "yacc.c", 28911, 1779181050
+	.dbg		file, "common.h", 522, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/ctype.h", 4485, 1779181050
+	.forceimport	__STARTUP__
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0000
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0001:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0009:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0003:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S0011:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0006:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S000A:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S0010:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S000F:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S000E:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S000D:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S000B	:=	S000C+6
+S0007:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S0012	:=	S0007+0
+S0005:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+	.dbg	func, "yylook", "00", static, "_yylook"
+	.dbg	sym, "yystate", "00", auto, -2
+	.dbg	sym, "lsp", "00", auto, -4
+	.dbg	sym, "yyt", "00", auto, -6
+	.dbg	sym, "yyz", "00", auto, -8
+	.dbg	sym, "yych", "00", auto, -10
+	.dbg	sym, "yyr", "00", auto, -12
+	.dbg	sym, "yylastch", "00", auto, -14
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 380
+	ldy     #$0E
+	jsr     subysp
+	lda     _yymorfg
+	ldx     _yymorfg+1
+	jsr     bnegax
+	jeq     L0002
+	.dbg	line, "yacc.c", 381
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "yacc.c", 382
+	jmp     L0003
+	.dbg	line, "yacc.c", 384
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _yymorfg
+	stx     _yymorfg+1
+	.dbg	line, "yacc.c", 385
+	lda     _yyleng
+	ldx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	tay
+	txa
+	adc     #>(_yytext)
+	tax
+	tya
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "yacc.c", 392
+L0003:	jmp     L0007
+L0006:	jmp     L0003
+	.dbg	line, "yacc.c", 398
+L0007:	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "yacc.c", 399
+	lda     _yybgin
+	ldx     _yybgin+1
+	ldy     #$0C
+	jsr     staxysp
+	sta     _yyestate
+	stx     _yyestate+1
+	.dbg	line, "yacc.c", 400
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$0A
+L0009:	jsr     booleq
+	jeq     L0008
+	ldy     #$0C
+	ldx     #$00
+	lda     #$06
+	jsr     addeqysp
+	.dbg	line, "yacc.c", 402
+L0008:	ldx     #$00
+	lda     #$00
+	sta     _testbreak
+	.dbg	line, "yacc.c", 404
+L000A:	jmp     L000D
+L000C:	jmp     L000A
+	.dbg	line, "yacc.c", 409
+L000D:	ldx     #$00
+	lda     _testbreak
+	cmp     #$05
+	jsr     booleq
+	jeq     L000E
+	.dbg	line, "yacc.c", 411
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "yacc.c", 412
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "yacc.c", 414
+L000E:	ldx     #$00
+	lda     _testbreak
+	inc     _testbreak
+	.dbg	line, "yacc.c", 416
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 421
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     toseqax
+	jeq     L0012
+	.dbg	line, "yacc.c", 423
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "yacc.c", 424
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+L0011:	jsr     booleq
+	jeq     L0010
+	jmp     L000B
+	.dbg	line, "yacc.c", 425
+L0010:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     toseqax
+	jeq     L0012
+	jmp     L000B
+	.dbg	line, "yacc.c", 427
+L0012:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jeq     L0013
+	lda     _yysptr
+	bne     L0014
+	dec     _yysptr+1
+L0014:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0015
+L0013:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0015:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0016
+	cmp     #$0A
+L0016:	jsr     booleq
+	jeq     L0017
+	inc     _yylineno
+	bne     L0018
+	inc     _yylineno+1
+L0018:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0019
+L0017:	lda     _yytchar
+	ldx     _yytchar+1
+L0019:	cpx     #$FF
+	bne     L001A
+	cmp     #$FF
+L001A:	jsr     booleq
+	jeq     L001B
+	ldx     #$00
+	lda     #$00
+	jmp     L001C
+L001B:	lda     _yytchar
+	ldx     _yytchar+1
+L001C:	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "yacc.c", 440
+L001D:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "yacc.c", 444
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosugtax
+	jeq     L001E
+	.dbg	line, "yacc.c", 446
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 447
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L0020
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L0021
+L0020:	ldx     #$00
+	lda     #$00
+	jeq     L0022
+L0021:	ldx     #$00
+	lda     #$01
+L0022:	jeq     L001F
+	.dbg	line, "yacc.c", 449
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L0023
+	.dbg	line, "yacc.c", 455
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0025
+	cmp     #$0A
+L0025:	jsr     booleq
+	jeq     L0024
+	lda     _yylineno
+	bne     L0026
+	dec     _yylineno+1
+L0026:	dec     _yylineno
+L0024:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0027
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 456
+L0027:	jmp     L000B
+	.dbg	line, "yacc.c", 458
+L0023:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "yacc.c", 462
+	pha
+	lda     M0002
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0002+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+	.dbg	line, "yacc.c", 469
+L001F:	jmp     L0034
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosultax
+	jeq     L0034
+	.dbg	line, "yacc.c", 471
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	jsr     aslax1
+	clc
+	adc     #<(_yycrank)
+	tay
+	txa
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 475
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 476
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L002C
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L002D
+L002C:	ldx     #$00
+	lda     #$00
+	jeq     L002E
+L002D:	ldx     #$00
+	lda     #$01
+L002E:	jeq     L002B
+	.dbg	line, "yacc.c", 481
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L002F
+	.dbg	line, "yacc.c", 487
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0031
+	cmp     #$0A
+L0031:	jsr     booleq
+	jeq     L0030
+	lda     _yylineno
+	bne     L0032
+	dec     _yylineno+1
+L0032:	dec     _yylineno
+L0030:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0033
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 488
+L0033:	jmp     L000B
+	.dbg	line, "yacc.c", 490
+L002F:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "yacc.c", 494
+	pha
+	lda     M0003
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0003+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+	.dbg	line, "yacc.c", 504
+L002B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	adc     #<(_yymatch)
+	tay
+	txa
+	adc     #>(_yymatch)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 512
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yytop
+	ldx     _yytop+1
+	jsr     tosuleax
+	jeq     L0035
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jne     L0036
+L0035:	ldx     #$00
+	lda     #$00
+	jeq     L0037
+L0036:	ldx     #$00
+	lda     #$01
+L0037:	jeq     L0034
+	.dbg	line, "yacc.c", 518
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     toseqax
+	jeq     L0038
+	.dbg	line, "yacc.c", 525
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L003A
+	cmp     #$0A
+L003A:	jsr     booleq
+	jeq     L0039
+	lda     _yylineno
+	bne     L003B
+	dec     _yylineno+1
+L003B:	dec     _yylineno
+L0039:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L003C
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 526
+L003C:	jmp     L000B
+	.dbg	line, "yacc.c", 528
+L0038:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     mulax6
+	jsr     pushax
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     tosaddax
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "yacc.c", 533
+	pha
+	lda     M0004
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0004+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0041
+	.dbg	line, "yacc.c", 540
+L0034:	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$0C
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	jeq     L003E
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     tosneax
+	jne     L003F
+L003E:	ldx     #$00
+	lda     #$00
+	jeq     L0040
+L003F:	ldx     #$00
+	lda     #$01
+L0040:	jeq     L003D
+	.dbg	line, "yacc.c", 545
+	jmp     L001D
+	.dbg	line, "yacc.c", 548
+	jmp     L0041
+	.dbg	line, "yacc.c", 554
+L003D:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0043
+	cmp     #$0A
+L0043:	jsr     booleq
+	jeq     L0042
+	lda     _yylineno
+	bne     L0044
+	dec     _yylineno+1
+L0044:	dec     _yylineno
+L0042:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0045
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 555
+L0045:	jmp     L000B
+	.dbg	line, "yacc.c", 562
+L0041:	jmp     L000C
+	.dbg	line, "yacc.c", 574
+L000B:	jmp     L0060
+	.dbg	line, "yacc.c", 576
+L0046:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 577
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L004A
+	cmp     #$00
+L004A:	jsr     boolne
+	jeq     L004B
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$05
+	jsr     ldaxidx
+	sta     _yyfnd
+	stx     _yyfnd+1
+	stx     tmp1
+	ora     tmp1
+	jeq     L004B
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L004C
+	eor     #$80
+L004C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L004D
+L004B:	ldx     #$00
+	lda     #$00
+	jeq     L004E
+L004D:	ldx     #$00
+	lda     #$01
+L004E:	jeq     L0049
+	.dbg	line, "yacc.c", 579
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yyolsp
+	stx     _yyolsp+1
+	.dbg	line, "yacc.c", 580
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	clc
+	adc     #<(_yyextra)
+	tay
+	txa
+	adc     #>(_yyextra)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jeq     L0051
+	.dbg	line, "yacc.c", 582
+	jmp     L005A
+	.dbg	line, "yacc.c", 584
+L0050:	ldx     #$00
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 589
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0058
+	cmp     #$0A
+L0058:	jsr     booleq
+	jeq     L0057
+	lda     _yylineno
+	bne     L0059
+	dec     _yylineno+1
+L0059:	dec     _yylineno
+L0057:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L005A
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 582
+L005A:	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L0053
+	cmp     #$01
+L0053:	jsr     boolne
+	jeq     L0054
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	jsr     tosugtax
+	jne     L0055
+L0054:	ldx     #$00
+	lda     #$00
+	jeq     L0056
+L0055:	ldx     #$00
+	lda     #$01
+L0056:	jne     L0050
+	.dbg	line, "yacc.c", 592
+L0051:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yyprevious
+	stx     _yyprevious+1
+	.dbg	line, "yacc.c", 593
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yylsp
+	stx     _yylsp+1
+	.dbg	line, "yacc.c", 594
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     tossubax
+	ina
+	bne     L005B
+	inx
+L005B:	sta     _yyleng
+	stx     _yyleng+1
+	.dbg	line, "yacc.c", 595
+	lda     _yyleng
+	ldx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	tay
+	txa
+	adc     #>(_yytext)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "yacc.c", 600
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L005C
+	inc     _yyfnd+1
+L005C:	lda     regsave
+	ldx     regsave+1
+	jmp     L0005
+	.dbg	line, "yacc.c", 602
+L0049:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L005E
+	cmp     #$0A
+L005E:	jsr     booleq
+	jeq     L005D
+	lda     _yylineno
+	bne     L005F
+	dec     _yylineno+1
+L005F:	dec     _yylineno
+L005D:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0060
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 574
+L0060:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	jsr     tosugtax
+	php
+	ldx     #$00
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	plp
+	jne     L0046
+	.dbg	line, "yacc.c", 604
+	ldx     #$00
+	lda     _yytext
+	cmp     #$00
+	jsr     booleq
+	jeq     L0061
+	.dbg	line, "yacc.c", 606
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	sta     _yysptr
+	stx     _yysptr+1
+	.dbg	line, "yacc.c", 610
+	ldx     #$00
+	lda     #$00
+	jmp     L0005
+	.dbg	line, "yacc.c", 612
+L0061:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	jeq     L0062
+	lda     _yysptr
+	bne     L0063
+	dec     _yysptr+1
+L0063:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0064
+L0062:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0064:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0065
+	cmp     #$0A
+L0065:	jsr     booleq
+	jeq     L0066
+	inc     _yylineno
+	bne     L0067
+	inc     _yylineno+1
+L0067:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0068
+L0066:	lda     _yytchar
+	ldx     _yytchar+1
+L0068:	cpx     #$FF
+	bne     L0069
+	cmp     #$FF
+L0069:	jsr     booleq
+	jeq     L006A
+	ldx     #$00
+	lda     #$00
+	jmp     L006B
+L006A:	lda     _yytchar
+	ldx     _yytchar+1
+L006B:	ldx     #$00
+	sta     _yytext
+	sta     _yyprevious
+	stx     _yyprevious+1
+	.dbg	line, "yacc.c", 619
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L006D
+	eor     #$80
+L006D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L006C
+	.dbg	line, "yacc.c", 620
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	.dbg	line, "yacc.c", 621
+L006C:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "yacc.c", 625
+	jmp     L0006
+	.dbg	line, "yacc.c", 631
+L0005:	ldy     #$0E
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+	.dbg	func, "yywrap", "00", static, "_yywrap"
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 1005
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 1006
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+	.dbg	func, "yyparse", "00", static, "_yyparse"
+	.dbg	sym, "yys", "00", auto, -100
+	.dbg	sym, "yyj", "00", auto, -102
+	.dbg	sym, "yym", "00", auto, -104
+	.dbg	sym, "yypvt", "00", auto, -106
+	.dbg	sym, "yystate", "00", auto, -108
+	.dbg	sym, "yyps", "00", auto, -110
+	.dbg	sym, "yyn", "00", auto, -112
+	.dbg	sym, "yypv", "00", auto, -114
+	.dbg	sym, "yyxi", "00", auto, -116
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 786
+	ldy     #$74
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 787
+	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	.dbg	line, "yacc.c", 788
+	ldx     #$00
+	lda     #$00
+	sta     _yynerrs
+	stx     _yynerrs+1
+	.dbg	line, "yacc.c", 789
+	ldx     #$00
+	lda     #$00
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	.dbg	line, "yacc.c", 790
+	lda     #$0E
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "yacc.c", 791
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "yacc.c", 802
+L0002:	ldy     #$06
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tosugtax
+	jeq     L0003
+	.dbg	line, "yacc.c", 804
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _yyerror
+	.dbg	line, "yacc.c", 805
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 807
+L0003:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "yacc.c", 808
+	ldy     #$02
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	.dbg	line, "yacc.c", 809
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _yyval
+	ldx     _yyval+1
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "yacc.c", 816
+L0004:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "yacc.c", 818
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	pha
+	lda     M0003
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0003+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000E
+	.dbg	line, "yacc.c", 824
+L0005:	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	ldx     #$00
+	lda     #$00
+	sta     _yychar
+	stx     _yychar+1
+	.dbg	line, "yacc.c", 832
+L0009:	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000B
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000B
+	ldx     #$00
+	lda     #$00
+	jeq     L000D
+L000B:	ldx     #$00
+	lda     #$01
+L000D:	jeq     L000A
+	pha
+	lda     M0004
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0004+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000E
+	.dbg	line, "yacc.c", 838
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     toseqax
+	jeq     L000E
+	.dbg	line, "yacc.c", 840
+	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	.dbg	line, "yacc.c", 841
+	lda     _yylval
+	ldx     _yylval+1
+	sta     _yyval
+	stx     _yyval+1
+	.dbg	line, "yacc.c", 842
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 848
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	lda     _yyerrflag
+	bne     L0011
+	dec     _yyerrflag+1
+L0011:	dea
+	sta     _yyerrflag
+	ldx     _yyerrflag+1
+	.dbg	line, "yacc.c", 849
+L000F:	jmp     L0002
+	.dbg	line, "yacc.c", 858
+L000E:	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yydef)
+	tay
+	txa
+	adc     #>(_yydef)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	bne     L0013
+	cmp     #$FE
+L0013:	jsr     booleq
+	jeq     L0021
+	.dbg	line, "yacc.c", 860
+	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0015
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0015
+	ldx     #$00
+	lda     #$00
+	sta     _yychar
+	stx     _yychar+1
+	.dbg	line, "yacc.c", 863
+L0015:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	ldy     #$00
+	jsr     staxysp
+L0016:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$FF
+	bne     L001A
+	cmp     #$FF
+L001A:	jsr     boolne
+	jne     L001B
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L001B
+	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001B:	ldx     #$00
+	lda     #$01
+L001C:	jne     L0018
+	jmp     L0017
+L0018:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	jmp     L0016
+	.dbg	line, "yacc.c", 865
+L0017:	jmp     L0020
+	.dbg	line, "yacc.c", 867
+L001D:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     toseqax
+	jeq     L0020
+	jmp     L001E
+	.dbg	line, "yacc.c", 865
+L0020:	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxidx
+	txa
+	jsr     boolge
+	jne     L001D
+	.dbg	line, "yacc.c", 869
+L001E:	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0021
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 876
+L0021:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0023
+	cmp     #$00
+L0023:	jsr     booleq
+	jeq     L0025
+	.dbg	line, "yacc.c", 880
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	jmp     L0024
+	.dbg	line, "yacc.c", 927
+L0024:	cpx     #$00
+	jne     L0025
+	cmp     #$00
+	jeq     L0026
+	cmp     #$01
+	jeq     L0029
+	cmp     #$02
+	jeq     L0029
+	cmp     #$03
+	jeq     L0035
+	jmp     L0025
+	jmp     L0025
+	.dbg	line, "yacc.c", 883
+L0026:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _yyerror
+	.dbg	line, "yacc.c", 885
+	inc     _yynerrs
+	bne     L0028
+	inc     _yynerrs+1
+L0028:	lda     _yynerrs
+	ldx     _yynerrs+1
+	.dbg	line, "yacc.c", 890
+L0029:	ldx     #$00
+	lda     #$03
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	.dbg	line, "yacc.c", 894
+	jmp     L002D
+	.dbg	line, "yacc.c", 895
+L002B:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "yacc.c", 896
+	ldy     #$05
+	jsr     ldaxysp
+	txa
+	jsr     boolge
+	jeq     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0030
+	eor     #$80
+L0030:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L002F
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$01
+	bne     L0031
+	cmp     #$00
+L0031:	jsr     booleq
+	jne     L0032
+L002F:	ldx     #$00
+	lda     #$00
+	jeq     L0033
+L0032:	ldx     #$00
+	lda     #$01
+L0033:	jeq     L002E
+	.dbg	line, "yacc.c", 897
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 898
+	jmp     L0002
+	.dbg	line, "yacc.c", 900
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "yacc.c", 907
+	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 908
+	ldx     #$00
+	lda     #$02
+	ldy     #$02
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 894
+L002D:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$12
+	jsr     leaa0sp
+	jsr     tosugeax
+	jne     L002B
+	.dbg	line, "yacc.c", 914
+L002C:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 923
+L0035:	lda     _yychar
+	ldx     _yychar+1
+	cpx     #$00
+	bne     L0037
+	cmp     #$00
+L0037:	jsr     booleq
+	jeq     L0036
+	jmp     L002C
+	.dbg	line, "yacc.c", 924
+L0036:	ldx     #$FF
+	lda     #$FF
+	sta     _yychar
+	stx     _yychar+1
+	.dbg	line, "yacc.c", 925
+	jmp     L0004
+	.dbg	line, "yacc.c", 936
+L0025:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 937
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "yacc.c", 938
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	ldy     #$02
+	jsr     subeqysp
+	.dbg	line, "yacc.c", 939
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$01
+	jsr     ldaxidx
+	sta     _yyval
+	stx     _yyval+1
+	.dbg	line, "yacc.c", 940
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "yacc.c", 942
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr1)
+	tay
+	txa
+	adc     #>(_yyr1)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "yacc.c", 943
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	ina
+	bne     L0038
+	inx
+L0038:	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "yacc.c", 944
+	ldy     #$0F
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L003A
+	eor     #$80
+L003A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L003B
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosneax
+	jne     L003B
+	ldx     #$00
+	lda     #$00
+	jeq     L003C
+L003B:	ldx     #$00
+	lda     #$01
+L003C:	jeq     L0039
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "yacc.c", 946
+L0039:	ldy     #$0D
+	jsr     ldaxysp
+	.dbg	line, "yacc.c", 947
+	jmp     L003D
+	.dbg	line, "yacc.c", 998
+L003D:	cpx     #$00
+	jne     L003E
+	cmp     #$04
+	jeq     L003F
+	cmp     #$05
+	jeq     L0040
+	cmp     #$06
+	jeq     L0041
+	cmp     #$07
+	jeq     L0042
+	cmp     #$08
+	jeq     L0043
+	cmp     #$09
+	jeq     L0044
+	cmp     #$0A
+	jeq     L0045
+	cmp     #$0C
+	jeq     L0046
+	cmp     #$0D
+	jeq     L0047
+	cmp     #$0E
+	jeq     L0048
+	jmp     L003E
+	jmp     L003E
+	.dbg	line, "yacc.c", 950
+L003F:	ldx     #$00
+	lda     #$00
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	.dbg	line, "yacc.c", 952
+	jmp     L003E
+	.dbg	line, "yacc.c", 955
+L0040:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 957
+	jmp     L003E
+	.dbg	line, "yacc.c", 960
+L0041:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 962
+	jmp     L003E
+	.dbg	line, "yacc.c", 965
+L0042:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 967
+	jmp     L003E
+	.dbg	line, "yacc.c", 970
+L0043:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 972
+	jmp     L003E
+	.dbg	line, "yacc.c", 975
+L0044:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 977
+	jmp     L003E
+	.dbg	line, "yacc.c", 980
+L0045:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 982
+	jmp     L003E
+	.dbg	line, "yacc.c", 985
+L0046:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 987
+	jmp     L003E
+	.dbg	line, "yacc.c", 990
+L0047:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "yacc.c", 992
+	jmp     L003E
+	.dbg	line, "yacc.c", 995
+L0048:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "yacc.c", 997
+	jmp     L003E
+	.dbg	line, "yacc.c", 1000
+L003E:	jmp     L0002
+	.dbg	line, "yacc.c", 1001
+L0001:	ldy     #$74
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+	.dbg	func, "yyerror", "00", static, "_yyerror"
+	.dbg	sym, "s", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 686
+	jsr     pushax
+	.dbg	line, "yacc.c", 687
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "yacc.c", 688
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+	.dbg	func, "yyunput", "00", static, "_yyunput"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 665
+	jsr     pushax
+	.dbg	line, "yacc.c", 666
+	ldy     #$01
+	jsr     ldaxysp
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     _yytchar
+	ldx     _yytchar+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$0A
+L0003:	jsr     booleq
+	jeq     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	jsr     staspidx
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+	.dbg	line, "yacc.c", 667
+L0005:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+	.dbg	func, "yyoutput", "00", static, "_yyoutput"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 660
+	jsr     pushax
+	.dbg	line, "yacc.c", 661
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	.dbg	line, "yacc.c", 662
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+	.dbg	func, "yyinput", "00", static, "_yyinput"
+	.dbg	sym, "out", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 650
+	lda     _yysptr
+	ldx     _yysptr+1
+	jsr     pushax
+	lda     #<(_yysbuf)
+	ldx     #>(_yysbuf)
+	jsr     tosugtax
+	jeq     L0002
+	lda     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$0A
+L0005:	jsr     booleq
+	jeq     L0006
+	inc     _yylineno
+	bne     L0007
+	inc     _yylineno+1
+L0007:	lda     _yytchar
+	ldx     _yytchar+1
+	jmp     L0008
+L0006:	lda     _yytchar
+	ldx     _yytchar+1
+L0008:	cpx     #$FF
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     booleq
+	jeq     L000A
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+L000B:	jsr     pushax
+	.dbg	line, "yacc.c", 656
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "yacc.c", 657
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+	.dbg	func, "yyback", "00", static, "_yyback"
+	.dbg	sym, "p", "00", auto, 2
+	.dbg	sym, "m", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 636
+	jsr     pushax
+	.dbg	line, "yacc.c", 637
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 638
+L0002:	jmp     L0007
+	.dbg	line, "yacc.c", 640
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     toseqax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	plp
+	jeq     L0007
+	.dbg	line, "yacc.c", 642
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 638
+L0007:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jne     L0004
+	.dbg	line, "yacc.c", 645
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 646
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+	.dbg	func, "yylex", "00", static, "_yylex"
+	.dbg	sym, "nstr", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 123
+	jsr     decsp2
+	jmp     L0007
+	.dbg	line, "yacc.c", 129
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	.dbg	line, "yacc.c", 130
+	jmp     L0006
+	.dbg	line, "yacc.c", 150
+L0006:	cpx     #$00
+	jne     L0010
+	cmp     #$00
+	jeq     L0008
+	cmp     #$01
+	jeq     L000A
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000C
+	cmp     #$04
+	jeq     L000D
+	jmp     L000F
+L0010:	cpx     #$FF
+	jne     L000F
+	cmp     #$FF
+	jeq     L000E
+	jmp     L000F
+	jmp     L000F
+	.dbg	line, "yacc.c", 132
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	jeq     L0009
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 133
+L0009:	jmp     L0007
+	.dbg	line, "yacc.c", 135
+L000A:	ldx     #$01
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 136
+	jmp     L0007
+	.dbg	line, "yacc.c", 138
+L000B:	ldx     #$01
+	lda     #$02
+	jmp     L0001
+	.dbg	line, "yacc.c", 139
+	jmp     L0007
+	.dbg	line, "yacc.c", 142
+L000C:	jmp     L0007
+	.dbg	line, "yacc.c", 144
+L000D:	ldx     #$00
+	lda     _yytext
+	jmp     L0001
+	.dbg	line, "yacc.c", 145
+	jmp     L0007
+	.dbg	line, "yacc.c", 147
+L000E:	jmp     L0007
+	.dbg	line, "yacc.c", 149
+L000F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "yacc.c", 150
+	jmp     L0007
+	.dbg	line, "yacc.c", 123
+L0007:	jsr     _yylook
+	ldy     #$00
+	jsr     staxysp
+	txa
+	jsr     boolge
+	jne     L0002
+	.dbg	line, "yacc.c", 157
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 158
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "yacc.c", 671
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 672
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	.dbg	line, "yacc.c", 673
+	lda     _infile
+	ldx     _infile+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "yacc.c", 674
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "yacc.c", 676
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	.dbg	line, "yacc.c", 677
+	jsr     _yyparse
+	.dbg	line, "yacc.c", 678
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	.dbg	line, "yacc.c", 679
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "yacc.c", 680
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "yacc.c", 681
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,716 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_yycrank
+	.export		_yytop
+	.export		_yyvstop
+	.export		_yysvec
+	.export		_subtest2
+	.export		_subtest3
+	.export		_yyr2
+	.export		_subtest4
+	.export		_yylookret
+	.export		_yylook
+	.export		_subtest5
+	.export		_main
+
+.segment	"DATA"
+
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yytop:
+	.addr	_yycrank+510
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_bog:
+	.word	$04D2
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yylookret:
+	.word	$000A
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$69,$66,$20,$6E,$6F,$74,$20,$6F,$6B,$20,$25,$64,$20,$25,$64,$0A
+	.byte	$00
+S0002:
+	.byte	$69,$66,$20,$6F,$6B,$20,$25,$64,$20,$25,$64,$0A,$00
+S0004:
+	.byte	$79,$79,$70,$73,$3A,$20,$25,$30,$34,$78,$0A,$00
+S0005:
+	.byte	$6E,$73,$74,$72,$3A,$20,$25,$30,$34,$78,$0A,$00
+S0001:
+	.byte	$79,$79,$74,$3A,$20,$25,$64,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ subtest2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest2: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	ldy     #$02
+	jsr     staxysp
+	lda     #$0A
+	sta     (c_sp)
+	lda     #$00
+	ldy     #$01
+	sta     (c_sp),y
+	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	iny
+	adc     (c_sp),y
+	pha
+	lda     tmp1
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest3: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     stax0sp
+	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0009
+	bcs     L0002
+L0009:	iny
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cmp     (c_sp)
+	bne     L0002
+	txa
+	dey
+	cmp     (c_sp),y
+	bne     L0002
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	bra     L001C
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+L001C:	jsr     pushax
+	ldy     #$05
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest4: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$02
+	lda     #$04
+	sta     (c_sp),y
+	lda     #$80
+	iny
+	sta     (c_sp),y
+	lda     #$00
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+	bra     L0006
+L0002:	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr2)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr2)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	lda     (ptr1)
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	iny
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0006:	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$0E
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	bmi     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	lda     _yylookret
+	bne     L0002
+	dec     _yylookret+1
+L0002:	dec     _yylookret
+	lda     _yylookret
+	ldx     _yylookret+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ subtest5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_subtest5: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	bra     L000C
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L000C:	lda     #$34
+	clc
+	adc     _bog
+	sta     _bog
+	lda     #$12
+	adc     _bog+1
+	sta     _bog+1
+	jsr     _yylook
+	jsr     stax0sp
+	txa
+	bpl     L0002
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _subtest2
+	jsr     _subtest3
+	jsr     _subtest4
+	jsr     _subtest5
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
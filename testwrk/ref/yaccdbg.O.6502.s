@@ -0,0 +1,3806 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.import		_isprint
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_printchar
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0001
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0043:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$65,$72,$72,$6F,$72,$20,$72
+	.byte	$65,$63,$6F,$76,$65,$72,$79,$20,$70,$6F,$70,$73,$20,$73,$74,$61
+	.byte	$74,$65,$20,$25,$64,$2C,$20,$75,$6E,$63,$6F,$76,$65,$72,$73,$20
+	.byte	$25,$64,$0A,$00
+S000D:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0044:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$65,$72,$72,$6F,$72,$20,$72
+	.byte	$65,$63,$6F,$76,$65,$72,$79,$20,$64,$69,$73,$63,$61,$72,$64,$73
+	.byte	$20,$63,$68,$61,$72,$20,$00
+S001A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$74,$72,$79,$20,$66,$61
+	.byte	$6C,$6C,$20,$62,$61,$63,$6B,$20,$63,$68,$61,$72,$61,$63,$74,$65
+	.byte	$72,$0A,$00
+S0020:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$66,$61,$6C,$6C,$20,$62
+	.byte	$61,$63,$6B,$20,$74,$6F,$20,$73,$74,$61,$74,$65,$20,$25,$64,$0A
+	.byte	$00
+S000C:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$69,$6E,$6E,$65,$72
+	.byte	$20,$6C,$6F,$6F,$70,$29,$20,$73,$74,$61,$74,$65,$20,$25,$64,$0A
+	.byte	$00
+S0040:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$20,$79,$79,$73,$74,$61,$74,$65,$3D,$25,$64,$0A,$00
+S0025:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$73,$74,$6F,$70,$70,$65,$64
+	.byte	$20,$61,$74,$20,$25,$64,$20,$77,$69,$74,$68,$3A,$0A,$00
+S0041:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$3D,$25,$64,$20
+	.byte	$79,$79,$65,$72,$72,$66,$6C,$61,$67,$3D,$25,$64,$0A,$00
+S0006:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0039:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0014:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$20,$79,$79,$74,$20
+	.byte	$3E,$20,$79,$79,$63,$72,$61,$6E,$6B,$29,$0A,$00
+S0015:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6D,$70,$72,$65
+	.byte	$73,$73,$65,$64,$20,$73,$74,$61,$74,$65,$0A,$00
+S003C:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$79,$79,$6E,$3D,$25,$64,$20,$00
+S0023:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$20,$73,$74,$61,$74,$65,$3D,$25,$64,$0A,$00
+S0028:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$6D,$61,$74,$63,$68,$20,$61
+	.byte	$63,$74,$69,$6F,$6E,$20,$25,$64,$0A,$00
+S002A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$64,$6F,$6E,$65,$20,$6C,$6F
+	.byte	$6F,$70,$73,$3A,$20,$25,$64,$0A,$00
+S003F:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$33,$29,$0A,$00
+S003B:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$31,$29,$0A,$00
+S0029	:=	S002A+0
+S003E:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$32,$29,$0A,$00
+S001E:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$33,$29,$0A,$00
+S0019:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$32,$29,$0A,$00
+S002D:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$64,$6F,$6E,$65,$20,$6C,$6F,$6F
+	.byte	$70,$73,$3A,$20,$25,$64,$0A,$00
+S0024:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$73,$74,$6F,$70,$70,$65,$64
+	.byte	$20,$28,$65,$6E,$64,$29,$0A,$00
+S0013:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$31,$29,$0A,$00
+S002E:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$72,$65,$74,$75,$72,$6E,$20,$3C
+	.byte	$76,$6F,$69,$64,$3E,$0A,$00
+S0037:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$73,$74,$61,$74,$65
+	.byte	$3D,$25,$64,$2C,$20,$00
+S0042:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$28,$6F,$75,$74,$65,$72,$20
+	.byte	$6C,$6F,$6F,$70,$29,$00
+S001C:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$33,$29,$20,$00
+S0017:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$32,$29,$20,$00
+S0011:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$31,$29,$20,$00
+S0021:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$34,$29,$20,$00
+S003A:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$0A,$00
+S0026:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$35,$29,$20,$00
+S0010:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$74,$72,$79,$61,$67,$61
+	.byte	$69,$6E,$0A,$00
+S0046:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$72,$65,$64,$75,$63,$65,$20
+	.byte	$25,$64,$0A,$00
+S0009:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$79,$79,$6D,$6F,$72,$66,$67,$3D
+	.byte	$25,$64,$0A,$00
+S0036:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$73,$74,$61,$63,$6B
+	.byte	$0A,$00
+S002F:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$69,$6E,$70,$75,$74,$20
+	.byte	$00
+S002B	:=	S002F+0
+S0007:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$72,$65,$74,$75,$72,$6E,$20,$30,$0A
+	.byte	$00
+S000E	:=	S002F+0
+S001B:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$32,$61,$29,$0A,$00
+S0005:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$6E,$73,$74,$72,$3D,$25,$64,$0A,$00
+S0001:
+	.byte	$20,$25,$73,$3D,$59,$59,$4E,$45,$57,$4C,$49,$4E,$45,$0A,$00
+S0016:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$31,$29,$0A,$00
+S001F:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$32,$29,$0A,$00
+S0049:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0031:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S002C:
+	.byte	$79,$79,$70,$72,$65,$76,$69,$6F,$75,$73,$00
+S000B	:=	S002C+0
+S004E:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0022:
+	.byte	$2A,$79,$79,$6C,$61,$73,$74,$63,$68,$00
+S001D	:=	S0022+0
+S0003:
+	.byte	$20,$25,$73,$3D,$27,$25,$63,$27,$0A,$00
+S0018	:=	S0022+0
+S0002:
+	.byte	$20,$25,$73,$3D,$25,$30,$34,$78,$0A,$00
+S0012	:=	S0022+0
+S0034:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S0027	:=	S0022+0
+S0008:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$28,$29,$0A,$00
+S0047:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$79,$6C,$65,$78,$28,$29,$0A,$00
+S0032:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S004D:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S004B:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S004A:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S0048	:=	S0049+6
+S004C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S003D:
+	.byte	$79,$79,$63,$68,$61,$72,$00
+S0045	:=	S003D+0
+S0038	:=	S003D+0
+S0035:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S004F	:=	S0035+0
+S000F:
+	.byte	$79,$79,$63,$68,$00
+S0030:
+	.byte	$6F,$75,$74,$00
+S0033:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	ldy     #$0E
+	jsr     subysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     _yymorfg
+	ora     _yymorfg+1
+	bne     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jmp     L008C
+L0002:	lda     #$00
+	sta     _yymorfg
+	sta     _yymorfg+1
+	lda     _yyleng
+	clc
+	adc     #<(_yytext)
+	tay
+	lda     _yyleng+1
+	adc     #>(_yytext)
+	tax
+	tya
+L008C:	jsr     stax0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _yymorfg
+	ldx     _yymorfg+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+L0007:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     _printchar
+	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	ldy     #$0A
+	jsr     staxysp
+	lda     _yybgin
+	ldx     _yybgin+1
+	ldy     #$0C
+	jsr     staxysp
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious+1
+	bne     L0008
+	lda     _yyprevious
+	cmp     #$0A
+	bne     L0008
+	ldy     #$0C
+	ldx     #$00
+	lda     #$06
+	jsr     addeqysp
+L0008:	lda     #$00
+	sta     _testbreak
+L000D:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yysvec)
+	pha
+	txa
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	jsr     decax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	lda     _testbreak
+	cmp     #$05
+	bne     L0082
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0082:	inc     _testbreak
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	bne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0086
+	cmp     #$00
+	jeq     L000B
+L0086:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #>(_yycrank)
+	bne     L0012
+	cmp     #<(_yycrank)
+	jeq     L000B
+L0012:	jsr     pushw0sp
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	jsr     boolugt
+	php
+	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0013
+	ldx     _yysptr
+	bne     L0014
+	dec     _yysptr+1
+L0014:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0015
+L0013:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0015:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0017
+	cmp     #$0A
+	bne     L0017
+	inc     _yylineno
+	bne     L0017
+	inc     _yylineno+1
+L0017:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L001B
+	lda     _yytchar
+	cmp     #$FF
+	bne     L001B
+	ldx     #$00
+	txa
+	jmp     L001C
+L001B:	lda     _yytchar
+	ldx     _yytchar+1
+L001C:	ldy     #$06
+	jsr     staxysp
+	ldy     #$00
+	jsr     staspidx
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _printchar
+L001D:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yycrank)
+	sta     tmp1
+	txa
+	sbc     #>(_yycrank)
+	ora     tmp1
+	jcc     L001E
+	jeq     L001E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L007F
+	jcs     L001F
+L007F:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	jne     L001F
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L001F
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0023
+	cmp     #<(_yysvec)
+	bne     L0023
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0024
+	lda     _yylineno
+	bne     L0026
+	dec     _yylineno+1
+L0026:	dec     _yylineno
+L0024:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	jne     L000B
+	inc     _yysptr+1
+	jmp     L000B
+L0023:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L0041
+L001F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jmp     L008E
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	cmp     #<(_yycrank)
+	txa
+	sbc     #>(_yycrank)
+	jcs     L002A
+	lda     #<(_yycrank)
+	sec
+	ldy     #$08
+	sbc     (c_sp),y
+	pha
+	lda     #>(_yycrank)
+	iny
+	sbc     (c_sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     aslax1
+	clc
+	adc     #<(_yycrank)
+	tay
+	txa
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	ldy     #$08
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0080
+	jcs     L002B
+L0080:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	jne     L002B
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L002B
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L002F
+	cmp     #<(_yysvec)
+	bne     L002F
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0030
+	lda     _yylineno
+	bne     L0032
+	dec     _yylineno+1
+L0032:	dec     _yylineno
+L0030:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	jne     L000B
+	inc     _yysptr+1
+	jmp     L000B
+L002F:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L0041
+L002B:	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yymatch)
+	sta     ptr1+1
+	ldy     #<(_yymatch)
+	ldx     #$00
+	lda     (ptr1),y
+	asl     a
+	bcc     L007E
+	inx
+	clc
+L007E:	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	ldy     #$08
+	jsr     staxysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$09
+	jsr     ldaxysp
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0081
+	jcs     L0034
+L0081:	ldy     #$09
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0C
+	cmp     (c_sp),y
+	jne     L0034
+	txa
+	iny
+	cmp     (c_sp),y
+	jne     L0034
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$09
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0038
+	cmp     #<(_yysvec)
+	bne     L0038
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0039
+	lda     _yylineno
+	bne     L003B
+	dec     _yylineno+1
+L003B:	dec     _yylineno
+L0039:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	jne     L000B
+	inc     _yysptr+1
+	jmp     L000B
+L0038:	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldptr1ysp
+	ldy     #$01
+	ldx     #$00
+	lda     (ptr1),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$0A
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L0041
+L0034:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S001F)
+	ldx     #>(S001F)
+L008E:	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+L002A:	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$0C
+	jsr     staxysp
+	stx     tmp1
+	ora     tmp1
+	beq     L003D
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	cpx     #>(_yycrank)
+	bne     L003F
+	cmp     #<(_yycrank)
+	beq     L003D
+L003F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yysvec)
+	pha
+	txa
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	jsr     decax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L001D
+L003D:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L0042
+	lda     _yylineno
+	bne     L0044
+	dec     _yylineno+1
+L0044:	dec     _yylineno
+L0042:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L000B
+	inc     _yysptr+1
+	jmp     L000B
+L0041:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yysvec)
+	pha
+	txa
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	jsr     decax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L000D
+L000B:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #>(_yylstate)
+	bne     L0046
+	cmp     #<(_yylstate)
+	bne     L0046
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L0061
+L0046:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     decax2
+	jsr     ldaxi
+	sec
+	sbc     #<(_yysvec+6)
+	pha
+	txa
+	sbc     #>(_yysvec+6)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L0061
+L0048:	jsr     ldptr10sp
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	tax
+	lda     #$01
+	jsr     subeq0sp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #$00
+	bne     L008A
+	cmp     #$00
+	jeq     L004B
+L008A:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$05
+	jsr     ldaxidx
+	sta     _yyfnd
+	stx     _yyfnd+1
+	ora     _yyfnd+1
+	jeq     L004B
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L004E
+	eor     #$80
+L004E:	jpl     L004B
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yyolsp
+	stx     _yyolsp+1
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yyextra)
+	sta     ptr1+1
+	ldy     #<(_yyextra)
+	lda     (ptr1),y
+	jeq     L0053
+	jmp     L005C
+L0084:	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _printchar
+	jsr     ldptr10sp
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	lda     #$01
+	jsr     subeq0sp
+	lda     _yytchar+1
+	bne     L0059
+	lda     _yytchar
+	cmp     #$0A
+	bne     L0059
+	lda     _yylineno
+	bne     L005B
+	dec     _yylineno+1
+L005B:	dec     _yylineno
+L0059:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	ldy     #$00
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L005C
+	inc     _yysptr+1
+L005C:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$05
+	jsr     pushwidx
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L008B
+	cmp     #$01
+	beq     L0053
+L008B:	ldy     #$0B
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	beq     L0053
+	bcc     L0053
+	ldx     #$00
+	jmp     L0084
+L0053:	jsr     ldptr10sp
+	ldx     #$00
+	lda     (ptr1,x)
+	sta     _yyprevious
+	stx     _yyprevious+1
+	ldy     #$0B
+	jsr     ldaxysp
+	sta     _yylsp
+	stx     _yylsp+1
+	jsr     ldax0sp
+	sec
+	sbc     #<(_yytext)
+	pha
+	txa
+	sbc     #>(_yytext)
+	tax
+	pla
+	jsr     incax1
+	sta     _yyleng
+	stx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	sta     ptr1
+	txa
+	adc     #>(_yytext)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     pushw
+	ldy     #$06
+	jsr     _fprintf
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     _testbreak
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	lda     _yyfnd
+	ldx     _yyfnd+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L005D
+	inc     _yyfnd+1
+L005D:	lda     regsave
+	ldx     regsave+1
+	jmp     L0001
+L004B:	jsr     ldptr10sp
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	sta     _yytchar
+	stx     _yytchar+1
+	cmp     #$0A
+	bne     L005E
+	lda     _yylineno
+	bne     L0060
+	dec     _yylineno+1
+L0060:	dec     _yylineno
+L005E:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L0061
+	inc     _yysptr+1
+L0061:	ldy     #$0B
+	jsr     ldaxysp
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	txa
+	sbc     #>(_yylstate)
+	ora     tmp1
+	jsr     boolugt
+	php
+	lda     #$02
+	ldy     #$0A
+	jsr     subeqysp
+	plp
+	jne     L0048
+	lda     _yytext
+	bne     L0062
+	lda     #>(_yysbuf)
+	sta     _yysptr+1
+	lda     #<(_yysbuf)
+	sta     _yysptr
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	lda     _testbreak
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	ldx     #$00
+	txa
+	jmp     L0001
+L0062:	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0063
+	beq     L0063
+	ldx     _yysptr
+	bne     L0064
+	dec     _yysptr+1
+L0064:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0065
+L0063:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0065:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0067
+	cmp     #$0A
+	bne     L0067
+	inc     _yylineno
+	bne     L0067
+	inc     _yylineno+1
+L0067:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L006B
+	lda     _yytchar
+	cmp     #$FF
+	bne     L006B
+	ldx     #$00
+	txa
+	jmp     L0085
+L006B:	lda     _yytchar
+	ldx     #$00
+L0085:	sta     _yytext
+	sta     _yyprevious
+	stx     _yyprevious+1
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     _printchar
+	lda     _yyprevious
+	cmp     #$01
+	lda     _yyprevious+1
+	sbc     #$00
+	bvs     L006E
+	eor     #$80
+L006E:	bpl     L006D
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L006D:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     stax0sp
+	jmp     L0007
+L0001:	ldy     #$0E
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$74
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$08
+	jsr     staxysp
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	txa
+	sta     _yynerrs
+	sta     _yynerrs+1
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	lda     #$0E
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+L004C:	jsr     staxysp
+L0002:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	ldy     #$06
+	ldx     #$00
+	lda     #$02
+	jsr     addeqysp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tosicmp
+	bcc     L0003
+	beq     L0003
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     _yyerror
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0003:	ldy     #$07
+	jsr     ldptr1ysp
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     _yyval
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     _yyval+1
+	sta     (ptr1),y
+L0004:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L000E
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0009
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0009
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L0009:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	jcs     L000E
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	jmi     L000E
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L000E
+	cmp     _yychar
+	bne     L000E
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     _yylval+1
+	sta     _yyval+1
+	lda     _yylval
+	sta     _yyval
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	jsr     staxysp
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _yyerrflag
+	cmp     #$01
+	lda     _yyerrflag+1
+	sbc     #$00
+	bvs     L0010
+	eor     #$80
+L0010:	jpl     L0002
+	ldx     _yyerrflag
+	bne     L0011
+	dec     _yyerrflag+1
+L0011:	dex
+	stx     _yyerrflag
+	jmp     L0002
+L000E:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yydef)
+	tay
+	txa
+	adc     #>(_yydef)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	jne     L0021
+	cmp     #$FE
+	jne     L0021
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0015
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0015
+	lda     #$00
+	sta     _yychar
+	sta     _yychar+1
+L0015:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	jsr     stax0sp
+L0016:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     #$FF
+	bne     L0018
+	cmp     #$FF
+	bne     L0018
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$08
+	cmp     (c_sp),y
+	bne     L0018
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L0020
+L0018:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jmp     L0016
+L001D:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     _yychar+1
+	bne     L0020
+	cmp     _yychar
+	beq     L001E
+L0020:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	jsr     ldaxi
+	txa
+	bpl     L001D
+L001E:	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	bcc     L0021
+	ldx     #$00
+	txa
+	jmp     L0001
+L0021:	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	jne     L0025
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cpx     #$00
+	jne     L0025
+	cmp     #$00
+	beq     L0026
+	cmp     #$01
+	beq     L004E
+	cmp     #$02
+	beq     L004E
+	cmp     #$03
+	jeq     L0035
+	jmp     L0025
+L0026:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L0028
+	inc     _yynerrs+1
+L0028:	ldx     #$00
+L004E:	lda     #$03
+	sta     _yyerrflag
+	stx     _yyerrflag+1
+	jmp     L002D
+L002B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	clc
+	lda     ptr1
+	pha
+	lda     #$01
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxysp
+	txa
+	bmi     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0030
+	eor     #$80
+L0030:	bpl     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$01
+	bne     L002E
+	cmp     #$00
+	bne     L002E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jmp     L004C
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yypact)
+	tay
+	txa
+	adc     #>(_yypact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushw
+	lda     #$FE
+	clc
+	ldy     #$0A
+	adc     (c_sp),y
+	pha
+	lda     #$FF
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	jsr     pushw
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     subeqysp
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+L002D:	ldy     #$09
+	jsr     pushwysp
+	lda     #$12
+	jsr     leaa0sp
+	jsr     tosicmp
+	jcs     L002B
+L002C:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0035:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	lda     _yychar
+	ora     _yychar+1
+	beq     L002C
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	jmp     L0004
+L0025:	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr2)
+	tay
+	txa
+	adc     #>(_yyr2)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	sta     _yyval
+	stx     _yyval+1
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyr1)
+	tay
+	txa
+	adc     #>(_yyr1)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$04
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	clc
+	adc     sreg
+	pha
+	txa
+	adc     sreg+1
+	tax
+	pla
+	jsr     incax1
+	ldy     #$0E
+	jsr     staxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L0039
+	eor     #$80
+L0039:	bmi     L0051
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yychk)
+	tay
+	txa
+	adc     #>(_yychk)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosicmp
+	beq     L0038
+L0051:	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_yypgo)
+	tay
+	txa
+	adc     #>(_yypgo)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     aslax1
+	clc
+	adc     #<(_yyact)
+	tay
+	txa
+	adc     #>(_yyact)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$08
+	jsr     staxysp
+L0038:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0002
+	cmp     #$04
+	beq     L0052
+	cmp     #$05
+	beq     L003F
+	cmp     #$06
+	beq     L0040
+	cmp     #$07
+	beq     L0041
+	cmp     #$08
+	beq     L0042
+	cmp     #$09
+	beq     L0043
+	cmp     #$0A
+	beq     L0044
+	cmp     #$0C
+	beq     L0045
+	cmp     #$0D
+	beq     L0046
+	cmp     #$0E
+	jeq     L0047
+	jmp     L0002
+L0052:	txa
+	sta     _yyerrflag
+	sta     _yyerrflag+1
+	jmp     L0002
+L003F:	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0040:	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0041:	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0042:	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0043:	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0044:	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0045:	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0002
+L0046:	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L0047:	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0002
+L0001:	ldy     #$74
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+	bne     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	ldx     #$00
+	lda     _yytchar
+	ldy     #$00
+	sta     (ptr1),y
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	ldx     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dex
+	stx     _yysptr
+	stx     ptr1
+	ldx     _yysptr+1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+	bne     L0006
+	inc     _yylineno
+	bne     L0006
+	inc     _yylineno+1
+L0006:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L000A
+	lda     _yytchar
+	cmp     #$FF
+	bne     L000A
+	ldx     #$00
+	txa
+	jmp     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+L000B:	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _printchar
+	jmp     popax
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L000A
+	jmp     L000B
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	ldy     #$00
+	cmp     (c_sp),y
+	bne     L0008
+	txa
+	iny
+	cmp     (c_sp),y
+L0008:	jsr     booleq
+	php
+	ldy     #$02
+	tya
+	jsr     addeqysp
+	plp
+	beq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0007:	ldy     #$03
+L000A:	jsr     ldaxysp
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	bne     L0004
+L000B:	tax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ printchar (char *name, int ch)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printchar: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L000D
+	dey
+	lda     (c_sp),y
+	cmp     #$0A
+	bne     L000D
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jmp     L000A
+L000D:	jsr     ldax0sp
+	cpx     #$80
+	bcs     L000B
+	jsr     ldax0sp
+	cmp     #$F1
+	txa
+	sbc     #$00
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L000B
+	jsr     ldax0sp
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+L000B:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     L0014
+L0005:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+L0014:	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+L000A:	jsr     _fprintf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$04
+	jmp     L0011
+L0002:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	jsr     ldax0sp
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0008
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L0007
+	cmp     #$04
+	beq     L0013
+	jmp     L000F
+L0010:	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+	beq     L0007
+	jmp     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	jmp     L0014
+L000A:	inx
+	jmp     incsp2
+L000B:	inx
+	jmp     incsp2
+L0013:	lda     _yytext
+	jmp     incsp2
+L000F:	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+L0011:	jsr     _fprintf
+L0007:	jsr     _yylook
+	jsr     stax0sp
+	txa
+	jpl     L0002
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+L0014:	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #$01
+	rts
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,4338 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fclose
+	.import		_fgetc
+	.import		_fopen
+	.import		_fprintf
+	.import		_fputc
+	.import		_printf
+	.import		_exit
+	.import		_isprint
+	.export		_infile
+	.export		_outfile
+	.export		_yychar
+	.export		_yyerrflag
+	.export		_yylval
+	.export		_yyval
+	.export		_yyleng
+	.export		_yytext
+	.export		_yymorfg
+	.export		_yysptr
+	.export		_yysbuf
+	.export		_yytchar
+	.export		_yylineno
+	.export		_yyestate
+	.export		_yysvec
+	.export		_yybgin
+	.export		_yylook
+	.export		_yywrap
+	.export		_yyparse
+	.export		_yyerror
+	.export		_yyunput
+	.export		_yyoutput
+	.export		_yyinput
+	.export		_yyback
+	.export		_printchar
+	.export		_yylex
+	.export		_yyprevious
+	.export		_yyvstop
+	.export		_yycrank
+	.export		_yytop
+	.export		_yymatch
+	.export		_yyextra
+	.export		_yylstate
+	.export		_yylsp
+	.export		_yyolsp
+	.export		_yyfnd
+	.export		_testbreak
+	.export		_main
+	.export		_yyexca
+	.export		_yyact
+	.export		_yypact
+	.export		_yypgo
+	.export		_yyr1
+	.export		_yyr2
+	.export		_yychk
+	.export		_yydef
+	.export		_yydebug
+	.export		_yyv
+	.export		_yynerrs
+
+.segment	"DATA"
+
+_yyvstop:
+	.word	$0000
+	.word	$0004
+	.word	$0000
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0004
+	.word	$0000
+	.word	$0001
+	.word	$0004
+	.word	$0000
+	.word	$0002
+	.word	$0000
+	.word	$0001
+	.word	$0000
+	.word	$0000
+_yycrank:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$05
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$05
+	.byte	$07
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$06
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$06
+	.byte	$08
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yysvec:
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank-2
+	.word	$0000
+	.word	$0000
+	.addr	_yycrank
+	.addr	_yysvec+6
+	.word	$0000
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+2
+	.addr	_yycrank
+	.word	$0000
+	.addr	_yyvstop+6
+	.addr	_yycrank+4
+	.word	$0000
+	.addr	_yyvstop+12
+	.addr	_yycrank+38
+	.word	$0000
+	.addr	_yyvstop+18
+	.addr	_yycrank
+	.addr	_yysvec+30
+	.addr	_yyvstop+24
+	.addr	_yycrank
+	.addr	_yysvec+36
+	.addr	_yyvstop+28
+	.word	$0000
+	.word	$0000
+	.word	$0000
+_yytop:
+	.addr	_yycrank+510
+_yybgin:
+	.addr	_yysvec+6
+_yymatch:
+	.byte	$00
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$0A
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$09
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$30
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yyextra:
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_yylineno:
+	.word	$0001
+_yysptr:
+	.addr	_yysbuf
+_yyprevious:
+	.word	$000A
+_testbreak:
+	.byte	$00
+_yyexca:
+	.word	$FFFF
+	.word	$0001
+	.word	$0000
+	.word	$FFFF
+	.word	$FFFE
+	.word	$0000
+_yyact:
+	.word	$000C
+	.word	$0002
+	.word	$0009
+	.word	$0008
+	.word	$0011
+	.word	$000B
+	.word	$0019
+	.word	$0011
+	.word	$000F
+	.word	$0012
+	.word	$0010
+	.word	$000A
+	.word	$0012
+	.word	$0011
+	.word	$000F
+	.word	$0007
+	.word	$0010
+	.word	$000D
+	.word	$0012
+	.word	$0005
+	.word	$0003
+	.word	$0001
+	.word	$0000
+	.word	$0013
+	.word	$0014
+	.word	$0000
+	.word	$0000
+	.word	$0015
+	.word	$0016
+	.word	$0017
+	.word	$0018
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0006
+	.word	$000E
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0004
+	.word	$0006
+_yypact:
+	.word	$FC18
+	.word	$FFF7
+	.word	$FC18
+	.word	$0005
+	.word	$FFF9
+	.word	$FFC5
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFE3
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FC18
+	.word	$FC18
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFD8
+	.word	$FFDA
+	.word	$FFDD
+	.word	$FFDA
+	.word	$FFDA
+	.word	$FC18
+	.word	$FC18
+	.word	$FC18
+_yypgo:
+	.word	$0000
+	.word	$0015
+	.word	$0014
+	.word	$0011
+	.word	$000B
+_yyr1:
+	.word	$0000
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0001
+	.word	$0002
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0004
+	.word	$0003
+_yyr2:
+	.word	$0000
+	.word	$0000
+	.word	$0002
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0003
+	.word	$0002
+	.word	$0003
+	.word	$0001
+	.word	$0001
+	.word	$0001
+_yychk:
+	.word	$FC18
+	.word	$FFFF
+	.word	$000A
+	.word	$FFFE
+	.word	$0100
+	.word	$FFFD
+	.word	$0101
+	.word	$000A
+	.word	$000A
+	.word	$003D
+	.word	$FFFC
+	.word	$002D
+	.word	$0028
+	.word	$FFFD
+	.word	$0102
+	.word	$002B
+	.word	$002D
+	.word	$002A
+	.word	$002F
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$FFFC
+	.word	$0029
+_yydef:
+	.word	$0001
+	.word	$FFFE
+	.word	$0002
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000E
+	.word	$0003
+	.word	$0004
+	.word	$0000
+	.word	$0005
+	.word	$0000
+	.word	$0000
+	.word	$000C
+	.word	$000D
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$0000
+	.word	$000A
+	.word	$0000
+	.word	$0006
+	.word	$0007
+	.word	$0008
+	.word	$0009
+	.word	$000B
+_yydebug:
+	.word	$0001
+_yychar:
+	.word	$FFFF
+_yynerrs:
+	.word	$0000
+_yyerrflag:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0043:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$65,$72,$72,$6F,$72,$20,$72
+	.byte	$65,$63,$6F,$76,$65,$72,$79,$20,$70,$6F,$70,$73,$20,$73,$74,$61
+	.byte	$74,$65,$20,$25,$64,$2C,$20,$75,$6E,$63,$6F,$76,$65,$72,$73,$20
+	.byte	$25,$64,$0A,$00
+S000D:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$65,$72,$72,$6F,$72,$2C
+	.byte	$20,$61,$62,$6F,$72,$74,$65,$64,$20,$61,$66,$74,$65,$72,$20,$35
+	.byte	$20,$6C,$6F,$6F,$70,$73,$0A,$00
+S0044:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$65,$72,$72,$6F,$72,$20,$72
+	.byte	$65,$63,$6F,$76,$65,$72,$79,$20,$64,$69,$73,$63,$61,$72,$64,$73
+	.byte	$20,$63,$68,$61,$72,$20,$00
+S001A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$74,$72,$79,$20,$66,$61
+	.byte	$6C,$6C,$20,$62,$61,$63,$6B,$20,$63,$68,$61,$72,$61,$63,$74,$65
+	.byte	$72,$0A,$00
+S0020:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$66,$61,$6C,$6C,$20,$62
+	.byte	$61,$63,$6B,$20,$74,$6F,$20,$73,$74,$61,$74,$65,$20,$25,$64,$0A
+	.byte	$00
+S000C:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$69,$6E,$6E,$65,$72
+	.byte	$20,$6C,$6F,$6F,$70,$29,$20,$73,$74,$61,$74,$65,$20,$25,$64,$0A
+	.byte	$00
+S0040:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$20,$79,$79,$73,$74,$61,$74,$65,$3D,$25,$64,$0A,$00
+S0025:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$73,$74,$6F,$70,$70,$65,$64
+	.byte	$20,$61,$74,$20,$25,$64,$20,$77,$69,$74,$68,$3A,$0A,$00
+S0041:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$3D,$25,$64,$20
+	.byte	$79,$79,$65,$72,$72,$66,$6C,$61,$67,$3D,$25,$64,$0A,$00
+S0006:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$62,$61,$64,$20,$73,$77,$69,$74,$63
+	.byte	$68,$20,$79,$79,$6C,$6F,$6F,$6B,$20,$25,$64,$0A,$00
+S0039:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$61,$63,$63,$20,$73,$74
+	.byte	$61,$63,$6B,$20,$6F,$76,$65,$72,$66,$6C,$6F,$77,$00
+S0014:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$20,$79,$79,$74,$20
+	.byte	$3E,$20,$79,$79,$63,$72,$61,$6E,$6B,$29,$0A,$00
+S0015:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6D,$70,$72,$65
+	.byte	$73,$73,$65,$64,$20,$73,$74,$61,$74,$65,$0A,$00
+S003C:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$79,$79,$6E,$3D,$25,$64,$20,$00
+S0023:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$20,$73,$74,$61,$74,$65,$3D,$25,$64,$0A,$00
+S0028:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$6D,$61,$74,$63,$68,$20,$61
+	.byte	$63,$74,$69,$6F,$6E,$20,$25,$64,$0A,$00
+S002A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$64,$6F,$6E,$65,$20,$6C,$6F
+	.byte	$6F,$70,$73,$3A,$20,$25,$64,$0A,$00
+S003F:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$33,$29,$0A,$00
+S003B:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$31,$29,$0A,$00
+S0029	:=	S002A+0
+S003E:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$20,$28,$32,$29,$0A,$00
+S001E:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$33,$29,$0A,$00
+S0019:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$32,$29,$0A,$00
+S002D:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$64,$6F,$6E,$65,$20,$6C,$6F,$6F
+	.byte	$70,$73,$3A,$20,$25,$64,$0A,$00
+S0024:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$73,$74,$6F,$70,$70,$65,$64
+	.byte	$20,$28,$65,$6E,$64,$29,$0A,$00
+S0013:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$63,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$20,$28,$31,$29,$0A,$00
+S002E:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$72,$65,$74,$75,$72,$6E,$20,$3C
+	.byte	$76,$6F,$69,$64,$3E,$0A,$00
+S0037:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$73,$74,$61,$74,$65
+	.byte	$3D,$25,$64,$2C,$20,$00
+S0042:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$73,$79,$6E,$74,$61,$78,$20
+	.byte	$65,$72,$72,$6F,$72,$00
+S000A:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$28,$6F,$75,$74,$65,$72,$20
+	.byte	$6C,$6F,$6F,$70,$29,$00
+S001C:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$33,$29,$20,$00
+S0017:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$32,$29,$20,$00
+S0011:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$31,$29,$20,$00
+S0021:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$34,$29,$20,$00
+S003A:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$6E,$65,$77,$73,$74
+	.byte	$61,$74,$65,$0A,$00
+S0026:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$75,$6E,$70,$75,$74,$20
+	.byte	$28,$35,$29,$20,$00
+S0010:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$74,$72,$79,$61,$67,$61
+	.byte	$69,$6E,$0A,$00
+S0046:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$72,$65,$64,$75,$63,$65,$20
+	.byte	$25,$64,$0A,$00
+S0009:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$79,$79,$6D,$6F,$72,$66,$67,$3D
+	.byte	$25,$64,$0A,$00
+S0036:
+	.byte	$79,$79,$70,$61,$72,$73,$65,$3A,$20,$79,$79,$73,$74,$61,$63,$6B
+	.byte	$0A,$00
+S002F:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$69,$6E,$70,$75,$74,$20
+	.byte	$00
+S002B	:=	S002F+0
+S0007:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$72,$65,$74,$75,$72,$6E,$20,$30,$0A
+	.byte	$00
+S000E	:=	S002F+0
+S001B:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$32,$61,$29,$0A,$00
+S0005:
+	.byte	$79,$79,$6C,$65,$78,$3A,$20,$6E,$73,$74,$72,$3D,$25,$64,$0A,$00
+S0001:
+	.byte	$20,$25,$73,$3D,$59,$59,$4E,$45,$57,$4C,$49,$4E,$45,$0A,$00
+S0016:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$31,$29,$0A,$00
+S001F:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$3A,$20,$20,$20,$28,$32,$29,$0A,$00
+S0049:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$5B,$41,$44,$44,$5D,$0A,$00
+S0031:
+	.byte	$6D,$61,$69,$6E,$20,$73,$74,$61,$72,$74,$0A,$00
+S002C:
+	.byte	$79,$79,$70,$72,$65,$76,$69,$6F,$75,$73,$00
+S000B	:=	S002C+0
+S004E:
+	.byte	$5B,$50,$55,$53,$48,$20,$25,$73,$5D,$0A,$00
+S0022:
+	.byte	$2A,$79,$79,$6C,$61,$73,$74,$63,$68,$00
+S001D	:=	S0022+0
+S0003:
+	.byte	$20,$25,$73,$3D,$27,$25,$63,$27,$0A,$00
+S0018	:=	S0022+0
+S0002:
+	.byte	$20,$25,$73,$3D,$25,$30,$34,$78,$0A,$00
+S0012	:=	S0022+0
+S0034:
+	.byte	$6D,$61,$69,$6E,$20,$65,$6E,$64,$0A,$00
+S0027	:=	S0022+0
+S0008:
+	.byte	$79,$79,$6C,$6F,$6F,$6B,$28,$29,$0A,$00
+S0047:
+	.byte	$5B,$53,$54,$4F,$52,$45,$5D,$0A,$00
+S0004:
+	.byte	$79,$79,$6C,$65,$78,$28,$29,$0A,$00
+S0032:
+	.byte	$79,$61,$63,$63,$2E,$69,$6E,$00
+S004D:
+	.byte	$5B,$4C,$4F,$41,$44,$5D,$0A,$00
+S004B:
+	.byte	$5B,$44,$49,$56,$5D,$0A,$00
+S004A:
+	.byte	$5B,$4D,$55,$4C,$5D,$0A,$00
+S0048	:=	S0049+6
+S004C:
+	.byte	$5B,$4E,$45,$47,$5D,$0A,$00
+S003D:
+	.byte	$79,$79,$63,$68,$61,$72,$00
+S0045	:=	S003D+0
+S0038	:=	S003D+0
+S0035:
+	.byte	$5B,$25,$73,$5D,$0A,$00
+S004F	:=	S0035+0
+S000F:
+	.byte	$79,$79,$63,$68,$00
+S0030:
+	.byte	$6F,$75,$74,$00
+S0033:
+	.byte	$72,$62,$00
+
+.segment	"BSS"
+
+_infile:
+	.res	2,$00
+_outfile:
+	.res	2,$00
+_yylval:
+	.res	2,$00
+_yyval:
+	.res	2,$00
+_yyleng:
+	.res	2,$00
+_yytext:
+	.res	200,$00
+_yymorfg:
+	.res	2,$00
+_yysbuf:
+	.res	200,$00
+_yytchar:
+	.res	2,$00
+_yyestate:
+	.res	2,$00
+_yylstate:
+	.res	400,$00
+_yylsp:
+	.res	2,$00
+_yyolsp:
+	.res	2,$00
+_yyfnd:
+	.res	2,$00
+_yyv:
+	.res	100,$00
+
+; ---------------------------------------------------------------
+; int __near__ yylook (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylook: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	ldy     #$0C
+	jsr     subysp
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0008)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0008)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     _yymorfg
+	ora     _yymorfg+1
+	bne     L0002
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	bra     L009A
+L0002:	stz     _yymorfg
+	stz     _yymorfg+1
+	lda     _yyleng
+	clc
+	adc     #<(_yytext)
+	tay
+	lda     _yyleng+1
+	adc     #>(_yytext)
+	tax
+	tya
+L009A:	jsr     stax0sp
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0009)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0009)
+	sta     (c_sp),y
+	lda     _yymorfg
+	ldx     _yymorfg+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+L0007:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S000A)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S000A)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     _printchar
+	lda     #>(_yylstate)
+	sta     regbank+2+1
+	lda     #<(_yylstate)
+	sta     regbank+2
+	lda     _yybgin
+	ldx     _yybgin+1
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     _yyestate
+	stx     _yyestate+1
+	lda     _yyprevious+1
+	bne     L000A
+	lda     _yyprevious
+	cmp     #$0A
+	bne     L000A
+	lda     #$06
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L000A
+	inc     regbank+4+1
+L000A:	stz     _testbreak
+L000E:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S000C)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S000C)
+	sta     (c_sp),y
+	lda     regbank+4
+	sec
+	sbc     #<(_yysvec)
+	pha
+	lda     regbank+4+1
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	sec
+	sbc     #$01
+	bcs     L000F
+	dex
+L000F:	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	lda     _testbreak
+	cmp     #$05
+	bne     L0091
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S000D)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S000D)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0091:	inc     _testbreak
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	lda     (regbank+4)
+	sta     regbank+0
+	stx     regbank+0+1
+	cpx     #>(_yycrank)
+	bne     L0014
+	cmp     #<(_yycrank)
+	bne     L0014
+	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0094
+	cmp     #$00
+	jeq     L000C
+L0094:	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #>(_yycrank)
+	bne     L0014
+	cmp     #<(_yycrank)
+	jeq     L000C
+L0014:	jsr     pushw0sp
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	jsr     boolugt
+	php
+	ldy     #$02
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0015
+	lda     _yysptr
+	bne     L0016
+	dec     _yysptr+1
+L0016:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L0017
+L0015:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0017:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0019
+	cmp     #$0A
+	bne     L0019
+	inc     _yylineno
+	bne     L0019
+	inc     _yylineno+1
+L0019:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L001D
+	lda     _yytchar
+	cmp     #$FF
+	bne     L001D
+	ldx     #$00
+	txa
+	bra     L001E
+L001D:	lda     _yytchar
+	ldx     _yytchar+1
+L001E:	ldy     #$06
+	jsr     staxysp
+	ldy     #$00
+	jsr     staspidx
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S000E)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S000E)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _printchar
+L001F:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0010)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0010)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     regbank+0
+	ldx     regbank+0+1
+	ldy     #$02
+	jsr     staxysp
+	lda     regbank+0
+	sec
+	sbc     #<(_yycrank)
+	sta     tmp1
+	lda     regbank+0+1
+	sbc     #>(_yycrank)
+	ora     tmp1
+	jcc     L0020
+	jeq     L0020
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	lda     tmp1
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     regbank+0
+	stx     regbank+0+1
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L008E
+	jcs     L0021
+L008E:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	jne     L0021
+	cmp     regbank+4
+	jne     L0021
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0025
+	cmp     #<(_yysvec)
+	bne     L0025
+	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0011)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0011)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L0026
+	lda     _yylineno
+	bne     L0028
+	dec     _yylineno+1
+L0028:	dec     _yylineno
+L0026:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	jne     L000C
+	inc     _yysptr+1
+	jmp     L000C
+L0025:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	bcc     L002A
+	inc     regbank+2+1
+L002A:	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0013)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0013)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L004A
+L0021:	jsr     decsp4
+	lda     _outfile
+	dey
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0014)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0014)
+	jmp     L009C
+L0020:	lda     regbank+0
+	cmp     #<(_yycrank)
+	lda     regbank+0+1
+	sbc     #>(_yycrank)
+	jcs     L002D
+	lda     #<(_yycrank)
+	sec
+	sbc     regbank+0
+	pha
+	lda     #>(_yycrank)
+	sbc     regbank+0+1
+	tax
+	pla
+	cpx     #$00
+	bpl     L002E
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0030
+	cmp     #$FF
+L0030:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L002E
+	ldx     #$00
+	txa
+	bra     L002F
+L002E:	jsr     asrax1
+L002F:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yycrank)
+	tay
+	lda     tmp1
+	adc     #>(_yycrank)
+	tax
+	tya
+	ldy     #$02
+	jsr     staxysp
+	sta     regbank+0
+	stx     regbank+0+1
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0015)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0015)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     regbank+0
+	pha
+	lda     tmp1
+	adc     regbank+0+1
+	tax
+	pla
+	sta     regbank+0
+	stx     regbank+0+1
+	sec
+	sbc     _yytop
+	sta     tmp1
+	txa
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L008F
+	jcs     L0031
+L008F:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	jne     L0031
+	cmp     regbank+4
+	jne     L0031
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0016)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0016)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L0035
+	cmp     #<(_yysvec)
+	bne     L0035
+	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0017)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0017)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L0036
+	lda     _yylineno
+	bne     L0038
+	dec     _yylineno+1
+L0038:	dec     _yylineno
+L0036:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	jne     L000C
+	inc     _yysptr+1
+	jmp     L000C
+L0035:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	bcc     L003A
+	inc     regbank+2+1
+L003A:	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0019)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0019)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L004A
+L0031:	iny
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yymatch)
+	sta     ptr1+1
+	ldy     #<(_yymatch)
+	ldx     #$00
+	lda     (ptr1),y
+	asl     a
+	bcc     L008D
+	inx
+	clc
+L008D:	ldy     #$02
+	adc     (c_sp),y
+	sta     regbank+0
+	txa
+	iny
+	adc     (c_sp),y
+	sta     regbank+0+1
+	jsr     decsp4
+	lda     _outfile
+	dey
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S001A)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S001A)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     regbank+0
+	sec
+	sbc     _yytop
+	sta     tmp1
+	lda     regbank+0+1
+	sbc     _yytop+1
+	ora     tmp1
+	beq     L0090
+	jcs     L003B
+L0090:	ldx     #$00
+	lda     (regbank+0)
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     regbank+4+1
+	jne     L003B
+	cmp     regbank+4
+	jne     L003B
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S001B)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S001B)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$01
+	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #>(_yysvec)
+	bne     L003F
+	cmp     #<(_yysvec)
+	bne     L003F
+	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S001C)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S001C)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L0040
+	lda     _yylineno
+	bne     L0042
+	dec     _yylineno+1
+L0042:	dec     _yylineno
+L0040:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	jne     L000C
+	inc     _yysptr+1
+	jmp     L000C
+L003F:	ldx     #$00
+	lda     (regbank+0),y
+	jsr     mulax6
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_yysvec)
+	clc
+	adc     ptr1
+	pha
+	lda     #>(_yysvec)
+	adc     ptr1+1
+	tax
+	pla
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     (regbank+2)
+	ldy     #$01
+	txa
+	sta     (regbank+2),y
+	lda     #$02
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	bcc     L0044
+	inc     regbank+2+1
+L0044:	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S001E)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S001E)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L004A
+L003B:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S001F)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S001F)
+L009C:	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+L002D:	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regbank+4
+	stx     regbank+4+1
+	ora     regbank+4+1
+	beq     L0045
+	dey
+	lda     (regbank+4),y
+	tax
+	lda     (regbank+4)
+	sta     regbank+0
+	stx     regbank+0+1
+	cpx     #>(_yycrank)
+	bne     L0047
+	cmp     #<(_yycrank)
+	beq     L0045
+L0047:	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0020)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0020)
+	sta     (c_sp),y
+	lda     regbank+4
+	sec
+	sbc     #<(_yysvec)
+	pha
+	lda     regbank+4+1
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	sec
+	sbc     #$01
+	bcs     L0049
+	dex
+L0049:	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L001F
+L0045:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0021)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0021)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     _printchar
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L004B
+	lda     _yylineno
+	bne     L004D
+	dec     _yylineno+1
+L004D:	dec     _yylineno
+L004B:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L000C
+	inc     _yysptr+1
+	bra     L000C
+L004A:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0023)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0023)
+	sta     (c_sp),y
+	lda     regbank+4
+	sec
+	sbc     #<(_yysvec)
+	pha
+	lda     regbank+4+1
+	sbc     #>(_yysvec)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	sec
+	sbc     #$01
+	bcs     L004F
+	dex
+L004F:	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L000E
+L000C:	lda     #<(_yylstate)
+	ldx     #>(_yylstate)
+	cpx     regbank+2+1
+	bne     L0050
+	cmp     regbank+2
+	bne     L0050
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0024)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0024)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	jmp     L006F
+L0050:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0025)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0025)
+	sta     (c_sp),y
+	lda     regbank+2
+	ldx     regbank+2+1
+	sec
+	sbc     #$02
+	bcs     L0052
+	dex
+L0052:	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sec
+	sbc     #<(_yysvec+6)
+	pha
+	txa
+	sbc     #>(_yysvec+6)
+	tax
+	pla
+	jsr     pushax
+	lda     #$06
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jmp     L006F
+L0053:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	txa
+	sta     (ptr1)
+	tya
+	jsr     subeq0sp
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	cpx     #$00
+	bne     L0098
+	cmp     #$00
+	jeq     L0057
+L0098:	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (ptr1),y
+	sta     _yyfnd+1
+	dey
+	lda     (ptr1),y
+	sta     _yyfnd
+	ora     _yyfnd+1
+	jeq     L0057
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L005A
+	eor     #$80
+L005A:	jpl     L0057
+	lda     regbank+2+1
+	sta     _yyolsp+1
+	lda     regbank+2
+	sta     _yyolsp
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_yyextra)
+	sta     ptr1+1
+	ldy     #<(_yyextra)
+	lda     (ptr1),y
+	jeq     L005F
+	jmp     L0069
+L005E:	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L0065
+	dec     regbank+2+1
+L0065:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0026)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0026)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	jsr     _printchar
+	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	tya
+	jsr     subeq0sp
+	lda     _yytchar+1
+	bne     L0066
+	lda     _yytchar
+	cmp     #$0A
+	bne     L0066
+	lda     _yylineno
+	bne     L0068
+	dec     _yylineno+1
+L0068:	dec     _yylineno
+L0066:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L0069
+	inc     _yysptr+1
+L0069:	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     negax
+	jsr     _yyback
+	cpx     #$00
+	bne     L0099
+	cmp     #$01
+	beq     L005F
+L0099:	lda     regbank+2
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	lda     regbank+2+1
+	sbc     #>(_yylstate)
+	ora     tmp1
+	beq     L005F
+	jcs     L005E
+L005F:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	lda     (ptr1)
+	sta     _yyprevious
+	stz     _yyprevious+1
+	lda     regbank+2+1
+	sta     _yylsp+1
+	lda     regbank+2
+	sta     _yylsp
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sec
+	sbc     #<(_yytext)
+	pha
+	txa
+	sbc     #>(_yytext)
+	tax
+	pla
+	ina
+	bne     L006A
+	inx
+L006A:	sta     _yyleng
+	stx     _yyleng+1
+	clc
+	adc     #<(_yytext)
+	sta     ptr1
+	txa
+	adc     #>(_yytext)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0028)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0028)
+	sta     (c_sp),y
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0029)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0029)
+	sta     (c_sp),y
+	lda     _testbreak
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	lda     _yyfnd+1
+	sta     ptr1+1
+	lda     _yyfnd
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     regsave
+	stx     regsave+1
+	lda     #$02
+	clc
+	adc     _yyfnd
+	sta     _yyfnd
+	bcc     L006B
+	inc     _yyfnd+1
+L006B:	lda     regsave
+	ldx     regsave+1
+	jmp     L0001
+L0057:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	lda     (ptr1)
+	sta     _yytchar
+	stz     _yytchar+1
+	cmp     #$0A
+	bne     L006C
+	lda     _yylineno
+	bne     L006E
+	dec     _yylineno+1
+L006E:	dec     _yylineno
+L006C:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L006F
+	inc     _yysptr+1
+L006F:	lda     regbank+2
+	sec
+	sbc     #<(_yylstate)
+	sta     tmp1
+	lda     regbank+2+1
+	sbc     #>(_yylstate)
+	ora     tmp1
+	jsr     boolugt
+	php
+	lda     regbank+2
+	sec
+	sbc     #$02
+	sta     regbank+2
+	bcs     L0056
+	dec     regbank+2+1
+L0056:	plp
+	jne     L0053
+	lda     _yytext
+	bne     L0070
+	lda     #>(_yysbuf)
+	sta     _yysptr+1
+	lda     #<(_yysbuf)
+	sta     _yysptr
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S002A)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S002A)
+	sta     (c_sp),y
+	lda     _testbreak
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	ldx     #$00
+	txa
+	jmp     L0001
+L0070:	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0071
+	beq     L0071
+	lda     _yysptr
+	bne     L0072
+	dec     _yysptr+1
+L0072:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L0073
+L0071:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0073:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0075
+	cmp     #$0A
+	bne     L0075
+	inc     _yylineno
+	bne     L0075
+	inc     _yylineno+1
+L0075:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L0079
+	lda     _yytchar
+	cmp     #$FF
+	bne     L0079
+	ina
+	bra     L0093
+L0079:	lda     _yytchar
+L0093:	sta     _yytext
+	sta     _yyprevious
+	stz     _yyprevious+1
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S002B)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S002B)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     _printchar
+	lda     _yyprevious
+	cmp     #$01
+	lda     _yyprevious+1
+	sbc     #$00
+	bvs     L007C
+	eor     #$80
+L007C:	bpl     L007B
+	lda     _yyprevious
+	ldx     _yyprevious+1
+	jsr     pushax
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+L007B:	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     stax0sp
+	jmp     L0007
+L0001:	pha
+	stx     tmp1
+	ldy     #$0D
+	ldx     #$05
+L007D:	lda     (c_sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L007D
+	ldx     tmp1
+	pla
+	ldy     #$0E
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yywrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yywrap: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyparse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyparse: near
+
+.segment	"CODE"
+
+	ldy     #$68
+	jsr     subysp
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jsr     decsp6
+	stz     regbank+2
+	stz     regbank+2+1
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	stz     _yynerrs
+	stz     _yynerrs+1
+	stz     _yyerrflag
+	stz     _yyerrflag+1
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$0E
+	bcc     L0002
+	inx
+L0002:	sta     regbank+0
+	stx     regbank+0+1
+	lda     #<(_yyv-2)
+	ldx     #>(_yyv-2)
+	ldy     #$02
+	jsr     staxysp
+L0003:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	lda     #$02
+	clc
+	adc     regbank+0
+	sta     regbank+0
+	bcc     L0005
+	inc     regbank+0+1
+L0005:	ldx     regbank+0+1
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$76
+	bcc     L0006
+	inx
+L0006:	jsr     tosicmp
+	bcc     L0004
+	beq     L0004
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     _yyerror
+	lda     #$01
+	jmp     L0001
+L0004:	lda     regbank+2
+	sta     (regbank+0)
+	ldy     #$01
+	lda     regbank+2+1
+	sta     (regbank+0),y
+	iny
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	lda     _yyval
+	sta     (ptr1)
+	dey
+	lda     _yyval+1
+	sta     (ptr1),y
+L0007:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     regbank+2
+	ldx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	cmp     #$19
+	txa
+	sbc     #$FC
+	bvc     L0009
+	eor     #$80
+L0009:	jmi     L0011
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L000C
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L000C
+	stz     _yychar
+	stz     _yychar+1
+L000C:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	lda     _yychar
+	ldx     _yychar+1
+	ldy     #$04
+	jsr     addeqysp
+	cpx     #$80
+	jcs     L0011
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L000F
+	eor     #$80
+L000F:	jmi     L0011
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     _yychar+1
+	bne     L0011
+	cmp     _yychar
+	bne     L0011
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	lda     _yylval+1
+	sta     _yyval+1
+	lda     _yylval
+	sta     _yyval
+	ldy     #$05
+	lda     (c_sp),y
+	sta     regbank+2+1
+	dey
+	lda     (c_sp),y
+	sta     regbank+2
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _yyerrflag
+	cmp     #$01
+	lda     _yyerrflag+1
+	sbc     #$00
+	bvs     L0013
+	eor     #$80
+L0013:	jpl     L0003
+	lda     _yyerrflag
+	bne     L0014
+	dec     _yyerrflag+1
+L0014:	dea
+	sta     _yyerrflag
+	jmp     L0003
+L0011:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     regbank+2
+	ldx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yydef)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yydef)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$FF
+	jne     L0025
+	cmp     #$FE
+	jne     L0025
+	ldx     _yychar+1
+	cpx     #$80
+	bcc     L0018
+	jsr     _yylex
+	sta     _yychar
+	stx     _yychar+1
+	cpx     #$80
+	bcc     L0018
+	stz     _yychar
+	stz     _yychar+1
+L0018:	lda     #<(_yyexca)
+	ldx     #>(_yyexca)
+	jsr     stax0sp
+L0019:	ldy     #$01
+	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #$FF
+	bne     L001E
+	cmp     #$FF
+	bne     L001E
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	clc
+	adc     #$02
+	bcc     L001F
+	inx
+L001F:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     regbank+2+1
+	bne     L001E
+	cmp     regbank+2
+	beq     L0060
+L001E:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	bra     L0019
+L0021:	lda     (c_sp),y
+	sta     ptr1+1
+	lda     (c_sp)
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     _yychar+1
+	bne     L0060
+	cmp     _yychar
+	beq     L0022
+L0060:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	bpl     L0021
+L0022:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	clc
+	adc     #$02
+	bcc     L0026
+	inx
+L0026:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	cpx     #$80
+	bcc     L0025
+	lda     #$00
+	jmp     L0001
+L0025:	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$04
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	jne     L002A
+	lda     _yyerrflag
+	ldx     _yyerrflag+1
+	cpx     #$00
+	jne     L002A
+	cmp     #$00
+	beq     L002B
+	cmp     #$01
+	beq     L005B
+	cmp     #$02
+	beq     L005B
+	cmp     #$03
+	jeq     L003C
+	jmp     L002A
+L002B:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     _yyerror
+	inc     _yynerrs
+	bne     L005B
+	inc     _yynerrs+1
+L005B:	lda     #$03
+	sta     _yyerrflag
+	stz     _yyerrflag+1
+	jmp     L0032
+L0030:	ldy     #$01
+	lda     (regbank+0),y
+	sta     tmp1
+	lda     (regbank+0)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	inx
+	ldy     #$04
+	jsr     staxysp
+	txa
+	bmi     L0034
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvc     L0036
+	eor     #$80
+L0036:	bpl     L0034
+	iny
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	lda     (ptr1)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #$01
+	bne     L0034
+	cmp     #$00
+	bne     L0034
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     regbank+2
+	stx     regbank+2+1
+	jmp     L0003
+L0034:	ldy     #$01
+	lda     (regbank+0),y
+	sta     tmp1
+	lda     (regbank+0)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	lda     (regbank+0)
+	jsr     pushax
+	lda     regbank+0
+	clc
+	adc     #$FE
+	sta     ptr1
+	lda     regbank+0+1
+	adc     #$FF
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     regbank+0
+	sec
+	sbc     #$02
+	sta     regbank+0
+	bcs     L003A
+	dec     regbank+0+1
+L003A:	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+L0032:	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$12
+	bcc     L0033
+	inx
+L0033:	jsr     tosicmp
+	jcs     L0030
+L0031:	lda     #$01
+	jmp     L0001
+L003C:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	lda     _yychar
+	ldx     _yychar+1
+	jsr     _printchar
+	lda     _yychar
+	ora     _yychar+1
+	beq     L0031
+	lda     #$FF
+	sta     _yychar
+	sta     _yychar+1
+	jmp     L0007
+L002A:	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr2)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr2)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	lda     (ptr1)
+	asl     a
+	rol     tmp1
+	eor     #$FF
+	sec
+	adc     regbank+0
+	sta     regbank+0
+	lda     tmp1
+	eor     #$FF
+	adc     regbank+0+1
+	sta     regbank+0+1
+	ldy     #$03
+	lda     (c_sp),y
+	sta     regbank+4+1
+	dey
+	lda     (c_sp),y
+	sta     regbank+4
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr2)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr2)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	lda     (ptr1)
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	iny
+	jsr     subeqysp
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$02
+	bcc     L003F
+	inx
+L003F:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	sta     _yyval+1
+	lda     (ptr1)
+	sta     _yyval
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyr1)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyr1)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$04
+	jsr     staxysp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypgo)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypgo)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	lda     (regbank+0)
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ina
+	bne     L0040
+	inx
+L0040:	ldy     #$0E
+	jsr     staxysp
+	cmp     #$F9
+	txa
+	sbc     #$00
+	bvs     L0042
+	eor     #$80
+L0042:	bmi     L005E
+	ldy     #$0F
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     regbank+2
+	stx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yychk)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yychk)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     negax
+	jsr     tosicmp
+	beq     L0041
+L005E:	ldy     #$05
+	lda     (c_sp),y
+	sta     tmp1
+	dey
+	lda     (c_sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yypgo)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yypgo)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	lda     (ptr1)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_yyact)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_yyact)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     regbank+2
+	stx     regbank+2+1
+L0041:	ldy     #$0D
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	cpx     #$00
+	jne     L0003
+	cmp     #$04
+	beq     L005F
+	cmp     #$05
+	beq     L0048
+	cmp     #$06
+	beq     L0049
+	cmp     #$07
+	beq     L004A
+	cmp     #$08
+	beq     L004B
+	cmp     #$09
+	beq     L004C
+	cmp     #$0A
+	beq     L004D
+	cmp     #$0C
+	beq     L004E
+	cmp     #$0D
+	beq     L004F
+	cmp     #$0E
+	jeq     L0050
+	jmp     L0003
+L005F:	stz     _yyerrflag
+	stz     _yyerrflag+1
+	jmp     L0003
+L0048:	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0049:	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004A:	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004B:	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004C:	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004D:	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004E:	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L004F:	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0003
+L0050:	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     #<(_yytext)
+	ldx     #>(_yytext)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0003
+L0001:	pha
+	stz     tmp1
+	ldy     #$0B
+	ldx     #$05
+L0051:	lda     (c_sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0051
+	ldx     tmp1
+	pla
+	ldy     #$74
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0003:
+	.word	$0000
+M0004:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyerror (s) char *s;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyerror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyunput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyunput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$0A
+	bne     L0002
+	lda     _yylineno
+	bne     L0004
+	dec     _yylineno+1
+L0004:	dec     _yylineno
+L0002:	lda     _yysptr+1
+	sta     ptr1+1
+	lda     _yysptr
+	sta     ptr1
+	ldx     #$00
+	lda     _yytchar
+	sta     (ptr1)
+	inc     _yysptr
+	bne     L0005
+	inc     _yysptr+1
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyoutput (c) int c;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyoutput: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     _outfile
+	ldx     _outfile+1
+	jsr     _fputc
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyinput (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyinput: near
+
+.segment	"CODE"
+
+	lda     _yysptr
+	sec
+	sbc     #<(_yysbuf)
+	sta     tmp1
+	lda     _yysptr+1
+	sbc     #>(_yysbuf)
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	lda     _yysptr
+	bne     L0003
+	dec     _yysptr+1
+L0003:	dea
+	sta     _yysptr
+	ldx     _yysptr+1
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L0004
+L0002:	lda     _infile
+	ldx     _infile+1
+	jsr     _fgetc
+L0004:	sta     _yytchar
+	stx     _yytchar+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+	bne     L0006
+	inc     _yylineno
+	bne     L0006
+	inc     _yylineno+1
+L0006:	lda     _yytchar+1
+	cmp     #$FF
+	bne     L000A
+	lda     _yytchar
+	cmp     #$FF
+	bne     L000A
+	ldx     #$00
+	txa
+	bra     L000B
+L000A:	lda     _yytchar
+	ldx     _yytchar+1
+L000B:	jsr     pushax
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S002F)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S002F)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _printchar
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yyback (p, m) int *p; int m;
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yyback: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	bne     L000A
+	bra     L000B
+L0004:	ldy     #$03
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cmp     (c_sp)
+	bne     L0008
+	txa
+	ldy     #$01
+	cmp     (c_sp),y
+L0008:	jsr     booleq
+	php
+	iny
+	tya
+	jsr     addeqysp
+	plp
+	beq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0007:	ldy     #$03
+L000A:	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	dey
+	ora     (ptr1),y
+	bne     L0004
+L000B:	tax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ printchar (char *name, int ch)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printchar: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L000D
+	lda     (c_sp)
+	cmp     #$0A
+	bne     L0002
+	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0001)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0001)
+	sta     (c_sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	bra     L000A
+L0002:	ldy     #$01
+L000D:	lda     (c_sp),y
+	tax
+	cpx     #$80
+	bcs     L000B
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cmp     #$F1
+	txa
+	sbc     #$00
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L000B
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+L000B:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0002)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0002)
+	bra     L0014
+L0005:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0003)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0003)
+L0014:	sta     (c_sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+L000A:	jsr     _fprintf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ yylex (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_yylex: near
+
+.segment	"CODE"
+
+	jsr     decsp6
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0004)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0004)
+	sta     (c_sp),y
+	ldy     #$04
+	jmp     L0011
+L0002:	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0005)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0005)
+	sta     (c_sp),y
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+	beq     L0008
+	cmp     #$01
+	beq     L000A
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	beq     L0007
+	cmp     #$04
+	beq     L0013
+	bra     L000F
+L0010:	cpx     #$FF
+	bne     L000F
+	cmp     #$FF
+	beq     L0007
+	bra     L000F
+L0008:	jsr     _yywrap
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	bra     L0014
+L000A:	inx
+	jmp     incsp2
+L000B:	inx
+	jmp     incsp2
+L0013:	lda     _yytext
+	jmp     incsp2
+L000F:	jsr     decsp4
+	lda     _outfile
+	iny
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0006)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0006)
+	sta     (c_sp),y
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+L0011:	jsr     _fprintf
+L0007:	jsr     _yylook
+	jsr     stax0sp
+	txa
+	jpl     L0002
+	jsr     decsp4
+	lda     _outfile
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     _outfile+1
+	sta     (c_sp),y
+	lda     #<(S0007)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0007)
+	sta     (c_sp),y
+	ldy     #$04
+	jsr     _fprintf
+L0014:	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     _fopen
+	sta     _infile
+	stx     _infile+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ina
+	rts
+L0002:	lda     _stdout
+	ldx     _stdout+1
+	sta     _outfile
+	stx     _outfile+1
+	jsr     _yyparse
+	lda     _infile
+	ldx     _infile+1
+	jsr     _fclose
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
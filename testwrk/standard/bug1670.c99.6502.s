@@ -0,0 +1,179 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_localtime
+	.import		_strftime
+	.export		_clock_gettime
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$54,$68,$65,$20,$74,$69,$6D,$65,$20,$69,$73,$20,$25,$73,$0A,$00
+S0001:
+	.byte	$25,$32,$64,$3A,$25,$32,$64,$3A,$25,$32,$64,$0A,$00
+S0002:
+	.byte	$3C,$25,$48,$3A,$25,$4D,$3A,$25,$53,$3E,$00
+
+; ---------------------------------------------------------------
+; const char *__near__ clock_gettime (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_gettime: near
+
+.segment	"CODE"
+
+;
+; time_t t = 0x12345678;
+;
+	jsr     decsp2
+	lda     #$12
+	sta     sreg+1
+	lda     #$34
+	sta     sreg
+	lda     #$78
+	ldx     #$56
+	jsr     pusheax
+;
+; my_tm = localtime(&t);
+;
+	lda     c_sp
+	ldx     c_sp+1
+	jsr     _localtime
+	ldy     #$04
+	jsr     staxysp
+;
+; printf("%2d:%2d:%2d\n", my_tm->tm_hour, my_tm->tm_min, my_tm->tm_sec);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$09
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$0B
+	lda     (c_sp),y
+	sta     ptr1+1
+	dey
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; strftime(buf, sizeof(buf), "<%H:%M:%S>", my_tm);
+;
+	jsr     decsp6
+	lda     #<(M0001)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(M0001)
+	sta     (c_sp),y
+	lda     #$20
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0002)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0002)
+	sta     (c_sp),y
+	ldy     #$0B
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _strftime
+;
+; return buf;
+;
+	lda     #<(M0001)
+	ldx     #>(M0001)
+;
+; }
+;
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	32,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; printf("The time is %s\n", clock_gettime());
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	jsr     _clock_gettime
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return EXIT_SUCCESS;
+;
+	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
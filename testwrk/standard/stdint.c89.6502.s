@@ -0,0 +1,209 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S006D:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$61,$78,$69,$6D,$75,$6D,$20,$28,$25,$6C,$75,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$75,$29,$0A,$00
+S006A	:=	S006D+0
+S0004:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$61,$78,$69,$6D,$75,$6D,$20,$28,$25,$6C,$64,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$64,$29,$0A,$00
+S0067	:=	S0004+0
+S0064:
+	.byte	$4D,$69,$73,$6D,$61,$74,$63,$68,$20,$66,$6F,$72,$20,$25,$73,$2C
+	.byte	$20,$6D,$69,$6E,$69,$6D,$75,$6D,$20,$28,$25,$6C,$64,$29,$20,$69
+	.byte	$73,$20,$6E,$6F,$74,$20,$25,$73,$20,$28,$25,$6C,$64,$29,$0A,$00
+S0007	:=	S0064+0
+S0061	:=	S006D+0
+S005E	:=	S0004+0
+S000A	:=	S0004+0
+S005B	:=	S0064+0
+S0058	:=	S006D+0
+S000D	:=	S0064+0
+S0055	:=	S0004+0
+S0052	:=	S0064+0
+S0010	:=	S0004+0
+S004F	:=	S006D+0
+S004C	:=	S006D+0
+S0013	:=	S006D+0
+S0049	:=	S006D+0
+S0046	:=	S0004+0
+S0016	:=	S006D+0
+S0043	:=	S0064+0
+S0040	:=	S0004+0
+S0019	:=	S006D+0
+S003D	:=	S0064+0
+S003A	:=	S0004+0
+S001C	:=	S0064+0
+S0037	:=	S0064+0
+S0034	:=	S006D+0
+S001F	:=	S0004+0
+S0031	:=	S006D+0
+S002E	:=	S006D+0
+S0022	:=	S0064+0
+S002B	:=	S0004+0
+S0028	:=	S0064+0
+S0025	:=	S0004+0
+S0001	:=	S0064+0
+S0036:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$33,$32,$5F,$4D,$41,$58
+	.byte	$00
+S0033:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$31,$36,$5F,$4D,$41,$58
+	.byte	$00
+S0051:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$33,$32,$5F,$4D,$41,$58,$00
+S002A:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S0027	:=	S0033+1
+S0024:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S002D	:=	S0036+1
+S0030:
+	.byte	$55,$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$38,$5F,$4D,$41,$58,$00
+S004E:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$31,$36,$5F,$4D,$41,$58,$00
+S0021	:=	S0030+1
+S006C:
+	.byte	$53,$49,$47,$5F,$41,$54,$4F,$4D,$49,$43,$5F,$4D,$41,$58,$00
+S0032:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$31,$36,$5F,$74,$00
+S0048	:=	S0051+1
+S001E:
+	.byte	$49,$4E,$54,$5F,$4C,$45,$41,$53,$54,$38,$5F,$4D,$49,$4E,$00
+S0035:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$33,$32,$5F,$74,$00
+S003F:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S0045:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S004B:
+	.byte	$55,$49,$4E,$54,$5F,$46,$41,$53,$54,$38,$5F,$4D,$41,$58,$00
+S0042	:=	S004E+1
+S0050:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$33,$32,$5F,$74,$00
+S004D:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$31,$36,$5F,$74,$00
+S003C	:=	S004B+1
+S002F:
+	.byte	$75,$69,$6E,$74,$5F,$6C,$65,$61,$73,$74,$38,$5F,$74,$00
+S002C	:=	S0035+1
+S0023	:=	S0032+1
+S0029	:=	S0035+1
+S0039:
+	.byte	$49,$4E,$54,$5F,$46,$41,$53,$54,$38,$5F,$4D,$49,$4E,$00
+S0026	:=	S0032+1
+S0020	:=	S002F+1
+S0044	:=	S0050+1
+S006B:
+	.byte	$73,$69,$67,$5F,$61,$74,$6F,$6D,$69,$63,$5F,$74,$00
+S001D	:=	S002F+1
+S0047	:=	S0050+1
+S003E	:=	S004D+1
+S004A:
+	.byte	$75,$69,$6E,$74,$5F,$66,$61,$73,$74,$38,$5F,$74,$00
+S0041	:=	S004D+1
+S0063:
+	.byte	$55,$49,$4E,$54,$4D,$41,$58,$5F,$4D,$41,$58,$00
+S0069:
+	.byte	$50,$54,$52,$44,$49,$46,$46,$5F,$4D,$41,$58,$00
+S003B	:=	S004A+1
+S005A:
+	.byte	$55,$49,$4E,$54,$50,$54,$52,$5F,$4D,$41,$58,$00
+S0038	:=	S004A+1
+S0066:
+	.byte	$50,$54,$52,$44,$49,$46,$46,$5F,$4D,$49,$4E,$00
+S0060	:=	S0063+1
+S005D:
+	.byte	$49,$4E,$54,$4D,$41,$58,$5F,$4D,$49,$4E,$00
+S001B:
+	.byte	$55,$49,$4E,$54,$33,$32,$5F,$4D,$41,$58,$00
+S0054:
+	.byte	$49,$4E,$54,$50,$54,$52,$5F,$4D,$49,$4E,$00
+S0057	:=	S005A+1
+S0018:
+	.byte	$55,$49,$4E,$54,$31,$36,$5F,$4D,$41,$58,$00
+S0062:
+	.byte	$75,$69,$6E,$74,$6D,$61,$78,$5F,$74,$00
+S000C	:=	S0018+1
+S0059:
+	.byte	$75,$69,$6E,$74,$70,$74,$72,$5F,$74,$00
+S0068:
+	.byte	$70,$74,$72,$64,$69,$66,$66,$5F,$74,$00
+S0012	:=	S001B+1
+S0015:
+	.byte	$55,$49,$4E,$54,$38,$5F,$4D,$41,$58,$00
+S000F:
+	.byte	$49,$4E,$54,$33,$32,$5F,$4D,$49,$4E,$00
+S0009:
+	.byte	$49,$4E,$54,$31,$36,$5F,$4D,$49,$4E,$00
+S0065	:=	S0068+0
+S005C	:=	S0062+1
+S0053	:=	S0059+1
+S0003:
+	.byte	$49,$4E,$54,$38,$5F,$4D,$49,$4E,$00
+S001A:
+	.byte	$75,$69,$6E,$74,$33,$32,$5F,$74,$00
+S0006	:=	S0015+1
+S005F	:=	S0062+1
+S0056	:=	S0059+1
+S006F:
+	.byte	$53,$49,$5A,$45,$5F,$4D,$41,$58,$00
+S0017:
+	.byte	$75,$69,$6E,$74,$31,$36,$5F,$74,$00
+S000B	:=	S0017+1
+S000E	:=	S001A+1
+S0011	:=	S001A+1
+S0008	:=	S0017+1
+S0014:
+	.byte	$75,$69,$6E,$74,$38,$5F,$74,$00
+S006E:
+	.byte	$73,$69,$7A,$65,$5F,$74,$00
+S0005	:=	S0014+1
+S0002	:=	S0014+1
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; return failures;
+;
+	lda     _failures
+	ldx     _failures+1
+;
+; }
+;
+	rts
+
+.endproc
+
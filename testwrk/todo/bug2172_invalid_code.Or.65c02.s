@@ -0,0 +1,222 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stdout
+	.import		_fputs
+	.import		_printf
+	.export		_func
+	.export		_err
+	.export		_main
+
+.segment	"DATA"
+
+_err:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$69,$3A,$25,$64,$20,$65,$78,$70,$65,$63,$74,$3A,$31,$37,$20,$67
+	.byte	$6F,$74,$3A,$25,$64,$0A,$00
+S0003:
+	.byte	$69,$3A,$25,$64,$20,$65,$78,$70,$65,$63,$74,$3A,$31,$36,$20,$67
+	.byte	$6F,$74,$3A,$25,$64,$0A,$00
+S0001	:=	S0003+0
+S0004:
+	.byte	$73,$74,$61,$63,$6B,$20,$6D,$65,$73,$73,$65,$64,$20,$75,$70,$3F
+	.byte	$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (int expr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	bne     L0005
+	tax
+	lda     #$11
+	bra     L0008
+L0005:	ldx     #$00
+	lda     #$10
+L0008:	jsr     stax0sp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	lda     #$2A
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$FD
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	tax
+	bcc     L0020
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _func
+	jsr     stax0sp
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$FD
+	txa
+	sbc     #$FF
+	bvc     L0007
+	eor     #$80
+L0007:	jmi     L000A
+	ldy     #$03
+	jsr     ldaxysp
+	txa
+	jpl     L000A
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0022
+	lda     (c_sp)
+	cmp     #$10
+	beq     L0004
+L0022:	inc     _err
+	bne     L0004
+	inc     _err+1
+L0004:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0002
+L0020:	jsr     _func
+	jsr     stax0sp
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	jsr     push0
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0023
+	lda     (c_sp)
+	cmp     #$11
+	beq     L0010
+L0023:	inc     _err
+	bne     L0010
+	inc     _err+1
+L0010:	ldx     #$00
+	tya
+	iny
+	jsr     staxysp
+L0011:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	bpl     L0012
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _func
+	jsr     stax0sp
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0017
+	eor     #$80
+L0017:	bmi     L000A
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvs     L0019
+	eor     #$80
+L0019:	bmi     L000A
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0024
+	lda     (c_sp)
+	cmp     #$10
+	beq     L0013
+L0024:	inc     _err
+	bne     L0013
+	inc     _err+1
+L0013:	iny
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	bra     L0011
+L0012:	lda     _err
+	ldx     _err+1
+	rts
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fputs
+	ldx     #$FF
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+M0002:
+	.word	$0000
+
+.endproc
+
@@ -0,0 +1,358 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug2172_invalid_code.c", 1044, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.dbg		sym, "stdout", "00", extern, "_stdout"
+	.import		_stdout
+	.import		_fputs
+	.import		_printf
+	.export		_func
+	.export		_err
+	.export		_main
+
+.segment	"DATA"
+
+_err:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$69,$3A,$25,$64,$20,$65,$78,$70,$65,$63,$74,$3A,$31,$37,$20,$67
+	.byte	$6F,$74,$3A,$25,$64,$0A,$00
+S0003:
+	.byte	$69,$3A,$25,$64,$20,$65,$78,$70,$65,$63,$74,$3A,$31,$36,$20,$67
+	.byte	$6F,$74,$3A,$25,$64,$0A,$00
+S0001	:=	S0003+0
+S0004:
+	.byte	$73,$74,$61,$63,$6B,$20,$6D,$65,$73,$73,$65,$64,$20,$75,$70,$3F
+	.byte	$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (int expr)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+	.dbg	func, "func", "00", static, "_func"
+	.dbg	sym, "expr", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "bug2172_invalid_code.c", 9
+	jsr     pushax
+	.dbg	line, "bug2172_invalid_code.c", 10
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "bug2172_invalid_code.c", 18
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0005
+	jmp     L0005
+	.dbg	line, "bug2172_invalid_code.c", 12
+	jsr     decsp2
+	.dbg	line, "bug2172_invalid_code.c", 13
+L0004:	ldx     #$00
+	lda     #$11
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172_invalid_code.c", 14
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incsp2
+	jmp     L0003
+	.dbg	line, "bug2172_invalid_code.c", 16
+L0005:	ldx     #$00
+	lda     #$10
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172_invalid_code.c", 17
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incsp2
+	jmp     L0003
+	.dbg	line, "bug2172_invalid_code.c", 19
+L0003:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug2172_invalid_code.c", 25
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "bug2172_invalid_code.c", 26
+	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	.dbg	line, "bug2172_invalid_code.c", 27
+	ldx     #$FF
+	lda     #$FD
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	jmp     L0003
+	.dbg	line, "bug2172_invalid_code.c", 28
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _func
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172_invalid_code.c", 29
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$FD
+	txa
+	sbc     #$FF
+	bvc     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0008
+	ldy     #$03
+	jsr     ldaxysp
+	txa
+	jsr     boolge
+	jne     L0008
+	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0008:	ldx     #$00
+	lda     #$01
+L0009:	jeq     L0006
+	.dbg	line, "bug2172_invalid_code.c", 30
+	pha
+	lda     M0001
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0001+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000A
+	.dbg	line, "bug2172_invalid_code.c", 32
+L0006:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug2172_invalid_code.c", 33
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$10
+L000C:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "bug2172_invalid_code.c", 34
+	inc     _err
+	bne     L0004
+	inc     _err+1
+	.dbg	line, "bug2172_invalid_code.c", 27
+L0004:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+	.dbg	line, "bug2172_invalid_code.c", 37
+L0003:	ldx     #$00
+	lda     #$00
+	jsr     _func
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172_invalid_code.c", 38
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug2172_invalid_code.c", 39
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000F
+	cmp     #$11
+L000F:	jsr     boolne
+	jeq     L0010
+	.dbg	line, "bug2172_invalid_code.c", 40
+	inc     _err
+	bne     L0010
+	inc     _err+1
+	.dbg	line, "bug2172_invalid_code.c", 42
+L0010:	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+L0011:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	jmp     L0012
+	.dbg	line, "bug2172_invalid_code.c", 43
+L0014:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _func
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172_invalid_code.c", 44
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0017
+	eor     #$80
+L0017:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0018
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvs     L0019
+	eor     #$80
+L0019:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0018
+	ldx     #$00
+	lda     #$00
+	jeq     L001A
+L0018:	ldx     #$00
+	lda     #$01
+L001A:	jeq     L0016
+	.dbg	line, "bug2172_invalid_code.c", 45
+	pha
+	lda     M0002
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0002+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L000A
+	.dbg	line, "bug2172_invalid_code.c", 47
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug2172_invalid_code.c", 48
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001C
+	cmp     #$10
+L001C:	jsr     boolne
+	jeq     L0013
+	.dbg	line, "bug2172_invalid_code.c", 49
+	inc     _err
+	bne     L0013
+	inc     _err+1
+	.dbg	line, "bug2172_invalid_code.c", 42
+L0013:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+	.dbg	line, "bug2172_invalid_code.c", 52
+L0012:	lda     _err
+	ldx     _err+1
+	jmp     L0001
+	.dbg	line, "bug2172_invalid_code.c", 54
+L000A:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     _fputs
+	.dbg	line, "bug2172_invalid_code.c", 55
+	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+	.dbg	line, "bug2172_invalid_code.c", 56
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+M0002:
+	.word	$0000
+
+.endproc
+
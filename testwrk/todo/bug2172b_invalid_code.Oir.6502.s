@@ -0,0 +1,159 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_func
+	.export		_err
+	.export		_main
+
+.segment	"DATA"
+
+_err:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$6E,$3A,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (int m)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	lda     #$D6
+	ldx     #$FF
+	jsr     pusheax
+	jsr     ldeax0sp
+	ldy     sreg+1
+	cpy     #$00
+	bne     L0010
+	ldy     sreg
+	cpy     #$7E
+	bne     L0011
+	cpx     #$FF
+	bne     L0005
+	cmp     #$00
+	beq     L000E
+	jmp     L0005
+L0011:	cpy     #$7F
+	bne     L0005
+	cpx     #$FF
+	bne     L0005
+	cmp     #$00
+	beq     L0013
+	cmp     #$01
+	beq     L0008
+	jmp     L0005
+L0010:	cpy     #$7E
+	bne     L0012
+	ldy     sreg
+	cpy     #$FF
+	bne     L0005
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+	beq     L000E
+	jmp     L0015
+L0012:	cpy     #$7F
+	bne     L0005
+	ldy     sreg
+	cpy     #$FF
+	bne     L0005
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+	beq     L0013
+L0015:	cmp     #$01
+	beq     L000A
+L0005:	ldy     #$00
+	lda     (c_sp),y
+	iny
+	ora     (c_sp),y
+	beq     L0013
+	lda     #$0D
+	ldx     #$00
+	jsr     push0ax
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$0A
+	jsr     subeqysp
+L000A:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jsr     incsp4
+	jmp     L0013
+L000E:	tax
+	lda     #$01
+	jsr     addeq0sp
+L0013:	jsr     incsp2
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jmp     incsp6
+
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$2A
+	jsr     pusha0
+	lda     #$07
+	jsr     _func
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0005
+	cmp     #$07
+	beq     L0004
+L0005:	inc     _err
+	bne     L0004
+	inc     _err+1
+L0004:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     _err
+	ldx     _err+1
+	rts
+
+.endproc
+
@@ -0,0 +1,247 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug2172b_invalid_code.c", 928, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_func
+	.export		_err
+	.export		_main
+
+.segment	"DATA"
+
+_err:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$6E,$3A,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (int m)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+	.dbg	func, "func", "00", static, "_func"
+	.dbg	sym, "m", "00", auto, 0
+	.dbg	sym, "x", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug2172b_invalid_code.c", 7
+	jsr     pushax
+	.dbg	line, "bug2172b_invalid_code.c", 8
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$D6
+	ldx     #$FF
+	jsr     pusheax
+	.dbg	line, "bug2172b_invalid_code.c", 9
+	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0002
+	.dbg	line, "bug2172b_invalid_code.c", 35
+L0002:	ldy     sreg+1
+	cpy     #$00
+	jne     L0010
+	ldy     sreg
+	cpy     #$7E
+	jne     L0011
+	cpx     #$FF
+	jne     L0005
+	cmp     #$00
+	jeq     L000E
+	jmp     L0005
+	jmp     L0005
+L0011:	cpy     #$7F
+	jne     L0005
+	cpx     #$FF
+	jne     L0005
+	cmp     #$00
+	jeq     L0006
+	cmp     #$01
+	jeq     L0008
+	jmp     L0005
+	jmp     L0005
+	jmp     L0005
+L0010:	cpy     #$7E
+	jne     L0012
+	ldy     sreg
+	cpy     #$FF
+	jne     L0005
+	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L000E
+	cmp     #$01
+	jeq     L000A
+	jmp     L0005
+	jmp     L0005
+	jmp     L0005
+L0012:	cpy     #$7F
+	jne     L0005
+	ldy     sreg
+	cpy     #$FF
+	jne     L0005
+	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0006
+	cmp     #$01
+	jeq     L000A
+	jmp     L0005
+	jmp     L0005
+	jmp     L0005
+	jmp     L0005
+	.dbg	line, "bug2172b_invalid_code.c", 11
+	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	.dbg	line, "bug2172b_invalid_code.c", 13
+L0004:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	.dbg	line, "bug2172b_invalid_code.c", 15
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "bug2172b_invalid_code.c", 16
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$0D
+	ldx     #$00
+	jsr     pusheax
+	.dbg	line, "bug2172b_invalid_code.c", 17
+	pha
+	lda     M0002
+	clc
+	adc     c_sp
+	sta     c_sp
+	lda     M0002+1
+	adc     c_sp+1
+	sta     c_sp+1
+	pla
+	jmp     L0008
+	.dbg	line, "bug2172b_invalid_code.c", 20
+L0008:	ldx     #$00
+	lda     #$01
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "bug2172b_invalid_code.c", 23
+L000A:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "bug2172b_invalid_code.c", 24
+	jsr     incsp4
+	.dbg	line, "bug2172b_invalid_code.c", 27
+L0006:	jsr     incsp2
+	jmp     L0003
+	.dbg	line, "bug2172b_invalid_code.c", 28
+	jmp     L0004
+	.dbg	line, "bug2172b_invalid_code.c", 30
+	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	.dbg	line, "bug2172b_invalid_code.c", 33
+L000E:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "bug2172b_invalid_code.c", 34
+	jsr     incsp2
+	.dbg	line, "bug2172b_invalid_code.c", 37
+L0003:	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "bug2172b_invalid_code.c", 38
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0002:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "n", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "bug2172b_invalid_code.c", 44
+	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	.dbg	line, "bug2172b_invalid_code.c", 45
+	ldx     #$00
+	lda     #$07
+	jsr     _func
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug2172b_invalid_code.c", 46
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$07
+L0003:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "bug2172b_invalid_code.c", 47
+	inc     _err
+	bne     L0004
+	inc     _err+1
+	.dbg	line, "bug2172b_invalid_code.c", 49
+L0004:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug2172b_invalid_code.c", 50
+	lda     _err
+	ldx     _err+1
+	jmp     L0001
+	.dbg	line, "bug2172b_invalid_code.c", 51
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,313 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.import		_strcmp
+	.export		_b1
+	.export		_b2
+	.export		_b3
+	.export		_b4
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$25,$30,$34,$64,$0A,$0A,$00
+S0003:
+	.byte	$25,$2E,$34,$64,$0A,$00
+S0002:
+	.byte	$25,$30,$34,$64,$0A,$00
+S0017:
+	.byte	$2D,$30,$30,$32,$33,$00
+S0012	:=	S0017+0
+S0001	:=	S0003+0
+S0008:
+	.byte	$25,$30,$34,$64,$00
+S0018:
+	.byte	$2D,$30,$32,$33,$00
+S0005:
+	.byte	$25,$2E,$34,$64,$00
+S0016	:=	S0017+1
+S000C:
+	.byte	$25,$73,$0A,$0A,$00
+S0015	:=	S0017+1
+S000E	:=	S0017+1
+S0014	:=	S0018+0
+S0010	:=	S0017+1
+S0006	:=	S0008+0
+S0007	:=	S0005+0
+S0013:
+	.byte	$25,$64,$0A,$00
+S000F	:=	S0013+0
+S000D	:=	S0013+0
+S000B:
+	.byte	$25,$73,$0A,$00
+S000A	:=	S000B+0
+S0009	:=	S000B+0
+S0011	:=	S0013+0
+
+.segment	"BSS"
+
+_b1:
+	.res	10,$00
+_b2:
+	.res	10,$00
+_b3:
+	.res	10,$00
+_b4:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$17
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$17
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp4
+	lda     #<(_b1)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b1)
+	sta     (c_sp),y
+	lda     #<(S0005)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0005)
+	sta     (c_sp),y
+	lda     #$17
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b2)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b2)
+	sta     (c_sp),y
+	lda     #<(S0006)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0006)
+	sta     (c_sp),y
+	lda     #$17
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b3)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b3)
+	sta     (c_sp),y
+	lda     #<(S0007)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0007)
+	sta     (c_sp),y
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b4)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b4)
+	sta     (c_sp),y
+	lda     #<(S0008)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0008)
+	sta     (c_sp),y
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+	beq     L0002
+L000A:	ldx     #$00
+	lda     #$01
+	rts
+L0002:	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+	beq     L0004
+L000B:	ldx     #$00
+	lda     #$01
+	rts
+L0004:	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+	beq     L0006
+L000C:	ldx     #$00
+	lda     #$01
+	rts
+L0006:	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+	beq     L000F
+L000D:	ldx     #$00
+	lda     #$01
+	rts
+L000F:	rts
+
+.endproc
+
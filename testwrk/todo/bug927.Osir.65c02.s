@@ -0,0 +1,353 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.import		_strcmp
+	.export		_b1
+	.export		_b2
+	.export		_b3
+	.export		_b4
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$25,$30,$34,$64,$0A,$0A,$00
+S0003:
+	.byte	$25,$2E,$34,$64,$0A,$00
+S0002:
+	.byte	$25,$30,$34,$64,$0A,$00
+S0017:
+	.byte	$2D,$30,$30,$32,$33,$00
+S0012	:=	S0017+0
+S0001	:=	S0003+0
+S0008:
+	.byte	$25,$30,$34,$64,$00
+S0018:
+	.byte	$2D,$30,$32,$33,$00
+S0005:
+	.byte	$25,$2E,$34,$64,$00
+S0016	:=	S0017+1
+S000C:
+	.byte	$25,$73,$0A,$0A,$00
+S0015	:=	S0017+1
+S000E	:=	S0017+1
+S0014	:=	S0018+0
+S0010	:=	S0017+1
+S0006	:=	S0008+0
+S0007	:=	S0005+0
+S0013:
+	.byte	$25,$64,$0A,$00
+S000F	:=	S0013+0
+S000D	:=	S0013+0
+S000B:
+	.byte	$25,$73,$0A,$00
+S000A	:=	S000B+0
+S0009	:=	S000B+0
+S0011	:=	S0013+0
+
+.segment	"BSS"
+
+_b1:
+	.res	10,$00
+_b2:
+	.res	10,$00
+_b3:
+	.res	10,$00
+_b4:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$17
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$17
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp4
+	lda     #<(_b1)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b1)
+	sta     (c_sp),y
+	lda     #<(S0005)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0005)
+	sta     (c_sp),y
+	lda     #$17
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b2)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b2)
+	sta     (c_sp),y
+	lda     #<(S0006)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0006)
+	sta     (c_sp),y
+	lda     #$17
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b3)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b3)
+	sta     (c_sp),y
+	lda     #<(S0007)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0007)
+	sta     (c_sp),y
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jsr     decsp4
+	lda     #<(_b4)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_b4)
+	sta     (c_sp),y
+	lda     #<(S0008)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(S0008)
+	sta     (c_sp),y
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$00
+	bra     L0002
+L0003:	tax
+	beq     L0004
+	iny
+L0002:	lda     _b1,y
+	cmp     S000E,y
+	beq     L0003
+	ldx     #$01
+	bcs     L0004
+	ldx     #$FF
+L0004:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$00
+	bra     L0005
+L0006:	tax
+	beq     L0007
+	iny
+L0005:	lda     _b2,y
+	cmp     S0010,y
+	beq     L0006
+	ldx     #$01
+	bcs     L0007
+	ldx     #$FF
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$00
+	bra     L0008
+L0009:	tax
+	beq     L000A
+	iny
+L0008:	lda     _b3,y
+	cmp     S0012,y
+	beq     L0009
+	ldx     #$01
+	bcs     L000A
+	ldx     #$FF
+L000A:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$00
+	bra     L000B
+L000C:	tax
+	beq     L000D
+	iny
+L000B:	lda     _b4,y
+	cmp     S0014,y
+	beq     L000C
+	ldx     #$01
+	bcs     L000D
+	ldx     #$FF
+L000D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	bra     L000F
+L0010:	tax
+	beq     L0011
+	iny
+L000F:	lda     _b1,y
+	cmp     S0015,y
+	beq     L0010
+	ldx     #$01
+	bcs     L0011
+	ldx     #$FF
+L0011:	cpx     #$00
+	bne     L0022
+	cmp     #$00
+	beq     L000E
+L0022:	ldx     #$00
+	lda     #$01
+	rts
+L000E:	ldy     #$00
+	bra     L0014
+L0015:	tax
+	beq     L0016
+	iny
+L0014:	lda     _b2,y
+	cmp     S0016,y
+	beq     L0015
+	ldx     #$01
+	bcs     L0016
+	ldx     #$FF
+L0016:	cpx     #$00
+	bne     L0023
+	cmp     #$00
+	beq     L0013
+L0023:	ldx     #$00
+	lda     #$01
+	rts
+L0013:	ldy     #$00
+	bra     L0019
+L001A:	tax
+	beq     L001B
+	iny
+L0019:	lda     _b3,y
+	cmp     S0017,y
+	beq     L001A
+	ldx     #$01
+	bcs     L001B
+	ldx     #$FF
+L001B:	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	beq     L0018
+L0024:	ldx     #$00
+	lda     #$01
+	rts
+L0018:	ldy     #$00
+	bra     L001E
+L001F:	tax
+	beq     L0020
+	iny
+L001E:	lda     _b4,y
+	cmp     S0018,y
+	beq     L001F
+	ldx     #$01
+	bcs     L0020
+	ldx     #$FF
+L0020:	cpx     #$00
+	bne     L0025
+	cmp     #$00
+	beq     L0027
+L0025:	ldx     #$00
+	lda     #$01
+	rts
+L0027:	rts
+
+.endproc
+
@@ -0,0 +1,329 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug927.c", 990, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.import		_strcmp
+	.export		_b1
+	.export		_b2
+	.export		_b3
+	.export		_b4
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$25,$30,$34,$64,$0A,$0A,$00
+S0003:
+	.byte	$25,$2E,$34,$64,$0A,$00
+S0002:
+	.byte	$25,$30,$34,$64,$0A,$00
+S0017:
+	.byte	$2D,$30,$30,$32,$33,$00
+S0012	:=	S0017+0
+S0001	:=	S0003+0
+S0008:
+	.byte	$25,$30,$34,$64,$00
+S0018:
+	.byte	$2D,$30,$32,$33,$00
+S0005:
+	.byte	$25,$2E,$34,$64,$00
+S0016	:=	S0017+1
+S000C:
+	.byte	$25,$73,$0A,$0A,$00
+S0015	:=	S0017+1
+S000E	:=	S0017+1
+S0014	:=	S0018+0
+S0010	:=	S0017+1
+S0006	:=	S0008+0
+S0007	:=	S0005+0
+S0013:
+	.byte	$25,$64,$0A,$00
+S000F	:=	S0013+0
+S000D	:=	S0013+0
+S000B:
+	.byte	$25,$73,$0A,$00
+S000A	:=	S000B+0
+S0009	:=	S000B+0
+S0011	:=	S0013+0
+
+.segment	"BSS"
+
+_b1:
+	.res	10,$00
+_b2:
+	.res	10,$00
+_b3:
+	.res	10,$00
+_b4:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug927.c", 21
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$17
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 22
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$17
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 23
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 24
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 26
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$17
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug927.c", 27
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$17
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug927.c", 28
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug927.c", 29
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E9
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug927.c", 31
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 32
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 33
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 34
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 36
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 37
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 38
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 39
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     _strcmp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug927.c", 41
+	lda     #<(_b1)
+	ldx     #>(_b1)
+	jsr     pushax
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug927.c", 42
+L0002:	lda     #<(_b2)
+	ldx     #>(_b2)
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jeq     L0004
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug927.c", 43
+L0004:	lda     #<(_b3)
+	ldx     #>(_b3)
+	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug927.c", 44
+L0006:	lda     #<(_b4)
+	ldx     #>(_b4)
+	jsr     pushax
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug927.c", 46
+L0008:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug927.c", 47
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,11819 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_vsprintf
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_Tests:
+	.word	$0000
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S02C9:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$2D,$74,$65,$73,$74,$3A,$20,$25,$75
+	.byte	$20,$74,$65,$73,$74,$73,$2C,$20,$25,$75,$20,$66,$61,$69,$6C,$75
+	.byte	$72,$65,$73,$0A,$00
+S0004:
+	.byte	$25,$33,$64,$3A,$20,$6E,$20,$3D,$20,$30,$78,$25,$30,$38,$6C,$58
+	.byte	$0A,$20,$20,$20,$20,$20,$6E,$20,$3D,$20,$30,$78,$25,$30,$38,$6C
+	.byte	$58,$0A,$00
+S0001:
+	.byte	$25,$33,$64,$3A,$20,$22,$25,$73,$22,$20,$28,$25,$64,$29,$0A,$20
+	.byte	$20,$20,$20,$20,$22,$25,$73,$22,$20,$28,$25,$64,$29,$0A,$00
+S02CA:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$2D,$74,$65,$73,$74,$3A,$20,$25,$75
+	.byte	$20,$74,$65,$73,$74,$73,$3A,$20,$4F,$6B,$0A,$00
+S01C7:
+	.byte	$2D,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30
+	.byte	$00
+S01E0	:=	S01C7+0
+S01E4	:=	S01C7+0
+S01C3	:=	S01C7+0
+S02BD:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$58,$31,$30,$36,$38,$00
+S02BB:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$78,$31,$30,$36,$38,$00
+S02B9:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$31,$30,$31,$35,$30,$00
+S029B:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S0299	:=	S029B+0
+S0297	:=	S029B+0
+S0295	:=	S029B+0
+S0293	:=	S029B+0
+S0291	:=	S029B+0
+S028F:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$45,$46,$39,$38,$00
+S028D:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$30,$36,$38,$00
+S028B:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$65,$66,$39,$38,$00
+S011F:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$2D,$34,$32,$30,$30,$00
+S0289	:=	S028D+0
+S0287:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$36,$31,$33,$33,$36,$00
+S0285:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$34,$32,$30,$30,$00
+S0121	:=	S0285+0
+S0282	:=	S029B+0
+S0280:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$36,$37,$36,$33,$30,$00
+S027E:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$30,$31,$35,$30,$00
+S027C	:=	S011F+0
+S027A	:=	S0285+0
+S0278	:=	S011F+0
+S0276	:=	S0285+0
+S0274:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$75,$00
+S0123	:=	S011F+0
+S0125	:=	S027E+0
+S022C:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$45,$46,$39,$38,$00
+S022A:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S0228:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$65,$66,$39,$38,$00
+S0226	:=	S022A+0
+S0224:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$36,$31,$33,$33,$36,$00
+S0222:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S0220:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$31,$36,$37,$36,$33,$30,$00
+S021E:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$31,$30,$31,$35,$30,$00
+S021C:
+	.byte	$20,$20,$20,$20,$2D,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S021A	:=	S0222+0
+S0218	:=	S021C+0
+S0216	:=	S0222+0
+S0214	:=	S022C+0
+S0212	:=	S022A+0
+S0210	:=	S0228+0
+S020E	:=	S022A+0
+S020C	:=	S0224+0
+S020A	:=	S0222+0
+S0127	:=	S0280+0
+S0207:
+	.byte	$20,$20,$20,$20,$20,$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$00
+S0205	:=	S0220+0
+S0203	:=	S021E+0
+S0201	:=	S021C+0
+S01FF	:=	S0222+0
+S01FD	:=	S021C+0
+S01FB	:=	S0222+0
+S01F9	:=	S0274+0
+S01F7:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$45,$46,$39,$38,$00
+S01F5:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01F3:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$65,$66,$39,$38,$00
+S01F1	:=	S01F5+0
+S01EF:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$36,$31,$33,$33,$36,$00
+S01ED	:=	S01C7+1
+S0129:
+	.byte	$20,$20,$20,$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$6C,$64,$00
+S012C	:=	S0285+0
+S01E8:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$36,$37,$36,$33,$30,$00
+S01E6:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$31,$35,$30,$00
+S02C1:
+	.byte	$30,$78,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01E2	:=	S01C7+1
+S02C3:
+	.byte	$30,$58,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01DE	:=	S01C7+1
+S01DA	:=	S01F7+0
+S01D8	:=	S01F5+0
+S01D6	:=	S01F3+0
+S01D4	:=	S01F5+0
+S01D2	:=	S01EF+0
+S01D0	:=	S01C7+1
+S012E	:=	S0287+0
+S0130	:=	S028D+0
+S01CB	:=	S01E8+0
+S01C9	:=	S01E6+0
+S011D	:=	S0285+0
+S01C5	:=	S01C7+1
+S02BF	:=	S01E6+0
+S01C1	:=	S01C7+1
+S01BD:
+	.byte	$45,$46,$39,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01BB:
+	.byte	$31,$30,$36,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B9:
+	.byte	$65,$66,$39,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B7	:=	S01BB+0
+S01B5:
+	.byte	$36,$31,$33,$33,$36,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B3:
+	.byte	$34,$32,$30,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B1:
+	.byte	$31,$36,$37,$36,$33,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AF:
+	.byte	$31,$30,$31,$35,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AD:
+	.byte	$2D,$34,$32,$30,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AB	:=	S01B3+0
+S01A9	:=	S01AD+0
+S01A7	:=	S01B3+0
+S01A5	:=	S01F7+0
+S01A3	:=	S01F5+0
+S01A1	:=	S01F3+0
+S019F	:=	S01F5+0
+S019D	:=	S01EF+0
+S019B	:=	S01C7+1
+S0199	:=	S01E8+0
+S0197	:=	S01E6+0
+S0195:
+	.byte	$2D,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S0193	:=	S01C7+1
+S0191	:=	S0195+0
+S018F	:=	S01C7+1
+S0132	:=	S028B+0
+S0134	:=	S028D+0
+S0170	:=	S01BD+0
+S016E	:=	S01BB+0
+S016C	:=	S01B9+0
+S016A	:=	S01BB+0
+S0168	:=	S01B5+0
+S0166	:=	S01B3+0
+S0136	:=	S028F+0
+S0163:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$6C,$64,$20,$20,$20,$00
+S0161	:=	S01B1+0
+S015F	:=	S01AF+0
+S015D	:=	S01AD+0
+S015B	:=	S01B3+0
+S0159	:=	S01AD+0
+S0157	:=	S01B3+0
+S0155:
+	.byte	$75,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S0153	:=	S028F+0
+S0151	:=	S028D+0
+S014F	:=	S028B+0
+S014D	:=	S028D+0
+S014B	:=	S0287+0
+S0149	:=	S0285+0
+S0138	:=	S0274+0
+S0146	:=	S0129+0
+S0144	:=	S0280+0
+S0142	:=	S027E+0
+S0140	:=	S011F+0
+S013E	:=	S0285+0
+S013C	:=	S011F+0
+S013A	:=	S0285+0
+S011B	:=	S0274+0
+S0165	:=	S0129+3
+S0180	:=	S0129+3
+S0182	:=	S0129+3
+S01CD	:=	S0129+3
+S01CF	:=	S0129+3
+S01EA	:=	S0129+3
+S012B	:=	S0129+3
+S01EC	:=	S0129+3
+S0209	:=	S0129+3
+S023E	:=	S0129+3
+S025B	:=	S0129+3
+S0284	:=	S0129+3
+S0018	:=	S0129+3
+S0007	:=	S0129+3
+S0148	:=	S0129+3
+S010E	:=	S0129+3
+S010C	:=	S0129+3
+S00F1	:=	S0129+3
+S00EF	:=	S0129+3
+S00D4	:=	S0129+3
+S00D2	:=	S0129+3
+S0006	:=	S0129+3
+S006E:
+	.byte	$33,$37,$37,$35,$37,$37,$36,$34,$35,$30,$35,$00
+S0086	:=	S006E+0
+S0009:
+	.byte	$68,$65,$6C,$6C,$6F,$20,$25,$25,$20,$25,$25,$00
+S008A:
+	.byte	$34,$32,$39,$30,$37,$36,$37,$31,$37,$33,$00
+S0072	:=	S008A+0
+S002E:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$25,$73,$00
+S0019	:=	S002E+0
+S0008:
+	.byte	$68,$65,$6C,$6C,$6F,$20,$25,$20,$25,$00
+S007A:
+	.byte	$46,$46,$42,$46,$45,$39,$34,$35,$00
+S007E:
+	.byte	$2D,$34,$32,$30,$30,$31,$32,$33,$00
+S006C:
+	.byte	$32,$30,$30,$31,$33,$32,$37,$33,$00
+S0082	:=	S007E+0
+S006A	:=	S007E+0
+S0066	:=	S007E+0
+S0084	:=	S006C+0
+S0217:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$64,$00
+S0219	:=	S0217+0
+S021B:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$69,$00
+S021D	:=	S021B+0
+S008E:
+	.byte	$66,$66,$62,$66,$65,$39,$34,$35,$00
+S021F:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$6F,$00
+S0221	:=	S021F+0
+S0223:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$75,$00
+S0225	:=	S0223+0
+S0076	:=	S008E+0
+S0227:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$78,$00
+S0229	:=	S0227+0
+S022B:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$58,$00
+S022D	:=	S022B+0
+S0092	:=	S007A+0
+S0080	:=	S007E+1
+S007C	:=	S007E+1
+S0070	:=	S007E+1
+S0068	:=	S007E+1
+S0064	:=	S007E+1
+S01FA:
+	.byte	$25,$31,$35,$2E,$31,$30,$63,$00
+S01FC:
+	.byte	$25,$31,$35,$2E,$31,$30,$64,$00
+S01FE	:=	S01FC+0
+S0200:
+	.byte	$25,$31,$35,$2E,$31,$30,$69,$00
+S002D:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$00
+S0202	:=	S0200+0
+S029F	:=	S0220+8
+S0204:
+	.byte	$25,$31,$35,$2E,$31,$30,$6F,$00
+S0206	:=	S0204+0
+S0208:
+	.byte	$25,$31,$35,$2E,$31,$30,$73,$00
+S020B:
+	.byte	$25,$31,$35,$2E,$31,$30,$75,$00
+S0215:
+	.byte	$25,$31,$35,$2E,$31,$30,$58,$00
+S0213	:=	S0215+0
+S0211:
+	.byte	$25,$31,$35,$2E,$31,$30,$78,$00
+S020F	:=	S0211+0
+S020D	:=	S020B+0
+S0088	:=	S007E+1
+S0281:
+	.byte	$25,$31,$35,$2E,$30,$6F,$00
+S027F	:=	S0281+0
+S027D:
+	.byte	$25,$31,$35,$2E,$30,$69,$00
+S027B	:=	S027D+0
+S0279:
+	.byte	$25,$31,$35,$2E,$30,$64,$00
+S003E	:=	S0280+9
+S0277	:=	S0279+0
+S00D0	:=	S0280+9
+S0275:
+	.byte	$25,$31,$35,$2E,$30,$63,$00
+S02C0:
+	.byte	$25,$23,$30,$31,$35,$6F,$00
+S02C2:
+	.byte	$25,$23,$30,$31,$35,$78,$00
+S029D	:=	S02B9+9
+S01BE:
+	.byte	$25,$2D,$30,$31,$35,$58,$00
+S00ED	:=	S0280+9
+S02C4:
+	.byte	$25,$23,$30,$31,$35,$58,$00
+S01BC	:=	S01BE+0
+S01BA:
+	.byte	$25,$2D,$30,$31,$35,$78,$00
+S01B8	:=	S01BA+0
+S01B6:
+	.byte	$25,$2D,$30,$31,$35,$75,$00
+S01B4	:=	S01B6+0
+S01B2:
+	.byte	$25,$2D,$30,$31,$35,$6F,$00
+S02A1	:=	S02BB+9
+S01B0	:=	S01B2+0
+S01AE:
+	.byte	$25,$2D,$30,$31,$35,$69,$00
+S0286:
+	.byte	$25,$31,$35,$2E,$30,$75,$00
+S01AC	:=	S01AE+0
+S01AA:
+	.byte	$25,$2D,$30,$31,$35,$64,$00
+S02A3:
+	.byte	$30,$78,$65,$66,$39,$38,$00
+S01A8	:=	S01AA+0
+S0288	:=	S0286+0
+S00B6	:=	S0280+9
+S028A:
+	.byte	$25,$31,$35,$2E,$30,$78,$00
+S02A5	:=	S02BD+9
+S029C:
+	.byte	$25,$31,$35,$2E,$30,$58,$00
+S0074:
+	.byte	$34,$30,$31,$36,$62,$62,$00
+S028C	:=	S028A+0
+S017E	:=	S0280+9
+S02C7:
+	.byte	$25,$64,$25,$68,$68,$6E,$00
+S0078:
+	.byte	$34,$30,$31,$36,$42,$42,$00
+S0016	:=	S0280+9
+S02A7:
+	.byte	$30,$58,$45,$46,$39,$38,$00
+S028E	:=	S029C+0
+S010A	:=	S0280+9
+S023A	:=	S0280+9
+S029A	:=	S028A+0
+S0290	:=	S029C+0
+S0292	:=	S0279+0
+S0283:
+	.byte	$25,$31,$35,$2E,$30,$73,$00
+S0294	:=	S027D+0
+S008C	:=	S0074+0
+S0296	:=	S0281+0
+S0090	:=	S0078+0
+S0257	:=	S0280+9
+S009E	:=	S0280+9
+S0298	:=	S0286+0
+S003C	:=	S02B9+10
+S00E3	:=	S0285+10
+S00E5	:=	S011F+10
+S0036	:=	S011F+10
+S00E7	:=	S0285+10
+S0042	:=	S0287+10
+S02BE:
+	.byte	$25,$23,$31,$35,$58,$00
+S02BC:
+	.byte	$25,$23,$31,$35,$78,$00
+S00A2	:=	S0287+10
+S02BA:
+	.byte	$25,$23,$31,$35,$6F,$00
+S0012	:=	S011F+10
+S00D7	:=	S0287+10
+S00E9	:=	S011F+10
+S01DB:
+	.byte	$25,$2E,$31,$35,$58,$00
+S000E	:=	S011F+10
+S01D9	:=	S01DB+0
+S01D7:
+	.byte	$25,$2E,$31,$35,$78,$00
+S01D5	:=	S01D7+0
+S00AE	:=	S011F+10
+S01D3:
+	.byte	$25,$2E,$31,$35,$75,$00
+S009C	:=	S02B9+10
+S0014	:=	S02B9+10
+S01D1	:=	S01D3+0
+S009A	:=	S011F+10
+S01CE:
+	.byte	$25,$2E,$31,$35,$73,$00
+S01CC:
+	.byte	$25,$2E,$31,$35,$6F,$00
+S02B8:
+	.byte	$25,$23,$2E,$31,$58,$00
+S01CA	:=	S01CC+0
+S01C8:
+	.byte	$25,$2E,$31,$35,$69,$00
+S00B2	:=	S011F+10
+S02B6:
+	.byte	$25,$23,$2E,$31,$78,$00
+S0096	:=	S011F+10
+S01C6	:=	S01C8+0
+S00B4	:=	S02B9+10
+S01C4:
+	.byte	$25,$2E,$31,$35,$64,$00
+S00CE	:=	S02B9+10
+S001A	:=	S0129+10
+S01C2	:=	S01C4+0
+S00BA	:=	S0287+10
+S01C0:
+	.byte	$25,$2E,$31,$35,$63,$00
+S001D	:=	S0287+10
+S00EB	:=	S02B9+10
+S02B4:
+	.byte	$25,$23,$2E,$31,$6F,$00
+S00CC	:=	S011F+10
+S02B2	:=	S02B8+0
+S02B0	:=	S02B6+0
+S02C6:
+	.byte	$25,$64,$25,$68,$6E,$00
+S00F4	:=	S0287+10
+S0232	:=	S011F+10
+S0236	:=	S011F+10
+S0111	:=	S0287+10
+S01A6:
+	.byte	$25,$30,$31,$35,$58,$00
+S01A4	:=	S01A6+0
+S00C6:
+	.byte	$2B,$34,$32,$30,$30,$00
+S0238	:=	S02B9+10
+S01A2:
+	.byte	$25,$30,$31,$35,$78,$00
+S02C8:
+	.byte	$25,$64,$25,$6C,$6E,$00
+S01A0	:=	S01A2+0
+S019E:
+	.byte	$25,$30,$31,$35,$75,$00
+S019C	:=	S019E+0
+S00C8	:=	S011F+10
+S00CA	:=	S00C6+0
+S019A:
+	.byte	$25,$30,$31,$35,$6F,$00
+S0156:
+	.byte	$25,$2D,$31,$35,$63,$00
+S0100	:=	S00C6+0
+S0158:
+	.byte	$25,$2D,$31,$35,$64,$00
+S0198	:=	S019A+0
+S015A	:=	S0158+0
+S0196:
+	.byte	$25,$30,$31,$35,$69,$00
+S015C:
+	.byte	$25,$2D,$31,$35,$69,$00
+S0194	:=	S0196+0
+S015E	:=	S015C+0
+S025E	:=	S0287+10
+S0160:
+	.byte	$25,$2D,$31,$35,$6F,$00
+S02AE	:=	S02B4+0
+S0162	:=	S0160+0
+S0192:
+	.byte	$25,$30,$31,$35,$64,$00
+S0164:
+	.byte	$25,$2D,$31,$35,$73,$00
+S0102	:=	S011F+10
+S0190	:=	S0192+0
+S0167:
+	.byte	$25,$2D,$31,$35,$75,$00
+S0108	:=	S02B9+10
+S0169	:=	S0167+0
+S0255	:=	S02B9+10
+S016B:
+	.byte	$25,$2D,$31,$35,$78,$00
+S0241	:=	S0287+10
+S016D	:=	S016B+0
+S0253	:=	S011F+10
+S016F:
+	.byte	$25,$2D,$31,$35,$58,$00
+S0106	:=	S011F+10
+S0171	:=	S016F+0
+S0185	:=	S0287+10
+S0104	:=	S00C6+0
+S017C	:=	S02B9+10
+S024F	:=	S011F+10
+S0176	:=	S011F+10
+S017A	:=	S011F+10
+S003A	:=	S011F+10
+S024A:
+	.byte	$25,$2E,$30,$58,$00
+S024D	:=	S01C7+12
+S0249	:=	S028F+11
+S0174	:=	S01C7+12
+S0248	:=	S024A+0
+S0251	:=	S01C7+12
+S0247	:=	S02BD+11
+S0246:
+	.byte	$25,$2E,$30,$78,$00
+S0245	:=	S028B+11
+S0103:
+	.byte	$25,$20,$2B,$64,$00
+S0183	:=	S01C7+12
+S0244	:=	S0246+0
+S0105:
+	.byte	$25,$20,$2B,$69,$00
+S0243	:=	S02BD+11
+S0187	:=	S02BD+11
+S0242:
+	.byte	$25,$2E,$30,$75,$00
+S0189	:=	S028B+11
+S0107	:=	S0105+0
+S018B	:=	S02BD+11
+S0240	:=	S0242+0
+S018D	:=	S028F+11
+S023F	:=	S01C7+12
+S023D:
+	.byte	$25,$2E,$30,$73,$00
+S0025	:=	S028F+11
+S0109:
+	.byte	$25,$20,$2B,$6F,$00
+S025C	:=	S01C7+12
+S010B	:=	S0109+0
+S00A6	:=	S028B+11
+S0101	:=	S0103+0
+S0260	:=	S02BD+11
+S023B:
+	.byte	$25,$2E,$30,$6F,$00
+S010D:
+	.byte	$25,$20,$2B,$73,$00
+S0262	:=	S028B+11
+S0264	:=	S02BD+11
+S0266	:=	S028F+11
+S0269:
+	.byte	$25,$2E,$30,$64,$00
+S00FF:
+	.byte	$25,$20,$2B,$63,$00
+S010F	:=	S01C7+12
+S0239	:=	S023B+0
+S026B:
+	.byte	$25,$2E,$30,$69,$00
+S026D	:=	S023B+0
+S026F	:=	S0242+0
+S0110:
+	.byte	$25,$20,$2B,$75,$00
+S0271	:=	S0246+0
+S0237	:=	S026B+0
+S0273	:=	S024A+0
+S0023	:=	S02BD+11
+S00FC	:=	S028F+11
+S0235	:=	S026B+0
+S00FA	:=	S02BD+11
+S0234	:=	S01C7+12
+S0233	:=	S0269+0
+S00F8	:=	S028B+11
+S00C2	:=	S028F+11
+S0231	:=	S0269+0
+S00F6	:=	S02BD+11
+S0230	:=	S01C7+12
+S0112	:=	S0110+0
+S0063:
+	.byte	$25,$68,$68,$58,$00
+S022F:
+	.byte	$25,$2E,$30,$63,$00
+S0021	:=	S028B+11
+S00F2	:=	S01C7+12
+S0061	:=	S0063+0
+S00C0	:=	S02BD+11
+S02C5:
+	.byte	$25,$64,$25,$6E,$00
+S00BE	:=	S028B+11
+S005F:
+	.byte	$25,$68,$68,$78,$00
+S00A8	:=	S02BD+11
+S0113	:=	S02BD+11
+S001F	:=	S02BD+11
+S00BC	:=	S02BD+11
+S0114:
+	.byte	$25,$20,$2B,$78,$00
+S005D	:=	S005F+0
+S001B	:=	S01C7+12
+S0094	:=	S01C7+12
+S00B8	:=	S01C7+12
+S005B:
+	.byte	$25,$68,$68,$75,$00
+S0137:
+	.byte	$25,$31,$35,$58,$00
+S0135	:=	S0137+0
+S0133:
+	.byte	$25,$31,$35,$78,$00
+S0059	:=	S005B+0
+S0098	:=	S01C7+12
+S0131	:=	S0133+0
+S00B0	:=	S01C7+12
+S0057:
+	.byte	$25,$68,$68,$6F,$00
+S012F:
+	.byte	$25,$31,$35,$75,$00
+S00AA	:=	S028F+11
+S0055	:=	S0057+0
+S012D	:=	S012F+0
+S00D5	:=	S01C7+12
+S012A:
+	.byte	$25,$31,$35,$73,$00
+S0053:
+	.byte	$25,$68,$68,$69,$00
+S0128:
+	.byte	$25,$31,$35,$6F,$00
+S0052:
+	.byte	$2D,$31,$30,$34,$00
+S0115	:=	S028B+11
+S0051	:=	S0053+0
+S0126	:=	S0128+0
+S0010	:=	S01C7+12
+S0124:
+	.byte	$25,$31,$35,$69,$00
+S00A0	:=	S01C7+12
+S01DD:
+	.byte	$25,$2E,$2A,$63,$00
+S004F:
+	.byte	$25,$68,$68,$64,$00
+S01DF:
+	.byte	$25,$2E,$2A,$64,$00
+S004E	:=	S0052+0
+S01E1	:=	S01DF+0
+S004D	:=	S004F+0
+S01E3:
+	.byte	$25,$2E,$2A,$69,$00
+S0122	:=	S0124+0
+S01E5	:=	S01E3+0
+S0120:
+	.byte	$25,$31,$35,$64,$00
+S01E7:
+	.byte	$25,$2E,$2A,$6F,$00
+S004A	:=	S028F+11
+S01E9	:=	S01E7+0
+S011E	:=	S0120+0
+S01EB:
+	.byte	$25,$2E,$2A,$73,$00
+S0048	:=	S02BD+11
+S00D9	:=	S02BD+11
+S01EE:
+	.byte	$25,$2E,$2A,$75,$00
+S0046	:=	S028B+11
+S01F0	:=	S01EE+0
+S000C	:=	S01C7+12
+S01F2:
+	.byte	$25,$2E,$2A,$78,$00
+S0044	:=	S02BD+11
+S01F4	:=	S01F2+0
+S00AC	:=	S01C7+12
+S01F6:
+	.byte	$25,$2E,$2A,$58,$00
+S011C:
+	.byte	$25,$31,$35,$63,$00
+S01F8	:=	S01F6+0
+S00DB	:=	S028B+11
+S0034	:=	S01C7+12
+S0040	:=	S01C7+12
+S00A4	:=	S02BD+11
+S00DD	:=	S02BD+11
+S011A:
+	.byte	$25,$20,$2B,$58,$00
+S0119	:=	S028F+11
+S00DF	:=	S028F+11
+S0038	:=	S01C7+12
+S0118	:=	S011A+0
+S0117	:=	S02BD+11
+S0178	:=	S01C7+12
+S0003	:=	S01C7+12
+S0116	:=	S0114+0
+S00E2:
+	.byte	$25,$20,$63,$00
+S00E0:
+	.byte	$25,$2B,$58,$00
+S0039:
+	.byte	$25,$68,$69,$00
+S003D:
+	.byte	$25,$68,$6F,$00
+S00E4:
+	.byte	$25,$20,$64,$00
+S0037:
+	.byte	$25,$68,$64,$00
+S00DE	:=	S00E0+0
+S00E6	:=	S00E4+0
+S003F	:=	S003D+0
+S0035	:=	S0037+0
+S00DC:
+	.byte	$25,$2B,$78,$00
+S00E8:
+	.byte	$25,$20,$69,$00
+S0041:
+	.byte	$25,$68,$75,$00
+S0043	:=	S0041+0
+S00DA	:=	S00DC+0
+S0045:
+	.byte	$25,$68,$78,$00
+S0047	:=	S0045+0
+S0049:
+	.byte	$25,$68,$58,$00
+S00D8:
+	.byte	$25,$2B,$75,$00
+S004B	:=	S0049+0
+S004C	:=	S0052+1
+S0050	:=	S0052+1
+S00D6	:=	S00D8+0
+S0054	:=	S02B9+12
+S00A9:
+	.byte	$25,$74,$58,$00
+S00D3:
+	.byte	$25,$2B,$73,$00
+S0056:
+	.byte	$32,$33,$30,$00
+S0058	:=	S0052+1
+S00D1:
+	.byte	$25,$2B,$6F,$00
+S02B7:
+	.byte	$30,$58,$31,$00
+S00CF	:=	S00D1+0
+S005A:
+	.byte	$31,$35,$32,$00
+S00EA	:=	S00E8+0
+S02B5:
+	.byte	$30,$78,$31,$00
+S00CD:
+	.byte	$25,$2B,$69,$00
+S00EC:
+	.byte	$25,$20,$6F,$00
+S00EE	:=	S00EC+0
+S00F0:
+	.byte	$25,$20,$73,$00
+S00CB	:=	S00CD+0
+S00A7:
+	.byte	$25,$74,$78,$00
+S00F3:
+	.byte	$25,$20,$75,$00
+S00F5	:=	S00F3+0
+S0065:
+	.byte	$25,$6A,$64,$00
+S00F7:
+	.byte	$25,$20,$78,$00
+S00F9	:=	S00F7+0
+S0067	:=	S0065+0
+S00FB:
+	.byte	$25,$20,$58,$00
+S0069:
+	.byte	$25,$6A,$69,$00
+S00FD	:=	S00FB+0
+S006B	:=	S0069+0
+S006D:
+	.byte	$25,$6A,$6F,$00
+S006F	:=	S006D+0
+S0071:
+	.byte	$25,$6A,$75,$00
+S0073	:=	S0071+0
+S0075:
+	.byte	$25,$6A,$78,$00
+S02AC:
+	.byte	$25,$23,$58,$00
+S018E:
+	.byte	$25,$31,$58,$00
+S018C	:=	S018E+0
+S018A:
+	.byte	$25,$31,$78,$00
+S0188	:=	S018A+0
+S0186:
+	.byte	$25,$31,$75,$00
+S0184	:=	S0186+0
+S0181:
+	.byte	$25,$31,$73,$00
+S0077	:=	S0075+0
+S017F:
+	.byte	$25,$31,$6F,$00
+S017D	:=	S017F+0
+S017B:
+	.byte	$25,$31,$69,$00
+S0179	:=	S017B+0
+S02AA:
+	.byte	$25,$23,$78,$00
+S024C:
+	.byte	$25,$2E,$63,$00
+S0177:
+	.byte	$25,$31,$64,$00
+S024E:
+	.byte	$25,$2E,$64,$00
+S0175	:=	S0177+0
+S0250	:=	S024E+0
+S0173:
+	.byte	$25,$31,$63,$00
+S0252:
+	.byte	$25,$2E,$69,$00
+S0079:
+	.byte	$25,$6A,$58,$00
+S0254	:=	S0252+0
+S007B	:=	S0079+0
+S0256:
+	.byte	$25,$2E,$6F,$00
+S00C9:
+	.byte	$25,$2B,$64,$00
+S0258	:=	S0256+0
+S02A8	:=	S02AC+0
+S025A:
+	.byte	$25,$2E,$73,$00
+S007D:
+	.byte	$25,$6C,$64,$00
+S007F	:=	S007D+0
+S025D:
+	.byte	$25,$2E,$75,$00
+S0081:
+	.byte	$25,$6C,$69,$00
+S025F	:=	S025D+0
+S0083	:=	S0081+0
+S0261:
+	.byte	$25,$2E,$78,$00
+S0085:
+	.byte	$25,$6C,$6F,$00
+S0263	:=	S0261+0
+S00A5	:=	S00A7+0
+S0265:
+	.byte	$25,$2E,$58,$00
+S0154:
+	.byte	$25,$2A,$58,$00
+S0267	:=	S0265+0
+S0087	:=	S0085+0
+S0152	:=	S0154+0
+S02A6	:=	S02AC+0
+S0150:
+	.byte	$25,$2A,$78,$00
+S00C7	:=	S00C9+0
+S0089:
+	.byte	$25,$6C,$75,$00
+S02A4	:=	S02AA+0
+S014E	:=	S0150+0
+S014C:
+	.byte	$25,$2A,$75,$00
+S008B	:=	S0089+0
+S02A2	:=	S02AA+0
+S014A	:=	S014C+0
+S00C5:
+	.byte	$25,$2B,$63,$00
+S00C3:
+	.byte	$25,$7A,$58,$00
+S008D:
+	.byte	$25,$6C,$78,$00
+S0147:
+	.byte	$25,$2A,$73,$00
+S02A0:
+	.byte	$25,$23,$6F,$00
+S00C1	:=	S00C3+0
+S0145:
+	.byte	$25,$2A,$6F,$00
+S008F	:=	S008D+0
+S00BF:
+	.byte	$25,$7A,$78,$00
+S0143	:=	S0145+0
+S0141:
+	.byte	$25,$2A,$69,$00
+S00BD	:=	S00BF+0
+S029E	:=	S02A0+0
+S0091:
+	.byte	$25,$6C,$58,$00
+S013F	:=	S0141+0
+S00BB:
+	.byte	$25,$7A,$75,$00
+S013D:
+	.byte	$25,$2A,$64,$00
+S0093	:=	S0091+0
+S00B9	:=	S00BB+0
+S013B	:=	S013D+0
+S0139:
+	.byte	$25,$2A,$63,$00
+S00B7:
+	.byte	$25,$7A,$6F,$00
+S00B5	:=	S00B7+0
+S0095:
+	.byte	$25,$74,$64,$00
+S00B3:
+	.byte	$25,$7A,$69,$00
+S0097	:=	S0095+0
+S00B1	:=	S00B3+0
+S0099:
+	.byte	$25,$74,$69,$00
+S00AF:
+	.byte	$25,$7A,$64,$00
+S009B	:=	S0099+0
+S009D:
+	.byte	$25,$74,$6F,$00
+S009F	:=	S009D+0
+S00AD	:=	S00AF+0
+S00A1:
+	.byte	$25,$74,$75,$00
+S00A3	:=	S00A1+0
+S003B	:=	S0039+0
+S00AB	:=	S00A9+0
+S0013:
+	.byte	$25,$69,$00
+S0015:
+	.byte	$25,$6F,$00
+S000F:
+	.byte	$25,$64,$00
+S0017	:=	S0015+0
+S001C:
+	.byte	$25,$75,$00
+S001E	:=	S001C+0
+S0020:
+	.byte	$25,$78,$00
+S0022	:=	S0020+0
+S0024:
+	.byte	$25,$58,$00
+S0062	:=	S028F+13
+S0060	:=	S02BD+13
+S005E	:=	S028F+13
+S005C	:=	S02BD+13
+S000B:
+	.byte	$25,$63,$00
+S0033	:=	S0020+0
+S0031	:=	S001C+0
+S000D	:=	S000F+0
+S002C	:=	S0015+0
+S002A	:=	S000F+0
+S0026	:=	S0024+0
+S0028	:=	S000B+0
+S02B3:
+	.byte	$30,$31,$00
+S0011	:=	S0013+0
+S022E	:=	S0274+14
+S02B1	:=	S01C7+15
+S0027:
+	.byte	$00,$00
+S00C4	:=	S0274+14
+S02AD	:=	S01C7+15
+S0029	:=	S01C7+15
+S02AB	:=	S01C7+15
+S002B	:=	S01C7+15
+S024B	:=	S0274+14
+S00E1	:=	S0274+14
+S0030	:=	S01C7+15
+S02A9	:=	S01C7+15
+S00FE	:=	S0274+14
+S0032	:=	S01C7+15
+S0172	:=	S0274+14
+S01BF	:=	S0274+14
+S01DC	:=	S0274+14
+S000A	:=	S0274+14
+S02AF	:=	S01C7+15
+S026A	:=	S02C9+36
+S026E	:=	S02C9+36
+S0270	:=	S02C9+36
+S0272	:=	S02C9+36
+S0268	:=	S02C9+36
+S0259	:=	S02C9+36
+S002F	:=	S02C9+36
+S023C	:=	S02C9+36
+S026C	:=	S02C9+36
+
+; ---------------------------------------------------------------
+; void __near__ OneTest (int Line, const char *RString, int RCount, const char *Format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_OneTest: near
+
+.segment	"CODE"
+
+	jsr     enter
+	ldy     #$84
+	jsr     subysp
+	inc     _Tests
+	bne     L0002
+	inc     _Tests+1
+L0002:	ldy     #$84
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$7D
+	bcc     L0003
+	inx
+L0003:	jsr     stax0sp
+	jsr     decsp4
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0004
+	inx
+L0004:	ldy     #$02
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	ldy     #$88
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$81
+	bcc     L0005
+	inx
+L0005:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     _vsprintf
+	ldy     #$82
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$81
+	bcc     L0007
+	inx
+L0007:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bne     L0008
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$02
+	bcc     L0009
+	inx
+L0009:	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$83
+	bcc     L000A
+	inx
+L000A:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+	beq     L0006
+L0008:	inc     _Failures
+	bne     L000D
+	inc     _Failures+1
+L000D:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$85
+	bcc     L000E
+	inx
+L000E:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L000F
+	inx
+L000F:	jsr     pushax
+	ldy     #$8B
+	jsr     pushwysp
+	ldy     #$8C
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$89
+	bcc     L0010
+	inx
+L0010:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$8E
+	lda     (c_sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$89
+	bcc     L0011
+	inx
+L0011:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+L0006:	ldy     #$84
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ WriteTest (int Line, const char *Format, union WriteCount *W, long Count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_WriteTest: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     pushwysp
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	tax
+	ldy     #$00
+	jsr     steaxspidx
+	jsr     decsp8
+	ldy     #$11
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #<(S0003)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0003)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	ldy     #$0F
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0C
+	jsr     _OneTest
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0002
+	inc     _Failures
+	bne     L0003
+	inc     _Failures+1
+L0003:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$09
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$0C
+	jsr     subysp
+	lda     #$64
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0006)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0006)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0007)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0007)
+	sta     (c_sp),y
+	ldy     #$08
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$67
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0008)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0008)
+	sta     (c_sp),y
+	lda     #$09
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0009)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0009)
+	sta     (c_sp),y
+	ldy     #$08
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000A)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S000B)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000C)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S000D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S000E)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S000F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S000F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0010)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0010)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0011)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0011)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0012)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0012)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0013)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0013)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0014)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0014)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0015)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0015)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$70
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0016)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0016)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0017)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0017)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$71
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0018)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0018)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0019)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0019)
+	sta     (c_sp),y
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$72
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S001B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S001B)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S001C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S001C)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$73
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S001D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S001D)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S001E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S001E)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$74
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S001F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S001F)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0020)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0020)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$75
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0021)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0021)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0022)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0022)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$76
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0023)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0023)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0024)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0024)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$77
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0025)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0025)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0026)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0026)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0027)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0027)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0028)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0028)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0029)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0029)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S002A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S002A)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S002B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S002B)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S002C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S002C)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S002D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S002D)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S002E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S002E)
+	sta     (c_sp),y
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0030)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0030)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0031)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0031)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0032)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0032)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0033)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0033)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$82
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0034)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0034)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0035)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0035)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$83
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0036)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0036)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0037)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0037)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$84
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0038)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0038)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0039)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0039)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$85
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S003A)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S003B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$86
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S003C)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S003D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$87
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S003E)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S003F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S003F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$88
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0040)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0040)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0041)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0041)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$89
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0042)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0042)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0043)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0043)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0044)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0044)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0045)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0045)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0046)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0046)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0047)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0047)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0048)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0048)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0049)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0049)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S004A)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S004B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$90
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S004C)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S004D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$91
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S004E)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S004F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S004F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$92
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0050)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0050)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0051)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0051)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$93
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0052)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0052)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0053)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0053)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$94
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0054)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0054)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0055)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0055)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$95
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0056)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0056)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0057)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0057)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$96
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0058)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0058)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0059)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0059)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$97
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S005A)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S005B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$98
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S005C)
+	sta     (c_sp),y
+	lda     #$02
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S005D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$99
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S005E)
+	sta     (c_sp),y
+	lda     #$02
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S005F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S005F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$9A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0060)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0060)
+	sta     (c_sp),y
+	lda     #$02
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0061)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0061)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$9B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0062)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0062)
+	sta     (c_sp),y
+	lda     #$02
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0063)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0063)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$9E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0064)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0064)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0065)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0065)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$9F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0066)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0066)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0067)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0067)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0068)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0068)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0069)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0069)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S006A)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S006B)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S006C)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S006D)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S006E)
+	sta     (c_sp),y
+	lda     #$0B
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S006F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S006F)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0070)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0070)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0071)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0071)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0072)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0072)
+	sta     (c_sp),y
+	lda     #$0A
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0073)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0073)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0074)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0074)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0075)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0075)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0076)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0076)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0077)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0077)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0078)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0078)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0079)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0079)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$A9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S007A)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S007B)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S007C)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S007D)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S007E)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S007F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S007F)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0080)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0080)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0081)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0081)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0082)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0082)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0083)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0083)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0084)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0084)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0085)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0085)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0086)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0086)
+	sta     (c_sp),y
+	lda     #$0B
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0087)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0087)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0088)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0088)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0089)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0089)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S008A)
+	sta     (c_sp),y
+	lda     #$0A
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S008B)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S008C)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S008D)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S008E)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S008F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S008F)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0090)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0090)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0091)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0091)
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0092)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0092)
+	sta     (c_sp),y
+	lda     #$08
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0093)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0093)
+	sta     (c_sp),y
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0094)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0094)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0095)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0095)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0096)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0096)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0097)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0097)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0098)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0098)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0099)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0099)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S009A)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S009B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S009C)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S009D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S009E)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S009F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S009F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A0)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A1)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A2)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A3)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A4)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A5)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A6)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A7)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A8)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00A9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00A9)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AA)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AB)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AC)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AC)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AD)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AD)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AE)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AE)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00AF)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00AF)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B0)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B1)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B2)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B3)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B4)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B5)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B6)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B7)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B8)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00B9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00B9)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BA)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BB)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BC)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BC)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BD)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BD)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BE)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BE)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00BF)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00BF)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C0)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C1)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C2)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C3)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C4)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C5)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C6)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C7)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C8)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00C9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00C9)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CA)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CB)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CC)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CC)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CD)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CD)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CE)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CE)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00CF)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00CF)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D0)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D1)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D2)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D3)
+	sta     (c_sp),y
+	lda     #<(S00D4)
+	ldx     #>(S00D4)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D5)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D6)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D7)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D8)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00D9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00D9)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DA)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DB)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DC)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DD)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DE)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00DF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00DF)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E0)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E1)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E2)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E3)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E4)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E5)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E6)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E7)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E8)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$ED
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00E9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00E9)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00EA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00EA)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00EB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00EB)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00EC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00EC)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00ED)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00ED)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00EE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00EE)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00EF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00EF)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F0)
+	sta     (c_sp),y
+	lda     #<(S00F1)
+	ldx     #>(S00F1)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F2)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F3)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F4)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F5)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F6)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F7)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F8)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00F9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00F9)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FA)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FB)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FC)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FC)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FD)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FD)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FE)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FE)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S00FF)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S00FF)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0100)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0100)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0101)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0101)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0102)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0102)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0103)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0103)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0104)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0104)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0105)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0105)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0106)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0106)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0107)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0107)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0108)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0108)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0109)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0109)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S010A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S010A)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S010B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S010B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$00
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S010C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S010C)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S010D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S010D)
+	sta     (c_sp),y
+	lda     #<(S010E)
+	ldx     #>(S010E)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$01
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S010F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S010F)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0110)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0110)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$02
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0111)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0111)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0112)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0112)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$03
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0113)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0113)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0114)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0114)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$04
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0115)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0115)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0116)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0116)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$05
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0117)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0117)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0118)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0118)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$06
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0119)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0119)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S011A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S011A)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$09
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S011B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S011B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S011C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S011C)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S011D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S011D)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S011E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S011E)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S011F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S011F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0120)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0120)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0121)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0121)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0122)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0122)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0123)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0123)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0124)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0124)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0125)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0125)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0126)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0126)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0127)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0127)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0128)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0128)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$10
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0129)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0129)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S012A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S012A)
+	sta     (c_sp),y
+	lda     #<(S012B)
+	ldx     #>(S012B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$11
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S012C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S012C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S012D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S012D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$12
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S012E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S012E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S012F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S012F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$13
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0130)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0130)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0131)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0131)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$14
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0132)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0132)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0133)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0133)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$15
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0134)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0134)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0135)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0135)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$16
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0136)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0136)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0137)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0137)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$19
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0138)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0138)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0139)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0139)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S013A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S013A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S013B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S013B)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S013C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S013C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S013D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S013D)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S013E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S013E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S013F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S013F)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0140)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0140)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0141)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0141)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0142)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0142)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0143)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0143)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0144)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0144)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0145)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0145)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$20
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0146)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0146)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0147)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0147)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0148)
+	ldx     #>(S0148)
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$21
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0149)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0149)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S014A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S014A)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$22
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S014B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S014B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S014C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S014C)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$23
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S014D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S014D)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S014E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S014E)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$24
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S014F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S014F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0150)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0150)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$25
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0151)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0151)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0152)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0152)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$26
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0153)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0153)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0154)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0154)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$29
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0155)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0155)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0156)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0156)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0157)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0157)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0158)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0158)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0159)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0159)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S015A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S015A)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S015B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S015B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S015C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S015C)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S015D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S015D)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S015E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S015E)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S015F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S015F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0160)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0160)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0161)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0161)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0162)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0162)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$30
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0163)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0163)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0164)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0164)
+	sta     (c_sp),y
+	lda     #<(S0165)
+	ldx     #>(S0165)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$31
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0166)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0166)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0167)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0167)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$32
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0168)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0168)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0169)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0169)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$33
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S016A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S016A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S016B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S016B)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$34
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S016C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S016C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S016D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S016D)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$35
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S016E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S016E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S016F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S016F)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$36
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0170)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0170)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0171)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0171)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$4F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0172)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0172)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0173)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0173)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$50
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0174)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0174)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0175)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0175)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$51
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0176)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0176)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0177)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0177)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$52
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0178)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0178)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0179)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0179)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$53
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S017A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S017A)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S017B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S017B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$54
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S017C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S017C)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S017D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S017D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$55
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S017E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S017E)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S017F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S017F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$56
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0180)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0180)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0181)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0181)
+	sta     (c_sp),y
+	lda     #<(S0182)
+	ldx     #>(S0182)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$57
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0183)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0183)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0184)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0184)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$58
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0185)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0185)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0186)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0186)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$59
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0187)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0187)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0188)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0188)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$5A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0189)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0189)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S018A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S018A)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$5B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S018B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S018B)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S018C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S018C)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$5C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S018D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S018D)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S018E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S018E)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$5F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S018F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S018F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0190)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0190)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$60
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0191)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0191)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0192)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0192)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$61
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0193)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0193)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0194)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0194)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$62
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0195)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0195)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0196)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0196)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$63
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0197)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0197)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0198)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0198)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$64
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0199)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0199)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S019A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S019A)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$65
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S019B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S019B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S019C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S019C)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$66
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S019D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S019D)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S019E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S019E)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$67
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S019F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S019F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01A0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A0)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$68
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01A1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A1)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01A2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A2)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$69
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01A3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A3)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01A4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A4)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01A5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A5)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01A6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A6)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01A7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A7)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01A8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A8)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01A9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01A9)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01AA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AA)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$6F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01AB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AB)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01AC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AC)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$70
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01AD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AD)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01AE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AE)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$71
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01AF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01AF)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01B0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B0)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$72
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01B1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B1)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01B2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B2)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$73
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01B3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B3)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01B4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B4)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$74
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01B5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B5)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01B6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B6)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$75
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01B7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B7)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01B8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B8)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$76
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01B9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01B9)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01BA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BA)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$77
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01BB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BB)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01BC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BC)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$78
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01BD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BD)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01BE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BE)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01BF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01BF)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01C0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C0)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01C1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C1)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01C2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C2)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01C3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C3)
+	sta     (c_sp),y
+	lda     #$10
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01C4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C4)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01C5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C5)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01C6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C6)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$7F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01C7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C7)
+	sta     (c_sp),y
+	lda     #$10
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01C8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C8)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$80
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01C9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01C9)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01CA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01CA)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$81
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01CB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01CB)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01CC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01CC)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$82
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01CD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01CD)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01CE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01CE)
+	sta     (c_sp),y
+	lda     #<(S01CF)
+	ldx     #>(S01CF)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$83
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01D0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D0)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01D1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D1)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$84
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01D2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D2)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01D3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D3)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$85
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01D4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D4)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01D5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D5)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$86
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01D6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D6)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01D7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D7)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$87
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01D8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D8)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01D9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01D9)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$88
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01DA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DA)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01DB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DB)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01DC)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DC)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01DD)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DD)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01DE)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DE)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01DF)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01DF)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01E0)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E0)
+	sta     (c_sp),y
+	lda     #$10
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01E1)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E1)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01E2)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E2)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01E3)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E3)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$8F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01E4)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E4)
+	sta     (c_sp),y
+	lda     #$10
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01E5)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E5)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$90
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01E6)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E6)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01E7)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E7)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$91
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01E8)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E8)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01E9)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01E9)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$92
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01EA)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01EA)
+	sta     (c_sp),y
+	lda     #$0C
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01EB)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01EB)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01EC)
+	ldx     #>(S01EC)
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$93
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01ED)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01ED)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01EE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01EE)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$94
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01EF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01EF)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01F0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F0)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$95
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01F1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F1)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01F2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F2)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$96
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01F3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F3)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01F4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F4)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$97
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01F5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F5)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01F6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F6)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$98
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01F7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F7)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01F8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F8)
+	sta     (c_sp),y
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01F9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01F9)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01FA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FA)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01FB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FB)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01FC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FC)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$AF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01FD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FD)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S01FE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FE)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S01FF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S01FF)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0200)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0200)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0201)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0201)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0202)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0202)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0203)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0203)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0204)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0204)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0205)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0205)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0206)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0206)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0207)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0207)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0208)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0208)
+	sta     (c_sp),y
+	lda     #<(S0209)
+	ldx     #>(S0209)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S020A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S020A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S020B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S020B)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S020C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S020C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S020D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S020D)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S020E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S020E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S020F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S020F)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0210)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0210)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0211)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0211)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$B9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0212)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0212)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0213)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0213)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0214)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0214)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0215)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0215)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$BF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0216)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0216)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0217)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0217)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0218)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0218)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0219)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0219)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S021A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S021A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S021B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S021B)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S021C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S021C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S021D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S021D)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S021E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S021E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S021F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S021F)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0220)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0220)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0221)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0221)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0222)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0222)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0223)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0223)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0224)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0224)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0225)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0225)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0226)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0226)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0227)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0227)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0228)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0228)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0229)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0229)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$C9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S022A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S022A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S022B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S022B)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S022C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S022C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S022D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S022D)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S022E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S022E)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S022F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S022F)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0230)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0230)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0231)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0231)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$CF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0232)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0232)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0233)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0233)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0234)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0234)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0235)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0235)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0236)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0236)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0237)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0237)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0238)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0238)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0239)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0239)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S023A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S023A)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S023B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S023B)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S023C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S023C)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S023D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S023D)
+	sta     (c_sp),y
+	lda     #<(S023E)
+	ldx     #>(S023E)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S023F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S023F)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0240)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0240)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0241)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0241)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0242)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0242)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0243)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0243)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0244)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0244)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0245)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0245)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0246)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0246)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$D9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0247)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0247)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0248)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0248)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0249)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0249)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S024A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S024A)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S024B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S024B)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S024C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S024C)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S024D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S024D)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S024E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S024E)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$DF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S024F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S024F)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0250)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0250)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0251)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0251)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0252)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0252)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0253)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0253)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0254)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0254)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0255)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0255)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0256)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0256)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E3
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0257)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0257)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0258)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0258)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E4
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0259)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0259)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S025A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S025A)
+	sta     (c_sp),y
+	lda     #<(S025B)
+	ldx     #>(S025B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S025C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S025C)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S025D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S025D)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S025E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S025E)
+	sta     (c_sp),y
+	tya
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S025F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S025F)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0260)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0260)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0261)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0261)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0262)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0262)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0263)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0263)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$E9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0264)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0264)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0265)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0265)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0266)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0266)
+	sta     (c_sp),y
+	lda     #$04
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0267)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0267)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$ED
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0268)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0268)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S0269)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0269)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S026A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S026A)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S026B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S026B)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$EF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S026C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S026C)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S026D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S026D)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F0
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S026E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S026E)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S026F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S026F)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F1
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0270)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0270)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S0271)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0271)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F2
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0272)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0272)
+	sta     (c_sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S0273)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0273)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F5
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0274)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0274)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0275)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0275)
+	sta     (c_sp),y
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F6
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0276)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0276)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0277)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0277)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F7
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0278)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0278)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0279)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0279)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F8
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S027A)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S027A)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S027B)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S027B)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$F9
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S027C)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S027C)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S027D)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S027D)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FA
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S027E)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S027E)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S027F)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S027F)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FB
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0280)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0280)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0281)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0281)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FC
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0282)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0282)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0283)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0283)
+	sta     (c_sp),y
+	lda     #<(S0284)
+	ldx     #>(S0284)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FD
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0285)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0285)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0286)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0286)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FE
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0287)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0287)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0288)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0288)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$FF
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$01
+	sta     (c_sp),y
+	lda     #<(S0289)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0289)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S028A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S028A)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$00
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S028B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S028B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S028C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S028C)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$01
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S028D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S028D)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S028E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S028E)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$02
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	sta     (c_sp),y
+	lda     #<(S028F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S028F)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0290)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0290)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$05
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S0291)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0291)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0292)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0292)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$06
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S0293)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0293)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0294)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0294)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$07
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S0295)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0295)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0296)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0296)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$08
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S0297)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0297)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S0298)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S0298)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$09
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S0299)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S0299)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S029A)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S029A)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0A
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S029B)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S029B)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S029C)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S029C)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S029D)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S029D)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S029E)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S029E)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S029F)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S029F)
+	sta     (c_sp),y
+	lda     #$07
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02A0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A0)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$0F
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02A1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A1)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02A2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A2)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$10
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02A3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A3)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02A4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A4)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$11
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02A5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A5)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02A6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A6)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$12
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02A7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A7)
+	sta     (c_sp),y
+	lda     #$06
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02A8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A8)
+	sta     (c_sp),y
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$18
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02A9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02A9)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02AA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AA)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$19
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02AB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AB)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02AC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AC)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02AD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AD)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02AE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AE)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02AF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02AF)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02B0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B0)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$1E
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02B1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B1)
+	sta     (c_sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02B2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B2)
+	sta     (c_sp),y
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$21
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02B3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B3)
+	sta     (c_sp),y
+	lda     #$02
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02B4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B4)
+	sta     (c_sp),y
+	tya
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$22
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02B5)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B5)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02B6)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B6)
+	sta     (c_sp),y
+	tya
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$23
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02B7)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B7)
+	sta     (c_sp),y
+	lda     #$03
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02B8)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B8)
+	sta     (c_sp),y
+	tya
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$26
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02B9)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02B9)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02BA)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BA)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$27
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02BB)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BB)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02BC)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BC)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$28
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02BD)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BD)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02BE)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BE)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2B
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02BF)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02BF)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02C0)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C0)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2C
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C1)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C1)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02C2)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C2)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp8
+	lda     #$2D
+	ldy     #$06
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C3)
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C3)
+	sta     (c_sp),y
+	lda     #$0F
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(S02C4)
+	ldy     #$00
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C4)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	jsr     decsp6
+	lda     #$30
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C5)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C5)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0002
+	inx
+L0002:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	jsr     decsp6
+	lda     #$31
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C6)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C6)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0003
+	inx
+L0003:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	jsr     decsp6
+	lda     #$32
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C7)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C7)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0004
+	inx
+L0004:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$5A
+	jsr     _WriteTest
+	jsr     decsp6
+	lda     #$33
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$02
+	sta     (c_sp),y
+	lda     #<(S02C8)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(S02C8)
+	sta     (c_sp),y
+	lda     c_sp
+	ldx     c_sp+1
+	clc
+	adc     #$06
+	bcc     L0005
+	inx
+L0005:	ldy     #$00
+	sta     (c_sp),y
+	iny
+	txa
+	sta     (c_sp),y
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	lda     _Failures
+	ora     _Failures+1
+	beq     L0006
+	lda     #<(S02C9)
+	ldx     #>(S02C9)
+	jsr     pushax
+	lda     _Tests
+	ldx     _Tests+1
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$06
+	jmp     L0008
+L0006:	lda     #<(S02CA)
+	ldx     #>(S02CA)
+	jsr     pushax
+	lda     _Tests
+	ldx     _Tests+1
+	jsr     pushax
+	ldy     #$04
+L0008:	jsr     _printf
+	lda     _Failures
+	ldx     _Failures+1
+	rts
+
+.endproc
+
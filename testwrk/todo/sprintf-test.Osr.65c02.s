@@ -0,0 +1,6694 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_vsprintf
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_Tests:
+	.word	$0000
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S02C9:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$2D,$74,$65,$73,$74,$3A,$20,$25,$75
+	.byte	$20,$74,$65,$73,$74,$73,$2C,$20,$25,$75,$20,$66,$61,$69,$6C,$75
+	.byte	$72,$65,$73,$0A,$00
+S0004:
+	.byte	$25,$33,$64,$3A,$20,$6E,$20,$3D,$20,$30,$78,$25,$30,$38,$6C,$58
+	.byte	$0A,$20,$20,$20,$20,$20,$6E,$20,$3D,$20,$30,$78,$25,$30,$38,$6C
+	.byte	$58,$0A,$00
+S0001:
+	.byte	$25,$33,$64,$3A,$20,$22,$25,$73,$22,$20,$28,$25,$64,$29,$0A,$20
+	.byte	$20,$20,$20,$20,$22,$25,$73,$22,$20,$28,$25,$64,$29,$0A,$00
+S02CA:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$2D,$74,$65,$73,$74,$3A,$20,$25,$75
+	.byte	$20,$74,$65,$73,$74,$73,$3A,$20,$4F,$6B,$0A,$00
+S01C7:
+	.byte	$2D,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30
+	.byte	$00
+S01E0	:=	S01C7+0
+S01E4	:=	S01C7+0
+S01C3	:=	S01C7+0
+S02BD:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$58,$31,$30,$36,$38,$00
+S02BB:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$78,$31,$30,$36,$38,$00
+S02B9:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$30,$31,$30,$31,$35,$30,$00
+S029B:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S0299	:=	S029B+0
+S0297	:=	S029B+0
+S0295	:=	S029B+0
+S0293	:=	S029B+0
+S0291	:=	S029B+0
+S028F:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$45,$46,$39,$38,$00
+S028D:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$30,$36,$38,$00
+S028B:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$65,$66,$39,$38,$00
+S011F:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$2D,$34,$32,$30,$30,$00
+S0289	:=	S028D+0
+S0287:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$36,$31,$33,$33,$36,$00
+S0285:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$34,$32,$30,$30,$00
+S0121	:=	S0285+0
+S0282	:=	S029B+0
+S0280:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$36,$37,$36,$33,$30,$00
+S027E:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$31,$30,$31,$35,$30,$00
+S027C	:=	S011F+0
+S027A	:=	S0285+0
+S0278	:=	S011F+0
+S0276	:=	S0285+0
+S0274:
+	.byte	$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$75,$00
+S0123	:=	S011F+0
+S0125	:=	S027E+0
+S022C:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$45,$46,$39,$38,$00
+S022A:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S0228:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$65,$66,$39,$38,$00
+S0226	:=	S022A+0
+S0224:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$36,$31,$33,$33,$36,$00
+S0222:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S0220:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$31,$36,$37,$36,$33,$30,$00
+S021E:
+	.byte	$20,$20,$20,$20,$20,$30,$30,$30,$30,$30,$31,$30,$31,$35,$30,$00
+S021C:
+	.byte	$20,$20,$20,$20,$2D,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S021A	:=	S0222+0
+S0218	:=	S021C+0
+S0216	:=	S0222+0
+S0214	:=	S022C+0
+S0212	:=	S022A+0
+S0210	:=	S0228+0
+S020E	:=	S022A+0
+S020C	:=	S0224+0
+S020A	:=	S0222+0
+S0127	:=	S0280+0
+S0207:
+	.byte	$20,$20,$20,$20,$20,$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$00
+S0205	:=	S0220+0
+S0203	:=	S021E+0
+S0201	:=	S021C+0
+S01FF	:=	S0222+0
+S01FD	:=	S021C+0
+S01FB	:=	S0222+0
+S01F9	:=	S0274+0
+S01F7:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$45,$46,$39,$38,$00
+S01F5:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01F3:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$65,$66,$39,$38,$00
+S01F1	:=	S01F5+0
+S01EF:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$36,$31,$33,$33,$36,$00
+S01ED	:=	S01C7+1
+S0129:
+	.byte	$20,$20,$20,$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$6C,$64,$00
+S012C	:=	S0285+0
+S01E8:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$36,$37,$36,$33,$30,$00
+S01E6:
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$31,$35,$30,$00
+S02C1:
+	.byte	$30,$78,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01E2	:=	S01C7+1
+S02C3:
+	.byte	$30,$58,$30,$30,$30,$30,$30,$30,$30,$30,$30,$31,$30,$36,$38,$00
+S01DE	:=	S01C7+1
+S01DA	:=	S01F7+0
+S01D8	:=	S01F5+0
+S01D6	:=	S01F3+0
+S01D4	:=	S01F5+0
+S01D2	:=	S01EF+0
+S01D0	:=	S01C7+1
+S012E	:=	S0287+0
+S0130	:=	S028D+0
+S01CB	:=	S01E8+0
+S01C9	:=	S01E6+0
+S011D	:=	S0285+0
+S01C5	:=	S01C7+1
+S02BF	:=	S01E6+0
+S01C1	:=	S01C7+1
+S01BD:
+	.byte	$45,$46,$39,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01BB:
+	.byte	$31,$30,$36,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B9:
+	.byte	$65,$66,$39,$38,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B7	:=	S01BB+0
+S01B5:
+	.byte	$36,$31,$33,$33,$36,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B3:
+	.byte	$34,$32,$30,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01B1:
+	.byte	$31,$36,$37,$36,$33,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AF:
+	.byte	$31,$30,$31,$35,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AD:
+	.byte	$2D,$34,$32,$30,$30,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S01AB	:=	S01B3+0
+S01A9	:=	S01AD+0
+S01A7	:=	S01B3+0
+S01A5	:=	S01F7+0
+S01A3	:=	S01F5+0
+S01A1	:=	S01F3+0
+S019F	:=	S01F5+0
+S019D	:=	S01EF+0
+S019B	:=	S01C7+1
+S0199	:=	S01E8+0
+S0197	:=	S01E6+0
+S0195:
+	.byte	$2D,$30,$30,$30,$30,$30,$30,$30,$30,$30,$30,$34,$32,$30,$30,$00
+S0193	:=	S01C7+1
+S0191	:=	S0195+0
+S018F	:=	S01C7+1
+S0132	:=	S028B+0
+S0134	:=	S028D+0
+S0170	:=	S01BD+0
+S016E	:=	S01BB+0
+S016C	:=	S01B9+0
+S016A	:=	S01BB+0
+S0168	:=	S01B5+0
+S0166	:=	S01B3+0
+S0136	:=	S028F+0
+S0163:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$77,$6F,$72,$6C,$64,$20,$20,$20,$00
+S0161	:=	S01B1+0
+S015F	:=	S01AF+0
+S015D	:=	S01AD+0
+S015B	:=	S01B3+0
+S0159	:=	S01AD+0
+S0157	:=	S01B3+0
+S0155:
+	.byte	$75,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$20,$00
+S0153	:=	S028F+0
+S0151	:=	S028D+0
+S014F	:=	S028B+0
+S014D	:=	S028D+0
+S014B	:=	S0287+0
+S0149	:=	S0285+0
+S0138	:=	S0274+0
+S0146	:=	S0129+0
+S0144	:=	S0280+0
+S0142	:=	S027E+0
+S0140	:=	S011F+0
+S013E	:=	S0285+0
+S013C	:=	S011F+0
+S013A	:=	S0285+0
+S011B	:=	S0274+0
+S0165	:=	S0129+3
+S0180	:=	S0129+3
+S0182	:=	S0129+3
+S01CD	:=	S0129+3
+S01CF	:=	S0129+3
+S01EA	:=	S0129+3
+S012B	:=	S0129+3
+S01EC	:=	S0129+3
+S0209	:=	S0129+3
+S023E	:=	S0129+3
+S025B	:=	S0129+3
+S0284	:=	S0129+3
+S0018	:=	S0129+3
+S0007	:=	S0129+3
+S0148	:=	S0129+3
+S010E	:=	S0129+3
+S010C	:=	S0129+3
+S00F1	:=	S0129+3
+S00EF	:=	S0129+3
+S00D4	:=	S0129+3
+S00D2	:=	S0129+3
+S0006	:=	S0129+3
+S006E:
+	.byte	$33,$37,$37,$35,$37,$37,$36,$34,$35,$30,$35,$00
+S0086	:=	S006E+0
+S0009:
+	.byte	$68,$65,$6C,$6C,$6F,$20,$25,$25,$20,$25,$25,$00
+S008A:
+	.byte	$34,$32,$39,$30,$37,$36,$37,$31,$37,$33,$00
+S0072	:=	S008A+0
+S002E:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$25,$73,$00
+S0019	:=	S002E+0
+S0008:
+	.byte	$68,$65,$6C,$6C,$6F,$20,$25,$20,$25,$00
+S007A:
+	.byte	$46,$46,$42,$46,$45,$39,$34,$35,$00
+S007E:
+	.byte	$2D,$34,$32,$30,$30,$31,$32,$33,$00
+S006C:
+	.byte	$32,$30,$30,$31,$33,$32,$37,$33,$00
+S0082	:=	S007E+0
+S006A	:=	S007E+0
+S0066	:=	S007E+0
+S0084	:=	S006C+0
+S0217:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$64,$00
+S0219	:=	S0217+0
+S021B:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$69,$00
+S021D	:=	S021B+0
+S008E:
+	.byte	$66,$66,$62,$66,$65,$39,$34,$35,$00
+S021F:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$6F,$00
+S0221	:=	S021F+0
+S0223:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$75,$00
+S0225	:=	S0223+0
+S0076	:=	S008E+0
+S0227:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$78,$00
+S0229	:=	S0227+0
+S022B:
+	.byte	$25,$30,$31,$35,$2E,$31,$30,$58,$00
+S022D	:=	S022B+0
+S0092	:=	S007A+0
+S0080	:=	S007E+1
+S007C	:=	S007E+1
+S0070	:=	S007E+1
+S0068	:=	S007E+1
+S0064	:=	S007E+1
+S01FA:
+	.byte	$25,$31,$35,$2E,$31,$30,$63,$00
+S01FC:
+	.byte	$25,$31,$35,$2E,$31,$30,$64,$00
+S01FE	:=	S01FC+0
+S0200:
+	.byte	$25,$31,$35,$2E,$31,$30,$69,$00
+S002D:
+	.byte	$68,$65,$6C,$6C,$6F,$2C,$20,$00
+S0202	:=	S0200+0
+S029F	:=	S0220+8
+S0204:
+	.byte	$25,$31,$35,$2E,$31,$30,$6F,$00
+S0206	:=	S0204+0
+S0208:
+	.byte	$25,$31,$35,$2E,$31,$30,$73,$00
+S020B:
+	.byte	$25,$31,$35,$2E,$31,$30,$75,$00
+S0215:
+	.byte	$25,$31,$35,$2E,$31,$30,$58,$00
+S0213	:=	S0215+0
+S0211:
+	.byte	$25,$31,$35,$2E,$31,$30,$78,$00
+S020F	:=	S0211+0
+S020D	:=	S020B+0
+S0088	:=	S007E+1
+S0281:
+	.byte	$25,$31,$35,$2E,$30,$6F,$00
+S027F	:=	S0281+0
+S027D:
+	.byte	$25,$31,$35,$2E,$30,$69,$00
+S027B	:=	S027D+0
+S0279:
+	.byte	$25,$31,$35,$2E,$30,$64,$00
+S003E	:=	S0280+9
+S0277	:=	S0279+0
+S00D0	:=	S0280+9
+S0275:
+	.byte	$25,$31,$35,$2E,$30,$63,$00
+S02C0:
+	.byte	$25,$23,$30,$31,$35,$6F,$00
+S02C2:
+	.byte	$25,$23,$30,$31,$35,$78,$00
+S029D	:=	S02B9+9
+S01BE:
+	.byte	$25,$2D,$30,$31,$35,$58,$00
+S00ED	:=	S0280+9
+S02C4:
+	.byte	$25,$23,$30,$31,$35,$58,$00
+S01BC	:=	S01BE+0
+S01BA:
+	.byte	$25,$2D,$30,$31,$35,$78,$00
+S01B8	:=	S01BA+0
+S01B6:
+	.byte	$25,$2D,$30,$31,$35,$75,$00
+S01B4	:=	S01B6+0
+S01B2:
+	.byte	$25,$2D,$30,$31,$35,$6F,$00
+S02A1	:=	S02BB+9
+S01B0	:=	S01B2+0
+S01AE:
+	.byte	$25,$2D,$30,$31,$35,$69,$00
+S0286:
+	.byte	$25,$31,$35,$2E,$30,$75,$00
+S01AC	:=	S01AE+0
+S01AA:
+	.byte	$25,$2D,$30,$31,$35,$64,$00
+S02A3:
+	.byte	$30,$78,$65,$66,$39,$38,$00
+S01A8	:=	S01AA+0
+S0288	:=	S0286+0
+S00B6	:=	S0280+9
+S028A:
+	.byte	$25,$31,$35,$2E,$30,$78,$00
+S02A5	:=	S02BD+9
+S029C:
+	.byte	$25,$31,$35,$2E,$30,$58,$00
+S0074:
+	.byte	$34,$30,$31,$36,$62,$62,$00
+S028C	:=	S028A+0
+S017E	:=	S0280+9
+S02C7:
+	.byte	$25,$64,$25,$68,$68,$6E,$00
+S0078:
+	.byte	$34,$30,$31,$36,$42,$42,$00
+S0016	:=	S0280+9
+S02A7:
+	.byte	$30,$58,$45,$46,$39,$38,$00
+S028E	:=	S029C+0
+S010A	:=	S0280+9
+S023A	:=	S0280+9
+S029A	:=	S028A+0
+S0290	:=	S029C+0
+S0292	:=	S0279+0
+S0283:
+	.byte	$25,$31,$35,$2E,$30,$73,$00
+S0294	:=	S027D+0
+S008C	:=	S0074+0
+S0296	:=	S0281+0
+S0090	:=	S0078+0
+S0257	:=	S0280+9
+S009E	:=	S0280+9
+S0298	:=	S0286+0
+S003C	:=	S02B9+10
+S00E3	:=	S0285+10
+S00E5	:=	S011F+10
+S0036	:=	S011F+10
+S00E7	:=	S0285+10
+S0042	:=	S0287+10
+S02BE:
+	.byte	$25,$23,$31,$35,$58,$00
+S02BC:
+	.byte	$25,$23,$31,$35,$78,$00
+S00A2	:=	S0287+10
+S02BA:
+	.byte	$25,$23,$31,$35,$6F,$00
+S0012	:=	S011F+10
+S00D7	:=	S0287+10
+S00E9	:=	S011F+10
+S01DB:
+	.byte	$25,$2E,$31,$35,$58,$00
+S000E	:=	S011F+10
+S01D9	:=	S01DB+0
+S01D7:
+	.byte	$25,$2E,$31,$35,$78,$00
+S01D5	:=	S01D7+0
+S00AE	:=	S011F+10
+S01D3:
+	.byte	$25,$2E,$31,$35,$75,$00
+S009C	:=	S02B9+10
+S0014	:=	S02B9+10
+S01D1	:=	S01D3+0
+S009A	:=	S011F+10
+S01CE:
+	.byte	$25,$2E,$31,$35,$73,$00
+S01CC:
+	.byte	$25,$2E,$31,$35,$6F,$00
+S02B8:
+	.byte	$25,$23,$2E,$31,$58,$00
+S01CA	:=	S01CC+0
+S01C8:
+	.byte	$25,$2E,$31,$35,$69,$00
+S00B2	:=	S011F+10
+S02B6:
+	.byte	$25,$23,$2E,$31,$78,$00
+S0096	:=	S011F+10
+S01C6	:=	S01C8+0
+S00B4	:=	S02B9+10
+S01C4:
+	.byte	$25,$2E,$31,$35,$64,$00
+S00CE	:=	S02B9+10
+S001A	:=	S0129+10
+S01C2	:=	S01C4+0
+S00BA	:=	S0287+10
+S01C0:
+	.byte	$25,$2E,$31,$35,$63,$00
+S001D	:=	S0287+10
+S00EB	:=	S02B9+10
+S02B4:
+	.byte	$25,$23,$2E,$31,$6F,$00
+S00CC	:=	S011F+10
+S02B2	:=	S02B8+0
+S02B0	:=	S02B6+0
+S02C6:
+	.byte	$25,$64,$25,$68,$6E,$00
+S00F4	:=	S0287+10
+S0232	:=	S011F+10
+S0236	:=	S011F+10
+S0111	:=	S0287+10
+S01A6:
+	.byte	$25,$30,$31,$35,$58,$00
+S01A4	:=	S01A6+0
+S00C6:
+	.byte	$2B,$34,$32,$30,$30,$00
+S0238	:=	S02B9+10
+S01A2:
+	.byte	$25,$30,$31,$35,$78,$00
+S02C8:
+	.byte	$25,$64,$25,$6C,$6E,$00
+S01A0	:=	S01A2+0
+S019E:
+	.byte	$25,$30,$31,$35,$75,$00
+S019C	:=	S019E+0
+S00C8	:=	S011F+10
+S00CA	:=	S00C6+0
+S019A:
+	.byte	$25,$30,$31,$35,$6F,$00
+S0156:
+	.byte	$25,$2D,$31,$35,$63,$00
+S0100	:=	S00C6+0
+S0158:
+	.byte	$25,$2D,$31,$35,$64,$00
+S0198	:=	S019A+0
+S015A	:=	S0158+0
+S0196:
+	.byte	$25,$30,$31,$35,$69,$00
+S015C:
+	.byte	$25,$2D,$31,$35,$69,$00
+S0194	:=	S0196+0
+S015E	:=	S015C+0
+S025E	:=	S0287+10
+S0160:
+	.byte	$25,$2D,$31,$35,$6F,$00
+S02AE	:=	S02B4+0
+S0162	:=	S0160+0
+S0192:
+	.byte	$25,$30,$31,$35,$64,$00
+S0164:
+	.byte	$25,$2D,$31,$35,$73,$00
+S0102	:=	S011F+10
+S0190	:=	S0192+0
+S0167:
+	.byte	$25,$2D,$31,$35,$75,$00
+S0108	:=	S02B9+10
+S0169	:=	S0167+0
+S0255	:=	S02B9+10
+S016B:
+	.byte	$25,$2D,$31,$35,$78,$00
+S0241	:=	S0287+10
+S016D	:=	S016B+0
+S0253	:=	S011F+10
+S016F:
+	.byte	$25,$2D,$31,$35,$58,$00
+S0106	:=	S011F+10
+S0171	:=	S016F+0
+S0185	:=	S0287+10
+S0104	:=	S00C6+0
+S017C	:=	S02B9+10
+S024F	:=	S011F+10
+S0176	:=	S011F+10
+S017A	:=	S011F+10
+S003A	:=	S011F+10
+S024A:
+	.byte	$25,$2E,$30,$58,$00
+S024D	:=	S01C7+12
+S0249	:=	S028F+11
+S0174	:=	S01C7+12
+S0248	:=	S024A+0
+S0251	:=	S01C7+12
+S0247	:=	S02BD+11
+S0246:
+	.byte	$25,$2E,$30,$78,$00
+S0245	:=	S028B+11
+S0103:
+	.byte	$25,$20,$2B,$64,$00
+S0183	:=	S01C7+12
+S0244	:=	S0246+0
+S0105:
+	.byte	$25,$20,$2B,$69,$00
+S0243	:=	S02BD+11
+S0187	:=	S02BD+11
+S0242:
+	.byte	$25,$2E,$30,$75,$00
+S0189	:=	S028B+11
+S0107	:=	S0105+0
+S018B	:=	S02BD+11
+S0240	:=	S0242+0
+S018D	:=	S028F+11
+S023F	:=	S01C7+12
+S023D:
+	.byte	$25,$2E,$30,$73,$00
+S0025	:=	S028F+11
+S0109:
+	.byte	$25,$20,$2B,$6F,$00
+S025C	:=	S01C7+12
+S010B	:=	S0109+0
+S00A6	:=	S028B+11
+S0101	:=	S0103+0
+S0260	:=	S02BD+11
+S023B:
+	.byte	$25,$2E,$30,$6F,$00
+S010D:
+	.byte	$25,$20,$2B,$73,$00
+S0262	:=	S028B+11
+S0264	:=	S02BD+11
+S0266	:=	S028F+11
+S0269:
+	.byte	$25,$2E,$30,$64,$00
+S00FF:
+	.byte	$25,$20,$2B,$63,$00
+S010F	:=	S01C7+12
+S0239	:=	S023B+0
+S026B:
+	.byte	$25,$2E,$30,$69,$00
+S026D	:=	S023B+0
+S026F	:=	S0242+0
+S0110:
+	.byte	$25,$20,$2B,$75,$00
+S0271	:=	S0246+0
+S0237	:=	S026B+0
+S0273	:=	S024A+0
+S0023	:=	S02BD+11
+S00FC	:=	S028F+11
+S0235	:=	S026B+0
+S00FA	:=	S02BD+11
+S0234	:=	S01C7+12
+S0233	:=	S0269+0
+S00F8	:=	S028B+11
+S00C2	:=	S028F+11
+S0231	:=	S0269+0
+S00F6	:=	S02BD+11
+S0230	:=	S01C7+12
+S0112	:=	S0110+0
+S0063:
+	.byte	$25,$68,$68,$58,$00
+S022F:
+	.byte	$25,$2E,$30,$63,$00
+S0021	:=	S028B+11
+S00F2	:=	S01C7+12
+S0061	:=	S0063+0
+S00C0	:=	S02BD+11
+S02C5:
+	.byte	$25,$64,$25,$6E,$00
+S00BE	:=	S028B+11
+S005F:
+	.byte	$25,$68,$68,$78,$00
+S00A8	:=	S02BD+11
+S0113	:=	S02BD+11
+S001F	:=	S02BD+11
+S00BC	:=	S02BD+11
+S0114:
+	.byte	$25,$20,$2B,$78,$00
+S005D	:=	S005F+0
+S001B	:=	S01C7+12
+S0094	:=	S01C7+12
+S00B8	:=	S01C7+12
+S005B:
+	.byte	$25,$68,$68,$75,$00
+S0137:
+	.byte	$25,$31,$35,$58,$00
+S0135	:=	S0137+0
+S0133:
+	.byte	$25,$31,$35,$78,$00
+S0059	:=	S005B+0
+S0098	:=	S01C7+12
+S0131	:=	S0133+0
+S00B0	:=	S01C7+12
+S0057:
+	.byte	$25,$68,$68,$6F,$00
+S012F:
+	.byte	$25,$31,$35,$75,$00
+S00AA	:=	S028F+11
+S0055	:=	S0057+0
+S012D	:=	S012F+0
+S00D5	:=	S01C7+12
+S012A:
+	.byte	$25,$31,$35,$73,$00
+S0053:
+	.byte	$25,$68,$68,$69,$00
+S0128:
+	.byte	$25,$31,$35,$6F,$00
+S0052:
+	.byte	$2D,$31,$30,$34,$00
+S0115	:=	S028B+11
+S0051	:=	S0053+0
+S0126	:=	S0128+0
+S0010	:=	S01C7+12
+S0124:
+	.byte	$25,$31,$35,$69,$00
+S00A0	:=	S01C7+12
+S01DD:
+	.byte	$25,$2E,$2A,$63,$00
+S004F:
+	.byte	$25,$68,$68,$64,$00
+S01DF:
+	.byte	$25,$2E,$2A,$64,$00
+S004E	:=	S0052+0
+S01E1	:=	S01DF+0
+S004D	:=	S004F+0
+S01E3:
+	.byte	$25,$2E,$2A,$69,$00
+S0122	:=	S0124+0
+S01E5	:=	S01E3+0
+S0120:
+	.byte	$25,$31,$35,$64,$00
+S01E7:
+	.byte	$25,$2E,$2A,$6F,$00
+S004A	:=	S028F+11
+S01E9	:=	S01E7+0
+S011E	:=	S0120+0
+S01EB:
+	.byte	$25,$2E,$2A,$73,$00
+S0048	:=	S02BD+11
+S00D9	:=	S02BD+11
+S01EE:
+	.byte	$25,$2E,$2A,$75,$00
+S0046	:=	S028B+11
+S01F0	:=	S01EE+0
+S000C	:=	S01C7+12
+S01F2:
+	.byte	$25,$2E,$2A,$78,$00
+S0044	:=	S02BD+11
+S01F4	:=	S01F2+0
+S00AC	:=	S01C7+12
+S01F6:
+	.byte	$25,$2E,$2A,$58,$00
+S011C:
+	.byte	$25,$31,$35,$63,$00
+S01F8	:=	S01F6+0
+S00DB	:=	S028B+11
+S0034	:=	S01C7+12
+S0040	:=	S01C7+12
+S00A4	:=	S02BD+11
+S00DD	:=	S02BD+11
+S011A:
+	.byte	$25,$20,$2B,$58,$00
+S0119	:=	S028F+11
+S00DF	:=	S028F+11
+S0038	:=	S01C7+12
+S0118	:=	S011A+0
+S0117	:=	S02BD+11
+S0178	:=	S01C7+12
+S0003	:=	S01C7+12
+S0116	:=	S0114+0
+S00E2:
+	.byte	$25,$20,$63,$00
+S00E0:
+	.byte	$25,$2B,$58,$00
+S0039:
+	.byte	$25,$68,$69,$00
+S003D:
+	.byte	$25,$68,$6F,$00
+S00E4:
+	.byte	$25,$20,$64,$00
+S0037:
+	.byte	$25,$68,$64,$00
+S00DE	:=	S00E0+0
+S00E6	:=	S00E4+0
+S003F	:=	S003D+0
+S0035	:=	S0037+0
+S00DC:
+	.byte	$25,$2B,$78,$00
+S00E8:
+	.byte	$25,$20,$69,$00
+S0041:
+	.byte	$25,$68,$75,$00
+S0043	:=	S0041+0
+S00DA	:=	S00DC+0
+S0045:
+	.byte	$25,$68,$78,$00
+S0047	:=	S0045+0
+S0049:
+	.byte	$25,$68,$58,$00
+S00D8:
+	.byte	$25,$2B,$75,$00
+S004B	:=	S0049+0
+S004C	:=	S0052+1
+S0050	:=	S0052+1
+S00D6	:=	S00D8+0
+S0054	:=	S02B9+12
+S00A9:
+	.byte	$25,$74,$58,$00
+S00D3:
+	.byte	$25,$2B,$73,$00
+S0056:
+	.byte	$32,$33,$30,$00
+S0058	:=	S0052+1
+S00D1:
+	.byte	$25,$2B,$6F,$00
+S02B7:
+	.byte	$30,$58,$31,$00
+S00CF	:=	S00D1+0
+S005A:
+	.byte	$31,$35,$32,$00
+S00EA	:=	S00E8+0
+S02B5:
+	.byte	$30,$78,$31,$00
+S00CD:
+	.byte	$25,$2B,$69,$00
+S00EC:
+	.byte	$25,$20,$6F,$00
+S00EE	:=	S00EC+0
+S00F0:
+	.byte	$25,$20,$73,$00
+S00CB	:=	S00CD+0
+S00A7:
+	.byte	$25,$74,$78,$00
+S00F3:
+	.byte	$25,$20,$75,$00
+S00F5	:=	S00F3+0
+S0065:
+	.byte	$25,$6A,$64,$00
+S00F7:
+	.byte	$25,$20,$78,$00
+S00F9	:=	S00F7+0
+S0067	:=	S0065+0
+S00FB:
+	.byte	$25,$20,$58,$00
+S0069:
+	.byte	$25,$6A,$69,$00
+S00FD	:=	S00FB+0
+S006B	:=	S0069+0
+S006D:
+	.byte	$25,$6A,$6F,$00
+S006F	:=	S006D+0
+S0071:
+	.byte	$25,$6A,$75,$00
+S0073	:=	S0071+0
+S0075:
+	.byte	$25,$6A,$78,$00
+S02AC:
+	.byte	$25,$23,$58,$00
+S018E:
+	.byte	$25,$31,$58,$00
+S018C	:=	S018E+0
+S018A:
+	.byte	$25,$31,$78,$00
+S0188	:=	S018A+0
+S0186:
+	.byte	$25,$31,$75,$00
+S0184	:=	S0186+0
+S0181:
+	.byte	$25,$31,$73,$00
+S0077	:=	S0075+0
+S017F:
+	.byte	$25,$31,$6F,$00
+S017D	:=	S017F+0
+S017B:
+	.byte	$25,$31,$69,$00
+S0179	:=	S017B+0
+S02AA:
+	.byte	$25,$23,$78,$00
+S024C:
+	.byte	$25,$2E,$63,$00
+S0177:
+	.byte	$25,$31,$64,$00
+S024E:
+	.byte	$25,$2E,$64,$00
+S0175	:=	S0177+0
+S0250	:=	S024E+0
+S0173:
+	.byte	$25,$31,$63,$00
+S0252:
+	.byte	$25,$2E,$69,$00
+S0079:
+	.byte	$25,$6A,$58,$00
+S0254	:=	S0252+0
+S007B	:=	S0079+0
+S0256:
+	.byte	$25,$2E,$6F,$00
+S00C9:
+	.byte	$25,$2B,$64,$00
+S0258	:=	S0256+0
+S02A8	:=	S02AC+0
+S025A:
+	.byte	$25,$2E,$73,$00
+S007D:
+	.byte	$25,$6C,$64,$00
+S007F	:=	S007D+0
+S025D:
+	.byte	$25,$2E,$75,$00
+S0081:
+	.byte	$25,$6C,$69,$00
+S025F	:=	S025D+0
+S0083	:=	S0081+0
+S0261:
+	.byte	$25,$2E,$78,$00
+S0085:
+	.byte	$25,$6C,$6F,$00
+S0263	:=	S0261+0
+S00A5	:=	S00A7+0
+S0265:
+	.byte	$25,$2E,$58,$00
+S0154:
+	.byte	$25,$2A,$58,$00
+S0267	:=	S0265+0
+S0087	:=	S0085+0
+S0152	:=	S0154+0
+S02A6	:=	S02AC+0
+S0150:
+	.byte	$25,$2A,$78,$00
+S00C7	:=	S00C9+0
+S0089:
+	.byte	$25,$6C,$75,$00
+S02A4	:=	S02AA+0
+S014E	:=	S0150+0
+S014C:
+	.byte	$25,$2A,$75,$00
+S008B	:=	S0089+0
+S02A2	:=	S02AA+0
+S014A	:=	S014C+0
+S00C5:
+	.byte	$25,$2B,$63,$00
+S00C3:
+	.byte	$25,$7A,$58,$00
+S008D:
+	.byte	$25,$6C,$78,$00
+S0147:
+	.byte	$25,$2A,$73,$00
+S02A0:
+	.byte	$25,$23,$6F,$00
+S00C1	:=	S00C3+0
+S0145:
+	.byte	$25,$2A,$6F,$00
+S008F	:=	S008D+0
+S00BF:
+	.byte	$25,$7A,$78,$00
+S0143	:=	S0145+0
+S0141:
+	.byte	$25,$2A,$69,$00
+S00BD	:=	S00BF+0
+S029E	:=	S02A0+0
+S0091:
+	.byte	$25,$6C,$58,$00
+S013F	:=	S0141+0
+S00BB:
+	.byte	$25,$7A,$75,$00
+S013D:
+	.byte	$25,$2A,$64,$00
+S0093	:=	S0091+0
+S00B9	:=	S00BB+0
+S013B	:=	S013D+0
+S0139:
+	.byte	$25,$2A,$63,$00
+S00B7:
+	.byte	$25,$7A,$6F,$00
+S00B5	:=	S00B7+0
+S0095:
+	.byte	$25,$74,$64,$00
+S00B3:
+	.byte	$25,$7A,$69,$00
+S0097	:=	S0095+0
+S00B1	:=	S00B3+0
+S0099:
+	.byte	$25,$74,$69,$00
+S00AF:
+	.byte	$25,$7A,$64,$00
+S009B	:=	S0099+0
+S009D:
+	.byte	$25,$74,$6F,$00
+S009F	:=	S009D+0
+S00AD	:=	S00AF+0
+S00A1:
+	.byte	$25,$74,$75,$00
+S00A3	:=	S00A1+0
+S003B	:=	S0039+0
+S00AB	:=	S00A9+0
+S0013:
+	.byte	$25,$69,$00
+S0015:
+	.byte	$25,$6F,$00
+S000F:
+	.byte	$25,$64,$00
+S0017	:=	S0015+0
+S001C:
+	.byte	$25,$75,$00
+S001E	:=	S001C+0
+S0020:
+	.byte	$25,$78,$00
+S0022	:=	S0020+0
+S0024:
+	.byte	$25,$58,$00
+S0062	:=	S028F+13
+S0060	:=	S02BD+13
+S005E	:=	S028F+13
+S005C	:=	S02BD+13
+S000B:
+	.byte	$25,$63,$00
+S0033	:=	S0020+0
+S0031	:=	S001C+0
+S000D	:=	S000F+0
+S002C	:=	S0015+0
+S002A	:=	S000F+0
+S0026	:=	S0024+0
+S0028	:=	S000B+0
+S02B3:
+	.byte	$30,$31,$00
+S0011	:=	S0013+0
+S022E	:=	S0274+14
+S02B1	:=	S01C7+15
+S0027:
+	.byte	$00,$00
+S00C4	:=	S0274+14
+S02AD	:=	S01C7+15
+S0029	:=	S01C7+15
+S02AB	:=	S01C7+15
+S002B	:=	S01C7+15
+S024B	:=	S0274+14
+S00E1	:=	S0274+14
+S0030	:=	S01C7+15
+S02A9	:=	S01C7+15
+S00FE	:=	S0274+14
+S0032	:=	S01C7+15
+S0172	:=	S0274+14
+S01BF	:=	S0274+14
+S01DC	:=	S0274+14
+S000A	:=	S0274+14
+S02AF	:=	S01C7+15
+S026A	:=	S02C9+36
+S026E	:=	S02C9+36
+S0270	:=	S02C9+36
+S0272	:=	S02C9+36
+S0268	:=	S02C9+36
+S0259	:=	S02C9+36
+S002F	:=	S02C9+36
+S023C	:=	S02C9+36
+S026C	:=	S02C9+36
+
+; ---------------------------------------------------------------
+; void __near__ OneTest (int Line, const char *RString, int RCount, const char *Format, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_OneTest: near
+
+.segment	"CODE"
+
+	jsr     enter
+	ldy     #$84
+	jsr     subysp
+	inc     _Tests
+	bne     L0002
+	inc     _Tests+1
+L0002:	ldy     #$84
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$7D
+	jsr     incaxy
+	jsr     stax0sp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$7F
+	jsr     incaxy
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _vsprintf
+	ldy     #$82
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$82
+	jsr     ldaxidx
+	jsr     tosicmp
+	bne     L0004
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$84
+	jsr     ldaxidx
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+	beq     L0003
+L0004:	inc     _Failures
+	bne     L0007
+	inc     _Failures+1
+L0007:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$86
+	lda     (c_sp),y
+	jsr     leaa0sp
+	dey
+	jsr     incaxy
+	jsr     pushw
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$8B
+	jsr     pushwysp
+	ldy     #$8C
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$89
+	jsr     incaxy
+	jsr     pushw
+	ldy     #$8E
+	lda     (c_sp),y
+	jsr     leaa0sp
+	ldy     #$89
+	jsr     incaxy
+	jsr     pushw
+	ldy     #$0C
+	jsr     _printf
+L0003:	ldy     #$84
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ WriteTest (int Line, const char *Format, union WriteCount *W, long Count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_WriteTest: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	ldy     #$07
+	jsr     pushwysp
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	tax
+	ldy     #$00
+	jsr     steaxspidx
+	ldy     #$0B
+	jsr     pushwysp
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	ldy     #$0F
+	jsr     pushwysp
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0C
+	jsr     _OneTest
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0002
+	inc     _Failures
+	bne     L0003
+	inc     _Failures+1
+L0003:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     #$64
+	jsr     pusha0
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$08
+	jsr     _OneTest
+	lda     #$67
+	jsr     pusha0
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$09
+	jsr     pusha0
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$08
+	jsr     _OneTest
+	lda     #$6A
+	jsr     pusha0
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$6B
+	jsr     pusha0
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$6C
+	jsr     pusha0
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$6D
+	jsr     pusha0
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$6E
+	jsr     pusha0
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$6F
+	jsr     pusha0
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$70
+	jsr     pusha0
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$71
+	jsr     pusha0
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$72
+	jsr     pusha0
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$73
+	jsr     pusha0
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$74
+	jsr     pusha0
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$75
+	jsr     pusha0
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$76
+	jsr     pusha0
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$77
+	jsr     pusha0
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7A
+	jsr     pusha0
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7B
+	jsr     pusha0
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7C
+	jsr     pusha0
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7D
+	jsr     pusha0
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7E
+	jsr     pusha0
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$7F
+	jsr     pusha0
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$82
+	jsr     pusha0
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$83
+	jsr     pusha0
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$84
+	jsr     pusha0
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$85
+	jsr     pusha0
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$86
+	jsr     pusha0
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$87
+	jsr     pusha0
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$88
+	jsr     pusha0
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$89
+	jsr     pusha0
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$8A
+	jsr     pusha0
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$8B
+	jsr     pusha0
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$8C
+	jsr     pusha0
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$8D
+	jsr     pusha0
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$90
+	jsr     pusha0
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$91
+	jsr     pusha0
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$92
+	jsr     pusha0
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$93
+	jsr     pusha0
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$94
+	jsr     pusha0
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$95
+	jsr     pusha0
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$96
+	jsr     pusha0
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$97
+	jsr     pusha0
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$98
+	jsr     pusha0
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$99
+	jsr     pusha0
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$9A
+	jsr     pusha0
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$9B
+	jsr     pusha0
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$9E
+	jsr     pusha0
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S0065)
+	ldx     #>(S0065)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$9F
+	jsr     pusha0
+	lda     #<(S0066)
+	ldx     #>(S0066)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S0067)
+	ldx     #>(S0067)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A0
+	jsr     pusha0
+	lda     #<(S0068)
+	ldx     #>(S0068)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S0069)
+	ldx     #>(S0069)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A1
+	jsr     pusha0
+	lda     #<(S006A)
+	ldx     #>(S006A)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S006B)
+	ldx     #>(S006B)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A2
+	jsr     pusha0
+	lda     #<(S006C)
+	ldx     #>(S006C)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S006D)
+	ldx     #>(S006D)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A3
+	jsr     pusha0
+	lda     #<(S006E)
+	ldx     #>(S006E)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	lda     #<(S006F)
+	ldx     #>(S006F)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A4
+	jsr     pusha0
+	lda     #<(S0070)
+	ldx     #>(S0070)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S0071)
+	ldx     #>(S0071)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A5
+	jsr     pusha0
+	lda     #<(S0072)
+	ldx     #>(S0072)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	lda     #<(S0073)
+	ldx     #>(S0073)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A6
+	jsr     pusha0
+	lda     #<(S0074)
+	ldx     #>(S0074)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S0075)
+	ldx     #>(S0075)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A7
+	jsr     pusha0
+	lda     #<(S0076)
+	ldx     #>(S0076)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S0077)
+	ldx     #>(S0077)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A8
+	jsr     pusha0
+	lda     #<(S0078)
+	ldx     #>(S0078)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S0079)
+	ldx     #>(S0079)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$A9
+	jsr     pusha0
+	lda     #<(S007A)
+	ldx     #>(S007A)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S007B)
+	ldx     #>(S007B)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$AC
+	jsr     pusha0
+	lda     #<(S007C)
+	ldx     #>(S007C)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S007D)
+	ldx     #>(S007D)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$AD
+	jsr     pusha0
+	lda     #<(S007E)
+	ldx     #>(S007E)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S007F)
+	ldx     #>(S007F)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$AE
+	jsr     pusha0
+	lda     #<(S0080)
+	ldx     #>(S0080)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S0081)
+	ldx     #>(S0081)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$AF
+	jsr     pusha0
+	lda     #<(S0082)
+	ldx     #>(S0082)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S0083)
+	ldx     #>(S0083)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B0
+	jsr     pusha0
+	lda     #<(S0084)
+	ldx     #>(S0084)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S0085)
+	ldx     #>(S0085)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B1
+	jsr     pusha0
+	lda     #<(S0086)
+	ldx     #>(S0086)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	lda     #<(S0087)
+	ldx     #>(S0087)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B2
+	jsr     pusha0
+	lda     #<(S0088)
+	ldx     #>(S0088)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S0089)
+	ldx     #>(S0089)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B3
+	jsr     pusha0
+	lda     #<(S008A)
+	ldx     #>(S008A)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	lda     #<(S008B)
+	ldx     #>(S008B)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B4
+	jsr     pusha0
+	lda     #<(S008C)
+	ldx     #>(S008C)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S008D)
+	ldx     #>(S008D)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B5
+	jsr     pusha0
+	lda     #<(S008E)
+	ldx     #>(S008E)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S008F)
+	ldx     #>(S008F)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B6
+	jsr     pusha0
+	lda     #<(S0090)
+	ldx     #>(S0090)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S0091)
+	ldx     #>(S0091)
+	jsr     pushax
+	stz     sreg+1
+	lda     #$40
+	sta     sreg
+	lda     #$BB
+	ldx     #$16
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$B7
+	jsr     pusha0
+	lda     #<(S0092)
+	ldx     #>(S0092)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	lda     #<(S0093)
+	ldx     #>(S0093)
+	jsr     pushax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$BF
+	sta     sreg
+	lda     #$45
+	ldx     #$E9
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _OneTest
+	lda     #$BA
+	jsr     pusha0
+	lda     #<(S0094)
+	ldx     #>(S0094)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0095)
+	ldx     #>(S0095)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$BB
+	jsr     pusha0
+	lda     #<(S0096)
+	ldx     #>(S0096)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0097)
+	ldx     #>(S0097)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$BC
+	jsr     pusha0
+	lda     #<(S0098)
+	ldx     #>(S0098)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0099)
+	ldx     #>(S0099)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$BD
+	jsr     pusha0
+	lda     #<(S009A)
+	ldx     #>(S009A)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S009B)
+	ldx     #>(S009B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$BE
+	jsr     pusha0
+	lda     #<(S009C)
+	ldx     #>(S009C)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S009D)
+	ldx     #>(S009D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$BF
+	jsr     pusha0
+	lda     #<(S009E)
+	ldx     #>(S009E)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S009F)
+	ldx     #>(S009F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C0
+	jsr     pusha0
+	lda     #<(S00A0)
+	ldx     #>(S00A0)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00A1)
+	ldx     #>(S00A1)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C1
+	jsr     pusha0
+	lda     #<(S00A2)
+	ldx     #>(S00A2)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00A3)
+	ldx     #>(S00A3)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C2
+	jsr     pusha0
+	lda     #<(S00A4)
+	ldx     #>(S00A4)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00A5)
+	ldx     #>(S00A5)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C3
+	jsr     pusha0
+	lda     #<(S00A6)
+	ldx     #>(S00A6)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00A7)
+	ldx     #>(S00A7)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C4
+	jsr     pusha0
+	lda     #<(S00A8)
+	ldx     #>(S00A8)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00A9)
+	ldx     #>(S00A9)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C5
+	jsr     pusha0
+	lda     #<(S00AA)
+	ldx     #>(S00AA)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00AB)
+	ldx     #>(S00AB)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C8
+	jsr     pusha0
+	lda     #<(S00AC)
+	ldx     #>(S00AC)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00AD)
+	ldx     #>(S00AD)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$C9
+	jsr     pusha0
+	lda     #<(S00AE)
+	ldx     #>(S00AE)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00AF)
+	ldx     #>(S00AF)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CA
+	jsr     pusha0
+	lda     #<(S00B0)
+	ldx     #>(S00B0)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00B1)
+	ldx     #>(S00B1)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CB
+	jsr     pusha0
+	lda     #<(S00B2)
+	ldx     #>(S00B2)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00B3)
+	ldx     #>(S00B3)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CC
+	jsr     pusha0
+	lda     #<(S00B4)
+	ldx     #>(S00B4)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00B5)
+	ldx     #>(S00B5)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CD
+	jsr     pusha0
+	lda     #<(S00B6)
+	ldx     #>(S00B6)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S00B7)
+	ldx     #>(S00B7)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CE
+	jsr     pusha0
+	lda     #<(S00B8)
+	ldx     #>(S00B8)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00B9)
+	ldx     #>(S00B9)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$CF
+	jsr     pusha0
+	lda     #<(S00BA)
+	ldx     #>(S00BA)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00BB)
+	ldx     #>(S00BB)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D0
+	jsr     pusha0
+	lda     #<(S00BC)
+	ldx     #>(S00BC)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00BD)
+	ldx     #>(S00BD)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D1
+	jsr     pusha0
+	lda     #<(S00BE)
+	ldx     #>(S00BE)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00BF)
+	ldx     #>(S00BF)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D2
+	jsr     pusha0
+	lda     #<(S00C0)
+	ldx     #>(S00C0)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00C1)
+	ldx     #>(S00C1)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D3
+	jsr     pusha0
+	lda     #<(S00C2)
+	ldx     #>(S00C2)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00C3)
+	ldx     #>(S00C3)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D6
+	jsr     pusha0
+	lda     #<(S00C4)
+	ldx     #>(S00C4)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S00C5)
+	ldx     #>(S00C5)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D7
+	jsr     pusha0
+	lda     #<(S00C6)
+	ldx     #>(S00C6)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00C7)
+	ldx     #>(S00C7)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D8
+	jsr     pusha0
+	lda     #<(S00C8)
+	ldx     #>(S00C8)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00C9)
+	ldx     #>(S00C9)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$D9
+	jsr     pusha0
+	lda     #<(S00CA)
+	ldx     #>(S00CA)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00CB)
+	ldx     #>(S00CB)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DA
+	jsr     pusha0
+	lda     #<(S00CC)
+	ldx     #>(S00CC)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00CD)
+	ldx     #>(S00CD)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DB
+	jsr     pusha0
+	lda     #<(S00CE)
+	ldx     #>(S00CE)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00CF)
+	ldx     #>(S00CF)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DC
+	jsr     pusha0
+	lda     #<(S00D0)
+	ldx     #>(S00D0)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S00D1)
+	ldx     #>(S00D1)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DD
+	jsr     pusha0
+	lda     #<(S00D2)
+	ldx     #>(S00D2)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S00D3)
+	ldx     #>(S00D3)
+	jsr     pushax
+	lda     #<(S00D4)
+	ldx     #>(S00D4)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DE
+	jsr     pusha0
+	lda     #<(S00D5)
+	ldx     #>(S00D5)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00D6)
+	ldx     #>(S00D6)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$DF
+	jsr     pusha0
+	lda     #<(S00D7)
+	ldx     #>(S00D7)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00D8)
+	ldx     #>(S00D8)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$E0
+	jsr     pusha0
+	lda     #<(S00D9)
+	ldx     #>(S00D9)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00DA)
+	ldx     #>(S00DA)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$E1
+	jsr     pusha0
+	lda     #<(S00DB)
+	ldx     #>(S00DB)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00DC)
+	ldx     #>(S00DC)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$E2
+	jsr     pusha0
+	lda     #<(S00DD)
+	ldx     #>(S00DD)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00DE)
+	ldx     #>(S00DE)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$E3
+	jsr     pusha0
+	lda     #<(S00DF)
+	ldx     #>(S00DF)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00E0)
+	ldx     #>(S00E0)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$E9
+	jsr     pusha0
+	lda     #<(S00E1)
+	ldx     #>(S00E1)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S00E2)
+	ldx     #>(S00E2)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$EA
+	jsr     pusha0
+	lda     #<(S00E3)
+	ldx     #>(S00E3)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00E4)
+	ldx     #>(S00E4)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$EB
+	jsr     pusha0
+	lda     #<(S00E5)
+	ldx     #>(S00E5)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00E6)
+	ldx     #>(S00E6)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$EC
+	jsr     pusha0
+	lda     #<(S00E7)
+	ldx     #>(S00E7)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00E8)
+	ldx     #>(S00E8)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$ED
+	jsr     pusha0
+	lda     #<(S00E9)
+	ldx     #>(S00E9)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00EA)
+	ldx     #>(S00EA)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$EE
+	jsr     pusha0
+	lda     #<(S00EB)
+	ldx     #>(S00EB)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00EC)
+	ldx     #>(S00EC)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$EF
+	jsr     pusha0
+	lda     #<(S00ED)
+	ldx     #>(S00ED)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S00EE)
+	ldx     #>(S00EE)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F0
+	jsr     pusha0
+	lda     #<(S00EF)
+	ldx     #>(S00EF)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S00F0)
+	ldx     #>(S00F0)
+	jsr     pushax
+	lda     #<(S00F1)
+	ldx     #>(S00F1)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F1
+	jsr     pusha0
+	lda     #<(S00F2)
+	ldx     #>(S00F2)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00F3)
+	ldx     #>(S00F3)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F2
+	jsr     pusha0
+	lda     #<(S00F4)
+	ldx     #>(S00F4)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S00F5)
+	ldx     #>(S00F5)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F3
+	jsr     pusha0
+	lda     #<(S00F6)
+	ldx     #>(S00F6)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00F7)
+	ldx     #>(S00F7)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F4
+	jsr     pusha0
+	lda     #<(S00F8)
+	ldx     #>(S00F8)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00F9)
+	ldx     #>(S00F9)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F5
+	jsr     pusha0
+	lda     #<(S00FA)
+	ldx     #>(S00FA)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00FB)
+	ldx     #>(S00FB)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F6
+	jsr     pusha0
+	lda     #<(S00FC)
+	ldx     #>(S00FC)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S00FD)
+	ldx     #>(S00FD)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$F9
+	jsr     pusha0
+	lda     #<(S00FE)
+	ldx     #>(S00FE)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S00FF)
+	ldx     #>(S00FF)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FA
+	jsr     pusha0
+	lda     #<(S0100)
+	ldx     #>(S0100)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0101)
+	ldx     #>(S0101)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FB
+	jsr     pusha0
+	lda     #<(S0102)
+	ldx     #>(S0102)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0103)
+	ldx     #>(S0103)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FC
+	jsr     pusha0
+	lda     #<(S0104)
+	ldx     #>(S0104)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0105)
+	ldx     #>(S0105)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FD
+	jsr     pusha0
+	lda     #<(S0106)
+	ldx     #>(S0106)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0107)
+	ldx     #>(S0107)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FE
+	jsr     pusha0
+	lda     #<(S0108)
+	ldx     #>(S0108)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0109)
+	ldx     #>(S0109)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	lda     #$FF
+	jsr     pusha0
+	lda     #<(S010A)
+	ldx     #>(S010A)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S010B)
+	ldx     #>(S010B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$00
+	jsr     pushax
+	lda     #<(S010C)
+	ldx     #>(S010C)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S010D)
+	ldx     #>(S010D)
+	jsr     pushax
+	lda     #<(S010E)
+	ldx     #>(S010E)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	txa
+	jsr     pushax
+	lda     #<(S010F)
+	ldx     #>(S010F)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0110)
+	ldx     #>(S0110)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$02
+	jsr     pushax
+	lda     #<(S0111)
+	ldx     #>(S0111)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0112)
+	ldx     #>(S0112)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$03
+	jsr     pushax
+	lda     #<(S0113)
+	ldx     #>(S0113)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0114)
+	ldx     #>(S0114)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$04
+	jsr     pushax
+	lda     #<(S0115)
+	ldx     #>(S0115)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0116)
+	ldx     #>(S0116)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$05
+	jsr     pushax
+	lda     #<(S0117)
+	ldx     #>(S0117)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0118)
+	ldx     #>(S0118)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$06
+	jsr     pushax
+	lda     #<(S0119)
+	ldx     #>(S0119)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S011A)
+	ldx     #>(S011A)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$09
+	jsr     pushax
+	lda     #<(S011B)
+	ldx     #>(S011B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S011C)
+	ldx     #>(S011C)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0A
+	jsr     pushax
+	lda     #<(S011D)
+	ldx     #>(S011D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S011E)
+	ldx     #>(S011E)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0B
+	jsr     pushax
+	lda     #<(S011F)
+	ldx     #>(S011F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0120)
+	ldx     #>(S0120)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0C
+	jsr     pushax
+	lda     #<(S0121)
+	ldx     #>(S0121)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0122)
+	ldx     #>(S0122)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0D
+	jsr     pushax
+	lda     #<(S0123)
+	ldx     #>(S0123)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0124)
+	ldx     #>(S0124)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0E
+	jsr     pushax
+	lda     #<(S0125)
+	ldx     #>(S0125)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0126)
+	ldx     #>(S0126)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$0F
+	jsr     pushax
+	lda     #<(S0127)
+	ldx     #>(S0127)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0128)
+	ldx     #>(S0128)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$10
+	jsr     pushax
+	lda     #<(S0129)
+	ldx     #>(S0129)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S012A)
+	ldx     #>(S012A)
+	jsr     pushax
+	lda     #<(S012B)
+	ldx     #>(S012B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$11
+	jsr     pushax
+	lda     #<(S012C)
+	ldx     #>(S012C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S012D)
+	ldx     #>(S012D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$12
+	jsr     pushax
+	lda     #<(S012E)
+	ldx     #>(S012E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S012F)
+	ldx     #>(S012F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$13
+	jsr     pushax
+	lda     #<(S0130)
+	ldx     #>(S0130)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0131)
+	ldx     #>(S0131)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$14
+	jsr     pushax
+	lda     #<(S0132)
+	ldx     #>(S0132)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0133)
+	ldx     #>(S0133)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$15
+	jsr     pushax
+	lda     #<(S0134)
+	ldx     #>(S0134)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0135)
+	ldx     #>(S0135)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$16
+	jsr     pushax
+	lda     #<(S0136)
+	ldx     #>(S0136)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0137)
+	ldx     #>(S0137)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$19
+	jsr     pushax
+	lda     #<(S0138)
+	ldx     #>(S0138)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0139)
+	ldx     #>(S0139)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1A
+	jsr     pushax
+	lda     #<(S013A)
+	ldx     #>(S013A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S013B)
+	ldx     #>(S013B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1B
+	jsr     pushax
+	lda     #<(S013C)
+	ldx     #>(S013C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S013D)
+	ldx     #>(S013D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1C
+	jsr     pushax
+	lda     #<(S013E)
+	ldx     #>(S013E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S013F)
+	ldx     #>(S013F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1D
+	jsr     pushax
+	lda     #<(S0140)
+	ldx     #>(S0140)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0141)
+	ldx     #>(S0141)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1E
+	jsr     pushax
+	lda     #<(S0142)
+	ldx     #>(S0142)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0143)
+	ldx     #>(S0143)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$1F
+	jsr     pushax
+	lda     #<(S0144)
+	ldx     #>(S0144)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0145)
+	ldx     #>(S0145)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$20
+	jsr     pushax
+	lda     #<(S0146)
+	ldx     #>(S0146)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0147)
+	ldx     #>(S0147)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0148)
+	ldx     #>(S0148)
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$21
+	jsr     pushax
+	lda     #<(S0149)
+	ldx     #>(S0149)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S014A)
+	ldx     #>(S014A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$22
+	jsr     pushax
+	lda     #<(S014B)
+	ldx     #>(S014B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S014C)
+	ldx     #>(S014C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$23
+	jsr     pushax
+	lda     #<(S014D)
+	ldx     #>(S014D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S014E)
+	ldx     #>(S014E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$24
+	jsr     pushax
+	lda     #<(S014F)
+	ldx     #>(S014F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0150)
+	ldx     #>(S0150)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$25
+	jsr     pushax
+	lda     #<(S0151)
+	ldx     #>(S0151)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0152)
+	ldx     #>(S0152)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$26
+	jsr     pushax
+	lda     #<(S0153)
+	ldx     #>(S0153)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0154)
+	ldx     #>(S0154)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$29
+	jsr     pushax
+	lda     #<(S0155)
+	ldx     #>(S0155)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0156)
+	ldx     #>(S0156)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2A
+	jsr     pushax
+	lda     #<(S0157)
+	ldx     #>(S0157)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0158)
+	ldx     #>(S0158)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2B
+	jsr     pushax
+	lda     #<(S0159)
+	ldx     #>(S0159)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S015A)
+	ldx     #>(S015A)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2C
+	jsr     pushax
+	lda     #<(S015B)
+	ldx     #>(S015B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S015C)
+	ldx     #>(S015C)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2D
+	jsr     pushax
+	lda     #<(S015D)
+	ldx     #>(S015D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S015E)
+	ldx     #>(S015E)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2E
+	jsr     pushax
+	lda     #<(S015F)
+	ldx     #>(S015F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0160)
+	ldx     #>(S0160)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$2F
+	jsr     pushax
+	lda     #<(S0161)
+	ldx     #>(S0161)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0162)
+	ldx     #>(S0162)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$30
+	jsr     pushax
+	lda     #<(S0163)
+	ldx     #>(S0163)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0164)
+	ldx     #>(S0164)
+	jsr     pushax
+	lda     #<(S0165)
+	ldx     #>(S0165)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$31
+	jsr     pushax
+	lda     #<(S0166)
+	ldx     #>(S0166)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0167)
+	ldx     #>(S0167)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$32
+	jsr     pushax
+	lda     #<(S0168)
+	ldx     #>(S0168)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0169)
+	ldx     #>(S0169)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$33
+	jsr     pushax
+	lda     #<(S016A)
+	ldx     #>(S016A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S016B)
+	ldx     #>(S016B)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$34
+	jsr     pushax
+	lda     #<(S016C)
+	ldx     #>(S016C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S016D)
+	ldx     #>(S016D)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$35
+	jsr     pushax
+	lda     #<(S016E)
+	ldx     #>(S016E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S016F)
+	ldx     #>(S016F)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$36
+	jsr     pushax
+	lda     #<(S0170)
+	ldx     #>(S0170)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0171)
+	ldx     #>(S0171)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$4F
+	jsr     pushax
+	lda     #<(S0172)
+	ldx     #>(S0172)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S0173)
+	ldx     #>(S0173)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$50
+	jsr     pushax
+	lda     #<(S0174)
+	ldx     #>(S0174)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0175)
+	ldx     #>(S0175)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$51
+	jsr     pushax
+	lda     #<(S0176)
+	ldx     #>(S0176)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0177)
+	ldx     #>(S0177)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$52
+	jsr     pushax
+	lda     #<(S0178)
+	ldx     #>(S0178)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0179)
+	ldx     #>(S0179)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$53
+	jsr     pushax
+	lda     #<(S017A)
+	ldx     #>(S017A)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S017B)
+	ldx     #>(S017B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$54
+	jsr     pushax
+	lda     #<(S017C)
+	ldx     #>(S017C)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S017D)
+	ldx     #>(S017D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$55
+	jsr     pushax
+	lda     #<(S017E)
+	ldx     #>(S017E)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S017F)
+	ldx     #>(S017F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$56
+	jsr     pushax
+	lda     #<(S0180)
+	ldx     #>(S0180)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S0181)
+	ldx     #>(S0181)
+	jsr     pushax
+	lda     #<(S0182)
+	ldx     #>(S0182)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$57
+	jsr     pushax
+	lda     #<(S0183)
+	ldx     #>(S0183)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0184)
+	ldx     #>(S0184)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$58
+	jsr     pushax
+	lda     #<(S0185)
+	ldx     #>(S0185)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0186)
+	ldx     #>(S0186)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$59
+	jsr     pushax
+	lda     #<(S0187)
+	ldx     #>(S0187)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0188)
+	ldx     #>(S0188)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$5A
+	jsr     pushax
+	lda     #<(S0189)
+	ldx     #>(S0189)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S018A)
+	ldx     #>(S018A)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$5B
+	jsr     pushax
+	lda     #<(S018B)
+	ldx     #>(S018B)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S018C)
+	ldx     #>(S018C)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$5C
+	jsr     pushax
+	lda     #<(S018D)
+	ldx     #>(S018D)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S018E)
+	ldx     #>(S018E)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$5F
+	jsr     pushax
+	lda     #<(S018F)
+	ldx     #>(S018F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0190)
+	ldx     #>(S0190)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$60
+	jsr     pushax
+	lda     #<(S0191)
+	ldx     #>(S0191)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0192)
+	ldx     #>(S0192)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$61
+	jsr     pushax
+	lda     #<(S0193)
+	ldx     #>(S0193)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0194)
+	ldx     #>(S0194)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$62
+	jsr     pushax
+	lda     #<(S0195)
+	ldx     #>(S0195)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0196)
+	ldx     #>(S0196)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$63
+	jsr     pushax
+	lda     #<(S0197)
+	ldx     #>(S0197)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0198)
+	ldx     #>(S0198)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$64
+	jsr     pushax
+	lda     #<(S0199)
+	ldx     #>(S0199)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S019A)
+	ldx     #>(S019A)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$65
+	jsr     pushax
+	lda     #<(S019B)
+	ldx     #>(S019B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S019C)
+	ldx     #>(S019C)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$66
+	jsr     pushax
+	lda     #<(S019D)
+	ldx     #>(S019D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S019E)
+	ldx     #>(S019E)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$67
+	jsr     pushax
+	lda     #<(S019F)
+	ldx     #>(S019F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01A0)
+	ldx     #>(S01A0)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$68
+	jsr     pushax
+	lda     #<(S01A1)
+	ldx     #>(S01A1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01A2)
+	ldx     #>(S01A2)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$69
+	jsr     pushax
+	lda     #<(S01A3)
+	ldx     #>(S01A3)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01A4)
+	ldx     #>(S01A4)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$6A
+	jsr     pushax
+	lda     #<(S01A5)
+	ldx     #>(S01A5)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01A6)
+	ldx     #>(S01A6)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$6D
+	jsr     pushax
+	lda     #<(S01A7)
+	ldx     #>(S01A7)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01A8)
+	ldx     #>(S01A8)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$6E
+	jsr     pushax
+	lda     #<(S01A9)
+	ldx     #>(S01A9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01AA)
+	ldx     #>(S01AA)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$6F
+	jsr     pushax
+	lda     #<(S01AB)
+	ldx     #>(S01AB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01AC)
+	ldx     #>(S01AC)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$70
+	jsr     pushax
+	lda     #<(S01AD)
+	ldx     #>(S01AD)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01AE)
+	ldx     #>(S01AE)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$71
+	jsr     pushax
+	lda     #<(S01AF)
+	ldx     #>(S01AF)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01B0)
+	ldx     #>(S01B0)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$72
+	jsr     pushax
+	lda     #<(S01B1)
+	ldx     #>(S01B1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01B2)
+	ldx     #>(S01B2)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$73
+	jsr     pushax
+	lda     #<(S01B3)
+	ldx     #>(S01B3)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01B4)
+	ldx     #>(S01B4)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$74
+	jsr     pushax
+	lda     #<(S01B5)
+	ldx     #>(S01B5)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01B6)
+	ldx     #>(S01B6)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$75
+	jsr     pushax
+	lda     #<(S01B7)
+	ldx     #>(S01B7)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01B8)
+	ldx     #>(S01B8)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$76
+	jsr     pushax
+	lda     #<(S01B9)
+	ldx     #>(S01B9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01BA)
+	ldx     #>(S01BA)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$77
+	jsr     pushax
+	lda     #<(S01BB)
+	ldx     #>(S01BB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01BC)
+	ldx     #>(S01BC)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$78
+	jsr     pushax
+	lda     #<(S01BD)
+	ldx     #>(S01BD)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01BE)
+	ldx     #>(S01BE)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$7B
+	jsr     pushax
+	lda     #<(S01BF)
+	ldx     #>(S01BF)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S01C0)
+	ldx     #>(S01C0)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$7C
+	jsr     pushax
+	lda     #<(S01C1)
+	ldx     #>(S01C1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01C2)
+	ldx     #>(S01C2)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$7D
+	jsr     pushax
+	lda     #<(S01C3)
+	ldx     #>(S01C3)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	lda     #<(S01C4)
+	ldx     #>(S01C4)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$7E
+	jsr     pushax
+	lda     #<(S01C5)
+	ldx     #>(S01C5)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01C6)
+	ldx     #>(S01C6)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$7F
+	jsr     pushax
+	lda     #<(S01C7)
+	ldx     #>(S01C7)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	lda     #<(S01C8)
+	ldx     #>(S01C8)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$80
+	jsr     pushax
+	lda     #<(S01C9)
+	ldx     #>(S01C9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01CA)
+	ldx     #>(S01CA)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$81
+	jsr     pushax
+	lda     #<(S01CB)
+	ldx     #>(S01CB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01CC)
+	ldx     #>(S01CC)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$82
+	jsr     pushax
+	lda     #<(S01CD)
+	ldx     #>(S01CD)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S01CE)
+	ldx     #>(S01CE)
+	jsr     pushax
+	lda     #<(S01CF)
+	ldx     #>(S01CF)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$83
+	jsr     pushax
+	lda     #<(S01D0)
+	ldx     #>(S01D0)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01D1)
+	ldx     #>(S01D1)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$84
+	jsr     pushax
+	lda     #<(S01D2)
+	ldx     #>(S01D2)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01D3)
+	ldx     #>(S01D3)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$85
+	jsr     pushax
+	lda     #<(S01D4)
+	ldx     #>(S01D4)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01D5)
+	ldx     #>(S01D5)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$86
+	jsr     pushax
+	lda     #<(S01D6)
+	ldx     #>(S01D6)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01D7)
+	ldx     #>(S01D7)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$87
+	jsr     pushax
+	lda     #<(S01D8)
+	ldx     #>(S01D8)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01D9)
+	ldx     #>(S01D9)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$88
+	jsr     pushax
+	lda     #<(S01DA)
+	ldx     #>(S01DA)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01DB)
+	ldx     #>(S01DB)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$8B
+	jsr     pushax
+	lda     #<(S01DC)
+	ldx     #>(S01DC)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S01DD)
+	ldx     #>(S01DD)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$8C
+	jsr     pushax
+	lda     #<(S01DE)
+	ldx     #>(S01DE)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01DF)
+	ldx     #>(S01DF)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$8D
+	jsr     pushax
+	lda     #<(S01E0)
+	ldx     #>(S01E0)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	lda     #<(S01E1)
+	ldx     #>(S01E1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$8E
+	jsr     pushax
+	lda     #<(S01E2)
+	ldx     #>(S01E2)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01E3)
+	ldx     #>(S01E3)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$8F
+	jsr     pushax
+	lda     #<(S01E4)
+	ldx     #>(S01E4)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	lda     #<(S01E5)
+	ldx     #>(S01E5)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$90
+	jsr     pushax
+	lda     #<(S01E6)
+	ldx     #>(S01E6)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01E7)
+	ldx     #>(S01E7)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$91
+	jsr     pushax
+	lda     #<(S01E8)
+	ldx     #>(S01E8)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01E9)
+	ldx     #>(S01E9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$92
+	jsr     pushax
+	lda     #<(S01EA)
+	ldx     #>(S01EA)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	lda     #<(S01EB)
+	ldx     #>(S01EB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01EC)
+	ldx     #>(S01EC)
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$93
+	jsr     pushax
+	lda     #<(S01ED)
+	ldx     #>(S01ED)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01EE)
+	ldx     #>(S01EE)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$94
+	jsr     pushax
+	lda     #<(S01EF)
+	ldx     #>(S01EF)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01F0)
+	ldx     #>(S01F0)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$95
+	jsr     pushax
+	lda     #<(S01F1)
+	ldx     #>(S01F1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01F2)
+	ldx     #>(S01F2)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$96
+	jsr     pushax
+	lda     #<(S01F3)
+	ldx     #>(S01F3)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01F4)
+	ldx     #>(S01F4)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$97
+	jsr     pushax
+	lda     #<(S01F5)
+	ldx     #>(S01F5)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01F6)
+	ldx     #>(S01F6)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$98
+	jsr     pushax
+	lda     #<(S01F7)
+	ldx     #>(S01F7)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01F8)
+	ldx     #>(S01F8)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0C
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$AD
+	jsr     pushax
+	lda     #<(S01F9)
+	ldx     #>(S01F9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01FA)
+	ldx     #>(S01FA)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$AE
+	jsr     pushax
+	lda     #<(S01FB)
+	ldx     #>(S01FB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01FC)
+	ldx     #>(S01FC)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$AF
+	jsr     pushax
+	lda     #<(S01FD)
+	ldx     #>(S01FD)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S01FE)
+	ldx     #>(S01FE)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B0
+	jsr     pushax
+	lda     #<(S01FF)
+	ldx     #>(S01FF)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0200)
+	ldx     #>(S0200)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B1
+	jsr     pushax
+	lda     #<(S0201)
+	ldx     #>(S0201)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0202)
+	ldx     #>(S0202)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B2
+	jsr     pushax
+	lda     #<(S0203)
+	ldx     #>(S0203)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0204)
+	ldx     #>(S0204)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B3
+	jsr     pushax
+	lda     #<(S0205)
+	ldx     #>(S0205)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0206)
+	ldx     #>(S0206)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B4
+	jsr     pushax
+	lda     #<(S0207)
+	ldx     #>(S0207)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0208)
+	ldx     #>(S0208)
+	jsr     pushax
+	lda     #<(S0209)
+	ldx     #>(S0209)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B5
+	jsr     pushax
+	lda     #<(S020A)
+	ldx     #>(S020A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S020B)
+	ldx     #>(S020B)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B6
+	jsr     pushax
+	lda     #<(S020C)
+	ldx     #>(S020C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S020D)
+	ldx     #>(S020D)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B7
+	jsr     pushax
+	lda     #<(S020E)
+	ldx     #>(S020E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S020F)
+	ldx     #>(S020F)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B8
+	jsr     pushax
+	lda     #<(S0210)
+	ldx     #>(S0210)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0211)
+	ldx     #>(S0211)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$B9
+	jsr     pushax
+	lda     #<(S0212)
+	ldx     #>(S0212)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0213)
+	ldx     #>(S0213)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$BA
+	jsr     pushax
+	lda     #<(S0214)
+	ldx     #>(S0214)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0215)
+	ldx     #>(S0215)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$BF
+	jsr     pushax
+	lda     #<(S0216)
+	ldx     #>(S0216)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0217)
+	ldx     #>(S0217)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C0
+	jsr     pushax
+	lda     #<(S0218)
+	ldx     #>(S0218)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0219)
+	ldx     #>(S0219)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C1
+	jsr     pushax
+	lda     #<(S021A)
+	ldx     #>(S021A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S021B)
+	ldx     #>(S021B)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C2
+	jsr     pushax
+	lda     #<(S021C)
+	ldx     #>(S021C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S021D)
+	ldx     #>(S021D)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C3
+	jsr     pushax
+	lda     #<(S021E)
+	ldx     #>(S021E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S021F)
+	ldx     #>(S021F)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C4
+	jsr     pushax
+	lda     #<(S0220)
+	ldx     #>(S0220)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0221)
+	ldx     #>(S0221)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C5
+	jsr     pushax
+	lda     #<(S0222)
+	ldx     #>(S0222)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0223)
+	ldx     #>(S0223)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C6
+	jsr     pushax
+	lda     #<(S0224)
+	ldx     #>(S0224)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0225)
+	ldx     #>(S0225)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C7
+	jsr     pushax
+	lda     #<(S0226)
+	ldx     #>(S0226)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0227)
+	ldx     #>(S0227)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C8
+	jsr     pushax
+	lda     #<(S0228)
+	ldx     #>(S0228)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0229)
+	ldx     #>(S0229)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$C9
+	jsr     pushax
+	lda     #<(S022A)
+	ldx     #>(S022A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S022B)
+	ldx     #>(S022B)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$CA
+	jsr     pushax
+	lda     #<(S022C)
+	ldx     #>(S022C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S022D)
+	ldx     #>(S022D)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$CD
+	jsr     pushax
+	lda     #<(S022E)
+	ldx     #>(S022E)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S022F)
+	ldx     #>(S022F)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$CE
+	jsr     pushax
+	lda     #<(S0230)
+	ldx     #>(S0230)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0231)
+	ldx     #>(S0231)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$CF
+	jsr     pushax
+	lda     #<(S0232)
+	ldx     #>(S0232)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0233)
+	ldx     #>(S0233)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D0
+	jsr     pushax
+	lda     #<(S0234)
+	ldx     #>(S0234)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0235)
+	ldx     #>(S0235)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D1
+	jsr     pushax
+	lda     #<(S0236)
+	ldx     #>(S0236)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0237)
+	ldx     #>(S0237)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D2
+	jsr     pushax
+	lda     #<(S0238)
+	ldx     #>(S0238)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0239)
+	ldx     #>(S0239)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D3
+	jsr     pushax
+	lda     #<(S023A)
+	ldx     #>(S023A)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S023B)
+	ldx     #>(S023B)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D4
+	jsr     pushax
+	lda     #<(S023C)
+	ldx     #>(S023C)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S023D)
+	ldx     #>(S023D)
+	jsr     pushax
+	lda     #<(S023E)
+	ldx     #>(S023E)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D5
+	jsr     pushax
+	lda     #<(S023F)
+	ldx     #>(S023F)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0240)
+	ldx     #>(S0240)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D6
+	jsr     pushax
+	lda     #<(S0241)
+	ldx     #>(S0241)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0242)
+	ldx     #>(S0242)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D7
+	jsr     pushax
+	lda     #<(S0243)
+	ldx     #>(S0243)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0244)
+	ldx     #>(S0244)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D8
+	jsr     pushax
+	lda     #<(S0245)
+	ldx     #>(S0245)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0246)
+	ldx     #>(S0246)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$D9
+	jsr     pushax
+	lda     #<(S0247)
+	ldx     #>(S0247)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0248)
+	ldx     #>(S0248)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$DA
+	jsr     pushax
+	lda     #<(S0249)
+	ldx     #>(S0249)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S024A)
+	ldx     #>(S024A)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$DD
+	jsr     pushax
+	lda     #<(S024B)
+	ldx     #>(S024B)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S024C)
+	ldx     #>(S024C)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$DE
+	jsr     pushax
+	lda     #<(S024D)
+	ldx     #>(S024D)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S024E)
+	ldx     #>(S024E)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$DF
+	jsr     pushax
+	lda     #<(S024F)
+	ldx     #>(S024F)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0250)
+	ldx     #>(S0250)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E0
+	jsr     pushax
+	lda     #<(S0251)
+	ldx     #>(S0251)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0252)
+	ldx     #>(S0252)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E1
+	jsr     pushax
+	lda     #<(S0253)
+	ldx     #>(S0253)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0254)
+	ldx     #>(S0254)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E2
+	jsr     pushax
+	lda     #<(S0255)
+	ldx     #>(S0255)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S0256)
+	ldx     #>(S0256)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E3
+	jsr     pushax
+	lda     #<(S0257)
+	ldx     #>(S0257)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S0258)
+	ldx     #>(S0258)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E4
+	jsr     pushax
+	lda     #<(S0259)
+	ldx     #>(S0259)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S025A)
+	ldx     #>(S025A)
+	jsr     pushax
+	lda     #<(S025B)
+	ldx     #>(S025B)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E5
+	jsr     pushax
+	lda     #<(S025C)
+	ldx     #>(S025C)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S025D)
+	ldx     #>(S025D)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E6
+	jsr     pushax
+	lda     #<(S025E)
+	ldx     #>(S025E)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #<(S025F)
+	ldx     #>(S025F)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E7
+	jsr     pushax
+	lda     #<(S0260)
+	ldx     #>(S0260)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0261)
+	ldx     #>(S0261)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E8
+	jsr     pushax
+	lda     #<(S0262)
+	ldx     #>(S0262)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0263)
+	ldx     #>(S0263)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$E9
+	jsr     pushax
+	lda     #<(S0264)
+	ldx     #>(S0264)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0265)
+	ldx     #>(S0265)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$EA
+	jsr     pushax
+	lda     #<(S0266)
+	ldx     #>(S0266)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #<(S0267)
+	ldx     #>(S0267)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$ED
+	jsr     pushax
+	lda     #<(S0268)
+	ldx     #>(S0268)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S0269)
+	ldx     #>(S0269)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$EE
+	jsr     pushax
+	lda     #<(S026A)
+	ldx     #>(S026A)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S026B)
+	ldx     #>(S026B)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$EF
+	jsr     pushax
+	lda     #<(S026C)
+	ldx     #>(S026C)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S026D)
+	ldx     #>(S026D)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F0
+	jsr     pushax
+	lda     #<(S026E)
+	ldx     #>(S026E)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S026F)
+	ldx     #>(S026F)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F1
+	jsr     pushax
+	lda     #<(S0270)
+	ldx     #>(S0270)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S0271)
+	ldx     #>(S0271)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F2
+	jsr     pushax
+	lda     #<(S0272)
+	ldx     #>(S0272)
+	jsr     pushax
+	jsr     push0
+	lda     #<(S0273)
+	ldx     #>(S0273)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F5
+	jsr     pushax
+	lda     #<(S0274)
+	ldx     #>(S0274)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0275)
+	ldx     #>(S0275)
+	jsr     pushax
+	lda     #$75
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F6
+	jsr     pushax
+	lda     #<(S0276)
+	ldx     #>(S0276)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0277)
+	ldx     #>(S0277)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F7
+	jsr     pushax
+	lda     #<(S0278)
+	ldx     #>(S0278)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0279)
+	ldx     #>(S0279)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F8
+	jsr     pushax
+	lda     #<(S027A)
+	ldx     #>(S027A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S027B)
+	ldx     #>(S027B)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$F9
+	jsr     pushax
+	lda     #<(S027C)
+	ldx     #>(S027C)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S027D)
+	ldx     #>(S027D)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FA
+	jsr     pushax
+	lda     #<(S027E)
+	ldx     #>(S027E)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S027F)
+	ldx     #>(S027F)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FB
+	jsr     pushax
+	lda     #<(S0280)
+	ldx     #>(S0280)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0281)
+	ldx     #>(S0281)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FC
+	jsr     pushax
+	lda     #<(S0282)
+	ldx     #>(S0282)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0283)
+	ldx     #>(S0283)
+	jsr     pushax
+	lda     #<(S0284)
+	ldx     #>(S0284)
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FD
+	jsr     pushax
+	lda     #<(S0285)
+	ldx     #>(S0285)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0286)
+	ldx     #>(S0286)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FE
+	jsr     pushax
+	lda     #<(S0287)
+	ldx     #>(S0287)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0288)
+	ldx     #>(S0288)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$01
+	lda     #$FF
+	jsr     pushax
+	lda     #<(S0289)
+	ldx     #>(S0289)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S028A)
+	ldx     #>(S028A)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$00
+	jsr     pushax
+	lda     #<(S028B)
+	ldx     #>(S028B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S028C)
+	ldx     #>(S028C)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$01
+	jsr     pushax
+	lda     #<(S028D)
+	ldx     #>(S028D)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S028E)
+	ldx     #>(S028E)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	txa
+	jsr     pushax
+	lda     #<(S028F)
+	ldx     #>(S028F)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0290)
+	ldx     #>(S0290)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$05
+	jsr     pushax
+	lda     #<(S0291)
+	ldx     #>(S0291)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0292)
+	ldx     #>(S0292)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$06
+	jsr     pushax
+	lda     #<(S0293)
+	ldx     #>(S0293)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0294)
+	ldx     #>(S0294)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$07
+	jsr     pushax
+	lda     #<(S0295)
+	ldx     #>(S0295)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0296)
+	ldx     #>(S0296)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$08
+	jsr     pushax
+	lda     #<(S0297)
+	ldx     #>(S0297)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S0298)
+	ldx     #>(S0298)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$09
+	jsr     pushax
+	lda     #<(S0299)
+	ldx     #>(S0299)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S029A)
+	ldx     #>(S029A)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$0A
+	jsr     pushax
+	lda     #<(S029B)
+	ldx     #>(S029B)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S029C)
+	ldx     #>(S029C)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$0D
+	jsr     pushax
+	lda     #<(S029D)
+	ldx     #>(S029D)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S029E)
+	ldx     #>(S029E)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$0E
+	jsr     pushax
+	lda     #<(S029F)
+	ldx     #>(S029F)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #<(S02A0)
+	ldx     #>(S02A0)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$0F
+	jsr     pushax
+	lda     #<(S02A1)
+	ldx     #>(S02A1)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S02A2)
+	ldx     #>(S02A2)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$10
+	jsr     pushax
+	lda     #<(S02A3)
+	ldx     #>(S02A3)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S02A4)
+	ldx     #>(S02A4)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$11
+	jsr     pushax
+	lda     #<(S02A5)
+	ldx     #>(S02A5)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S02A6)
+	ldx     #>(S02A6)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$12
+	jsr     pushax
+	lda     #<(S02A7)
+	ldx     #>(S02A7)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #<(S02A8)
+	ldx     #>(S02A8)
+	jsr     pushax
+	ldx     #$EF
+	lda     #$98
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$18
+	jsr     pushax
+	lda     #<(S02A9)
+	ldx     #>(S02A9)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S02AA)
+	ldx     #>(S02AA)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$19
+	jsr     pushax
+	lda     #<(S02AB)
+	ldx     #>(S02AB)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S02AC)
+	ldx     #>(S02AC)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$1C
+	jsr     pushax
+	lda     #<(S02AD)
+	ldx     #>(S02AD)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S02AE)
+	ldx     #>(S02AE)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$1D
+	jsr     pushax
+	lda     #<(S02AF)
+	ldx     #>(S02AF)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S02B0)
+	ldx     #>(S02B0)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$1E
+	jsr     pushax
+	lda     #<(S02B1)
+	ldx     #>(S02B1)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #<(S02B2)
+	ldx     #>(S02B2)
+	jsr     pushax
+	jsr     push0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$21
+	jsr     pushax
+	lda     #<(S02B3)
+	ldx     #>(S02B3)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #<(S02B4)
+	ldx     #>(S02B4)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$22
+	jsr     pushax
+	lda     #<(S02B5)
+	ldx     #>(S02B5)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S02B6)
+	ldx     #>(S02B6)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$23
+	jsr     pushax
+	lda     #<(S02B7)
+	ldx     #>(S02B7)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #<(S02B8)
+	ldx     #>(S02B8)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$26
+	jsr     pushax
+	lda     #<(S02B9)
+	ldx     #>(S02B9)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02BA)
+	ldx     #>(S02BA)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$27
+	jsr     pushax
+	lda     #<(S02BB)
+	ldx     #>(S02BB)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02BC)
+	ldx     #>(S02BC)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$28
+	jsr     pushax
+	lda     #<(S02BD)
+	ldx     #>(S02BD)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02BE)
+	ldx     #>(S02BE)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$2B
+	jsr     pushax
+	lda     #<(S02BF)
+	ldx     #>(S02BF)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02C0)
+	ldx     #>(S02C0)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$2C
+	jsr     pushax
+	lda     #<(S02C1)
+	ldx     #>(S02C1)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02C2)
+	ldx     #>(S02C2)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$2D
+	jsr     pushax
+	lda     #<(S02C3)
+	ldx     #>(S02C3)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	lda     #<(S02C4)
+	ldx     #>(S02C4)
+	jsr     pushax
+	ldx     #$10
+	lda     #$68
+	jsr     pushax
+	ldy     #$0A
+	jsr     _OneTest
+	ldx     #$02
+	lda     #$30
+	jsr     pushax
+	lda     #<(S02C5)
+	ldx     #>(S02C5)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	ldx     #$02
+	lda     #$31
+	jsr     pushax
+	lda     #<(S02C6)
+	ldx     #>(S02C6)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	ldx     #$02
+	lda     #$32
+	jsr     pushax
+	lda     #<(S02C7)
+	ldx     #>(S02C7)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	sta     sreg+1
+	sta     sreg
+	lda     #$04
+	ldx     #$5A
+	jsr     _WriteTest
+	ldx     #$02
+	lda     #$33
+	jsr     pushax
+	lda     #<(S02C8)
+	ldx     #>(S02C8)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	stz     sreg+1
+	stz     sreg
+	lda     #$04
+	ldx     #$00
+	jsr     _WriteTest
+	lda     _Failures
+	ora     _Failures+1
+	beq     L0002
+	lda     #<(S02C9)
+	ldx     #>(S02C9)
+	jsr     pushax
+	lda     _Tests
+	ldx     _Tests+1
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$06
+	bra     L0004
+L0002:	lda     #<(S02CA)
+	ldx     #>(S02CA)
+	jsr     pushax
+	lda     _Tests
+	ldx     _Tests+1
+	jsr     pushax
+	ldy     #$04
+L0004:	jsr     _printf
+	lda     _Failures
+	ldx     _Failures+1
+	rts
+
+.endproc
+
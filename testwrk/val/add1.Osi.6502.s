@@ -0,0 +1,411 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uchar
+	.export		_add_uchar2uchar
+	.export		_add_uchar2uchar2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uchar: near
+
+.segment	"CODE"
+
+;
+; achar0 = achar0 + 5;
+;
+	lda     _achar0
+	clc
+	adc     #$05
+	sta     _achar0
+;
+; if(achar0 != 5)
+;
+	cmp     #$05
+	beq     L000C
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar0 += 10;
+;
+L000C:	lda     #$0A
+	clc
+	adc     _achar0
+	sta     _achar0
+;
+; if(achar0 != 15)
+;
+	cmp     #$0F
+	beq     L000D
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar0 = achar0 +1;  /*Should be an increment */
+;
+L000D:	lda     _achar0
+	clc
+	adc     #$01
+	sta     _achar0
+;
+; if(achar0 != 16)
+;
+	cmp     #$10
+	beq     L000E
+;
+; failures++;
+;
+	inc     _failures
+;
+; for(achar1 = 0; achar1 < 100; achar1++)
+;
+L000E:	lda     #$00
+	sta     _achar1
+L000F:	lda     _achar1
+	cmp     #$64
+	bcs     L0010
+;
+; achar0 += 2;
+;
+	lda     #$02
+	clc
+	adc     _achar0
+	sta     _achar0
+;
+; for(achar1 = 0; achar1 < 100; achar1++)
+;
+	inc     _achar1
+	jmp     L000F
+;
+; if(achar0 != 216)
+;
+L0010:	lda     _achar0
+	cmp     #$D8
+	beq     L000B
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000B:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar: near
+
+.segment	"CODE"
+
+;
+; achar1 = achar1 + achar0;
+;
+	lda     _achar1
+	clc
+	adc     _achar0
+	sta     _achar1
+;
+; if(achar1 != 16)
+;
+	cmp     #$10
+	beq     L0009
+;
+; failures++;
+;
+	inc     _failures
+;
+; for(achar2 = 0; achar2<7; achar2++)
+;
+L0009:	lda     #$00
+	sta     _achar2
+L000A:	lda     _achar2
+	cmp     #$07
+	bcs     L000B
+;
+; achar1 += achar0;
+;
+	lda     _achar0
+	clc
+	adc     _achar1
+	sta     _achar1
+;
+; for(achar2 = 0; achar2<7; achar2++)
+;
+	inc     _achar2
+	jmp     L000A
+;
+; if(achar1 != 128)
+;
+L000B:	lda     _achar1
+	cmp     #$80
+	beq     L0007
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar2: near
+
+.segment	"CODE"
+
+;
+; achar0++;
+;
+	inc     _achar0
+;
+; achar0 = achar0 + 1;
+;
+	lda     _achar0
+	clc
+	adc     #$01
+	sta     _achar0
+;
+; achar0 = achar0 + 2;
+;
+	clc
+	adc     #$02
+	sta     _achar0
+;
+; achar0 = achar0 + 3;
+;
+	clc
+	adc     #$03
+	sta     _achar0
+;
+; if(achar0 != 7)
+;
+	cmp     #$07
+	beq     L000D
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar1 += achar0;
+;
+L000D:	lda     _achar0
+	clc
+	adc     _achar1
+	sta     _achar1
+;
+; if(achar1 != 39)
+;
+	cmp     #$27
+	beq     L000E
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar2 = achar1 + achar0;
+;
+L000E:	lda     _achar1
+	clc
+	adc     _achar0
+	sta     _achar2
+;
+; if(achar2 != 46)
+;
+	cmp     #$2E
+	beq     L000F
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar3 = achar2 + achar1 + achar0;
+;
+L000F:	lda     _achar2
+	clc
+	adc     _achar1
+	bcc     L000C
+	clc
+L000C:	adc     _achar0
+	sta     _achar3
+;
+; if(achar3 != 92)
+;
+	cmp     #$5C
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; add_lit2uchar();
+;
+	jsr     _add_lit2uchar
+;
+; achar0=16;
+;
+	lda     #$10
+	sta     _achar0
+;
+; achar1=0;
+;
+	lda     #$00
+	sta     _achar1
+;
+; add_uchar2uchar();
+;
+	jsr     _add_uchar2uchar
+;
+; achar0 = 0;
+;
+	lda     #$00
+	sta     _achar0
+;
+; achar1 = 32;
+;
+	lda     #$20
+	sta     _achar1
+;
+; add_uchar2uchar2();
+;
+	jsr     _add_uchar2uchar2
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,1125 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_aint2
+	.export		_aint3
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uint
+	.export		_add_uint2uint
+	.export		_add_uint2uint2
+	.export		_addlits
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_aint2:
+	.word	$0000
+_aint3:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uint: near
+
+.segment	"CODE"
+
+;
+; aint0 = aint0 + 5;
+;
+	lda     _aint0
+	ldx     _aint0+1
+	clc
+	adc     #$05
+	bcc     L0002
+	inx
+L0002:	sta     _aint0
+	stx     _aint0+1
+;
+; if(aint0 != 5)
+;
+	cpx     #$00
+	bne     L0014
+	cmp     #$05
+	beq     L0003
+;
+; failures++;
+;
+L0014:	inc     _failures
+;
+; aint0 += 10;
+;
+L0003:	lda     #$0A
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0005
+	inc     _aint0+1
+;
+; if(aint0 != 15)
+;
+L0005:	lda     _aint0+1
+	bne     L0015
+	lda     _aint0
+	cmp     #$0F
+	beq     L0006
+;
+; failures++;
+;
+L0015:	inc     _failures
+;
+; aint0 = aint0 +1;  /* Should be an increment */
+;
+L0006:	lda     _aint0
+	ldx     _aint0+1
+	ina
+	bne     L0008
+	inx
+L0008:	sta     _aint0
+	stx     _aint0+1
+;
+; if(aint0 != 16)
+;
+	cpx     #$00
+	bne     L0016
+	cmp     #$10
+	beq     L0018
+;
+; failures++;
+;
+L0016:	inc     _failures
+;
+; for(aint1 = 0; aint1 < 100; aint1++)
+;
+L0018:	stz     _aint1
+	stz     _aint1+1
+L000B:	lda     _aint1+1
+	cmp     #$00
+	bne     L000F
+	lda     _aint1
+	cmp     #$64
+L000F:	bcs     L000C
+;
+; aint0 += 2;
+;
+	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0011
+	inc     _aint0+1
+;
+; for(aint1 = 0; aint1 < 100; aint1++)
+;
+L0011:	inc     _aint1
+	bne     L000B
+	inc     _aint1+1
+	bra     L000B
+;
+; if(aint0 != 216)
+;
+L000C:	lda     _aint0+1
+	bne     L0017
+	lda     _aint0
+	cmp     #$D8
+	beq     L0012
+;
+; failures++;
+;
+L0017:	inc     _failures
+;
+; }
+;
+L0012:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint: near
+
+.segment	"CODE"
+
+;
+; aint1 = aint1 + aint0;
+;
+	lda     _aint1
+	clc
+	adc     _aint0
+	pha
+	lda     _aint1+1
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint1
+	stx     _aint1+1
+;
+; if(aint1 != 16)
+;
+	cpx     #$00
+	bne     L000C
+	cmp     #$10
+	beq     L000E
+;
+; failures++;
+;
+L000C:	inc     _failures
+;
+; for(aint2 = 0; aint2<7; aint2++)
+;
+L000E:	stz     _aint2
+	stz     _aint2+1
+L0004:	lda     _aint2+1
+	cmp     #$00
+	bne     L0008
+	lda     _aint2
+	cmp     #$07
+L0008:	bcs     L0005
+;
+; aint1 += aint0;
+;
+	lda     _aint0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     _aint0+1
+	adc     _aint1+1
+	sta     _aint1+1
+;
+; for(aint2 = 0; aint2<7; aint2++)
+;
+	inc     _aint2
+	bne     L0004
+	inc     _aint2+1
+	bra     L0004
+;
+; if(aint1 != 128)
+;
+L0005:	lda     _aint1+1
+	bne     L000D
+	lda     _aint1
+	cmp     #$80
+	beq     L000A
+;
+; failures++;
+;
+L000D:	inc     _failures
+;
+; }
+;
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint2: near
+
+.segment	"CODE"
+
+;
+; aint0++;
+;
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+;
+; aint0 = aint0 + 1;
+;
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	ina
+	bne     L0003
+	inx
+L0003:	sta     _aint0
+	stx     _aint0+1
+;
+; aint0 = aint0 + 2;
+;
+	clc
+	adc     #$02
+	bcc     L0004
+	inx
+L0004:	sta     _aint0
+	stx     _aint0+1
+;
+; aint0 = aint0 + 3;
+;
+	clc
+	adc     #$03
+	bcc     L0005
+	inx
+L0005:	sta     _aint0
+	stx     _aint0+1
+;
+; if(aint0 != 7)
+;
+	cpx     #$00
+	bne     L0017
+	cmp     #$07
+	beq     L0006
+;
+; failures++;
+;
+L0017:	inc     _failures
+;
+; aint1 += aint0;
+;
+L0006:	lda     _aint0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     _aint0+1
+	adc     _aint1+1
+	sta     _aint1+1
+;
+; if(aint1 != 0x27)
+;
+	cmp     #$00
+	bne     L0018
+	lda     _aint1
+	cmp     #$27
+	beq     L0008
+;
+; failures++;
+;
+L0018:	inc     _failures
+;
+; aint2 = aint1 + aint0;
+;
+L0008:	lda     _aint1
+	clc
+	adc     _aint0
+	pha
+	lda     _aint1+1
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint2
+	stx     _aint2+1
+;
+; if(aint2 != 0x2e)
+;
+	cpx     #$00
+	bne     L0019
+	cmp     #$2E
+	beq     L000A
+;
+; failures++;
+;
+L0019:	inc     _failures
+;
+; aint3 = aint2 + aint1 + aint0;
+;
+L000A:	lda     _aint2
+	clc
+	adc     _aint1
+	pha
+	lda     _aint2+1
+	adc     _aint1+1
+	tax
+	pla
+	clc
+	adc     _aint0
+	pha
+	txa
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint3
+	stx     _aint3+1
+;
+; if(aint3 != 0x5c)
+;
+	cpx     #$00
+	bne     L001A
+	cmp     #$5C
+	beq     L000C
+;
+; failures++;
+;
+L001A:	inc     _failures
+;
+; aint3 += 0xa0;
+;
+L000C:	lda     #$A0
+	clc
+	adc     _aint3
+	sta     _aint3
+	bcc     L000E
+	inc     _aint3+1
+;
+; if(aint3 != 0xfc)
+;
+L000E:	lda     _aint3+1
+	bne     L001B
+	lda     _aint3
+	cmp     #$FC
+	beq     L000F
+;
+; failures++;
+;
+L001B:	inc     _failures
+;
+; aint3 += aint0;
+;
+L000F:	lda     _aint0
+	clc
+	adc     _aint3
+	sta     _aint3
+	lda     _aint0+1
+	adc     _aint3+1
+	sta     _aint3+1
+;
+; if(aint3 != 0x103)
+;
+	cmp     #$01
+	bne     L001C
+	lda     _aint3
+	cmp     #$03
+	beq     L0011
+;
+; failures++;
+;
+L001C:	inc     _failures
+;
+; aint1 += 0xffc0;
+;
+L0011:	lda     #$C0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     #$FF
+	adc     _aint1+1
+	sta     _aint1+1
+;
+; if(aint1 != 0xffe7)
+;
+	cmp     #$FF
+	bne     L001D
+	lda     _aint1
+	cmp     #$E7
+	beq     L0013
+;
+; failures++;
+;
+L001D:	inc     _failures
+;
+; aint3 = aint2 + aint1 + aint0;
+;
+L0013:	lda     _aint2
+	clc
+	adc     _aint1
+	pha
+	lda     _aint2+1
+	adc     _aint1+1
+	tax
+	pla
+	clc
+	adc     _aint0
+	pha
+	txa
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint3
+	stx     _aint3+1
+;
+; if(aint3 != 0x1c)
+;
+	cpx     #$00
+	bne     L001E
+	cmp     #$1C
+	beq     L0015
+;
+; failures++;
+;
+L001E:	inc     _failures
+;
+; }
+;
+L0015:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addlits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addlits: near
+
+.segment	"CODE"
+
+;
+; aint0 += 0x0001;
+;
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+;
+; if(aint0 != 1)
+;
+L0002:	lda     _aint0+1
+	bne     L003B
+	lda     _aint0
+	cmp     #$01
+	beq     L0003
+;
+; failures++;
+;
+L003B:	inc     _failures
+;
+; aint0 += 0x00;
+;
+L0003:	clc
+	bcc     L0005
+	inc     _aint0+1
+;
+; if(aint0 != 1)
+;
+L0005:	lda     _aint0+1
+	bne     L003C
+	lda     _aint0
+	cmp     #$01
+	beq     L0006
+;
+; failures++;
+;
+L003C:	inc     _failures
+;
+; aint0 += 0x00fe;
+;
+L0006:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0008
+	inc     _aint0+1
+;
+; if(aint0 != 0x00ff)
+;
+L0008:	lda     _aint0+1
+	bne     L003D
+	lda     _aint0
+	cmp     #$FF
+	beq     L0009
+;
+; failures++;
+;
+L003D:	inc     _failures
+;
+; aint0 += 0x0001;
+;
+L0009:	inc     _aint0
+	bne     L000B
+	inc     _aint0+1
+;
+; if(aint0 != 0x0100)
+;
+L000B:	lda     _aint0+1
+	cmp     #$01
+	bne     L003E
+	lda     _aint0
+	beq     L000C
+;
+; failures++;
+;
+L003E:	inc     _failures
+;
+; aint0++;
+;
+L000C:	inc     _aint0
+	bne     L000E
+	inc     _aint0+1
+;
+; if(aint0 != 0x0101)
+;
+L000E:	lda     _aint0+1
+	cmp     #$01
+	bne     L003F
+	lda     _aint0
+	cmp     #$01
+	beq     L000F
+;
+; failures++;
+;
+L003F:	inc     _failures
+;
+; aint0 += 0x00ff;
+;
+L000F:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0011
+	inc     _aint0+1
+;
+; if(aint0 != 0x0200)
+;
+L0011:	lda     _aint0+1
+	cmp     #$02
+	bne     L0040
+	lda     _aint0
+	beq     L0012
+;
+; failures++;
+;
+L0040:	inc     _failures
+;
+; aint0 += 0x00a0;
+;
+L0012:	lda     #$A0
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0014
+	inc     _aint0+1
+;
+; if(aint0 != 0x02a0)
+;
+L0014:	lda     _aint0+1
+	cmp     #$02
+	bne     L0041
+	lda     _aint0
+	cmp     #$A0
+	beq     L0015
+;
+; failures++;
+;
+L0041:	inc     _failures
+;
+; aint0 += 0x0061;
+;
+L0015:	lda     #$61
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0017
+	inc     _aint0+1
+;
+; if(aint0 != 0x0301)
+;
+L0017:	lda     _aint0+1
+	cmp     #$03
+	bne     L0042
+	lda     _aint0
+	cmp     #$01
+	beq     L0018
+;
+; failures++;
+;
+L0042:	inc     _failures
+;
+; aint0 += 0x0100;
+;
+L0018:	clc
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0401)
+;
+	cmp     #$04
+	bne     L0043
+	lda     _aint0
+	cmp     #$01
+	beq     L0053
+;
+; failures++;
+;
+L0043:	inc     _failures
+;
+; aint0 += 0x0101;
+;
+	lda     #$01
+L0053:	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0502)
+;
+	cmp     #$05
+	bne     L0044
+	lda     _aint0
+	cmp     #$02
+	beq     L001C
+;
+; failures++;
+;
+L0044:	inc     _failures
+;
+; aint0 += 0x00fd;
+;
+L001C:	lda     #$FD
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L001E
+	inc     _aint0+1
+;
+; if(aint0 != 0x05ff)
+;
+L001E:	lda     _aint0+1
+	cmp     #$05
+	bne     L0045
+	lda     _aint0
+	cmp     #$FF
+	beq     L001F
+;
+; failures++;
+;
+L0045:	inc     _failures
+;
+; aint0 += 0x0101;
+;
+L001F:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0700)
+;
+	cmp     #$07
+	bne     L0046
+	lda     _aint0
+	beq     L0021
+;
+; failures++;
+;
+L0046:	inc     _failures
+;
+; aint0 += 0x01ff;
+;
+L0021:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x08ff)
+;
+	cmp     #$08
+	bne     L0047
+	lda     _aint0
+	cmp     #$FF
+	beq     L0054
+;
+; failures++;
+;
+L0047:	inc     _failures
+;
+; aint0 += 0x01ff;
+;
+	lda     #$FF
+L0054:	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0afe)
+;
+	cmp     #$0A
+	bne     L0048
+	lda     _aint0
+	cmp     #$FE
+	beq     L0025
+;
+; failures++;
+;
+L0048:	inc     _failures
+;
+; aint0 += 0xff02;
+;
+L0025:	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0a00)
+;
+	cmp     #$0A
+	bne     L0049
+	lda     _aint0
+	beq     L0027
+;
+; failures++;
+;
+L0049:	inc     _failures
+;
+; aint0 += 0xffff;
+;
+L0027:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x09ff)
+;
+	cmp     #$09
+	bne     L004A
+	lda     _aint0
+	cmp     #$FF
+	beq     L0029
+;
+; failures++;
+;
+L004A:	inc     _failures
+;
+; aint0 += 0xff01;
+;
+L0029:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0900)
+;
+	cmp     #$09
+	bne     L004B
+	lda     _aint0
+	beq     L0055
+;
+; failures++;
+;
+L004B:	inc     _failures
+;
+; aint0 += 0xff00;
+;
+L0055:	clc
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0800)
+;
+	cmp     #$08
+	bne     L004C
+	lda     _aint0
+	beq     L002D
+;
+; failures++;
+;
+L004C:	inc     _failures
+;
+; aint0 += 0xff01;
+;
+L002D:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0701)
+;
+	cmp     #$07
+	bne     L004D
+	lda     _aint0
+	cmp     #$01
+	beq     L002F
+;
+; failures++;
+;
+L004D:	inc     _failures
+;
+; aint0 += 0x0300;
+;
+L002F:	clc
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0a01)
+;
+	cmp     #$0A
+	bne     L004E
+	lda     _aint0
+	cmp     #$01
+	beq     L0031
+;
+; failures++;
+;
+L004E:	inc     _failures
+;
+; aint0 += 0x03ff;
+;
+L0031:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x0e00)
+;
+	cmp     #$0E
+	bne     L004F
+	lda     _aint0
+	beq     L0033
+;
+; failures++;
+;
+L004F:	inc     _failures
+;
+; aint0 += 0x0301;
+;
+L0033:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x1101)
+;
+	cmp     #$11
+	bne     L0050
+	lda     _aint0
+	cmp     #$01
+	beq     L0035
+;
+; failures++;
+;
+L0050:	inc     _failures
+;
+; aint0 += 0x03fe;
+;
+L0035:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x14ff)
+;
+	cmp     #$14
+	bne     L0051
+	lda     _aint0
+	cmp     #$FF
+	beq     L0037
+;
+; failures++;
+;
+L0051:	inc     _failures
+;
+; aint0 += 0x0301;
+;
+L0037:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+;
+; if(aint0 != 0x1800)
+;
+	cmp     #$18
+	bne     L0052
+	lda     _aint0
+	beq     L0039
+;
+; failures++;
+;
+L0052:	inc     _failures
+;
+; }
+;
+L0039:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; add_lit2uint();
+;
+	jsr     _add_lit2uint
+;
+; aint0=16;
+;
+	lda     #$10
+	sta     _aint0
+	stz     _aint0+1
+;
+; aint1=0;
+;
+	stz     _aint1
+	stz     _aint1+1
+;
+; add_uint2uint();
+;
+	jsr     _add_uint2uint
+;
+; aint0 = 0;
+;
+	stz     _aint0
+	stz     _aint0+1
+;
+; aint1 = 32;
+;
+	lda     #$20
+	sta     _aint1
+	stz     _aint1+1
+;
+; aint2 = 0;
+;
+	stz     _aint2
+	stz     _aint2+1
+;
+; add_uint2uint2();
+;
+	jsr     _add_uint2uint2
+;
+; aint0 = 0;
+;
+	stz     _aint0
+	stz     _aint0+1
+;
+; addlits();
+;
+	jsr     _addlits
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,1176 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_exit
+	.export		_failures
+	.export		_char0
+	.export		_char1
+	.export		_char2
+	.export		_int0
+	.export		_int1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_done
+	.export		_add_char2char
+	.export		_add_compound_char
+	.export		_add_int2int
+	.export		_add_compound_int
+	.export		_add_lit2long
+	.export		_add_lit2ulong
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_char2:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$20,$64,$6F,$6E,$65,$20,$2D,$20,$66,$61,$69,$6C,$75,$72
+	.byte	$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$61,$64,$64,$5F,$63,$6F,$6D,$70,$6F,$75,$6E,$64,$5F,$63,$68,$61
+	.byte	$72,$00
+S0005:
+	.byte	$61,$64,$64,$5F,$63,$6F,$6D,$70,$6F,$75,$6E,$64,$5F,$69,$6E,$74
+	.byte	$00
+S0007:
+	.byte	$61,$64,$64,$5F,$6C,$69,$74,$32,$75,$6C,$6F,$6E,$67,$00
+S0002:
+	.byte	$61,$64,$64,$5F,$63,$68,$61,$72,$32,$63,$68,$61,$72,$00
+S0006:
+	.byte	$61,$64,$64,$5F,$6C,$69,$74,$32,$6C,$6F,$6E,$67,$00
+S0004:
+	.byte	$61,$64,$64,$5F,$69,$6E,$74,$32,$69,$6E,$74,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; printf("%s done - failures: %d\n", name, failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	lda     _failures
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+;
+; if(failures)
+;
+	lda     _failures
+	beq     L0002
+;
+; exit(failures);
+;
+	ldx     #$00
+	lda     _failures
+	jsr     _exit
+;
+; }
+;
+L0002:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_char2char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_char2char: near
+
+.segment	"CODE"
+
+;
+; if(char0 != 4)
+;
+	lda     _char0
+	cmp     #$04
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(char1 != 5)
+;
+L0008:	lda     _char1
+	cmp     #$05
+	beq     L0009
+;
+; failures++;
+;
+	inc     _failures
+;
+; char0 = char0 + char1;
+;
+L0009:	lda     _char0
+	clc
+	adc     _char1
+	sta     _char0
+;
+; if(char0 != 9)
+;
+	cmp     #$09
+	beq     L000A
+;
+; failures++;
+;
+	inc     _failures
+;
+; char0 += 127;
+;
+L000A:	lda     #$7F
+	clc
+	adc     _char0
+	sta     _char0
+;
+; if(char0 != (127+9))
+;
+	cmp     #$88
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; done("add_char2char");
+;
+L0006:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_compound_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_compound_char: near
+
+.segment	"CODE"
+
+;
+; char0 = char1+5;
+;
+	lda     _char1
+	clc
+	adc     #$05
+	sta     _char0
+;
+; if(char0 != 9)
+;
+	ldx     #$00
+	lda     _char0
+	cmp     #$09
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; if((char0+char1) != 13)
+;
+L0006:	lda     _char0
+	clc
+	adc     _char1
+	bcc     L0005
+	inx
+L0005:	cpx     #$00
+	bne     L0007
+	cmp     #$0D
+	beq     L0003
+;
+; failures++;
+;
+L0007:	inc     _failures
+;
+; done("add_compound_char");
+;
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_int2int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_int2int: near
+
+.segment	"CODE"
+
+;
+; if(int0 != 4)
+;
+	lda     _int0+1
+	bne     L000A
+	lda     _int0
+	cmp     #$04
+	beq     L0002
+;
+; failures++;
+;
+L000A:	inc     _failures
+;
+; if(int1 != 5)
+;
+L0002:	lda     _int1+1
+	bne     L000B
+	lda     _int1
+	cmp     #$05
+	beq     L0004
+;
+; failures++;
+;
+L000B:	inc     _failures
+;
+; int0 += int1;
+;
+L0004:	lda     _int1
+	clc
+	adc     _int0
+	sta     _int0
+	lda     _int1+1
+	adc     _int0+1
+	sta     _int0+1
+;
+; if(int0 != 9)
+;
+	cmp     #$00
+	bne     L000C
+	lda     _int0
+	cmp     #$09
+	beq     L0006
+;
+; failures++;
+;
+L000C:	inc     _failures
+;
+; int0 += 0x7fff;
+;
+L0006:	lda     #$FF
+	clc
+	adc     _int0
+	sta     _int0
+	lda     #$7F
+	adc     _int0+1
+	sta     _int0+1
+;
+; if(int0 != -0x7ff8)
+;
+	cmp     #$80
+	bne     L000D
+	lda     _int0
+	cmp     #$08
+	beq     L0008
+;
+; failures++;
+;
+L000D:	inc     _failures
+;
+; done("add_int2int");
+;
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_compound_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_compound_int: near
+
+.segment	"CODE"
+
+;
+; int0 = int1+5;
+;
+	lda     _int1
+	ldx     _int1+1
+	jsr     incax5
+	sta     _int0
+	stx     _int0+1
+;
+; if(int0 != 9)
+;
+	cpx     #$00
+	bne     L0006
+	cmp     #$09
+	beq     L0002
+;
+; failures++;
+;
+L0006:	inc     _failures
+;
+; if((int0+int1) != 13)
+;
+L0002:	lda     _int0
+	clc
+	adc     _int1
+	pha
+	lda     _int0+1
+	adc     _int1+1
+	tax
+	pla
+	cpx     #$00
+	bne     L0007
+	cmp     #$0D
+	beq     L0004
+;
+; failures++;
+;
+L0007:	inc     _failures
+;
+; done("add_compound_int");
+;
+L0004:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2long: near
+
+.segment	"CODE"
+
+;
+; if(long0 != 0)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0++;
+;
+L0002:	ldy     #<(_long0)
+	sty     ptr1
+	ldy     #>(_long0)
+	jsr     laddeq1
+;
+; if(long0 != 1)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0xff;
+;
+L0003:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	ldy     #$FF
+	jsr     inceaxy
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0x100)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	ldx     #$01
+	jsr     tosneeax
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0x100;
+;
+L0004:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	ldx     #$01
+	jsr     tosadd0ax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0x200)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	ldx     #$02
+	jsr     tosneeax
+	beq     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0xfe00;
+;
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	ldx     #$FE
+	jsr     tosadd0ax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0x10000)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosneeax
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0xff0000;
+;
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0x1000000)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0007
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0x7e000000;
+;
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$7E
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0x7f000000)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0x2000000;
+;
+L0008:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != -0x7f000000)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0009
+;
+; failures++;
+;
+	inc     _failures
+;
+; long0 = long0 + 0x7f000000;
+;
+L0009:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != 0)
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L000A
+;
+; failures++;
+;
+	inc     _failures
+;
+; done("add_lit2long");
+;
+L000A:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2ulong: near
+
+.segment	"CODE"
+
+;
+; if(ulong0 != 0)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0++;
+;
+L0002:	ldy     #<(_ulong0)
+	sty     ptr1
+	ldy     #>(_ulong0)
+	jsr     laddeq1
+;
+; if(ulong0 != 1)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0xff;
+;
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	ldy     #$FF
+	jsr     inceaxy
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x100)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	ldx     #$01
+	jsr     tosneeax
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0x100;
+;
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	ldx     #$01
+	jsr     tosadd0ax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x200)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	sta     sreg
+	ldx     #$02
+	jsr     tosneeax
+	beq     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0xfe00;
+;
+L0005:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	ldx     #$FE
+	jsr     tosadd0ax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x10000)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosneeax
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0xff0000;
+;
+L0006:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x1000000)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0007
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0x7e000000;
+;
+L0007:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7E
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x7f000000)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0x2000000;
+;
+L0008:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x81000000)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0009
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 = ulong0 + 0x7f000000;
+;
+L0009:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	tax
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0)
+;
+	lda     _ulong0+3
+	ora     _ulong0+2
+	ora     _ulong0+1
+	ora     _ulong0+0
+	beq     L000A
+;
+; failures++;
+;
+	inc     _failures
+;
+; done("add_lit2ulong");
+;
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jmp     _done
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; char0=4;
+;
+	lda     #$04
+	sta     _char0
+;
+; char1 = char0 + 1;
+;
+	clc
+	adc     #$01
+	sta     _char1
+;
+; add_char2char();
+;
+	jsr     _add_char2char
+;
+; char1=4;
+;
+	lda     #$04
+	sta     _char1
+;
+; add_compound_char();
+;
+	jsr     _add_compound_char
+;
+; int0 = 4;
+;
+	ldx     #$00
+	lda     #$04
+	sta     _int0
+	stx     _int0+1
+;
+; int1 = int0 + 1;
+;
+	jsr     incax1
+	sta     _int1
+	stx     _int1+1
+;
+; add_int2int();
+;
+	jsr     _add_int2int
+;
+; int1=4;
+;
+	ldx     #$00
+	lda     #$04
+	sta     _int1
+	stx     _int1+1
+;
+; add_compound_int();
+;
+	jsr     _add_compound_int
+;
+; add_lit2long();
+;
+	jsr     _add_lit2long
+;
+; add_lit2ulong();
+;
+	jsr     _add_lit2ulong
+;
+; return 0;
+;
+	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,226 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_long0
+	.export		_print
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+_long0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$6C,$6F,$6E,$67,$30,$3A,$20,$25,$6C,$64,$0A,$00
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$21,$0A,$00
+S0002	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+;
+; printf("long0: %ld\n", long0);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldy     #$06
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; long0 = 0x7f000000L;
+;
+	lda     #$7F
+	sta     _long0+3
+	stz     _long0+2
+	stz     _long0+1
+	stz     _long0
+;
+; print();
+;
+	jsr     _print
+;
+; long0 = long0 + 0x2000000L;
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	stz     sreg
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != -0x7f000000L) {
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	stz     sreg
+	tax
+	jsr     tosneeax
+	beq     L0003
+;
+; printf("failed!\n");
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+;
+; print();
+;
+L0003:	jsr     _print
+;
+; long0 = 0x7f000000L;
+;
+	lda     #$7F
+	sta     _long0+3
+	stz     _long0+2
+	stz     _long0+1
+	stz     _long0
+;
+; print();
+;
+	jsr     _print
+;
+; long0 = long0 + 0x2000000L;
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	stz     sreg
+	tax
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; print();
+;
+	jsr     _print
+;
+; if(long0 != -0x7f000000L) {
+;
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	stz     sreg
+	tax
+	jsr     tosneeax
+	beq     L0005
+;
+; printf("failed!\n");
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+;
+; print();
+;
+L0005:	jsr     _print
+;
+; return failures;
+;
+	lda     _failures
+	ldx     _failures+1
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,277 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "add3a.c", 1236, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_long0
+	.export		_print
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+_long0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$6C,$6F,$6E,$67,$30,$3A,$20,$25,$6C,$64,$0A,$00
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$21,$0A,$00
+S0002	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+	.dbg	func, "print", "00", static, "_print"
+
+.segment	"CODE"
+
+;
+; printf("long0: %ld\n", long0);
+;
+	.dbg	line, "add3a.c", 45
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; }
+;
+	.dbg	line, "add3a.c", 47
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; long0 = 0x7f000000L;
+;
+	.dbg	line, "add3a.c", 51
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; print();
+;
+	.dbg	line, "add3a.c", 53
+	jsr     _print
+;
+; long0 = long0 + 0x2000000L;
+;
+	.dbg	line, "add3a.c", 54
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; if(long0 != -0x7f000000L) {
+;
+	.dbg	line, "add3a.c", 55
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0003
+;
+; printf("failed!\n");
+;
+	.dbg	line, "add3a.c", 56
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "add3a.c", 57
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+;
+; print();
+;
+	.dbg	line, "add3a.c", 59
+L0003:	jsr     _print
+;
+; long0 = 0x7f000000L;
+;
+	.dbg	line, "add3a.c", 61
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; print();
+;
+	.dbg	line, "add3a.c", 63
+	jsr     _print
+;
+; long0 = long0 + 0x2000000L;
+;
+	.dbg	line, "add3a.c", 64
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+;
+; print();
+;
+	.dbg	line, "add3a.c", 65
+	jsr     _print
+;
+; if(long0 != -0x7f000000L) {
+;
+	.dbg	line, "add3a.c", 66
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0005
+;
+; printf("failed!\n");
+;
+	.dbg	line, "add3a.c", 67
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "add3a.c", 68
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+;
+; print();
+;
+	.dbg	line, "add3a.c", 70
+L0005:	jsr     _print
+;
+; return failures;
+;
+	.dbg	line, "add3a.c", 72
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "add3a.c", 73
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,373 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_cP0
+	.export		_cP1
+	.export		_iP0
+	.export		_iP1
+	.export		_done
+	.export		_pc_add
+	.export		_pi_add
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+_cP0:
+	.word	$0000
+_cP1:
+	.word	$0000
+_iP0:
+	.word	$0000
+_iP1:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pc_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pc_add: near
+
+.segment	"CODE"
+
+;
+; if(*cP1)
+;
+	lda     _cP1+1
+	sta     ptr1+1
+	lda     _cP1
+	sta     ptr1
+	lda     (ptr1)
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; *cP1 += 1;
+;
+L0002:	lda     _cP1
+	ldx     _cP1+1
+	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	ina
+	sta     (sreg)
+;
+; if(*cP1 != 1)
+;
+	lda     _cP1+1
+	sta     ptr1+1
+	lda     _cP1
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$01
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(char0 != 1)
+;
+L0008:	lda     _char0
+	cmp     #$01
+	beq     L0009
+;
+; failures++;
+;
+	inc     _failures
+;
+; char0++;
+;
+L0009:	inc     _char0
+;
+; if(*cP1 != 2)
+;
+	lda     _cP1+1
+	sta     ptr1+1
+	lda     _cP1
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$02
+	beq     L000A
+;
+; failures++;
+;
+	inc     _failures
+;
+; char1 = char0 + *cP1;
+;
+L000A:	lda     _cP1+1
+	sta     ptr1+1
+	lda     _cP1
+	sta     ptr1
+	lda     (ptr1)
+	clc
+	adc     _char0
+	sta     _char1
+;
+; if(char1 != 4)
+;
+	cmp     #$04
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pi_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pi_add: near
+
+.segment	"CODE"
+
+;
+; if(*iP0)
+;
+	lda     _iP0
+	ldx     _iP0+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; *iP0 += 1;
+;
+L0002:	lda     _iP0
+	ldx     _iP0+1
+	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ina
+	bne     L000A
+	inx
+L000A:	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+;
+; if(*iP0 != 1)
+;
+	lda     _iP0+1
+	sta     ptr1+1
+	lda     _iP0
+	sta     ptr1
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #$00
+	bne     L000B
+	cmp     #$01
+	beq     L0004
+;
+; failures++;
+;
+L000B:	inc     _failures
+;
+; if(int0 != 1)
+;
+L0004:	lda     _int0+1
+	bne     L000C
+	lda     _int0
+	cmp     #$01
+	beq     L0006
+;
+; failures++;
+;
+L000C:	inc     _failures
+;
+; int1 = int0 + *iP0;
+;
+L0006:	lda     _iP0+1
+	sta     ptr1+1
+	lda     _iP0
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	clc
+	adc     _int0
+	pha
+	txa
+	adc     _int0+1
+	tax
+	pla
+	sta     _int1
+	stx     _int1+1
+;
+; if(int1 != 2)
+;
+	cpx     #$00
+	bne     L000D
+	cmp     #$02
+	beq     L0008
+;
+; failures++;
+;
+L000D:	inc     _failures
+;
+; }
+;
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; cP1 = &char0;
+;
+	lda     #>(_char0)
+	sta     _cP1+1
+	lda     #<(_char0)
+	sta     _cP1
+;
+; pc_add();
+;
+	jsr     _pc_add
+;
+; iP0 = &int0;
+;
+	lda     #>(_int0)
+	sta     _iP0+1
+	lda     #<(_int0)
+	sta     _iP0
+;
+; pi_add();
+;
+	jsr     _pi_add
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
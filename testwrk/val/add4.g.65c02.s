@@ -0,0 +1,445 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "add4.c", 1162, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_cP0
+	.export		_cP1
+	.export		_iP0
+	.export		_iP1
+	.export		_done
+	.export		_pc_add
+	.export		_pi_add
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+_cP0:
+	.word	$0000
+_cP1:
+	.word	$0000
+_iP0:
+	.word	$0000
+_iP1:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", static, "_done"
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	.dbg	line, "add4.c", 33
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+;
+; }
+;
+	.dbg	line, "add4.c", 34
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pc_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pc_add: near
+
+	.dbg	func, "pc_add", "00", static, "_pc_add"
+
+.segment	"CODE"
+
+;
+; if(*cP1)
+;
+	.dbg	line, "add4.c", 40
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; *cP1 += 1;
+;
+	.dbg	line, "add4.c", 43
+L0002:	lda     _cP1
+	ldx     _cP1+1
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	ina
+	ldy     #$00
+	jsr     staspidx
+;
+; if(*cP1 != 1)
+;
+	.dbg	line, "add4.c", 44
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 45
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if(char0 != 1)
+;
+	.dbg	line, "add4.c", 47
+L0003:	ldx     #$00
+	lda     _char0
+	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; char0++;
+;
+	.dbg	line, "add4.c", 50
+L0004:	ldx     #$00
+	lda     _char0
+	inc     _char0
+;
+; if(*cP1 != 2)
+;
+	.dbg	line, "add4.c", 52
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0005
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 53
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; char1 = char0 + *cP1;
+;
+	.dbg	line, "add4.c", 55
+L0005:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosaddax
+	ldx     #$00
+	sta     _char1
+;
+; if(char1 != 4)
+;
+	.dbg	line, "add4.c", 57
+	ldx     #$00
+	lda     _char1
+	cmp     #$04
+	jsr     boolne
+	jeq     L0006
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 58
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "add4.c", 59
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pi_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pi_add: near
+
+	.dbg	func, "pi_add", "00", static, "_pi_add"
+
+.segment	"CODE"
+
+;
+; if(*iP0)
+;
+	.dbg	line, "add4.c", 64
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 65
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; *iP0 += 1;
+;
+	.dbg	line, "add4.c", 67
+L0002:	lda     _iP0
+	ldx     _iP0+1
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	ina
+	bne     L0003
+	inx
+L0003:	ldy     #$00
+	jsr     staxspidx
+;
+; if(*iP0 != 1)
+;
+	.dbg	line, "add4.c", 69
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$01
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if(int0 != 1)
+;
+	.dbg	line, "add4.c", 72
+L0004:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+L0007:	jsr     boolne
+	jeq     L0006
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 73
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; int1 = int0 + *iP0;
+;
+	.dbg	line, "add4.c", 75
+L0006:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	sta     _int1
+	stx     _int1+1
+;
+; if(int1 != 2)
+;
+	.dbg	line, "add4.c", 76
+	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$02
+L0009:	jsr     boolne
+	jeq     L0008
+;
+; failures++;
+;
+	.dbg	line, "add4.c", 77
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "add4.c", 78
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; cP1 = &char0;
+;
+	.dbg	line, "add4.c", 82
+	lda     #<(_char0)
+	ldx     #>(_char0)
+	sta     _cP1
+	stx     _cP1+1
+;
+; pc_add();
+;
+	.dbg	line, "add4.c", 83
+	jsr     _pc_add
+;
+; iP0 = &int0;
+;
+	.dbg	line, "add4.c", 85
+	lda     #<(_int0)
+	ldx     #>(_int0)
+	sta     _iP0
+	stx     _iP0+1
+;
+; pi_add();
+;
+	.dbg	line, "add4.c", 86
+	jsr     _pi_add
+;
+; success = failures;
+;
+	.dbg	line, "add4.c", 88
+	ldx     #$00
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	.dbg	line, "add4.c", 89
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	.dbg	line, "add4.c", 90
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "add4.c", 92
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "add4.c", 93
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,1165 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$64,$64,$35,$3A,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20
+	.byte	$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_array:
+	.res	16,$00
+_cPtr:
+	.res	2,$00
+_iPtr:
+	.res	2,$00
+_lPtr:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_char: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; cPtr = cP + offset;
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	clc
+	ldy     #$01
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_int: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; cPtr = cP + offset;
+;
+	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_long: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; cPtr = cP + offset;
+;
+	jsr     ldeax0sp
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_char: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; iPtr = iP + offset;
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	asl     a
+	bcc     L0005
+	inx
+	clc
+L0005:	ldy     #$01
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0006
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0006:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_int: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; iPtr = iP + offset;
+;
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_long: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; iPtr = iP + offset;
+;
+	jsr     ldeax0sp
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_char: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; lPtr = lP + offset;
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	jsr     aslax2
+	clc
+	ldy     #$01
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_int: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; lPtr = lP + offset;
+;
+	jsr     ldax0sp
+	jsr     aslax2
+	clc
+	ldy     #$02
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_long: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; lPtr = lP + offset;
+;
+	jsr     ldeax0sp
+	jsr     aslax2
+	clc
+	ldy     #$04
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_cPointer: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; cPtr = offset + cP;
+;
+	ldy     #$00
+	lda     (c_sp),y
+	sta     ptr1
+	ldy     #$02
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	bcc     L0003
+	inx
+L0003:	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0005
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0005:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_cPointer: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; cPtr = offset + cP;
+;
+	tay
+	jsr     ldaxysp
+	clc
+	ldy     #$00
+	adc     (c_sp),y
+	pha
+	txa
+	iny
+	adc     (c_sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_cPointer: near
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$00
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; cPtr = (offset + cP);
+;
+	jsr     ldeax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_iPointer: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; iPtr = offset + iP;
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	asl     a
+	bcc     L0003
+	inx
+L0003:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0005
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0005:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_iPointer: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; iPtr = offset + iP;
+;
+	jsr     ldax0sp
+	jsr     aslax1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_iPointer: near
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$00
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; iPtr = (offset + iP);
+;
+	jsr     ldeax0sp
+	jsr     aslax1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lPointer: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	lda     #$03
+	jsr     pusha
+;
+; lPtr = offset + lP;
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	jsr     aslax2
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lPointer: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	lda     #$03
+	jsr     pusha0
+;
+; lPtr = offset + lP;
+;
+	jsr     ldax0sp
+	jsr     aslax2
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_lPointer: near
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	lda     #$00
+	lda     #$03
+	ldx     #$00
+	jsr     push0ax
+;
+; lPtr = (offset + lP);
+;
+	jsr     ldeax0sp
+	jsr     aslax2
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+;
+; ++failures;
+;
+L0004:	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; cPointer_char();
+;
+	jsr     _cPointer_char
+;
+; cPointer_int();
+;
+	jsr     _cPointer_int
+;
+; cPointer_long();
+;
+	jsr     _cPointer_long
+;
+; iPointer_char();
+;
+	jsr     _iPointer_char
+;
+; iPointer_int();
+;
+	jsr     _iPointer_int
+;
+; iPointer_long();
+;
+	jsr     _iPointer_long
+;
+; lPointer_char();
+;
+	jsr     _lPointer_char
+;
+; lPointer_int();
+;
+	jsr     _lPointer_int
+;
+; lPointer_long();
+;
+	jsr     _lPointer_long
+;
+; char_cPointer();
+;
+	jsr     _char_cPointer
+;
+; int_cPointer();
+;
+	jsr     _int_cPointer
+;
+; long_cPointer();
+;
+	jsr     _long_cPointer
+;
+; char_iPointer();
+;
+	jsr     _char_iPointer
+;
+; int_iPointer();
+;
+	jsr     _int_iPointer
+;
+; long_iPointer();
+;
+	jsr     _long_iPointer
+;
+; char_lPointer();
+;
+	jsr     _char_lPointer
+;
+; int_lPointer();
+;
+	jsr     _int_lPointer
+;
+; long_lPointer();
+;
+	jsr     _long_lPointer
+;
+; if (failures != 0) {
+;
+	ldx     #$00
+	lda     _failures
+	beq     L0003
+;
+; printf("add5: failures: %u\n", failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+L0003:	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
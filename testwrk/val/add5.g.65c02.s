@@ -0,0 +1,1440 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "add5.c", 4092, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$64,$64,$35,$3A,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20
+	.byte	$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_array:
+	.res	16,$00
+_cPtr:
+	.res	2,$00
+_iPtr:
+	.res	2,$00
+_lPtr:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_char: near
+
+	.dbg	func, "cPointer_char", "00", static, "_cPointer_char"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 22
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 23
+	lda     #$03
+	jsr     pusha
+;
+; cPtr = cP + offset;
+;
+	.dbg	line, "add5.c", 25
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 26
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 27
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 29
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_int: near
+
+	.dbg	func, "cPointer_int", "00", static, "_cPointer_int"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 33
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 34
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; cPtr = cP + offset;
+;
+	.dbg	line, "add5.c", 36
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 37
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 38
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 40
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_long: near
+
+	.dbg	func, "cPointer_long", "00", static, "_cPointer_long"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 44
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 45
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; cPtr = cP + offset;
+;
+	.dbg	line, "add5.c", 47
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 48
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 49
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 51
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_char: near
+
+	.dbg	func, "iPointer_char", "00", static, "_iPointer_char"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 55
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 56
+	lda     #$03
+	jsr     pusha
+;
+; iPtr = iP + offset;
+;
+	.dbg	line, "add5.c", 58
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 59
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 60
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 62
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_int: near
+
+	.dbg	func, "iPointer_int", "00", static, "_iPointer_int"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 66
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 67
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; iPtr = iP + offset;
+;
+	.dbg	line, "add5.c", 69
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 70
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 71
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 73
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_long: near
+
+	.dbg	func, "iPointer_long", "00", static, "_iPointer_long"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 77
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 78
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; iPtr = iP + offset;
+;
+	.dbg	line, "add5.c", 80
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 81
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 82
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 84
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_char: near
+
+	.dbg	func, "lPointer_char", "00", static, "_lPointer_char"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 88
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 89
+	lda     #$03
+	jsr     pusha
+;
+; lPtr = lP + offset;
+;
+	.dbg	line, "add5.c", 91
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 92
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 93
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 95
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_int: near
+
+	.dbg	func, "lPointer_int", "00", static, "_lPointer_int"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 99
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 100
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; lPtr = lP + offset;
+;
+	.dbg	line, "add5.c", 102
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 103
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 104
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 106
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_long: near
+
+	.dbg	func, "lPointer_long", "00", static, "_lPointer_long"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 110
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 111
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; lPtr = lP + offset;
+;
+	.dbg	line, "add5.c", 113
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 114
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 115
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 117
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_cPointer: near
+
+	.dbg	func, "char_cPointer", "00", static, "_char_cPointer"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 123
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 124
+	lda     #$03
+	jsr     pusha
+;
+; cPtr = offset + cP;
+;
+	.dbg	line, "add5.c", 126
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 127
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 128
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 130
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_cPointer: near
+
+	.dbg	func, "int_cPointer", "00", static, "_int_cPointer"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 134
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 135
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; cPtr = offset + cP;
+;
+	.dbg	line, "add5.c", 137
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 138
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 139
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 141
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_cPointer: near
+
+	.dbg	func, "long_cPointer", "00", static, "_long_cPointer"
+	.dbg	sym, "cP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; char *cP = array;
+;
+	.dbg	line, "add5.c", 145
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 146
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; cPtr = (offset + cP);
+;
+	.dbg	line, "add5.c", 148
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+;
+; if (cPtr != (void *)&array[3]) {
+;
+	.dbg	line, "add5.c", 149
+	lda     _cPtr
+	ldx     _cPtr+1
+	jsr     pushax
+	lda     #<(_array+3)
+	ldx     #>(_array+3)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 150
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 152
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_iPointer: near
+
+	.dbg	func, "char_iPointer", "00", static, "_char_iPointer"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 156
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 157
+	lda     #$03
+	jsr     pusha
+;
+; iPtr = offset + iP;
+;
+	.dbg	line, "add5.c", 159
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     aslax1
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 160
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 161
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 163
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_iPointer: near
+
+	.dbg	func, "int_iPointer", "00", static, "_int_iPointer"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 167
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 168
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; iPtr = offset + iP;
+;
+	.dbg	line, "add5.c", 170
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 171
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 172
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 174
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_iPointer: near
+
+	.dbg	func, "long_iPointer", "00", static, "_long_iPointer"
+	.dbg	sym, "iP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; int *iP = (int *)array;
+;
+	.dbg	line, "add5.c", 178
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 179
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; iPtr = (offset + iP);
+;
+	.dbg	line, "add5.c", 181
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     aslax1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+;
+; if (iPtr != (void *)&array[6]) {
+;
+	.dbg	line, "add5.c", 182
+	lda     _iPtr
+	ldx     _iPtr+1
+	jsr     pushax
+	lda     #<(_array+6)
+	ldx     #>(_array+6)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 183
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 185
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lPointer: near
+
+	.dbg	func, "char_lPointer", "00", static, "_char_lPointer"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -3
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 189
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; char offset = 3;
+;
+	.dbg	line, "add5.c", 190
+	lda     #$03
+	jsr     pusha
+;
+; lPtr = offset + lP;
+;
+	.dbg	line, "add5.c", 192
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	jsr     aslax2
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 193
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 194
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 196
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lPointer: near
+
+	.dbg	func, "int_lPointer", "00", static, "_int_lPointer"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 200
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; int offset = 3;
+;
+	.dbg	line, "add5.c", 201
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+;
+; lPtr = offset + lP;
+;
+	.dbg	line, "add5.c", 203
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 204
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 205
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 207
+L0002:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_lPointer: near
+
+	.dbg	func, "long_lPointer", "00", static, "_long_lPointer"
+	.dbg	sym, "lP", "00", auto, -2
+	.dbg	sym, "offset", "00", auto, -6
+
+.segment	"CODE"
+
+;
+; long *lP = (long *)array;
+;
+	.dbg	line, "add5.c", 211
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+;
+; long offset = 3;
+;
+	.dbg	line, "add5.c", 212
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     pusheax
+;
+; lPtr = (offset + lP);
+;
+	.dbg	line, "add5.c", 214
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     aslax2
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+;
+; if (lPtr != (void *)&array[12]) {
+;
+	.dbg	line, "add5.c", 215
+	lda     _lPtr
+	ldx     _lPtr+1
+	jsr     pushax
+	lda     #<(_array+12)
+	ldx     #>(_array+12)
+	jsr     tosneax
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "add5.c", 216
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; }
+;
+	.dbg	line, "add5.c", 218
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; cPointer_char();
+;
+	.dbg	line, "add5.c", 222
+	jsr     _cPointer_char
+;
+; cPointer_int();
+;
+	.dbg	line, "add5.c", 223
+	jsr     _cPointer_int
+;
+; cPointer_long();
+;
+	.dbg	line, "add5.c", 224
+	jsr     _cPointer_long
+;
+; iPointer_char();
+;
+	.dbg	line, "add5.c", 226
+	jsr     _iPointer_char
+;
+; iPointer_int();
+;
+	.dbg	line, "add5.c", 227
+	jsr     _iPointer_int
+;
+; iPointer_long();
+;
+	.dbg	line, "add5.c", 228
+	jsr     _iPointer_long
+;
+; lPointer_char();
+;
+	.dbg	line, "add5.c", 230
+	jsr     _lPointer_char
+;
+; lPointer_int();
+;
+	.dbg	line, "add5.c", 231
+	jsr     _lPointer_int
+;
+; lPointer_long();
+;
+	.dbg	line, "add5.c", 232
+	jsr     _lPointer_long
+;
+; char_cPointer();
+;
+	.dbg	line, "add5.c", 234
+	jsr     _char_cPointer
+;
+; int_cPointer();
+;
+	.dbg	line, "add5.c", 235
+	jsr     _int_cPointer
+;
+; long_cPointer();
+;
+	.dbg	line, "add5.c", 236
+	jsr     _long_cPointer
+;
+; char_iPointer();
+;
+	.dbg	line, "add5.c", 238
+	jsr     _char_iPointer
+;
+; int_iPointer();
+;
+	.dbg	line, "add5.c", 239
+	jsr     _int_iPointer
+;
+; long_iPointer();
+;
+	.dbg	line, "add5.c", 240
+	jsr     _long_iPointer
+;
+; char_lPointer();
+;
+	.dbg	line, "add5.c", 242
+	jsr     _char_lPointer
+;
+; int_lPointer();
+;
+	.dbg	line, "add5.c", 243
+	jsr     _int_lPointer
+;
+; long_lPointer();
+;
+	.dbg	line, "add5.c", 244
+	jsr     _long_lPointer
+;
+; if (failures != 0) {
+;
+	.dbg	line, "add5.c", 246
+	ldx     #$00
+	lda     _failures
+	cmp     #$00
+	jsr     boolne
+	jeq     L0002
+;
+; printf("add5: failures: %u\n", failures);
+;
+	.dbg	line, "add5.c", 247
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "add5.c", 249
+L0002:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "add5.c", 250
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,620 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_func0
+	.export		_func1
+	.export		_func2
+	.export		_func3
+	.export		_func4
+	.export		_func5
+	.export		_func6
+	.export		_func7
+	.export		_func8
+	.export		_func9
+	.export		_onetest
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$54,$65,$73,$74,$20,$25,$75,$20,$66,$61,$69,$6C,$65,$64,$21,$20
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$30,$78,$25,$30,$34,$58,$20
+	.byte	$62,$75,$74,$20,$67,$6F,$74,$20,$30,$78,$25,$30,$34,$58,$2F,$30
+	.byte	$78,$25,$30,$34,$58,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func0: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a & 0x00FF) & (b & 0xFF00);
+;
+	lda     #$00
+	tax
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func1: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF & a) & (0xFF00 & b);
+;
+	lda     #$00
+	tax
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func2: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) & (b | 0xFF00);
+;
+	lda     (c_sp)
+	pha
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	pla
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func3: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) & (0xFF00 | b);
+;
+	lda     (c_sp)
+	pha
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	pla
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func4: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) | (b | 0xFF00);
+;
+	lda     #$FF
+	tax
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func5: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) | (0xFF00 | b);
+;
+	lda     #$FF
+	tax
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func6: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a ^ 0x00FF) & (b & 0xFF00);
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	txa
+	ldy     #$03
+	and     (c_sp),y
+	tax
+;
+; }
+;
+	lda     #$00
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func7: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF ^ a) & (0xFF00 & b);
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	txa
+	ldy     #$03
+	and     (c_sp),y
+	tax
+;
+; }
+;
+	lda     #$00
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func8: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) | (b ^ 0xFF00);
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	txa
+	eor     #$FF
+	ldy     #$03
+	ora     (c_sp),y
+	tax
+;
+; }
+;
+	lda     #$FF
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func9: near
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) | (0xFF00 ^ b);
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	txa
+	eor     #$FF
+	ldy     #$03
+	ora     (c_sp),y
+	tax
+;
+; }
+;
+	lda     #$FF
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ onetest (unsigned int count, int (*f1)(void), int (*f2)(void), int result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_onetest: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; int r1 = f1();
+;
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     callax
+	jsr     pushax
+;
+; int r2 = f2();
+;
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	jsr     callax
+	jsr     pushax
+;
+; if (r1 != result || r2 != result) {
+;
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ldy     #$04
+	cmp     (c_sp),y
+	bne     L0003
+	txa
+	iny
+	cmp     (c_sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	ldy     #$04
+	cmp     (c_sp),y
+	bne     L0003
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L0002
+;
+; printf("Test %u failed! Expected 0x%04X but got 0x%04X/0x%04X\n",
+;
+L0003:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; count, result, r1, r2);
+;
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+;
+; ++failures;
+;
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+;
+; }
+;
+L0002:	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; onetest(1, func0, func1, 0x0000);
+;
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	dea
+	sta     (c_sp),y
+	lda     #<(_func0)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_func0)
+	sta     (c_sp),y
+	lda     #<(_func1)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(_func1)
+	sta     (c_sp),y
+	ldx     #$00
+	txa
+	jsr     _onetest
+;
+; onetest(2, func2, func3, 0x12AA);
+;
+	jsr     decsp6
+	lda     #$02
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(_func2)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_func2)
+	sta     (c_sp),y
+	lda     #<(_func3)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(_func3)
+	sta     (c_sp),y
+	ldx     #$12
+	lda     #$AA
+	jsr     _onetest
+;
+; onetest(3, func4, func5, 0xFFFF);
+;
+	jsr     decsp6
+	lda     #$03
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(_func4)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_func4)
+	sta     (c_sp),y
+	lda     #<(_func5)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(_func5)
+	sta     (c_sp),y
+	ldx     #$FF
+	txa
+	jsr     _onetest
+;
+; onetest(4, func6, func7, 0x1000);
+;
+	jsr     decsp6
+	lda     #$04
+	tay
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(_func6)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_func6)
+	sta     (c_sp),y
+	lda     #<(_func7)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(_func7)
+	sta     (c_sp),y
+	ldx     #$10
+	lda     #$00
+	jsr     _onetest
+;
+; onetest(5, func8, func9, 0xBAFF);
+;
+	jsr     decsp6
+	lda     #$05
+	ldy     #$04
+	sta     (c_sp),y
+	iny
+	lda     #$00
+	sta     (c_sp),y
+	lda     #<(_func8)
+	ldy     #$02
+	sta     (c_sp),y
+	iny
+	lda     #>(_func8)
+	sta     (c_sp),y
+	lda     #<(_func9)
+	sta     (c_sp)
+	ldy     #$01
+	lda     #>(_func9)
+	sta     (c_sp),y
+	ldx     #$BA
+	lda     #$FF
+	jsr     _onetest
+;
+; return failures;
+;
+	lda     _failures
+	ldx     _failures+1
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,737 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "and-eor-ora-optimizations.c", 1555, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_func0
+	.export		_func1
+	.export		_func2
+	.export		_func3
+	.export		_func4
+	.export		_func5
+	.export		_func6
+	.export		_func7
+	.export		_func8
+	.export		_func9
+	.export		_onetest
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$54,$65,$73,$74,$20,$25,$75,$20,$66,$61,$69,$6C,$65,$64,$21,$20
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$30,$78,$25,$30,$34,$58,$20
+	.byte	$62,$75,$74,$20,$67,$6F,$74,$20,$30,$78,$25,$30,$34,$58,$2F,$30
+	.byte	$78,$25,$30,$34,$58,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ func0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func0: near
+
+	.dbg	func, "func0", "00", static, "_func0"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 9
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a & 0x00FF) & (b & 0xFF00);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 10
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	lda     #$00
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 11
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func1: near
+
+	.dbg	func, "func1", "00", static, "_func1"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 15
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF & a) & (0xFF00 & b);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 16
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	lda     #$00
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 17
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func2: near
+
+	.dbg	func, "func2", "00", static, "_func2"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 21
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) & (b | 0xFF00);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 22
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$FF
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 23
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func3: near
+
+	.dbg	func, "func3", "00", static, "_func3"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 27
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) & (0xFF00 | b);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 28
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$FF
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 29
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func4: near
+
+	.dbg	func, "func4", "00", static, "_func4"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 33
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) | (b | 0xFF00);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 34
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$FF
+	jsr     tosorax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 35
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func5: near
+
+	.dbg	func, "func5", "00", static, "_func5"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 39
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) | (0xFF00 | b);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 40
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$FF
+	jsr     tosorax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 41
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func6: near
+
+	.dbg	func, "func6", "00", static, "_func6"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 45
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a ^ 0x00FF) & (b & 0xFF00);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 46
+	ldy     #$03
+	jsr     ldaxysp
+	eor     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	lda     #$00
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 47
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func7: near
+
+	.dbg	func, "func7", "00", static, "_func7"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 51
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF ^ a) & (0xFF00 & b);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 52
+	ldy     #$03
+	jsr     ldaxysp
+	eor     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	lda     #$00
+	jsr     tosandax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 53
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func8: near
+
+	.dbg	func, "func8", "00", static, "_func8"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 57
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (a | 0x00FF) | (b ^ 0xFF00);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 58
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	pha
+	txa
+	eor     #$FF
+	tax
+	pla
+	jsr     tosorax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 59
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ func9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func9: near
+
+	.dbg	func, "func9", "00", static, "_func9"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; unsigned a = 0x1234, b = 0x55AA;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 63
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$55
+	lda     #$AA
+	jsr     pushax
+;
+; return (0x00FF | a) | (0xFF00 ^ b);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 64
+	ldy     #$03
+	jsr     ldaxysp
+	ora     #$FF
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	pha
+	txa
+	eor     #$FF
+	tax
+	pla
+	jsr     tosorax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 65
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ onetest (unsigned int count, int (*f1)(void), int (*f2)(void), int result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_onetest: near
+
+	.dbg	func, "onetest", "00", static, "_onetest"
+	.dbg	sym, "count", "00", auto, 6
+	.dbg	sym, "f1", "00", auto, 4
+	.dbg	sym, "f2", "00", auto, 2
+	.dbg	sym, "result", "00", auto, 0
+	.dbg	sym, "r1", "00", auto, -2
+	.dbg	sym, "r2", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 68
+	jsr     pushax
+;
+; int r1 = f1();
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 69
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     callax
+	jsr     pushax
+;
+; int r2 = f2();
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 70
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     callax
+	jsr     pushax
+;
+; if (r1 != result || r2 != result) {
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 71
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L0003
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+;
+; printf("Test %u failed! Expected 0x%04X but got 0x%04X/0x%04X\n",
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 72
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; count, result, r1, r2);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 73
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+;
+; ++failures;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 74
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+L0005:	lda     _failures
+	ldx     _failures+1
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 76
+L0002:	ldy     #$0C
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; onetest(1, func0, func1, 0x0000);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 80
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     #<(_func0)
+	ldx     #>(_func0)
+	jsr     pushax
+	lda     #<(_func1)
+	ldx     #>(_func1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _onetest
+;
+; onetest(2, func2, func3, 0x12AA);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 81
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	lda     #<(_func2)
+	ldx     #>(_func2)
+	jsr     pushax
+	lda     #<(_func3)
+	ldx     #>(_func3)
+	jsr     pushax
+	ldx     #$12
+	lda     #$AA
+	jsr     _onetest
+;
+; onetest(3, func4, func5, 0xFFFF);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 82
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	lda     #<(_func4)
+	ldx     #>(_func4)
+	jsr     pushax
+	lda     #<(_func5)
+	ldx     #>(_func5)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     _onetest
+;
+; onetest(4, func6, func7, 0x1000);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 83
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	lda     #<(_func6)
+	ldx     #>(_func6)
+	jsr     pushax
+	lda     #<(_func7)
+	ldx     #>(_func7)
+	jsr     pushax
+	ldx     #$10
+	lda     #$00
+	jsr     _onetest
+;
+; onetest(5, func8, func9, 0xBAFF);
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 84
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	lda     #<(_func8)
+	ldx     #>(_func8)
+	jsr     pushax
+	lda     #<(_func9)
+	ldx     #>(_func9)
+	jsr     pushax
+	ldx     #$BA
+	lda     #$FF
+	jsr     _onetest
+;
+; return failures;
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 85
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and-eor-ora-optimizations.c", 86
+L0001:	rts
+
+	.dbg	line
+.endproc
+
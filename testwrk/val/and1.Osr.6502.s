@@ -0,0 +1,623 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_lit2uchar
+	.export		_and_lit2uint
+	.export		_and_lit2ulong
+	.export		_and_uchar2uchar
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uchar: near
+
+.segment	"CODE"
+
+;
+; if(uchar0 != 0xff)
+;
+	lda     _uchar0
+	cmp     #$FF
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; uchar0 &= 0x7f;
+;
+L0006:	lda     _uchar0
+	and     #$7F
+	sta     _uchar0
+;
+; if(uchar0 != 0x7f)
+;
+	cmp     #$7F
+	beq     L0007
+;
+; failures++;
+;
+	inc     _failures
+;
+; uchar0 &= 0x3f;
+;
+L0007:	lda     _uchar0
+	and     #$3F
+	sta     _uchar0
+;
+; if(uchar0 != 0x3f)
+;
+	cmp     #$3F
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; uchar0 &= 0xdf;
+;
+L0008:	lda     _uchar0
+	and     #$DF
+	sta     _uchar0
+;
+; if(uchar0 != 0x1f)
+;
+	cmp     #$1F
+	beq     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uint: near
+
+.segment	"CODE"
+
+;
+; if(uint0 != 0xffff)
+;
+	lda     _uint0+1
+	cmp     #$FF
+	bne     L0012
+	lda     _uint0
+	cmp     #$FF
+	beq     L0002
+;
+; failures++;
+;
+L0012:	inc     _failures
+;
+; uint0 &= 0x7fff;
+;
+L0002:	lda     _uint0+1
+	and     #$7F
+	tax
+	lda     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x7fff)
+;
+	cpx     #$7F
+	bne     L0013
+	cmp     #$FF
+	beq     L0004
+;
+; failures++;
+;
+L0013:	inc     _failures
+;
+; uint0 &= 0x3fff;
+;
+L0004:	lda     _uint0+1
+	and     #$3F
+	tax
+	lda     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x3fff)
+;
+	cpx     #$3F
+	bne     L0014
+	cmp     #$FF
+	beq     L0006
+;
+; failures++;
+;
+L0014:	inc     _failures
+;
+; uint0 &= 0xdfff;
+;
+L0006:	lda     _uint0+1
+	and     #$DF
+	tax
+	lda     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x1fff)
+;
+	cpx     #$1F
+	bne     L0015
+	cmp     #$FF
+	beq     L0008
+;
+; failures++;
+;
+L0015:	inc     _failures
+;
+; uint0 &= 0xff7f;
+;
+L0008:	lda     _uint0
+	ldx     _uint0+1
+	and     #$7F
+	sta     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x1f7f)
+;
+	cpx     #$1F
+	bne     L0016
+	cmp     #$7F
+	beq     L000A
+;
+; failures++;
+;
+L0016:	inc     _failures
+;
+; uint0 &= 0x0f0f;
+;
+L000A:	lda     _uint0+1
+	and     #$0F
+	tax
+	lda     _uint0
+	and     #$0F
+	sta     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x0f0f)
+;
+	cpx     #$0F
+	bne     L0017
+	cmp     #$0F
+	beq     L000C
+;
+; failures++;
+;
+L0017:	inc     _failures
+;
+; uint0 &= 0xfefe;
+;
+L000C:	lda     _uint0+1
+	and     #$FE
+	tax
+	lda     _uint0
+	and     #$FE
+	sta     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0x0e0e)
+;
+	cpx     #$0E
+	bne     L0018
+	cmp     #$0E
+	beq     L000E
+;
+; failures++;
+;
+L0018:	inc     _failures
+;
+; uint0 &= 0xf0f0;
+;
+L000E:	lda     _uint0+1
+	and     #$F0
+	tax
+	lda     _uint0
+	and     #$F0
+	sta     _uint0
+	stx     _uint0+1
+;
+; if(uint0 != 0)
+;
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+	beq     L0010
+;
+; failures++;
+;
+L0019:	inc     _failures
+;
+; }
+;
+L0010:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2ulong: near
+
+.segment	"CODE"
+
+;
+; if(ulong0 != 0xffffffff)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 &= 0x7fffffff;
+;
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	tax
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x7fffffff)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 &= 0xff00ffff;
+;
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x7f00ffff)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosneeax
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; ulong0 &= 0xfeff00ff;
+;
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$FE
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	ldx     #$00
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+;
+; if(ulong0 != 0x7e0000ff)
+;
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     #$7E
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_uchar2uchar: near
+
+.segment	"CODE"
+
+;
+; uchar0 &= uchar1;
+;
+	lda     _uchar0
+	and     _uchar1
+	sta     _uchar0
+;
+; if(uchar0 != 0x0f)
+;
+	cmp     #$0F
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; uchar1 &= 0xf7;
+;
+L0004:	lda     _uchar1
+	and     #$F7
+	sta     _uchar1
+;
+; uchar0 = uchar1 & 0xfe;
+;
+	and     #$FE
+	sta     _uchar0
+;
+; if(uchar0 != 0x06)
+;
+	cmp     #$06
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; uchar0 = 0xff;
+;
+	lda     #$FF
+	sta     _uchar0
+;
+; and_lit2uchar();
+;
+	jsr     _and_lit2uchar
+;
+; uint0 = 0xffff;
+;
+	lda     #$FF
+	sta     _uint0
+	sta     _uint0+1
+;
+; and_lit2uint();
+;
+	jsr     _and_lit2uint
+;
+; ulong0 = 0xffffffff;
+;
+	lda     #$FF
+	sta     _ulong0+3
+	sta     _ulong0+2
+	sta     _ulong0+1
+	sta     _ulong0
+;
+; and_lit2ulong();
+;
+	jsr     _and_lit2ulong
+;
+; uchar0 = 0xff;
+;
+	lda     #$FF
+	sta     _uchar0
+;
+; uchar1 = 0x0f;
+;
+	lda     #$0F
+	sta     _uchar1
+;
+; and_uchar2uchar();
+;
+	jsr     _and_uchar2uchar
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
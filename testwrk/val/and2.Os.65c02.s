@@ -0,0 +1,449 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_compound1
+	.export		_and_compound2
+	.export		_or_compound1
+	.export		_or_compound2
+	.export		_xor_compound1
+	.export		_xor_compound2
+	.export		_neg_compound1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound1: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 1) & 0x0f;
+;
+	lda     _uchar0
+	ina
+	and     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 4)
+;
+	cmp     #$04
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound2: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 1) & 0x0f;
+;
+	lda     _uchar1
+	ina
+	and     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 3)
+;
+	cmp     #$03
+	beq     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(uchar1 != 0x42)
+;
+L0006:	lda     _uchar1
+	cmp     #$42
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound1: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 0xe) | 0x0f;
+;
+	ldx     #$00
+	lda     _uchar0
+	ldy     #$0E
+	jsr     incaxy
+	ora     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 0x2f)
+;
+	cmp     #$2F
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound2: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 0xf) | 0x0f;
+;
+	ldx     #$00
+	lda     _uchar1
+	ldy     #$0F
+	jsr     incaxy
+	ora     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 0x5f)
+;
+	cmp     #$5F
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(uchar1 != 0x47)
+;
+L0004:	lda     _uchar1
+	cmp     #$47
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound1: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 1) ^ 0x0f;
+;
+	lda     _uchar0
+	ina
+	eor     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 0x1b)
+;
+	cmp     #$1B
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound2: near
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 0xf) ^ 0x0f;
+;
+	ldx     #$00
+	lda     _uchar1
+	ldy     #$0F
+	jsr     incaxy
+	eor     #$0F
+	sta     _uchar0
+;
+; if(uchar0 != 0x59)
+;
+	cmp     #$59
+	beq     L0004
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(uchar1 != 0x47)
+;
+L0004:	lda     _uchar1
+	cmp     #$47
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ neg_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_neg_compound1: near
+
+.segment	"CODE"
+
+;
+; uchar0 = ~(uchar0 + 1);
+;
+	lda     _uchar0
+	ina
+	eor     #$FF
+	sta     _uchar0
+;
+; if(uchar0 != 0xeb)
+;
+	cmp     #$EB
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; uchar0 = 0x13;
+;
+	lda     #$13
+	sta     _uchar0
+;
+; and_compound1();
+;
+	jsr     _and_compound1
+;
+; uchar1 = 0x42;
+;
+	lda     #$42
+	sta     _uchar1
+;
+; and_compound2();
+;
+	jsr     _and_compound2
+;
+; uchar0 = 0x13;
+;
+	lda     #$13
+	sta     _uchar0
+;
+; or_compound1();
+;
+	jsr     _or_compound1
+;
+; uchar1 = 0x47;
+;
+	lda     #$47
+	sta     _uchar1
+;
+; or_compound2();
+;
+	jsr     _or_compound2
+;
+; uchar0 = 0x13;
+;
+	lda     #$13
+	sta     _uchar0
+;
+; xor_compound1();
+;
+	jsr     _xor_compound1
+;
+; uchar1 = 0x47;
+;
+	lda     #$47
+	sta     _uchar1
+;
+; xor_compound2();
+;
+	jsr     _xor_compound2
+;
+; uchar0 = 0x13;
+;
+	lda     #$13
+	sta     _uchar0
+;
+; neg_compound1();
+;
+	jsr     _neg_compound1
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,606 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "and2.c", 1686, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_compound1
+	.export		_and_compound2
+	.export		_or_compound1
+	.export		_or_compound2
+	.export		_xor_compound1
+	.export		_xor_compound2
+	.export		_neg_compound1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", static, "_done"
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	.dbg	line, "and2.c", 22
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+;
+; }
+;
+	.dbg	line, "and2.c", 23
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound1: near
+
+	.dbg	func, "and_compound1", "00", static, "_and_compound1"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 1) & 0x0f;
+;
+	.dbg	line, "and2.c", 28
+	ldx     #$00
+	lda     _uchar0
+	jsr     incax1
+	ldx     #$00
+	and     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 4)
+;
+	.dbg	line, "and2.c", 29
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$04
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 30
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 31
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound2: near
+
+	.dbg	func, "and_compound2", "00", static, "_and_compound2"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 1) & 0x0f;
+;
+	.dbg	line, "and2.c", 36
+	ldx     #$00
+	lda     _uchar1
+	jsr     incax1
+	ldx     #$00
+	and     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 3)
+;
+	.dbg	line, "and2.c", 37
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$03
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if(uchar1 != 0x42)
+;
+	.dbg	line, "and2.c", 40
+L0002:	ldx     #$00
+	lda     _uchar1
+	cmp     #$42
+	jsr     boolne
+	jeq     L0003
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 42
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound1: near
+
+	.dbg	func, "or_compound1", "00", static, "_or_compound1"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 0xe) | 0x0f;
+;
+	.dbg	line, "and2.c", 47
+	ldx     #$00
+	lda     _uchar0
+	ldy     #$0E
+	jsr     incaxy
+	ora     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 0x2f)
+;
+	.dbg	line, "and2.c", 48
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$2F
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 50
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound2: near
+
+	.dbg	func, "or_compound2", "00", static, "_or_compound2"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 0xf) | 0x0f;
+;
+	.dbg	line, "and2.c", 55
+	ldx     #$00
+	lda     _uchar1
+	ldy     #$0F
+	jsr     incaxy
+	ora     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 0x5f)
+;
+	.dbg	line, "and2.c", 56
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$5F
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 57
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if(uchar1 != 0x47)
+;
+	.dbg	line, "and2.c", 59
+L0002:	ldx     #$00
+	lda     _uchar1
+	cmp     #$47
+	jsr     boolne
+	jeq     L0003
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 61
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound1: near
+
+	.dbg	func, "xor_compound1", "00", static, "_xor_compound1"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar0 + 1) ^ 0x0f;
+;
+	.dbg	line, "and2.c", 66
+	ldx     #$00
+	lda     _uchar0
+	jsr     incax1
+	eor     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 0x1b)
+;
+	.dbg	line, "and2.c", 67
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$1B
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 69
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound2: near
+
+	.dbg	func, "xor_compound2", "00", static, "_xor_compound2"
+
+.segment	"CODE"
+
+;
+; uchar0 = (uchar1 + 0xf) ^ 0x0f;
+;
+	.dbg	line, "and2.c", 74
+	ldx     #$00
+	lda     _uchar1
+	ldy     #$0F
+	jsr     incaxy
+	eor     #$0F
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 0x59)
+;
+	.dbg	line, "and2.c", 75
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$59
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 76
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if(uchar1 != 0x47)
+;
+	.dbg	line, "and2.c", 78
+L0002:	ldx     #$00
+	lda     _uchar1
+	cmp     #$47
+	jsr     boolne
+	jeq     L0003
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 80
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ neg_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_neg_compound1: near
+
+	.dbg	func, "neg_compound1", "00", static, "_neg_compound1"
+
+.segment	"CODE"
+
+;
+; uchar0 = ~(uchar0 + 1);
+;
+	.dbg	line, "and2.c", 85
+	ldx     #$00
+	lda     _uchar0
+	jsr     incax1
+	jsr     complax
+	ldx     #$00
+	sta     _uchar0
+;
+; if(uchar0 != 0xeb)
+;
+	.dbg	line, "and2.c", 86
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$EB
+	jsr     boolne
+	jeq     L0002
+;
+; failures++;
+;
+	.dbg	line, "and2.c", 87
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "and2.c", 88
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; uchar0 = 0x13;
+;
+	.dbg	line, "and2.c", 92
+	ldx     #$00
+	lda     #$13
+	sta     _uchar0
+;
+; and_compound1();
+;
+	.dbg	line, "and2.c", 93
+	jsr     _and_compound1
+;
+; uchar1 = 0x42;
+;
+	.dbg	line, "and2.c", 95
+	ldx     #$00
+	lda     #$42
+	sta     _uchar1
+;
+; and_compound2();
+;
+	.dbg	line, "and2.c", 96
+	jsr     _and_compound2
+;
+; uchar0 = 0x13;
+;
+	.dbg	line, "and2.c", 98
+	ldx     #$00
+	lda     #$13
+	sta     _uchar0
+;
+; or_compound1();
+;
+	.dbg	line, "and2.c", 99
+	jsr     _or_compound1
+;
+; uchar1 = 0x47;
+;
+	.dbg	line, "and2.c", 101
+	ldx     #$00
+	lda     #$47
+	sta     _uchar1
+;
+; or_compound2();
+;
+	.dbg	line, "and2.c", 102
+	jsr     _or_compound2
+;
+; uchar0 = 0x13;
+;
+	.dbg	line, "and2.c", 104
+	ldx     #$00
+	lda     #$13
+	sta     _uchar0
+;
+; xor_compound1();
+;
+	.dbg	line, "and2.c", 105
+	jsr     _xor_compound1
+;
+; uchar1 = 0x47;
+;
+	.dbg	line, "and2.c", 107
+	ldx     #$00
+	lda     #$47
+	sta     _uchar1
+;
+; xor_compound2();
+;
+	.dbg	line, "and2.c", 108
+	jsr     _xor_compound2
+;
+; uchar0 = 0x13;
+;
+	.dbg	line, "and2.c", 110
+	ldx     #$00
+	lda     #$13
+	sta     _uchar0
+;
+; neg_compound1();
+;
+	.dbg	line, "and2.c", 111
+	jsr     _neg_compound1
+;
+; success = failures;
+;
+	.dbg	line, "and2.c", 113
+	ldx     #$00
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	.dbg	line, "and2.c", 114
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	.dbg	line, "and2.c", 115
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "and2.c", 117
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "and2.c", 118
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,166 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "assign-shift-use1.c", 895, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_buffer:
+	.word	$ABCD
+S0002:
+	.byte	$61,$73,$73,$69,$67,$6E,$2D,$75,$73,$65,$31,$3A,$20,$72,$69,$67
+	.byte	$68,$74,$20,$73,$68,$69,$66,$74,$20,$69,$73,$20,$24,$25,$58,$2C
+	.byte	$20,$6E,$6F,$74,$20,$24,$30,$30,$41,$42,$2E,$0A,$00
+S0001:
+	.byte	$61,$73,$73,$69,$67,$6E,$2D,$75,$73,$65,$31,$3A,$20,$6C,$65,$66
+	.byte	$74,$20,$73,$68,$69,$66,$74,$20,$69,$73,$20,$24,$25,$58,$2C,$20
+	.byte	$6E,$6F,$74,$20,$24,$43,$44,$30,$30,$2E,$0A,$00
+
+.segment	"BSS"
+
+_result:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; result = buffer;
+;
+	.dbg	line, "assign-shift-use1.c", 17
+	lda     _buffer
+	ldx     _buffer+1
+	sta     _result
+	stx     _result+1
+;
+; result <<= 8;
+;
+	.dbg	line, "assign-shift-use1.c", 20
+	lda     _result
+	ldx     _result+1
+	tax
+	lda     #$00
+	sta     _result
+	stx     _result+1
+;
+; if (result != 0xCD00) {
+;
+	.dbg	line, "assign-shift-use1.c", 21
+	lda     _result
+	ldx     _result+1
+	cpx     #$CD
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "assign-shift-use1.c", 22
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; printf("assign-use1: left shift is $%X, not $CD00.\n", result);
+;
+	.dbg	line, "assign-shift-use1.c", 23
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _result
+	ldx     _result+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; result = buffer;
+;
+	.dbg	line, "assign-shift-use1.c", 26
+L0002:	lda     _buffer
+	ldx     _buffer+1
+	sta     _result
+	stx     _result+1
+;
+; result >>= 8;
+;
+	.dbg	line, "assign-shift-use1.c", 29
+	lda     _result
+	ldx     _result+1
+	txa
+	ldx     #$00
+	sta     _result
+	stx     _result+1
+;
+; if (result != 0x00AB) {
+;
+	.dbg	line, "assign-shift-use1.c", 30
+	lda     _result
+	ldx     _result+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$AB
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; ++failures;
+;
+	.dbg	line, "assign-shift-use1.c", 31
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+;
+; printf("assign-use1: right shift is $%X, not $00AB.\n", result);
+;
+	.dbg	line, "assign-shift-use1.c", 32
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _result
+	ldx     _result+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "assign-shift-use1.c", 35
+L0004:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "assign-shift-use1.c", 36
+L0001:	rts
+
+	.dbg	line
+.endproc
+
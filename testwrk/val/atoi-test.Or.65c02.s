@@ -0,0 +1,255 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stderr
+	.import		_fprintf
+	.import		_atoi
+	.export		_main
+
+.segment	"DATA"
+
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$74,$6F,$69,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20,$22,$25
+	.byte	$73,$22,$3A,$0A,$20,$20,$72,$65,$73,$75,$6C,$74,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$25,$64,$0A
+	.byte	$00
+S000E:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S000C:
+	.byte	$20,$2B,$30,$78,$37,$46,$46,$46,$00
+S0004:
+	.byte	$09,$20,$2D,$30,$2E,$31,$32,$33,$00
+S000D:
+	.byte	$20,$2D,$30,$78,$37,$46,$46,$46,$00
+S000A:
+	.byte	$20,$2D,$30,$33,$37,$37,$20,$00
+S0009:
+	.byte	$20,$2B,$30,$33,$37,$37,$20,$00
+S0005:
+	.byte	$20,$20,$2D,$33,$32,$20,$20,$00
+S000B	:=	S000C+2
+S0008:
+	.byte	$20,$30,$33,$37,$37,$20,$00
+S0006:
+	.byte	$20,$2B,$33,$32,$20,$20,$00
+S0003:
+	.byte	$09,$20,$2B,$30,$41,$00
+S0007:
+	.byte	$30,$33,$37,$37,$00
+
+; ---------------------------------------------------------------
+; void __near__ CheckAtoi (const char *Str, int Val)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckAtoi: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; int Res = atoi (Str);
+;
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _atoi
+	jsr     pushax
+;
+; if (Res != Val) {
+;
+	jsr     ldax0sp
+	ldy     #$02
+	cmp     (c_sp),y
+	bne     L0005
+	txa
+	iny
+	cmp     (c_sp),y
+	beq     L0002
+;
+; fprintf (outfile, "atoi error in \"%s\":\n"
+;
+L0005:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+;
+; "  result = %d, should be %d\n", Str, Res, Val);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _fprintf
+;
+; ++Failures;
+;
+	inc     _Failures
+	bne     L0002
+	inc     _Failures+1
+;
+; }
+;
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; CheckAtoi ("\t +0A", 0);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _CheckAtoi
+;
+; CheckAtoi ("\t -0.123", 0);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _CheckAtoi
+;
+; CheckAtoi ("  -32  ", -32);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" +32  ", 32);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     _CheckAtoi
+;
+; CheckAtoi ("0377", 377);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" 0377 ", 377);
+;
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" +0377 ", 377);
+;
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" -0377 ", -377);
+;
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$FE
+	lda     #$87
+	jsr     _CheckAtoi
+;
+; CheckAtoi ("0x7FFF", 0);
+;
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" +0x7FFF", 0);
+;
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _CheckAtoi
+;
+; CheckAtoi (" -0x7FFF", 0);
+;
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _CheckAtoi
+;
+; fprintf (outfile, "Failures: %u\n", Failures);
+;
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+;
+; return (Failures != 0);
+;
+	lda     _Failures
+	ldx     _Failures+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jmp     boolne
+
+.endproc
+
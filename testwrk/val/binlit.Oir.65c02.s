@@ -0,0 +1,2963 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_small:
+	.res	256,$00
+_big:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; small[0] = 0b0;
+;
+	jsr     decsp2
+	stz     _small
+;
+; small[1] = 0b1;
+;
+	lda     #$01
+	sta     _small+1
+;
+; small[2] = 0b10;
+;
+	ina
+	sta     _small+2
+;
+; small[3] = 0b11;
+;
+	ina
+	sta     _small+3
+;
+; small[4] = 0b100;
+;
+	ina
+	sta     _small+4
+;
+; small[5] = 0b101;
+;
+	ina
+	sta     _small+5
+;
+; small[6] = 0b110;
+;
+	ina
+	sta     _small+6
+;
+; small[7] = 0b000111;
+;
+	ina
+	sta     _small+7
+;
+; small[8] = 0b1000;
+;
+	ina
+	sta     _small+8
+;
+; small[9] = 0b1001;
+;
+	ina
+	sta     _small+9
+;
+; small[10] = 0b0001010;
+;
+	ina
+	sta     _small+10
+;
+; small[11] = 0b0001011;
+;
+	ina
+	sta     _small+11
+;
+; small[12] = 0b1100;
+;
+	ina
+	sta     _small+12
+;
+; small[13] = 0b1101;
+;
+	ina
+	sta     _small+13
+;
+; small[14] = 0b1110;
+;
+	ina
+	sta     _small+14
+;
+; small[15] = 0b1111;
+;
+	ina
+	sta     _small+15
+;
+; small[16] = 0b10000;
+;
+	ina
+	sta     _small+16
+;
+; small[17] = 0b10001;
+;
+	ina
+	sta     _small+17
+;
+; small[18] = 0b00010010;
+;
+	ina
+	sta     _small+18
+;
+; small[19] = 0b00010011;
+;
+	ina
+	sta     _small+19
+;
+; small[20] = 0b00010100;
+;
+	ina
+	sta     _small+20
+;
+; small[21] = 0b00010101;
+;
+	ina
+	sta     _small+21
+;
+; small[22] = 0b10110;
+;
+	ina
+	sta     _small+22
+;
+; small[23] = 0b10111;
+;
+	ina
+	sta     _small+23
+;
+; small[24] = 0b11000;
+;
+	ina
+	sta     _small+24
+;
+; small[25] = 0b11001;
+;
+	ina
+	sta     _small+25
+;
+; small[26] = 0b11010;
+;
+	ina
+	sta     _small+26
+;
+; small[27] = 0b11011;
+;
+	ina
+	sta     _small+27
+;
+; small[28] = 0b11100;
+;
+	ina
+	sta     _small+28
+;
+; small[29] = 0b11101;
+;
+	ina
+	sta     _small+29
+;
+; small[30] = 0b11110;
+;
+	ina
+	sta     _small+30
+;
+; small[31] = 0b11111;
+;
+	ina
+	sta     _small+31
+;
+; small[32] = 0b00000000100000;
+;
+	ina
+	sta     _small+32
+;
+; small[33] = 0b00000000100001;
+;
+	ina
+	sta     _small+33
+;
+; small[34] = 0b100010;
+;
+	ina
+	sta     _small+34
+;
+; small[35] = 0b100011;
+;
+	ina
+	sta     _small+35
+;
+; small[36] = 0b100100;
+;
+	ina
+	sta     _small+36
+;
+; small[37] = 0b100101;
+;
+	ina
+	sta     _small+37
+;
+; small[38] = 0b100110;
+;
+	ina
+	sta     _small+38
+;
+; small[39] = 0b100111;
+;
+	ina
+	sta     _small+39
+;
+; small[40] = 0b101000;
+;
+	ina
+	sta     _small+40
+;
+; small[41] = 0b101001;
+;
+	ina
+	sta     _small+41
+;
+; small[42] = 0b101010;
+;
+	ina
+	sta     _small+42
+;
+; small[43] = 0b101011;
+;
+	ina
+	sta     _small+43
+;
+; small[44] = 0b101100;
+;
+	ina
+	sta     _small+44
+;
+; small[45] = 0b101101;
+;
+	ina
+	sta     _small+45
+;
+; small[46] = 0b101110;
+;
+	ina
+	sta     _small+46
+;
+; small[47] = 0b101111;
+;
+	ina
+	sta     _small+47
+;
+; small[48] = 0b110000;
+;
+	ina
+	sta     _small+48
+;
+; small[49] = 0b110001;
+;
+	ina
+	sta     _small+49
+;
+; small[50] = 0b110010;
+;
+	ina
+	sta     _small+50
+;
+; small[51] = 0b110011;
+;
+	ina
+	sta     _small+51
+;
+; small[52] = 0b110100;
+;
+	ina
+	sta     _small+52
+;
+; small[53] = 0b110101;
+;
+	ina
+	sta     _small+53
+;
+; small[54] = 0b110110;
+;
+	ina
+	sta     _small+54
+;
+; small[55] = 0b110111;
+;
+	ina
+	sta     _small+55
+;
+; small[56] = 0b111000;
+;
+	ina
+	sta     _small+56
+;
+; small[57] = 0b111001;
+;
+	ina
+	sta     _small+57
+;
+; small[58] = 0b111010;
+;
+	ina
+	sta     _small+58
+;
+; small[59] = 0b111011;
+;
+	ina
+	sta     _small+59
+;
+; small[60] = 0b111100;
+;
+	ina
+	sta     _small+60
+;
+; small[61] = 0b111101;
+;
+	ina
+	sta     _small+61
+;
+; small[62] = 0b111110;
+;
+	ina
+	sta     _small+62
+;
+; small[63] = 0b111111;
+;
+	ina
+	sta     _small+63
+;
+; small[64] = 0b1000000;
+;
+	ina
+	sta     _small+64
+;
+; small[65] = 0b1000001;
+;
+	ina
+	sta     _small+65
+;
+; small[66] = 0b1000010;
+;
+	ina
+	sta     _small+66
+;
+; small[67] = 0b1000011;
+;
+	ina
+	sta     _small+67
+;
+; small[68] = 0b1000100;
+;
+	ina
+	sta     _small+68
+;
+; small[69] = 0b1000101;
+;
+	ina
+	sta     _small+69
+;
+; small[70] = 0b1000110;
+;
+	ina
+	sta     _small+70
+;
+; small[71] = 0b1000111;
+;
+	ina
+	sta     _small+71
+;
+; small[72] = 0b1001000;
+;
+	ina
+	sta     _small+72
+;
+; small[73] = 0b1001001;
+;
+	ina
+	sta     _small+73
+;
+; small[74] = 0b1001010;
+;
+	ina
+	sta     _small+74
+;
+; small[75] = 0b1001011;
+;
+	ina
+	sta     _small+75
+;
+; small[76] = 0b1001100;
+;
+	ina
+	sta     _small+76
+;
+; small[77] = 0b1001101;
+;
+	ina
+	sta     _small+77
+;
+; small[78] = 0b1001110;
+;
+	ina
+	sta     _small+78
+;
+; small[79] = 0b1001111;
+;
+	ina
+	sta     _small+79
+;
+; small[80] = 0b1010000;
+;
+	ina
+	sta     _small+80
+;
+; small[81] = 0b1010001;
+;
+	ina
+	sta     _small+81
+;
+; small[82] = 0b1010010;
+;
+	ina
+	sta     _small+82
+;
+; small[83] = 0b1010011;
+;
+	ina
+	sta     _small+83
+;
+; small[84] = 0b1010100;
+;
+	ina
+	sta     _small+84
+;
+; small[85] = 0b1010101;
+;
+	ina
+	sta     _small+85
+;
+; small[86] = 0b1010110;
+;
+	ina
+	sta     _small+86
+;
+; small[87] = 0b1010111;
+;
+	ina
+	sta     _small+87
+;
+; small[88] = 0b1011000;
+;
+	ina
+	sta     _small+88
+;
+; small[89] = 0b1011001;
+;
+	ina
+	sta     _small+89
+;
+; small[90] = 0b1011010;
+;
+	ina
+	sta     _small+90
+;
+; small[91] = 0b1011011;
+;
+	ina
+	sta     _small+91
+;
+; small[92] = 0b1011100;
+;
+	ina
+	sta     _small+92
+;
+; small[93] = 0b1011101;
+;
+	ina
+	sta     _small+93
+;
+; small[94] = 0b1011110;
+;
+	ina
+	sta     _small+94
+;
+; small[95] = 0b1011111;
+;
+	ina
+	sta     _small+95
+;
+; small[96] = 0b1100000;
+;
+	ina
+	sta     _small+96
+;
+; small[97] = 0b1100001;
+;
+	ina
+	sta     _small+97
+;
+; small[98] = 0b1100010;
+;
+	ina
+	sta     _small+98
+;
+; small[99] = 0b1100011;
+;
+	ina
+	sta     _small+99
+;
+; small[100] = 0b1100100;
+;
+	ina
+	sta     _small+100
+;
+; small[101] = 0b1100101;
+;
+	ina
+	sta     _small+101
+;
+; small[102] = 0b1100110;
+;
+	ina
+	sta     _small+102
+;
+; small[103] = 0b1100111;
+;
+	ina
+	sta     _small+103
+;
+; small[104] = 0b1101000;
+;
+	ina
+	sta     _small+104
+;
+; small[105] = 0b1101001;
+;
+	ina
+	sta     _small+105
+;
+; small[106] = 0b1101010;
+;
+	ina
+	sta     _small+106
+;
+; small[107] = 0b1101011;
+;
+	ina
+	sta     _small+107
+;
+; small[108] = 0b1101100;
+;
+	ina
+	sta     _small+108
+;
+; small[109] = 0b1101101;
+;
+	ina
+	sta     _small+109
+;
+; small[110] = 0b1101110;
+;
+	ina
+	sta     _small+110
+;
+; small[111] = 0b1101111;
+;
+	ina
+	sta     _small+111
+;
+; small[112] = 0b1110000;
+;
+	ina
+	sta     _small+112
+;
+; small[113] = 0b1110001;
+;
+	ina
+	sta     _small+113
+;
+; small[114] = 0b1110010;
+;
+	ina
+	sta     _small+114
+;
+; small[115] = 0b1110011;
+;
+	ina
+	sta     _small+115
+;
+; small[116] = 0b1110100;
+;
+	ina
+	sta     _small+116
+;
+; small[117] = 0b1110101;
+;
+	ina
+	sta     _small+117
+;
+; small[118] = 0b1110110;
+;
+	ina
+	sta     _small+118
+;
+; small[119] = 0b1110111;
+;
+	ina
+	sta     _small+119
+;
+; small[120] = 0b1111000;
+;
+	ina
+	sta     _small+120
+;
+; small[121] = 0b1111001;
+;
+	ina
+	sta     _small+121
+;
+; small[122] = 0b1111010;
+;
+	ina
+	sta     _small+122
+;
+; small[123] = 0b1111011;
+;
+	ina
+	sta     _small+123
+;
+; small[124] = 0b1111100;
+;
+	ina
+	sta     _small+124
+;
+; small[125] = 0b1111101;
+;
+	ina
+	sta     _small+125
+;
+; small[126] = 0b1111110;
+;
+	ina
+	sta     _small+126
+;
+; small[127] = 0b1111111;
+;
+	ina
+	sta     _small+127
+;
+; small[128] = 0b10000000;
+;
+	ina
+	sta     _small+128
+;
+; small[129] = 0b10000001;
+;
+	ina
+	sta     _small+129
+;
+; small[130] = 0b10000010;
+;
+	ina
+	sta     _small+130
+;
+; small[131] = 0b10000011;
+;
+	ina
+	sta     _small+131
+;
+; small[132] = 0b10000100;
+;
+	ina
+	sta     _small+132
+;
+; small[133] = 0b10000101;
+;
+	ina
+	sta     _small+133
+;
+; small[134] = 0b10000110;
+;
+	ina
+	sta     _small+134
+;
+; small[135] = 0b10000111;
+;
+	ina
+	sta     _small+135
+;
+; small[136] = 0b10001000;
+;
+	ina
+	sta     _small+136
+;
+; small[137] = 0b10001001;
+;
+	ina
+	sta     _small+137
+;
+; small[138] = 0b10001010;
+;
+	ina
+	sta     _small+138
+;
+; small[139] = 0b10001011;
+;
+	ina
+	sta     _small+139
+;
+; small[140] = 0b10001100;
+;
+	ina
+	sta     _small+140
+;
+; small[141] = 0b10001101;
+;
+	ina
+	sta     _small+141
+;
+; small[142] = 0b10001110;
+;
+	ina
+	sta     _small+142
+;
+; small[143] = 0b10001111;
+;
+	ina
+	sta     _small+143
+;
+; small[144] = 0b10010000;
+;
+	ina
+	sta     _small+144
+;
+; small[145] = 0b10010001;
+;
+	ina
+	sta     _small+145
+;
+; small[146] = 0b10010010;
+;
+	ina
+	sta     _small+146
+;
+; small[147] = 0b10010011;
+;
+	ina
+	sta     _small+147
+;
+; small[148] = 0b10010100;
+;
+	ina
+	sta     _small+148
+;
+; small[149] = 0b10010101;
+;
+	ina
+	sta     _small+149
+;
+; small[150] = 0b10010110;
+;
+	ina
+	sta     _small+150
+;
+; small[151] = 0b10010111;
+;
+	ina
+	sta     _small+151
+;
+; small[152] = 0b10011000;
+;
+	ina
+	sta     _small+152
+;
+; small[153] = 0b10011001;
+;
+	ina
+	sta     _small+153
+;
+; small[154] = 0b10011010;
+;
+	ina
+	sta     _small+154
+;
+; small[155] = 0b10011011;
+;
+	ina
+	sta     _small+155
+;
+; small[156] = 0b10011100;
+;
+	ina
+	sta     _small+156
+;
+; small[157] = 0b10011101;
+;
+	ina
+	sta     _small+157
+;
+; small[158] = 0b10011110;
+;
+	ina
+	sta     _small+158
+;
+; small[159] = 0b10011111;
+;
+	ina
+	sta     _small+159
+;
+; small[160] = 0b10100000;
+;
+	ina
+	sta     _small+160
+;
+; small[161] = 0b10100001;
+;
+	ina
+	sta     _small+161
+;
+; small[162] = 0b10100010;
+;
+	ina
+	sta     _small+162
+;
+; small[163] = 0b10100011;
+;
+	ina
+	sta     _small+163
+;
+; small[164] = 0b10100100;
+;
+	ina
+	sta     _small+164
+;
+; small[165] = 0b10100101;
+;
+	ina
+	sta     _small+165
+;
+; small[166] = 0b10100110;
+;
+	ina
+	sta     _small+166
+;
+; small[167] = 0b10100111;
+;
+	ina
+	sta     _small+167
+;
+; small[168] = 0b10101000;
+;
+	ina
+	sta     _small+168
+;
+; small[169] = 0b10101001;
+;
+	ina
+	sta     _small+169
+;
+; small[170] = 0b10101010;
+;
+	ina
+	sta     _small+170
+;
+; small[171] = 0b10101011;
+;
+	ina
+	sta     _small+171
+;
+; small[172] = 0b10101100;
+;
+	ina
+	sta     _small+172
+;
+; small[173] = 0b10101101;
+;
+	ina
+	sta     _small+173
+;
+; small[174] = 0b10101110;
+;
+	ina
+	sta     _small+174
+;
+; small[175] = 0b10101111;
+;
+	ina
+	sta     _small+175
+;
+; small[176] = 0b10110000;
+;
+	ina
+	sta     _small+176
+;
+; small[177] = 0b10110001;
+;
+	ina
+	sta     _small+177
+;
+; small[178] = 0b10110010;
+;
+	ina
+	sta     _small+178
+;
+; small[179] = 0b10110011;
+;
+	ina
+	sta     _small+179
+;
+; small[180] = 0b10110100;
+;
+	ina
+	sta     _small+180
+;
+; small[181] = 0b10110101;
+;
+	ina
+	sta     _small+181
+;
+; small[182] = 0b10110110;
+;
+	ina
+	sta     _small+182
+;
+; small[183] = 0b10110111;
+;
+	ina
+	sta     _small+183
+;
+; small[184] = 0b10111000;
+;
+	ina
+	sta     _small+184
+;
+; small[185] = 0b10111001;
+;
+	ina
+	sta     _small+185
+;
+; small[186] = 0b10111010;
+;
+	ina
+	sta     _small+186
+;
+; small[187] = 0b10111011;
+;
+	ina
+	sta     _small+187
+;
+; small[188] = 0b10111100;
+;
+	ina
+	sta     _small+188
+;
+; small[189] = 0b10111101;
+;
+	ina
+	sta     _small+189
+;
+; small[190] = 0b10111110;
+;
+	ina
+	sta     _small+190
+;
+; small[191] = 0b10111111;
+;
+	ina
+	sta     _small+191
+;
+; small[192] = 0b11000000;
+;
+	ina
+	sta     _small+192
+;
+; small[193] = 0b11000001;
+;
+	ina
+	sta     _small+193
+;
+; small[194] = 0b11000010;
+;
+	ina
+	sta     _small+194
+;
+; small[195] = 0b11000011;
+;
+	ina
+	sta     _small+195
+;
+; small[196] = 0b11000100;
+;
+	ina
+	sta     _small+196
+;
+; small[197] = 0b11000101;
+;
+	ina
+	sta     _small+197
+;
+; small[198] = 0b11000110;
+;
+	ina
+	sta     _small+198
+;
+; small[199] = 0b11000111;
+;
+	ina
+	sta     _small+199
+;
+; small[200] = 0b11001000;
+;
+	ina
+	sta     _small+200
+;
+; small[201] = 0b11001001;
+;
+	ina
+	sta     _small+201
+;
+; small[202] = 0b11001010;
+;
+	ina
+	sta     _small+202
+;
+; small[203] = 0b11001011;
+;
+	ina
+	sta     _small+203
+;
+; small[204] = 0b11001100;
+;
+	ina
+	sta     _small+204
+;
+; small[205] = 0b11001101;
+;
+	ina
+	sta     _small+205
+;
+; small[206] = 0b11001110;
+;
+	ina
+	sta     _small+206
+;
+; small[207] = 0b11001111;
+;
+	ina
+	sta     _small+207
+;
+; small[208] = 0b11010000;
+;
+	ina
+	sta     _small+208
+;
+; small[209] = 0b11010001;
+;
+	ina
+	sta     _small+209
+;
+; small[210] = 0b11010010;
+;
+	ina
+	sta     _small+210
+;
+; small[211] = 0b11010011;
+;
+	ina
+	sta     _small+211
+;
+; small[212] = 0b11010100;
+;
+	ina
+	sta     _small+212
+;
+; small[213] = 0b11010101;
+;
+	ina
+	sta     _small+213
+;
+; small[214] = 0b11010110;
+;
+	ina
+	sta     _small+214
+;
+; small[215] = 0b11010111;
+;
+	ina
+	sta     _small+215
+;
+; small[216] = 0b11011000;
+;
+	ina
+	sta     _small+216
+;
+; small[217] = 0b11011001;
+;
+	ina
+	sta     _small+217
+;
+; small[218] = 0b11011010;
+;
+	ina
+	sta     _small+218
+;
+; small[219] = 0b11011011;
+;
+	ina
+	sta     _small+219
+;
+; small[220] = 0b11011100;
+;
+	ina
+	sta     _small+220
+;
+; small[221] = 0b11011101;
+;
+	ina
+	sta     _small+221
+;
+; small[222] = 0b11011110;
+;
+	ina
+	sta     _small+222
+;
+; small[223] = 0b11011111;
+;
+	ina
+	sta     _small+223
+;
+; small[224] = 0b11100000;
+;
+	ina
+	sta     _small+224
+;
+; small[225] = 0b11100001;
+;
+	ina
+	sta     _small+225
+;
+; small[226] = 0b11100010;
+;
+	ina
+	sta     _small+226
+;
+; small[227] = 0b11100011;
+;
+	ina
+	sta     _small+227
+;
+; small[228] = 0b11100100;
+;
+	ina
+	sta     _small+228
+;
+; small[229] = 0b11100101;
+;
+	ina
+	sta     _small+229
+;
+; small[230] = 0b11100110;
+;
+	ina
+	sta     _small+230
+;
+; small[231] = 0b11100111;
+;
+	ina
+	sta     _small+231
+;
+; small[232] = 0b11101000;
+;
+	ina
+	sta     _small+232
+;
+; small[233] = 0b11101001;
+;
+	ina
+	sta     _small+233
+;
+; small[234] = 0b11101010;
+;
+	ina
+	sta     _small+234
+;
+; small[235] = 0b11101011;
+;
+	ina
+	sta     _small+235
+;
+; small[236] = 0b11101100;
+;
+	ina
+	sta     _small+236
+;
+; small[237] = 0b11101101;
+;
+	ina
+	sta     _small+237
+;
+; small[238] = 0b11101110;
+;
+	ina
+	sta     _small+238
+;
+; small[239] = 0b11101111;
+;
+	ina
+	sta     _small+239
+;
+; small[240] = 0b11110000;
+;
+	ina
+	sta     _small+240
+;
+; small[241] = 0b11110001;
+;
+	ina
+	sta     _small+241
+;
+; small[242] = 0b11110010;
+;
+	ina
+	sta     _small+242
+;
+; small[243] = 0b11110011;
+;
+	ina
+	sta     _small+243
+;
+; small[244] = 0b11110100;
+;
+	ina
+	sta     _small+244
+;
+; small[245] = 0b11110101;
+;
+	ina
+	sta     _small+245
+;
+; small[246] = 0b11110110;
+;
+	ina
+	sta     _small+246
+;
+; small[247] = 0b11110111;
+;
+	ina
+	sta     _small+247
+;
+; small[248] = 0b11111000;
+;
+	ina
+	sta     _small+248
+;
+; small[249] = 0b11111001;
+;
+	ina
+	sta     _small+249
+;
+; small[250] = 0b11111010;
+;
+	ina
+	sta     _small+250
+;
+; small[251] = 0b11111011;
+;
+	ina
+	sta     _small+251
+;
+; small[252] = 0b11111100;
+;
+	ina
+	sta     _small+252
+;
+; small[253] = 0b11111101;
+;
+	ina
+	sta     _small+253
+;
+; small[254] = 0b11111110;
+;
+	ina
+	sta     _small+254
+;
+; small[255] = 0b11111111;
+;
+	ina
+	sta     _small+255
+;
+; for (i = 0; i < 256; i++) {
+;
+	ina
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	cpx     #$01
+	bcs     L0003
+;
+; if (small[i] != i)
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_small)
+	sta     ptr1+1
+	ldy     #<(_small)
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     (c_sp)
+	bne     L000D
+	txa
+	ldy     #$01
+	cmp     (c_sp),y
+	beq     L0004
+;
+; return 1;
+;
+L000D:	lda     #$01
+	rts
+;
+; for (i = 0; i < 256; i++) {
+;
+L0004:	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+;
+; big[0] = 0b1111111100000000;
+;
+L0003:	ldx     #$FF
+	stz     _big
+	stx     _big+1
+;
+; big[1] = 0b1111111100000001;
+;
+	tya
+	sta     _big+2
+	stx     _big+2+1
+;
+; big[2] = 0b1111111100000010;
+;
+	ina
+	sta     _big+4
+	stx     _big+4+1
+;
+; big[3] = 0b1111111100000011;
+;
+	ina
+	sta     _big+6
+	stx     _big+6+1
+;
+; big[4] = 0b1111111100000100;
+;
+	ina
+	sta     _big+8
+	stx     _big+8+1
+;
+; big[5] = 0b1111111100000101;
+;
+	ina
+	sta     _big+10
+	stx     _big+10+1
+;
+; big[6] = 0b1111111100000110;
+;
+	ina
+	sta     _big+12
+	stx     _big+12+1
+;
+; big[7] = 0b1111111100000111;
+;
+	ina
+	sta     _big+14
+	stx     _big+14+1
+;
+; big[8] = 0b1111111100001000;
+;
+	ina
+	sta     _big+16
+	stx     _big+16+1
+;
+; big[9] = 0b1111111100001001;
+;
+	ina
+	sta     _big+18
+	stx     _big+18+1
+;
+; big[10] = 0b1111111100001010;
+;
+	ina
+	sta     _big+20
+	stx     _big+20+1
+;
+; big[11] = 0b1111111100001011;
+;
+	ina
+	sta     _big+22
+	stx     _big+22+1
+;
+; big[12] = 0b1111111100001100;
+;
+	ina
+	sta     _big+24
+	stx     _big+24+1
+;
+; big[13] = 0b1111111100001101;
+;
+	ina
+	sta     _big+26
+	stx     _big+26+1
+;
+; big[14] = 0b1111111100001110;
+;
+	ina
+	sta     _big+28
+	stx     _big+28+1
+;
+; big[15] = 0b1111111100001111;
+;
+	ina
+	sta     _big+30
+	stx     _big+30+1
+;
+; big[16] = 0b1111111100010000;
+;
+	ina
+	sta     _big+32
+	stx     _big+32+1
+;
+; big[17] = 0b1111111100010001;
+;
+	ina
+	sta     _big+34
+	stx     _big+34+1
+;
+; big[18] = 0b1111111100010010;
+;
+	ina
+	sta     _big+36
+	stx     _big+36+1
+;
+; big[19] = 0b1111111100010011;
+;
+	ina
+	sta     _big+38
+	stx     _big+38+1
+;
+; big[20] = 0b1111111100010100;
+;
+	ina
+	sta     _big+40
+	stx     _big+40+1
+;
+; big[21] = 0b1111111100010101;
+;
+	ina
+	sta     _big+42
+	stx     _big+42+1
+;
+; big[22] = 0b1111111100010110;
+;
+	ina
+	sta     _big+44
+	stx     _big+44+1
+;
+; big[23] = 0b1111111100010111;
+;
+	ina
+	sta     _big+46
+	stx     _big+46+1
+;
+; big[24] = 0b1111111100011000;
+;
+	ina
+	sta     _big+48
+	stx     _big+48+1
+;
+; big[25] = 0b1111111100011001;
+;
+	ina
+	sta     _big+50
+	stx     _big+50+1
+;
+; big[26] = 0b1111111100011010;
+;
+	ina
+	sta     _big+52
+	stx     _big+52+1
+;
+; big[27] = 0b1111111100011011;
+;
+	ina
+	sta     _big+54
+	stx     _big+54+1
+;
+; big[28] = 0b1111111100011100;
+;
+	ina
+	sta     _big+56
+	stx     _big+56+1
+;
+; big[29] = 0b1111111100011101;
+;
+	ina
+	sta     _big+58
+	stx     _big+58+1
+;
+; big[30] = 0b1111111100011110;
+;
+	ina
+	sta     _big+60
+	stx     _big+60+1
+;
+; big[31] = 0b1111111100011111;
+;
+	ina
+	sta     _big+62
+	stx     _big+62+1
+;
+; big[32] = 0b1111111100100000;
+;
+	ina
+	sta     _big+64
+	stx     _big+64+1
+;
+; big[33] = 0b1111111100100001;
+;
+	ina
+	sta     _big+66
+	stx     _big+66+1
+;
+; big[34] = 0b1111111100100010;
+;
+	ina
+	sta     _big+68
+	stx     _big+68+1
+;
+; big[35] = 0b1111111100100011;
+;
+	ina
+	sta     _big+70
+	stx     _big+70+1
+;
+; big[36] = 0b1111111100100100;
+;
+	ina
+	sta     _big+72
+	stx     _big+72+1
+;
+; big[37] = 0b1111111100100101;
+;
+	ina
+	sta     _big+74
+	stx     _big+74+1
+;
+; big[38] = 0b1111111100100110;
+;
+	ina
+	sta     _big+76
+	stx     _big+76+1
+;
+; big[39] = 0b1111111100100111;
+;
+	ina
+	sta     _big+78
+	stx     _big+78+1
+;
+; big[40] = 0b1111111100101000;
+;
+	ina
+	sta     _big+80
+	stx     _big+80+1
+;
+; big[41] = 0b1111111100101001;
+;
+	ina
+	sta     _big+82
+	stx     _big+82+1
+;
+; big[42] = 0b1111111100101010;
+;
+	ina
+	sta     _big+84
+	stx     _big+84+1
+;
+; big[43] = 0b1111111100101011;
+;
+	ina
+	sta     _big+86
+	stx     _big+86+1
+;
+; big[44] = 0b1111111100101100;
+;
+	ina
+	sta     _big+88
+	stx     _big+88+1
+;
+; big[45] = 0b1111111100101101;
+;
+	ina
+	sta     _big+90
+	stx     _big+90+1
+;
+; big[46] = 0b1111111100101110;
+;
+	ina
+	sta     _big+92
+	stx     _big+92+1
+;
+; big[47] = 0b1111111100101111;
+;
+	ina
+	sta     _big+94
+	stx     _big+94+1
+;
+; big[48] = 0b1111111100110000;
+;
+	ina
+	sta     _big+96
+	stx     _big+96+1
+;
+; big[49] = 0b1111111100110001;
+;
+	ina
+	sta     _big+98
+	stx     _big+98+1
+;
+; big[50] = 0b1111111100110010;
+;
+	ina
+	sta     _big+100
+	stx     _big+100+1
+;
+; big[51] = 0b1111111100110011;
+;
+	ina
+	sta     _big+102
+	stx     _big+102+1
+;
+; big[52] = 0b1111111100110100;
+;
+	ina
+	sta     _big+104
+	stx     _big+104+1
+;
+; big[53] = 0b1111111100110101;
+;
+	ina
+	sta     _big+106
+	stx     _big+106+1
+;
+; big[54] = 0b1111111100110110;
+;
+	ina
+	sta     _big+108
+	stx     _big+108+1
+;
+; big[55] = 0b1111111100110111;
+;
+	ina
+	sta     _big+110
+	stx     _big+110+1
+;
+; big[56] = 0b1111111100111000;
+;
+	ina
+	sta     _big+112
+	stx     _big+112+1
+;
+; big[57] = 0b1111111100111001;
+;
+	ina
+	sta     _big+114
+	stx     _big+114+1
+;
+; big[58] = 0b1111111100111010;
+;
+	ina
+	sta     _big+116
+	stx     _big+116+1
+;
+; big[59] = 0b1111111100111011;
+;
+	ina
+	sta     _big+118
+	stx     _big+118+1
+;
+; big[60] = 0b1111111100111100;
+;
+	ina
+	sta     _big+120
+	stx     _big+120+1
+;
+; big[61] = 0b1111111100111101;
+;
+	ina
+	sta     _big+122
+	stx     _big+122+1
+;
+; big[62] = 0b1111111100111110;
+;
+	ina
+	sta     _big+124
+	stx     _big+124+1
+;
+; big[63] = 0b1111111100111111;
+;
+	ina
+	sta     _big+126
+	stx     _big+126+1
+;
+; big[64] = 0b1111111101000000;
+;
+	ina
+	sta     _big+128
+	stx     _big+128+1
+;
+; big[65] = 0b1111111101000001;
+;
+	ina
+	sta     _big+130
+	stx     _big+130+1
+;
+; big[66] = 0b1111111101000010;
+;
+	ina
+	sta     _big+132
+	stx     _big+132+1
+;
+; big[67] = 0b1111111101000011;
+;
+	ina
+	sta     _big+134
+	stx     _big+134+1
+;
+; big[68] = 0b1111111101000100;
+;
+	ina
+	sta     _big+136
+	stx     _big+136+1
+;
+; big[69] = 0b1111111101000101;
+;
+	ina
+	sta     _big+138
+	stx     _big+138+1
+;
+; big[70] = 0b1111111101000110;
+;
+	ina
+	sta     _big+140
+	stx     _big+140+1
+;
+; big[71] = 0b1111111101000111;
+;
+	ina
+	sta     _big+142
+	stx     _big+142+1
+;
+; big[72] = 0b1111111101001000;
+;
+	ina
+	sta     _big+144
+	stx     _big+144+1
+;
+; big[73] = 0b1111111101001001;
+;
+	ina
+	sta     _big+146
+	stx     _big+146+1
+;
+; big[74] = 0b1111111101001010;
+;
+	ina
+	sta     _big+148
+	stx     _big+148+1
+;
+; big[75] = 0b1111111101001011;
+;
+	ina
+	sta     _big+150
+	stx     _big+150+1
+;
+; big[76] = 0b1111111101001100;
+;
+	ina
+	sta     _big+152
+	stx     _big+152+1
+;
+; big[77] = 0b1111111101001101;
+;
+	ina
+	sta     _big+154
+	stx     _big+154+1
+;
+; big[78] = 0b1111111101001110;
+;
+	ina
+	sta     _big+156
+	stx     _big+156+1
+;
+; big[79] = 0b1111111101001111;
+;
+	ina
+	sta     _big+158
+	stx     _big+158+1
+;
+; big[80] = 0b1111111101010000;
+;
+	ina
+	sta     _big+160
+	stx     _big+160+1
+;
+; big[81] = 0b1111111101010001;
+;
+	ina
+	sta     _big+162
+	stx     _big+162+1
+;
+; big[82] = 0b1111111101010010;
+;
+	ina
+	sta     _big+164
+	stx     _big+164+1
+;
+; big[83] = 0b1111111101010011;
+;
+	ina
+	sta     _big+166
+	stx     _big+166+1
+;
+; big[84] = 0b1111111101010100;
+;
+	ina
+	sta     _big+168
+	stx     _big+168+1
+;
+; big[85] = 0b1111111101010101;
+;
+	ina
+	sta     _big+170
+	stx     _big+170+1
+;
+; big[86] = 0b1111111101010110;
+;
+	ina
+	sta     _big+172
+	stx     _big+172+1
+;
+; big[87] = 0b1111111101010111;
+;
+	ina
+	sta     _big+174
+	stx     _big+174+1
+;
+; big[88] = 0b1111111101011000;
+;
+	ina
+	sta     _big+176
+	stx     _big+176+1
+;
+; big[89] = 0b1111111101011001;
+;
+	ina
+	sta     _big+178
+	stx     _big+178+1
+;
+; big[90] = 0b1111111101011010;
+;
+	ina
+	sta     _big+180
+	stx     _big+180+1
+;
+; big[91] = 0b1111111101011011;
+;
+	ina
+	sta     _big+182
+	stx     _big+182+1
+;
+; big[92] = 0b1111111101011100;
+;
+	ina
+	sta     _big+184
+	stx     _big+184+1
+;
+; big[93] = 0b1111111101011101;
+;
+	ina
+	sta     _big+186
+	stx     _big+186+1
+;
+; big[94] = 0b1111111101011110;
+;
+	ina
+	sta     _big+188
+	stx     _big+188+1
+;
+; big[95] = 0b1111111101011111;
+;
+	ina
+	sta     _big+190
+	stx     _big+190+1
+;
+; big[96] = 0b1111111101100000;
+;
+	ina
+	sta     _big+192
+	stx     _big+192+1
+;
+; big[97] = 0b1111111101100001;
+;
+	ina
+	sta     _big+194
+	stx     _big+194+1
+;
+; big[98] = 0b1111111101100010;
+;
+	ina
+	sta     _big+196
+	stx     _big+196+1
+;
+; big[99] = 0b1111111101100011;
+;
+	ina
+	sta     _big+198
+	stx     _big+198+1
+;
+; big[100] = 0b1111111101100100;
+;
+	ina
+	sta     _big+200
+	stx     _big+200+1
+;
+; big[101] = 0b1111111101100101;
+;
+	ina
+	sta     _big+202
+	stx     _big+202+1
+;
+; big[102] = 0b1111111101100110;
+;
+	ina
+	sta     _big+204
+	stx     _big+204+1
+;
+; big[103] = 0b1111111101100111;
+;
+	ina
+	sta     _big+206
+	stx     _big+206+1
+;
+; big[104] = 0b1111111101101000;
+;
+	ina
+	sta     _big+208
+	stx     _big+208+1
+;
+; big[105] = 0b1111111101101001;
+;
+	ina
+	sta     _big+210
+	stx     _big+210+1
+;
+; big[106] = 0b1111111101101010;
+;
+	ina
+	sta     _big+212
+	stx     _big+212+1
+;
+; big[107] = 0b1111111101101011;
+;
+	ina
+	sta     _big+214
+	stx     _big+214+1
+;
+; big[108] = 0b1111111101101100;
+;
+	ina
+	sta     _big+216
+	stx     _big+216+1
+;
+; big[109] = 0b1111111101101101;
+;
+	ina
+	sta     _big+218
+	stx     _big+218+1
+;
+; big[110] = 0b1111111101101110;
+;
+	ina
+	sta     _big+220
+	stx     _big+220+1
+;
+; big[111] = 0b1111111101101111;
+;
+	ina
+	sta     _big+222
+	stx     _big+222+1
+;
+; big[112] = 0b1111111101110000;
+;
+	ina
+	sta     _big+224
+	stx     _big+224+1
+;
+; big[113] = 0b1111111101110001;
+;
+	ina
+	sta     _big+226
+	stx     _big+226+1
+;
+; big[114] = 0b1111111101110010;
+;
+	ina
+	sta     _big+228
+	stx     _big+228+1
+;
+; big[115] = 0b1111111101110011;
+;
+	ina
+	sta     _big+230
+	stx     _big+230+1
+;
+; big[116] = 0b1111111101110100;
+;
+	ina
+	sta     _big+232
+	stx     _big+232+1
+;
+; big[117] = 0b1111111101110101;
+;
+	ina
+	sta     _big+234
+	stx     _big+234+1
+;
+; big[118] = 0b1111111101110110;
+;
+	ina
+	sta     _big+236
+	stx     _big+236+1
+;
+; big[119] = 0b1111111101110111;
+;
+	ina
+	sta     _big+238
+	stx     _big+238+1
+;
+; big[120] = 0b1111111101111000;
+;
+	ina
+	sta     _big+240
+	stx     _big+240+1
+;
+; big[121] = 0b1111111101111001;
+;
+	ina
+	sta     _big+242
+	stx     _big+242+1
+;
+; big[122] = 0b1111111101111010;
+;
+	ina
+	sta     _big+244
+	stx     _big+244+1
+;
+; big[123] = 0b1111111101111011;
+;
+	ina
+	sta     _big+246
+	stx     _big+246+1
+;
+; big[124] = 0b1111111101111100;
+;
+	ina
+	sta     _big+248
+	stx     _big+248+1
+;
+; big[125] = 0b1111111101111101;
+;
+	ina
+	sta     _big+250
+	stx     _big+250+1
+;
+; big[126] = 0b1111111101111110;
+;
+	ina
+	sta     _big+252
+	stx     _big+252+1
+;
+; big[127] = 0b1111111101111111;
+;
+	ina
+	sta     _big+254
+	stx     _big+254+1
+;
+; big[128] = 0b1111111110000000;
+;
+	ina
+	sta     _big+256
+	stx     _big+256+1
+;
+; big[129] = 0b1111111110000001;
+;
+	ina
+	sta     _big+258
+	stx     _big+258+1
+;
+; big[130] = 0b1111111110000010;
+;
+	ina
+	sta     _big+260
+	stx     _big+260+1
+;
+; big[131] = 0b1111111110000011;
+;
+	ina
+	sta     _big+262
+	stx     _big+262+1
+;
+; big[132] = 0b1111111110000100;
+;
+	ina
+	sta     _big+264
+	stx     _big+264+1
+;
+; big[133] = 0b1111111110000101;
+;
+	ina
+	sta     _big+266
+	stx     _big+266+1
+;
+; big[134] = 0b1111111110000110;
+;
+	ina
+	sta     _big+268
+	stx     _big+268+1
+;
+; big[135] = 0b1111111110000111;
+;
+	ina
+	sta     _big+270
+	stx     _big+270+1
+;
+; big[136] = 0b1111111110001000;
+;
+	ina
+	sta     _big+272
+	stx     _big+272+1
+;
+; big[137] = 0b1111111110001001;
+;
+	ina
+	sta     _big+274
+	stx     _big+274+1
+;
+; big[138] = 0b1111111110001010;
+;
+	ina
+	sta     _big+276
+	stx     _big+276+1
+;
+; big[139] = 0b1111111110001011;
+;
+	ina
+	sta     _big+278
+	stx     _big+278+1
+;
+; big[140] = 0b1111111110001100;
+;
+	ina
+	sta     _big+280
+	stx     _big+280+1
+;
+; big[141] = 0b1111111110001101;
+;
+	ina
+	sta     _big+282
+	stx     _big+282+1
+;
+; big[142] = 0b1111111110001110;
+;
+	ina
+	sta     _big+284
+	stx     _big+284+1
+;
+; big[143] = 0b1111111110001111;
+;
+	ina
+	sta     _big+286
+	stx     _big+286+1
+;
+; big[144] = 0b1111111110010000;
+;
+	ina
+	sta     _big+288
+	stx     _big+288+1
+;
+; big[145] = 0b1111111110010001;
+;
+	ina
+	sta     _big+290
+	stx     _big+290+1
+;
+; big[146] = 0b1111111110010010;
+;
+	ina
+	sta     _big+292
+	stx     _big+292+1
+;
+; big[147] = 0b1111111110010011;
+;
+	ina
+	sta     _big+294
+	stx     _big+294+1
+;
+; big[148] = 0b1111111110010100;
+;
+	ina
+	sta     _big+296
+	stx     _big+296+1
+;
+; big[149] = 0b1111111110010101;
+;
+	ina
+	sta     _big+298
+	stx     _big+298+1
+;
+; big[150] = 0b1111111110010110;
+;
+	ina
+	sta     _big+300
+	stx     _big+300+1
+;
+; big[151] = 0b1111111110010111;
+;
+	ina
+	sta     _big+302
+	stx     _big+302+1
+;
+; big[152] = 0b1111111110011000;
+;
+	ina
+	sta     _big+304
+	stx     _big+304+1
+;
+; big[153] = 0b1111111110011001;
+;
+	ina
+	sta     _big+306
+	stx     _big+306+1
+;
+; big[154] = 0b1111111110011010;
+;
+	ina
+	sta     _big+308
+	stx     _big+308+1
+;
+; big[155] = 0b1111111110011011;
+;
+	ina
+	sta     _big+310
+	stx     _big+310+1
+;
+; big[156] = 0b1111111110011100;
+;
+	ina
+	sta     _big+312
+	stx     _big+312+1
+;
+; big[157] = 0b1111111110011101;
+;
+	ina
+	sta     _big+314
+	stx     _big+314+1
+;
+; big[158] = 0b1111111110011110;
+;
+	ina
+	sta     _big+316
+	stx     _big+316+1
+;
+; big[159] = 0b1111111110011111;
+;
+	ina
+	sta     _big+318
+	stx     _big+318+1
+;
+; big[160] = 0b1111111110100000;
+;
+	ina
+	sta     _big+320
+	stx     _big+320+1
+;
+; big[161] = 0b1111111110100001;
+;
+	ina
+	sta     _big+322
+	stx     _big+322+1
+;
+; big[162] = 0b1111111110100010;
+;
+	ina
+	sta     _big+324
+	stx     _big+324+1
+;
+; big[163] = 0b1111111110100011;
+;
+	ina
+	sta     _big+326
+	stx     _big+326+1
+;
+; big[164] = 0b1111111110100100;
+;
+	ina
+	sta     _big+328
+	stx     _big+328+1
+;
+; big[165] = 0b1111111110100101;
+;
+	ina
+	sta     _big+330
+	stx     _big+330+1
+;
+; big[166] = 0b1111111110100110;
+;
+	ina
+	sta     _big+332
+	stx     _big+332+1
+;
+; big[167] = 0b1111111110100111;
+;
+	ina
+	sta     _big+334
+	stx     _big+334+1
+;
+; big[168] = 0b1111111110101000;
+;
+	ina
+	sta     _big+336
+	stx     _big+336+1
+;
+; big[169] = 0b1111111110101001;
+;
+	ina
+	sta     _big+338
+	stx     _big+338+1
+;
+; big[170] = 0b1111111110101010;
+;
+	ina
+	sta     _big+340
+	stx     _big+340+1
+;
+; big[171] = 0b1111111110101011;
+;
+	ina
+	sta     _big+342
+	stx     _big+342+1
+;
+; big[172] = 0b1111111110101100;
+;
+	ina
+	sta     _big+344
+	stx     _big+344+1
+;
+; big[173] = 0b1111111110101101;
+;
+	ina
+	sta     _big+346
+	stx     _big+346+1
+;
+; big[174] = 0b1111111110101110;
+;
+	ina
+	sta     _big+348
+	stx     _big+348+1
+;
+; big[175] = 0b1111111110101111;
+;
+	ina
+	sta     _big+350
+	stx     _big+350+1
+;
+; big[176] = 0b1111111110110000;
+;
+	ina
+	sta     _big+352
+	stx     _big+352+1
+;
+; big[177] = 0b1111111110110001;
+;
+	ina
+	sta     _big+354
+	stx     _big+354+1
+;
+; big[178] = 0b1111111110110010;
+;
+	ina
+	sta     _big+356
+	stx     _big+356+1
+;
+; big[179] = 0b1111111110110011;
+;
+	ina
+	sta     _big+358
+	stx     _big+358+1
+;
+; big[180] = 0b1111111110110100;
+;
+	ina
+	sta     _big+360
+	stx     _big+360+1
+;
+; big[181] = 0b1111111110110101;
+;
+	ina
+	sta     _big+362
+	stx     _big+362+1
+;
+; big[182] = 0b1111111110110110;
+;
+	ina
+	sta     _big+364
+	stx     _big+364+1
+;
+; big[183] = 0b1111111110110111;
+;
+	ina
+	sta     _big+366
+	stx     _big+366+1
+;
+; big[184] = 0b1111111110111000;
+;
+	ina
+	sta     _big+368
+	stx     _big+368+1
+;
+; big[185] = 0b1111111110111001;
+;
+	ina
+	sta     _big+370
+	stx     _big+370+1
+;
+; big[186] = 0b1111111110111010;
+;
+	ina
+	sta     _big+372
+	stx     _big+372+1
+;
+; big[187] = 0b1111111110111011;
+;
+	ina
+	sta     _big+374
+	stx     _big+374+1
+;
+; big[188] = 0b1111111110111100;
+;
+	ina
+	sta     _big+376
+	stx     _big+376+1
+;
+; big[189] = 0b1111111110111101;
+;
+	ina
+	sta     _big+378
+	stx     _big+378+1
+;
+; big[190] = 0b1111111110111110;
+;
+	ina
+	sta     _big+380
+	stx     _big+380+1
+;
+; big[191] = 0b1111111110111111;
+;
+	ina
+	sta     _big+382
+	stx     _big+382+1
+;
+; big[192] = 0b1111111111000000;
+;
+	ina
+	sta     _big+384
+	stx     _big+384+1
+;
+; big[193] = 0b1111111111000001;
+;
+	ina
+	sta     _big+386
+	stx     _big+386+1
+;
+; big[194] = 0b1111111111000010;
+;
+	ina
+	sta     _big+388
+	stx     _big+388+1
+;
+; big[195] = 0b1111111111000011;
+;
+	ina
+	sta     _big+390
+	stx     _big+390+1
+;
+; big[196] = 0b1111111111000100;
+;
+	ina
+	sta     _big+392
+	stx     _big+392+1
+;
+; big[197] = 0b1111111111000101;
+;
+	ina
+	sta     _big+394
+	stx     _big+394+1
+;
+; big[198] = 0b1111111111000110;
+;
+	ina
+	sta     _big+396
+	stx     _big+396+1
+;
+; big[199] = 0b1111111111000111;
+;
+	ina
+	sta     _big+398
+	stx     _big+398+1
+;
+; big[200] = 0b1111111111001000;
+;
+	ina
+	sta     _big+400
+	stx     _big+400+1
+;
+; big[201] = 0b1111111111001001;
+;
+	ina
+	sta     _big+402
+	stx     _big+402+1
+;
+; big[202] = 0b1111111111001010;
+;
+	ina
+	sta     _big+404
+	stx     _big+404+1
+;
+; big[203] = 0b1111111111001011;
+;
+	ina
+	sta     _big+406
+	stx     _big+406+1
+;
+; big[204] = 0b1111111111001100;
+;
+	ina
+	sta     _big+408
+	stx     _big+408+1
+;
+; big[205] = 0b1111111111001101;
+;
+	ina
+	sta     _big+410
+	stx     _big+410+1
+;
+; big[206] = 0b1111111111001110;
+;
+	ina
+	sta     _big+412
+	stx     _big+412+1
+;
+; big[207] = 0b1111111111001111;
+;
+	ina
+	sta     _big+414
+	stx     _big+414+1
+;
+; big[208] = 0b1111111111010000;
+;
+	ina
+	sta     _big+416
+	stx     _big+416+1
+;
+; big[209] = 0b1111111111010001;
+;
+	ina
+	sta     _big+418
+	stx     _big+418+1
+;
+; big[210] = 0b1111111111010010;
+;
+	ina
+	sta     _big+420
+	stx     _big+420+1
+;
+; big[211] = 0b1111111111010011;
+;
+	ina
+	sta     _big+422
+	stx     _big+422+1
+;
+; big[212] = 0b1111111111010100;
+;
+	ina
+	sta     _big+424
+	stx     _big+424+1
+;
+; big[213] = 0b1111111111010101;
+;
+	ina
+	sta     _big+426
+	stx     _big+426+1
+;
+; big[214] = 0b1111111111010110;
+;
+	ina
+	sta     _big+428
+	stx     _big+428+1
+;
+; big[215] = 0b1111111111010111;
+;
+	ina
+	sta     _big+430
+	stx     _big+430+1
+;
+; big[216] = 0b1111111111011000;
+;
+	ina
+	sta     _big+432
+	stx     _big+432+1
+;
+; big[217] = 0b1111111111011001;
+;
+	ina
+	sta     _big+434
+	stx     _big+434+1
+;
+; big[218] = 0b1111111111011010;
+;
+	ina
+	sta     _big+436
+	stx     _big+436+1
+;
+; big[219] = 0b1111111111011011;
+;
+	ina
+	sta     _big+438
+	stx     _big+438+1
+;
+; big[220] = 0b1111111111011100;
+;
+	ina
+	sta     _big+440
+	stx     _big+440+1
+;
+; big[221] = 0b1111111111011101;
+;
+	ina
+	sta     _big+442
+	stx     _big+442+1
+;
+; big[222] = 0b1111111111011110;
+;
+	ina
+	sta     _big+444
+	stx     _big+444+1
+;
+; big[223] = 0b1111111111011111;
+;
+	ina
+	sta     _big+446
+	stx     _big+446+1
+;
+; big[224] = 0b1111111111100000;
+;
+	ina
+	sta     _big+448
+	stx     _big+448+1
+;
+; big[225] = 0b1111111111100001;
+;
+	ina
+	sta     _big+450
+	stx     _big+450+1
+;
+; big[226] = 0b1111111111100010;
+;
+	ina
+	sta     _big+452
+	stx     _big+452+1
+;
+; big[227] = 0b1111111111100011;
+;
+	ina
+	sta     _big+454
+	stx     _big+454+1
+;
+; big[228] = 0b1111111111100100;
+;
+	ina
+	sta     _big+456
+	stx     _big+456+1
+;
+; big[229] = 0b1111111111100101;
+;
+	ina
+	sta     _big+458
+	stx     _big+458+1
+;
+; big[230] = 0b1111111111100110;
+;
+	ina
+	sta     _big+460
+	stx     _big+460+1
+;
+; big[231] = 0b1111111111100111;
+;
+	ina
+	sta     _big+462
+	stx     _big+462+1
+;
+; big[232] = 0b1111111111101000;
+;
+	ina
+	sta     _big+464
+	stx     _big+464+1
+;
+; big[233] = 0b1111111111101001;
+;
+	ina
+	sta     _big+466
+	stx     _big+466+1
+;
+; big[234] = 0b1111111111101010;
+;
+	ina
+	sta     _big+468
+	stx     _big+468+1
+;
+; big[235] = 0b1111111111101011;
+;
+	ina
+	sta     _big+470
+	stx     _big+470+1
+;
+; big[236] = 0b1111111111101100;
+;
+	ina
+	sta     _big+472
+	stx     _big+472+1
+;
+; big[237] = 0b1111111111101101;
+;
+	ina
+	sta     _big+474
+	stx     _big+474+1
+;
+; big[238] = 0b1111111111101110;
+;
+	ina
+	sta     _big+476
+	stx     _big+476+1
+;
+; big[239] = 0b1111111111101111;
+;
+	ina
+	sta     _big+478
+	stx     _big+478+1
+;
+; big[240] = 0b1111111111110000;
+;
+	ina
+	sta     _big+480
+	stx     _big+480+1
+;
+; big[241] = 0b1111111111110001;
+;
+	ina
+	sta     _big+482
+	stx     _big+482+1
+;
+; big[242] = 0b1111111111110010;
+;
+	ina
+	sta     _big+484
+	stx     _big+484+1
+;
+; big[243] = 0b1111111111110011;
+;
+	ina
+	sta     _big+486
+	stx     _big+486+1
+;
+; big[244] = 0b1111111111110100;
+;
+	ina
+	sta     _big+488
+	stx     _big+488+1
+;
+; big[245] = 0b1111111111110101;
+;
+	ina
+	sta     _big+490
+	stx     _big+490+1
+;
+; big[246] = 0b1111111111110110;
+;
+	ina
+	sta     _big+492
+	stx     _big+492+1
+;
+; big[247] = 0b1111111111110111;
+;
+	ina
+	sta     _big+494
+	stx     _big+494+1
+;
+; big[248] = 0b1111111111111000;
+;
+	ina
+	sta     _big+496
+	stx     _big+496+1
+;
+; big[249] = 0b1111111111111001;
+;
+	ina
+	sta     _big+498
+	stx     _big+498+1
+;
+; big[250] = 0b1111111111111010;
+;
+	ina
+	sta     _big+500
+	stx     _big+500+1
+;
+; big[251] = 0b1111111111111011;
+;
+	ina
+	sta     _big+502
+	stx     _big+502+1
+;
+; big[252] = 0b1111111111111100;
+;
+	ina
+	sta     _big+504
+	stx     _big+504+1
+;
+; big[253] = 0b1111111111111101;
+;
+	ina
+	sta     _big+506
+	stx     _big+506+1
+;
+; big[254] = 0b1111111111111110;
+;
+	ina
+	sta     _big+508
+	stx     _big+508+1
+;
+; big[255] = 0b1111111111111111;
+;
+	txa
+	sta     _big+510
+	sta     _big+510+1
+;
+; for (i = 0; i < 256; i++) {
+;
+	ina
+	sta     (c_sp)
+	ldy     #$01
+	sta     (c_sp),y
+L0007:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	cpx     #$01
+	bcs     L0008
+;
+; if (big[i] != i + 65280U)
+;
+	ldy     #$01
+	lda     (c_sp),y
+	sta     tmp1
+	lda     (c_sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_big)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_big)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	pha
+	txa
+	clc
+	adc     #$FF
+	tax
+	pla
+	jsr     tosicmp
+	beq     L0009
+;
+; return 1;
+;
+	ldx     #$00
+	lda     #$01
+	rts
+;
+; for (i = 0; i < 256; i++) {
+;
+L0009:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0007
+;
+; return 0;
+;
+L0008:	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,366 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_x
+	.export		_y
+	.export		_i
+	.export		_f1
+	.export		_f2
+	.export		_main
+
+.segment	"DATA"
+
+_x:
+	.word	$0001
+	.byte	$02
+	.byte	$03
+	.byte	$40
+	.byte	$01
+	.byte	$60
+	.res	1,$00
+_y:
+	.byte	$23
+	.byte	$09
+	.byte	$00
+_i:
+	.word	$0008
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$78,$20,$3D,$20,$25,$64,$20,$62,$3A,$25,$64,$20,$25,$64,$20,$25
+	.byte	$64,$20,$25,$64,$20,$63,$3A,$25,$64,$0A,$00
+S0003	:=	S0001+0
+S0006:
+	.byte	$70,$2D,$3E,$61,$20,$3D,$20,$30,$78,$25,$78,$2C,$20,$70,$2D,$3E
+	.byte	$62,$20,$3D,$20,$30,$78,$25,$78,$0A,$00
+S0002:
+	.byte	$79,$20,$3D,$20,$25,$64,$20,$62,$3A,$25,$64,$20,$63,$3A,$25,$64
+	.byte	$0A,$00
+S0004	:=	S0002+0
+S0005:
+	.byte	$70,$2D,$3E,$62,$20,$21,$3D,$20,$30,$21,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (struct baz *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+;
+; f1(struct baz *p) {
+;
+	jsr     pushax
+;
+; p->a = p->b = 0;
+;
+	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$C3
+	sta     (ptr1)
+	lsr     a
+	lsr     a
+	and     #$0F
+	and     #$03
+	jsr     pusha0
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$FC
+	jsr     tosora0
+	ldy     #$00
+	jsr     staspidx
+;
+; if (p->b)
+;
+	jsr     ldptr10sp
+	lda     (ptr1)
+	and     #$3C
+	beq     L0002
+;
+; printf("p->b != 0!\n");
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; p->a = 0x3; p->b = 0xf;
+;
+L0002:	jsr     ldptr10sp
+	lda     (ptr1)
+	ora     #$03
+	sta     (ptr1)
+	jsr     ldptr10sp
+	lda     (ptr1)
+	ora     #$3C
+	sta     (ptr1)
+;
+; printf("p->a = 0x%x, p->b = 0x%x\n", p->a, p->b);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$03
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	lsr     a
+	lsr     a
+	and     #$0F
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (struct baz *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+;
+; f2(struct baz *p) {
+;
+	jsr     pushax
+;
+; p->a = (i==0);
+;
+	jsr     pushw0sp
+	lda     _i
+	ldx     _i+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	and     #$03
+	jsr     pusha0
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$FC
+	jsr     tosora0
+	ldy     #$00
+	jsr     staspidx
+;
+; p->b = (f1(p),0);
+;
+	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f1
+	lda     #$00
+	asl     a
+	asl     a
+	jsr     push0
+	ldy     #$03
+	jsr     ldptr1ysp
+	lda     (ptr1)
+	and     #$C3
+	jsr     tosora0
+	ldy     #$00
+	jsr     staspidx
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; printf("x = %d b:%d %d %d %d c:%d\n", x.a, x.b, x.x, x.y, x.z, x.c);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _x
+	ldx     _x+1
+	jsr     pushax
+	lda     _x+2
+	jsr     pusha0
+	lda     _x+3+1
+	and     #$0F
+	tax
+	lda     _x+3
+	jsr     pushax
+	lda     _x+4
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	lda     _x+6
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	lda     _x+7
+	jsr     pusha0
+	ldy     #$0E
+	jsr     _printf
+;
+; printf("y = %d b:%d c:%d\n", y.a, y.b, y.c);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _y
+	and     #$03
+	jsr     pusha0
+	lda     _y
+	lsr     a
+	lsr     a
+	and     #$0F
+	jsr     pusha0
+	lda     _y+1
+	ldx     _y+1+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; x.y = i;
+;
+	lda     _i
+	and     #$0F
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	jsr     pusha0
+	lda     _x+4
+	and     #$0F
+	jsr     tosora0
+	sta     _x+4
+;
+; x.z = 070;
+;
+	lda     #$70
+	trb     _x+6
+;
+; printf("x = %d b:%d %d %d %d c:%d\n", x.a, x.b, x.x, x.y, x.z, x.c);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _x
+	ldx     _x+1
+	jsr     pushax
+	lda     _x+2
+	jsr     pusha0
+	lda     _x+3+1
+	and     #$0F
+	tax
+	lda     _x+3
+	jsr     pushax
+	lda     _x+4
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	lda     _x+6
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	lda     _x+7
+	jsr     pusha0
+	ldy     #$0E
+	jsr     _printf
+;
+; y.a = 2;
+;
+	lda     _y
+	and     #$FC
+	ora     #$02
+	sta     _y
+;
+; y.c = i;
+;
+	lda     _i+1
+	sta     _y+1+1
+	lda     _i
+	sta     _y+1
+;
+; printf("y = %d b:%d c:%d\n", y.a, y.b, y.c);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _y
+	and     #$03
+	jsr     pusha0
+	lda     _y
+	lsr     a
+	lsr     a
+	and     #$0F
+	jsr     pusha0
+	lda     _y+1
+	ldx     _y+1+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; f2((struct baz *)&x);
+;
+	lda     #<(_x)
+	ldx     #>(_x)
+	jsr     _f2
+;
+; return 0;
+;
+	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,461 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-1.c", 1798, 1779181050
+	.dbg		file, "common.h", 557, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_x
+	.export		_y
+	.export		_i
+	.export		_f1
+	.export		_f2
+	.export		_main
+
+.segment	"DATA"
+
+_x:
+	.word	$0001
+	.byte	$02
+	.byte	$03
+	.byte	$40
+	.byte	$01
+	.byte	$60
+	.res	1,$00
+_y:
+	.byte	$23
+	.byte	$09
+	.byte	$00
+_i:
+	.word	$0008
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$78,$20,$3D,$20,$25,$64,$20,$62,$3A,$25,$64,$20,$25,$64,$20,$25
+	.byte	$64,$20,$25,$64,$20,$63,$3A,$25,$64,$0A,$00
+S0003	:=	S0001+0
+S0006:
+	.byte	$70,$2D,$3E,$61,$20,$3D,$20,$30,$78,$25,$78,$2C,$20,$70,$2D,$3E
+	.byte	$62,$20,$3D,$20,$30,$78,$25,$78,$0A,$00
+S0002:
+	.byte	$79,$20,$3D,$20,$25,$64,$20,$62,$3A,$25,$64,$20,$63,$3A,$25,$64
+	.byte	$0A,$00
+S0004	:=	S0002+0
+S0005:
+	.byte	$70,$2D,$3E,$62,$20,$21,$3D,$20,$30,$21,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f1 (struct baz *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", static, "_f1"
+	.dbg	sym, "p", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; f1(struct baz *p) {
+;
+	.dbg	line, "bitfield-1.c", 82
+	jsr     pushax
+;
+; p->a = p->b = 0;
+;
+	.dbg	line, "bitfield-1.c", 83
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	and     #$C3
+	ldy     #$00
+	jsr     staspidx
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	ldx     #$00
+	and     #$03
+	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	and     #$FC
+	jsr     tosorax
+	ldy     #$00
+	jsr     staspidx
+;
+; if (p->b)
+;
+	.dbg	line, "bitfield-1.c", 84
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	and     #$3C
+	jeq     L0002
+;
+; printf("p->b != 0!\n");
+;
+	.dbg	line, "bitfield-1.c", 85
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+;
+; p->a = 0x3; p->b = 0xf;
+;
+	.dbg	line, "bitfield-1.c", 86
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	ora     #$03
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	ora     #$3C
+	ldy     #$00
+	jsr     staspidx
+;
+; printf("p->a = 0x%x, p->b = 0x%x\n", p->a, p->b);
+;
+	.dbg	line, "bitfield-1.c", 87
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldx     #$00
+	and     #$03
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+;
+; }
+;
+	.dbg	line, "bitfield-1.c", 88
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (struct baz *p)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", static, "_f2"
+	.dbg	sym, "p", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; f2(struct baz *p) {
+;
+	.dbg	line, "bitfield-1.c", 89
+	jsr     pushax
+;
+; p->a = (i==0);
+;
+	.dbg	line, "bitfield-1.c", 90
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _i
+	ldx     _i+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	ldx     #$00
+	and     #$03
+	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	and     #$FC
+	jsr     tosorax
+	ldy     #$00
+	jsr     staspidx
+;
+; p->b = (f1(p),0);
+;
+	.dbg	line, "bitfield-1.c", 91
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f1
+	ldx     #$00
+	lda     #$00
+	and     #$0F
+	ldx     #$00
+	asl     a
+	asl     a
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	and     #$C3
+	jsr     tosorax
+	ldy     #$00
+	jsr     staspidx
+;
+; }
+;
+	.dbg	line, "bitfield-1.c", 92
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; printf("x = %d b:%d %d %d %d c:%d\n", x.a, x.b, x.x, x.y, x.z, x.c);
+;
+	.dbg	line, "bitfield-1.c", 66
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _x
+	ldx     _x+1
+	jsr     pushax
+	ldx     #$00
+	lda     _x+2
+	jsr     pushax
+	lda     _x+3
+	ldx     _x+3+1
+	tay
+	txa
+	and     #$0F
+	tax
+	tya
+	jsr     pushax
+	lda     _x+4
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	lda     _x+6
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldx     #$00
+	lda     _x+7
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+;
+; printf("y = %d b:%d c:%d\n", y.a, y.b, y.c);
+;
+	.dbg	line, "bitfield-1.c", 67
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _y
+	ldx     #$00
+	and     #$03
+	jsr     pushax
+	lda     _y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _y+1
+	ldx     _y+1+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; x.y = i;
+;
+	.dbg	line, "bitfield-1.c", 68
+	ldx     #$00
+	lda     _i
+	and     #$0F
+	ldx     #$00
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	jsr     pushax
+	lda     _x+4
+	and     #$0F
+	jsr     tosorax
+	sta     _x+4
+;
+; x.z = 070;
+;
+	.dbg	line, "bitfield-1.c", 69
+	lda     _x+6
+	and     #$8F
+	sta     _x+6
+;
+; printf("x = %d b:%d %d %d %d c:%d\n", x.a, x.b, x.x, x.y, x.z, x.c);
+;
+	.dbg	line, "bitfield-1.c", 70
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _x
+	ldx     _x+1
+	jsr     pushax
+	ldx     #$00
+	lda     _x+2
+	jsr     pushax
+	lda     _x+3
+	ldx     _x+3+1
+	tay
+	txa
+	and     #$0F
+	tax
+	tya
+	jsr     pushax
+	lda     _x+4
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	lda     _x+6
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldx     #$00
+	lda     _x+7
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+;
+; y.a = 2;
+;
+	.dbg	line, "bitfield-1.c", 71
+	lda     _y
+	and     #$FC
+	ora     #$02
+	sta     _y
+;
+; y.c = i;
+;
+	.dbg	line, "bitfield-1.c", 72
+	lda     _i
+	ldx     _i+1
+	sta     _y+1
+	stx     _y+1+1
+;
+; printf("y = %d b:%d c:%d\n", y.a, y.b, y.c);
+;
+	.dbg	line, "bitfield-1.c", 73
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _y
+	ldx     #$00
+	and     #$03
+	jsr     pushax
+	lda     _y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _y+1
+	ldx     _y+1+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; f2((struct baz *)&x);
+;
+	.dbg	line, "bitfield-1.c", 75
+	lda     #<(_x)
+	ldx     #>(_x)
+	jsr     _f2
+;
+; return 0;
+;
+	.dbg	line, "bitfield-1.c", 79
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-1.c", 80
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,764 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_sc
+	.export		_uc
+	.export		_pc
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbs:
+	.byte	$01
+_fbp:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.byte	$02
+_o:
+	.byte	$7B
+_fw:
+	.byte	$FF
+_ae:
+	.byte	$FC
+	.byte	$88
+_sc:
+	.byte	$01
+_uc:
+	.byte	$01
+_pc:
+	.byte	$01
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74
+	.byte	$68,$5F,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$74,$77,$6F,$5F,$63,$68,$61,$72,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$73,$63,$2E,$78,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$75,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+.segment	"CODE"
+
+;
+; if (fb.x != 1) {
+;
+	lda     _fb
+	and     #$0F
+	cmp     #$01
+	beq     L0003
+;
+; printf ("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fb.x = 3;
+;
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	and     #$0F
+	cmp     #$03
+	beq     L0004
+;
+; printf ("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_char: near
+
+.segment	"CODE"
+
+;
+; if (fbi.x != 1) {
+;
+	lda     _fbi
+	and     #$0F
+	cmp     #$01
+	beq     L0007
+;
+; printf ("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _fbi
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+L0007:	lda     _fbi+1
+	cmp     #$02
+	beq     L0004
+;
+; printf ("Got fbi.y = %u, expected 2.\n", fbi.y);
+;
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _fbi+1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fbi.x = 3;
+;
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 17;
+;
+	lda     #$11
+	sta     _fbi+1
+;
+; if (fbi.x != 3) {
+;
+	lda     _fbi
+	and     #$0F
+	cmp     #$03
+	beq     L0008
+;
+; printf ("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _fbi
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fbi.y != 17) {
+;
+L0008:	lda     _fbi+1
+	cmp     #$11
+	beq     L0006
+;
+; printf ("Got fbi.y = %u, expected 17.\n", fbi.y);
+;
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _fbi+1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_two_chars (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_two_chars: near
+
+.segment	"CODE"
+
+;
+; if (o.x != 11) {
+;
+	lda     _o
+	and     #$0F
+	cmp     #$0B
+	beq     L0003
+;
+; printf ("Got o.x = %u, expected 11.\n", o.x);
+;
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _o
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (o.y != 7) {
+;
+L0003:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$07
+	beq     L0004
+;
+; printf ("Got o.y = %u, expected 7.\n", o.y);
+;
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; o.x = 3;
+;
+L0004:	lda     _o
+	and     #$F0
+	ora     #$03
+	sta     _o
+;
+; o.y = 4;
+;
+	and     #$0F
+	ora     #$40
+	sta     _o
+;
+; if (o.x != 3) {
+;
+	and     #$0F
+	cmp     #$03
+	beq     L0005
+;
+; printf ("Got o.x = %u, expected 3.\n", o.x);
+;
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _o
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (o.y != 4) {
+;
+L0005:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$04
+	beq     L0006
+;
+; printf ("Got o.y = %u, expected 4.\n", o.y);
+;
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+.segment	"CODE"
+
+;
+; if (fw.x != 255) {
+;
+	lda     _fw
+	cmp     #$FF
+	beq     L0005
+;
+; printf ("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _fw
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fw.x = 42;
+;
+L0005:	lda     #$2A
+	sta     _fw
+;
+; if (fw.x != 42) {
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+.segment	"CODE"
+
+;
+; if (ae.x != 63) {
+;
+	lda     _ae
+	lsr     a
+	lsr     a
+	cmp     #$3F
+	beq     L0003
+;
+; printf ("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+L0003:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$11
+	beq     L0004
+;
+; printf ("Got ae.y = %u, expected 17.\n", ae.y);
+;
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; ae.x = 42;
+;
+L0004:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 15;
+;
+	lda     _ae+1
+	and     #$07
+	ora     #$78
+	sta     _ae+1
+;
+; if (ae.x != 42) {
+;
+	lda     _ae
+	lsr     a
+	lsr     a
+	cmp     #$2A
+	beq     L0005
+;
+; printf ("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.y != 15) {
+;
+L0005:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$0F
+	beq     L0006
+;
+; printf ("Got ae.y = %u, expected 15.\n", ae.y);
+;
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signedness (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signedness: near
+
+.segment	"CODE"
+
+;
+; if (sc.x != -1) {
+;
+	lda     _sc
+	and     #$01
+	eor     #$01
+	sec
+	sbc     #$01
+	cmp     #$FF
+	beq     L0002
+;
+; printf ("Got sc.x = %d, expected -1.\n", sc.x);
+;
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _sc
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	sec
+	sbc     #$01
+	bcs     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (uc.x != 1) {
+;
+L0002:	lda     _uc
+	and     #$01
+	cmp     #$01
+	beq     L0005
+;
+; printf ("Got uc.x = %u, expected 1.\n", uc.x);
+;
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _uc
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pc.x != 1) {
+;
+L0005:	lda     _pc
+	and     #$01
+	cmp     #$01
+	beq     L0006
+;
+; printf ("Got pc.x = %u, expected 1.\n", pc.x);
+;
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _pc
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_four_bits ();
+;
+	jsr     _test_four_bits
+;
+; test_four_bits_with_char ();
+;
+	jsr     _test_four_bits_with_char
+;
+; test_two_chars ();
+;
+	jsr     _test_two_chars
+;
+; test_full_width ();
+;
+	jsr     _test_full_width
+;
+; test_aligned_end ();
+;
+	jsr     _test_aligned_end
+;
+; test_signedness ();
+;
+	jsr     _test_signedness
+;
+; printf ("failures: %u\n", failures);
+;
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
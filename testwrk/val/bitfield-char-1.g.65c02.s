@@ -0,0 +1,1124 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-char-1.c", 6356, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_sc
+	.export		_uc
+	.export		_pc
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbs:
+	.byte	$01
+_fbp:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.byte	$02
+_o:
+	.byte	$7B
+_fw:
+	.byte	$FF
+_ae:
+	.byte	$FC
+	.byte	$88
+_sc:
+	.byte	$01
+_uc:
+	.byte	$01
+_pc:
+	.byte	$01
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74
+	.byte	$68,$5F,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$74,$77,$6F,$5F,$63,$68,$61,$72,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$73,$63,$2E,$78,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$75,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct four_bits) != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 35
+	jmp     L0002
+;
+; printf ("Got sizeof (struct four_bits) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-char-1.c", 36
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; sizeof (struct four_bits));
+;
+	.dbg	line, "bitfield-char-1.c", 37
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fb.x != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 41
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	.dbg	line, "bitfield-char-1.c", 42
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fb.x = 3;
+;
+	.dbg	line, "bitfield-char-1.c", 46
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	.dbg	line, "bitfield-char-1.c", 48
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	.dbg	line, "bitfield-char-1.c", 49
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 50
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 52
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_char: near
+
+	.dbg	func, "test_four_bits_with_char", "00", static, "_test_four_bits_with_char"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct four_bits_with_char) != 2) {
+;
+	.dbg	line, "bitfield-char-1.c", 116
+	jmp     L0002
+;
+; printf ("Got sizeof (struct four_bits_with_char) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-char-1.c", 117
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+;
+; sizeof (struct four_bits_with_char));
+;
+	.dbg	line, "bitfield-char-1.c", 118
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.x != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 122
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	.dbg	line, "bitfield-char-1.c", 123
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 124
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+	.dbg	line, "bitfield-char-1.c", 127
+L0003:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$02
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got fbi.y = %u, expected 2.\n", fbi.y);
+;
+	.dbg	line, "bitfield-char-1.c", 128
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 129
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fbi.x = 3;
+;
+	.dbg	line, "bitfield-char-1.c", 132
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 17;
+;
+	.dbg	line, "bitfield-char-1.c", 133
+	ldx     #$00
+	lda     #$11
+	sta     _fbi+1
+;
+; if (fbi.x != 3) {
+;
+	.dbg	line, "bitfield-char-1.c", 135
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	.dbg	line, "bitfield-char-1.c", 136
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 137
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 17) {
+;
+	.dbg	line, "bitfield-char-1.c", 140
+L0005:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$11
+	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got fbi.y = %u, expected 17.\n", fbi.y);
+;
+	.dbg	line, "bitfield-char-1.c", 141
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 142
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 144
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_two_chars (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_two_chars: near
+
+	.dbg	func, "test_two_chars", "00", static, "_test_two_chars"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct two_chars) != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 154
+	jmp     L0002
+;
+; printf ("Got sizeof (struct two_chars) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-char-1.c", 155
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+;
+; sizeof (struct two_chars));
+;
+	.dbg	line, "bitfield-char-1.c", 156
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 157
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.x != 11) {
+;
+	.dbg	line, "bitfield-char-1.c", 160
+L0002:	lda     _o
+	ldx     #$00
+	and     #$0F
+	cmp     #$0B
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got o.x = %u, expected 11.\n", o.x);
+;
+	.dbg	line, "bitfield-char-1.c", 161
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 7) {
+;
+	.dbg	line, "bitfield-char-1.c", 165
+L0003:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$07
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got o.y = %u, expected 7.\n", o.y);
+;
+	.dbg	line, "bitfield-char-1.c", 166
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 167
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; o.x = 3;
+;
+	.dbg	line, "bitfield-char-1.c", 170
+L0004:	lda     _o
+	and     #$F0
+	ora     #$03
+	sta     _o
+;
+; o.y = 4;
+;
+	.dbg	line, "bitfield-char-1.c", 171
+	lda     _o
+	and     #$0F
+	ora     #$40
+	sta     _o
+;
+; if (o.x != 3) {
+;
+	.dbg	line, "bitfield-char-1.c", 173
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got o.x = %u, expected 3.\n", o.x);
+;
+	.dbg	line, "bitfield-char-1.c", 174
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 175
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 4) {
+;
+	.dbg	line, "bitfield-char-1.c", 178
+L0005:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$04
+	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got o.y = %u, expected 4.\n", o.y);
+;
+	.dbg	line, "bitfield-char-1.c", 179
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 180
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 182
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct full_width) != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 190
+	jmp     L0002
+;
+; printf ("Got sizeof (struct full_width) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-char-1.c", 191
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+;
+; sizeof (struct full_width));
+;
+	.dbg	line, "bitfield-char-1.c", 192
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 193
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.x != 255) {
+;
+	.dbg	line, "bitfield-char-1.c", 196
+L0002:	ldx     #$00
+	lda     _fw
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	.dbg	line, "bitfield-char-1.c", 197
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fw.x = 42;
+;
+	.dbg	line, "bitfield-char-1.c", 201
+L0003:	ldx     #$00
+	lda     #$2A
+	sta     _fw
+;
+; if (fw.x != 42) {
+;
+	.dbg	line, "bitfield-char-1.c", 203
+	ldx     #$00
+	lda     _fw
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got fw.x = %u, expected 42.\n", fw.x);
+;
+	.dbg	line, "bitfield-char-1.c", 204
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 205
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 207
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct aligned_end) != 2) {
+;
+	.dbg	line, "bitfield-char-1.c", 218
+	jmp     L0002
+;
+; printf ("Got sizeof (struct aligned_end) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-char-1.c", 219
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+;
+; sizeof (struct aligned_end));
+;
+	.dbg	line, "bitfield-char-1.c", 220
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 221
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.x != 63) {
+;
+	.dbg	line, "bitfield-char-1.c", 224
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	.dbg	line, "bitfield-char-1.c", 225
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 226
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+	.dbg	line, "bitfield-char-1.c", 229
+L0003:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$11
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got ae.y = %u, expected 17.\n", ae.y);
+;
+	.dbg	line, "bitfield-char-1.c", 230
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 231
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ae.x = 42;
+;
+	.dbg	line, "bitfield-char-1.c", 234
+L0004:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 15;
+;
+	.dbg	line, "bitfield-char-1.c", 235
+	lda     _ae+1
+	and     #$07
+	ora     #$78
+	sta     _ae+1
+;
+; if (ae.x != 42) {
+;
+	.dbg	line, "bitfield-char-1.c", 237
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	.dbg	line, "bitfield-char-1.c", 238
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 239
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 15) {
+;
+	.dbg	line, "bitfield-char-1.c", 242
+L0005:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got ae.y = %u, expected 15.\n", ae.y);
+;
+	.dbg	line, "bitfield-char-1.c", 243
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 244
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 246
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signedness (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signedness: near
+
+	.dbg	func, "test_signedness", "00", static, "_test_signedness"
+
+.segment	"CODE"
+
+;
+; if (sc.x != -1) {
+;
+	.dbg	line, "bitfield-char-1.c", 254
+	lda     _sc
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got sc.x = %d, expected -1.\n", sc.x);
+;
+	.dbg	line, "bitfield-char-1.c", 255
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _sc
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 256
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (uc.x != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 259
+L0002:	lda     _uc
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got uc.x = %u, expected 1.\n", uc.x);
+;
+	.dbg	line, "bitfield-char-1.c", 260
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _uc
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 261
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pc.x != 1) {
+;
+	.dbg	line, "bitfield-char-1.c", 264
+L0003:	lda     _pc
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got pc.x = %u, expected 1.\n", pc.x);
+;
+	.dbg	line, "bitfield-char-1.c", 265
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-char-1.c", 266
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 268
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_four_bits ();
+;
+	.dbg	line, "bitfield-char-1.c", 272
+	jsr     _test_four_bits
+;
+; test_four_bits_with_char ();
+;
+	.dbg	line, "bitfield-char-1.c", 273
+	jsr     _test_four_bits_with_char
+;
+; test_two_chars ();
+;
+	.dbg	line, "bitfield-char-1.c", 274
+	jsr     _test_two_chars
+;
+; test_full_width ();
+;
+	.dbg	line, "bitfield-char-1.c", 275
+	jsr     _test_full_width
+;
+; test_aligned_end ();
+;
+	.dbg	line, "bitfield-char-1.c", 276
+	jsr     _test_aligned_end
+;
+; test_signedness ();
+;
+	.dbg	line, "bitfield-char-1.c", 277
+	jsr     _test_signedness
+;
+; printf ("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-char-1.c", 278
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-char-1.c", 279
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-char-1.c", 280
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,2593 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-enum.c", 11935, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/limits.h", 3735, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_e10ubf:
+	.byte	$90
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e11ibf:
+	.byte	$93
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e7ucbf:
+	.byte	$14
+	.byte	$64
+_e8scbf:
+	.byte	$0A
+	.byte	$64
+_e20ulbf:
+	.byte	$8A
+	.byte	$3E
+	.byte	$00
+	.byte	$00
+	.byte	$CA
+	.byte	$9A
+	.byte	$3B
+_e20slbf:
+	.byte	$A3
+	.byte	$0F
+	.byte	$00
+	.byte	$00
+	.byte	$CA
+	.byte	$9A
+	.byte	$3B
+
+.segment	"RODATA"
+
+S0012:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$76,$20,$28,$3D,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$2D
+	.byte	$20,$31,$30,$32,$34,$29,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E
+	.byte	$0A,$00
+S0034:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$7A,$20,$2D,$20,$31,$30,$34
+	.byte	$38,$35,$37,$36,$4C,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E,$0A
+	.byte	$00
+S0028:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$79,$20,$2D,$20,$36,$35,$35
+	.byte	$33,$36,$4C,$20,$3D,$20,$25,$6C,$75,$2C,$20,$65,$78,$70,$65,$63
+	.byte	$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$76,$20,$28,$3D,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$2D
+	.byte	$20,$32,$29,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63
+	.byte	$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$76,$20,$28,$3D,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$2D
+	.byte	$20,$32,$29,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63
+	.byte	$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$20,$76,$20,$28
+	.byte	$3D,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$2D,$20,$31,$30,$32
+	.byte	$34,$29,$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74
+	.byte	$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65,$2E,$0A,$00
+S002A:
+	.byte	$47,$6F,$74,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$20,$65,$32,$30
+	.byte	$75,$6C,$62,$66,$2E,$7A,$20,$2D,$20,$31,$30,$34,$38,$35,$37,$36
+	.byte	$20,$3D,$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$70,$6F,$73,$69,$74,$69,$76,$65,$2E,$0A,$00
+S0032:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$79,$20,$2D,$20,$32,$35,$38
+	.byte	$20,$3D,$20,$25,$6C,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$6E,$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0021:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$6C,$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0026:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$78,$20,$2D,$20,$39,$20,$3D
+	.byte	$20,$25,$6C,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6E
+	.byte	$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0030:
+	.byte	$47,$6F,$74,$20,$6E,$6F,$6E,$2D,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$78,$20,$2D,$20,$32,$20,$3D
+	.byte	$20,$25,$6C,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6E
+	.byte	$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S002B:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$6C,$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$38,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S002E:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$7A,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$2E,$0A,$00
+S0024:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$7A,$20,$3D,$20
+	.byte	$25,$75,$6C,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30
+	.byte	$30,$30,$30,$30,$30,$30,$30,$30,$2E,$0A,$00
+S0033:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$7A,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30
+	.byte	$34,$38,$35,$37,$35,$2E,$0A,$00
+S0029:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$7A,$20,$3D,$20
+	.byte	$25,$6C,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30
+	.byte	$34,$38,$35,$37,$35,$2E,$0A,$00
+S0027:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$79,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$36,$35
+	.byte	$35,$33,$35,$2E,$0A,$00
+S002D:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$79,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30
+	.byte	$30,$30,$2E,$0A,$00
+S0023:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$79,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30
+	.byte	$30,$2E,$0A,$00
+S0031:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$79,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35
+	.byte	$37,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S002C:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$78,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31
+	.byte	$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0020:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0022:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$78,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E
+	.byte	$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$2E
+	.byte	$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0025:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$75,$6C,$62,$66,$2E,$78,$20,$3D,$20
+	.byte	$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$38,$2E
+	.byte	$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A
+	.byte	$00
+S000B:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S001F:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A
+	.byte	$00
+S0007:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001E:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S002F:
+	.byte	$47,$6F,$74,$20,$65,$32,$30,$73,$6C,$62,$66,$2E,$78,$20,$3D,$20
+	.byte	$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0015:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E,$0A
+	.byte	$00
+S0010:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001C:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$35,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0035:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uint: near
+
+	.dbg	func, "test_enum_bitfield_uint", "00", static, "_test_enum_bitfield_uint"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_uint) != 4) {
+;
+	.dbg	line, "bitfield-enum.c", 44
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_uint) = %zu, expected 4.\n",
+;
+	.dbg	line, "bitfield-enum.c", 45
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_uint));
+;
+	.dbg	line, "bitfield-enum.c", 46
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 47
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e10ubf.x != 0) {
+;
+	.dbg	line, "bitfield-enum.c", 50
+L0002:	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	cmp     #$00
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e10ubf.x = %u, expected 0.\n", e10ubf.x);
+;
+	.dbg	line, "bitfield-enum.c", 51
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e10ubf.y != 200) {
+;
+	.dbg	line, "bitfield-enum.c", 54
+L0003:	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	cmp     #$C8
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e10ubf.y = %u, expected 200.\n", e10ubf.y);
+;
+	.dbg	line, "bitfield-enum.c", 55
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 56
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e10ubf.z != 1000) {
+;
+	.dbg	line, "bitfield-enum.c", 58
+L0004:	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	cpx     #$03
+	bne     L0006
+	cmp     #$E8
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got e10ubf.z = %u, expected 1000.\n", e10ubf.z);
+;
+	.dbg	line, "bitfield-enum.c", 59
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e10ubf.x = 1;
+;
+	.dbg	line, "bitfield-enum.c", 63
+L0005:	lda     _e10ubf
+	ora     #$01
+	sta     _e10ubf
+;
+; e10ubf.y = 17;
+;
+	.dbg	line, "bitfield-enum.c", 64
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	tay
+	txa
+	and     #$FE
+	tax
+	tya
+	and     #$01
+	ora     #$22
+	sta     _e10ubf
+	stx     _e10ubf+1
+;
+; e10ubf.z = 1023;
+;
+	.dbg	line, "bitfield-enum.c", 65
+	ldx     #$03
+	lda     #$FF
+	sta     _e10ubf+2
+	stx     _e10ubf+2+1
+;
+; if (e10ubf.x != 1) {
+;
+	.dbg	line, "bitfield-enum.c", 67
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0007
+;
+; printf ("Got e10ubf.x = %u, expected 1.\n", e10ubf.x);
+;
+	.dbg	line, "bitfield-enum.c", 68
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 69
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; long v = e10ubf.x - 2;
+;
+	.dbg	line, "bitfield-enum.c", 74
+L0007:	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     decax2
+	jsr     axlong
+	jsr     pusheax
+;
+; if (v >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 75
+	ldy     #$03
+	jsr     ldeaxysp
+	lda     sreg+1
+	jsr     boolge
+	jeq     L0008
+;
+; printf ("Got non-negative v (= e10ubf.x - 2) = %ld, expected negative.\n", v);
+;
+	.dbg	line, "bitfield-enum.c", 76
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 77
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 79
+L0008:	jsr     incsp4
+;
+; if (e10ubf.y != 17) {
+;
+	.dbg	line, "bitfield-enum.c", 81
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	cmp     #$11
+	jsr     boolne
+	jeq     L0009
+;
+; printf ("Got e10ubf.y = %u, expected 17.\n", e10ubf.y);
+;
+	.dbg	line, "bitfield-enum.c", 82
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 83
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e10ubf.z != 1023) {
+;
+	.dbg	line, "bitfield-enum.c", 85
+L0009:	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	cpx     #$03
+	bne     L000B
+	cmp     #$FF
+L000B:	jsr     boolne
+	jeq     L000A
+;
+; printf ("Got e10ubf.z = %u, expected 1023.\n", e10ubf.z);
+;
+	.dbg	line, "bitfield-enum.c", 86
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 87
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; long v = e10ubf.z - 1024;
+;
+	.dbg	line, "bitfield-enum.c", 92
+L000A:	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldx     #$04
+	lda     #$00
+	jsr     tossubax
+	jsr     axulong
+	jsr     pusheax
+;
+; if (v < 0) {
+;
+	.dbg	line, "bitfield-enum.c", 93
+	ldy     #$03
+	jsr     ldeaxysp
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+;
+; printf ("Got negative v (= e10ubf.z - 1024) = %ld, expected positive.\n", v);
+;
+	.dbg	line, "bitfield-enum.c", 94
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 95
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 97
+L000C:	jsr     incsp4
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 98
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_int: near
+
+	.dbg	func, "test_enum_bitfield_int", "00", static, "_test_enum_bitfield_int"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_int) != 4) {
+;
+	.dbg	line, "bitfield-enum.c", 115
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_int) = %zu, expected 4.\n",
+;
+	.dbg	line, "bitfield-enum.c", 116
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_int));
+;
+	.dbg	line, "bitfield-enum.c", 117
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e11ibf.x != -1) {
+;
+	.dbg	line, "bitfield-enum.c", 121
+L0002:	lda     _e11ibf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e11ibf.x = %d, expected -1.\n", e11ibf.x);
+;
+	.dbg	line, "bitfield-enum.c", 122
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e11ibf.y != 100) {
+;
+	.dbg	line, "bitfield-enum.c", 125
+L0003:	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	ldx     #$00
+	eor     #$80
+	ldy     #$80
+	jsr     decaxy
+	cmp     #$64
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e11ibf.y = %d, expected 100.\n", e11ibf.y);
+;
+	.dbg	line, "bitfield-enum.c", 126
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	ldx     #$00
+	eor     #$80
+	ldy     #$80
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 127
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e11ibf.z != 1000) {
+;
+	.dbg	line, "bitfield-enum.c", 129
+L0004:	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	cpx     #$03
+	bne     L0006
+	cmp     #$E8
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got e11ibf.z = %d, expected 1000.\n", e11ibf.z);
+;
+	.dbg	line, "bitfield-enum.c", 130
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e11ibf.x = 1;
+;
+	.dbg	line, "bitfield-enum.c", 134
+L0005:	lda     _e11ibf
+	and     #$FC
+	ora     #$01
+	sta     _e11ibf
+;
+; e11ibf.y = 17;
+;
+	.dbg	line, "bitfield-enum.c", 135
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	tay
+	txa
+	and     #$FC
+	tax
+	tya
+	and     #$03
+	ora     #$44
+	sta     _e11ibf
+	stx     _e11ibf+1
+;
+; e11ibf.z = 1023;
+;
+	.dbg	line, "bitfield-enum.c", 136
+	ldx     #$03
+	lda     #$FF
+	sta     _e11ibf+2
+	stx     _e11ibf+2+1
+;
+; if (e11ibf.x != 1) {
+;
+	.dbg	line, "bitfield-enum.c", 138
+	lda     _e11ibf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	cmp     #$01
+	jsr     boolne
+	jeq     L0007
+;
+; printf ("Got e11ibf.x = %d, expected 1.\n", e11ibf.x);
+;
+	.dbg	line, "bitfield-enum.c", 139
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 140
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; long v = e11ibf.x - 2;
+;
+	.dbg	line, "bitfield-enum.c", 145
+L0007:	lda     _e11ibf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     decax2
+	jsr     axlong
+	jsr     pusheax
+;
+; if (v >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 146
+	ldy     #$03
+	jsr     ldeaxysp
+	lda     sreg+1
+	jsr     boolge
+	jeq     L0008
+;
+; printf ("Got non-negative v (= e11ibf.x - 2) = %ld, expected negative.\n", v);
+;
+	.dbg	line, "bitfield-enum.c", 147
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 148
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 150
+L0008:	jsr     incsp4
+;
+; if (e11ibf.y != 17) {
+;
+	.dbg	line, "bitfield-enum.c", 152
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	ldx     #$00
+	eor     #$80
+	ldy     #$80
+	jsr     decaxy
+	cmp     #$11
+	jsr     boolne
+	jeq     L0009
+;
+; printf ("Got e11ibf.y = %d, expected 17.\n", e11ibf.y);
+;
+	.dbg	line, "bitfield-enum.c", 153
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	ldx     #$00
+	eor     #$80
+	ldy     #$80
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 154
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e11ibf.z != 1023) {
+;
+	.dbg	line, "bitfield-enum.c", 156
+L0009:	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	cpx     #$03
+	bne     L000B
+	cmp     #$FF
+L000B:	jsr     boolne
+	jeq     L000A
+;
+; printf ("Got e11ibf.z = %d, expected 1023.\n", e11ibf.z);
+;
+	.dbg	line, "bitfield-enum.c", 157
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 158
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; long v = e11ibf.z - 1024;
+;
+	.dbg	line, "bitfield-enum.c", 163
+L000A:	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldx     #$04
+	lda     #$00
+	jsr     tossubax
+	jsr     axlong
+	jsr     pusheax
+;
+; if (v >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 164
+	ldy     #$03
+	jsr     ldeaxysp
+	lda     sreg+1
+	jsr     boolge
+	jeq     L000C
+;
+; printf ("Got non-negative v (= e11ibf.z - 1024) = %ld, expected negative.\n", v);
+;
+	.dbg	line, "bitfield-enum.c", 165
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 166
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 168
+L000C:	jsr     incsp4
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 169
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uchar: near
+
+	.dbg	func, "test_enum_bitfield_uchar", "00", static, "_test_enum_bitfield_uchar"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_uchar) != 2) {
+;
+	.dbg	line, "bitfield-enum.c", 184
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_uchar) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-enum.c", 185
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_uchar));
+;
+	.dbg	line, "bitfield-enum.c", 186
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 187
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e7ucbf.x != 0) {
+;
+	.dbg	line, "bitfield-enum.c", 190
+L0002:	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	cmp     #$00
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e7ucbf.x = %u, expected 0.\n", e7ucbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 191
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 192
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e7ucbf.y != 10) {
+;
+	.dbg	line, "bitfield-enum.c", 194
+L0003:	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e7ucbf.y = %u, expected 10.\n", e7ucbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 195
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 196
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e7ucbf.z != 100) {
+;
+	.dbg	line, "bitfield-enum.c", 198
+L0004:	ldx     #$00
+	lda     _e7ucbf+1
+	cmp     #$64
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got e7ucbf.z = %u, expected 100.\n", e7ucbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 199
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _e7ucbf+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 200
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e7ucbf.x = -1;  /* Will store 1. */
+;
+	.dbg	line, "bitfield-enum.c", 203
+L0005:	lda     _e7ucbf
+	ora     #$01
+	sta     _e7ucbf
+;
+; e7ucbf.y = -1;  /* Will store 15. */
+;
+	.dbg	line, "bitfield-enum.c", 204
+	lda     _e7ucbf
+	ora     #$1E
+	sta     _e7ucbf
+;
+; e7ucbf.z = 127;
+;
+	.dbg	line, "bitfield-enum.c", 205
+	ldx     #$00
+	lda     #$7F
+	sta     _e7ucbf+1
+;
+; if (e7ucbf.x != 1) {
+;
+	.dbg	line, "bitfield-enum.c", 210
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got e7ucbf.x = %u, expected 1.\n", e7ucbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 211
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 212
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e7ucbf.y != 15) {
+;
+	.dbg	line, "bitfield-enum.c", 215
+L0006:	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0007
+;
+; printf ("Got e7ucbf.y = %u, expected 15.\n", e7ucbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 216
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 217
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e7ucbf.z != 127) {
+;
+	.dbg	line, "bitfield-enum.c", 219
+L0007:	ldx     #$00
+	lda     _e7ucbf+1
+	cmp     #$7F
+	jsr     boolne
+	jeq     L0008
+;
+; printf ("Got e7ucbf.z = %u, expected 127.\n", e7ucbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 220
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     _e7ucbf+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 221
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 223
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_char: near
+
+	.dbg	func, "test_enum_bitfield_char", "00", static, "_test_enum_bitfield_char"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_char) != 2) {
+;
+	.dbg	line, "bitfield-enum.c", 239
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_char) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-enum.c", 240
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_char));
+;
+	.dbg	line, "bitfield-enum.c", 241
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 242
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e8scbf.x != 0) {
+;
+	.dbg	line, "bitfield-enum.c", 245
+L0002:	lda     _e8scbf
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	cmp     #$00
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e8scbf.x = %d, expected 0.\n", e8scbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 246
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _e8scbf
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 247
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e8scbf.y != 5) {
+;
+	.dbg	line, "bitfield-enum.c", 249
+L0003:	lda     _e8scbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$05
+	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e8scbf.y = %d, expected 5.\n", e8scbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 250
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 251
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e8scbf.z != 100) {
+;
+	.dbg	line, "bitfield-enum.c", 253
+L0004:	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L0006
+	dex
+L0006:	cmp     #$64
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got e8scbf.z = %d, expected 100.\n", e8scbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 254
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 255
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e8scbf.x = -1;
+;
+	.dbg	line, "bitfield-enum.c", 258
+L0005:	lda     _e8scbf
+	ora     #$01
+	sta     _e8scbf
+;
+; e8scbf.y = -3;
+;
+	.dbg	line, "bitfield-enum.c", 259
+	lda     _e8scbf
+	and     #$E1
+	ora     #$1A
+	sta     _e8scbf
+;
+; e8scbf.z = 127;
+;
+	.dbg	line, "bitfield-enum.c", 260
+	ldx     #$00
+	lda     #$7F
+	sta     _e8scbf+1
+;
+; if (e8scbf.x != -1) {
+;
+	.dbg	line, "bitfield-enum.c", 262
+	lda     _e8scbf
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0008
+;
+; printf ("Got e8scbf.x = %d, expected -1.\n", e8scbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 263
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _e8scbf
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	jsr     decax1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 264
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e8scbf.y != -3) {
+;
+	.dbg	line, "bitfield-enum.c", 266
+L0008:	lda     _e8scbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$FD
+	jsr     boolne
+	jeq     L0009
+;
+; printf ("Got e8scbf.y = %d, expected -3.\n", e8scbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 267
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 268
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e8scbf.z != 127) {
+;
+	.dbg	line, "bitfield-enum.c", 270
+L0009:	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L000B
+	dex
+L000B:	cmp     #$7F
+	jsr     boolne
+	jeq     L000A
+;
+; printf ("Got e8scbf.z = %d, expected 127.\n", e8scbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 271
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 272
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 274
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_ulong: near
+
+	.dbg	func, "test_enum_bitfield_ulong", "00", static, "_test_enum_bitfield_ulong"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_ulong) != 7) {
+;
+	.dbg	line, "bitfield-enum.c", 291
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_ulong) = %zu, expected 7.\n",
+;
+	.dbg	line, "bitfield-enum.c", 292
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_ulong));
+;
+	.dbg	line, "bitfield-enum.c", 293
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 294
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.x != 10) {
+;
+	.dbg	line, "bitfield-enum.c", 297
+L0002:	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e20ulbf.x = %u, expected 10.\n", e20ulbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 298
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 299
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.y != 1000) {
+;
+	.dbg	line, "bitfield-enum.c", 301
+L0003:	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     shreax4
+	cpx     #$03
+	bne     L0005
+	cmp     #$E8
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e20ulbf.y = %u, expected 1000.\n", e20ulbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 302
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _e20ulbf
+	ldx     _e20ulbf+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 303
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.z != 1000000000L) {
+;
+	.dbg	line, "bitfield-enum.c", 305
+L0004:	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	lda     #$3B
+	sta     sreg+1
+	lda     #$9A
+	sta     sreg
+	lda     #$00
+	ldx     #$CA
+	jsr     tosneeax
+	jeq     L0006
+;
+; printf ("Got e20ulbf.z = %ul, expected 1000000000.\n", e20ulbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 306
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 307
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e20ulbf.x = 8;
+;
+	.dbg	line, "bitfield-enum.c", 310
+L0006:	lda     _e20ulbf
+	and     #$F0
+	ora     #$08
+	sta     _e20ulbf
+;
+; e20ulbf.y = -1;  /* Will store 65535. */
+;
+	.dbg	line, "bitfield-enum.c", 311
+	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$0F
+	sta     sreg
+	lda     #$F0
+	ldx     #$FF
+	jsr     tosoreax
+	sta     _e20ulbf
+	stx     _e20ulbf+1
+	ldy     sreg
+	sty     _e20ulbf+2
+	ldy     sreg+1
+	sty     _e20ulbf+3
+;
+; e20ulbf.z = 1048575L;
+;
+	.dbg	line, "bitfield-enum.c", 312
+	lda     #$00
+	sta     sreg+1
+	lda     #$0F
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	sta     _e20ulbf+3
+	stx     _e20ulbf+3+1
+	ldy     sreg
+	sty     _e20ulbf+3+2
+	ldy     sreg+1
+	sty     _e20ulbf+3+3
+;
+; if (e20ulbf.x != 8) {
+;
+	.dbg	line, "bitfield-enum.c", 314
+	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	cmp     #$08
+	jsr     boolne
+	jeq     L0007
+;
+; printf ("Got e20ulbf.x = %ld, expected 8.\n", (long)e20ulbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 315
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 316
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.x - 9 >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 321
+L0007:	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	ldy     #$09
+	jsr     decaxy
+	txa
+	jsr     boolge
+	jeq     L0008
+;
+; printf ("Got non-negative e20ulbf.x - 9 = %lu, expected negative.\n", (unsigned long)(e20ulbf.x - 9));
+;
+	.dbg	line, "bitfield-enum.c", 322
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     _e20ulbf
+	ldx     #$00
+	and     #$0F
+	ldy     #$09
+	jsr     decaxy
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 323
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.y != 65535L) {
+;
+	.dbg	line, "bitfield-enum.c", 327
+L0008:	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     shreax4
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L0009
+;
+; printf ("Got e20ulbf.y = %ld, expected 65535.\n", (long)e20ulbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 328
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     shreax4
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 329
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.y - 65536L >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 334
+L0009:	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     shreax4
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	lda     sreg+1
+	jsr     boolge
+	jeq     L000A
+;
+; printf ("Got non-negative e20ulbf.y - 65536L = %lu, expected negative.\n", (unsigned long)(e20ulbf.y - 65536L));
+;
+	.dbg	line, "bitfield-enum.c", 335
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     _e20ulbf+3
+	sta     sreg+1
+	lda     _e20ulbf+2
+	sta     sreg
+	ldx     _e20ulbf+1
+	lda     _e20ulbf
+	jsr     shreax4
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 336
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.z != 1048575L) {
+;
+	.dbg	line, "bitfield-enum.c", 340
+L000A:	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$0F
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L000B
+;
+; printf ("Got e20ulbf.z = %lu, expected 1048575.\n", (unsigned long)e20ulbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 341
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 342
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20ulbf.z - 1048576L < 0) {
+;
+	.dbg	line, "bitfield-enum.c", 347
+L000B:	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     return0
+	jeq     L000C
+;
+; printf ("Got negative e20ulbf.z - 1048576 = %ld, expected positive.\n", (long)(e20ulbf.z - 1048576L));
+;
+	.dbg	line, "bitfield-enum.c", 348
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	lda     _e20ulbf+3+3
+	sta     sreg+1
+	lda     _e20ulbf+3+2
+	sta     sreg
+	ldx     _e20ulbf+3+1
+	lda     _e20ulbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 349
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 352
+L000C:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_long: near
+
+	.dbg	func, "test_enum_bitfield_long", "00", static, "_test_enum_bitfield_long"
+
+.segment	"CODE"
+
+;
+; if (sizeof (struct enum_bitfield_long) != 7) {
+;
+	.dbg	line, "bitfield-enum.c", 369
+	jmp     L0002
+;
+; printf ("Got sizeof(struct enum_bitfield_long) = %zu, expected 8.\n",
+;
+	.dbg	line, "bitfield-enum.c", 370
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+;
+; sizeof(struct enum_bitfield_long));
+;
+	.dbg	line, "bitfield-enum.c", 371
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 372
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.x != -1) {
+;
+	.dbg	line, "bitfield-enum.c", 375
+L0002:	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got e20slbf.x = %ld, expected -1.\n", (long)e20slbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 376
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 377
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.y != 1000) {
+;
+	.dbg	line, "bitfield-enum.c", 379
+L0003:	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	cpx     #$03
+	bne     L0005
+	cmp     #$E8
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf ("Got e20slbf.y = %ld, expected 1000.\n", (long)e20slbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 380
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 381
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.z != 1000000000L) {
+;
+	.dbg	line, "bitfield-enum.c", 383
+L0004:	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	lda     #$3B
+	sta     sreg+1
+	lda     #$9A
+	sta     sreg
+	lda     #$00
+	ldx     #$CA
+	jsr     tosneeax
+	jeq     L0006
+;
+; printf ("Got e20slbf.z = %ld, expected 1000000000.\n", (long)e20slbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 384
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 385
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; e20slbf.x = 1;
+;
+	.dbg	line, "bitfield-enum.c", 388
+L0006:	lda     _e20slbf
+	and     #$FC
+	ora     #$01
+	sta     _e20slbf
+;
+; e20slbf.y = 257;
+;
+	.dbg	line, "bitfield-enum.c", 389
+	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FC
+	sta     sreg
+	lda     #$03
+	ldx     #$00
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$04
+	ldx     #$04
+	jsr     tosoreax
+	sta     _e20slbf
+	stx     _e20slbf+1
+	ldy     sreg
+	sty     _e20slbf+2
+	ldy     sreg+1
+	sty     _e20slbf+3
+;
+; e20slbf.z = 1048575L;
+;
+	.dbg	line, "bitfield-enum.c", 390
+	lda     #$00
+	sta     sreg+1
+	lda     #$0F
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	sta     _e20slbf+3
+	stx     _e20slbf+3+1
+	ldy     sreg
+	sty     _e20slbf+3+2
+	ldy     sreg+1
+	sty     _e20slbf+3+3
+;
+; if (e20slbf.x != 1) {
+;
+	.dbg	line, "bitfield-enum.c", 392
+	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	cmp     #$01
+	jsr     boolne
+	jeq     L0007
+;
+; printf ("Got e20slbf.x = %d, expected 1.\n", e20slbf.x);
+;
+	.dbg	line, "bitfield-enum.c", 393
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 394
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.x - 2 >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 399
+L0007:	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     decax2
+	txa
+	jsr     boolge
+	jeq     L0008
+;
+; printf ("Got non-negative e20slbf.x - 2 = %lu, expected negative.\n", (unsigned long)(e20slbf.x - 2));
+;
+	.dbg	line, "bitfield-enum.c", 400
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     _e20slbf
+	ldx     #$00
+	and     #$03
+	eor     #$02
+	jsr     decax2
+	jsr     decax2
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 401
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.y != 257) {
+;
+	.dbg	line, "bitfield-enum.c", 405
+L0008:	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	cpx     #$01
+	bne     L000A
+	cmp     #$01
+L000A:	jsr     boolne
+	jeq     L0009
+;
+; printf ("Got e20slbf.y = %ld, expected 257.\n", (long)e20slbf.y);
+;
+	.dbg	line, "bitfield-enum.c", 406
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 407
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.y - 258 >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 412
+L0009:	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	jsr     pushax
+	ldx     #$01
+	lda     #$02
+	jsr     tossubax
+	txa
+	jsr     boolge
+	jeq     L000B
+;
+; printf ("Got non-negative e20slbf.y - 258 = %lu, expected negative.\n", (unsigned long)(e20slbf.y - 258));
+;
+	.dbg	line, "bitfield-enum.c", 413
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     _e20slbf+3
+	sta     sreg+1
+	lda     _e20slbf+2
+	sta     sreg
+	ldx     _e20slbf+1
+	lda     _e20slbf
+	jsr     shreax2
+	tay
+	txa
+	and     #$FF
+	eor     #$80
+	sec
+	sbc     #$80
+	tax
+	tya
+	jsr     pushax
+	ldx     #$01
+	lda     #$02
+	jsr     tossubax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 414
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.z != 1048575L) {
+;
+	.dbg	line, "bitfield-enum.c", 418
+L000B:	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$0F
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L000C
+;
+; printf ("Got e20slbf.z = %ld, expected 1048575.\n", (long)e20slbf.z);
+;
+	.dbg	line, "bitfield-enum.c", 419
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 420
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (e20slbf.z - 1048576L >= 0) {
+;
+	.dbg	line, "bitfield-enum.c", 425
+L000C:	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	lda     sreg+1
+	jsr     boolge
+	jeq     L000D
+;
+; printf ("Got non-negative e20slbf.z - 1048576L = %ld, expected negative.\n", (long)(e20slbf.z - 1048576L));
+;
+	.dbg	line, "bitfield-enum.c", 426
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     _e20slbf+3+3
+	sta     sreg+1
+	lda     _e20slbf+3+2
+	sta     sreg
+	ldx     _e20slbf+3+1
+	lda     _e20slbf+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-enum.c", 427
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 430
+L000D:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_enum_bitfield_uint();
+;
+	.dbg	line, "bitfield-enum.c", 434
+	jsr     _test_enum_bitfield_uint
+;
+; test_enum_bitfield_int();
+;
+	.dbg	line, "bitfield-enum.c", 435
+	jsr     _test_enum_bitfield_int
+;
+; test_enum_bitfield_uchar();
+;
+	.dbg	line, "bitfield-enum.c", 436
+	jsr     _test_enum_bitfield_uchar
+;
+; test_enum_bitfield_char();
+;
+	.dbg	line, "bitfield-enum.c", 437
+	jsr     _test_enum_bitfield_char
+;
+; test_enum_bitfield_ulong();
+;
+	.dbg	line, "bitfield-enum.c", 438
+	jsr     _test_enum_bitfield_ulong
+;
+; test_enum_bitfield_long();
+;
+	.dbg	line, "bitfield-enum.c", 439
+	jsr     _test_enum_bitfield_long
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-enum.c", 440
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-enum.c", 441
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-enum.c", 442
+L0001:	rts
+
+	.dbg	line
+.endproc
+
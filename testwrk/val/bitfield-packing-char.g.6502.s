@@ -0,0 +1,1312 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-packing-char.c", 6471, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.byte	$02
+_o:
+	.byte	$0B
+	.byte	$16
+_oi:
+	.byte	$0B
+	.byte	$16
+	.byte	$21
+_fw:
+	.byte	$FF
+	.byte	$11
+_ae:
+	.byte	$FC
+	.byte	$00
+	.byte	$11
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74,$68
+	.byte	$5F,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$5F,$77,$69,$74,$68,$5F,$63
+	.byte	$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20,$25
+	.byte	$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$29,$20,$3D,$20,$25,$7A,$75
+	.byte	$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$35,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits) != 1) {
+;
+	.dbg	line, "bitfield-packing-char.c", 40
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 41
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; sizeof(struct four_bits));
+;
+	.dbg	line, "bitfield-packing-char.c", 42
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fb.x != 1) {
+;
+	.dbg	line, "bitfield-packing-char.c", 46
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 47
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fb.x = 3;
+;
+	.dbg	line, "bitfield-packing-char.c", 51
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	.dbg	line, "bitfield-packing-char.c", 53
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 54
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 57
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_char: near
+
+	.dbg	func, "test_four_bits_with_char", "00", static, "_test_four_bits_with_char"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits_with_char) != 2) {
+;
+	.dbg	line, "bitfield-packing-char.c", 72
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits_with_char) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 73
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+;
+; sizeof(struct four_bits_with_char));
+;
+	.dbg	line, "bitfield-packing-char.c", 74
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.x != 1) {
+;
+	.dbg	line, "bitfield-packing-char.c", 78
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 79
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 80
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+	.dbg	line, "bitfield-packing-char.c", 83
+L0003:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$02
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fbi.y = %u, expected 2.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 84
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 85
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fbi.x = 3;
+;
+	.dbg	line, "bitfield-packing-char.c", 88
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 17;
+;
+	.dbg	line, "bitfield-packing-char.c", 89
+	ldx     #$00
+	lda     #$11
+	sta     _fbi+1
+;
+; if (fbi.x != 3) {
+;
+	.dbg	line, "bitfield-packing-char.c", 91
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 92
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 17) {
+;
+	.dbg	line, "bitfield-packing-char.c", 96
+L0005:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$11
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got fbi.y = %u, expected 17.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 97
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 100
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap: near
+
+	.dbg	func, "test_overlap", "00", static, "_test_overlap"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap) != 2) {
+;
+	.dbg	line, "bitfield-packing-char.c", 110
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 111
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+;
+; sizeof(struct overlap));
+;
+	.dbg	line, "bitfield-packing-char.c", 112
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.x != 11) {
+;
+	.dbg	line, "bitfield-packing-char.c", 116
+L0002:	lda     _o
+	ldx     #$00
+	and     #$3F
+	cmp     #$0B
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got o.x = %u, expected 11.\n", o.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 117
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 22) {
+;
+	.dbg	line, "bitfield-packing-char.c", 121
+L0003:	lda     _o+1
+	ldx     #$00
+	and     #$3F
+	cmp     #$16
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got o.y = %u, expected 22.\n", o.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 122
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _o+1
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; o.x = 33;
+;
+	.dbg	line, "bitfield-packing-char.c", 126
+L0004:	lda     _o
+	and     #$C0
+	ora     #$21
+	sta     _o
+;
+; o.y = 44;
+;
+	.dbg	line, "bitfield-packing-char.c", 127
+	lda     _o+1
+	and     #$C0
+	ora     #$2C
+	sta     _o+1
+;
+; if (o.x != 33) {
+;
+	.dbg	line, "bitfield-packing-char.c", 129
+	lda     _o
+	ldx     #$00
+	and     #$3F
+	cmp     #$21
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got o.x = %u, expected 33.\n", o.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 130
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 44) {
+;
+	.dbg	line, "bitfield-packing-char.c", 134
+L0005:	lda     _o+1
+	ldx     #$00
+	and     #$3F
+	cmp     #$2C
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got o.y = %u, expected 44.\n", o.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 135
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _o+1
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 136
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 138
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap_with_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap_with_char: near
+
+	.dbg	func, "test_overlap_with_char", "00", static, "_test_overlap_with_char"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap_with_char) != 3) {
+;
+	.dbg	line, "bitfield-packing-char.c", 149
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap_with_char) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 150
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+;
+; sizeof(struct overlap_with_char));
+;
+	.dbg	line, "bitfield-packing-char.c", 151
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 152
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.x != 11) {
+;
+	.dbg	line, "bitfield-packing-char.c", 155
+L0002:	lda     _oi
+	ldx     #$00
+	and     #$3F
+	cmp     #$0B
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got oi.x = %u, expected 11.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 156
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _oi
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 157
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 22) {
+;
+	.dbg	line, "bitfield-packing-char.c", 160
+L0003:	lda     _oi+1
+	ldx     #$00
+	and     #$3F
+	cmp     #$16
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got oi.y = %u, expected 22.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 161
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _oi+1
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 33) {
+;
+	.dbg	line, "bitfield-packing-char.c", 165
+L0004:	ldx     #$00
+	lda     _oi+2
+	cmp     #$21
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got oi.z = %u, expected 33.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing-char.c", 166
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     _oi+2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 167
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; oi.x = 44;
+;
+	.dbg	line, "bitfield-packing-char.c", 170
+L0005:	lda     _oi
+	and     #$C0
+	ora     #$2C
+	sta     _oi
+;
+; oi.y = 55;
+;
+	.dbg	line, "bitfield-packing-char.c", 171
+	lda     _oi+1
+	and     #$C0
+	ora     #$37
+	sta     _oi+1
+;
+; oi.z = 66;
+;
+	.dbg	line, "bitfield-packing-char.c", 172
+	ldx     #$00
+	lda     #$42
+	sta     _oi+2
+;
+; if (oi.x != 44) {
+;
+	.dbg	line, "bitfield-packing-char.c", 174
+	lda     _oi
+	ldx     #$00
+	and     #$3F
+	cmp     #$2C
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got oi.x = %u, expected 44.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 175
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _oi
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 176
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 55) {
+;
+	.dbg	line, "bitfield-packing-char.c", 179
+L0006:	lda     _oi+1
+	ldx     #$00
+	and     #$3F
+	cmp     #$37
+	jsr     boolne
+	jeq     L0007
+;
+; printf("Got oi.y = %u, expected 55.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 180
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _oi+1
+	ldx     #$00
+	and     #$3F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 181
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 66) {
+;
+	.dbg	line, "bitfield-packing-char.c", 184
+L0007:	ldx     #$00
+	lda     _oi+2
+	cmp     #$42
+	jsr     boolne
+	jeq     L0008
+;
+; printf("Got oi.z = %u, expected 66.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing-char.c", 185
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     _oi+2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 186
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 188
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct full_width) != 2) {
+;
+	.dbg	line, "bitfield-packing-char.c", 197
+	jmp     L0002
+;
+; printf("Got sizeof(struct full_width) = %zu, expected 2.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 198
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+;
+; sizeof(struct full_width));
+;
+	.dbg	line, "bitfield-packing-char.c", 199
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 200
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.x != 255) {
+;
+	.dbg	line, "bitfield-packing-char.c", 203
+L0002:	ldx     #$00
+	lda     _fw
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 204
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 205
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 17) {
+;
+	.dbg	line, "bitfield-packing-char.c", 208
+L0003:	ldx     #$00
+	lda     _fw+1
+	cmp     #$11
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fw.y = %u, expected 17.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 209
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 210
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fw.x = 42;
+;
+	.dbg	line, "bitfield-packing-char.c", 213
+L0004:	ldx     #$00
+	lda     #$2A
+	sta     _fw
+;
+; fw.y = 255;
+;
+	.dbg	line, "bitfield-packing-char.c", 214
+	ldx     #$00
+	lda     #$FF
+	sta     _fw+1
+;
+; if (fw.x != 42) {
+;
+	.dbg	line, "bitfield-packing-char.c", 216
+	ldx     #$00
+	lda     _fw
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got fw.x = %u, expected 42.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 217
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 218
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 255) {
+;
+	.dbg	line, "bitfield-packing-char.c", 221
+L0005:	ldx     #$00
+	lda     _fw+1
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got fw.y = %u, expected 255.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 222
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 223
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 225
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct aligned_end) != 3) {
+;
+	.dbg	line, "bitfield-packing-char.c", 237
+	jmp     L0002
+;
+; printf("Got sizeof(struct aligned_end) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing-char.c", 238
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+;
+; sizeof(struct aligned_end));
+;
+	.dbg	line, "bitfield-packing-char.c", 239
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 240
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.x != 63) {
+;
+	.dbg	line, "bitfield-packing-char.c", 243
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 244
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 245
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+	.dbg	line, "bitfield-packing-char.c", 248
+L0003:	lda     _ae+2
+	ldx     #$00
+	and     #$7F
+	cmp     #$11
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got ae.y = %u, expected 17.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 249
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _ae+2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 250
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ae.x = 42;
+;
+	.dbg	line, "bitfield-packing-char.c", 253
+L0004:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 127;
+;
+	.dbg	line, "bitfield-packing-char.c", 254
+	lda     _ae+2
+	ora     #$7F
+	sta     _ae+2
+;
+; if (ae.x != 42) {
+;
+	.dbg	line, "bitfield-packing-char.c", 256
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing-char.c", 257
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 258
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 127) {
+;
+	.dbg	line, "bitfield-packing-char.c", 261
+L0005:	lda     _ae+2
+	ldx     #$00
+	and     #$7F
+	cmp     #$7F
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got ae.y = %u, expected 127.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing-char.c", 262
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _ae+2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-char.c", 263
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 266
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_four_bits();
+;
+	.dbg	line, "bitfield-packing-char.c", 270
+	jsr     _test_four_bits
+;
+; test_four_bits_with_char();
+;
+	.dbg	line, "bitfield-packing-char.c", 271
+	jsr     _test_four_bits_with_char
+;
+; test_overlap();
+;
+	.dbg	line, "bitfield-packing-char.c", 272
+	jsr     _test_overlap
+;
+; test_overlap_with_char();
+;
+	.dbg	line, "bitfield-packing-char.c", 273
+	jsr     _test_overlap_with_char
+;
+; test_full_width();
+;
+	.dbg	line, "bitfield-packing-char.c", 274
+	jsr     _test_full_width
+;
+; test_aligned_end();
+;
+	.dbg	line, "bitfield-packing-char.c", 275
+	jsr     _test_aligned_end
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-packing-char.c", 276
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-packing-char.c", 277
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-packing-char.c", 278
+L0001:	rts
+
+	.dbg	line
+.endproc
+
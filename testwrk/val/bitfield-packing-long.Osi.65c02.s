@@ -0,0 +1,1385 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.dword	$00000002
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_oi:
+	.byte	$6F
+	.byte	$78
+	.byte	$03
+	.dword	$0000014D
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$40
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74,$68
+	.byte	$5F,$6C,$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$5F,$77,$69,$74,$68,$5F,$6C
+	.byte	$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$39
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20,$25
+	.byte	$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$29,$20,$3D,$20,$25,$7A,$75
+	.byte	$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$39,$34,$39,$36,$37
+	.byte	$32,$39,$35,$2E,$0A,$00
+S0023:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$36,$35,$35,$33,$37,$2E
+	.byte	$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$36,$35,$35,$33,$37,$2E,$0A
+	.byte	$00
+S001A:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0022:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$31,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$32,$32,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$33,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$34,$34,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$35,$35,$2E,$0A,$00
+S0020:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$77,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0021:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S001F:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0024:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$77,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0025:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+.segment	"CODE"
+
+;
+; if (fb.x != 1) {
+;
+	lda     _fb
+	and     #$0F
+	cmp     #$01
+	beq     L0003
+;
+; printf("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fb.x = 3;
+;
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	and     #$0F
+	cmp     #$03
+	beq     L0004
+;
+; printf("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_long: near
+
+.segment	"CODE"
+
+;
+; if (fbi.x != 1) {
+;
+	lda     _fbi
+	and     #$0F
+	cmp     #$01
+	beq     L0003
+;
+; printf("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _fbi
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+L0003:	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0004
+;
+; printf("Got fbi.y = %lu, expected 2.\n", fbi.y);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fbi.x = 3;
+;
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 65537;
+;
+	stz     _fbi+1+3
+	lda     #$01
+	sta     _fbi+1+2
+	stz     _fbi+1+1
+	lda     #$01
+	sta     _fbi+1
+;
+; if (fbi.x != 3) {
+;
+	lda     _fbi
+	and     #$0F
+	cmp     #$03
+	beq     L0005
+;
+; printf("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fbi
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fbi.y != 65537) {
+;
+L0005:	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$01
+	sta     sreg
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0006
+;
+; printf("Got fbi.y = %lu, expected 65537.\n", fbi.y);
+;
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap: near
+
+.segment	"CODE"
+
+;
+; if (o.x != 11) {
+;
+	lda     _o+1
+	and     #$03
+	tax
+	lda     _o
+	cpx     #$00
+	bne     L000B
+	cmp     #$0B
+	beq     L0003
+;
+; printf("Got o.x = %u, expected 11.\n", o.x);
+;
+L000B:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _o+1
+	and     #$03
+	tax
+	lda     _o
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (o.y != 22) {
+;
+L0003:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000C
+	cmp     #$16
+	beq     L0005
+;
+; printf("Got o.y = %u, expected 22.\n", o.y);
+;
+L000C:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; o.x = 33;
+;
+L0005:	lda     #$03
+	trb     _o+1
+	lda     #$21
+	sta     _o
+;
+; o.y = 44;
+;
+	lda     #$0F
+	trb     _o+1+1
+	lda     _o+1
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+;
+; if (o.x != 33) {
+;
+	and     #$03
+	tax
+	lda     _o
+	cpx     #$00
+	bne     L000D
+	cmp     #$21
+	beq     L0007
+;
+; printf("Got o.x = %u, expected 33.\n", o.x);
+;
+L000D:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _o+1
+	and     #$03
+	tax
+	lda     _o
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (o.y != 44) {
+;
+L0007:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000E
+	cmp     #$2C
+	beq     L0009
+;
+; printf("Got o.y = %u, expected 44.\n", o.y);
+;
+L000E:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0009:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap_with_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap_with_long: near
+
+.segment	"CODE"
+
+;
+; if (oi.x != 111) {
+;
+	lda     _oi+1
+	and     #$03
+	tax
+	lda     _oi
+	cpx     #$00
+	bne     L000D
+	cmp     #$6F
+	beq     L0003
+;
+; printf("Got oi.x = %u, expected 111.\n", oi.x);
+;
+L000D:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _oi+1
+	and     #$03
+	tax
+	lda     _oi
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (oi.y != 222) {
+;
+L0003:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000E
+	cmp     #$DE
+	beq     L0005
+;
+; printf("Got oi.y = %u, expected 222.\n", oi.y);
+;
+L000E:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (oi.z != 333) {
+;
+L0005:	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$4D
+	ldx     #$01
+	jsr     tosneeax
+	beq     L0007
+;
+; printf("Got oi.z = %u, expected 333.\n", oi.z);
+;
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; oi.x = 444;
+;
+L0007:	lda     _oi+1
+	and     #$FC
+	tax
+	lda     #$BC
+	sta     _oi
+	txa
+	ora     #$01
+	sta     _oi+1
+;
+; oi.y = 555;
+;
+	lda     _oi+1+1
+	and     #$F0
+	tax
+	lda     _oi+1
+	and     #$03
+	ora     #$AC
+	sta     _oi+1
+	txa
+	ora     #$08
+	sta     _oi+1+1
+;
+; oi.z = 4294967295;
+;
+	lda     #$FF
+	sta     _oi+3+3
+	sta     _oi+3+2
+	sta     _oi+3+1
+	sta     _oi+3
+;
+; if (oi.x != 444) {
+;
+	lda     _oi+1
+	and     #$03
+	tax
+	lda     _oi
+	cpx     #$01
+	bne     L000F
+	cmp     #$BC
+	beq     L0008
+;
+; printf("Got oi.x = %u, expected 444.\n", oi.x);
+;
+L000F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _oi+1
+	and     #$03
+	tax
+	lda     _oi
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (oi.y != 555) {
+;
+L0008:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0010
+	cmp     #$2B
+	beq     L000A
+;
+; printf("Got oi.y = %u, expected 555.\n", oi.y);
+;
+L0010:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (oi.z != 4294967295) {
+;
+L000A:	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	sta     sreg
+	tax
+	jsr     tosneeax
+	beq     L000C
+;
+; printf("Got oi.z = %lu, expected 4294967295.\n", oi.z);
+;
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000C:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+.segment	"CODE"
+
+;
+; if (fw.x != 255) {
+;
+	lda     _fw
+	cmp     #$FF
+	beq     L0003
+;
+; printf("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _fw
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fw.y != 17) {
+;
+L0003:	lda     _fw+1+1
+	bne     L000B
+	lda     _fw+1
+	cmp     #$11
+	beq     L0004
+;
+; printf("Got fw.y = %u, expected 17.\n", fw.y);
+;
+L000B:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fw.z != 1) {
+;
+L0004:	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0006
+;
+; printf("Got fw.z = %lu, expected 1.\n", fw.z);
+;
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; fw.x = 42;
+;
+L0006:	lda     #$2A
+	sta     _fw
+;
+; fw.y = 1023;
+;
+	ldx     #$03
+	lda     #$FF
+	sta     _fw+1
+	stx     _fw+1+1
+;
+; fw.z = 65537;
+;
+	stz     _fw+3+3
+	lda     #$01
+	sta     _fw+3+2
+	stz     _fw+3+1
+	lda     #$01
+	sta     _fw+3
+;
+; if (fw.x != 42) {
+;
+	lda     _fw
+	cmp     #$2A
+	beq     L0007
+;
+; printf("Got fw.x = %u, expected 42.\n", fw.x);
+;
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _fw
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fw.y != 1023) {
+;
+L0007:	lda     _fw+1+1
+	cmp     #$03
+	bne     L000C
+	lda     _fw+1
+	cmp     #$FF
+	beq     L0008
+;
+; printf("Got fw.y = %u, expected 1023.\n", fw.y);
+;
+L000C:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (fw.z != 65537) {
+;
+L0008:	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$01
+	sta     sreg
+	ldx     #$00
+	jsr     tosneeax
+	beq     L000A
+;
+; printf("Got fw.z = %lu, expected 65537.\n", fw.z);
+;
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+.segment	"CODE"
+
+;
+; if (ae.x != 63) {
+;
+	lda     _ae
+	lsr     a
+	lsr     a
+	cmp     #$3F
+	beq     L0003
+;
+; printf("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+L0003:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$00
+	bne     L000D
+	cmp     #$11
+	beq     L0004
+;
+; printf("Got ae.y = %u, expected 17.\n", ae.y);
+;
+L000D:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.z != 1) {
+;
+L0004:	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	stz     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	beq     L0006
+;
+; printf("Got ae.z = %lu, expected 1.\n", ae.z);
+;
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.w != 100) {
+;
+L0006:	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	cmp     #$64
+	beq     L0007
+;
+; printf("Got ae.w = %u, expected 100.\n", ae.w);
+;
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; ae.x = 42;
+;
+L0007:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 1023;
+;
+	lda     _ae+1
+	and     #$07
+	ora     #$F8
+	sta     _ae+1
+	ldx     #$1F
+	stx     _ae+1+1
+;
+; ae.z = 262143;
+;
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$C0
+	ldx     #$FF
+	jsr     tosoreax
+	sta     _ae+4
+	stx     _ae+4+1
+	ldy     sreg
+	sty     _ae+4+2
+	ldy     sreg+1
+	sty     _ae+4+3
+;
+; ae.w = 66;
+;
+	lda     _ae+7+1
+	and     #$E0
+	tax
+	lda     _ae+7
+	and     #$3F
+	ora     #$80
+	sta     _ae+7
+	txa
+	ora     #$10
+	sta     _ae+7+1
+;
+; if (ae.x != 42) {
+;
+	lda     _ae
+	lsr     a
+	lsr     a
+	cmp     #$2A
+	beq     L0008
+;
+; printf("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.y != 1023) {
+;
+L0008:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$03
+	bne     L000E
+	cmp     #$FF
+	beq     L0009
+;
+; printf("Got ae.y = %u, expected 1023.\n", ae.y);
+;
+L000E:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.z != 262143) {
+;
+L0009:	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosneeax
+	beq     L000B
+;
+; printf("Got ae.z = %lu, expected 262143.\n", ae.z);
+;
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ae.w != 66) {
+;
+L000B:	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	cmp     #$42
+	beq     L000C
+;
+; printf("Got ae.w = %u, expected 66.\n", ae.w);
+;
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000C:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_four_bits();
+;
+	jsr     _test_four_bits
+;
+; test_four_bits_with_long();
+;
+	jsr     _test_four_bits_with_long
+;
+; test_overlap();
+;
+	jsr     _test_overlap
+;
+; test_overlap_with_long();
+;
+	jsr     _test_overlap_with_long
+;
+; test_full_width();
+;
+	jsr     _test_full_width
+;
+; test_aligned_end();
+;
+	jsr     _test_aligned_end
+;
+; printf("failures: %u\n", failures);
+;
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
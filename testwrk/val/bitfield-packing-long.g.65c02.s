@@ -0,0 +1,1905 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-packing-long.c", 7334, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.dword	$00000002
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_oi:
+	.byte	$6F
+	.byte	$78
+	.byte	$03
+	.dword	$0000014D
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+	.byte	$01
+	.byte	$00
+	.byte	$00
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$40
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74,$68
+	.byte	$5F,$6C,$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$5F,$77,$69,$74,$68,$5F,$6C
+	.byte	$6F,$6E,$67,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$39
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20,$25
+	.byte	$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$29,$20,$3D,$20,$25,$7A,$75
+	.byte	$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$39,$34,$39,$36,$37
+	.byte	$32,$39,$35,$2E,$0A,$00
+S0023:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$36,$35,$35,$33,$37,$2E
+	.byte	$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$36,$35,$35,$33,$37,$2E,$0A
+	.byte	$00
+S001A:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0022:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$31,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$32,$32,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$33,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$34,$34,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$35,$35,$2E,$0A,$00
+S0020:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$77,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0021:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S001F:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0024:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$77,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0025:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits) != 1) {
+;
+	.dbg	line, "bitfield-packing-long.c", 40
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 41
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; sizeof(struct four_bits));
+;
+	.dbg	line, "bitfield-packing-long.c", 42
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fb.x != 1) {
+;
+	.dbg	line, "bitfield-packing-long.c", 46
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 47
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fb.x = 3;
+;
+	.dbg	line, "bitfield-packing-long.c", 51
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	.dbg	line, "bitfield-packing-long.c", 53
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 54
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 57
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_long: near
+
+	.dbg	func, "test_four_bits_with_long", "00", static, "_test_four_bits_with_long"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits_with_long) != 5) {
+;
+	.dbg	line, "bitfield-packing-long.c", 72
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits_with_long) = %zu, expected 5.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 73
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+;
+; sizeof(struct four_bits_with_long));
+;
+	.dbg	line, "bitfield-packing-long.c", 74
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.x != 1) {
+;
+	.dbg	line, "bitfield-packing-long.c", 78
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 79
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 80
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+	.dbg	line, "bitfield-packing-long.c", 83
+L0003:	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$02
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0004
+;
+; printf("Got fbi.y = %lu, expected 2.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 84
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 85
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fbi.x = 3;
+;
+	.dbg	line, "bitfield-packing-long.c", 88
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 65537;
+;
+	.dbg	line, "bitfield-packing-long.c", 89
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	sta     _fbi+1
+	stx     _fbi+1+1
+	ldy     sreg
+	sty     _fbi+1+2
+	ldy     sreg+1
+	sty     _fbi+1+3
+;
+; if (fbi.x != 3) {
+;
+	.dbg	line, "bitfield-packing-long.c", 91
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 92
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 65537) {
+;
+	.dbg	line, "bitfield-packing-long.c", 96
+L0005:	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0006
+;
+; printf("Got fbi.y = %lu, expected 65537.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 97
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _fbi+1+3
+	sta     sreg+1
+	lda     _fbi+1+2
+	sta     sreg
+	ldx     _fbi+1+1
+	lda     _fbi+1
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 100
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap: near
+
+	.dbg	func, "test_overlap", "00", static, "_test_overlap"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap) != 3) {
+;
+	.dbg	line, "bitfield-packing-long.c", 110
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 111
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+;
+; sizeof(struct overlap));
+;
+	.dbg	line, "bitfield-packing-long.c", 112
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.x != 11) {
+;
+	.dbg	line, "bitfield-packing-long.c", 116
+L0002:	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$0B
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf("Got o.x = %u, expected 11.\n", o.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 117
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 22) {
+;
+	.dbg	line, "bitfield-packing-long.c", 121
+L0003:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$16
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf("Got o.y = %u, expected 22.\n", o.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 122
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; o.x = 33;
+;
+	.dbg	line, "bitfield-packing-long.c", 126
+L0005:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$21
+	sta     _o
+	stx     _o+1
+;
+; o.y = 44;
+;
+	.dbg	line, "bitfield-packing-long.c", 127
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	stx     _o+1+1
+;
+; if (o.x != 33) {
+;
+	.dbg	line, "bitfield-packing-long.c", 129
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0008
+	cmp     #$21
+L0008:	jsr     boolne
+	jeq     L0007
+;
+; printf("Got o.x = %u, expected 33.\n", o.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 130
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 44) {
+;
+	.dbg	line, "bitfield-packing-long.c", 134
+L0007:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000A
+	cmp     #$2C
+L000A:	jsr     boolne
+	jeq     L0009
+;
+; printf("Got o.y = %u, expected 44.\n", o.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 135
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 136
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 138
+L0009:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap_with_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap_with_long: near
+
+	.dbg	func, "test_overlap_with_long", "00", static, "_test_overlap_with_long"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap_with_long) != 7) {
+;
+	.dbg	line, "bitfield-packing-long.c", 149
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap_with_long) = %zu, expected 7.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 150
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+;
+; sizeof(struct overlap_with_long));
+;
+	.dbg	line, "bitfield-packing-long.c", 151
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 152
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.x != 111) {
+;
+	.dbg	line, "bitfield-packing-long.c", 155
+L0002:	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$6F
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf("Got oi.x = %u, expected 111.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 156
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 157
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 222) {
+;
+	.dbg	line, "bitfield-packing-long.c", 160
+L0003:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$DE
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf("Got oi.y = %u, expected 222.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 161
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 333) {
+;
+	.dbg	line, "bitfield-packing-long.c", 165
+L0005:	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$4D
+	ldx     #$01
+	jsr     tosneeax
+	jeq     L0007
+;
+; printf("Got oi.z = %u, expected 333.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 166
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 167
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; oi.x = 444;
+;
+	.dbg	line, "bitfield-packing-long.c", 170
+L0007:	lda     _oi
+	ldx     _oi+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$BC
+	pha
+	txa
+	ora     #$01
+	tax
+	pla
+	sta     _oi
+	stx     _oi+1
+;
+; oi.y = 555;
+;
+	.dbg	line, "bitfield-packing-long.c", 171
+	lda     _oi+1
+	ldx     _oi+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$AC
+	pha
+	txa
+	ora     #$08
+	tax
+	pla
+	sta     _oi+1
+	stx     _oi+1+1
+;
+; oi.z = 4294967295;
+;
+	.dbg	line, "bitfield-packing-long.c", 172
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	sta     _oi+3
+	stx     _oi+3+1
+	ldy     sreg
+	sty     _oi+3+2
+	ldy     sreg+1
+	sty     _oi+3+3
+;
+; if (oi.x != 444) {
+;
+	.dbg	line, "bitfield-packing-long.c", 174
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$01
+	bne     L0009
+	cmp     #$BC
+L0009:	jsr     boolne
+	jeq     L0008
+;
+; printf("Got oi.x = %u, expected 444.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 175
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 176
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 555) {
+;
+	.dbg	line, "bitfield-packing-long.c", 179
+L0008:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L000B
+	cmp     #$2B
+L000B:	jsr     boolne
+	jeq     L000A
+;
+; printf("Got oi.y = %u, expected 555.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 180
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 181
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 4294967295) {
+;
+	.dbg	line, "bitfield-packing-long.c", 184
+L000A:	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L000C
+;
+; printf("Got oi.z = %lu, expected 4294967295.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 185
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _oi+3+3
+	sta     sreg+1
+	lda     _oi+3+2
+	sta     sreg
+	ldx     _oi+3+1
+	lda     _oi+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 186
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 188
+L000C:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct full_width) != 7) {
+;
+	.dbg	line, "bitfield-packing-long.c", 198
+	jmp     L0002
+;
+; printf("Got sizeof(struct full_width) = %zu, expected 7.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 199
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+;
+; sizeof(struct full_width));
+;
+	.dbg	line, "bitfield-packing-long.c", 200
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 201
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.x != 255) {
+;
+	.dbg	line, "bitfield-packing-long.c", 204
+L0002:	ldx     #$00
+	lda     _fw
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 205
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 206
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 17) {
+;
+	.dbg	line, "bitfield-packing-long.c", 209
+L0003:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$11
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fw.y = %u, expected 17.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 210
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 211
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.z != 1) {
+;
+	.dbg	line, "bitfield-packing-long.c", 214
+L0004:	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0006
+;
+; printf("Got fw.z = %lu, expected 1.\n", fw.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 215
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 216
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fw.x = 42;
+;
+	.dbg	line, "bitfield-packing-long.c", 219
+L0006:	ldx     #$00
+	lda     #$2A
+	sta     _fw
+;
+; fw.y = 1023;
+;
+	.dbg	line, "bitfield-packing-long.c", 220
+	ldx     #$03
+	lda     #$FF
+	sta     _fw+1
+	stx     _fw+1+1
+;
+; fw.z = 65537;
+;
+	.dbg	line, "bitfield-packing-long.c", 221
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	sta     _fw+3
+	stx     _fw+3+1
+	ldy     sreg
+	sty     _fw+3+2
+	ldy     sreg+1
+	sty     _fw+3+3
+;
+; if (fw.x != 42) {
+;
+	.dbg	line, "bitfield-packing-long.c", 223
+	ldx     #$00
+	lda     _fw
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0007
+;
+; printf("Got fw.x = %u, expected 42.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 224
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 225
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 1023) {
+;
+	.dbg	line, "bitfield-packing-long.c", 228
+L0007:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$03
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     boolne
+	jeq     L0008
+;
+; printf("Got fw.y = %u, expected 1023.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 229
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 230
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.z != 65537) {
+;
+	.dbg	line, "bitfield-packing-long.c", 233
+L0008:	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L000A
+;
+; printf("Got fw.z = %lu, expected 65537.\n", fw.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 234
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _fw+3+3
+	sta     sreg+1
+	lda     _fw+3+2
+	sta     sreg
+	ldx     _fw+3+1
+	lda     _fw+3
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 235
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 237
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct aligned_end) != 9) {
+;
+	.dbg	line, "bitfield-packing-long.c", 253
+	jmp     L0002
+;
+; printf("Got sizeof(struct aligned_end) = %zu, expected 9.\n",
+;
+	.dbg	line, "bitfield-packing-long.c", 254
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+;
+; sizeof(struct aligned_end));
+;
+	.dbg	line, "bitfield-packing-long.c", 255
+	ldx     #$00
+	lda     #$09
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 256
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.x != 63) {
+;
+	.dbg	line, "bitfield-packing-long.c", 259
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 260
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 261
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+	.dbg	line, "bitfield-packing-long.c", 264
+L0003:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$00
+	bne     L0005
+	cmp     #$11
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf("Got ae.y = %u, expected 17.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 265
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 266
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.z != 1) {
+;
+	.dbg	line, "bitfield-packing-long.c", 269
+L0004:	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$01
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0006
+;
+; printf("Got ae.z = %lu, expected 1.\n", ae.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 270
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 271
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.w != 100) {
+;
+	.dbg	line, "bitfield-packing-long.c", 274
+L0006:	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cmp     #$64
+	jsr     boolne
+	jeq     L0007
+;
+; printf("Got ae.w = %u, expected 100.\n", ae.w);
+;
+	.dbg	line, "bitfield-packing-long.c", 275
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 276
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ae.x = 42;
+;
+	.dbg	line, "bitfield-packing-long.c", 279
+L0007:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 1023;
+;
+	.dbg	line, "bitfield-packing-long.c", 280
+	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	ora     #$F8
+	pha
+	txa
+	ora     #$1F
+	tax
+	pla
+	sta     _ae+1
+	stx     _ae+1+1
+;
+; ae.z = 262143;
+;
+	.dbg	line, "bitfield-packing-long.c", 281
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$C0
+	ldx     #$FF
+	jsr     tosoreax
+	sta     _ae+4
+	stx     _ae+4+1
+	ldy     sreg
+	sty     _ae+4+2
+	ldy     sreg+1
+	sty     _ae+4+3
+;
+; ae.w = 66;
+;
+	.dbg	line, "bitfield-packing-long.c", 282
+	lda     _ae+7
+	ldx     _ae+7+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	pha
+	txa
+	ora     #$10
+	tax
+	pla
+	sta     _ae+7
+	stx     _ae+7+1
+;
+; if (ae.x != 42) {
+;
+	.dbg	line, "bitfield-packing-long.c", 284
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0008
+;
+; printf("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing-long.c", 285
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 286
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 1023) {
+;
+	.dbg	line, "bitfield-packing-long.c", 289
+L0008:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$03
+	bne     L000A
+	cmp     #$FF
+L000A:	jsr     boolne
+	jeq     L0009
+;
+; printf("Got ae.y = %u, expected 1023.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing-long.c", 290
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 291
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.z != 262143) {
+;
+	.dbg	line, "bitfield-packing-long.c", 294
+L0009:	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L000B
+;
+; printf("Got ae.z = %lu, expected 262143.\n", ae.z);
+;
+	.dbg	line, "bitfield-packing-long.c", 295
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _ae+4+3
+	sta     sreg+1
+	lda     _ae+4+2
+	sta     sreg
+	ldx     _ae+4+1
+	lda     _ae+4
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 296
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.w != 66) {
+;
+	.dbg	line, "bitfield-packing-long.c", 299
+L000B:	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cmp     #$42
+	jsr     boolne
+	jeq     L000C
+;
+; printf("Got ae.w = %u, expected 66.\n", ae.w);
+;
+	.dbg	line, "bitfield-packing-long.c", 300
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _ae+7
+	ldx     _ae+7+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing-long.c", 301
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 303
+L000C:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_four_bits();
+;
+	.dbg	line, "bitfield-packing-long.c", 307
+	jsr     _test_four_bits
+;
+; test_four_bits_with_long();
+;
+	.dbg	line, "bitfield-packing-long.c", 308
+	jsr     _test_four_bits_with_long
+;
+; test_overlap();
+;
+	.dbg	line, "bitfield-packing-long.c", 309
+	jsr     _test_overlap
+;
+; test_overlap_with_long();
+;
+	.dbg	line, "bitfield-packing-long.c", 310
+	jsr     _test_overlap_with_long
+;
+; test_full_width();
+;
+	.dbg	line, "bitfield-packing-long.c", 311
+	jsr     _test_full_width
+;
+; test_aligned_end();
+;
+	.dbg	line, "bitfield-packing-long.c", 312
+	jsr     _test_aligned_end
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-packing-long.c", 313
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-packing-long.c", 314
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-packing-long.c", 315
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,1574 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-packing.c", 6699, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.word	$0002
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_oi:
+	.byte	$6F
+	.byte	$78
+	.byte	$03
+	.word	$014D
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74,$68
+	.byte	$5F,$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$5F,$77,$69,$74,$68,$5F,$69
+	.byte	$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63
+	.byte	$74,$65,$64,$20,$35,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$35
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20,$25
+	.byte	$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$29,$20,$3D,$20,$25,$7A,$75
+	.byte	$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$35,$35,$33,$35,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$37,$2E,$0A,$00
+S001F:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$35,$35,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$34,$34,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$31,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$32,$32,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$33,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0020:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0021:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits) != 1) {
+;
+	.dbg	line, "bitfield-packing.c", 39
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits) = %zu, expected 1.\n",
+;
+	.dbg	line, "bitfield-packing.c", 40
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+;
+; sizeof(struct four_bits));
+;
+	.dbg	line, "bitfield-packing.c", 41
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 42
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fb.x != 1) {
+;
+	.dbg	line, "bitfield-packing.c", 45
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fb.x = %u, expected 1.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing.c", 46
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 47
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fb.x = 3;
+;
+	.dbg	line, "bitfield-packing.c", 50
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+;
+; if (fb.x != 3) {
+;
+	.dbg	line, "bitfield-packing.c", 52
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fb.x = %u, expected 3.\n", fb.x);
+;
+	.dbg	line, "bitfield-packing.c", 53
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 56
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_int: near
+
+	.dbg	func, "test_four_bits_with_int", "00", static, "_test_four_bits_with_int"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct four_bits_with_int) != 3) {
+;
+	.dbg	line, "bitfield-packing.c", 71
+	jmp     L0002
+;
+; printf("Got sizeof(struct four_bits_with_int) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing.c", 72
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+;
+; sizeof(struct four_bits_with_int));
+;
+	.dbg	line, "bitfield-packing.c", 73
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.x != 1) {
+;
+	.dbg	line, "bitfield-packing.c", 77
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fbi.x = %u, expected 1.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing.c", 78
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 2) {
+;
+	.dbg	line, "bitfield-packing.c", 82
+L0003:	lda     _fbi+1
+	ldx     _fbi+1+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$02
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fbi.y = %u, expected 2.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing.c", 83
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _fbi+1
+	ldx     _fbi+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 84
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fbi.x = 3;
+;
+	.dbg	line, "bitfield-packing.c", 87
+L0004:	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+;
+; fbi.y = 257;
+;
+	.dbg	line, "bitfield-packing.c", 88
+	ldx     #$01
+	lda     #$01
+	sta     _fbi+1
+	stx     _fbi+1+1
+;
+; if (fbi.x != 3) {
+;
+	.dbg	line, "bitfield-packing.c", 90
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got fbi.x = %u, expected 3.\n", fbi.x);
+;
+	.dbg	line, "bitfield-packing.c", 91
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 92
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fbi.y != 257) {
+;
+	.dbg	line, "bitfield-packing.c", 95
+L0006:	lda     _fbi+1
+	ldx     _fbi+1+1
+	cpx     #$01
+	bne     L0008
+	cmp     #$01
+L0008:	jsr     boolne
+	jeq     L0007
+;
+; printf("Got fbi.y = %u, expected 257.\n", fbi.y);
+;
+	.dbg	line, "bitfield-packing.c", 96
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _fbi+1
+	ldx     _fbi+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 97
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 99
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap: near
+
+	.dbg	func, "test_overlap", "00", static, "_test_overlap"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap) != 3) {
+;
+	.dbg	line, "bitfield-packing.c", 109
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing.c", 110
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+;
+; sizeof(struct overlap));
+;
+	.dbg	line, "bitfield-packing.c", 111
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 112
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.x != 11) {
+;
+	.dbg	line, "bitfield-packing.c", 115
+L0002:	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$0B
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf("Got o.x = %u, expected 11.\n", o.x);
+;
+	.dbg	line, "bitfield-packing.c", 116
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 117
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 22) {
+;
+	.dbg	line, "bitfield-packing.c", 120
+L0003:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$16
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf("Got o.y = %u, expected 22.\n", o.y);
+;
+	.dbg	line, "bitfield-packing.c", 121
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 122
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; o.x = 33;
+;
+	.dbg	line, "bitfield-packing.c", 125
+L0005:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$21
+	sta     _o
+	stx     _o+1
+;
+; o.y = 44;
+;
+	.dbg	line, "bitfield-packing.c", 126
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	stx     _o+1+1
+;
+; if (o.x != 33) {
+;
+	.dbg	line, "bitfield-packing.c", 128
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0008
+	cmp     #$21
+L0008:	jsr     boolne
+	jeq     L0007
+;
+; printf("Got o.x = %u, expected 33.\n", o.x);
+;
+	.dbg	line, "bitfield-packing.c", 129
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 130
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (o.y != 44) {
+;
+	.dbg	line, "bitfield-packing.c", 133
+L0007:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000A
+	cmp     #$2C
+L000A:	jsr     boolne
+	jeq     L0009
+;
+; printf("Got o.y = %u, expected 44.\n", o.y);
+;
+	.dbg	line, "bitfield-packing.c", 134
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 135
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 137
+L0009:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap_with_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap_with_int: near
+
+	.dbg	func, "test_overlap_with_int", "00", static, "_test_overlap_with_int"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct overlap_with_int) != 5) {
+;
+	.dbg	line, "bitfield-packing.c", 148
+	jmp     L0002
+;
+; printf("Got sizeof(struct overlap_with_int) = %zu, expected 5.\n",
+;
+	.dbg	line, "bitfield-packing.c", 149
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+;
+; sizeof(struct overlap_with_int));
+;
+	.dbg	line, "bitfield-packing.c", 150
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 151
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.x != 111) {
+;
+	.dbg	line, "bitfield-packing.c", 154
+L0002:	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$6F
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf("Got oi.x = %u, expected 111.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing.c", 155
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 222) {
+;
+	.dbg	line, "bitfield-packing.c", 159
+L0003:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$DE
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; printf("Got oi.y = %u, expected 222.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing.c", 160
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 161
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 333) {
+;
+	.dbg	line, "bitfield-packing.c", 164
+L0005:	lda     _oi+3
+	ldx     _oi+3+1
+	cpx     #$01
+	bne     L0008
+	cmp     #$4D
+L0008:	jsr     boolne
+	jeq     L0007
+;
+; printf("Got oi.z = %u, expected 333.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing.c", 165
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _oi+3
+	ldx     _oi+3+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 166
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; oi.x = 444;
+;
+	.dbg	line, "bitfield-packing.c", 169
+L0007:	lda     _oi
+	ldx     _oi+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$BC
+	pha
+	txa
+	ora     #$01
+	tax
+	pla
+	sta     _oi
+	stx     _oi+1
+;
+; oi.y = 555;
+;
+	.dbg	line, "bitfield-packing.c", 170
+	lda     _oi+1
+	ldx     _oi+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$AC
+	pha
+	txa
+	ora     #$08
+	tax
+	pla
+	sta     _oi+1
+	stx     _oi+1+1
+;
+; oi.z = 65535;
+;
+	.dbg	line, "bitfield-packing.c", 171
+	ldx     #$FF
+	lda     #$FF
+	sta     _oi+3
+	stx     _oi+3+1
+;
+; if (oi.x != 444) {
+;
+	.dbg	line, "bitfield-packing.c", 173
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$01
+	bne     L000A
+	cmp     #$BC
+L000A:	jsr     boolne
+	jeq     L0009
+;
+; printf("Got oi.x = %u, expected 444.\n", oi.x);
+;
+	.dbg	line, "bitfield-packing.c", 174
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 175
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.y != 555) {
+;
+	.dbg	line, "bitfield-packing.c", 178
+L0009:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L000C
+	cmp     #$2B
+L000C:	jsr     boolne
+	jeq     L000B
+;
+; printf("Got oi.y = %u, expected 555.\n", oi.y);
+;
+	.dbg	line, "bitfield-packing.c", 179
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 180
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (oi.z != 65535) {
+;
+	.dbg	line, "bitfield-packing.c", 183
+L000B:	lda     _oi+3
+	ldx     _oi+3+1
+	jsr     axulong
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L000D
+;
+; printf("Got oi.z = %u, expected 65535.\n", oi.z);
+;
+	.dbg	line, "bitfield-packing.c", 184
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _oi+3
+	ldx     _oi+3+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 185
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 187
+L000D:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct full_width) != 3) {
+;
+	.dbg	line, "bitfield-packing.c", 196
+	jmp     L0002
+;
+; printf("Got sizeof(struct full_width) = %zu, expected 3.\n",
+;
+	.dbg	line, "bitfield-packing.c", 197
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+;
+; sizeof(struct full_width));
+;
+	.dbg	line, "bitfield-packing.c", 198
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 199
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.x != 255) {
+;
+	.dbg	line, "bitfield-packing.c", 202
+L0002:	ldx     #$00
+	lda     _fw
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got fw.x = %u, expected 255.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing.c", 203
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 204
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 17) {
+;
+	.dbg	line, "bitfield-packing.c", 207
+L0003:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$11
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf("Got fw.y = %u, expected 17.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing.c", 208
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 209
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; fw.x = 42;
+;
+	.dbg	line, "bitfield-packing.c", 212
+L0004:	ldx     #$00
+	lda     #$2A
+	sta     _fw
+;
+; fw.y = 1023;
+;
+	.dbg	line, "bitfield-packing.c", 213
+	ldx     #$03
+	lda     #$FF
+	sta     _fw+1
+	stx     _fw+1+1
+;
+; if (fw.x != 42) {
+;
+	.dbg	line, "bitfield-packing.c", 215
+	ldx     #$00
+	lda     _fw
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got fw.x = %u, expected 42.\n", fw.x);
+;
+	.dbg	line, "bitfield-packing.c", 216
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 217
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (fw.y != 1023) {
+;
+	.dbg	line, "bitfield-packing.c", 220
+L0006:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$03
+	bne     L0008
+	cmp     #$FF
+L0008:	jsr     boolne
+	jeq     L0007
+;
+; printf("Got fw.y = %u, expected 1023.\n", fw.y);
+;
+	.dbg	line, "bitfield-packing.c", 221
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 222
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 224
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+;
+; if (sizeof(struct aligned_end) != 5) {
+;
+	.dbg	line, "bitfield-packing.c", 238
+	jmp     L0002
+;
+; printf("Got sizeof(struct aligned_end) = %zu, expected 5.\n",
+;
+	.dbg	line, "bitfield-packing.c", 239
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+;
+; sizeof(struct aligned_end));
+;
+	.dbg	line, "bitfield-packing.c", 240
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 241
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.x != 63) {
+;
+	.dbg	line, "bitfield-packing.c", 244
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got ae.x = %u, expected 63.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing.c", 245
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 246
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 17) {
+;
+	.dbg	line, "bitfield-packing.c", 249
+L0003:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$00
+	bne     L0005
+	cmp     #$11
+L0005:	jsr     boolne
+	jeq     L0004
+;
+; printf("Got ae.y = %u, expected 17.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing.c", 250
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 251
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.z != 100) {
+;
+	.dbg	line, "bitfield-packing.c", 254
+L0004:	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cmp     #$64
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got ae.z = %u, expected 100.\n", ae.z);
+;
+	.dbg	line, "bitfield-packing.c", 255
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 256
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ae.x = 42;
+;
+	.dbg	line, "bitfield-packing.c", 259
+L0006:	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+;
+; ae.y = 1023;
+;
+	.dbg	line, "bitfield-packing.c", 260
+	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	ora     #$F8
+	pha
+	txa
+	ora     #$1F
+	tax
+	pla
+	sta     _ae+1
+	stx     _ae+1+1
+;
+; ae.z = 66;
+;
+	.dbg	line, "bitfield-packing.c", 261
+	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	pha
+	txa
+	ora     #$10
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+;
+; if (ae.x != 42) {
+;
+	.dbg	line, "bitfield-packing.c", 263
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0007
+;
+; printf("Got ae.x = %u, expected 42.\n", ae.x);
+;
+	.dbg	line, "bitfield-packing.c", 264
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 265
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.y != 1023) {
+;
+	.dbg	line, "bitfield-packing.c", 268
+L0007:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$03
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     boolne
+	jeq     L0008
+;
+; printf("Got ae.y = %u, expected 1023.\n", ae.y);
+;
+	.dbg	line, "bitfield-packing.c", 269
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 270
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ae.z != 66) {
+;
+	.dbg	line, "bitfield-packing.c", 273
+L0008:	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cmp     #$42
+	jsr     boolne
+	jeq     L000A
+;
+; printf("Got ae.z = %u, expected 66.\n", ae.z);
+;
+	.dbg	line, "bitfield-packing.c", 274
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-packing.c", 275
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 277
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_four_bits();
+;
+	.dbg	line, "bitfield-packing.c", 281
+	jsr     _test_four_bits
+;
+; test_four_bits_with_int();
+;
+	.dbg	line, "bitfield-packing.c", 282
+	jsr     _test_four_bits_with_int
+;
+; test_overlap();
+;
+	.dbg	line, "bitfield-packing.c", 283
+	jsr     _test_overlap
+;
+; test_overlap_with_int();
+;
+	.dbg	line, "bitfield-packing.c", 284
+	jsr     _test_overlap_with_int
+;
+; test_full_width();
+;
+	.dbg	line, "bitfield-packing.c", 285
+	jsr     _test_full_width
+;
+; test_aligned_end();
+;
+	.dbg	line, "bitfield-packing.c", 286
+	jsr     _test_aligned_end
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-packing.c", 287
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-packing.c", 288
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-packing.c", 289
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,910 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_pi:
+	.byte	$CF
+	.byte	$2B
+_ps:
+	.byte	$CF
+	.byte	$2B
+_pc:
+	.byte	$0F
+_pl:
+	.byte	$CF
+	.byte	$2B
+	.byte	$50
+	.byte	$C3
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0017:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_int_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_int_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pi.x != 15) {
+;
+	lda     _pi
+	and     #$0F
+	cmp     #$0F
+	beq     L0002
+;
+; printf ("Got pi.x = %ld, expected 15.\n", (long)pi.x);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pi.y != 700) {
+;
+L0002:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0008
+	cmp     #$BC
+	beq     L0003
+;
+; printf ("Got pi.y = %ld, expected 700.\n", (long)pi.y);
+;
+L0008:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pi.x = 3;
+;
+L0003:	lda     _pi
+	and     #$F0
+	ora     #$03
+	sta     _pi
+;
+; pi.y = 1023;
+;
+	ora     #$F0
+	sta     _pi
+	lda     #$3F
+	tsb     _pi+1
+;
+; if (pi.x != 3) {
+;
+	lda     _pi
+	and     #$0F
+	cmp     #$03
+	beq     L0005
+;
+; printf ("Got pi.x = %ld, expected 3.\n", (long)pi.x);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pi.y != 1023) {
+;
+L0005:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L0009
+	cmp     #$FF
+	beq     L0006
+;
+; printf ("Got pi.y = %ld, expected 1023.\n", (long)pi.y);
+;
+L0009:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_short_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_short_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (ps.x != 15) {
+;
+	lda     _ps
+	and     #$0F
+	cmp     #$0F
+	beq     L0002
+;
+; printf ("Got ps.x = %ld, expected 15.\n", (long)ps.x);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ps.y != 700) {
+;
+L0002:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0008
+	cmp     #$BC
+	beq     L0003
+;
+; printf ("Got ps.y = %ld, expected 700.\n", (long)ps.y);
+;
+L0008:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; ps.x = 3;
+;
+L0003:	lda     _ps
+	and     #$F0
+	ora     #$03
+	sta     _ps
+;
+; ps.y = 1023;
+;
+	ora     #$F0
+	sta     _ps
+	lda     #$3F
+	tsb     _ps+1
+;
+; if (ps.x != 3) {
+;
+	lda     _ps
+	and     #$0F
+	cmp     #$03
+	beq     L0005
+;
+; printf ("Got ps.x = %ld, expected 3.\n", (long)ps.x);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ps.y != 1023) {
+;
+L0005:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L0009
+	cmp     #$FF
+	beq     L0006
+;
+; printf ("Got ps.y = %ld, expected 1023.\n", (long)ps.y);
+;
+L0009:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_char_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_char_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pc.x != 15) {
+;
+	lda     _pc
+	and     #$0F
+	cmp     #$0F
+	beq     L0002
+;
+; printf ("Got pc.x = %ld, expected 15.\n", (long)pc.x);
+;
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pc.x = 3;
+;
+L0002:	lda     _pc
+	and     #$F0
+	ora     #$03
+	sta     _pc
+;
+; if (pc.x != 3) {
+;
+	and     #$0F
+	cmp     #$03
+	beq     L0003
+;
+; printf ("Got pc.x = %ld, expected 3.\n", (long)pc.x);
+;
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_long_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_long_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pl.x != 15) {
+;
+	lda     _pl
+	and     #$0F
+	cmp     #$0F
+	beq     L0002
+;
+; printf ("Got pl.x = %lu, expected 15.\n", (unsigned long)pl.x);
+;
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.y != 700) {
+;
+L0002:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L001A
+	cmp     #$BC
+	beq     L0005
+;
+; if (pl.y < 0) {
+;
+L001A:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	jsr     return0
+	beq     L0007
+;
+; printf ("Got pl.y = %ld, expected 700.\n", (long)pl.y);
+;
+	lda     #<(S000D)
+	ldx     #>(S000D)
+;
+; } else {
+;
+	bra     L0048
+;
+; printf ("Got pl.y = %lu, expected 700.\n", (unsigned long)pl.y);
+;
+L0007:	lda     #<(S000E)
+	ldx     #>(S000E)
+L0048:	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.z != 200000) {
+;
+L0005:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$40
+	ldx     #$0D
+	jsr     tosneeax
+	beq     L0009
+;
+; if (pl.z < 0) {
+;
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     return0
+	beq     L000A
+;
+; printf ("Got pl.z = %ld, expected 200000.\n", (long)pl.z);
+;
+	lda     #<(S000F)
+	ldx     #>(S000F)
+;
+; } else {
+;
+	bra     L0058
+;
+; printf ("Got pl.z = %lu, expected 200000.\n", (unsigned long)pl.z);
+;
+L000A:	lda     #<(S0010)
+	ldx     #>(S0010)
+L0058:	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pl.x = 3;
+;
+L0009:	lda     _pl
+	and     #$F0
+	ora     #$03
+	sta     _pl
+;
+; pl.y = 1023;
+;
+	ora     #$F0
+	sta     _pl
+	lda     #$3F
+	tsb     _pl+1
+;
+; pl.z = 262143;
+;
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$C0
+	ldx     #$FF
+	jsr     tosoreax
+	sta     _pl+1
+	stx     _pl+1+1
+	ldy     sreg
+	sty     _pl+1+2
+	ldy     sreg+1
+	sty     _pl+1+3
+;
+; if (pl.x != 3) {
+;
+	lda     _pl
+	and     #$0F
+	cmp     #$03
+	beq     L000C
+;
+; printf ("Got pl.x = %lu, expected 3.\n", (unsigned long)pl.x);
+;
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.y != 1023) {
+;
+L000C:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L001B
+	cmp     #$FF
+	beq     L000F
+;
+; if (pl.y < 0) {
+;
+L001B:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	jsr     return0
+	beq     L0011
+;
+; printf ("Got pl.y = %ld, expected 1023.\n", (long)pl.y);
+;
+	lda     #<(S0013)
+	ldx     #>(S0013)
+;
+; } else {
+;
+	bra     L004A
+;
+; printf ("Got pl.y = %lu, expected 1023.\n", (unsigned long)pl.y);
+;
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+L004A:	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.z != 262143) {
+;
+L000F:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosneeax
+	beq     L0013
+;
+; if (pl.z < 0) {
+;
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     return0
+	beq     L0014
+;
+; printf ("Got pl.z = %ld, expected 262143.\n", (long)pl.z);
+;
+	lda     #<(S0015)
+	ldx     #>(S0015)
+;
+; } else {
+;
+	bra     L0059
+;
+; printf ("Got pl.z = %lu, expected 262143.\n", (unsigned long)pl.z);
+;
+L0014:	lda     #<(S0016)
+	ldx     #>(S0016)
+L0059:	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0013:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_plain_int_bitfields ();
+;
+	jsr     _test_plain_int_bitfields
+;
+; test_plain_short_bitfields ();
+;
+	jsr     _test_plain_short_bitfields
+;
+; test_plain_char_bitfields ();
+;
+	jsr     _test_plain_char_bitfields
+;
+; test_plain_long_bitfields ();
+;
+	jsr     _test_plain_long_bitfields
+;
+; printf ("failures: %u\n", failures);
+;
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
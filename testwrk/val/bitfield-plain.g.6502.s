@@ -0,0 +1,1220 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-plain.c", 4706, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_pi:
+	.byte	$CF
+	.byte	$2B
+_ps:
+	.byte	$CF
+	.byte	$2B
+_pc:
+	.byte	$0F
+_pl:
+	.byte	$CF
+	.byte	$2B
+	.byte	$50
+	.byte	$C3
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$36,$32,$31,$34,$33,$2E
+	.byte	$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$37,$30,$30,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0017:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_int_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_int_bitfields: near
+
+	.dbg	func, "test_plain_int_bitfields", "00", static, "_test_plain_int_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pi.x != 15) {
+;
+	.dbg	line, "bitfield-plain.c", 39
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got pi.x = %ld, expected 15.\n", (long)pi.x);
+;
+	.dbg	line, "bitfield-plain.c", 40
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pi.y != 700) {
+;
+	.dbg	line, "bitfield-plain.c", 43
+L0002:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0004
+	cmp     #$BC
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got pi.y = %ld, expected 700.\n", (long)pi.y);
+;
+	.dbg	line, "bitfield-plain.c", 44
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 45
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pi.x = 3;
+;
+	.dbg	line, "bitfield-plain.c", 48
+L0003:	lda     _pi
+	and     #$F0
+	ora     #$03
+	sta     _pi
+;
+; pi.y = 1023;
+;
+	.dbg	line, "bitfield-plain.c", 49
+	lda     _pi
+	ldx     _pi+1
+	ora     #$F0
+	pha
+	txa
+	ora     #$3F
+	tax
+	pla
+	sta     _pi
+	stx     _pi+1
+;
+; if (pi.x != 3) {
+;
+	.dbg	line, "bitfield-plain.c", 51
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got pi.x = %ld, expected 3.\n", (long)pi.x);
+;
+	.dbg	line, "bitfield-plain.c", 52
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 53
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pi.y != 1023) {
+;
+	.dbg	line, "bitfield-plain.c", 55
+L0005:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L0007
+	cmp     #$FF
+L0007:	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got pi.y = %ld, expected 1023.\n", (long)pi.y);
+;
+	.dbg	line, "bitfield-plain.c", 56
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 57
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-plain.c", 59
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_short_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_short_bitfields: near
+
+	.dbg	func, "test_plain_short_bitfields", "00", static, "_test_plain_short_bitfields"
+
+.segment	"CODE"
+
+;
+; if (ps.x != 15) {
+;
+	.dbg	line, "bitfield-plain.c", 68
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got ps.x = %ld, expected 15.\n", (long)ps.x);
+;
+	.dbg	line, "bitfield-plain.c", 69
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ps.y != 700) {
+;
+	.dbg	line, "bitfield-plain.c", 72
+L0002:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0004
+	cmp     #$BC
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got ps.y = %ld, expected 700.\n", (long)ps.y);
+;
+	.dbg	line, "bitfield-plain.c", 73
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ps.x = 3;
+;
+	.dbg	line, "bitfield-plain.c", 77
+L0003:	lda     _ps
+	and     #$F0
+	ora     #$03
+	sta     _ps
+;
+; ps.y = 1023;
+;
+	.dbg	line, "bitfield-plain.c", 78
+	lda     _ps
+	ldx     _ps+1
+	ora     #$F0
+	pha
+	txa
+	ora     #$3F
+	tax
+	pla
+	sta     _ps
+	stx     _ps+1
+;
+; if (ps.x != 3) {
+;
+	.dbg	line, "bitfield-plain.c", 80
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got ps.x = %ld, expected 3.\n", (long)ps.x);
+;
+	.dbg	line, "bitfield-plain.c", 81
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 82
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ps.y != 1023) {
+;
+	.dbg	line, "bitfield-plain.c", 84
+L0005:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L0007
+	cmp     #$FF
+L0007:	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got ps.y = %ld, expected 1023.\n", (long)ps.y);
+;
+	.dbg	line, "bitfield-plain.c", 85
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 86
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-plain.c", 88
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_char_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_char_bitfields: near
+
+	.dbg	func, "test_plain_char_bitfields", "00", static, "_test_plain_char_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pc.x != 15) {
+;
+	.dbg	line, "bitfield-plain.c", 96
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got pc.x = %ld, expected 15.\n", (long)pc.x);
+;
+	.dbg	line, "bitfield-plain.c", 97
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pc.x = 3;
+;
+	.dbg	line, "bitfield-plain.c", 101
+L0002:	lda     _pc
+	and     #$F0
+	ora     #$03
+	sta     _pc
+;
+; if (pc.x != 3) {
+;
+	.dbg	line, "bitfield-plain.c", 103
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got pc.x = %ld, expected 3.\n", (long)pc.x);
+;
+	.dbg	line, "bitfield-plain.c", 104
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 105
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-plain.c", 107
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_plain_long_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_plain_long_bitfields: near
+
+	.dbg	func, "test_plain_long_bitfields", "00", static, "_test_plain_long_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pl.x != 15) {
+;
+	.dbg	line, "bitfield-plain.c", 117
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0002
+;
+; if (pl.x < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 118
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jmp     L0003
+;
+; printf ("Got pl.x = %ld, expected 15.\n", (long)pl.x);
+;
+	.dbg	line, "bitfield-plain.c", 119
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 120
+	jmp     L0004
+;
+; printf ("Got pl.x = %lu, expected 15.\n", (unsigned long)pl.x);
+;
+	.dbg	line, "bitfield-plain.c", 121
+L0003:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 123
+L0004:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.y != 700) {
+;
+	.dbg	line, "bitfield-plain.c", 125
+L0002:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L0006
+	cmp     #$BC
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; if (pl.y < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 126
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     return0
+	jeq     L0007
+;
+; printf ("Got pl.y = %ld, expected 700.\n", (long)pl.y);
+;
+	.dbg	line, "bitfield-plain.c", 127
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 128
+	jmp     L0008
+;
+; printf ("Got pl.y = %lu, expected 700.\n", (unsigned long)pl.y);
+;
+	.dbg	line, "bitfield-plain.c", 129
+L0007:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 131
+L0008:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.z != 200000) {
+;
+	.dbg	line, "bitfield-plain.c", 133
+L0005:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$40
+	ldx     #$0D
+	jsr     tosneeax
+	jeq     L0009
+;
+; if (pl.z < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 134
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     return0
+	jeq     L000A
+;
+; printf ("Got pl.z = %ld, expected 200000.\n", (long)pl.z);
+;
+	.dbg	line, "bitfield-plain.c", 135
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 136
+	jmp     L000B
+;
+; printf ("Got pl.z = %lu, expected 200000.\n", (unsigned long)pl.z);
+;
+	.dbg	line, "bitfield-plain.c", 137
+L000A:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 139
+L000B:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pl.x = 3;
+;
+	.dbg	line, "bitfield-plain.c", 142
+L0009:	lda     _pl
+	and     #$F0
+	ora     #$03
+	sta     _pl
+;
+; pl.y = 1023;
+;
+	.dbg	line, "bitfield-plain.c", 143
+	lda     _pl
+	ldx     _pl+1
+	ora     #$F0
+	pha
+	txa
+	ora     #$3F
+	tax
+	pla
+	sta     _pl
+	stx     _pl+1
+;
+; pl.z = 262143;
+;
+	.dbg	line, "bitfield-plain.c", 144
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$C0
+	ldx     #$FF
+	jsr     tosoreax
+	sta     _pl+1
+	stx     _pl+1+1
+	ldy     sreg
+	sty     _pl+1+2
+	ldy     sreg+1
+	sty     _pl+1+3
+;
+; if (pl.x != 3) {
+;
+	.dbg	line, "bitfield-plain.c", 146
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L000C
+;
+; if (pl.x < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 147
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jmp     L000D
+;
+; printf ("Got pl.x = %ld, expected 3.\n", (long)pl.x);
+;
+	.dbg	line, "bitfield-plain.c", 148
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 149
+	jmp     L000E
+;
+; printf ("Got pl.x = %lu, expected 3.\n", (unsigned long)pl.x);
+;
+	.dbg	line, "bitfield-plain.c", 150
+L000D:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 152
+L000E:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.y != 1023) {
+;
+	.dbg	line, "bitfield-plain.c", 154
+L000C:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$03
+	bne     L0010
+	cmp     #$FF
+L0010:	jsr     boolne
+	jeq     L000F
+;
+; if (pl.y < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 155
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     return0
+	jeq     L0011
+;
+; printf ("Got pl.y = %ld, expected 1023.\n", (long)pl.y);
+;
+	.dbg	line, "bitfield-plain.c", 156
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 157
+	jmp     L0012
+;
+; printf ("Got pl.y = %lu, expected 1023.\n", (unsigned long)pl.y);
+;
+	.dbg	line, "bitfield-plain.c", 158
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 160
+L0012:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.z != 262143) {
+;
+	.dbg	line, "bitfield-plain.c", 162
+L000F:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosneeax
+	jeq     L0013
+;
+; if (pl.z < 0) {
+;
+	.dbg	line, "bitfield-plain.c", 163
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     return0
+	jeq     L0014
+;
+; printf ("Got pl.z = %ld, expected 262143.\n", (long)pl.z);
+;
+	.dbg	line, "bitfield-plain.c", 164
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-plain.c", 165
+	jmp     L0015
+;
+; printf ("Got pl.z = %lu, expected 262143.\n", (unsigned long)pl.z);
+;
+	.dbg	line, "bitfield-plain.c", 166
+L0014:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-plain.c", 168
+L0015:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-plain.c", 170
+L0013:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_plain_int_bitfields ();
+;
+	.dbg	line, "bitfield-plain.c", 174
+	jsr     _test_plain_int_bitfields
+;
+; test_plain_short_bitfields ();
+;
+	.dbg	line, "bitfield-plain.c", 175
+	jsr     _test_plain_short_bitfields
+;
+; test_plain_char_bitfields ();
+;
+	.dbg	line, "bitfield-plain.c", 176
+	jsr     _test_plain_char_bitfields
+;
+; test_plain_long_bitfields ();
+;
+	.dbg	line, "bitfield-plain.c", 177
+	jsr     _test_plain_long_bitfields
+;
+; printf ("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-plain.c", 178
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-plain.c", 179
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-plain.c", 180
+L0001:	rts
+
+	.dbg	line
+.endproc
+
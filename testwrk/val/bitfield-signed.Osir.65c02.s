@@ -0,0 +1,1177 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_pi:
+	.byte	$C8
+	.byte	$20
+_ps:
+	.byte	$C8
+	.byte	$20
+_pc:
+	.byte	$08
+_pl:
+	.byte	$C8
+	.byte	$20
+	.byte	$A4
+	.byte	$BB
+
+.segment	"RODATA"
+
+S0015:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$33,$31,$30,$37,$32
+	.byte	$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$33,$31,$30,$37,$32
+	.byte	$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$37,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$37,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0017:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_int_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_int_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pi.x != -8) {
+;
+	lda     _pi
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$F8
+	beq     L0002
+;
+; printf ("Got pi.x = %ld, expected -8.\n", (long)pi.x);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0004
+	dex
+L0004:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pi.y != -500) {
+;
+L0002:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L000C
+	cmp     #$0C
+	beq     L0005
+;
+; printf ("Got pi.y = %ld, expected -500.\n", (long)pi.y);
+;
+L000C:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pi.x = -3;
+;
+L0005:	lda     _pi
+	and     #$F0
+	ora     #$0D
+	sta     _pi
+;
+; pi.y = -512;
+;
+	tay
+	lda     _pi+1
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	sta     _pi
+	txa
+	ora     #$20
+	sta     _pi+1
+;
+; if (pi.x != -3) {
+;
+	lda     _pi
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$FD
+	beq     L0007
+;
+; printf ("Got pi.x = %ld, expected -3.\n", (long)pi.x);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0009
+	dex
+L0009:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pi.y != -512) {
+;
+L0007:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L000D
+	cmp     #$00
+	beq     L000A
+;
+; printf ("Got pi.y = %ld, expected -512.\n", (long)pi.y);
+;
+L000D:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_short_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_short_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (ps.x != -8) {
+;
+	lda     _ps
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$F8
+	beq     L0002
+;
+; printf ("Got ps.x = %ld, expected -8.\n", (long)ps.x);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0004
+	dex
+L0004:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ps.y != -500) {
+;
+L0002:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L000C
+	cmp     #$0C
+	beq     L0005
+;
+; printf ("Got ps.y = %ld, expected -500.\n", (long)ps.y);
+;
+L000C:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; ps.x = -3;
+;
+L0005:	lda     _ps
+	and     #$F0
+	ora     #$0D
+	sta     _ps
+;
+; ps.y = -512;
+;
+	tay
+	lda     _ps+1
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	sta     _ps
+	txa
+	ora     #$20
+	sta     _ps+1
+;
+; if (ps.x != -3) {
+;
+	lda     _ps
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$FD
+	beq     L0007
+;
+; printf ("Got ps.x = %ld, expected -3.\n", (long)ps.x);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0009
+	dex
+L0009:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (ps.y != -512) {
+;
+L0007:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L000D
+	cmp     #$00
+	beq     L000A
+;
+; printf ("Got ps.y = %ld, expected -512.\n", (long)ps.y);
+;
+L000D:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_char_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_char_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pc.x != -8) {
+;
+	lda     _pc
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$F8
+	beq     L0002
+;
+; printf ("Got pc.x = %ld, expected -8.\n", (long)pc.x);
+;
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0004
+	dex
+L0004:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pc.x = -3;
+;
+L0002:	lda     _pc
+	and     #$F0
+	ora     #$0D
+	sta     _pc
+;
+; if (pc.x != -3) {
+;
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$FD
+	beq     L0005
+;
+; printf ("Got pc.x = %ld, expected -3.\n", (long)pc.x);
+;
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0007
+	dex
+L0007:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_long_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_long_bitfields: near
+
+.segment	"CODE"
+
+;
+; if (pl.x != -8) {
+;
+	lda     _pl
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$F8
+	beq     L0002
+;
+; if (pl.x < 0) {
+;
+	lda     _pl
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	asl     a
+	bcc     L0004
+;
+; printf ("Got pl.x = %ld, expected -8.\n", (long)pl.x);
+;
+	lda     #<(S000B)
+	ldx     #>(S000B)
+;
+; } else {
+;
+	bra     L0066
+;
+; printf ("Got pl.x = %lu, expected -8.\n", (unsigned long)pl.x);
+;
+L0004:	lda     #<(S000C)
+	ldx     #>(S000C)
+L0066:	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0008
+	dex
+L0008:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.y != -500) {
+;
+L0002:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0024
+	cmp     #$0C
+	beq     L0009
+;
+; if (pl.y < 0) {
+;
+L0024:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	cpx     #$80
+	bcc     L000B
+;
+; printf ("Got pl.y = %ld, expected -500.\n", (long)pl.y);
+;
+	lda     #<(S000D)
+	ldx     #>(S000D)
+;
+; } else {
+;
+	bra     L0074
+;
+; printf ("Got pl.y = %lu, expected -500.\n", (unsigned long)pl.y);
+;
+L000B:	lda     #<(S000E)
+	ldx     #>(S000E)
+L0074:	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.z != -70000) {
+;
+L0009:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	dea
+	sta     sreg
+	lda     #$90
+	ldx     #$EE
+	jsr     tosneeax
+	jeq     L000D
+;
+; if (pl.z < 0) {
+;
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	lda     sreg+1
+	asl     a
+	bcc     L000E
+;
+; printf ("Got pl.z = %ld, expected -70000.\n", (long)pl.z);
+;
+	lda     #<(S000F)
+	ldx     #>(S000F)
+;
+; } else {
+;
+	bra     L009E
+;
+; printf ("Got pl.z = %lu, expected -70000.\n", (unsigned long)pl.z);
+;
+L000E:	lda     #<(S0010)
+	ldx     #>(S0010)
+L009E:	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; pl.x = -3;
+;
+L000D:	lda     _pl
+	and     #$F0
+	ora     #$0D
+	sta     _pl
+;
+; pl.y = -512;
+;
+	tay
+	lda     _pl+1
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	sta     _pl
+	txa
+	ora     #$20
+	sta     _pl+1
+;
+; pl.z = -131072;
+;
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	stz     sreg
+	lda     #$3F
+	ldx     #$00
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$80
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosoreax
+	sta     _pl+1
+	stx     _pl+1+1
+	ldy     sreg
+	sty     _pl+1+2
+	ldy     sreg+1
+	sty     _pl+1+3
+;
+; if (pl.x != -3) {
+;
+	lda     _pl
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	cmp     #$FD
+	beq     L0010
+;
+; if (pl.x < 0) {
+;
+	lda     _pl
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	asl     a
+	bcc     L0012
+;
+; printf ("Got pl.x = %ld, expected -3.\n", (long)pl.x);
+;
+	lda     #<(S0011)
+	ldx     #>(S0011)
+;
+; } else {
+;
+	bra     L0069
+;
+; printf ("Got pl.x = %lu, expected -3.\n", (unsigned long)pl.x);
+;
+L0012:	lda     #<(S0012)
+	ldx     #>(S0012)
+L0069:	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	sec
+	sbc     #$08
+	bcs     L0016
+	dex
+L0016:	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.y != -512) {
+;
+L0010:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0025
+	cmp     #$00
+	beq     L0017
+;
+; if (pl.y < 0) {
+;
+L0025:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	cpx     #$80
+	bcc     L0019
+;
+; printf ("Got pl.y = %ld, expected -512.\n", (long)pl.y);
+;
+	lda     #<(S0013)
+	ldx     #>(S0013)
+;
+; } else {
+;
+	bra     L0076
+;
+; printf ("Got pl.y = %lu, expected -512.\n", (unsigned long)pl.y);
+;
+L0019:	lda     #<(S0014)
+	ldx     #>(S0014)
+L0076:	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (pl.z != -131072) {
+;
+L0017:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	dea
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosneeax
+	bne     L00A0
+;
+; }
+;
+	rts
+;
+; if (pl.z < 0) {
+;
+L00A0:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	lda     sreg+1
+	asl     a
+	bcc     L001C
+;
+; printf ("Got pl.z = %ld, expected -131072.\n", (long)pl.z);
+;
+	lda     #<(S0015)
+	ldx     #>(S0015)
+;
+; } else {
+;
+	bra     L009F
+;
+; printf ("Got pl.z = %lu, expected -131072.\n", (unsigned long)pl.z);
+;
+L001C:	lda     #<(S0016)
+	ldx     #>(S0016)
+L009F:	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	tax
+	jsr     tosandeax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tosxoreax
+	jsr     pusheax
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	tax
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_signed_int_bitfields ();
+;
+	jsr     _test_signed_int_bitfields
+;
+; test_signed_short_bitfields ();
+;
+	jsr     _test_signed_short_bitfields
+;
+; test_signed_char_bitfields ();
+;
+	jsr     _test_signed_char_bitfields
+;
+; test_signed_long_bitfields ();
+;
+	jsr     _test_signed_long_bitfields
+;
+; printf ("failures: %u\n", failures);
+;
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,1484 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-signed.c", 4808, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_pi:
+	.byte	$C8
+	.byte	$20
+_ps:
+	.byte	$C8
+	.byte	$20
+_pc:
+	.byte	$08
+_pl:
+	.byte	$C8
+	.byte	$20
+	.byte	$A4
+	.byte	$BB
+
+.segment	"RODATA"
+
+S0015:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$33,$31,$30,$37,$32
+	.byte	$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$33,$31,$30,$37,$32
+	.byte	$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$37,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$7A,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$37,$30,$30,$30,$30,$2E
+	.byte	$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$31,$32,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$79,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$70,$73,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$70,$6C,$2E,$78,$20,$3D,$20,$25,$6C,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$70,$69,$2E,$78,$20,$3D,$20,$25,$6C,$64,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$38,$2E,$0A,$00
+S0017:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_int_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_int_bitfields: near
+
+	.dbg	func, "test_signed_int_bitfields", "00", static, "_test_signed_int_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pi.x != -8) {
+;
+	.dbg	line, "bitfield-signed.c", 39
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$F8
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got pi.x = %ld, expected -8.\n", (long)pi.x);
+;
+	.dbg	line, "bitfield-signed.c", 40
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pi.y != -500) {
+;
+	.dbg	line, "bitfield-signed.c", 43
+L0002:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0004
+	cmp     #$0C
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got pi.y = %ld, expected -500.\n", (long)pi.y);
+;
+	.dbg	line, "bitfield-signed.c", 44
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 45
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pi.x = -3;
+;
+	.dbg	line, "bitfield-signed.c", 48
+L0003:	lda     _pi
+	and     #$F0
+	ora     #$0D
+	sta     _pi
+;
+; pi.y = -512;
+;
+	.dbg	line, "bitfield-signed.c", 49
+	lda     _pi
+	ldx     _pi+1
+	tay
+	txa
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	ora     #$00
+	pha
+	txa
+	ora     #$20
+	tax
+	pla
+	sta     _pi
+	stx     _pi+1
+;
+; if (pi.x != -3) {
+;
+	.dbg	line, "bitfield-signed.c", 51
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$FD
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got pi.x = %ld, expected -3.\n", (long)pi.x);
+;
+	.dbg	line, "bitfield-signed.c", 52
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _pi
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 53
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pi.y != -512) {
+;
+	.dbg	line, "bitfield-signed.c", 55
+L0005:	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got pi.y = %ld, expected -512.\n", (long)pi.y);
+;
+	.dbg	line, "bitfield-signed.c", 56
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _pi
+	ldx     _pi+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 57
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-signed.c", 59
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_short_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_short_bitfields: near
+
+	.dbg	func, "test_signed_short_bitfields", "00", static, "_test_signed_short_bitfields"
+
+.segment	"CODE"
+
+;
+; if (ps.x != -8) {
+;
+	.dbg	line, "bitfield-signed.c", 68
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$F8
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got ps.x = %ld, expected -8.\n", (long)ps.x);
+;
+	.dbg	line, "bitfield-signed.c", 69
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ps.y != -500) {
+;
+	.dbg	line, "bitfield-signed.c", 72
+L0002:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0004
+	cmp     #$0C
+L0004:	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got ps.y = %ld, expected -500.\n", (long)ps.y);
+;
+	.dbg	line, "bitfield-signed.c", 73
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; ps.x = -3;
+;
+	.dbg	line, "bitfield-signed.c", 77
+L0003:	lda     _ps
+	and     #$F0
+	ora     #$0D
+	sta     _ps
+;
+; ps.y = -512;
+;
+	.dbg	line, "bitfield-signed.c", 78
+	lda     _ps
+	ldx     _ps+1
+	tay
+	txa
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	ora     #$00
+	pha
+	txa
+	ora     #$20
+	tax
+	pla
+	sta     _ps
+	stx     _ps+1
+;
+; if (ps.x != -3) {
+;
+	.dbg	line, "bitfield-signed.c", 80
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$FD
+	jsr     boolne
+	jeq     L0005
+;
+; printf ("Got ps.x = %ld, expected -3.\n", (long)ps.x);
+;
+	.dbg	line, "bitfield-signed.c", 81
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _ps
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 82
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (ps.y != -512) {
+;
+	.dbg	line, "bitfield-signed.c", 84
+L0005:	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+;
+; printf ("Got ps.y = %ld, expected -512.\n", (long)ps.y);
+;
+	.dbg	line, "bitfield-signed.c", 85
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _ps
+	ldx     _ps+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 86
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-signed.c", 88
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_char_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_char_bitfields: near
+
+	.dbg	func, "test_signed_char_bitfields", "00", static, "_test_signed_char_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pc.x != -8) {
+;
+	.dbg	line, "bitfield-signed.c", 96
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$F8
+	jsr     boolne
+	jeq     L0002
+;
+; printf ("Got pc.x = %ld, expected -8.\n", (long)pc.x);
+;
+	.dbg	line, "bitfield-signed.c", 97
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pc.x = -3;
+;
+	.dbg	line, "bitfield-signed.c", 101
+L0002:	lda     _pc
+	and     #$F0
+	ora     #$0D
+	sta     _pc
+;
+; if (pc.x != -3) {
+;
+	.dbg	line, "bitfield-signed.c", 103
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$FD
+	jsr     boolne
+	jeq     L0003
+;
+; printf ("Got pc.x = %ld, expected -3.\n", (long)pc.x);
+;
+	.dbg	line, "bitfield-signed.c", 104
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 105
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-signed.c", 107
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_long_bitfields (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_long_bitfields: near
+
+	.dbg	func, "test_signed_long_bitfields", "00", static, "_test_signed_long_bitfields"
+
+.segment	"CODE"
+
+;
+; if (pl.x != -8) {
+;
+	.dbg	line, "bitfield-signed.c", 117
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$F8
+	jsr     boolne
+	jeq     L0002
+;
+; if (pl.x < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 118
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+;
+; printf ("Got pl.x = %ld, expected -8.\n", (long)pl.x);
+;
+	.dbg	line, "bitfield-signed.c", 119
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 120
+	jmp     L0004
+;
+; printf ("Got pl.x = %lu, expected -8.\n", (unsigned long)pl.x);
+;
+	.dbg	line, "bitfield-signed.c", 121
+L0003:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 123
+L0004:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.y != -500) {
+;
+	.dbg	line, "bitfield-signed.c", 125
+L0002:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0006
+	cmp     #$0C
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; if (pl.y < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 126
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+;
+; printf ("Got pl.y = %ld, expected -500.\n", (long)pl.y);
+;
+	.dbg	line, "bitfield-signed.c", 127
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 128
+	jmp     L0008
+;
+; printf ("Got pl.y = %lu, expected -500.\n", (unsigned long)pl.y);
+;
+	.dbg	line, "bitfield-signed.c", 129
+L0007:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 131
+L0008:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.z != -70000) {
+;
+	.dbg	line, "bitfield-signed.c", 133
+L0005:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FE
+	sta     sreg
+	lda     #$90
+	ldx     #$EE
+	jsr     tosneeax
+	jeq     L0009
+;
+; if (pl.z < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 134
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+;
+; printf ("Got pl.z = %ld, expected -70000.\n", (long)pl.z);
+;
+	.dbg	line, "bitfield-signed.c", 135
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 136
+	jmp     L000B
+;
+; printf ("Got pl.z = %lu, expected -70000.\n", (unsigned long)pl.z);
+;
+	.dbg	line, "bitfield-signed.c", 137
+L000A:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 139
+L000B:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; pl.x = -3;
+;
+	.dbg	line, "bitfield-signed.c", 142
+L0009:	lda     _pl
+	and     #$F0
+	ora     #$0D
+	sta     _pl
+;
+; pl.y = -512;
+;
+	.dbg	line, "bitfield-signed.c", 143
+	lda     _pl
+	ldx     _pl+1
+	tay
+	txa
+	and     #$C0
+	tax
+	tya
+	and     #$0F
+	ora     #$00
+	pha
+	txa
+	ora     #$20
+	tax
+	pla
+	sta     _pl
+	stx     _pl+1
+;
+; pl.z = -131072;
+;
+	.dbg	line, "bitfield-signed.c", 144
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$3F
+	ldx     #$00
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$80
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosoreax
+	sta     _pl+1
+	stx     _pl+1+1
+	ldy     sreg
+	sty     _pl+1+2
+	ldy     sreg+1
+	sty     _pl+1+3
+;
+; if (pl.x != -3) {
+;
+	.dbg	line, "bitfield-signed.c", 146
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	cmp     #$FD
+	jsr     boolne
+	jeq     L000C
+;
+; if (pl.x < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 147
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+;
+; printf ("Got pl.x = %ld, expected -3.\n", (long)pl.x);
+;
+	.dbg	line, "bitfield-signed.c", 148
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 149
+	jmp     L000E
+;
+; printf ("Got pl.x = %lu, expected -3.\n", (unsigned long)pl.x);
+;
+	.dbg	line, "bitfield-signed.c", 150
+L000D:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _pl
+	ldx     #$00
+	and     #$0F
+	eor     #$08
+	jsr     decax8
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 152
+L000E:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.y != -512) {
+;
+	.dbg	line, "bitfield-signed.c", 154
+L000C:	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+;
+; if (pl.y < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 155
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0011
+;
+; printf ("Got pl.y = %ld, expected -512.\n", (long)pl.y);
+;
+	.dbg	line, "bitfield-signed.c", 156
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 157
+	jmp     L0012
+;
+; printf ("Got pl.y = %lu, expected -512.\n", (unsigned long)pl.y);
+;
+	.dbg	line, "bitfield-signed.c", 158
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _pl
+	ldx     _pl+1
+	jsr     shrax4
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 160
+L0012:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (pl.z != -131072) {
+;
+	.dbg	line, "bitfield-signed.c", 162
+L000F:	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	lda     #$FF
+	sta     sreg+1
+	lda     #$FE
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosneeax
+	jeq     L0013
+;
+; if (pl.z < 0) {
+;
+	.dbg	line, "bitfield-signed.c", 163
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0014
+;
+; printf ("Got pl.z = %ld, expected -131072.\n", (long)pl.z);
+;
+	.dbg	line, "bitfield-signed.c", 164
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; } else {
+;
+	.dbg	line, "bitfield-signed.c", 165
+	jmp     L0015
+;
+; printf ("Got pl.z = %lu, expected -131072.\n", (unsigned long)pl.z);
+;
+	.dbg	line, "bitfield-signed.c", 166
+L0014:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _pl+1+3
+	sta     sreg+1
+	lda     _pl+1+2
+	sta     sreg
+	ldx     _pl+1+1
+	lda     _pl+1
+	jsr     shreax4
+	jsr     shreax2
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$03
+	sta     sreg
+	lda     #$FF
+	ldx     #$FF
+	jsr     tosandeax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tosxoreax
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	ldx     #$00
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bitfield-signed.c", 168
+L0015:	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bitfield-signed.c", 170
+L0013:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_signed_int_bitfields ();
+;
+	.dbg	line, "bitfield-signed.c", 174
+	jsr     _test_signed_int_bitfields
+;
+; test_signed_short_bitfields ();
+;
+	.dbg	line, "bitfield-signed.c", 175
+	jsr     _test_signed_short_bitfields
+;
+; test_signed_char_bitfields ();
+;
+	.dbg	line, "bitfield-signed.c", 176
+	jsr     _test_signed_char_bitfields
+;
+; test_signed_long_bitfields ();
+;
+	.dbg	line, "bitfield-signed.c", 177
+	jsr     _test_signed_long_bitfields
+;
+; printf ("failures: %u\n", failures);
+;
+	.dbg	line, "bitfield-signed.c", 178
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bitfield-signed.c", 179
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-signed.c", 180
+L0001:	rts
+
+	.dbg	line
+.endproc
+
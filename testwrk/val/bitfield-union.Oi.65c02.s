@@ -0,0 +1,327 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$42,$69,$74,$66,$69,$65,$6C,$64,$3A,$20,$25,$75,$0A,$00
+S0001	:=	S0002+0
+S0004:
+	.byte	$61,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0006:
+	.byte	$62,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0008:
+	.byte	$63,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0007:
+	.byte	$63,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0005:
+	.byte	$62,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$61,$3D,$31,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; bitfield_t bitfield = { 42 };
+;
+	jsr     decsp2
+	ldy     #$01
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; printf ("Bitfield: %u\n", bitfield.bf);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 42) failures++;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0013
+	lda     (c_sp)
+	cmp     #$2A
+	beq     L0003
+L0013:	inc     _failures
+;
+; bitfield.bf ^= 42;
+;
+L0003:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	eor     #$2A
+	jsr     stax0sp
+;
+; printf ("Bitfield: %u\n", bitfield.bf);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	beq     L0005
+	inc     _failures
+;
+; bitfield.a = bitfield.a ^ 1;
+;
+L0005:	lda     (c_sp)
+	and     #$01
+	eor     #$01
+	and     #$01
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FE
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("a=1: %u\n", bitfield.bf);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 1) failures++;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0014
+	lda     (c_sp)
+	cmp     #$01
+	beq     L0017
+L0014:	inc     _failures
+;
+; bitfield.a = bitfield.a ^ 1;
+;
+L0017:	lda     (c_sp)
+	and     #$01
+	eor     #$01
+	and     #$01
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FE
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("a=0: %u\n\n", bitfield.bf);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	beq     L0009
+	inc     _failures
+;
+; bitfield.b = bitfield.b ^ 1;
+;
+L0009:	lda     (c_sp)
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FD
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("b=1: %u\n", bitfield.bf);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 2) failures++;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0015
+	lda     (c_sp)
+	cmp     #$02
+	beq     L0018
+L0015:	inc     _failures
+;
+; bitfield.b = bitfield.b ^ 1;
+;
+L0018:	lda     (c_sp)
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FD
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("b=0: %u\n\n", bitfield.bf);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	beq     L000D
+	inc     _failures
+;
+; bitfield.c = bitfield.c ^ 1;
+;
+L000D:	lda     (c_sp)
+	lsr     a
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	asl     a
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FB
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("c=1: %u\n", bitfield.bf);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 4) failures++;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	bne     L0016
+	lda     (c_sp)
+	cmp     #$04
+	beq     L0019
+L0016:	inc     _failures
+;
+; bitfield.c = bitfield.c ^ 1;
+;
+L0019:	lda     (c_sp)
+	lsr     a
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	asl     a
+	jsr     pusha0
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FB
+	jsr     tosora0
+	sta     (c_sp)
+;
+; printf ("c=0: %u\n\n", bitfield.bf);
+;
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	lda     (c_sp)
+	ldy     #$01
+	ora     (c_sp),y
+	beq     L0011
+	inc     _failures
+;
+; return failures;
+;
+L0011:	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$002A
+
+.endproc
+
@@ -0,0 +1,429 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bitfield-union.c", 2202, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$42,$69,$74,$66,$69,$65,$6C,$64,$3A,$20,$25,$75,$0A,$00
+S0001	:=	S0002+0
+S0004:
+	.byte	$61,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0006:
+	.byte	$62,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0008:
+	.byte	$63,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0007:
+	.byte	$63,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0005:
+	.byte	$62,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$61,$3D,$31,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "bitfield", "00", auto, -2
+
+.segment	"CODE"
+
+;
+; bitfield_t bitfield = { 42 };
+;
+	.dbg	line, "bitfield-union.c", 42
+	jsr     decsp2
+	ldy     #$01
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; printf ("Bitfield: %u\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 44
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 42) failures++;
+;
+	.dbg	line, "bitfield-union.c", 45
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0004
+	cmp     #$2A
+L0004:	jsr     boolne
+	jeq     L0003
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.bf ^= 42;
+;
+	.dbg	line, "bitfield-union.c", 47
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	eor     #$2A
+	ldy     #$00
+	jsr     staxysp
+;
+; printf ("Bitfield: %u\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 48
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	.dbg	line, "bitfield-union.c", 49
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     boolne
+	jeq     L0005
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.a = bitfield.a ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 51
+L0005:	ldy     #$00
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FE
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("a=1: %u\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 52
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 1) failures++;
+;
+	.dbg	line, "bitfield-union.c", 53
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0008
+	cmp     #$01
+L0008:	jsr     boolne
+	jeq     L0007
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.a = bitfield.a ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 55
+L0007:	ldy     #$00
+	lda     (c_sp),y
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FE
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("a=0: %u\n\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 56
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	.dbg	line, "bitfield-union.c", 57
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0009
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.b = bitfield.b ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 59
+L0009:	ldy     #$00
+	lda     (c_sp),y
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	asl     a
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FD
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("b=1: %u\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 60
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 2) failures++;
+;
+	.dbg	line, "bitfield-union.c", 61
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$02
+L000C:	jsr     boolne
+	jeq     L000B
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.b = bitfield.b ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 63
+L000B:	ldy     #$00
+	lda     (c_sp),y
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	asl     a
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FD
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("b=0: %u\n\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 64
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	.dbg	line, "bitfield-union.c", 65
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L000D
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.c = bitfield.c ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 67
+L000D:	ldy     #$00
+	lda     (c_sp),y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	asl     a
+	asl     a
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FB
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("c=1: %u\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 68
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 4) failures++;
+;
+	.dbg	line, "bitfield-union.c", 69
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0010
+	cmp     #$04
+L0010:	jsr     boolne
+	jeq     L000F
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; bitfield.c = bitfield.c ^ 1;
+;
+	.dbg	line, "bitfield-union.c", 71
+L000F:	ldy     #$00
+	lda     (c_sp),y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	ldx     #$00
+	asl     a
+	asl     a
+	jsr     pushax
+	ldy     #$02
+	lda     (c_sp),y
+	and     #$FB
+	jsr     tosorax
+	ldy     #$00
+	sta     (c_sp),y
+;
+; printf ("c=0: %u\n\n", bitfield.bf);
+;
+	.dbg	line, "bitfield-union.c", 72
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (bitfield.bf != 0) failures++;
+;
+	.dbg	line, "bitfield-union.c", 73
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$00
+L0012:	jsr     boolne
+	jeq     L0011
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; return failures;
+;
+	.dbg	line, "bitfield-union.c", 75
+L0011:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bitfield-union.c", 76
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$002A
+
+.endproc
+
@@ -0,0 +1,520 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_bool_or1
+	.export		_bool_or2
+	.export		_bool_test1
+	.export		_bool_test2
+	.export		_bool_and1
+	.export		_bin_or1
+	.export		_bin_xor1
+	.export		_bool_test3
+	.export		_bool_or_lit1
+	.export		_bool_and_lit1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or1: near
+
+.segment	"CODE"
+
+;
+; if( (achar0 >0) || (achar1 >0 ))
+;
+	lda     _achar0
+	bne     L0005
+	lda     _achar1
+	bne     L0005
+	rts
+;
+; failures++;
+;
+L0005:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or2: near
+
+.segment	"CODE"
+
+;
+; if( achar0 || achar1)
+;
+	lda     _achar0
+	bne     L0003
+	lda     _achar1
+	bne     L0003
+	rts
+;
+; failures++;
+;
+L0003:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test1: near
+
+.segment	"CODE"
+
+;
+; if( (achar0==0) || achar1)
+;
+	lda     _achar0
+	beq     L0005
+	lda     _achar1
+	bne     L0005
+	rts
+;
+; failures++;
+;
+L0005:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test2: near
+
+.segment	"CODE"
+
+;
+; if( (achar0==0) || aint0)
+;
+	lda     _achar0
+	beq     L0005
+	lda     _aint0
+	ora     _aint0+1
+	bne     L0005
+	rts
+;
+; failures++;
+;
+L0005:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and1: near
+
+.segment	"CODE"
+
+;
+; if( achar0 && achar1)
+;
+	lda     _achar0
+	beq     L0003
+	lda     _achar1
+	bne     L0004
+L0003:	rts
+;
+; failures++;
+;
+L0004:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_or1: near
+
+.segment	"CODE"
+
+;
+; t = achar0 | achar1;
+;
+	jsr     decsp1
+	lda     _achar0
+	ora     _achar1
+	sta     (c_sp)
+;
+; if(t)
+;
+	lda     (c_sp)
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_xor1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_xor1: near
+
+.segment	"CODE"
+
+;
+; if(achar0 ^ achar1)
+;
+	lda     _achar0
+	eor     _achar1
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test3: near
+
+.segment	"CODE"
+
+;
+; if((achar0 == 0x42) || (achar1 == 42))
+;
+	lda     _achar0
+	cmp     #$42
+	beq     L0005
+	lda     _achar1
+	cmp     #$2A
+	beq     L0005
+	rts
+;
+; failures++;
+;
+L0005:	inc     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or_lit1: near
+
+.segment	"CODE"
+
+;
+; achar0 |= 0x0f;
+;
+	lda     _achar0
+	ora     #$0F
+	sta     _achar0
+;
+; if(achar0 > 0x10)
+;
+	cmp     #$11
+	bcc     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; if( (achar0 | 0x10) > 0xf0)
+;
+L0005:	lda     _achar0
+	ora     #$10
+	cmp     #$F1
+	lda     #$00
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and_lit1: near
+
+.segment	"CODE"
+
+;
+; achar0 &= 0xf0;
+;
+	lda     _achar0
+	and     #$F0
+	sta     _achar0
+;
+; if(achar0 > 0x10)
+;
+	cmp     #$11
+	bcc     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; if( (achar0 & 0x10) > 0xf0)
+;
+L0005:	lda     _achar0
+	and     #$10
+	cmp     #$F1
+	lda     #$00
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; achar0 &= 0xef;
+;
+L0006:	lda     #$10
+	trb     _achar0
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; bool_or1();
+;
+	jsr     _bool_or1
+;
+; bool_or2();
+;
+	jsr     _bool_or2
+;
+; bool_and1();
+;
+	jsr     _bool_and1
+;
+; bin_or1();
+;
+	jsr     _bin_or1
+;
+; bin_xor1();
+;
+	jsr     _bin_xor1
+;
+; achar0++;
+;
+	inc     _achar0
+;
+; bool_and1();
+;
+	jsr     _bool_and1
+;
+; bool_test1();
+;
+	jsr     _bool_test1
+;
+; bool_test2();
+;
+	jsr     _bool_test2
+;
+; bool_test3();
+;
+	jsr     _bool_test3
+;
+; achar0--; achar1++;
+;
+	dec     _achar0
+	inc     _achar1
+;
+; bool_and1();
+;
+	jsr     _bool_and1
+;
+; achar0=0;
+;
+	stz     _achar0
+;
+; achar1=0;
+;
+	stz     _achar1
+;
+; bool_or_lit1();
+;
+	jsr     _bool_or_lit1
+;
+; bool_and_lit1();
+;
+	jsr     _bool_and_lit1
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
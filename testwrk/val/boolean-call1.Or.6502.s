@@ -0,0 +1,627 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_call3
+	.export		_done
+	.export		_call1
+	.export		_call2
+	.export		_call4
+	.export		_call5
+	.export		_call6a
+	.export		_call6
+	.export		_call7a
+	.export		_call7
+	.export		_call8
+	.export		_call9
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call3: near
+
+.segment	"CODE"
+
+;
+; if (uchar0)
+;
+	lda     _uchar0
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; return (failures);
+;
+L0002:	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+;
+; dummy++;
+;
+	inc     _dummy
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call1 (unsigned char uc0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call1: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; if (uc0)
+;
+	ldy     #$00
+	lda     (c_sp),y
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call2 (unsigned int ui0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call2: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; if (ui0)
+;
+	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call4: near
+
+.segment	"CODE"
+
+;
+; unsigned int i = 0;
+;
+	jsr     push0
+;
+; if (uint0)
+;
+	lda     _uint0
+	ora     _uint0+1
+	beq     L0002
+;
+; i++;
+;
+	lda     #$01
+	jsr     addeq0sp
+;
+; }
+;
+L0002:	jmp     popax
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call5 (unsigned int k)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call5: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; if (k)
+;
+	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0002:	jmp     popax
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call6a (unsigned char uc)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call6a: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; if(uc>uchar1)
+;
+	ldx     #$00
+	lda     (c_sp,x)
+	cmp     _uchar1
+	bcc     L0004
+	beq     L0004
+;
+; return 1;
+;
+	lda     #$01
+	jmp     incsp1
+;
+; return 0;
+;
+L0004:	txa
+;
+; }
+;
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call6 (unsigned char uc)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call6: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; return(call6a(uc));
+;
+	ldy     #$00
+	lda     (c_sp),y
+	jsr     _call6a
+;
+; }
+;
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call7a (unsigned int ui)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call7a: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; if(ui)
+;
+	ldy     #$01
+	lda     (c_sp),y
+	dey
+	ora     (c_sp),y
+	beq     L0002
+;
+; return 1;
+;
+	ldx     #$00
+	lda     #$01
+	jmp     incsp2
+;
+; return 0;
+;
+L0002:	tax
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call7 (unsigned int ui)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call7: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; return(call7a(ui));
+;
+	jsr     ldax0sp
+	jsr     _call7a
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call8 (unsigned char uc1, unsigned char uc2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call8: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; return uc1+uc2;
+;
+	ldy     #$00
+	lda     (c_sp),y
+	clc
+	iny
+	adc     (c_sp),y
+	ldx     #$00
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call9 (unsigned int ui1, unsigned int ui2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call9: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; if(ui1 != 0x1234)
+;
+	ldy     #$03
+	lda     (c_sp),y
+	cmp     #$12
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$34
+	beq     L0002
+;
+; failures++;
+;
+L0006:	inc     _failures
+;
+; if(ui2 != 0x5678)
+;
+L0002:	ldy     #$01
+	lda     (c_sp),y
+	cmp     #$56
+	bne     L0007
+	dey
+	lda     (c_sp),y
+	cmp     #$78
+	beq     L0004
+;
+; failures++;
+;
+L0007:	inc     _failures
+;
+; }
+;
+L0004:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; call1 (uchar0);
+;
+	lda     _uchar0
+	jsr     _call1
+;
+; call2 (uint0);
+;
+	lda     _uint0
+	ldx     _uint0+1
+	jsr     _call2
+;
+; uchar1 = call3 ();
+;
+	jsr     _call3
+	sta     _uchar1
+;
+; uint1 = call4 ();
+;
+	jsr     _call4
+	sta     _uint1
+	stx     _uint1+1
+;
+; if (uint1)
+;
+	lda     _uint1
+	ora     _uint1+1
+	beq     L0002
+;
+; failures++;
+;
+	inc     _failures
+;
+; uint1 = call5 (uint0);
+;
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	jsr     _call5
+	sta     _uint1
+	stx     _uint1+1
+;
+; if (uint1)
+;
+	lda     _uint1
+	ora     _uint1+1
+	beq     L0003
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(call6(uchar0))
+;
+L0003:	lda     _uchar0
+	jsr     _call6
+	tax
+	beq     L000A
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(call7(0))
+;
+	ldx     #$00
+	txa
+L000A:	jsr     _call7
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(!call7(1))
+;
+L0005:	ldx     #$00
+	lda     #$01
+	jsr     _call7
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+;
+; failures++;
+;
+	inc     _failures
+;
+; if(!call7(0xff00))
+;
+L0006:	ldx     #$FF
+	lda     #$00
+	jsr     _call7
+	stx     tmp1
+	ora     tmp1
+	bne     L0007
+;
+; failures++;
+;
+	inc     _failures
+;
+; uchar0=4;
+;
+L0007:	lda     #$04
+	sta     _uchar0
+;
+; uchar1=3;
+;
+	lda     #$03
+	sta     _uchar1
+;
+; uchar0 = call8(uchar0,uchar1);
+;
+	lda     _uchar0
+	jsr     pusha
+	lda     _uchar1
+	jsr     _call8
+	sta     _uchar0
+;
+; if(uchar0 != 7)
+;
+	cmp     #$07
+	beq     L0008
+;
+; failures++;
+;
+	inc     _failures
+;
+; call9(0x1234,0x5678);
+;
+L0008:	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$56
+	lda     #$78
+	jsr     _call9
+;
+; success = failures;
+;
+	lda     _failures
+	sta     _success
+;
+; done ();
+;
+	jsr     _done
+;
+; printf("failures: %d\n",failures);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,696 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_failures
+	.export		_a
+	.export		_test_booltrans
+	.export		_test_bnega2
+	.export		_test_bnegax2
+	.export		_f
+	.export		_test_bnegax3
+	.export		_test_bnegax4
+	.export		_main
+
+.segment	"RODATA"
+
+S001B:
+	.byte	$74,$65,$73,$74,$5F,$62,$6F,$6F,$6C,$74,$72,$61,$6E,$73,$28,$31
+	.byte	$29,$3A,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A
+	.byte	$20,$31,$0A,$00
+S001A:
+	.byte	$74,$65,$73,$74,$5F,$62,$6F,$6F,$6C,$74,$72,$61,$6E,$73,$28,$30
+	.byte	$29,$3A,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A
+	.byte	$20,$30,$0A,$00
+S0022:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$34,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S001E:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$32,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S001F:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$32,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S0020:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$33,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S0021:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$33,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S0023:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$34,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S001D:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$32,$28,$31,$29,$3A,$20
+	.byte	$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31,$0A
+	.byte	$00
+S001C:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$32,$28,$30,$29,$3A,$20
+	.byte	$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30,$0A
+	.byte	$00
+S0024:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test_booltrans (signed char x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_booltrans: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; a = x;
+;
+	ldx     #$00
+	lda     (c_sp)
+	bpl     L0002
+	dex
+L0002:	sta     _a
+	stx     _a+1
+;
+; __asm__("lda #$00");
+;
+	lda     #$00
+;
+; __asm__("cmp %v", a);
+;
+	cmp     _a
+;
+; __asm__("jne %g", L0);
+;
+	beq     L0004
+;
+; return 1;
+;
+	tax
+	ina
+	jmp     incsp1
+;
+; return 0;
+;
+L0004:	tax
+;
+; }
+;
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnega2 (signed char x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnega2: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusha
+;
+; a = x;
+;
+	ldx     #$00
+	lda     (c_sp)
+	bpl     L0002
+	dex
+L0002:	sta     _a
+	stx     _a+1
+;
+; __asm__("lda %v", a);
+;
+	lda     _a
+;
+; __asm__("jne %g", L0);
+;
+	beq     L0004
+;
+; return 1;
+;
+	ldx     #$00
+	lda     #$01
+	jmp     incsp1
+;
+; return 0;
+;
+L0004:	tax
+;
+; }
+;
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax2: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; int a = x;
+;
+	jsr     pushw0sp
+;
+; __asm__("ldy #%o+1", a);
+;
+	ldy     #$00+1
+;
+; __asm__("jsr ldaxysp");
+;
+	lda     (c_sp),y
+	ora     (c_sp)
+;
+; __asm__("jne %g", L0);
+;
+	beq     L0003
+;
+; return 1;
+;
+	ldx     #$00
+	tya
+	jmp     incsp4
+;
+; return 0;
+;
+L0003:	tax
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+;
+; void __fastcall__ f(void) {}
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax3 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax3: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; a = x;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	sta     _a+1
+	lda     (c_sp)
+	sta     _a
+;
+; __asm__("jsr %v", f);
+;
+	jsr     _f
+;
+; __asm__("jsr bnegax");
+;
+	stx     tmp1
+	ora     tmp1
+;
+; __asm__("jne %g", L0);
+;
+	beq     L0003
+;
+; return 1;
+;
+	ldx     #$00
+	lda     #$01
+	jmp     incsp2
+;
+; return 0;
+;
+L0003:	tax
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax4 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax4: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pushax
+;
+; a = x;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	sta     _a
+	stx     _a+1
+;
+; __asm__("jsr bnegax");
+;
+	jsr     bnegax
+;
+; __asm__("jne %g", L0);
+;
+	bne     L0005
+;
+; return 1;
+;
+	tya
+	jmp     incsp2
+;
+; return 0;
+;
+L0005:	txa
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; a = test_booltrans(0);
+;
+	lda     #$00
+	jsr     _test_booltrans
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	cpx     #$00
+	bne     L0022
+	cmp     #$00
+	beq     L0002
+;
+; ++failures;
+;
+L0022:	inc     _failures
+	bne     L0004
+	inc     _failures+1
+;
+; printf("test_booltrans(0): %d, expected: 0\n", a);
+;
+L0004:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_booltrans(1);
+;
+L0002:	lda     #$01
+	jsr     _test_booltrans
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	cpx     #$00
+	bne     L0023
+	cmp     #$01
+	beq     L0005
+;
+; ++failures;
+;
+L0023:	inc     _failures
+	bne     L0007
+	inc     _failures+1
+;
+; printf("test_booltrans(1): %d, expected: 1\n", a);
+;
+L0007:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnega2(0);
+;
+L0005:	lda     #$00
+	jsr     _test_bnega2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	beq     L0008
+;
+; ++failures;
+;
+L0024:	inc     _failures
+	bne     L000A
+	inc     _failures+1
+;
+; printf("test_bnega2(0): %d, expected: 0\n", a);
+;
+L000A:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnega2(1);
+;
+L0008:	lda     #$01
+	jsr     _test_bnega2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	cpx     #$00
+	bne     L0025
+	cmp     #$01
+	beq     L002C
+;
+; ++failures;
+;
+L0025:	inc     _failures
+	bne     L000D
+	inc     _failures+1
+;
+; printf("test_bnega2(1): %d, expected: 1\n", a);
+;
+L000D:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax2(0);
+;
+	ldx     #$00
+L002C:	txa
+	jsr     _test_bnegax2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	cpx     #$00
+	bne     L0026
+	cmp     #$00
+	beq     L002D
+;
+; ++failures;
+;
+L0026:	inc     _failures
+	bne     L0010
+	inc     _failures+1
+;
+; printf("test_bnegax2(0): %d, expected: 0\n", a);
+;
+L0010:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax2(1);
+;
+	ldx     #$00
+L002D:	lda     #$01
+	jsr     _test_bnegax2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	cpx     #$00
+	bne     L0027
+	cmp     #$01
+	beq     L002E
+;
+; ++failures;
+;
+L0027:	inc     _failures
+	bne     L0013
+	inc     _failures+1
+;
+; printf("test_bnegax2(1): %d, expected: 1\n", a);
+;
+L0013:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax3(0);
+;
+	ldx     #$00
+L002E:	txa
+	jsr     _test_bnegax3
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	cpx     #$00
+	bne     L0028
+	cmp     #$00
+	beq     L002F
+;
+; ++failures;
+;
+L0028:	inc     _failures
+	bne     L0016
+	inc     _failures+1
+;
+; printf("test_bnegax3(0): %d, expected: 0\n", a);
+;
+L0016:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax3(1);
+;
+	ldx     #$00
+L002F:	lda     #$01
+	jsr     _test_bnegax3
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	cpx     #$00
+	bne     L0029
+	cmp     #$01
+	beq     L0030
+;
+; ++failures;
+;
+L0029:	inc     _failures
+	bne     L0019
+	inc     _failures+1
+;
+; printf("test_bnegax3(1): %d, expected: 1\n", a);
+;
+L0019:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax4(0);
+;
+	ldx     #$00
+L0030:	txa
+	jsr     _test_bnegax4
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	cpx     #$00
+	bne     L002A
+	cmp     #$00
+	beq     L0031
+;
+; ++failures;
+;
+L002A:	inc     _failures
+	bne     L001C
+	inc     _failures+1
+;
+; printf("test_bnegax4(0): %d, expected: 0\n", a);
+;
+L001C:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax4(1);
+;
+	ldx     #$00
+L0031:	lda     #$01
+	jsr     _test_bnegax4
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	cpx     #$00
+	bne     L002B
+	cmp     #$01
+	beq     L001D
+;
+; ++failures;
+;
+L002B:	inc     _failures
+	bne     L001F
+	inc     _failures+1
+;
+; printf("test_bnegax4(1): %d, expected: 1\n", a);
+;
+L001F:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (failures > 0)
+;
+L001D:	lda     _failures
+	ora     _failures+1
+	beq     L0020
+;
+; printf("failures: %u\n", failures);
+;
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+L0020:	lda     _failures
+	ldx     _failures+1
+;
+; }
+;
+	rts
+
+.endproc
+
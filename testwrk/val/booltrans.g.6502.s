@@ -0,0 +1,943 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "booltrans.c", 2796, 1779181050
+	.dbg		file, "/root/repo/include/stdint.h", 5720, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_failures
+	.export		_a
+	.export		_test_booltrans
+	.export		_test_bnega2
+	.export		_test_bnegax2
+	.export		_f
+	.export		_test_bnegax3
+	.export		_test_bnegax4
+	.export		_main
+
+.segment	"RODATA"
+
+S001B:
+	.byte	$74,$65,$73,$74,$5F,$62,$6F,$6F,$6C,$74,$72,$61,$6E,$73,$28,$31
+	.byte	$29,$3A,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A
+	.byte	$20,$31,$0A,$00
+S001A:
+	.byte	$74,$65,$73,$74,$5F,$62,$6F,$6F,$6C,$74,$72,$61,$6E,$73,$28,$30
+	.byte	$29,$3A,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A
+	.byte	$20,$30,$0A,$00
+S0022:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$34,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S001E:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$32,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S001F:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$32,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S0020:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$33,$28,$30,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30
+	.byte	$0A,$00
+S0021:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$33,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S0023:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$78,$34,$28,$31,$29,$3A
+	.byte	$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31
+	.byte	$0A,$00
+S001D:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$32,$28,$31,$29,$3A,$20
+	.byte	$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$31,$0A
+	.byte	$00
+S001C:
+	.byte	$74,$65,$73,$74,$5F,$62,$6E,$65,$67,$61,$32,$28,$30,$29,$3A,$20
+	.byte	$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$30,$0A
+	.byte	$00
+S0024:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_a:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test_booltrans (signed char x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_booltrans: near
+
+	.dbg	func, "test_booltrans", "00", static, "_test_booltrans"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "booltrans.c", 13
+	jsr     pusha
+;
+; a = x;
+;
+	.dbg	line, "booltrans.c", 14
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0002
+	dex
+L0002:	sta     _a
+	stx     _a+1
+;
+; __asm__("lda #$00");
+;
+	.dbg	line, "booltrans.c", 15
+	lda     #$00
+;
+; __asm__("cmp %v", a);
+;
+	.dbg	line, "booltrans.c", 16
+	cmp     _a
+;
+; __asm__("jsr booleq");
+;
+	.dbg	line, "booltrans.c", 17
+	jsr     booleq
+;
+; __asm__("jeq %g", L1);
+;
+	.dbg	line, "booltrans.c", 18
+	jeq     L0003
+;
+; __asm__("jne %g", L0);
+;
+	.dbg	line, "booltrans.c", 19
+	jne     L0004
+;
+; return 1;
+;
+	.dbg	line, "booltrans.c", 21
+L0003:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return 0;
+;
+	.dbg	line, "booltrans.c", 23
+L0004:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 24
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnega2 (signed char x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnega2: near
+
+	.dbg	func, "test_bnega2", "00", static, "_test_bnega2"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "booltrans.c", 27
+	jsr     pusha
+;
+; a = x;
+;
+	.dbg	line, "booltrans.c", 28
+	ldy     #$00
+	ldx     #$00
+	lda     (c_sp),y
+	bpl     L0002
+	dex
+L0002:	sta     _a
+	stx     _a+1
+;
+; __asm__("lda %v", a);
+;
+	.dbg	line, "booltrans.c", 29
+	lda     _a
+;
+; __asm__("jsr bnega");
+;
+	.dbg	line, "booltrans.c", 30
+	jsr     bnega
+;
+; __asm__("jeq %g", L1);
+;
+	.dbg	line, "booltrans.c", 31
+	jeq     L0003
+;
+; __asm__("jne %g", L0);
+;
+	.dbg	line, "booltrans.c", 32
+	jne     L0004
+;
+; return 1;
+;
+	.dbg	line, "booltrans.c", 34
+L0003:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return 0;
+;
+	.dbg	line, "booltrans.c", 36
+L0004:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 37
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax2: near
+
+	.dbg	func, "test_bnegax2", "00", static, "_test_bnegax2"
+	.dbg	sym, "x", "00", auto, 0
+	.dbg	sym, "a", "00", auto, -2
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "booltrans.c", 40
+	jsr     pushax
+;
+; int a = x;
+;
+	.dbg	line, "booltrans.c", 41
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+;
+; __asm__("ldy #%o+1", a);
+;
+	.dbg	line, "booltrans.c", 42
+	ldy     #$00+1
+;
+; __asm__("jsr ldaxysp");
+;
+	.dbg	line, "booltrans.c", 43
+	jsr     ldaxysp
+;
+; __asm__("jsr bnegax");
+;
+	.dbg	line, "booltrans.c", 44
+	jsr     bnegax
+;
+; __asm__("jeq %g", L1);
+;
+	.dbg	line, "booltrans.c", 45
+	jeq     L0002
+;
+; __asm__("jne %g", L0);
+;
+	.dbg	line, "booltrans.c", 46
+	jne     L0003
+;
+; return 1;
+;
+	.dbg	line, "booltrans.c", 48
+L0002:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return 0;
+;
+	.dbg	line, "booltrans.c", 50
+L0003:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 51
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", static, "_f"
+
+.segment	"CODE"
+
+;
+; void __fastcall__ f(void) {}
+;
+	.dbg	line, "booltrans.c", 53
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax3 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax3: near
+
+	.dbg	func, "test_bnegax3", "00", static, "_test_bnegax3"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "booltrans.c", 56
+	jsr     pushax
+;
+; a = x;
+;
+	.dbg	line, "booltrans.c", 57
+	ldy     #$01
+	jsr     ldaxysp
+	sta     _a
+	stx     _a+1
+;
+; __asm__("lda %v", a);
+;
+	.dbg	line, "booltrans.c", 58
+	lda     _a
+;
+; __asm__("ldx %v+1", a);
+;
+	.dbg	line, "booltrans.c", 59
+	ldx     _a+1
+;
+; __asm__("jsr %v", f);
+;
+	.dbg	line, "booltrans.c", 60
+	jsr     _f
+;
+; __asm__("jsr bnegax");
+;
+	.dbg	line, "booltrans.c", 61
+	jsr     bnegax
+;
+; __asm__("jeq %g", L1);
+;
+	.dbg	line, "booltrans.c", 62
+	jeq     L0002
+;
+; __asm__("jne %g", L0);
+;
+	.dbg	line, "booltrans.c", 63
+	jne     L0003
+;
+; return 1;
+;
+	.dbg	line, "booltrans.c", 65
+L0002:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return 0;
+;
+	.dbg	line, "booltrans.c", 67
+L0003:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 68
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test_bnegax4 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bnegax4: near
+
+	.dbg	func, "test_bnegax4", "00", static, "_test_bnegax4"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "booltrans.c", 71
+	jsr     pushax
+;
+; a = x;
+;
+	.dbg	line, "booltrans.c", 72
+	ldy     #$01
+	jsr     ldaxysp
+	sta     _a
+	stx     _a+1
+;
+; __asm__("lda %v", a);
+;
+	.dbg	line, "booltrans.c", 73
+	lda     _a
+;
+; __asm__("ldx %v+1", a);
+;
+	.dbg	line, "booltrans.c", 74
+	ldx     _a+1
+;
+; __asm__("jsr bnegax");
+;
+	.dbg	line, "booltrans.c", 75
+	jsr     bnegax
+;
+; __asm__("jeq %g", L1);
+;
+	.dbg	line, "booltrans.c", 76
+	jeq     L0002
+;
+; __asm__("jne %g", L0);
+;
+	.dbg	line, "booltrans.c", 77
+	jne     L0003
+;
+; return 1;
+;
+	.dbg	line, "booltrans.c", 79
+L0002:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return 0;
+;
+	.dbg	line, "booltrans.c", 81
+L0003:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 82
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; a = test_booltrans(0);
+;
+	.dbg	line, "booltrans.c", 86
+	ldx     #$00
+	lda     #$00
+	jsr     _test_booltrans
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	.dbg	line, "booltrans.c", 87
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 89
+	inc     _failures
+	bne     L0004
+	inc     _failures+1
+L0004:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_booltrans(0): %d, expected: 0\n", a);
+;
+	.dbg	line, "booltrans.c", 90
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_booltrans(1);
+;
+	.dbg	line, "booltrans.c", 93
+L0002:	ldx     #$00
+	lda     #$01
+	jsr     _test_booltrans
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	.dbg	line, "booltrans.c", 94
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jeq     L0005
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 96
+	inc     _failures
+	bne     L0007
+	inc     _failures+1
+L0007:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_booltrans(1): %d, expected: 1\n", a);
+;
+	.dbg	line, "booltrans.c", 97
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnega2(0);
+;
+	.dbg	line, "booltrans.c", 100
+L0005:	ldx     #$00
+	lda     #$00
+	jsr     _test_bnega2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	.dbg	line, "booltrans.c", 101
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 103
+	inc     _failures
+	bne     L000A
+	inc     _failures+1
+L000A:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnega2(0): %d, expected: 0\n", a);
+;
+	.dbg	line, "booltrans.c", 104
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnega2(1);
+;
+	.dbg	line, "booltrans.c", 107
+L0008:	ldx     #$00
+	lda     #$01
+	jsr     _test_bnega2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	.dbg	line, "booltrans.c", 108
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$01
+L000C:	jsr     boolne
+	jeq     L000B
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 110
+	inc     _failures
+	bne     L000D
+	inc     _failures+1
+L000D:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnega2(1): %d, expected: 1\n", a);
+;
+	.dbg	line, "booltrans.c", 111
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax2(0);
+;
+	.dbg	line, "booltrans.c", 114
+L000B:	ldx     #$00
+	lda     #$00
+	jsr     _test_bnegax2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	.dbg	line, "booltrans.c", 115
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L000F
+	cmp     #$00
+L000F:	jsr     boolne
+	jeq     L000E
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 117
+	inc     _failures
+	bne     L0010
+	inc     _failures+1
+L0010:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax2(0): %d, expected: 0\n", a);
+;
+	.dbg	line, "booltrans.c", 118
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax2(1);
+;
+	.dbg	line, "booltrans.c", 121
+L000E:	ldx     #$00
+	lda     #$01
+	jsr     _test_bnegax2
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	.dbg	line, "booltrans.c", 122
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0012
+	cmp     #$01
+L0012:	jsr     boolne
+	jeq     L0011
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 124
+	inc     _failures
+	bne     L0013
+	inc     _failures+1
+L0013:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax2(1): %d, expected: 1\n", a);
+;
+	.dbg	line, "booltrans.c", 125
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax3(0);
+;
+	.dbg	line, "booltrans.c", 128
+L0011:	ldx     #$00
+	lda     #$00
+	jsr     _test_bnegax3
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	.dbg	line, "booltrans.c", 129
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0015
+	cmp     #$00
+L0015:	jsr     boolne
+	jeq     L0014
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 131
+	inc     _failures
+	bne     L0016
+	inc     _failures+1
+L0016:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax3(0): %d, expected: 0\n", a);
+;
+	.dbg	line, "booltrans.c", 132
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax3(1);
+;
+	.dbg	line, "booltrans.c", 135
+L0014:	ldx     #$00
+	lda     #$01
+	jsr     _test_bnegax3
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	.dbg	line, "booltrans.c", 136
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L0018
+	cmp     #$01
+L0018:	jsr     boolne
+	jeq     L0017
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 138
+	inc     _failures
+	bne     L0019
+	inc     _failures+1
+L0019:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax3(1): %d, expected: 1\n", a);
+;
+	.dbg	line, "booltrans.c", 139
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax4(0);
+;
+	.dbg	line, "booltrans.c", 142
+L0017:	ldx     #$00
+	lda     #$00
+	jsr     _test_bnegax4
+	sta     _a
+	stx     _a+1
+;
+; if (a != 0)
+;
+	.dbg	line, "booltrans.c", 143
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L001B
+	cmp     #$00
+L001B:	jsr     boolne
+	jeq     L001A
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 145
+	inc     _failures
+	bne     L001C
+	inc     _failures+1
+L001C:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax4(0): %d, expected: 0\n", a);
+;
+	.dbg	line, "booltrans.c", 146
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; a = test_bnegax4(1);
+;
+	.dbg	line, "booltrans.c", 149
+L001A:	ldx     #$00
+	lda     #$01
+	jsr     _test_bnegax4
+	sta     _a
+	stx     _a+1
+;
+; if (a != 1)
+;
+	.dbg	line, "booltrans.c", 150
+	lda     _a
+	ldx     _a+1
+	cpx     #$00
+	bne     L001E
+	cmp     #$01
+L001E:	jsr     boolne
+	jeq     L001D
+;
+; ++failures;
+;
+	.dbg	line, "booltrans.c", 152
+	inc     _failures
+	bne     L001F
+	inc     _failures+1
+L001F:	lda     _failures
+	ldx     _failures+1
+;
+; printf("test_bnegax4(1): %d, expected: 1\n", a);
+;
+	.dbg	line, "booltrans.c", 153
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _a
+	ldx     _a+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (failures > 0)
+;
+	.dbg	line, "booltrans.c", 156
+L001D:	lda     _failures
+	ldx     _failures+1
+	cpx     #$00
+	bne     L0021
+	cmp     #$00
+L0021:	jsr     boolne
+	jeq     L0020
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "booltrans.c", 158
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "booltrans.c", 160
+L0020:	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "booltrans.c", 161
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,56 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_n
+	.export		_main
+
+.segment	"DATA"
+
+_n:
+	.byte	$01
+
+.segment	"BSS"
+
+.segment	"ZEROPAGE"
+.segment	"BSS"
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; return (unsigned) &n >= 0x100 ? 0 : 1;
+;
+	lda     #<(_n)
+	cmp     #$00
+	lda     #>(_n)
+	sbc     #$01
+	ldx     #$00
+	bcc     L0004
+	txa
+	rts
+L0004:	lda     #$01
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,68 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bss-name-decl.c", 437, 1779181050
+	.forceimport	__STARTUP__
+	.export		_n
+	.export		_main
+
+.segment	"DATA"
+
+_n:
+	.byte	$01
+
+.segment	"BSS"
+
+.segment	"ZEROPAGE"
+.segment	"BSS"
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; return (unsigned) &n >= 0x100 ? 0 : 1;
+;
+	.dbg	line, "bss-name-decl.c", 21
+	lda     #<(_n)
+	ldx     #>(_n)
+	cmp     #$00
+	txa
+	sbc     #$01
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$01
+L0003:	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bss-name-decl.c", 22
+L0001:	rts
+
+	.dbg	line
+.endproc
+
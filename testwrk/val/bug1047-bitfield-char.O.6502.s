@@ -0,0 +1,268 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_cs:
+	.byte	$0C
+	.byte	$03
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$63,$73,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0008:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_char_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_char_bitfield: near
+
+.segment	"CODE"
+
+;
+; if (cs.a != 4) {
+;
+	lda     _cs
+	and     #$07
+	cmp     #$04
+	beq     L0003
+;
+; printf("Got cs.a = %u, expected 4.\n", cs.a);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _cs
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (cs.b != 1) {
+;
+L0003:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$01
+	beq     L0004
+;
+; printf("Got cs.b = %u, expected 1.\n", cs.b);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (cs.c != 3) {
+;
+L0004:	lda     _cs+1
+	and     #$07
+	cmp     #$03
+	beq     L0005
+;
+; printf("Got cs.c = %u, expected 3.\n", cs.c);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _cs+1
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; cs.a = -1;
+;
+L0005:	lda     _cs
+	ora     #$07
+	sta     _cs
+;
+; cs.b = 6;
+;
+	and     #$C7
+	ora     #$30
+	sta     _cs
+;
+; cs.c = 1;
+;
+	lda     _cs+1
+	and     #$F8
+	ora     #$01
+	sta     _cs+1
+;
+; if (cs.a != 7) {
+;
+	lda     _cs
+	and     #$07
+	cmp     #$07
+	beq     L0006
+;
+; printf("Got cs.a = %u, expected 7.\n", cs.a);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _cs
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (cs.b != 6) {
+;
+L0006:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$06
+	beq     L0007
+;
+; printf("Got cs.b = %u, expected 6.\n", cs.b);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (cs.c != 1) {
+;
+L0007:	lda     _cs+1
+	and     #$07
+	cmp     #$01
+	beq     L0008
+;
+; printf("Got cs.c = %u, expected 1.\n", cs.c);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _cs+1
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_char_bitfield();
+;
+	jsr     _test_char_bitfield
+;
+; printf("failures: %u\n", failures);
+;
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+
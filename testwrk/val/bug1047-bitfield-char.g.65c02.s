@@ -0,0 +1,359 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug1047-bitfield-char.c", 2065, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_cs:
+	.byte	$0C
+	.byte	$03
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$63,$73,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0008:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_char_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_char_bitfield: near
+
+	.dbg	func, "test_char_bitfield", "00", static, "_test_char_bitfield"
+
+.segment	"CODE"
+
+;
+; if (sizeof (cs) != 2) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 37
+	jmp     L0002
+;
+; printf("Got sizeof (cs) = %zu, expected 2.\n", sizeof (cs));
+;
+	.dbg	line, "bug1047-bitfield-char.c", 38
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 39
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (cs.a != 4) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 42
+L0002:	lda     _cs
+	ldx     #$00
+	and     #$07
+	cmp     #$04
+	jsr     boolne
+	jeq     L0003
+;
+; printf("Got cs.a = %u, expected 4.\n", cs.a);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 43
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (cs.b != 1) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 47
+L0003:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+;
+; printf("Got cs.b = %u, expected 1.\n", cs.b);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 48
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (cs.c != 3) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 52
+L0004:	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+;
+; printf("Got cs.c = %u, expected 3.\n", cs.c);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 53
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; cs.a = -1;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 57
+L0005:	lda     _cs
+	ora     #$07
+	sta     _cs
+;
+; cs.b = 6;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 58
+	lda     _cs
+	and     #$C7
+	ora     #$30
+	sta     _cs
+;
+; cs.c = 1;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 59
+	lda     _cs+1
+	and     #$F8
+	ora     #$01
+	sta     _cs+1
+;
+; if (cs.a != 7) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 61
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	cmp     #$07
+	jsr     boolne
+	jeq     L0006
+;
+; printf("Got cs.a = %u, expected 7.\n", cs.a);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 62
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (cs.b != 6) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 66
+L0006:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cmp     #$06
+	jsr     boolne
+	jeq     L0007
+;
+; printf("Got cs.b = %u, expected 6.\n", cs.b);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 67
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; if (cs.c != 1) {
+;
+	.dbg	line, "bug1047-bitfield-char.c", 71
+L0007:	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	cmp     #$01
+	jsr     boolne
+	jeq     L0008
+;
+; printf("Got cs.c = %u, expected 1.\n", cs.c);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 72
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 73
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+;
+; }
+;
+	.dbg	line, "bug1047-bitfield-char.c", 75
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; test_char_bitfield();
+;
+	.dbg	line, "bug1047-bitfield-char.c", 79
+	jsr     _test_char_bitfield
+;
+; printf("failures: %u\n", failures);
+;
+	.dbg	line, "bug1047-bitfield-char.c", 80
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	.dbg	line, "bug1047-bitfield-char.c", 81
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1047-bitfield-char.c", 82
+L0001:	rts
+
+	.dbg	line
+.endproc
+
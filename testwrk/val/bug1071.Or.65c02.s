@@ -0,0 +1,247 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_ghostLevel
+	.export		_level
+	.export		_loop
+	.export		_ghosts
+	.export		_bombs
+	.export		_test1
+	.export		_test2
+	.export		_res
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$65,$73,$74,$32,$20,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$31,$20,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_ghostLevel:
+	.res	2,$00
+_level:
+	.res	1,$00
+_loop:
+	.res	2,$00
+_ghosts:
+	.res	50,$00
+_bombs:
+	.res	15,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+;
+; if((loop<MAX_GHOST_LOOP) && (ghostLevel<MAX_GHOST_LEVEL))
+;
+	lda     _loop+1
+	cmp     #$02
+	bne     L0003
+	lda     _loop
+	cmp     #$58
+L0003:	bcs     L0002
+	lda     _ghostLevel+1
+	cmp     #$01
+	bne     L0005
+	lda     _ghostLevel
+	cmp     #$D2
+L0005:	bcs     L0002
+;
+; return INITIAL_GHOST_SLOWDOWN-(uint16_t)level*256-ghostLevel*8;
+;
+	sec
+	lda     #$3E
+	sbc     _level
+	tax
+	lda     #$80
+	jsr     pushax
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	jsr     shlax3
+	jmp     tossubax
+;
+; return GHOST_MIN_SLOWDOWN;
+;
+L0002:	ldx     #$0B
+	lda     #$B8
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+;
+; if((loop<MAX_GHOST_LOOP) && (ghostLevel<MAX_GHOST_LEVEL))
+;
+	lda     _loop+1
+	cmp     #$02
+	bne     L0003
+	lda     _loop
+	cmp     #$58
+L0003:	bcs     L0002
+	lda     _ghostLevel+1
+	cmp     #$01
+	bne     L0005
+	lda     _ghostLevel
+	cmp     #$D2
+L0005:	bcs     L0002
+;
+; return INITIAL_GHOST_SLOWDOWN-(uint16_t)level*256-ghostLevel*16;
+;
+	sec
+	lda     #$3E
+	sbc     _level
+	tax
+	lda     #$80
+	jsr     pushax
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	jsr     shlax4
+	jmp     tossubax
+;
+; return GHOST_MIN_SLOWDOWN;
+;
+L0002:	ldx     #$0B
+	lda     #$B8
+;
+; }
+;
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; loop = 7;
+;
+	lda     #$07
+	sta     _loop
+	stz     _loop+1
+;
+; ghostLevel = 13;
+;
+	lda     #$0D
+	sta     _ghostLevel
+	stz     _ghostLevel+1
+;
+; level = 3;
+;
+	lda     #$03
+	sta     _level
+;
+; res = test1();
+;
+	jsr     _test1
+	sta     _res
+	stx     _res+1
+;
+; printf("test1 res: %d\n", res);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 15128) return -1;
+;
+	lda     _res+1
+	cmp     #$3B
+	bne     L0006
+	lda     _res
+	cmp     #$18
+	beq     L0002
+L0006:	ldx     #$FF
+	txa
+	rts
+;
+; res = test2();
+;
+L0002:	jsr     _test2
+	sta     _res
+	stx     _res+1
+;
+; printf("test2 res: %d\n", res);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 15024) return -1;
+;
+	lda     _res+1
+	cmp     #$3A
+	bne     L0007
+	lda     _res
+	cmp     #$B0
+	beq     L0004
+L0007:	ldx     #$FF
+	txa
+	rts
+;
+; return 0;
+;
+L0004:	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,156 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memset
+	.export		_rhs
+	.export		_test
+	.export		_res
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_rhs:
+	.res	4,$00
+_res:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+.segment	"CODE"
+
+;
+; return *(char *)0xD77C + rhs;
+;
+	lda     $D77C
+	jsr     pusha0
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     tosulong
+	jmp     tosaddeax
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; memset(*(char *)0xD76C, 11, 0x80);
+;
+	lda     $D76C
+	jsr     pusha0
+	lda     #$0B
+	jsr     pusha0
+	lda     #$80
+	jsr     _memset
+;
+; rhs = 0x10;
+;
+	stz     _rhs+3
+	stz     _rhs+2
+	stz     _rhs+1
+	lda     #$10
+	sta     _rhs
+;
+; *(char *)(0xD77C + rhs) = 13;
+;
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     pusheax
+	lda     #$7C
+	ldx     #$D7
+	jsr     tosadd0ax
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0D
+	sta     (ptr1)
+;
+; *(char *)0xD77C = 23;
+;
+	lda     #$17
+	sta     $D77C
+;
+; *(char *)0xD78C = 42;
+;
+	lda     #$2A
+	sta     $D78C
+;
+; res = test();
+;
+	jsr     _test
+	sta     _res
+	stx     _res+1
+;
+; printf("res: %d\n", res);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != (23 + 0x10)) {
+;
+	lda     _res+1
+	bne     L0004
+	lda     _res
+	cmp     #$27
+	beq     L0002
+;
+; return EXIT_FAILURE;
+;
+L0004:	ldx     #$00
+	lda     #$01
+	rts
+;
+; return EXIT_SUCCESS;
+;
+L0002:	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
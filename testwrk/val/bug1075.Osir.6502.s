@@ -0,0 +1,161 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memset
+	.export		_rhs
+	.export		_test
+	.export		_res
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_rhs:
+	.res	4,$00
+_res:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+.segment	"CODE"
+
+;
+; return *(char *)0xD77C + rhs;
+;
+	lda     $D77C
+	jsr     pusha0
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     tosulong
+	jmp     tosaddeax
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; memset(*(char *)0xD76C, 11, 0x80);
+;
+	ldx     #$00
+	lda     $D76C
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$7F
+	lda     #$0B
+L0002:	sta     (ptr1),y
+	dey
+	bpl     L0002
+;
+; rhs = 0x10;
+;
+	lda     #$00
+	sta     _rhs+3
+	sta     _rhs+2
+	sta     _rhs+1
+	lda     #$10
+	sta     _rhs
+;
+; *(char *)(0xD77C + rhs) = 13;
+;
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     pusheax
+	lda     #$7C
+	ldx     #$D7
+	jsr     tosadd0ax
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0D
+	ldy     #$00
+	sta     (ptr1),y
+;
+; *(char *)0xD77C = 23;
+;
+	lda     #$17
+	sta     $D77C
+;
+; *(char *)0xD78C = 42;
+;
+	lda     #$2A
+	sta     $D78C
+;
+; res = test();
+;
+	jsr     _test
+	sta     _res
+	stx     _res+1
+;
+; printf("res: %d\n", res);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != (23 + 0x10)) {
+;
+	lda     _res+1
+	bne     L0005
+	lda     _res
+	cmp     #$27
+	beq     L0003
+;
+; return EXIT_FAILURE;
+;
+L0005:	ldx     #$00
+	lda     #$01
+	rts
+;
+; return EXIT_SUCCESS;
+;
+L0003:	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.endproc
+
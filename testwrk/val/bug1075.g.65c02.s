@@ -0,0 +1,205 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug1075.c", 598, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/string.h", 5678, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memset
+	.export		_rhs
+	.export		_test
+	.export		_res
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_rhs:
+	.res	4,$00
+_res:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+	.dbg	func, "test", "00", static, "_test"
+
+.segment	"CODE"
+
+;
+; return *(char *)0xD77C + rhs;
+;
+	.dbg	line, "bug1075.c", 13
+	ldx     #$00
+	lda     $D77C
+	jsr     pushax
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     tosulong
+	jsr     tosaddeax
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1075.c", 14
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+
+.segment	"CODE"
+
+;
+; memset(*(char *)0xD76C, 11, 0x80);
+;
+	.dbg	line, "bug1075.c", 20
+	ldx     #$00
+	lda     $D76C
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldx     #$00
+	lda     #$80
+	jsr     _memset
+;
+; rhs = 0x10;
+;
+	.dbg	line, "bug1075.c", 21
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$10
+	ldx     #$00
+	sta     _rhs
+	stx     _rhs+1
+	ldy     sreg
+	sty     _rhs+2
+	ldy     sreg+1
+	sty     _rhs+3
+;
+; *(char *)(0xD77C + rhs) = 13;
+;
+	.dbg	line, "bug1075.c", 22
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     pusheax
+	lda     #$00
+	sta     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$7C
+	ldx     #$D7
+	jsr     tosaddeax
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	ldy     #$00
+	jsr     staspidx
+;
+; *(char *)0xD77C = 23;
+;
+	.dbg	line, "bug1075.c", 23
+	ldx     #$00
+	lda     #$17
+	sta     $D77C
+;
+; *(char *)0xD78C = 42;
+;
+	.dbg	line, "bug1075.c", 24
+	ldx     #$00
+	lda     #$2A
+	sta     $D78C
+;
+; res = test();
+;
+	.dbg	line, "bug1075.c", 25
+	jsr     _test
+	sta     _res
+	stx     _res+1
+;
+; printf("res: %d\n", res);
+;
+	.dbg	line, "bug1075.c", 26
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != (23 + 0x10)) {
+;
+	.dbg	line, "bug1075.c", 27
+	lda     _res
+	ldx     _res+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$27
+L0003:	jsr     boolne
+	jeq     L0002
+;
+; return EXIT_FAILURE;
+;
+	.dbg	line, "bug1075.c", 28
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+;
+; return EXIT_SUCCESS;
+;
+	.dbg	line, "bug1075.c", 30
+L0002:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1075.c", 31
+L0001:	rts
+
+	.dbg	line
+.endproc
+
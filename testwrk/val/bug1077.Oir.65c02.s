@@ -0,0 +1,223 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test1
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+;
+; int a = 0;
+;
+	jsr     push0
+;
+; (&a)[a] = 42;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     c_sp
+	sta     ptr1
+	lda     tmp1
+	adc     c_sp+1
+	sta     ptr1+1
+	lda     #$2A
+	sta     (ptr1)
+	ldy     #$01
+	lda     #$00
+	sta     (ptr1),y
+;
+; return a;
+;
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+;
+; }
+;
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+;
+; int a = 0;
+;
+	jsr     push0
+;
+; int b = 0;
+;
+	jsr     push0
+;
+; (&a)[b] = 42;
+;
+	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$02
+	bcc     L0002
+	inx
+	clc
+L0002:	adc     c_sp
+	sta     ptr1
+	txa
+	adc     c_sp+1
+	sta     ptr1+1
+	lda     #$2A
+	sta     (ptr1)
+	ldy     #$01
+	lda     #$00
+	sta     (ptr1),y
+;
+; return a;
+;
+	ldy     #$03
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+;
+; }
+;
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; int res, ret = EXIT_SUCCESS;
+;
+	jsr     decsp2
+	jsr     push0
+;
+; res = test1();
+;
+	jsr     _test1
+	ldy     #$02
+	jsr     staxysp
+;
+; printf("%d\n", res);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 42) ret = EXIT_FAILURE;
+;
+	ldy     #$03
+	lda     (c_sp),y
+	bne     L0006
+	dey
+	lda     (c_sp),y
+	cmp     #$2A
+	beq     L0002
+L0006:	lda     #$01
+	sta     (c_sp)
+	dea
+	ldy     #$01
+	sta     (c_sp),y
+;
+; res = test2();
+;
+L0002:	jsr     _test2
+	ldy     #$02
+	jsr     staxysp
+;
+; printf("%d\n", res);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 42) ret = EXIT_FAILURE;
+;
+	ldy     #$03
+	lda     (c_sp),y
+	bne     L0007
+	dey
+	lda     (c_sp),y
+	cmp     #$2A
+	beq     L0004
+L0007:	lda     #$01
+	sta     (c_sp)
+	dea
+	ldy     #$01
+	sta     (c_sp),y
+;
+; return ret;
+;
+L0004:	ldy     #$01
+	lda     (c_sp),y
+	tax
+	lda     (c_sp)
+;
+; }
+;
+	rts
+
+.endproc
+
@@ -0,0 +1,243 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug1077.c", 516, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test1
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+	.dbg	func, "test1", "00", static, "_test1"
+	.dbg	sym, "a", "00", auto, -2
+
+.segment	"CODE"
+
+;
+; int a = 0;
+;
+	.dbg	line, "bug1077.c", 8
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+;
+; (&a)[a] = 42;
+;
+	.dbg	line, "bug1077.c", 9
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     leaaxsp
+	jsr     pushax
+	ldx     #$00
+	lda     #$2A
+	ldy     #$00
+	jsr     staxspidx
+;
+; return a;
+;
+	.dbg	line, "bug1077.c", 10
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1077.c", 11
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", static, "_test2"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "b", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; int a = 0;
+;
+	.dbg	line, "bug1077.c", 14
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+;
+; int b = 0;
+;
+	.dbg	line, "bug1077.c", 15
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+;
+; (&a)[b] = 42;
+;
+	.dbg	line, "bug1077.c", 16
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     incax2
+	jsr     leaaxsp
+	jsr     pushax
+	ldx     #$00
+	lda     #$2A
+	ldy     #$00
+	jsr     staxspidx
+;
+; return a;
+;
+	.dbg	line, "bug1077.c", 17
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1077.c", 18
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "res", "00", auto, -2
+	.dbg	sym, "ret", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; int res, ret = EXIT_SUCCESS;
+;
+	.dbg	line, "bug1077.c", 22
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+;
+; res = test1();
+;
+	.dbg	line, "bug1077.c", 23
+	jsr     _test1
+	ldy     #$02
+	jsr     staxysp
+;
+; printf("%d\n", res);
+;
+	.dbg	line, "bug1077.c", 24
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 42) ret = EXIT_FAILURE;
+;
+	.dbg	line, "bug1077.c", 25
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$2A
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+;
+; res = test2();
+;
+	.dbg	line, "bug1077.c", 26
+L0002:	jsr     _test2
+	ldy     #$02
+	jsr     staxysp
+;
+; printf("%d\n", res);
+;
+	.dbg	line, "bug1077.c", 27
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; if (res != 42) ret = EXIT_FAILURE;
+;
+	.dbg	line, "bug1077.c", 28
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$2A
+L0005:	jsr     boolne
+	jeq     L0004
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+;
+; return ret;
+;
+	.dbg	line, "bug1077.c", 30
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1077.c", 31
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,412 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_wwqq
+	.export		_g
+	.export		_h
+	.export		_x
+	.export		_div3
+	.export		_main
+
+.segment	"DATA"
+
+_wwqq:
+	.byte	$00
+	.byte	$52
+	.byte	$00
+	.byte	$43
+	.byte	$00
+_g:
+	.byte	$5D
+	.byte	$00
+_h:
+	.byte	$5D
+	.byte	$00
+_x:
+	.byte	$04
+	.byte	$35
+	.res	1,$00
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$28,$6C,$6F,$6E,$67,$29,$78,$2E,$62,$20,$3D,$20,$25,$6C,$64,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$78,$29,$20,$3D,$20,$25,$75,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$28,$6C,$6F,$6E,$67,$29,$78,$2E
+	.byte	$61,$29,$20,$3D,$20,$25,$75,$0A,$00
+S0009:
+	.byte	$2D,$78,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$28,$6C,$6F,$6E,$67
+	.byte	$29,$28,$2D,$78,$2E,$63,$20,$2B,$20,$31,$29,$20,$3D,$20,$25,$6C
+	.byte	$64,$0A,$00
+S0007:
+	.byte	$78,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$78,$2E,$62,$20,$3D,$20
+	.byte	$25,$64,$2C,$20,$78,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$67,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$67,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$67,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$68,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$68,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$68,$2E,$63,$20,$3D,$20,$25,$75,$0A,$00
+S0004:
+	.byte	$71,$75,$6F,$74,$20,$3D,$20,$25,$75,$2C,$20,$72,$65,$6D,$20,$3D
+	.byte	$20,$25,$75,$0A,$00
+S0003	:=	S0004+0
+S0005	:=	S0004+0
+S0002:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; struct $anon-struct-000A __near__ div3 (struct $anon-struct-000A u)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_div3: near
+
+.segment	"CODE"
+
+;
+; {
+;
+	jsr     pusheax
+;
+; udiv_t v = {};
+;
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; u.quot = 341 + u.quot;
+;
+	ldy     #$05
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	clc
+	adc     #$55
+	bcc     L0003
+	inx
+L0003:	inx
+	jsr     staxysp
+;
+; u.rem = 1 + u.rem;
+;
+	ldy     #$07
+	lda     (c_sp),y
+	tax
+	dey
+	lda     (c_sp),y
+	ina
+	bne     L0004
+	inx
+L0004:	jsr     staxysp
+;
+; v = u;
+;
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     steax0sp
+;
+; return v;
+;
+	jsr     ldeax0sp
+;
+; }
+;
+	jmp     incsp8
+
+.segment	"RODATA"
+
+M0001:
+	.res	4,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; udiv_t v = { 141, 32 };
+;
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; big_t  b = { 141, 32 };
+;
+	ldy     #$0C
+	jsr     subysp
+	ldy     #$0B
+L0003:	lda     M0002,y
+	sta     (c_sp),y
+	dey
+	bpl     L0003
+;
+; v = div3(*(udiv_t*)&b);
+;
+	jsr     ldeax0sp
+	jsr     _div3
+	ldy     #$0C
+	jsr     steaxysp
+;
+; printf("%d %d %d\n", (int)wwqq.a, wwqq.x[0].b, wwqq.x[0].c);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _wwqq
+	and     #$0F
+	jsr     pusha0
+	lda     _wwqq+1
+	and     #$0F
+	jsr     pusha0
+	lda     _wwqq+1
+	ldx     _wwqq+1+1
+	jsr     shrax4
+	jsr     pusha0
+	ldy     #$08
+	jsr     _printf
+;
+; printf("%d %d %d\n", (int)wwqq.a, wwqq.x[1].b, wwqq.x[1].c);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _wwqq
+	and     #$0F
+	jsr     pusha0
+	lda     _wwqq+3
+	and     #$0F
+	jsr     pusha0
+	lda     _wwqq+3
+	ldx     _wwqq+3+1
+	jsr     shrax4
+	jsr     pusha0
+	ldy     #$08
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", div3(v).quot, div3(v).rem);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldeaxysp
+	jsr     _div3
+	jsr     pushax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     _div3
+	ldx     sreg+1
+	lda     sreg
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", v.quot, v.rem);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", b.quot, b.rem);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+;
+; printf("g.a = %u, g.b = %u, g.c = %d\n", g.a, g.b, g.c);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _g
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	bcs     L0004
+	dex
+L0004:	jsr     pushax
+	lda     _g
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	bcs     L0005
+	dex
+L0005:	jsr     pushax
+	lda     _g
+	ldx     _g+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	bcs     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; x.e = 1467;
+;
+	ldx     #$05
+	lda     #$BB
+	sta     _x
+	stx     _x+1
+;
+; printf("x.a = %d, x.b = %d, x.c = %d\n", x.a, x.b, x.c);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _x
+	and     #$07
+	jsr     pusha0
+	lda     _x+1
+	and     #$07
+	jsr     pusha0
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	ldy     #$08
+	jsr     _printf
+;
+; printf("(long)x.b = %ld, sizeof(x) = %u, sizeof((long)x.a) = %u\n", (long)x.b, sizeof(x), sizeof((long)x.a));
+;
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _x+1
+	ldx     #$00
+	and     #$07
+	jsr     push0ax
+	lda     #$03
+	jsr     pusha0
+	ina
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _printf
+;
+; printf("-x.d = %d, (long)(-x.c + 1) = %ld\n", -x.d, (long)(-x.c + 1));
+;
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _x+1
+	ldx     _x+1+1
+	jsr     negax
+	jsr     pushax
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	ldx     #$FF
+	eor     #$FF
+	clc
+	adc     #$01
+	bcc     L0008
+	inx
+L0008:	ina
+	bne     L0007
+	inx
+L0007:	jsr     axlong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+;
+; printf("h.a = %u, h.b = %u, h.c = %u\n", h.a, h.b, h.c);
+;
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _h
+	and     #$07
+	jsr     pusha0
+	lda     _h
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	lda     _h
+	ldx     _h+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$07
+	jsr     pusha0
+	ldy     #$08
+	jsr     _printf
+;
+; return 0;
+;
+	ldx     #$00
+	txa
+;
+; }
+;
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$008D
+	.word	$0020
+M0002:
+	.word	$008D
+	.word	$0020
+	.res	8,$00
+
+.endproc
+
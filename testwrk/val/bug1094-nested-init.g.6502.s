@@ -0,0 +1,456 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.dbg		file, "bug1094-nested-init.c", 1925, 1779181050
+	.dbg		file, "/root/repo/include/stdio.h", 6999, 1779181050
+	.dbg		file, "/root/repo/include/stddef.h", 3037, 1779181050
+	.dbg		file, "/root/repo/include/stdlib.h", 6948, 1779181050
+	.dbg		file, "/root/repo/include/stdint.h", 5720, 1779181050
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_wwqq
+	.export		_g
+	.export		_h
+	.export		_x
+	.export		_div3
+	.export		_main
+
+.segment	"DATA"
+
+_wwqq:
+	.byte	$00
+	.byte	$52
+	.byte	$00
+	.byte	$43
+	.byte	$00
+_g:
+	.byte	$5D
+	.byte	$00
+_h:
+	.byte	$5D
+	.byte	$00
+_x:
+	.byte	$04
+	.byte	$35
+	.res	1,$00
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$28,$6C,$6F,$6E,$67,$29,$78,$2E,$62,$20,$3D,$20,$25,$6C,$64,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$78,$29,$20,$3D,$20,$25,$75,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$28,$6C,$6F,$6E,$67,$29,$78,$2E
+	.byte	$61,$29,$20,$3D,$20,$25,$75,$0A,$00
+S0009:
+	.byte	$2D,$78,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$28,$6C,$6F,$6E,$67
+	.byte	$29,$28,$2D,$78,$2E,$63,$20,$2B,$20,$31,$29,$20,$3D,$20,$25,$6C
+	.byte	$64,$0A,$00
+S0007:
+	.byte	$78,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$78,$2E,$62,$20,$3D,$20
+	.byte	$25,$64,$2C,$20,$78,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$67,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$67,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$67,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$68,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$68,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$68,$2E,$63,$20,$3D,$20,$25,$75,$0A,$00
+S0004:
+	.byte	$71,$75,$6F,$74,$20,$3D,$20,$25,$75,$2C,$20,$72,$65,$6D,$20,$3D
+	.byte	$20,$25,$75,$0A,$00
+S0003	:=	S0004+0
+S0005	:=	S0004+0
+S0002:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; struct $anon-struct-000A __near__ div3 (struct $anon-struct-000A u)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_div3: near
+
+	.dbg	func, "div3", "00", static, "_div3"
+	.dbg	sym, "u", "00", auto, 0
+	.dbg	sym, "v", "00", auto, -4
+
+.segment	"CODE"
+
+;
+; {
+;
+	.dbg	line, "bug1094-nested-init.c", 68
+	jsr     pusheax
+;
+; udiv_t v = {};
+;
+	.dbg	line, "bug1094-nested-init.c", 69
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; u.quot = 341 + u.quot;
+;
+	.dbg	line, "bug1094-nested-init.c", 71
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$01
+	lda     #$55
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+;
+; u.rem = 1 + u.rem;
+;
+	.dbg	line, "bug1094-nested-init.c", 72
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$06
+	jsr     staxysp
+;
+; v = u;
+;
+	.dbg	line, "bug1094-nested-init.c", 74
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     #$00
+	jsr     steaxysp
+;
+; return v;
+;
+	.dbg	line, "bug1094-nested-init.c", 76
+	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1094-nested-init.c", 77
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.res	4,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", static, "_main"
+	.dbg	sym, "v", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -16
+
+.segment	"CODE"
+
+;
+; udiv_t v = { 141, 32 };
+;
+	.dbg	line, "bug1094-nested-init.c", 81
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (c_sp),y
+	dey
+	bpl     L0002
+;
+; big_t  b = { 141, 32 };
+;
+	.dbg	line, "bug1094-nested-init.c", 82
+	ldy     #$0C
+	jsr     subysp
+	ldy     #$0B
+L0003:	lda     M0002,y
+	sta     (c_sp),y
+	dey
+	bpl     L0003
+;
+; v = div3(*(udiv_t*)&b);
+;
+	.dbg	line, "bug1094-nested-init.c", 84
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     _div3
+	ldy     #$0C
+	jsr     steaxysp
+;
+; printf("%d %d %d\n", (int)wwqq.a, wwqq.x[0].b, wwqq.x[0].c);
+;
+	.dbg	line, "bug1094-nested-init.c", 86
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _wwqq
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+1
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+1
+	ldx     _wwqq+1+1
+	jsr     shrax4
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; printf("%d %d %d\n", (int)wwqq.a, wwqq.x[1].b, wwqq.x[1].c);
+;
+	.dbg	line, "bug1094-nested-init.c", 87
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _wwqq
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+3
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+3
+	ldx     _wwqq+3+1
+	jsr     shrax4
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", div3(v).quot, div3(v).rem);
+;
+	.dbg	line, "bug1094-nested-init.c", 88
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldeaxysp
+	jsr     _div3
+	jsr     pushax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     _div3
+	ldy     #$00
+	ldx     sreg+1
+	lda     sreg
+	sty     sreg+1
+	sty     sreg
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", v.quot, v.rem);
+;
+	.dbg	line, "bug1094-nested-init.c", 89
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+;
+; printf("quot = %u, rem = %u\n", b.quot, b.rem);
+;
+	.dbg	line, "bug1094-nested-init.c", 90
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+;
+; printf("g.a = %u, g.b = %u, g.c = %d\n", g.a, g.b, g.c);
+;
+	.dbg	line, "bug1094-nested-init.c", 91
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _g
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	lda     _g
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	lda     _g
+	ldx     _g+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; x.e = 1467;
+;
+	.dbg	line, "bug1094-nested-init.c", 92
+	ldx     #$05
+	lda     #$BB
+	sta     _x
+	stx     _x+1
+;
+; printf("x.a = %d, x.b = %d, x.c = %d\n", x.a, x.b, x.c);
+;
+	.dbg	line, "bug1094-nested-init.c", 93
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _x
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _x+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; printf("(long)x.b = %ld, sizeof(x) = %u, sizeof((long)x.a) = %u\n", (long)x.b, sizeof(x), sizeof((long)x.a));
+;
+	.dbg	line, "bug1094-nested-init.c", 94
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _x+1
+	ldx     #$00
+	and     #$07
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+;
+; printf("-x.d = %d, (long)(-x.c + 1) = %ld\n", -x.d, (long)(-x.c + 1));
+;
+	.dbg	line, "bug1094-nested-init.c", 95
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _x+1
+	ldx     _x+1+1
+	jsr     negax
+	jsr     pushax
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     negax
+	jsr     incax1
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+;
+; printf("h.a = %u, h.b = %u, h.c = %u\n", h.a, h.b, h.c);
+;
+	.dbg	line, "bug1094-nested-init.c", 96
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _h
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _h
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _h
+	ldx     _h+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+;
+; return 0;
+;
+	.dbg	line, "bug1094-nested-init.c", 98
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+;
+; }
+;
+	.dbg	line, "bug1094-nested-init.c", 99
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$008D
+	.word	$0020
+M0002:
+	.word	$008D
+	.word	$0020
+	.res	8,$00
+
+.endproc
+
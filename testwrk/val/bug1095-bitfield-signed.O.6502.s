@@ -0,0 +1,961 @@
+;
+; File generated by cc65 v 2.19 - Git 690def709
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 690def709"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	c_sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.importzp	zpargs
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_si:
+	.byte	$FC
+	.byte	$18
+	.byte	$04
+	.byte	$9C
+	.byte	$78
+	.byte	$EC
+
+.segment	"RODATA"
+
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0001	:=	S000D+0
+S000C:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$30,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$30,$30,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$30,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$32,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$34,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0019:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_bitfield: near
+
+.segment	"CODE"
+
+;
+; if (si.a >= 0) {
+;
+	lda     _si
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	tax
+	bmi     L0002
+;
+; printf("Got si.a = %d, expected negative.\n", si.a);
+;
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _si
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.a != -4) {
+;
+L0002:	lda     _si
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$FC
+	beq     L0003
+;
+; printf("Got si.a = %d, expected -4.\n", si.a);
+;
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _si
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.b >= 0) {
+;
+L0003:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	tax
+	bmi     L0004
+;
+; printf("Got si.b = %d, expected negative.\n", si.b);
+;
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.b != -1) {
+;
+L0004:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$FF
+	beq     L0005
+;
+; printf("Got si.b = %d, expected -1.\n", si.b);
+;
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.c <= 0) {
+;
+L0005:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	sec
+	sbc     #$01
+	bvc     L0007
+	eor     #$80
+L0007:	bpl     L0006
+;
+; printf("Got si.c = %d, expected positive.\n", si.c);
+;
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.c != 3) {
+;
+L0006:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$03
+	beq     L0008
+;
+; printf("Got si.c = %d, expected 3.\n", si.c);
+;
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.d >= 0) {
+;
+L0008:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	bmi     L0009
+;
+; printf("Got si.d = %d, expected negative.\n", si.d);
+;
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.d != -500) {
+;
+L0009:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$FE
+	bne     L002C
+	cmp     #$0C
+	beq     L000A
+;
+; printf("Got si.d = %d, expected -500.\n", si.d);
+;
+L002C:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.e >= 0) {
+;
+L000A:	ldx     _si+3
+	bmi     L000C
+;
+; printf("Got si.e = %d, expected negative.\n", si.e);
+;
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L000E
+	dex
+L000E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.e != -100) {
+;
+L000C:	lda     _si+3
+	cmp     #$9C
+	beq     L000F
+;
+; printf("Got si.e = %d, expected -100.\n", si.e);
+;
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0011
+	dex
+L0011:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.f >= 0) {
+;
+L000F:	ldx     _si+4+1
+	bmi     L0012
+;
+; printf("Got si.f = %d, expected negative.\n", si.f);
+;
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.f != -5000) {
+;
+L0012:	lda     _si+4+1
+	cmp     #$EC
+	bne     L002D
+	lda     _si+4
+	cmp     #$78
+	beq     L0013
+;
+; printf("Got si.f = %d, expected -5000.\n", si.f);
+;
+L002D:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; si.a = -3;
+;
+L0013:	lda     _si
+	and     #$F8
+	ora     #$05
+	sta     _si
+;
+; si.b = 1;
+;
+	and     #$C7
+	ora     #$08
+	sta     _si
+;
+; si.c = -2;
+;
+	tay
+	lda     _si+1
+	and     #$FE
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	sta     _si
+	txa
+	ora     #$01
+	sta     _si+1
+;
+; si.d = 500;
+;
+	lda     _si+1+1
+	and     #$F8
+	tax
+	lda     _si+1
+	and     #$01
+	ora     #$E8
+	sta     _si+1
+	txa
+	ora     #$03
+	sta     _si+1+1
+;
+; si.e = 100;
+;
+	lda     #$64
+	sta     _si+3
+;
+; si.f = 5000;
+;
+	ldx     #$13
+	lda     #$88
+	sta     _si+4
+	stx     _si+4+1
+;
+; if (si.a >= 0) {
+;
+	lda     _si
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	tax
+	bmi     L0015
+;
+; printf("Got si.a = %d, expected negative.\n", si.a);
+;
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _si
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.a != -3) {
+;
+L0015:	lda     _si
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$FD
+	beq     L0016
+;
+; printf("Got si.a = %d, expected -3.\n", si.a);
+;
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _si
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.b <= 0) {
+;
+L0016:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	sec
+	sbc     #$01
+	bvc     L0018
+	eor     #$80
+L0018:	bpl     L0017
+;
+; printf("Got si.b = %d, expected positive.\n", si.b);
+;
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.b != 1) {
+;
+L0017:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$01
+	beq     L0019
+;
+; printf("Got si.b = %d, expected 1.\n", si.b);
+;
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.c >= 0) {
+;
+L0019:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	tax
+	bmi     L001A
+;
+; printf("Got si.c = %d, expected negative.\n", si.c);
+;
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.c != -2) {
+;
+L001A:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$07
+	eor     #$04
+	sec
+	sbc     #$04
+	cmp     #$FE
+	beq     L001B
+;
+; printf("Got si.c = %d, expected -2.\n", si.c);
+;
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	eor     #$04
+	jsr     decax4
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.d <= 0) {
+;
+L001B:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L001D
+	eor     #$80
+L001D:	bpl     L001C
+;
+; printf("Got si.d = %d, expected positive.\n", si.d);
+;
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.d != 500) {
+;
+L001C:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	cpx     #$01
+	bne     L002E
+	cmp     #$F4
+	beq     L001E
+;
+; printf("Got si.d = %d, expected 500.\n", si.d);
+;
+L002E:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$03
+	eor     #$02
+	sec
+	sbc     #$02
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.e <= 0) {
+;
+L001E:	lda     _si+3
+	sec
+	sbc     #$01
+	bvc     L0022
+	eor     #$80
+L0022:	bpl     L002B
+;
+; printf("Got si.e = %d, expected positive.\n", si.e);
+;
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0023
+	dex
+L0023:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.e != 100) {
+;
+L002B:	lda     _si+3
+	cmp     #$64
+	beq     L0024
+;
+; printf("Got si.e = %d, expected 100.\n", si.e);
+;
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0026
+	dex
+L0026:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.f <= 0) {
+;
+L0024:	lda     _si+4
+	cmp     #$01
+	lda     _si+4+1
+	sbc     #$00
+	bvc     L0028
+	eor     #$80
+L0028:	bpl     L0027
+;
+; printf("Got si.f = %d, expected positive.\n", si.f);
+;
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; if (si.f != 5000) {
+;
+L0027:	lda     _si+4+1
+	cmp     #$13
+	bne     L002F
+	lda     _si+4
+	cmp     #$88
+	beq     L0029
+;
+; printf("Got si.f = %d, expected 5000.\n", si.f);
+;
+L002F:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+;
+; failures++;
+;
+	inc     _failures
+;
+; }
+;
+L0029:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+;
+; test_signed_bitfield();
+;
+	jsr     _test_signed_bitfield
+;
+; printf("failures: %u\n", failures);
+;
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+;
+; return failures;
+;
+	ldx     #$00
+	lda     _failures
+;
+; }
+;
+	rts
+
+.endproc
+